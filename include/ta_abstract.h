@@ -149,6 +149,21 @@ typedef unsigned int TA_FuncHandle;
 TA_LIB_API TA_RetCode TA_GetFuncHandle( const char *name,
                                         const TA_FuncHandle **handle );
 
+/* Each function also has an id, which never changes between the
+ * versions of TA-Lib. A new function gets a new id, and the id of a
+ * removed function is never re-used. The ids can be saved in a file,
+ * or used as an index in the tables of the application.
+ *
+ * The ids go from 1 to TA_GetFuncIdMax() (some ids may be of removed
+ * functions, for which TA_GetFuncHandleById returns TA_FUNC_NOT_FOUND).
+ *
+ * TA_GetFuncHandle, TA_GetFuncId and TA_GetFuncHandleById take the
+ * same time whatever the number of functions.
+ */
+TA_LIB_API TA_RetCode   TA_GetFuncId( const TA_FuncHandle *handle, unsigned int *id );
+TA_LIB_API TA_RetCode   TA_GetFuncHandleById( unsigned int id, const TA_FuncHandle **handle );
+TA_LIB_API unsigned int TA_GetFuncIdMax( void );
+
 /* Get some basic information about a function.
  *
  * A const pointer will be set on the corresponding TA_FuncInfo structure.
@@ -205,6 +220,56 @@ typedef struct TA_FuncInfo
 TA_LIB_API TA_RetCode TA_GetFuncInfo( const TA_FuncHandle *handle,
                                       const TA_FuncInfo **funcInfo );
 
+/* Statistics of the calls of each function.
+ *
+ * The statistics are available only when TA-Lib is built with
+ * TA_FUNC_STATS defined (cmake -DTA_FUNC_STATS=ON). Otherwise these
+ * functions return TA_NOT_SUPPORTED and the calls have no overhead.
+ *
+ * Nothing is collected until TA_SetFuncStats(1). From then, the
+ * calls made through TA_CallFunc, TA_CallFuncContext,
+ * TA_CallFuncParallel (one call per chunk), TA_CallFuncBatch (one
+ * call per symbol) and the call plans are counted by the thread
+ * doing them, in its own counters. TA_GetFuncStats adds the counters
+ * of all the threads. The values of the calls in progress may be
+ * missing. TA_GetFuncStats and TA_ResetFuncStats can be called
+ * while other threads are doing calls, a call ending meanwhile
+ * may then be counted for only some of its values.
+ *
+ * The direct calls of the functions (TA_MA, TA_RSI...) are not
+ * counted, only the calls made through the functions above.
+ *
+ * nbBar is the sum of the ranges (endIdx-startIdx+1), totalNs and
+ * maxNs the time in the function, nbAlloc the number of memory
+ * allocations (see TA_SetAllocator in ta_common.h).
+ *
+ * Example (which function takes the most time):
+ *    void printStats( const TA_FuncInfo *funcInfo, void *opaqueData )
+ *    {
+ *       TA_FuncStats stats;
+ *
+ *       TA_GetFuncStats( funcInfo->handle, &stats );
+ *       if( stats.nbCall )
+ *          printf( "%s %llu ns\n", funcInfo->name, stats.totalNs );
+ *    }
+ *
+ *    TA_SetFuncStats( 1 );
+ *    ...
+ *    TA_ForEachFunc( printStats, NULL );
+ */
+typedef struct TA_FuncStats
+{
+   unsigned long long nbCall;
+   unsigned long long nbBar;
+   unsigned long long totalNs;
+   unsigned long long maxNs;
+   unsigned long long nbAlloc;
+} TA_FuncStats;
+
+TA_LIB_API TA_RetCode TA_SetFuncStats  ( int enable );
+TA_LIB_API TA_RetCode TA_GetFuncStats  ( const TA_FuncHandle *handle, TA_FuncStats *stats );
+TA_LIB_API TA_RetCode TA_ResetFuncStats( void );
+
 
 /* An alternate way to access all the functions is through the
  * use of the TA_ForEachFunc(). You can setup a function to be
@@ -540,6 +605,201 @@ TA_LIB_API TA_RetCode TA_CallFunc( const TA_ParamHolder *params,
                                    TA_Integer           *outBegIdx,
                                    TA_Integer           *outNbElement );
 
+/* Same as TA_CallFunc, but the TA function uses the settings of the
+ * provided TA_Context instead of the ones of the calling thread
+ * (see TA_SetThreadContext in ta_common.h).
+ *
+ * The settings of the calling thread are unchanged on return.
+ */
+TA_LIB_API TA_RetCode TA_CallFuncContext( const TA_Context     *context,
+                                          const TA_ParamHolder *params,
+                                          TA_Integer            startIdx,
+                                          TA_Integer            endIdx,
+                                          TA_Integer           *outBegIdx,
+                                          TA_Integer           *outNbElement );
+
+/* Same as TA_CallFunc, but the range is split among the threads
+ * of a TA_ThreadPool.
+ *
+ * Only the functions calculating each output from a finite window of
+ * input, always the same way, are split: the groups "Math Transform"
+ * and "Price Transform", the group "Math Operators" except SUM and
+ * the *INDEX functions, plus AROON, AROONOSC, AVGDEV, BOP, MIDPOINT,
+ * MIDPRICE, MOM, ROC*, TRANGE and WILLR. The other functions (and the
+ * small ranges) are done by the calling thread only, as TA_CallFunc
+ * would. The *INDEX functions would return another index when the
+ * extreme is tied.
+ *
+ * CCI, LINEARREG* and TSF are split too. They start their sums again
+ * every optInTimePeriod bars, so their chunks are a multiple of
+ * optInTimePeriod bars and start their sums where TA_CallFunc does.
+ *
+ * Each chunk is the same as a TA_CallFunc on a part of the range,
+ * using the settings of the calling thread (see TA_SetThreadContext).
+ * The output is identical to the one of TA_CallFunc.
+ *
+ * The other threads also allocate with the allocator of the calling
+ * thread (see TA_SetThreadAllocator in ta_common.h), which must so
+ * accept allocations from several threads at the same time. A
+ * TA_Arena is an exception: only the calling thread allocates from
+ * it, the other threads use the allocator shared by all threads. The
+ * temporary buffers of the functions having a TA_XXX_Workspace (see
+ * ta_func_ext.h) are taken from a workspace allocated once by the
+ * calling thread instead.
+ *
+ * In TA_MATH_FAST (see TA_SetMathMode), the functions carrying running
+ * sums from the start of the range to its end are split too: SUM, SMA,
+ * WMA, STDDEV, VAR, CORREL, BETA and the group "Pattern Recognition".
+ * Their sums at the start of a chunk depend on all the bars before it,
+ * so no chunk can give the same output without doing these bars first.
+ * Each chunk instead starts its sums again on the bars before it, so
+ * the output is the one of TA_CallFunc called on that chunk. It
+ * differs from the one of TA_CallFunc on the whole range by the
+ * rounding errors its running sums accumulated, which grow with the
+ * number of bars. For example, on 10M bars of prices around 100, the
+ * largest difference is 2e-11 for SMA 30 and 3e-6 for STDDEV 20 and
+ * WMA 30. A candlestick could differ only when a candle is exactly at
+ * the limit of a candle setting. Keep TA_MATH_STRICT (the default)
+ * for an output always identical to TA_CallFunc.
+ *
+ * The range is split in more chunks than threads. Each thread has its
+ * own queue of consecutive chunks, and steals half of the chunks left
+ * to another thread when its queue is empty.
+ *
+ * A TA_ThreadPool is for nbThread threads, including the thread
+ * calling TA_CallFuncParallel (0 for one thread per processor).
+ * Calls from many threads on the same pool are done one at the time.
+ *
+ * Example:
+ *    TA_ThreadPool *pool;
+ *
+ *    TA_ThreadPoolAlloc( &pool, 0 );
+ *    ...
+ *    retCode = TA_CallFuncParallel( pool, params, 0, 9999999,
+ *                                   &outBegIdx, &outNbElement );
+ *    ...
+ *    TA_ThreadPoolFree( pool );
+ */
+typedef struct TA_ThreadPool TA_ThreadPool;
+
+TA_LIB_API TA_RetCode TA_ThreadPoolAlloc( TA_ThreadPool **pool, unsigned int nbThread );
+TA_LIB_API TA_RetCode TA_ThreadPoolFree ( TA_ThreadPool *pool );
+
+TA_LIB_API unsigned int TA_ThreadPoolGetNbThread( const TA_ThreadPool *pool );
+
+TA_LIB_API TA_RetCode TA_CallFuncParallel( TA_ThreadPool        *pool,
+                                           const TA_ParamHolder *params,
+                                           TA_Integer            startIdx,
+                                           TA_Integer            endIdx,
+                                           TA_Integer           *outBegIdx,
+                                           TA_Integer           *outNbElement );
+
+/* Call the same TA function, with the same optional inputs, for many
+ * symbols.
+ *
+ * The function and its optional inputs are the ones of 'params' (its
+ * inputs and outputs do not need to be set, they are ignored).
+ *
+ * For each symbol, 'in' points on the inputs in the same order as the
+ * function: one pointer for each TA_Input_Real (TA_Real *) or
+ * TA_Input_Integer (TA_Integer *), and for a TA_Input_Price one
+ * TA_Real pointer for each of its flags, in the order open, high,
+ * low, close, volume and openInterest. 'out' points on one TA_Real or
+ * TA_Integer pointer for each output.
+ *
+ * The symbols are split among the threads of the pool (or done by the
+ * calling thread only if pool is NULL). Each thread gets its own queue
+ * of symbols, the longest series first, with about the same total
+ * number of bars in each queue. A thread whose queue is empty steals
+ * half of the symbols left to another thread.
+ * The outBegIdx, outNbElement and retCode of each symbol are the ones
+ * of its own TA_CallFunc. TA_SUCCESS is returned only when all the
+ * symbols succeed. The allocator and the workspace of the threads are
+ * the same as with TA_CallFuncParallel.
+ *
+ * Example (CDLDOJI uses open, high, low and close):
+ *    const void *in[4];
+ *    void *out[1];
+ *
+ *    in[0] = open; in[1] = high; in[2] = low; in[3] = close;
+ *    out[0] = outInteger;
+ *    symbol[0].in  = in;
+ *    symbol[0].out = out;
+ *    symbol[0].startIdx = 0;
+ *    symbol[0].endIdx   = nbBars-1;
+ *    ...
+ *    retCode = TA_CallFuncBatch( pool, params, symbol, nbSymbol );
+ */
+typedef struct
+{
+   /* Provided by the caller. */
+   const void * const *in;
+   void * const       *out;
+   TA_Integer          startIdx;
+   TA_Integer          endIdx;
+
+   /* Set by TA_CallFuncBatch. */
+   TA_Integer          outBegIdx;
+   TA_Integer          outNbElement;
+   TA_RetCode          retCode;
+} TA_BatchSymbol;
+
+TA_LIB_API TA_RetCode TA_CallFuncBatch( TA_ThreadPool        *pool,
+                                        const TA_ParamHolder *params,
+                                        TA_BatchSymbol       *symbol,
+                                        unsigned int          nbSymbol );
+
+/* A call plan is a TA_ParamHolder prepared once for being called
+ * many times, for example on many short series.
+ *
+ * TA_CallPlanAlloc does the checks of TA_CallFunc once and keeps a
+ * copy of the parameters: changing or freeing the TA_ParamHolder
+ * afterward does not change the plan. TA_CallPlanRun then calls the
+ * TA function directly, with the same result as TA_CallFunc.
+ *
+ * TA_CallPlanRunWith does the same with other inputs and outputs,
+ * given as for a TA_BatchSymbol ('in' and 'out' of TA_CallFuncBatch).
+ *
+ * A plan is never modified once allocated, so many threads can run
+ * the same plan at the same time (with different outputs).
+ *
+ * Example (SMA of many series):
+ *    const void *in[1];
+ *    void *out[1];
+ *    TA_CallPlan *plan;
+ *
+ *    retCode = TA_CallPlanAlloc( params, &plan );
+ *    for( i=0; i < nbSeries; i++ )
+ *    {
+ *       in[0]  = series[i];
+ *       out[0] = result[i];
+ *       retCode = TA_CallPlanRunWith( plan, in, out, 0, nbBars-1,
+ *                                     &outBegIdx, &outNbElement );
+ *    }
+ *    TA_CallPlanFree( plan );
+ */
+typedef struct TA_CallPlan TA_CallPlan;
+
+TA_LIB_API TA_RetCode TA_CallPlanAlloc( const TA_ParamHolder *params, TA_CallPlan **plan );
+TA_LIB_API TA_RetCode TA_CallPlanFree ( TA_CallPlan *plan );
+
+TA_LIB_API TA_RetCode TA_CallPlanRun( const TA_CallPlan *plan,
+                                      TA_Integer         startIdx,
+                                      TA_Integer         endIdx,
+                                      TA_Integer        *outBegIdx,
+                                      TA_Integer        *outNbElement );
+
+TA_LIB_API TA_RetCode TA_CallPlanRunWith( const TA_CallPlan  *plan,
+                                          const void * const *in,
+                                          void * const       *out,
+                                          TA_Integer          startIdx,
+                                          TA_Integer          endIdx,
+                                          TA_Integer         *outBegIdx,
+                                          TA_Integer         *outNbElement );
+
+/* Same as TA_GetLookback, for the parameters of the plan. */
+TA_LIB_API TA_RetCode TA_CallPlanLookback( const TA_CallPlan *plan, TA_Integer *lookback );
+
 
 /* Return XML representation of all the TA functions.
  * The returned array is the same as the ta_func_api.xml file.
@@ -41,7 +41,7 @@
  * use the "NEXT AVAILABLE NUMBER" and increment the
  * number in this file.
  *
- * NEXT AVAILABLE NUMBER: 181
+ * NEXT AVAILABLE NUMBER: 188
  */
 #define TA_INTERNAL_ERROR(Id) ((TA_RetCode)(TA_INTERNAL_ERROR+Id))
 
@@ -146,6 +146,175 @@ TA_LIB_API void TA_SetRetCodeInfo( TA_RetCode theRetCode, TA_RetCodeInfo *retCod
 TA_LIB_API TA_RetCode TA_Initialize( void );
 TA_LIB_API TA_RetCode TA_Shutdown( void );
 
+/* TA_MathMode: Precision of the math transforms TA_EXP, TA_LN, TA_LOG10,
+ * TA_SIN, TA_COS, TA_TAN, TA_ASIN, TA_ACOS, TA_ATAN, TA_SINH, TA_COSH
+ * and TA_TANH.
+ *
+ * TA_MATH_STRICT (the default) calls the C library for every element,
+ * so the outputs are exactly the ones of exp(), log(), sin() etc.
+ *
+ * TA_MATH_FAST calculates instead polynomial approximations with the
+ * SSE2, AVX2 or AVX-512 instructions (the best supported by the CPU,
+ * detected at the first call). The outputs are within 4 ulp of the
+ * exact result, and are the same whatever the instructions used. The
+ * elements outside of the range of the approximations (too large for
+ * the argument reduction, not finite, outside of the domain of the
+ * function) are still done by the C library.
+ *
+ * The other element-wise functions (TA_SQRT, TA_CEIL, TA_FLOOR, the
+ * math operators and the price transforms) are always calculated with
+ * these instructions since their outputs are exact.
+ *
+ * The SIMD instructions are used only on x86/x64 (gcc, clang or Visual
+ * Studio). Elsewhere TA_MATH_FAST has no effect on these functions.
+ *
+ * TA_MATH_FAST also lets TA_AVGDEV and TA_CCI use a sliding order
+ * statistics tree when the period is 128 or more, in O(log period) per
+ * output instead of O(period). Their outputs then differ from the ones
+ * of TA_MATH_STRICT by the rounding errors (less than 1e-12 relative). In
+ * TA_MATH_STRICT, they stay O(period) per output for any period: the
+ * tree adds the values in another order than the direct sums, so it
+ * cannot give the same outputs as the .NET, Java and Rust versions of
+ * TA-Lib.
+ *
+ * TA_MATH_FAST also lets TA_CallFuncParallel split the functions
+ * carrying running sums along the range (SMA, STDDEV, the
+ * candlesticks...), with an output differing by the rounding errors
+ * (see ta_abstract.h). CCI and the linear regressions are split in
+ * TA_MATH_STRICT too, with an identical output.
+ */
+typedef enum
+{
+   TA_MATH_STRICT,
+   TA_MATH_FAST
+} TA_MathMode;
+
+TA_LIB_API TA_RetCode  TA_SetMathMode( TA_MathMode mode );
+TA_LIB_API TA_MathMode TA_GetMathMode( void );
+
+/* A TA_Context holds its own copy of the settings changing the output
+ * of the TA functions: the unstable periods, the compatibility, the
+ * candle settings and the math mode (see TA_SetUnstablePeriod,
+ * TA_SetCompatibility and TA_SetCandleSettings in ta_func.h, and
+ * TA_SetMathMode above).
+ *
+ * TA_SetThreadContext() makes all the TA functions called afterward
+ * from the same thread use the settings of that context (including
+ * the functions called through TA_CallFunc and the streams allocated
+ * by that thread). Passing NULL goes back to the settings shared by
+ * all threads.
+ *
+ * This allows each thread (or strategy) to run its own configuration
+ * without any locking. A context can be changed by only one thread at
+ * the time, but it can be used at the same time by many threads as
+ * long as it is not modified.
+ *
+ * TA_ContextAlloc() starts with a copy of the settings shared by all
+ * threads, and must be called after TA_Initialize(). A context must not
+ * be freed while a thread is still using it.
+ *
+ * Example:
+ *    TA_Context *context;
+ *
+ *    TA_ContextAlloc( &context );
+ *    TA_ContextSetCompatibility( context, TA_COMPATIBILITY_METASTOCK );
+ *    TA_ContextSetUnstablePeriod( context, TA_FUNC_UNST_EMA, 50 );
+ *
+ *    TA_SetThreadContext( context );
+ *    retCode = TA_EMA( ... ); <- Metastock compatible, 50 unstable bars.
+ *    TA_SetThreadContext( NULL );
+ *
+ *    TA_ContextFree( context );
+ */
+typedef struct TA_Context TA_Context;
+
+TA_LIB_API TA_RetCode TA_ContextAlloc( TA_Context **context );
+TA_LIB_API TA_RetCode TA_ContextFree ( TA_Context *context );
+
+TA_LIB_API TA_RetCode   TA_ContextSetUnstablePeriod( TA_Context   *context,
+                                                     TA_FuncUnstId id,
+                                                     unsigned int  unstablePeriod );
+TA_LIB_API unsigned int TA_ContextGetUnstablePeriod( const TA_Context *context,
+                                                     TA_FuncUnstId id );
+
+TA_LIB_API TA_RetCode       TA_ContextSetCompatibility( TA_Context *context,
+                                                        TA_Compatibility value );
+TA_LIB_API TA_Compatibility TA_ContextGetCompatibility( const TA_Context *context );
+
+TA_LIB_API TA_RetCode  TA_ContextSetMathMode( TA_Context *context, TA_MathMode mode );
+TA_LIB_API TA_MathMode TA_ContextGetMathMode( const TA_Context *context );
+
+TA_LIB_API TA_RetCode TA_ContextSetCandleSettings( TA_Context *context,
+                                                   TA_CandleSettingType settingType,
+                                                   TA_RangeType rangeType,
+                                                   int avgPeriod,
+                                                   double factor );
+TA_LIB_API TA_RetCode TA_ContextRestoreCandleDefaultSettings( TA_Context *context,
+                                                              TA_CandleSettingType settingType );
+
+TA_LIB_API TA_RetCode        TA_SetThreadContext( const TA_Context *context );
+TA_LIB_API const TA_Context *TA_GetThreadContext( void );
+
+/* TA_Allocator: Where TA-Lib takes its memory.
+ *
+ * All the memory allocated by TA-Lib (the temporary buffers of the TA
+ * functions, the abstract interface, the streams, the contexts...) goes
+ * through the allocator of the calling thread (TA_SetThreadAllocator),
+ * else through the allocator shared by all threads (TA_SetAllocator),
+ * else through malloc/free. Passing NULL removes an allocator.
+ *
+ * allocFunc returns memory aligned for a double, or NULL on failure.
+ * freeFunc receives the same size that was given to allocFunc.
+ *
+ * Memory is always given back to the allocator that provided it, so
+ * the allocators can be changed at any time. An allocator (and its
+ * TA_Allocator struct) must stay valid until all its memory is freed.
+ * TA_SetAllocator can be called while other threads use TA-Lib, each
+ * allocation then uses either the previous or the new allocator.
+ *
+ * TA_Arena is a ready-made allocator for one thread. Memory freed is
+ * kept for being re-used by the next allocations of the same size, so
+ * calling the TA functions repeatedly does not go to the system heap
+ * anymore. All its memory is released by TA_ArenaFree. The blockSize
+ * is how much memory is taken from the heap at the time (0 for the
+ * default of 1MB).
+ *
+ * The first thread allocating from an arena owns it, and allocating
+ * from it in any other thread fails (the TA functions then return
+ * TA_ALLOC_ERR). Its memory can be freed by any thread, for example
+ * when a buffer is passed to another thread. TA_ArenaFree must be
+ * called only once no other thread uses the arena.
+ *
+ * Example:
+ *    TA_Arena *arena;
+ *
+ *    TA_ArenaAlloc( &arena, 0 );
+ *    TA_SetThreadAllocator( TA_ArenaGetAllocator(arena) );
+ *    for( ... )
+ *       retCode = TA_MACD( ... ); <- Temporary buffers from the arena.
+ *    TA_SetThreadAllocator( NULL );
+ *
+ *    TA_ArenaFree( arena );
+ */
+typedef struct
+{
+   void *(*allocFunc)( void *opaque, size_t size );
+   void  (*freeFunc) ( void *opaque, void *ptr, size_t size );
+   void  *opaque;
+} TA_Allocator;
+
+TA_LIB_API TA_RetCode TA_SetAllocator( const TA_Allocator *allocator );
+
+TA_LIB_API TA_RetCode          TA_SetThreadAllocator( const TA_Allocator *allocator );
+TA_LIB_API const TA_Allocator *TA_GetThreadAllocator( void );
+
+typedef struct TA_Arena TA_Arena;
+
+TA_LIB_API TA_RetCode TA_ArenaAlloc( TA_Arena **arena, size_t blockSize );
+TA_LIB_API TA_RetCode TA_ArenaFree ( TA_Arena *arena );
+
+TA_LIB_API const TA_Allocator *TA_ArenaGetAllocator( const TA_Arena *arena );
+
 /* TA_LIB_SOURCES_DIGEST helps for TA-Lib automated maintenance.
  *
  * This value is updated whenever a make, cmake or any source files
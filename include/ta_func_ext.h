@@ -0,0 +1,1124 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TA_FUNC_EXT_H
+#define TA_FUNC_EXT_H
+
+#ifndef TA_COMMON_H
+    #include "ta_common.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* This header contains the prototype of the TA functions that are
+ * not part of the abstract interface (ta_abstract.h). These typically
+ * calculate in one pass what would otherwise need many calls to the
+ * functions of ta_func.h.
+ *
+ * Unless specified otherwise, the parameters follow the same rules as
+ * the functions in ta_func.h, including the TA_S_XXX variants taking
+ * single precision input.
+ */
+
+/*
+ * TA_LINEARREG_ALL - Linear Regression, all outputs
+ *
+ * Input  = double
+ * Output = double, double, double, double, double
+ *
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriod:(From 2 to 100000)
+ *    Number of period
+ *
+ * Same values as TA_LINEARREG, TA_LINEARREG_SLOPE,
+ * TA_LINEARREG_INTERCEPT, TA_LINEARREG_ANGLE and TA_TSF, but the
+ * regression is calculated only once for all the outputs.
+ *
+ * An output can be NULL when not needed (at least one must be
+ * provided).
+ */
+TA_LIB_API TA_RetCode TA_LINEARREG_ALL( int    startIdx,
+                                        int    endIdx,
+                                        const double inReal[],
+                                        int           optInTimePeriod, /* From 2 to 100000 */
+                                        int          *outBegIdx,
+                                        int          *outNBElement,
+                                        double        outLinearReg[],
+                                        double        outSlope[],
+                                        double        outIntercept[],
+                                        double        outAngle[],
+                                        double        outTSF[] );
+
+TA_LIB_API TA_RetCode TA_S_LINEARREG_ALL( int    startIdx,
+                                          int    endIdx,
+                                          const float  inReal[],
+                                          int           optInTimePeriod, /* From 2 to 100000 */
+                                          int          *outBegIdx,
+                                          int          *outNBElement,
+                                          double        outLinearReg[],
+                                          double        outSlope[],
+                                          double        outIntercept[],
+                                          double        outAngle[],
+                                          double        outTSF[] );
+
+TA_LIB_API int TA_LINEARREG_ALL_Lookback( int optInTimePeriod );  /* From 2 to 100000 */
+
+/*
+ * TA_HT_ALL - Hilbert Transform, all outputs
+ *
+ * Input  = double
+ * Output = double, double, double, double, double, double, double,
+ *          int, double, double
+ *
+ * Optional Parameters
+ * -------------------
+ * optInFastLimit:(From 0.01 to 0.99)
+ *    Upper limit use in the adaptive algorithm (MAMA)
+ *
+ * optInSlowLimit:(From 0.01 to 0.99)
+ *    Lower limit use in the adaptive algorithm (MAMA)
+ *
+ * Outputs of TA_HT_DCPERIOD, TA_HT_DCPHASE, TA_HT_PHASOR, TA_HT_SINE,
+ * TA_HT_TRENDLINE, TA_HT_TRENDMODE and TA_MAMA. All the outputs start
+ * at the same bar (see TA_HT_ALL_Lookback) and are identical to the
+ * outputs of their individual function with the same unstable periods.
+ *
+ * The price smoother and the Hilbert Transform are calculated once for
+ * all the outputs whose function has the same lookback and warm-up.
+ * With the default unstable periods, this is done twice: once for
+ * HT_DCPHASE, HT_SINE, HT_TRENDLINE and HT_TRENDMODE, and once for
+ * HT_DCPERIOD, HT_PHASOR and MAMA.
+ *
+ * An output can be NULL when not needed (at least one must be
+ * provided).
+ */
+TA_LIB_API TA_RetCode TA_HT_ALL( int    startIdx,
+                                 int    endIdx,
+                                 const double inReal[],
+                                 double        optInFastLimit, /* From 0.01 to 0.99 */
+                                 double        optInSlowLimit, /* From 0.01 to 0.99 */
+                                 int          *outBegIdx,
+                                 int          *outNBElement,
+                                 double        outDCPeriod[],
+                                 double        outDCPhase[],
+                                 double        outInPhase[],
+                                 double        outQuadrature[],
+                                 double        outSine[],
+                                 double        outLeadSine[],
+                                 double        outTrendline[],
+                                 int           outTrendMode[],
+                                 double        outMAMA[],
+                                 double        outFAMA[] );
+
+TA_LIB_API TA_RetCode TA_S_HT_ALL( int    startIdx,
+                                   int    endIdx,
+                                   const float  inReal[],
+                                   double        optInFastLimit, /* From 0.01 to 0.99 */
+                                   double        optInSlowLimit, /* From 0.01 to 0.99 */
+                                   int          *outBegIdx,
+                                   int          *outNBElement,
+                                   double        outDCPeriod[],
+                                   double        outDCPhase[],
+                                   double        outInPhase[],
+                                   double        outQuadrature[],
+                                   double        outSine[],
+                                   double        outLeadSine[],
+                                   double        outTrendline[],
+                                   int           outTrendMode[],
+                                   double        outMAMA[],
+                                   double        outFAMA[] );
+
+TA_LIB_API int TA_HT_ALL_Lookback( double        optInFastLimit, /* From 0.01 to 0.99 */
+                                   double        optInSlowLimit );  /* From 0.01 to 0.99 */
+
+/*
+ * TA_DM_ALL - Directional Movement, all outputs
+ *
+ * Input  = High, Low, Close
+ * Output = double, double, double, double, double, double, double,
+ *          double, double, double
+ *
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriod:(From 2 to 100000)
+ *    Number of period
+ *
+ * Outputs of TA_TRANGE, TA_ATR, TA_NATR, TA_PLUS_DM, TA_MINUS_DM,
+ * TA_PLUS_DI, TA_MINUS_DI, TA_DX, TA_ADX and TA_ADXR, with the true
+ * range and the directional movements calculated only once for all
+ * the outputs.
+ *
+ * All the outputs start at the longest lookback of these functions
+ * (usually the one of ADXR). Each Wilder's smoothing starts at the
+ * same bar as in its individual function, so every output is
+ * identical to the one of its function with the same startIdx and
+ * unstable periods.
+ *
+ * An output can be NULL when not needed (at least one must be
+ * provided).
+ */
+TA_LIB_API TA_RetCode TA_DM_ALL( int    startIdx,
+                                 int    endIdx,
+                                 const double inHigh[],
+                                 const double inLow[],
+                                 const double inClose[],
+                                 int           optInTimePeriod, /* From 2 to 100000 */
+                                 int          *outBegIdx,
+                                 int          *outNBElement,
+                                 double        outTrueRange[],
+                                 double        outATR[],
+                                 double        outNATR[],
+                                 double        outPlusDM[],
+                                 double        outMinusDM[],
+                                 double        outPlusDI[],
+                                 double        outMinusDI[],
+                                 double        outDX[],
+                                 double        outADX[],
+                                 double        outADXR[] );
+
+TA_LIB_API TA_RetCode TA_S_DM_ALL( int    startIdx,
+                                   int    endIdx,
+                                   const float  inHigh[],
+                                   const float  inLow[],
+                                   const float  inClose[],
+                                   int           optInTimePeriod, /* From 2 to 100000 */
+                                   int          *outBegIdx,
+                                   int          *outNBElement,
+                                   double        outTrueRange[],
+                                   double        outATR[],
+                                   double        outNATR[],
+                                   double        outPlusDM[],
+                                   double        outMinusDM[],
+                                   double        outPlusDI[],
+                                   double        outMinusDI[],
+                                   double        outDX[],
+                                   double        outADX[],
+                                   double        outADXR[] );
+
+TA_LIB_API int TA_DM_ALL_Lookback( int optInTimePeriod );  /* From 2 to 100000 */
+
+/*
+ * TA_MA_MULTI - Moving average, many periods
+ *
+ * Input  = double
+ * Output = double (one row per period)
+ *
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriods:(From 1 to 100000)
+ *    Array of optInNbPeriod periods
+ *
+ * optInMAType:
+ *    Type of Moving Average (all except TA_MAType_KAMA and
+ *    TA_MAType_MAMA)
+ *
+ * Same values as calling TA_MA for each period. For the SMA, WMA and
+ * TRIMA, the running sums of the input are calculated only once for
+ * all the periods (same values within the rounding error). For the
+ * EMA, DEMA, TEMA and T3, the EMA of all the periods are advanced
+ * together on each input (identical values).
+ *
+ * The outputs of optInTimePeriods[k] are written in the row starting
+ * at outReal[k*(endIdx-startIdx+1)], its outBegIdx and outNBElement
+ * are outBegIdx[k] and outNBElement[k]. outReal must have space for
+ * optInNbPeriod*(endIdx-startIdx+1) values.
+ */
+TA_LIB_API TA_RetCode TA_MA_MULTI( int    startIdx,
+                                   int    endIdx,
+                                   const double inReal[],
+                                   const int     optInTimePeriods[], /* From 1 to 100000 */
+                                   int           optInNbPeriod,
+                                   TA_MAType     optInMAType,
+                                   int           outBegIdx[],
+                                   int           outNBElement[],
+                                   double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_MA_MULTI( int    startIdx,
+                                     int    endIdx,
+                                     const float  inReal[],
+                                     const int     optInTimePeriods[], /* From 1 to 100000 */
+                                     int           optInNbPeriod,
+                                     TA_MAType     optInMAType,
+                                     int           outBegIdx[],
+                                     int           outNBElement[],
+                                     double        outReal[] );
+
+/*
+ * TA_TRIX_MULTI - 1-day Rate-Of-Change (ROC) of a Triple Smooth EMA, many periods
+ *
+ * Input  = double
+ * Output = double (one row per period)
+ *
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriods:(From 2 to 100000)
+ *    Array of optInNbPeriod periods
+ *
+ * Same values as calling TA_TRIX for each period, the three EMA of
+ * all the periods are advanced together on each input. The outputs
+ * are written the same way as TA_MA_MULTI.
+ */
+TA_LIB_API TA_RetCode TA_TRIX_MULTI( int    startIdx,
+                                     int    endIdx,
+                                     const double inReal[],
+                                     const int     optInTimePeriods[], /* From 2 to 100000 */
+                                     int           optInNbPeriod,
+                                     int           outBegIdx[],
+                                     int           outNBElement[],
+                                     double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_TRIX_MULTI( int    startIdx,
+                                       int    endIdx,
+                                       const float  inReal[],
+                                       const int     optInTimePeriods[], /* From 2 to 100000 */
+                                       int           optInNbPeriod,
+                                       int           outBegIdx[],
+                                       int           outNBElement[],
+                                       double        outReal[] );
+
+/*
+ * TA_CDL_ALL - Candlestick patterns, many patterns
+ *
+ * Input  = Open, High, Low, Close
+ * Output = int (one row per pattern), UInt64 (one per bar)
+ *
+ * Optional Parameters
+ * -------------------
+ * optInPatterns:
+ *    Array of optInNbPattern patterns (see TA_CDLPattern)
+ *
+ * optInPenetration:(From 0 to 3e+37)
+ *    Percentage of penetration of a candle within another candle,
+ *    used by the patterns having this parameter. When TA_REAL_DEFAULT,
+ *    each of these patterns uses its own default.
+ *
+ * Same values as calling TA_CDLXXX for each pattern. The bars are
+ * done only once for all the patterns, and the averages of the
+ * candle ranges (see TA_SetCandleSettings) common to many patterns
+ * are calculated only once (identical values).
+ *
+ * The outputs of optInPatterns[k] are written the same way as
+ * TA_MA_MULTI. outInteger can be NULL when only outMask is needed.
+ *
+ * outMask[i] (when not NULL) is for the bar startIdx+i, with the bit
+ * (1<<pattern) set when that pattern is recognized on this bar.
+ * outMask must have space for endIdx-startIdx+1 values. At least one
+ * of outInteger and outMask must be provided.
+ *
+ * The TA_S_CDL_ALL variant converts the prices to double before
+ * recognizing the patterns.
+ */
+ENUM_BEGIN( CDLPattern )
+   ENUM_DEFINE( TA_CDLPattern_2CROWS,           Cdl2crows           ) =0,
+   ENUM_DEFINE( TA_CDLPattern_3BLACKCROWS,      Cdl3blackcrows      ) =1,
+   ENUM_DEFINE( TA_CDLPattern_3INSIDE,          Cdl3inside          ) =2,
+   ENUM_DEFINE( TA_CDLPattern_3LINESTRIKE,      Cdl3linestrike      ) =3,
+   ENUM_DEFINE( TA_CDLPattern_3OUTSIDE,         Cdl3outside         ) =4,
+   ENUM_DEFINE( TA_CDLPattern_3STARSINSOUTH,    Cdl3starsinsouth    ) =5,
+   ENUM_DEFINE( TA_CDLPattern_3WHITESOLDIERS,   Cdl3whitesoldiers   ) =6,
+   ENUM_DEFINE( TA_CDLPattern_ABANDONEDBABY,    CdlAbandonedbaby    ) =7,
+   ENUM_DEFINE( TA_CDLPattern_ADVANCEBLOCK,     CdlAdvanceblock     ) =8,
+   ENUM_DEFINE( TA_CDLPattern_BELTHOLD,         CdlBelthold         ) =9,
+   ENUM_DEFINE( TA_CDLPattern_BREAKAWAY,        CdlBreakaway        ) =10,
+   ENUM_DEFINE( TA_CDLPattern_CLOSINGMARUBOZU,  CdlClosingmarubozu  ) =11,
+   ENUM_DEFINE( TA_CDLPattern_CONCEALBABYSWALL, CdlConcealbabyswall ) =12,
+   ENUM_DEFINE( TA_CDLPattern_COUNTERATTACK,    CdlCounterattack    ) =13,
+   ENUM_DEFINE( TA_CDLPattern_DARKCLOUDCOVER,   CdlDarkcloudcover   ) =14,
+   ENUM_DEFINE( TA_CDLPattern_DOJI,             CdlDoji             ) =15,
+   ENUM_DEFINE( TA_CDLPattern_DOJISTAR,         CdlDojistar         ) =16,
+   ENUM_DEFINE( TA_CDLPattern_DRAGONFLYDOJI,    CdlDragonflydoji    ) =17,
+   ENUM_DEFINE( TA_CDLPattern_ENGULFING,        CdlEngulfing        ) =18,
+   ENUM_DEFINE( TA_CDLPattern_EVENINGDOJISTAR,  CdlEveningdojistar  ) =19,
+   ENUM_DEFINE( TA_CDLPattern_EVENINGSTAR,      CdlEveningstar      ) =20,
+   ENUM_DEFINE( TA_CDLPattern_GAPSIDESIDEWHITE, CdlGapsidesidewhite ) =21,
+   ENUM_DEFINE( TA_CDLPattern_GRAVESTONEDOJI,   CdlGravestonedoji   ) =22,
+   ENUM_DEFINE( TA_CDLPattern_HAMMER,           CdlHammer           ) =23,
+   ENUM_DEFINE( TA_CDLPattern_HANGINGMAN,       CdlHangingman       ) =24,
+   ENUM_DEFINE( TA_CDLPattern_HARAMI,           CdlHarami           ) =25,
+   ENUM_DEFINE( TA_CDLPattern_HARAMICROSS,      CdlHaramicross      ) =26,
+   ENUM_DEFINE( TA_CDLPattern_HIGHWAVE,         CdlHighwave         ) =27,
+   ENUM_DEFINE( TA_CDLPattern_HIKKAKE,          CdlHikkake          ) =28,
+   ENUM_DEFINE( TA_CDLPattern_HIKKAKEMOD,       CdlHikkakemod       ) =29,
+   ENUM_DEFINE( TA_CDLPattern_HOMINGPIGEON,     CdlHomingpigeon     ) =30,
+   ENUM_DEFINE( TA_CDLPattern_IDENTICAL3CROWS,  CdlIdentical3crows  ) =31,
+   ENUM_DEFINE( TA_CDLPattern_INNECK,           CdlInneck           ) =32,
+   ENUM_DEFINE( TA_CDLPattern_INVERTEDHAMMER,   CdlInvertedhammer   ) =33,
+   ENUM_DEFINE( TA_CDLPattern_KICKING,          CdlKicking          ) =34,
+   ENUM_DEFINE( TA_CDLPattern_KICKINGBYLENGTH,  CdlKickingbylength  ) =35,
+   ENUM_DEFINE( TA_CDLPattern_LADDERBOTTOM,     CdlLadderbottom     ) =36,
+   ENUM_DEFINE( TA_CDLPattern_LONGLEGGEDDOJI,   CdlLongleggeddoji   ) =37,
+   ENUM_DEFINE( TA_CDLPattern_LONGLINE,         CdlLongline         ) =38,
+   ENUM_DEFINE( TA_CDLPattern_MARUBOZU,         CdlMarubozu         ) =39,
+   ENUM_DEFINE( TA_CDLPattern_MATCHINGLOW,      CdlMatchinglow      ) =40,
+   ENUM_DEFINE( TA_CDLPattern_MATHOLD,          CdlMathold          ) =41,
+   ENUM_DEFINE( TA_CDLPattern_MORNINGDOJISTAR,  CdlMorningdojistar  ) =42,
+   ENUM_DEFINE( TA_CDLPattern_MORNINGSTAR,      CdlMorningstar      ) =43,
+   ENUM_DEFINE( TA_CDLPattern_ONNECK,           CdlOnneck           ) =44,
+   ENUM_DEFINE( TA_CDLPattern_PIERCING,         CdlPiercing         ) =45,
+   ENUM_DEFINE( TA_CDLPattern_RICKSHAWMAN,      CdlRickshawman      ) =46,
+   ENUM_DEFINE( TA_CDLPattern_RISEFALL3METHODS, CdlRisefall3methods ) =47,
+   ENUM_DEFINE( TA_CDLPattern_SEPARATINGLINES,  CdlSeparatinglines  ) =48,
+   ENUM_DEFINE( TA_CDLPattern_SHOOTINGSTAR,     CdlShootingstar     ) =49,
+   ENUM_DEFINE( TA_CDLPattern_SHORTLINE,        CdlShortline        ) =50,
+   ENUM_DEFINE( TA_CDLPattern_SPINNINGTOP,      CdlSpinningtop      ) =51,
+   ENUM_DEFINE( TA_CDLPattern_STALLEDPATTERN,   CdlStalledpattern   ) =52,
+   ENUM_DEFINE( TA_CDLPattern_STICKSANDWICH,    CdlSticksandwich    ) =53,
+   ENUM_DEFINE( TA_CDLPattern_TAKURI,           CdlTakuri           ) =54,
+   ENUM_DEFINE( TA_CDLPattern_TASUKIGAP,        CdlTasukigap        ) =55,
+   ENUM_DEFINE( TA_CDLPattern_THRUSTING,        CdlThrusting        ) =56,
+   ENUM_DEFINE( TA_CDLPattern_TRISTAR,          CdlTristar          ) =57,
+   ENUM_DEFINE( TA_CDLPattern_UNIQUE3RIVER,     CdlUnique3river     ) =58,
+   ENUM_DEFINE( TA_CDLPattern_UPSIDEGAP2CROWS,  CdlUpsidegap2crows  ) =59,
+   ENUM_DEFINE( TA_CDLPattern_XSIDEGAP3METHODS, CdlXsidegap3methods ) =60
+ENUM_END( CDLPattern )
+
+#define TA_CDL_NB_PATTERN 61
+
+TA_LIB_API TA_RetCode TA_CDL_ALL( int    startIdx,
+                                  int    endIdx,
+                                  const double inOpen[],
+                                  const double inHigh[],
+                                  const double inLow[],
+                                  const double inClose[],
+                                  const TA_CDLPattern optInPatterns[],
+                                  int           optInNbPattern,
+                                  double        optInPenetration, /* From 0 to 3e+37 */
+                                  int           outBegIdx[],
+                                  int           outNBElement[],
+                                  int           outInteger[],
+                                  UInt64        outMask[] );
+
+TA_LIB_API TA_RetCode TA_S_CDL_ALL( int    startIdx,
+                                    int    endIdx,
+                                    const float  inOpen[],
+                                    const float  inHigh[],
+                                    const float  inLow[],
+                                    const float  inClose[],
+                                    const TA_CDLPattern optInPatterns[],
+                                    int           optInNbPattern,
+                                    double        optInPenetration, /* From 0 to 3e+37 */
+                                    int           outBegIdx[],
+                                    int           outNBElement[],
+                                    int           outInteger[],
+                                    UInt64        outMask[] );
+
+/*
+ * TA_XXX_WS - TA functions with a workspace provided by the caller
+ *
+ * Same values as calling TA_XXX, but the temporary buffers are taken
+ * from the array of workspaceSize double 'workspace' instead of being
+ * allocated from the heap. The functions having a TA_XXX_WS
+ * variant are the ones allocating temporary buffers: DEMA, TEMA,
+ * TRIX, MA, APO, PPO, MACD, MACDEXT, STOCHF, STOCH, STOCHRSI, NATR,
+ * ADXR, CCI and MFI.
+ *
+ * TA_XXX_Workspace returns the number of double needed by TA_XXX_WS
+ * for the same startIdx, endIdx and optional parameters, or -1 when
+ * a parameter is out of range. It is 0 when TA_XXX does not allocate
+ * for these parameters, workspace can then be NULL. The size is enough
+ * whether or not the input and output are the same array.
+ *
+ * TA_XXX_WS returns TA_BAD_PARAM when workspaceSize is smaller than
+ * that. The same workspace can be re-used for any number of calls,
+ * but not by two threads at the same time.
+ *
+ * The size depends on the unstable period of the functions
+ * (see TA_SetUnstablePeriod), query it again after a change.
+ *
+ * Example:
+ *    size = TA_MACD_Workspace( 0, nbBar-1, 12, 26, 9 );
+ *    workspace = (double *)malloc( sizeof(double)*size );
+ *    for( i=0; i < nbSymbol; i++ )
+ *       TA_MACD_WS( 0, nbBar-1, close[i], 12, 26, 9, workspace, size,
+ *                   &outBegIdx, &outNBElement, macd, signal, hist );
+ */
+TA_LIB_API int TA_DEMA_Workspace( int startIdx,
+                                  int endIdx,
+                                  int optInTimePeriod ); /* From 2 to 100000 */
+
+TA_LIB_API TA_RetCode TA_DEMA_WS( int    startIdx,
+                                  int    endIdx,
+                                  const double inReal[],
+                                  int           optInTimePeriod, /* From 2 to 100000 */
+                                  double        workspace[],
+                                  int           workspaceSize,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_DEMA_WS( int    startIdx,
+                                    int    endIdx,
+                                    const float  inReal[],
+                                    int           optInTimePeriod, /* From 2 to 100000 */
+                                    double        workspace[],
+                                    int           workspaceSize,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API int TA_TEMA_Workspace( int startIdx,
+                                  int endIdx,
+                                  int optInTimePeriod ); /* From 2 to 100000 */
+
+TA_LIB_API TA_RetCode TA_TEMA_WS( int    startIdx,
+                                  int    endIdx,
+                                  const double inReal[],
+                                  int           optInTimePeriod, /* From 2 to 100000 */
+                                  double        workspace[],
+                                  int           workspaceSize,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_TEMA_WS( int    startIdx,
+                                    int    endIdx,
+                                    const float  inReal[],
+                                    int           optInTimePeriod, /* From 2 to 100000 */
+                                    double        workspace[],
+                                    int           workspaceSize,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API int TA_TRIX_Workspace( int startIdx,
+                                  int endIdx,
+                                  int optInTimePeriod ); /* From 1 to 100000 */
+
+TA_LIB_API TA_RetCode TA_TRIX_WS( int    startIdx,
+                                  int    endIdx,
+                                  const double inReal[],
+                                  int           optInTimePeriod, /* From 1 to 100000 */
+                                  double        workspace[],
+                                  int           workspaceSize,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_TRIX_WS( int    startIdx,
+                                    int    endIdx,
+                                    const float  inReal[],
+                                    int           optInTimePeriod, /* From 1 to 100000 */
+                                    double        workspace[],
+                                    int           workspaceSize,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API int TA_MA_Workspace( int startIdx,
+                                int endIdx,
+                                int optInTimePeriod, /* From 1 to 100000 */
+                                TA_MAType optInMAType );
+
+TA_LIB_API TA_RetCode TA_MA_WS( int    startIdx,
+                                int    endIdx,
+                                const double inReal[],
+                                int           optInTimePeriod, /* From 1 to 100000 */
+                                TA_MAType     optInMAType,
+                                double        workspace[],
+                                int           workspaceSize,
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_MA_WS( int    startIdx,
+                                  int    endIdx,
+                                  const float  inReal[],
+                                  int           optInTimePeriod, /* From 1 to 100000 */
+                                  TA_MAType     optInMAType,
+                                  double        workspace[],
+                                  int           workspaceSize,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API int TA_APO_Workspace( int startIdx,
+                                 int endIdx,
+                                 int optInFastPeriod, /* From 2 to 100000 */
+                                 int optInSlowPeriod, /* From 2 to 100000 */
+                                 TA_MAType optInMAType );
+
+TA_LIB_API TA_RetCode TA_APO_WS( int    startIdx,
+                                 int    endIdx,
+                                 const double inReal[],
+                                 int           optInFastPeriod, /* From 2 to 100000 */
+                                 int           optInSlowPeriod, /* From 2 to 100000 */
+                                 TA_MAType     optInMAType,
+                                 double        workspace[],
+                                 int           workspaceSize,
+                                 int          *outBegIdx,
+                                 int          *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_APO_WS( int    startIdx,
+                                   int    endIdx,
+                                   const float  inReal[],
+                                   int           optInFastPeriod, /* From 2 to 100000 */
+                                   int           optInSlowPeriod, /* From 2 to 100000 */
+                                   TA_MAType     optInMAType,
+                                   double        workspace[],
+                                   int           workspaceSize,
+                                   int          *outBegIdx,
+                                   int          *outNBElement,
+                                   double        outReal[] );
+
+TA_LIB_API int TA_PPO_Workspace( int startIdx,
+                                 int endIdx,
+                                 int optInFastPeriod, /* From 2 to 100000 */
+                                 int optInSlowPeriod, /* From 2 to 100000 */
+                                 TA_MAType optInMAType );
+
+TA_LIB_API TA_RetCode TA_PPO_WS( int    startIdx,
+                                 int    endIdx,
+                                 const double inReal[],
+                                 int           optInFastPeriod, /* From 2 to 100000 */
+                                 int           optInSlowPeriod, /* From 2 to 100000 */
+                                 TA_MAType     optInMAType,
+                                 double        workspace[],
+                                 int           workspaceSize,
+                                 int          *outBegIdx,
+                                 int          *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_PPO_WS( int    startIdx,
+                                   int    endIdx,
+                                   const float  inReal[],
+                                   int           optInFastPeriod, /* From 2 to 100000 */
+                                   int           optInSlowPeriod, /* From 2 to 100000 */
+                                   TA_MAType     optInMAType,
+                                   double        workspace[],
+                                   int           workspaceSize,
+                                   int          *outBegIdx,
+                                   int          *outNBElement,
+                                   double        outReal[] );
+
+TA_LIB_API int TA_MACD_Workspace( int startIdx,
+                                  int endIdx,
+                                  int optInFastPeriod, /* From 2 to 100000 */
+                                  int optInSlowPeriod, /* From 2 to 100000 */
+                                  int optInSignalPeriod ); /* From 1 to 100000 */
+
+TA_LIB_API TA_RetCode TA_MACD_WS( int    startIdx,
+                                  int    endIdx,
+                                  const double inReal[],
+                                  int           optInFastPeriod, /* From 2 to 100000 */
+                                  int           optInSlowPeriod, /* From 2 to 100000 */
+                                  int           optInSignalPeriod, /* From 1 to 100000 */
+                                  double        workspace[],
+                                  int           workspaceSize,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outMACD[],
+                                  double        outMACDSignal[],
+                                  double        outMACDHist[] );
+
+TA_LIB_API TA_RetCode TA_S_MACD_WS( int    startIdx,
+                                    int    endIdx,
+                                    const float  inReal[],
+                                    int           optInFastPeriod, /* From 2 to 100000 */
+                                    int           optInSlowPeriod, /* From 2 to 100000 */
+                                    int           optInSignalPeriod, /* From 1 to 100000 */
+                                    double        workspace[],
+                                    int           workspaceSize,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outMACD[],
+                                    double        outMACDSignal[],
+                                    double        outMACDHist[] );
+
+TA_LIB_API int TA_MACDEXT_Workspace( int startIdx,
+                                     int endIdx,
+                                     int optInFastPeriod, /* From 2 to 100000 */
+                                     TA_MAType optInFastMAType,
+                                     int optInSlowPeriod, /* From 2 to 100000 */
+                                     TA_MAType optInSlowMAType,
+                                     int optInSignalPeriod, /* From 1 to 100000 */
+                                     TA_MAType optInSignalMAType );
+
+TA_LIB_API TA_RetCode TA_MACDEXT_WS( int    startIdx,
+                                     int    endIdx,
+                                     const double inReal[],
+                                     int           optInFastPeriod, /* From 2 to 100000 */
+                                     TA_MAType     optInFastMAType,
+                                     int           optInSlowPeriod, /* From 2 to 100000 */
+                                     TA_MAType     optInSlowMAType,
+                                     int           optInSignalPeriod, /* From 1 to 100000 */
+                                     TA_MAType     optInSignalMAType,
+                                     double        workspace[],
+                                     int           workspaceSize,
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outMACD[],
+                                     double        outMACDSignal[],
+                                     double        outMACDHist[] );
+
+TA_LIB_API TA_RetCode TA_S_MACDEXT_WS( int    startIdx,
+                                       int    endIdx,
+                                       const float  inReal[],
+                                       int           optInFastPeriod, /* From 2 to 100000 */
+                                       TA_MAType     optInFastMAType,
+                                       int           optInSlowPeriod, /* From 2 to 100000 */
+                                       TA_MAType     optInSlowMAType,
+                                       int           optInSignalPeriod, /* From 1 to 100000 */
+                                       TA_MAType     optInSignalMAType,
+                                       double        workspace[],
+                                       int           workspaceSize,
+                                       int          *outBegIdx,
+                                       int          *outNBElement,
+                                       double        outMACD[],
+                                       double        outMACDSignal[],
+                                       double        outMACDHist[] );
+
+TA_LIB_API int TA_STOCHF_Workspace( int startIdx,
+                                    int endIdx,
+                                    int optInFastK_Period, /* From 1 to 100000 */
+                                    int optInFastD_Period, /* From 1 to 100000 */
+                                    TA_MAType optInFastD_MAType );
+
+TA_LIB_API TA_RetCode TA_STOCHF_WS( int    startIdx,
+                                    int    endIdx,
+                                    const double inHigh[],
+                                    const double inLow[],
+                                    const double inClose[],
+                                    int           optInFastK_Period, /* From 1 to 100000 */
+                                    int           optInFastD_Period, /* From 1 to 100000 */
+                                    TA_MAType     optInFastD_MAType,
+                                    double        workspace[],
+                                    int           workspaceSize,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outFastK[],
+                                    double        outFastD[] );
+
+TA_LIB_API TA_RetCode TA_S_STOCHF_WS( int    startIdx,
+                                      int    endIdx,
+                                      const float  inHigh[],
+                                      const float  inLow[],
+                                      const float  inClose[],
+                                      int           optInFastK_Period, /* From 1 to 100000 */
+                                      int           optInFastD_Period, /* From 1 to 100000 */
+                                      TA_MAType     optInFastD_MAType,
+                                      double        workspace[],
+                                      int           workspaceSize,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outFastK[],
+                                      double        outFastD[] );
+
+TA_LIB_API int TA_STOCH_Workspace( int startIdx,
+                                   int endIdx,
+                                   int optInFastK_Period, /* From 1 to 100000 */
+                                   int optInSlowK_Period, /* From 1 to 100000 */
+                                   TA_MAType optInSlowK_MAType,
+                                   int optInSlowD_Period, /* From 1 to 100000 */
+                                   TA_MAType optInSlowD_MAType );
+
+TA_LIB_API TA_RetCode TA_STOCH_WS( int    startIdx,
+                                   int    endIdx,
+                                   const double inHigh[],
+                                   const double inLow[],
+                                   const double inClose[],
+                                   int           optInFastK_Period, /* From 1 to 100000 */
+                                   int           optInSlowK_Period, /* From 1 to 100000 */
+                                   TA_MAType     optInSlowK_MAType,
+                                   int           optInSlowD_Period, /* From 1 to 100000 */
+                                   TA_MAType     optInSlowD_MAType,
+                                   double        workspace[],
+                                   int           workspaceSize,
+                                   int          *outBegIdx,
+                                   int          *outNBElement,
+                                   double        outSlowK[],
+                                   double        outSlowD[] );
+
+TA_LIB_API TA_RetCode TA_S_STOCH_WS( int    startIdx,
+                                     int    endIdx,
+                                     const float  inHigh[],
+                                     const float  inLow[],
+                                     const float  inClose[],
+                                     int           optInFastK_Period, /* From 1 to 100000 */
+                                     int           optInSlowK_Period, /* From 1 to 100000 */
+                                     TA_MAType     optInSlowK_MAType,
+                                     int           optInSlowD_Period, /* From 1 to 100000 */
+                                     TA_MAType     optInSlowD_MAType,
+                                     double        workspace[],
+                                     int           workspaceSize,
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outSlowK[],
+                                     double        outSlowD[] );
+
+TA_LIB_API int TA_STOCHRSI_Workspace( int startIdx,
+                                      int endIdx,
+                                      int optInTimePeriod, /* From 2 to 100000 */
+                                      int optInFastK_Period, /* From 1 to 100000 */
+                                      int optInFastD_Period, /* From 1 to 100000 */
+                                      TA_MAType optInFastD_MAType );
+
+TA_LIB_API TA_RetCode TA_STOCHRSI_WS( int    startIdx,
+                                      int    endIdx,
+                                      const double inReal[],
+                                      int           optInTimePeriod, /* From 2 to 100000 */
+                                      int           optInFastK_Period, /* From 1 to 100000 */
+                                      int           optInFastD_Period, /* From 1 to 100000 */
+                                      TA_MAType     optInFastD_MAType,
+                                      double        workspace[],
+                                      int           workspaceSize,
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      double        outFastK[],
+                                      double        outFastD[] );
+
+TA_LIB_API TA_RetCode TA_S_STOCHRSI_WS( int    startIdx,
+                                        int    endIdx,
+                                        const float  inReal[],
+                                        int           optInTimePeriod, /* From 2 to 100000 */
+                                        int           optInFastK_Period, /* From 1 to 100000 */
+                                        int           optInFastD_Period, /* From 1 to 100000 */
+                                        TA_MAType     optInFastD_MAType,
+                                        double        workspace[],
+                                        int           workspaceSize,
+                                        int          *outBegIdx,
+                                        int          *outNBElement,
+                                        double        outFastK[],
+                                        double        outFastD[] );
+
+TA_LIB_API int TA_NATR_Workspace( int startIdx,
+                                  int endIdx,
+                                  int optInTimePeriod ); /* From 1 to 100000 */
+
+TA_LIB_API TA_RetCode TA_NATR_WS( int    startIdx,
+                                  int    endIdx,
+                                  const double inHigh[],
+                                  const double inLow[],
+                                  const double inClose[],
+                                  int           optInTimePeriod, /* From 1 to 100000 */
+                                  double        workspace[],
+                                  int           workspaceSize,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_NATR_WS( int    startIdx,
+                                    int    endIdx,
+                                    const float  inHigh[],
+                                    const float  inLow[],
+                                    const float  inClose[],
+                                    int           optInTimePeriod, /* From 1 to 100000 */
+                                    double        workspace[],
+                                    int           workspaceSize,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API int TA_ADXR_Workspace( int startIdx,
+                                  int endIdx,
+                                  int optInTimePeriod ); /* From 2 to 100000 */
+
+TA_LIB_API TA_RetCode TA_ADXR_WS( int    startIdx,
+                                  int    endIdx,
+                                  const double inHigh[],
+                                  const double inLow[],
+                                  const double inClose[],
+                                  int           optInTimePeriod, /* From 2 to 100000 */
+                                  double        workspace[],
+                                  int           workspaceSize,
+                                  int          *outBegIdx,
+                                  int          *outNBElement,
+                                  double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_ADXR_WS( int    startIdx,
+                                    int    endIdx,
+                                    const float  inHigh[],
+                                    const float  inLow[],
+                                    const float  inClose[],
+                                    int           optInTimePeriod, /* From 2 to 100000 */
+                                    double        workspace[],
+                                    int           workspaceSize,
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API int TA_CCI_Workspace( int startIdx,
+                                 int endIdx,
+                                 int optInTimePeriod ); /* From 2 to 100000 */
+
+TA_LIB_API TA_RetCode TA_CCI_WS( int    startIdx,
+                                 int    endIdx,
+                                 const double inHigh[],
+                                 const double inLow[],
+                                 const double inClose[],
+                                 int           optInTimePeriod, /* From 2 to 100000 */
+                                 double        workspace[],
+                                 int           workspaceSize,
+                                 int          *outBegIdx,
+                                 int          *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_CCI_WS( int    startIdx,
+                                   int    endIdx,
+                                   const float  inHigh[],
+                                   const float  inLow[],
+                                   const float  inClose[],
+                                   int           optInTimePeriod, /* From 2 to 100000 */
+                                   double        workspace[],
+                                   int           workspaceSize,
+                                   int          *outBegIdx,
+                                   int          *outNBElement,
+                                   double        outReal[] );
+
+TA_LIB_API int TA_MFI_Workspace( int startIdx,
+                                 int endIdx,
+                                 int optInTimePeriod ); /* From 2 to 100000 */
+
+TA_LIB_API TA_RetCode TA_MFI_WS( int    startIdx,
+                                 int    endIdx,
+                                 const double inHigh[],
+                                 const double inLow[],
+                                 const double inClose[],
+                                 const double inVolume[],
+                                 int           optInTimePeriod, /* From 2 to 100000 */
+                                 double        workspace[],
+                                 int           workspaceSize,
+                                 int          *outBegIdx,
+                                 int          *outNBElement,
+                                 double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_MFI_WS( int    startIdx,
+                                   int    endIdx,
+                                   const float  inHigh[],
+                                   const float  inLow[],
+                                   const float  inClose[],
+                                   const float  inVolume[],
+                                   int           optInTimePeriod, /* From 2 to 100000 */
+                                   double        workspace[],
+                                   int           workspaceSize,
+                                   int          *outBegIdx,
+                                   int          *outNBElement,
+                                   double        outReal[] );
+
+/*
+ * TA_XXX_PANEL - Recursive TA functions for many symbols at once
+ *
+ * The input and output are "panels": one row per bar and one column
+ * per symbol, the value of the symbol s at the bar i being at
+ * [i*stride+s]. The stride (at least nbSymbol) is the same for the
+ * input and output, it can be rounded up for aligning the rows.
+ *
+ * The output of the symbol s is identical to TA_XXX called on its
+ * column alone: the row 0 of outReal is the bar outBegIdx, and the
+ * lookback is TA_XXX_Lookback. All the symbols share the same range.
+ *
+ * Each step of the recursion is done for all the symbols together, in
+ * a loop the compiler vectorizes (4 or 8 symbols per instruction with
+ * AVX2 or AVX-512). outReal must not overlap the input.
+ *
+ * Example:
+ *    // close of bar i, symbol s at close[i*stride+s]
+ *    TA_EMA_PANEL( 0, nbBar-1, nbSymbol, stride, close, 30,
+ *                  &outBegIdx, &outNBElement, ema );
+ */
+TA_LIB_API TA_RetCode TA_EMA_PANEL( int    startIdx,
+                                    int    endIdx,
+                                    int    nbSymbol,
+                                    int    stride,
+                                    const double inReal[],
+                                    int           optInTimePeriod, /* From 2 to 100000 */
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_RSI_PANEL( int    startIdx,
+                                    int    endIdx,
+                                    int    nbSymbol,
+                                    int    stride,
+                                    const double inReal[],
+                                    int           optInTimePeriod, /* From 2 to 100000 */
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_ATR_PANEL( int    startIdx,
+                                    int    endIdx,
+                                    int    nbSymbol,
+                                    int    stride,
+                                    const double inHigh[],
+                                    const double inLow[],
+                                    const double inClose[],
+                                    int           optInTimePeriod, /* From 1 to 100000 */
+                                    int          *outBegIdx,
+                                    int          *outNBElement,
+                                    double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_KAMA_PANEL( int    startIdx,
+                                     int    endIdx,
+                                     int    nbSymbol,
+                                     int    stride,
+                                     const double inReal[],
+                                     int           optInTimePeriod, /* From 2 to 100000 */
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     double        outReal[] );
+
+/*
+ * TA_F_XXX - Single precision input, output and calculation
+ *
+ * The TA_S_XXX functions take float input, but calculate and output
+ * double. TA_F_XXX keeps float all along: half the memory traffic,
+ * and twice as many values per SIMD instruction.
+ *
+ * The parameters, lookback and settings (compatibility, unstable
+ * period) are the same as TA_XXX. TA_F_EMA_PANEL follows the rules of
+ * TA_XXX_PANEL above.
+ *
+ * Error bounds, against the double output of TA_S_XXX for the same
+ * float input (u = 2^-24, the float precision):
+ *
+ *   TA_F_ADD, TA_F_SUB, TA_F_MULT, TA_F_DIV, TA_F_MEDPRICE:
+ *      Correctly rounded: the float nearest to the exact result.
+ *
+ *   TA_F_AVGPRICE, TA_F_TYPPRICE, TA_F_WCLPRICE:
+ *      Within 3u*M, M being the largest |input| of the bar.
+ *
+ *   TA_F_SMA:
+ *      The sum of the period is compensated (float hi+lo), the error
+ *      does not grow with the length of the series. Within 2u*M,
+ *      M being the largest |input| of the period.
+ *
+ *   TA_F_EMA, TA_F_EMA_PANEL:
+ *      The recursion is compensated the same way. Within 2u*M, M being
+ *      the largest |input| since the start of the calculation
+ *      (startIdx-lookback, or 0 for Metastock).
+ *
+ * For example, with prices up to 1000, 2u*M is at most 0.00012.
+ */
+TA_LIB_API TA_RetCode TA_F_ADD( int    startIdx,
+                                int    endIdx,
+                                const float inReal0[],
+                                const float inReal1[],
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                float         outReal[] );
+
+TA_LIB_API TA_RetCode TA_F_SUB( int    startIdx,
+                                int    endIdx,
+                                const float inReal0[],
+                                const float inReal1[],
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                float         outReal[] );
+
+TA_LIB_API TA_RetCode TA_F_MULT( int    startIdx,
+                                 int    endIdx,
+                                 const float inReal0[],
+                                 const float inReal1[],
+                                 int          *outBegIdx,
+                                 int          *outNBElement,
+                                 float         outReal[] );
+
+TA_LIB_API TA_RetCode TA_F_DIV( int    startIdx,
+                                int    endIdx,
+                                const float inReal0[],
+                                const float inReal1[],
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                float         outReal[] );
+
+TA_LIB_API TA_RetCode TA_F_AVGPRICE( int    startIdx,
+                                     int    endIdx,
+                                     const float inOpen[],
+                                     const float inHigh[],
+                                     const float inLow[],
+                                     const float inClose[],
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     float         outReal[] );
+
+TA_LIB_API TA_RetCode TA_F_MEDPRICE( int    startIdx,
+                                     int    endIdx,
+                                     const float inHigh[],
+                                     const float inLow[],
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     float         outReal[] );
+
+TA_LIB_API TA_RetCode TA_F_TYPPRICE( int    startIdx,
+                                     int    endIdx,
+                                     const float inHigh[],
+                                     const float inLow[],
+                                     const float inClose[],
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     float         outReal[] );
+
+TA_LIB_API TA_RetCode TA_F_WCLPRICE( int    startIdx,
+                                     int    endIdx,
+                                     const float inHigh[],
+                                     const float inLow[],
+                                     const float inClose[],
+                                     int          *outBegIdx,
+                                     int          *outNBElement,
+                                     float         outReal[] );
+
+TA_LIB_API TA_RetCode TA_F_SMA( int    startIdx,
+                                int    endIdx,
+                                const float inReal[],
+                                int           optInTimePeriod, /* From 2 to 100000 */
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                float         outReal[] );
+
+TA_LIB_API TA_RetCode TA_F_EMA( int    startIdx,
+                                int    endIdx,
+                                const float inReal[],
+                                int           optInTimePeriod, /* From 2 to 100000 */
+                                int          *outBegIdx,
+                                int          *outNBElement,
+                                float         outReal[] );
+
+TA_LIB_API TA_RetCode TA_F_EMA_PANEL( int    startIdx,
+                                      int    endIdx,
+                                      int    nbSymbol,
+                                      int    stride,
+                                      const float inReal[],
+                                      int           optInTimePeriod, /* From 2 to 100000 */
+                                      int          *outBegIdx,
+                                      int          *outNBElement,
+                                      float         outReal[] );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -47,5 +47,13 @@
    #include "ta_abstract.h"
 #endif
 
+#ifndef TA_STREAM_H
+   #include "ta_stream.h"
+#endif
+
+#ifndef TA_FUNC_EXT_H
+   #include "ta_func_ext.h"
+#endif
+
 #endif
 
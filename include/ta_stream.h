@@ -0,0 +1,207 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TA_STREAM_H
+#define TA_STREAM_H
+
+#ifndef TA_COMMON_H
+    #include "ta_common.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Streaming (tick-by-tick) interface for recursive TA functions.
+ *
+ * The batch functions (TA_EMA, TA_RSI...) must be re-run over at least
+ * the lookback and unstable period every time a new price bar arrives.
+ * A TA_Stream instead keeps the state of one indicator and is updated
+ * with one price bar at a time at a O(1) cost.
+ *
+ * The values produced by a TA_Stream are bit-identical to the ones
+ * produced by the equivalent batch function when it is called with
+ * startIdx=0 over the same price bars.
+ *
+ * The unstable period (TA_SetUnstablePeriod) and the compatibility
+ * (TA_SetCompatibility) are captured when the stream is allocated.
+ *
+ * Example:
+ *     TA_Stream *ema;
+ *     int outNBElement;
+ *     double outReal;
+ *
+ *     TA_EMA_StreamAlloc( 20, &ema );
+ *     for( i=0; i < nbBars; i++ )
+ *     {
+ *        TA_StreamUpdate( ema, close[i], &outNBElement, &outReal );
+ *        if( outNBElement == 1 )
+ *           printf( "EMA[%d]=%f\n", i, outReal );
+ *     }
+ *     TA_StreamFree( ema );
+ *
+ * A stream is not thread safe, but different streams can be used
+ * concurrently from different threads.
+ */
+typedef struct TA_Stream TA_Stream;
+
+/* Maximum number of outputs of a stream (see TA_StreamPeekAll). */
+#define TA_STREAM_MAX_OUTPUT 3
+
+/* Allocate a stream for one of the supported functions.
+ *
+ * The optional parameters follow the same range and default
+ * (TA_INTEGER_DEFAULT/TA_REAL_DEFAULT) rules as the batch functions.
+ *
+ * Functions using only one price (inReal) are updated with
+ * TA_StreamUpdate(). The other ones are updated with the function
+ * matching their price bar:
+ *    TA_StreamUpdateHL()   -> SAR
+ *    TA_StreamUpdateHLC()  -> TRANGE, ATR, NATR, the DM/DI family,
+ *                             DX, ADX and ADXR
+ *    TA_StreamUpdateHLCV() -> ADOSC
+ *
+ * The MACD and MACDFIX streams have three outputs (MACD, signal and
+ * histogram), see TA_StreamPeekAll().
+ *
+ * There is no stream for MACDEXT, APO, PPO and STOCHRSI. Their moving
+ * average can be of any TA_MAType (SMA by default) and most of these
+ * need a window of the past values instead of a recursive state.
+ */
+TA_LIB_API TA_RetCode TA_EMA_StreamAlloc     ( int optInTimePeriod, TA_Stream **stream );
+TA_LIB_API TA_RetCode TA_RSI_StreamAlloc     ( int optInTimePeriod, TA_Stream **stream );
+TA_LIB_API TA_RetCode TA_CMO_StreamAlloc     ( int optInTimePeriod, TA_Stream **stream );
+TA_LIB_API TA_RetCode TA_KAMA_StreamAlloc    ( int optInTimePeriod, TA_Stream **stream );
+TA_LIB_API TA_RetCode TA_T3_StreamAlloc      ( int optInTimePeriod, double optInVFactor, TA_Stream **stream );
+TA_LIB_API TA_RetCode TA_DEMA_StreamAlloc    ( int optInTimePeriod, TA_Stream **stream );
+TA_LIB_API TA_RetCode TA_TEMA_StreamAlloc    ( int optInTimePeriod, TA_Stream **stream );
+TA_LIB_API TA_RetCode TA_TRIX_StreamAlloc    ( int optInTimePeriod, TA_Stream **stream );
+TA_LIB_API TA_RetCode TA_MACD_StreamAlloc    ( int optInFastPeriod, int optInSlowPeriod, int optInSignalPeriod, TA_Stream **stream );
+TA_LIB_API TA_RetCode TA_MACDFIX_StreamAlloc ( int optInSignalPeriod, TA_Stream **stream );
+
+TA_LIB_API TA_RetCode TA_TRANGE_StreamAlloc  ( TA_Stream **stream );
+TA_LIB_API TA_RetCode TA_ATR_StreamAlloc     ( int optInTimePeriod, TA_Stream **stream );
+TA_LIB_API TA_RetCode TA_NATR_StreamAlloc    ( int optInTimePeriod, TA_Stream **stream );
+TA_LIB_API TA_RetCode TA_PLUS_DM_StreamAlloc ( int optInTimePeriod, TA_Stream **stream );
+TA_LIB_API TA_RetCode TA_MINUS_DM_StreamAlloc( int optInTimePeriod, TA_Stream **stream );
+TA_LIB_API TA_RetCode TA_PLUS_DI_StreamAlloc ( int optInTimePeriod, TA_Stream **stream );
+TA_LIB_API TA_RetCode TA_MINUS_DI_StreamAlloc( int optInTimePeriod, TA_Stream **stream );
+TA_LIB_API TA_RetCode TA_DX_StreamAlloc      ( int optInTimePeriod, TA_Stream **stream );
+TA_LIB_API TA_RetCode TA_ADX_StreamAlloc     ( int optInTimePeriod, TA_Stream **stream );
+TA_LIB_API TA_RetCode TA_ADXR_StreamAlloc    ( int optInTimePeriod, TA_Stream **stream );
+
+TA_LIB_API TA_RetCode TA_SAR_StreamAlloc     ( double optInAcceleration, double optInMaximum, TA_Stream **stream );
+TA_LIB_API TA_RetCode TA_ADOSC_StreamAlloc   ( int optInFastPeriod, int optInSlowPeriod, TA_Stream **stream );
+
+TA_LIB_API TA_RetCode TA_StreamFree( TA_Stream *stream );
+
+/* Forget all price bars previously provided. The stream
+ * behaves as if it was just allocated.
+ */
+TA_LIB_API TA_RetCode TA_StreamReset( TA_Stream *stream );
+
+/* Number of price bars consumed before the first output
+ * (same value as the TA_XXX_Lookback of the batch function).
+ *
+ * Returns -1 on invalid stream.
+ */
+TA_LIB_API int TA_StreamLookback( const TA_Stream *stream );
+
+/* Number of outputs of the stream (1, except 3 for MACD and MACDFIX).
+ *
+ * Returns -1 on invalid stream.
+ */
+TA_LIB_API int TA_StreamNbOutput( const TA_Stream *stream );
+
+/* Add one price bar.
+ *
+ * On success, outNBElement is 1 when outReal is written with the
+ * new value. It is 0 while the lookback is not yet satisfied.
+ *
+ * outNBElement and outReal can be NULL when the caller intends
+ * to use TA_StreamPeek() instead.
+ *
+ * For a stream with more than one output, outReal is the first one.
+ *
+ * TA_BAD_PARAM is returned when the update function does not match
+ * the price bar of the stream.
+ */
+TA_LIB_API TA_RetCode TA_StreamUpdate( TA_Stream *stream,
+                                       double     inReal,
+                                       int       *outNBElement,
+                                       double    *outReal );
+
+TA_LIB_API TA_RetCode TA_StreamUpdateHLC( TA_Stream *stream,
+                                          double     inHigh,
+                                          double     inLow,
+                                          double     inClose,
+                                          int       *outNBElement,
+                                          double    *outReal );
+
+TA_LIB_API TA_RetCode TA_StreamUpdateHL( TA_Stream *stream,
+                                         double     inHigh,
+                                         double     inLow,
+                                         int       *outNBElement,
+                                         double    *outReal );
+
+TA_LIB_API TA_RetCode TA_StreamUpdateHLCV( TA_Stream *stream,
+                                           double     inHigh,
+                                           double     inLow,
+                                           double     inClose,
+                                           double     inVolume,
+                                           int       *outNBElement,
+                                           double    *outReal );
+
+/* Get the latest output without adding a price bar.
+ *
+ * outNBElement is 0 when no output is yet available.
+ */
+TA_LIB_API TA_RetCode TA_StreamPeek( const TA_Stream *stream,
+                                     int             *outNBElement,
+                                     double          *outReal );
+
+/* Get all the latest outputs without adding a price bar.
+ *
+ * outReal must have room for TA_StreamNbOutput() values
+ * (at most TA_STREAM_MAX_OUTPUT). outNBElement is the number
+ * of values written, 0 when no output is yet available.
+ */
+TA_LIB_API TA_RetCode TA_StreamPeekAll( const TA_Stream *stream,
+                                        int             *outNBElement,
+                                        double           outReal[] );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -19590,7 +19590,7 @@ public class Core {
          outIdx--;
       }
       outIdx = 1;
-      tempValue = inClose[today];
+      tempValue = inClose[startIdx];
       if( ! (((- (0.00000000000001) )<tempValue)&&(tempValue< (0.00000000000001) )) )
          outReal[0] = (prevATR/tempValue)*100.0;
       else
@@ -19601,11 +19601,11 @@ public class Core {
          prevATR *= optInTimePeriod - 1;
          prevATR += tempBuffer[today++];
          prevATR /= optInTimePeriod;
-         tempValue = inClose[today];
+         tempValue = inClose[startIdx+outIdx];
          if( ! (((- (0.00000000000001) )<tempValue)&&(tempValue< (0.00000000000001) )) )
             outReal[outIdx] = (prevATR/tempValue)*100.0;
          else
-            outReal[0] = 0.0;
+            outReal[outIdx] = 0.0;
          outIdx++;
       }
       outBegIdx.value = startIdx;
@@ -19680,7 +19680,7 @@ public class Core {
          outIdx--;
       }
       outIdx = 1;
-      tempValue = inClose[today];
+      tempValue = inClose[startIdx];
       if( ! (((- (0.00000000000001) )<tempValue)&&(tempValue< (0.00000000000001) )) )
          outReal[0] = (prevATR/tempValue)*100.0;
       else
@@ -19691,11 +19691,11 @@ public class Core {
          prevATR *= optInTimePeriod - 1;
          prevATR += tempBuffer[today++];
          prevATR /= optInTimePeriod;
-         tempValue = inClose[today];
+         tempValue = inClose[startIdx+outIdx];
          if( ! (((- (0.00000000000001) )<tempValue)&&(tempValue< (0.00000000000001) )) )
             outReal[outIdx] = (prevATR/tempValue)*100.0;
          else
-            outReal[0] = 0.0;
+            outReal[outIdx] = 0.0;
          outIdx++;
       }
       outBegIdx.value = startIdx;
@@ -24170,7 +24170,7 @@ public class Core {
       nbElementToOutput = (endIdx-startIdx)+1+totalLookback;
       tempBuffer = new double[nbElementToOutput] ;
       k = ((double)2.0 / ((double)(optInTimePeriod + 1))) ;
-      retCode = TA_INT_EMA ( (startIdx-totalLookback), endIdx, inReal,
+      retCode = TA_INT_EMA ( (startIdx-totalLookback)+emaLookback, endIdx, inReal,
          optInTimePeriod, k,
          begIdx , nbElement ,
          tempBuffer );
@@ -24255,7 +24255,7 @@ public class Core {
       nbElementToOutput = (endIdx-startIdx)+1+totalLookback;
       tempBuffer = new double[nbElementToOutput] ;
       k = ((double)2.0 / ((double)(optInTimePeriod + 1))) ;
-      retCode = TA_INT_EMA ( (startIdx-totalLookback), endIdx, inReal,
+      retCode = TA_INT_EMA ( (startIdx-totalLookback)+emaLookback, endIdx, inReal,
          optInTimePeriod, k,
          begIdx , nbElement ,
          tempBuffer );
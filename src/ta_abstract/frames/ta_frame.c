@@ -79,6 +79,27 @@
 /* Generated */ {
 /* Generated */    return TA_ACCBANDS_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ACCBANDS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_ACCBANDS(
+/* Generated */                  startIdx,
+/* Generated */                  endIdx,
+/* Generated */                  (const TA_Real *)in[0], /* inHigh */
+/* Generated */                  (const TA_Real *)in[1], /* inLow */
+/* Generated */                  (const TA_Real *)in[2], /* inClose */
+/* Generated */                  params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                  outBegIdx, 
+/* Generated */                  outNBElement, 
+/* Generated */                  (TA_Real *)out[0], /*  outRealUpperBand */
+/* Generated */                  (TA_Real *)out[1], /*  outRealMiddleBand */
+/* Generated */                  (TA_Real *)out[2] /*  outRealLowerBand */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ACOS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -98,6 +119,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_ACOS_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ACOS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_ACOS(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              (const TA_Real *)in[0], /* inReal */
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_AD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -120,6 +158,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_AD_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_AD_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_AD(
+/* Generated */            startIdx,
+/* Generated */            endIdx,
+/* Generated */            (const TA_Real *)in[0], /* inHigh */
+/* Generated */            (const TA_Real *)in[1], /* inLow */
+/* Generated */            (const TA_Real *)in[2], /* inClose */
+/* Generated */            (const TA_Real *)in[3], /* inVolume */
+/* Generated */            outBegIdx, 
+/* Generated */            outNBElement, 
+/* Generated */            (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ADD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -140,6 +198,24 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_ADD_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ADD_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_ADD(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inReal0 */
+/* Generated */             (const TA_Real *)in[1], /* inReal1 */
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ADOSC_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -164,6 +240,27 @@
 /* Generated */    return TA_ADOSC_Lookback(params->optIn[0].data.optInInteger, /* optInFastPeriod*/
 /* Generated */                       params->optIn[1].data.optInInteger /* optInSlowPeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ADOSC_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_ADOSC(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               (const TA_Real *)in[0], /* inHigh */
+/* Generated */               (const TA_Real *)in[1], /* inLow */
+/* Generated */               (const TA_Real *)in[2], /* inClose */
+/* Generated */               (const TA_Real *)in[3], /* inVolume */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInFastPeriod*/
+/* Generated */               params->optIn[1].data.optInInteger, /* optInSlowPeriod*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ADX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -185,6 +282,25 @@
 /* Generated */ {
 /* Generated */    return TA_ADX_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ADX_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_ADX(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inHigh */
+/* Generated */             (const TA_Real *)in[1], /* inLow */
+/* Generated */             (const TA_Real *)in[2], /* inClose */
+/* Generated */             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ADXR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -206,6 +322,25 @@
 /* Generated */ {
 /* Generated */    return TA_ADXR_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ADXR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_ADXR(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              (const TA_Real *)in[0], /* inHigh */
+/* Generated */              (const TA_Real *)in[1], /* inLow */
+/* Generated */              (const TA_Real *)in[2], /* inClose */
+/* Generated */              params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_APO_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -229,6 +364,25 @@
 /* Generated */                     params->optIn[1].data.optInInteger, /* optInSlowPeriod*/
 /* Generated */                     (TA_MAType)params->optIn[2].data.optInInteger /* optInMAType*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_APO_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_APO(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inReal */
+/* Generated */             params->optIn[0].data.optInInteger, /* optInFastPeriod*/
+/* Generated */             params->optIn[1].data.optInInteger, /* optInSlowPeriod*/
+/* Generated */             (TA_MAType)params->optIn[2].data.optInInteger, /* optInMAType*/
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_AROON_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -250,6 +404,25 @@
 /* Generated */ {
 /* Generated */    return TA_AROON_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_AROON_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_AROON(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               (const TA_Real *)in[0], /* inHigh */
+/* Generated */               (const TA_Real *)in[1], /* inLow */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               (TA_Real *)out[0], /*  outAroonDown */
+/* Generated */               (TA_Real *)out[1] /*  outAroonUp */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_AROONOSC_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -270,6 +443,24 @@
 /* Generated */ {
 /* Generated */    return TA_AROONOSC_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_AROONOSC_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_AROONOSC(
+/* Generated */                  startIdx,
+/* Generated */                  endIdx,
+/* Generated */                  (const TA_Real *)in[0], /* inHigh */
+/* Generated */                  (const TA_Real *)in[1], /* inLow */
+/* Generated */                  params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                  outBegIdx, 
+/* Generated */                  outNBElement, 
+/* Generated */                  (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ASIN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -289,6 +480,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_ASIN_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ASIN_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_ASIN(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              (const TA_Real *)in[0], /* inReal */
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ATAN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -308,6 +516,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_ATAN_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ATAN_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_ATAN(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              (const TA_Real *)in[0], /* inReal */
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ATR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -329,6 +554,25 @@
 /* Generated */ {
 /* Generated */    return TA_ATR_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ATR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_ATR(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inHigh */
+/* Generated */             (const TA_Real *)in[1], /* inLow */
+/* Generated */             (const TA_Real *)in[2], /* inClose */
+/* Generated */             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_AVGPRICE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -351,6 +595,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_AVGPRICE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_AVGPRICE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_AVGPRICE(
+/* Generated */                  startIdx,
+/* Generated */                  endIdx,
+/* Generated */                  (const TA_Real *)in[0], /* inOpen */
+/* Generated */                  (const TA_Real *)in[1], /* inHigh */
+/* Generated */                  (const TA_Real *)in[2], /* inLow */
+/* Generated */                  (const TA_Real *)in[3], /* inClose */
+/* Generated */                  outBegIdx, 
+/* Generated */                  outNBElement, 
+/* Generated */                  (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_AVGDEV_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -370,6 +634,23 @@
 /* Generated */ {
 /* Generated */    return TA_AVGDEV_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_AVGDEV_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_AVGDEV(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                (const TA_Real *)in[0], /* inReal */
+/* Generated */                params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_BBANDS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -397,6 +678,28 @@
 /* Generated */                        params->optIn[2].data.optInReal, /* optInNbDevDn*/
 /* Generated */                        (TA_MAType)params->optIn[3].data.optInInteger /* optInMAType*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_BBANDS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_BBANDS(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                (const TA_Real *)in[0], /* inReal */
+/* Generated */                params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                params->optIn[1].data.optInReal, /* optInNbDevUp*/
+/* Generated */                params->optIn[2].data.optInReal, /* optInNbDevDn*/
+/* Generated */                (TA_MAType)params->optIn[3].data.optInInteger, /* optInMAType*/
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                (TA_Real *)out[0], /*  outRealUpperBand */
+/* Generated */                (TA_Real *)out[1], /*  outRealMiddleBand */
+/* Generated */                (TA_Real *)out[2] /*  outRealLowerBand */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_BETA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -417,6 +720,24 @@
 /* Generated */ {
 /* Generated */    return TA_BETA_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_BETA_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_BETA(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              (const TA_Real *)in[0], /* inReal0 */
+/* Generated */              (const TA_Real *)in[1], /* inReal1 */
+/* Generated */              params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_BOP_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -439,6 +760,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_BOP_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_BOP_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_BOP(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inOpen */
+/* Generated */             (const TA_Real *)in[1], /* inHigh */
+/* Generated */             (const TA_Real *)in[2], /* inLow */
+/* Generated */             (const TA_Real *)in[3], /* inClose */
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CCI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -460,6 +801,25 @@
 /* Generated */ {
 /* Generated */    return TA_CCI_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CCI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_CCI(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inHigh */
+/* Generated */             (const TA_Real *)in[1], /* inLow */
+/* Generated */             (const TA_Real *)in[2], /* inClose */
+/* Generated */             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDL2CROWS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -482,6 +842,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDL2CROWS_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDL2CROWS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDL2CROWS(
+/* Generated */                   startIdx,
+/* Generated */                   endIdx,
+/* Generated */                   (const TA_Real *)in[0], /* inOpen */
+/* Generated */                   (const TA_Real *)in[1], /* inHigh */
+/* Generated */                   (const TA_Real *)in[2], /* inLow */
+/* Generated */                   (const TA_Real *)in[3], /* inClose */
+/* Generated */                   outBegIdx, 
+/* Generated */                   outNBElement, 
+/* Generated */                   (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDL3BLACKCROWS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -504,21 +884,41 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDL3BLACKCROWS_Lookback( );
 /* Generated */ }
-/* Generated */ TA_RetCode TA_CDL3INSIDE_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */ TA_RetCode TA_CDL3BLACKCROWS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
 /* Generated */                           int           *outBegIdx,
 /* Generated */                           int           *outNBElement )
 /* Generated */ {
-/* Generated */    return TA_CDL3INSIDE(
-/* Generated */                    startIdx,
-/* Generated */                    endIdx,
-/* Generated */                    params->in[0].data.inPrice.open, /* inOpen */
-/* Generated */                    params->in[0].data.inPrice.high, /* inHigh */
-/* Generated */                    params->in[0].data.inPrice.low, /* inLow */
-/* Generated */                    params->in[0].data.inPrice.close, /* inClose */
-/* Generated */                    outBegIdx, 
-/* Generated */                    outNBElement, 
+/* Generated */    (void)params;
+/* Generated */    return TA_CDL3BLACKCROWS(
+/* Generated */                        startIdx,
+/* Generated */                        endIdx,
+/* Generated */                        (const TA_Real *)in[0], /* inOpen */
+/* Generated */                        (const TA_Real *)in[1], /* inHigh */
+/* Generated */                        (const TA_Real *)in[2], /* inLow */
+/* Generated */                        (const TA_Real *)in[3], /* inClose */
+/* Generated */                        outBegIdx, 
+/* Generated */                        outNBElement, 
+/* Generated */                        (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
+/* Generated */ TA_RetCode TA_CDL3INSIDE_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_CDL3INSIDE(
+/* Generated */                    startIdx,
+/* Generated */                    endIdx,
+/* Generated */                    params->in[0].data.inPrice.open, /* inOpen */
+/* Generated */                    params->in[0].data.inPrice.high, /* inHigh */
+/* Generated */                    params->in[0].data.inPrice.low, /* inLow */
+/* Generated */                    params->in[0].data.inPrice.close, /* inClose */
+/* Generated */                    outBegIdx, 
+/* Generated */                    outNBElement, 
 /* Generated */                    params->out[0].data.outInteger /*  outInteger */ );
 /* Generated */ }
 /* Generated */ unsigned int TA_CDL3INSIDE_FramePPLB( const TA_ParamHolderPriv *params )
@@ -526,6 +926,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDL3INSIDE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDL3INSIDE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDL3INSIDE(
+/* Generated */                    startIdx,
+/* Generated */                    endIdx,
+/* Generated */                    (const TA_Real *)in[0], /* inOpen */
+/* Generated */                    (const TA_Real *)in[1], /* inHigh */
+/* Generated */                    (const TA_Real *)in[2], /* inLow */
+/* Generated */                    (const TA_Real *)in[3], /* inClose */
+/* Generated */                    outBegIdx, 
+/* Generated */                    outNBElement, 
+/* Generated */                    (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDL3LINESTRIKE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -548,6 +968,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDL3LINESTRIKE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDL3LINESTRIKE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDL3LINESTRIKE(
+/* Generated */                        startIdx,
+/* Generated */                        endIdx,
+/* Generated */                        (const TA_Real *)in[0], /* inOpen */
+/* Generated */                        (const TA_Real *)in[1], /* inHigh */
+/* Generated */                        (const TA_Real *)in[2], /* inLow */
+/* Generated */                        (const TA_Real *)in[3], /* inClose */
+/* Generated */                        outBegIdx, 
+/* Generated */                        outNBElement, 
+/* Generated */                        (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDL3OUTSIDE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -570,6 +1010,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDL3OUTSIDE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDL3OUTSIDE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDL3OUTSIDE(
+/* Generated */                     startIdx,
+/* Generated */                     endIdx,
+/* Generated */                     (const TA_Real *)in[0], /* inOpen */
+/* Generated */                     (const TA_Real *)in[1], /* inHigh */
+/* Generated */                     (const TA_Real *)in[2], /* inLow */
+/* Generated */                     (const TA_Real *)in[3], /* inClose */
+/* Generated */                     outBegIdx, 
+/* Generated */                     outNBElement, 
+/* Generated */                     (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDL3STARSINSOUTH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -592,6 +1052,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDL3STARSINSOUTH_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDL3STARSINSOUTH_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDL3STARSINSOUTH(
+/* Generated */                          startIdx,
+/* Generated */                          endIdx,
+/* Generated */                          (const TA_Real *)in[0], /* inOpen */
+/* Generated */                          (const TA_Real *)in[1], /* inHigh */
+/* Generated */                          (const TA_Real *)in[2], /* inLow */
+/* Generated */                          (const TA_Real *)in[3], /* inClose */
+/* Generated */                          outBegIdx, 
+/* Generated */                          outNBElement, 
+/* Generated */                          (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDL3WHITESOLDIERS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -614,6 +1094,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDL3WHITESOLDIERS_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDL3WHITESOLDIERS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDL3WHITESOLDIERS(
+/* Generated */                           startIdx,
+/* Generated */                           endIdx,
+/* Generated */                           (const TA_Real *)in[0], /* inOpen */
+/* Generated */                           (const TA_Real *)in[1], /* inHigh */
+/* Generated */                           (const TA_Real *)in[2], /* inLow */
+/* Generated */                           (const TA_Real *)in[3], /* inClose */
+/* Generated */                           outBegIdx, 
+/* Generated */                           outNBElement, 
+/* Generated */                           (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLABANDONEDBABY_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -636,6 +1136,26 @@
 /* Generated */ {
 /* Generated */    return TA_CDLABANDONEDBABY_Lookback(params->optIn[0].data.optInReal /* optInPenetration*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLABANDONEDBABY_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_CDLABANDONEDBABY(
+/* Generated */                          startIdx,
+/* Generated */                          endIdx,
+/* Generated */                          (const TA_Real *)in[0], /* inOpen */
+/* Generated */                          (const TA_Real *)in[1], /* inHigh */
+/* Generated */                          (const TA_Real *)in[2], /* inLow */
+/* Generated */                          (const TA_Real *)in[3], /* inClose */
+/* Generated */                          params->optIn[0].data.optInReal, /* optInPenetration*/
+/* Generated */                          outBegIdx, 
+/* Generated */                          outNBElement, 
+/* Generated */                          (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLADVANCEBLOCK_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -658,6 +1178,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLADVANCEBLOCK_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLADVANCEBLOCK_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLADVANCEBLOCK(
+/* Generated */                         startIdx,
+/* Generated */                         endIdx,
+/* Generated */                         (const TA_Real *)in[0], /* inOpen */
+/* Generated */                         (const TA_Real *)in[1], /* inHigh */
+/* Generated */                         (const TA_Real *)in[2], /* inLow */
+/* Generated */                         (const TA_Real *)in[3], /* inClose */
+/* Generated */                         outBegIdx, 
+/* Generated */                         outNBElement, 
+/* Generated */                         (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLBELTHOLD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -680,6 +1220,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLBELTHOLD_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLBELTHOLD_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLBELTHOLD(
+/* Generated */                     startIdx,
+/* Generated */                     endIdx,
+/* Generated */                     (const TA_Real *)in[0], /* inOpen */
+/* Generated */                     (const TA_Real *)in[1], /* inHigh */
+/* Generated */                     (const TA_Real *)in[2], /* inLow */
+/* Generated */                     (const TA_Real *)in[3], /* inClose */
+/* Generated */                     outBegIdx, 
+/* Generated */                     outNBElement, 
+/* Generated */                     (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLBREAKAWAY_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -702,6 +1262,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLBREAKAWAY_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLBREAKAWAY_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLBREAKAWAY(
+/* Generated */                      startIdx,
+/* Generated */                      endIdx,
+/* Generated */                      (const TA_Real *)in[0], /* inOpen */
+/* Generated */                      (const TA_Real *)in[1], /* inHigh */
+/* Generated */                      (const TA_Real *)in[2], /* inLow */
+/* Generated */                      (const TA_Real *)in[3], /* inClose */
+/* Generated */                      outBegIdx, 
+/* Generated */                      outNBElement, 
+/* Generated */                      (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLCLOSINGMARUBOZU_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -724,6 +1304,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLCLOSINGMARUBOZU_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLCLOSINGMARUBOZU_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLCLOSINGMARUBOZU(
+/* Generated */                            startIdx,
+/* Generated */                            endIdx,
+/* Generated */                            (const TA_Real *)in[0], /* inOpen */
+/* Generated */                            (const TA_Real *)in[1], /* inHigh */
+/* Generated */                            (const TA_Real *)in[2], /* inLow */
+/* Generated */                            (const TA_Real *)in[3], /* inClose */
+/* Generated */                            outBegIdx, 
+/* Generated */                            outNBElement, 
+/* Generated */                            (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLCONCEALBABYSWALL_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -746,6 +1346,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLCONCEALBABYSWALL_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLCONCEALBABYSWALL_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLCONCEALBABYSWALL(
+/* Generated */                             startIdx,
+/* Generated */                             endIdx,
+/* Generated */                             (const TA_Real *)in[0], /* inOpen */
+/* Generated */                             (const TA_Real *)in[1], /* inHigh */
+/* Generated */                             (const TA_Real *)in[2], /* inLow */
+/* Generated */                             (const TA_Real *)in[3], /* inClose */
+/* Generated */                             outBegIdx, 
+/* Generated */                             outNBElement, 
+/* Generated */                             (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLCOUNTERATTACK_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -768,6 +1388,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLCOUNTERATTACK_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLCOUNTERATTACK_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLCOUNTERATTACK(
+/* Generated */                          startIdx,
+/* Generated */                          endIdx,
+/* Generated */                          (const TA_Real *)in[0], /* inOpen */
+/* Generated */                          (const TA_Real *)in[1], /* inHigh */
+/* Generated */                          (const TA_Real *)in[2], /* inLow */
+/* Generated */                          (const TA_Real *)in[3], /* inClose */
+/* Generated */                          outBegIdx, 
+/* Generated */                          outNBElement, 
+/* Generated */                          (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLDARKCLOUDCOVER_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -790,6 +1430,26 @@
 /* Generated */ {
 /* Generated */    return TA_CDLDARKCLOUDCOVER_Lookback(params->optIn[0].data.optInReal /* optInPenetration*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLDARKCLOUDCOVER_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_CDLDARKCLOUDCOVER(
+/* Generated */                           startIdx,
+/* Generated */                           endIdx,
+/* Generated */                           (const TA_Real *)in[0], /* inOpen */
+/* Generated */                           (const TA_Real *)in[1], /* inHigh */
+/* Generated */                           (const TA_Real *)in[2], /* inLow */
+/* Generated */                           (const TA_Real *)in[3], /* inClose */
+/* Generated */                           params->optIn[0].data.optInReal, /* optInPenetration*/
+/* Generated */                           outBegIdx, 
+/* Generated */                           outNBElement, 
+/* Generated */                           (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLDOJI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -812,6 +1472,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLDOJI_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLDOJI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLDOJI(
+/* Generated */                 startIdx,
+/* Generated */                 endIdx,
+/* Generated */                 (const TA_Real *)in[0], /* inOpen */
+/* Generated */                 (const TA_Real *)in[1], /* inHigh */
+/* Generated */                 (const TA_Real *)in[2], /* inLow */
+/* Generated */                 (const TA_Real *)in[3], /* inClose */
+/* Generated */                 outBegIdx, 
+/* Generated */                 outNBElement, 
+/* Generated */                 (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLDOJISTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -834,6 +1514,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLDOJISTAR_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLDOJISTAR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLDOJISTAR(
+/* Generated */                     startIdx,
+/* Generated */                     endIdx,
+/* Generated */                     (const TA_Real *)in[0], /* inOpen */
+/* Generated */                     (const TA_Real *)in[1], /* inHigh */
+/* Generated */                     (const TA_Real *)in[2], /* inLow */
+/* Generated */                     (const TA_Real *)in[3], /* inClose */
+/* Generated */                     outBegIdx, 
+/* Generated */                     outNBElement, 
+/* Generated */                     (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLDRAGONFLYDOJI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -856,6 +1556,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLDRAGONFLYDOJI_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLDRAGONFLYDOJI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLDRAGONFLYDOJI(
+/* Generated */                          startIdx,
+/* Generated */                          endIdx,
+/* Generated */                          (const TA_Real *)in[0], /* inOpen */
+/* Generated */                          (const TA_Real *)in[1], /* inHigh */
+/* Generated */                          (const TA_Real *)in[2], /* inLow */
+/* Generated */                          (const TA_Real *)in[3], /* inClose */
+/* Generated */                          outBegIdx, 
+/* Generated */                          outNBElement, 
+/* Generated */                          (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLENGULFING_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -878,6 +1598,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLENGULFING_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLENGULFING_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLENGULFING(
+/* Generated */                      startIdx,
+/* Generated */                      endIdx,
+/* Generated */                      (const TA_Real *)in[0], /* inOpen */
+/* Generated */                      (const TA_Real *)in[1], /* inHigh */
+/* Generated */                      (const TA_Real *)in[2], /* inLow */
+/* Generated */                      (const TA_Real *)in[3], /* inClose */
+/* Generated */                      outBegIdx, 
+/* Generated */                      outNBElement, 
+/* Generated */                      (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLEVENINGDOJISTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -900,6 +1640,26 @@
 /* Generated */ {
 /* Generated */    return TA_CDLEVENINGDOJISTAR_Lookback(params->optIn[0].data.optInReal /* optInPenetration*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLEVENINGDOJISTAR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_CDLEVENINGDOJISTAR(
+/* Generated */                            startIdx,
+/* Generated */                            endIdx,
+/* Generated */                            (const TA_Real *)in[0], /* inOpen */
+/* Generated */                            (const TA_Real *)in[1], /* inHigh */
+/* Generated */                            (const TA_Real *)in[2], /* inLow */
+/* Generated */                            (const TA_Real *)in[3], /* inClose */
+/* Generated */                            params->optIn[0].data.optInReal, /* optInPenetration*/
+/* Generated */                            outBegIdx, 
+/* Generated */                            outNBElement, 
+/* Generated */                            (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLEVENINGSTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -922,6 +1682,26 @@
 /* Generated */ {
 /* Generated */    return TA_CDLEVENINGSTAR_Lookback(params->optIn[0].data.optInReal /* optInPenetration*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLEVENINGSTAR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_CDLEVENINGSTAR(
+/* Generated */                        startIdx,
+/* Generated */                        endIdx,
+/* Generated */                        (const TA_Real *)in[0], /* inOpen */
+/* Generated */                        (const TA_Real *)in[1], /* inHigh */
+/* Generated */                        (const TA_Real *)in[2], /* inLow */
+/* Generated */                        (const TA_Real *)in[3], /* inClose */
+/* Generated */                        params->optIn[0].data.optInReal, /* optInPenetration*/
+/* Generated */                        outBegIdx, 
+/* Generated */                        outNBElement, 
+/* Generated */                        (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLGAPSIDESIDEWHITE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -944,17 +1724,37 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLGAPSIDESIDEWHITE_Lookback( );
 /* Generated */ }
-/* Generated */ TA_RetCode TA_CDLGRAVESTONEDOJI_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */ TA_RetCode TA_CDLGAPSIDESIDEWHITE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
 /* Generated */                           int           *outBegIdx,
 /* Generated */                           int           *outNBElement )
 /* Generated */ {
-/* Generated */    return TA_CDLGRAVESTONEDOJI(
-/* Generated */                           startIdx,
-/* Generated */                           endIdx,
-/* Generated */                           params->in[0].data.inPrice.open, /* inOpen */
-/* Generated */                           params->in[0].data.inPrice.high, /* inHigh */
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLGAPSIDESIDEWHITE(
+/* Generated */                             startIdx,
+/* Generated */                             endIdx,
+/* Generated */                             (const TA_Real *)in[0], /* inOpen */
+/* Generated */                             (const TA_Real *)in[1], /* inHigh */
+/* Generated */                             (const TA_Real *)in[2], /* inLow */
+/* Generated */                             (const TA_Real *)in[3], /* inClose */
+/* Generated */                             outBegIdx, 
+/* Generated */                             outNBElement, 
+/* Generated */                             (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
+/* Generated */ TA_RetCode TA_CDLGRAVESTONEDOJI_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_CDLGRAVESTONEDOJI(
+/* Generated */                           startIdx,
+/* Generated */                           endIdx,
+/* Generated */                           params->in[0].data.inPrice.open, /* inOpen */
+/* Generated */                           params->in[0].data.inPrice.high, /* inHigh */
 /* Generated */                           params->in[0].data.inPrice.low, /* inLow */
 /* Generated */                           params->in[0].data.inPrice.close, /* inClose */
 /* Generated */                           outBegIdx, 
@@ -966,6 +1766,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLGRAVESTONEDOJI_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLGRAVESTONEDOJI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLGRAVESTONEDOJI(
+/* Generated */                           startIdx,
+/* Generated */                           endIdx,
+/* Generated */                           (const TA_Real *)in[0], /* inOpen */
+/* Generated */                           (const TA_Real *)in[1], /* inHigh */
+/* Generated */                           (const TA_Real *)in[2], /* inLow */
+/* Generated */                           (const TA_Real *)in[3], /* inClose */
+/* Generated */                           outBegIdx, 
+/* Generated */                           outNBElement, 
+/* Generated */                           (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLHAMMER_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -988,6 +1808,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLHAMMER_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLHAMMER_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLHAMMER(
+/* Generated */                   startIdx,
+/* Generated */                   endIdx,
+/* Generated */                   (const TA_Real *)in[0], /* inOpen */
+/* Generated */                   (const TA_Real *)in[1], /* inHigh */
+/* Generated */                   (const TA_Real *)in[2], /* inLow */
+/* Generated */                   (const TA_Real *)in[3], /* inClose */
+/* Generated */                   outBegIdx, 
+/* Generated */                   outNBElement, 
+/* Generated */                   (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLHANGINGMAN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1010,6 +1850,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLHANGINGMAN_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLHANGINGMAN_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLHANGINGMAN(
+/* Generated */                       startIdx,
+/* Generated */                       endIdx,
+/* Generated */                       (const TA_Real *)in[0], /* inOpen */
+/* Generated */                       (const TA_Real *)in[1], /* inHigh */
+/* Generated */                       (const TA_Real *)in[2], /* inLow */
+/* Generated */                       (const TA_Real *)in[3], /* inClose */
+/* Generated */                       outBegIdx, 
+/* Generated */                       outNBElement, 
+/* Generated */                       (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLHARAMI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1032,6 +1892,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLHARAMI_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLHARAMI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLHARAMI(
+/* Generated */                   startIdx,
+/* Generated */                   endIdx,
+/* Generated */                   (const TA_Real *)in[0], /* inOpen */
+/* Generated */                   (const TA_Real *)in[1], /* inHigh */
+/* Generated */                   (const TA_Real *)in[2], /* inLow */
+/* Generated */                   (const TA_Real *)in[3], /* inClose */
+/* Generated */                   outBegIdx, 
+/* Generated */                   outNBElement, 
+/* Generated */                   (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLHARAMICROSS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1054,6 +1934,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLHARAMICROSS_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLHARAMICROSS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLHARAMICROSS(
+/* Generated */                        startIdx,
+/* Generated */                        endIdx,
+/* Generated */                        (const TA_Real *)in[0], /* inOpen */
+/* Generated */                        (const TA_Real *)in[1], /* inHigh */
+/* Generated */                        (const TA_Real *)in[2], /* inLow */
+/* Generated */                        (const TA_Real *)in[3], /* inClose */
+/* Generated */                        outBegIdx, 
+/* Generated */                        outNBElement, 
+/* Generated */                        (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLHIGHWAVE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1076,6 +1976,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLHIGHWAVE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLHIGHWAVE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLHIGHWAVE(
+/* Generated */                     startIdx,
+/* Generated */                     endIdx,
+/* Generated */                     (const TA_Real *)in[0], /* inOpen */
+/* Generated */                     (const TA_Real *)in[1], /* inHigh */
+/* Generated */                     (const TA_Real *)in[2], /* inLow */
+/* Generated */                     (const TA_Real *)in[3], /* inClose */
+/* Generated */                     outBegIdx, 
+/* Generated */                     outNBElement, 
+/* Generated */                     (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLHIKKAKE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1098,6 +2018,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLHIKKAKE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLHIKKAKE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLHIKKAKE(
+/* Generated */                    startIdx,
+/* Generated */                    endIdx,
+/* Generated */                    (const TA_Real *)in[0], /* inOpen */
+/* Generated */                    (const TA_Real *)in[1], /* inHigh */
+/* Generated */                    (const TA_Real *)in[2], /* inLow */
+/* Generated */                    (const TA_Real *)in[3], /* inClose */
+/* Generated */                    outBegIdx, 
+/* Generated */                    outNBElement, 
+/* Generated */                    (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLHIKKAKEMOD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1120,6 +2060,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLHIKKAKEMOD_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLHIKKAKEMOD_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLHIKKAKEMOD(
+/* Generated */                       startIdx,
+/* Generated */                       endIdx,
+/* Generated */                       (const TA_Real *)in[0], /* inOpen */
+/* Generated */                       (const TA_Real *)in[1], /* inHigh */
+/* Generated */                       (const TA_Real *)in[2], /* inLow */
+/* Generated */                       (const TA_Real *)in[3], /* inClose */
+/* Generated */                       outBegIdx, 
+/* Generated */                       outNBElement, 
+/* Generated */                       (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLHOMINGPIGEON_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1142,6 +2102,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLHOMINGPIGEON_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLHOMINGPIGEON_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLHOMINGPIGEON(
+/* Generated */                         startIdx,
+/* Generated */                         endIdx,
+/* Generated */                         (const TA_Real *)in[0], /* inOpen */
+/* Generated */                         (const TA_Real *)in[1], /* inHigh */
+/* Generated */                         (const TA_Real *)in[2], /* inLow */
+/* Generated */                         (const TA_Real *)in[3], /* inClose */
+/* Generated */                         outBegIdx, 
+/* Generated */                         outNBElement, 
+/* Generated */                         (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLIDENTICAL3CROWS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1164,6 +2144,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLIDENTICAL3CROWS_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLIDENTICAL3CROWS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLIDENTICAL3CROWS(
+/* Generated */                            startIdx,
+/* Generated */                            endIdx,
+/* Generated */                            (const TA_Real *)in[0], /* inOpen */
+/* Generated */                            (const TA_Real *)in[1], /* inHigh */
+/* Generated */                            (const TA_Real *)in[2], /* inLow */
+/* Generated */                            (const TA_Real *)in[3], /* inClose */
+/* Generated */                            outBegIdx, 
+/* Generated */                            outNBElement, 
+/* Generated */                            (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLINNECK_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1186,6 +2186,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLINNECK_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLINNECK_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLINNECK(
+/* Generated */                   startIdx,
+/* Generated */                   endIdx,
+/* Generated */                   (const TA_Real *)in[0], /* inOpen */
+/* Generated */                   (const TA_Real *)in[1], /* inHigh */
+/* Generated */                   (const TA_Real *)in[2], /* inLow */
+/* Generated */                   (const TA_Real *)in[3], /* inClose */
+/* Generated */                   outBegIdx, 
+/* Generated */                   outNBElement, 
+/* Generated */                   (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLINVERTEDHAMMER_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1208,6 +2228,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLINVERTEDHAMMER_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLINVERTEDHAMMER_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLINVERTEDHAMMER(
+/* Generated */                           startIdx,
+/* Generated */                           endIdx,
+/* Generated */                           (const TA_Real *)in[0], /* inOpen */
+/* Generated */                           (const TA_Real *)in[1], /* inHigh */
+/* Generated */                           (const TA_Real *)in[2], /* inLow */
+/* Generated */                           (const TA_Real *)in[3], /* inClose */
+/* Generated */                           outBegIdx, 
+/* Generated */                           outNBElement, 
+/* Generated */                           (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLKICKING_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1230,6 +2270,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLKICKING_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLKICKING_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLKICKING(
+/* Generated */                    startIdx,
+/* Generated */                    endIdx,
+/* Generated */                    (const TA_Real *)in[0], /* inOpen */
+/* Generated */                    (const TA_Real *)in[1], /* inHigh */
+/* Generated */                    (const TA_Real *)in[2], /* inLow */
+/* Generated */                    (const TA_Real *)in[3], /* inClose */
+/* Generated */                    outBegIdx, 
+/* Generated */                    outNBElement, 
+/* Generated */                    (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLKICKINGBYLENGTH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1252,6 +2312,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLKICKINGBYLENGTH_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLKICKINGBYLENGTH_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLKICKINGBYLENGTH(
+/* Generated */                            startIdx,
+/* Generated */                            endIdx,
+/* Generated */                            (const TA_Real *)in[0], /* inOpen */
+/* Generated */                            (const TA_Real *)in[1], /* inHigh */
+/* Generated */                            (const TA_Real *)in[2], /* inLow */
+/* Generated */                            (const TA_Real *)in[3], /* inClose */
+/* Generated */                            outBegIdx, 
+/* Generated */                            outNBElement, 
+/* Generated */                            (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLLADDERBOTTOM_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1274,6 +2354,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLLADDERBOTTOM_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLLADDERBOTTOM_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLLADDERBOTTOM(
+/* Generated */                         startIdx,
+/* Generated */                         endIdx,
+/* Generated */                         (const TA_Real *)in[0], /* inOpen */
+/* Generated */                         (const TA_Real *)in[1], /* inHigh */
+/* Generated */                         (const TA_Real *)in[2], /* inLow */
+/* Generated */                         (const TA_Real *)in[3], /* inClose */
+/* Generated */                         outBegIdx, 
+/* Generated */                         outNBElement, 
+/* Generated */                         (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLLONGLEGGEDDOJI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1296,6 +2396,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLLONGLEGGEDDOJI_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLLONGLEGGEDDOJI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLLONGLEGGEDDOJI(
+/* Generated */                           startIdx,
+/* Generated */                           endIdx,
+/* Generated */                           (const TA_Real *)in[0], /* inOpen */
+/* Generated */                           (const TA_Real *)in[1], /* inHigh */
+/* Generated */                           (const TA_Real *)in[2], /* inLow */
+/* Generated */                           (const TA_Real *)in[3], /* inClose */
+/* Generated */                           outBegIdx, 
+/* Generated */                           outNBElement, 
+/* Generated */                           (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLLONGLINE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1318,6 +2438,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLLONGLINE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLLONGLINE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLLONGLINE(
+/* Generated */                     startIdx,
+/* Generated */                     endIdx,
+/* Generated */                     (const TA_Real *)in[0], /* inOpen */
+/* Generated */                     (const TA_Real *)in[1], /* inHigh */
+/* Generated */                     (const TA_Real *)in[2], /* inLow */
+/* Generated */                     (const TA_Real *)in[3], /* inClose */
+/* Generated */                     outBegIdx, 
+/* Generated */                     outNBElement, 
+/* Generated */                     (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLMARUBOZU_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1340,6 +2480,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLMARUBOZU_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLMARUBOZU_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLMARUBOZU(
+/* Generated */                     startIdx,
+/* Generated */                     endIdx,
+/* Generated */                     (const TA_Real *)in[0], /* inOpen */
+/* Generated */                     (const TA_Real *)in[1], /* inHigh */
+/* Generated */                     (const TA_Real *)in[2], /* inLow */
+/* Generated */                     (const TA_Real *)in[3], /* inClose */
+/* Generated */                     outBegIdx, 
+/* Generated */                     outNBElement, 
+/* Generated */                     (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLMATCHINGLOW_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1362,6 +2522,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLMATCHINGLOW_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLMATCHINGLOW_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLMATCHINGLOW(
+/* Generated */                        startIdx,
+/* Generated */                        endIdx,
+/* Generated */                        (const TA_Real *)in[0], /* inOpen */
+/* Generated */                        (const TA_Real *)in[1], /* inHigh */
+/* Generated */                        (const TA_Real *)in[2], /* inLow */
+/* Generated */                        (const TA_Real *)in[3], /* inClose */
+/* Generated */                        outBegIdx, 
+/* Generated */                        outNBElement, 
+/* Generated */                        (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLMATHOLD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1384,21 +2564,41 @@
 /* Generated */ {
 /* Generated */    return TA_CDLMATHOLD_Lookback(params->optIn[0].data.optInReal /* optInPenetration*/ );
 /* Generated */ }
-/* Generated */ TA_RetCode TA_CDLMORNINGDOJISTAR_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */ TA_RetCode TA_CDLMATHOLD_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
 /* Generated */                           int           *outBegIdx,
 /* Generated */                           int           *outNBElement )
 /* Generated */ {
-/* Generated */    return TA_CDLMORNINGDOJISTAR(
-/* Generated */                            startIdx,
-/* Generated */                            endIdx,
-/* Generated */                            params->in[0].data.inPrice.open, /* inOpen */
-/* Generated */                            params->in[0].data.inPrice.high, /* inHigh */
-/* Generated */                            params->in[0].data.inPrice.low, /* inLow */
-/* Generated */                            params->in[0].data.inPrice.close, /* inClose */
-/* Generated */                            params->optIn[0].data.optInReal, /* optInPenetration*/
-/* Generated */                            outBegIdx, 
+/* Generated */    return TA_CDLMATHOLD(
+/* Generated */                    startIdx,
+/* Generated */                    endIdx,
+/* Generated */                    (const TA_Real *)in[0], /* inOpen */
+/* Generated */                    (const TA_Real *)in[1], /* inHigh */
+/* Generated */                    (const TA_Real *)in[2], /* inLow */
+/* Generated */                    (const TA_Real *)in[3], /* inClose */
+/* Generated */                    params->optIn[0].data.optInReal, /* optInPenetration*/
+/* Generated */                    outBegIdx, 
+/* Generated */                    outNBElement, 
+/* Generated */                    (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
+/* Generated */ TA_RetCode TA_CDLMORNINGDOJISTAR_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_CDLMORNINGDOJISTAR(
+/* Generated */                            startIdx,
+/* Generated */                            endIdx,
+/* Generated */                            params->in[0].data.inPrice.open, /* inOpen */
+/* Generated */                            params->in[0].data.inPrice.high, /* inHigh */
+/* Generated */                            params->in[0].data.inPrice.low, /* inLow */
+/* Generated */                            params->in[0].data.inPrice.close, /* inClose */
+/* Generated */                            params->optIn[0].data.optInReal, /* optInPenetration*/
+/* Generated */                            outBegIdx, 
 /* Generated */                            outNBElement, 
 /* Generated */                            params->out[0].data.outInteger /*  outInteger */ );
 /* Generated */ }
@@ -1406,6 +2606,26 @@
 /* Generated */ {
 /* Generated */    return TA_CDLMORNINGDOJISTAR_Lookback(params->optIn[0].data.optInReal /* optInPenetration*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLMORNINGDOJISTAR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_CDLMORNINGDOJISTAR(
+/* Generated */                            startIdx,
+/* Generated */                            endIdx,
+/* Generated */                            (const TA_Real *)in[0], /* inOpen */
+/* Generated */                            (const TA_Real *)in[1], /* inHigh */
+/* Generated */                            (const TA_Real *)in[2], /* inLow */
+/* Generated */                            (const TA_Real *)in[3], /* inClose */
+/* Generated */                            params->optIn[0].data.optInReal, /* optInPenetration*/
+/* Generated */                            outBegIdx, 
+/* Generated */                            outNBElement, 
+/* Generated */                            (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLMORNINGSTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1428,6 +2648,26 @@
 /* Generated */ {
 /* Generated */    return TA_CDLMORNINGSTAR_Lookback(params->optIn[0].data.optInReal /* optInPenetration*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLMORNINGSTAR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_CDLMORNINGSTAR(
+/* Generated */                        startIdx,
+/* Generated */                        endIdx,
+/* Generated */                        (const TA_Real *)in[0], /* inOpen */
+/* Generated */                        (const TA_Real *)in[1], /* inHigh */
+/* Generated */                        (const TA_Real *)in[2], /* inLow */
+/* Generated */                        (const TA_Real *)in[3], /* inClose */
+/* Generated */                        params->optIn[0].data.optInReal, /* optInPenetration*/
+/* Generated */                        outBegIdx, 
+/* Generated */                        outNBElement, 
+/* Generated */                        (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLONNECK_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1450,6 +2690,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLONNECK_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLONNECK_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLONNECK(
+/* Generated */                   startIdx,
+/* Generated */                   endIdx,
+/* Generated */                   (const TA_Real *)in[0], /* inOpen */
+/* Generated */                   (const TA_Real *)in[1], /* inHigh */
+/* Generated */                   (const TA_Real *)in[2], /* inLow */
+/* Generated */                   (const TA_Real *)in[3], /* inClose */
+/* Generated */                   outBegIdx, 
+/* Generated */                   outNBElement, 
+/* Generated */                   (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLPIERCING_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1472,6 +2732,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLPIERCING_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLPIERCING_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLPIERCING(
+/* Generated */                     startIdx,
+/* Generated */                     endIdx,
+/* Generated */                     (const TA_Real *)in[0], /* inOpen */
+/* Generated */                     (const TA_Real *)in[1], /* inHigh */
+/* Generated */                     (const TA_Real *)in[2], /* inLow */
+/* Generated */                     (const TA_Real *)in[3], /* inClose */
+/* Generated */                     outBegIdx, 
+/* Generated */                     outNBElement, 
+/* Generated */                     (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLRICKSHAWMAN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1494,6 +2774,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLRICKSHAWMAN_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLRICKSHAWMAN_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLRICKSHAWMAN(
+/* Generated */                        startIdx,
+/* Generated */                        endIdx,
+/* Generated */                        (const TA_Real *)in[0], /* inOpen */
+/* Generated */                        (const TA_Real *)in[1], /* inHigh */
+/* Generated */                        (const TA_Real *)in[2], /* inLow */
+/* Generated */                        (const TA_Real *)in[3], /* inClose */
+/* Generated */                        outBegIdx, 
+/* Generated */                        outNBElement, 
+/* Generated */                        (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLRISEFALL3METHODS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1516,6 +2816,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLRISEFALL3METHODS_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLRISEFALL3METHODS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLRISEFALL3METHODS(
+/* Generated */                             startIdx,
+/* Generated */                             endIdx,
+/* Generated */                             (const TA_Real *)in[0], /* inOpen */
+/* Generated */                             (const TA_Real *)in[1], /* inHigh */
+/* Generated */                             (const TA_Real *)in[2], /* inLow */
+/* Generated */                             (const TA_Real *)in[3], /* inClose */
+/* Generated */                             outBegIdx, 
+/* Generated */                             outNBElement, 
+/* Generated */                             (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLSEPARATINGLINES_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1538,6 +2858,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLSEPARATINGLINES_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLSEPARATINGLINES_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLSEPARATINGLINES(
+/* Generated */                            startIdx,
+/* Generated */                            endIdx,
+/* Generated */                            (const TA_Real *)in[0], /* inOpen */
+/* Generated */                            (const TA_Real *)in[1], /* inHigh */
+/* Generated */                            (const TA_Real *)in[2], /* inLow */
+/* Generated */                            (const TA_Real *)in[3], /* inClose */
+/* Generated */                            outBegIdx, 
+/* Generated */                            outNBElement, 
+/* Generated */                            (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLSHOOTINGSTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1560,6 +2900,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLSHOOTINGSTAR_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLSHOOTINGSTAR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLSHOOTINGSTAR(
+/* Generated */                         startIdx,
+/* Generated */                         endIdx,
+/* Generated */                         (const TA_Real *)in[0], /* inOpen */
+/* Generated */                         (const TA_Real *)in[1], /* inHigh */
+/* Generated */                         (const TA_Real *)in[2], /* inLow */
+/* Generated */                         (const TA_Real *)in[3], /* inClose */
+/* Generated */                         outBegIdx, 
+/* Generated */                         outNBElement, 
+/* Generated */                         (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLSHORTLINE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1582,6 +2942,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLSHORTLINE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLSHORTLINE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLSHORTLINE(
+/* Generated */                      startIdx,
+/* Generated */                      endIdx,
+/* Generated */                      (const TA_Real *)in[0], /* inOpen */
+/* Generated */                      (const TA_Real *)in[1], /* inHigh */
+/* Generated */                      (const TA_Real *)in[2], /* inLow */
+/* Generated */                      (const TA_Real *)in[3], /* inClose */
+/* Generated */                      outBegIdx, 
+/* Generated */                      outNBElement, 
+/* Generated */                      (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLSPINNINGTOP_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1604,6 +2984,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLSPINNINGTOP_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLSPINNINGTOP_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLSPINNINGTOP(
+/* Generated */                        startIdx,
+/* Generated */                        endIdx,
+/* Generated */                        (const TA_Real *)in[0], /* inOpen */
+/* Generated */                        (const TA_Real *)in[1], /* inHigh */
+/* Generated */                        (const TA_Real *)in[2], /* inLow */
+/* Generated */                        (const TA_Real *)in[3], /* inClose */
+/* Generated */                        outBegIdx, 
+/* Generated */                        outNBElement, 
+/* Generated */                        (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLSTALLEDPATTERN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1626,6 +3026,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLSTALLEDPATTERN_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLSTALLEDPATTERN_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLSTALLEDPATTERN(
+/* Generated */                           startIdx,
+/* Generated */                           endIdx,
+/* Generated */                           (const TA_Real *)in[0], /* inOpen */
+/* Generated */                           (const TA_Real *)in[1], /* inHigh */
+/* Generated */                           (const TA_Real *)in[2], /* inLow */
+/* Generated */                           (const TA_Real *)in[3], /* inClose */
+/* Generated */                           outBegIdx, 
+/* Generated */                           outNBElement, 
+/* Generated */                           (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLSTICKSANDWICH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1648,6 +3068,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLSTICKSANDWICH_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLSTICKSANDWICH_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLSTICKSANDWICH(
+/* Generated */                          startIdx,
+/* Generated */                          endIdx,
+/* Generated */                          (const TA_Real *)in[0], /* inOpen */
+/* Generated */                          (const TA_Real *)in[1], /* inHigh */
+/* Generated */                          (const TA_Real *)in[2], /* inLow */
+/* Generated */                          (const TA_Real *)in[3], /* inClose */
+/* Generated */                          outBegIdx, 
+/* Generated */                          outNBElement, 
+/* Generated */                          (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLTAKURI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1670,6 +3110,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLTAKURI_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLTAKURI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLTAKURI(
+/* Generated */                   startIdx,
+/* Generated */                   endIdx,
+/* Generated */                   (const TA_Real *)in[0], /* inOpen */
+/* Generated */                   (const TA_Real *)in[1], /* inHigh */
+/* Generated */                   (const TA_Real *)in[2], /* inLow */
+/* Generated */                   (const TA_Real *)in[3], /* inClose */
+/* Generated */                   outBegIdx, 
+/* Generated */                   outNBElement, 
+/* Generated */                   (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLTASUKIGAP_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1692,6 +3152,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLTASUKIGAP_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLTASUKIGAP_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLTASUKIGAP(
+/* Generated */                      startIdx,
+/* Generated */                      endIdx,
+/* Generated */                      (const TA_Real *)in[0], /* inOpen */
+/* Generated */                      (const TA_Real *)in[1], /* inHigh */
+/* Generated */                      (const TA_Real *)in[2], /* inLow */
+/* Generated */                      (const TA_Real *)in[3], /* inClose */
+/* Generated */                      outBegIdx, 
+/* Generated */                      outNBElement, 
+/* Generated */                      (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLTHRUSTING_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1714,6 +3194,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLTHRUSTING_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLTHRUSTING_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLTHRUSTING(
+/* Generated */                      startIdx,
+/* Generated */                      endIdx,
+/* Generated */                      (const TA_Real *)in[0], /* inOpen */
+/* Generated */                      (const TA_Real *)in[1], /* inHigh */
+/* Generated */                      (const TA_Real *)in[2], /* inLow */
+/* Generated */                      (const TA_Real *)in[3], /* inClose */
+/* Generated */                      outBegIdx, 
+/* Generated */                      outNBElement, 
+/* Generated */                      (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLTRISTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1736,6 +3236,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLTRISTAR_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLTRISTAR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLTRISTAR(
+/* Generated */                    startIdx,
+/* Generated */                    endIdx,
+/* Generated */                    (const TA_Real *)in[0], /* inOpen */
+/* Generated */                    (const TA_Real *)in[1], /* inHigh */
+/* Generated */                    (const TA_Real *)in[2], /* inLow */
+/* Generated */                    (const TA_Real *)in[3], /* inClose */
+/* Generated */                    outBegIdx, 
+/* Generated */                    outNBElement, 
+/* Generated */                    (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLUNIQUE3RIVER_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1758,6 +3278,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLUNIQUE3RIVER_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLUNIQUE3RIVER_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLUNIQUE3RIVER(
+/* Generated */                         startIdx,
+/* Generated */                         endIdx,
+/* Generated */                         (const TA_Real *)in[0], /* inOpen */
+/* Generated */                         (const TA_Real *)in[1], /* inHigh */
+/* Generated */                         (const TA_Real *)in[2], /* inLow */
+/* Generated */                         (const TA_Real *)in[3], /* inClose */
+/* Generated */                         outBegIdx, 
+/* Generated */                         outNBElement, 
+/* Generated */                         (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLUPSIDEGAP2CROWS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1780,6 +3320,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLUPSIDEGAP2CROWS_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLUPSIDEGAP2CROWS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLUPSIDEGAP2CROWS(
+/* Generated */                            startIdx,
+/* Generated */                            endIdx,
+/* Generated */                            (const TA_Real *)in[0], /* inOpen */
+/* Generated */                            (const TA_Real *)in[1], /* inHigh */
+/* Generated */                            (const TA_Real *)in[2], /* inLow */
+/* Generated */                            (const TA_Real *)in[3], /* inClose */
+/* Generated */                            outBegIdx, 
+/* Generated */                            outNBElement, 
+/* Generated */                            (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLXSIDEGAP3METHODS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1802,6 +3362,26 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLXSIDEGAP3METHODS_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLXSIDEGAP3METHODS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_CDLXSIDEGAP3METHODS(
+/* Generated */                             startIdx,
+/* Generated */                             endIdx,
+/* Generated */                             (const TA_Real *)in[0], /* inOpen */
+/* Generated */                             (const TA_Real *)in[1], /* inHigh */
+/* Generated */                             (const TA_Real *)in[2], /* inLow */
+/* Generated */                             (const TA_Real *)in[3], /* inClose */
+/* Generated */                             outBegIdx, 
+/* Generated */                             outNBElement, 
+/* Generated */                             (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CEIL_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1821,17 +3401,34 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CEIL_Lookback( );
 /* Generated */ }
-/* Generated */ TA_RetCode TA_CMO_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */ TA_RetCode TA_CEIL_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
 /* Generated */                           int           *outBegIdx,
 /* Generated */                           int           *outNBElement )
 /* Generated */ {
-/* Generated */    return TA_CMO(
-/* Generated */             startIdx,
-/* Generated */             endIdx,
-/* Generated */             params->in[0].data.inReal, /* inReal */
-/* Generated */             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */    (void)params;
+/* Generated */    return TA_CEIL(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              (const TA_Real *)in[0], /* inReal */
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
+/* Generated */ TA_RetCode TA_CMO_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_CMO(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             params->in[0].data.inReal, /* inReal */
+/* Generated */             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
 /* Generated */             outBegIdx, 
 /* Generated */             outNBElement, 
 /* Generated */             params->out[0].data.outReal /*  outReal */ );
@@ -1840,6 +3437,23 @@
 /* Generated */ {
 /* Generated */    return TA_CMO_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CMO_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_CMO(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inReal */
+/* Generated */             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CORREL_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1860,6 +3474,24 @@
 /* Generated */ {
 /* Generated */    return TA_CORREL_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CORREL_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_CORREL(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                (const TA_Real *)in[0], /* inReal0 */
+/* Generated */                (const TA_Real *)in[1], /* inReal1 */
+/* Generated */                params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_COS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1879,6 +3511,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_COS_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_COS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_COS(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inReal */
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_COSH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1898,6 +3547,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_COSH_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_COSH_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_COSH(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              (const TA_Real *)in[0], /* inReal */
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_DEMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1917,6 +3583,23 @@
 /* Generated */ {
 /* Generated */    return TA_DEMA_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_DEMA_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_DEMA(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              (const TA_Real *)in[0], /* inReal */
+/* Generated */              params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_DIV_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1937,6 +3620,24 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_DIV_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_DIV_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_DIV(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inReal0 */
+/* Generated */             (const TA_Real *)in[1], /* inReal1 */
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_DX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1958,6 +3659,25 @@
 /* Generated */ {
 /* Generated */    return TA_DX_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_DX_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_DX(
+/* Generated */            startIdx,
+/* Generated */            endIdx,
+/* Generated */            (const TA_Real *)in[0], /* inHigh */
+/* Generated */            (const TA_Real *)in[1], /* inLow */
+/* Generated */            (const TA_Real *)in[2], /* inClose */
+/* Generated */            params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */            outBegIdx, 
+/* Generated */            outNBElement, 
+/* Generated */            (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_EMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1977,6 +3697,23 @@
 /* Generated */ {
 /* Generated */    return TA_EMA_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_EMA_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_EMA(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inReal */
+/* Generated */             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_EXP_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1996,6 +3733,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_EXP_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_EXP_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_EXP(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inReal */
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_FLOOR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2015,6 +3769,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_FLOOR_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_FLOOR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_FLOOR(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               (const TA_Real *)in[0], /* inReal */
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_HT_DCPERIOD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2034,6 +3805,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_HT_DCPERIOD_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_HT_DCPERIOD_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_HT_DCPERIOD(
+/* Generated */                     startIdx,
+/* Generated */                     endIdx,
+/* Generated */                     (const TA_Real *)in[0], /* inReal */
+/* Generated */                     outBegIdx, 
+/* Generated */                     outNBElement, 
+/* Generated */                     (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_HT_DCPHASE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2053,6 +3841,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_HT_DCPHASE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_HT_DCPHASE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_HT_DCPHASE(
+/* Generated */                    startIdx,
+/* Generated */                    endIdx,
+/* Generated */                    (const TA_Real *)in[0], /* inReal */
+/* Generated */                    outBegIdx, 
+/* Generated */                    outNBElement, 
+/* Generated */                    (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_HT_PHASOR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2073,6 +3878,24 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_HT_PHASOR_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_HT_PHASOR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_HT_PHASOR(
+/* Generated */                   startIdx,
+/* Generated */                   endIdx,
+/* Generated */                   (const TA_Real *)in[0], /* inReal */
+/* Generated */                   outBegIdx, 
+/* Generated */                   outNBElement, 
+/* Generated */                   (TA_Real *)out[0], /*  outInPhase */
+/* Generated */                   (TA_Real *)out[1] /*  outQuadrature */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_HT_SINE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2093,6 +3916,24 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_HT_SINE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_HT_SINE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_HT_SINE(
+/* Generated */                 startIdx,
+/* Generated */                 endIdx,
+/* Generated */                 (const TA_Real *)in[0], /* inReal */
+/* Generated */                 outBegIdx, 
+/* Generated */                 outNBElement, 
+/* Generated */                 (TA_Real *)out[0], /*  outSine */
+/* Generated */                 (TA_Real *)out[1] /*  outLeadSine */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_HT_TRENDLINE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2112,6 +3953,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_HT_TRENDLINE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_HT_TRENDLINE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_HT_TRENDLINE(
+/* Generated */                      startIdx,
+/* Generated */                      endIdx,
+/* Generated */                      (const TA_Real *)in[0], /* inReal */
+/* Generated */                      outBegIdx, 
+/* Generated */                      outNBElement, 
+/* Generated */                      (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_HT_TRENDMODE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2131,6 +3989,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_HT_TRENDMODE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_HT_TRENDMODE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_HT_TRENDMODE(
+/* Generated */                      startIdx,
+/* Generated */                      endIdx,
+/* Generated */                      (const TA_Real *)in[0], /* inReal */
+/* Generated */                      outBegIdx, 
+/* Generated */                      outNBElement, 
+/* Generated */                      (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_IMI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2151,6 +4026,24 @@
 /* Generated */ {
 /* Generated */    return TA_IMI_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_IMI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_IMI(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inOpen */
+/* Generated */             (const TA_Real *)in[1], /* inClose */
+/* Generated */             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_KAMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2170,6 +4063,23 @@
 /* Generated */ {
 /* Generated */    return TA_KAMA_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_KAMA_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_KAMA(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              (const TA_Real *)in[0], /* inReal */
+/* Generated */              params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_LINEARREG_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2189,6 +4099,23 @@
 /* Generated */ {
 /* Generated */    return TA_LINEARREG_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_LINEARREG_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_LINEARREG(
+/* Generated */                   startIdx,
+/* Generated */                   endIdx,
+/* Generated */                   (const TA_Real *)in[0], /* inReal */
+/* Generated */                   params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                   outBegIdx, 
+/* Generated */                   outNBElement, 
+/* Generated */                   (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_LINEARREG_ANGLE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2206,9 +4133,47 @@
 /* Generated */ }
 /* Generated */ unsigned int TA_LINEARREG_ANGLE_FramePPLB( const TA_ParamHolderPriv *params )
 /* Generated */ {
-/* Generated */    return TA_LINEARREG_ANGLE_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
+/* Generated */    return TA_LINEARREG_ANGLE_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
+/* Generated */ }
+/* Generated */ TA_RetCode TA_LINEARREG_ANGLE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_LINEARREG_ANGLE(
+/* Generated */                         startIdx,
+/* Generated */                         endIdx,
+/* Generated */                         (const TA_Real *)in[0], /* inReal */
+/* Generated */                         params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                         outBegIdx, 
+/* Generated */                         outNBElement, 
+/* Generated */                         (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
+/* Generated */ TA_RetCode TA_LINEARREG_INTERCEPT_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_LINEARREG_INTERCEPT(
+/* Generated */                             startIdx,
+/* Generated */                             endIdx,
+/* Generated */                             params->in[0].data.inReal, /* inReal */
+/* Generated */                             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                             outBegIdx, 
+/* Generated */                             outNBElement, 
+/* Generated */                             params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
+/* Generated */ unsigned int TA_LINEARREG_INTERCEPT_FramePPLB( const TA_ParamHolderPriv *params )
+/* Generated */ {
+/* Generated */    return TA_LINEARREG_INTERCEPT_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
-/* Generated */ TA_RetCode TA_LINEARREG_INTERCEPT_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */ TA_RetCode TA_LINEARREG_INTERCEPT_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
 /* Generated */                           int           *outBegIdx,
@@ -2217,15 +4182,11 @@
 /* Generated */    return TA_LINEARREG_INTERCEPT(
 /* Generated */                             startIdx,
 /* Generated */                             endIdx,
-/* Generated */                             params->in[0].data.inReal, /* inReal */
+/* Generated */                             (const TA_Real *)in[0], /* inReal */
 /* Generated */                             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
 /* Generated */                             outBegIdx, 
 /* Generated */                             outNBElement, 
-/* Generated */                             params->out[0].data.outReal /*  outReal */ );
-/* Generated */ }
-/* Generated */ unsigned int TA_LINEARREG_INTERCEPT_FramePPLB( const TA_ParamHolderPriv *params )
-/* Generated */ {
-/* Generated */    return TA_LINEARREG_INTERCEPT_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
+/* Generated */                             (TA_Real *)out[0] /*  outReal */ );
 /* Generated */ }
 /* Generated */ TA_RetCode TA_LINEARREG_SLOPE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -2246,6 +4207,23 @@
 /* Generated */ {
 /* Generated */    return TA_LINEARREG_SLOPE_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_LINEARREG_SLOPE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_LINEARREG_SLOPE(
+/* Generated */                         startIdx,
+/* Generated */                         endIdx,
+/* Generated */                         (const TA_Real *)in[0], /* inReal */
+/* Generated */                         params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                         outBegIdx, 
+/* Generated */                         outNBElement, 
+/* Generated */                         (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_LN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2265,6 +4243,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_LN_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_LN_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_LN(
+/* Generated */            startIdx,
+/* Generated */            endIdx,
+/* Generated */            (const TA_Real *)in[0], /* inReal */
+/* Generated */            outBegIdx, 
+/* Generated */            outNBElement, 
+/* Generated */            (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_LOG10_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2284,6 +4279,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_LOG10_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_LOG10_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_LOG10(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               (const TA_Real *)in[0], /* inReal */
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2305,6 +4317,24 @@
 /* Generated */    return TA_MA_Lookback(params->optIn[0].data.optInInteger, /* optInTimePeriod*/
 /* Generated */                    (TA_MAType)params->optIn[1].data.optInInteger /* optInMAType*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MA_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_MA(
+/* Generated */            startIdx,
+/* Generated */            endIdx,
+/* Generated */            (const TA_Real *)in[0], /* inReal */
+/* Generated */            params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */            (TA_MAType)params->optIn[1].data.optInInteger, /* optInMAType*/
+/* Generated */            outBegIdx, 
+/* Generated */            outNBElement, 
+/* Generated */            (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MACD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2330,6 +4360,27 @@
 /* Generated */                      params->optIn[1].data.optInInteger, /* optInSlowPeriod*/
 /* Generated */                      params->optIn[2].data.optInInteger /* optInSignalPeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MACD_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_MACD(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              (const TA_Real *)in[0], /* inReal */
+/* Generated */              params->optIn[0].data.optInInteger, /* optInFastPeriod*/
+/* Generated */              params->optIn[1].data.optInInteger, /* optInSlowPeriod*/
+/* Generated */              params->optIn[2].data.optInInteger, /* optInSignalPeriod*/
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              (TA_Real *)out[0], /*  outMACD */
+/* Generated */              (TA_Real *)out[1], /*  outMACDSignal */
+/* Generated */              (TA_Real *)out[2] /*  outMACDHist */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MACDEXT_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2361,6 +4412,30 @@
 /* Generated */                         params->optIn[4].data.optInInteger, /* optInSignalPeriod*/
 /* Generated */                         (TA_MAType)params->optIn[5].data.optInInteger /* optInSignalMAType*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MACDEXT_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_MACDEXT(
+/* Generated */                 startIdx,
+/* Generated */                 endIdx,
+/* Generated */                 (const TA_Real *)in[0], /* inReal */
+/* Generated */                 params->optIn[0].data.optInInteger, /* optInFastPeriod*/
+/* Generated */                 (TA_MAType)params->optIn[1].data.optInInteger, /* optInFastMAType*/
+/* Generated */                 params->optIn[2].data.optInInteger, /* optInSlowPeriod*/
+/* Generated */                 (TA_MAType)params->optIn[3].data.optInInteger, /* optInSlowMAType*/
+/* Generated */                 params->optIn[4].data.optInInteger, /* optInSignalPeriod*/
+/* Generated */                 (TA_MAType)params->optIn[5].data.optInInteger, /* optInSignalMAType*/
+/* Generated */                 outBegIdx, 
+/* Generated */                 outNBElement, 
+/* Generated */                 (TA_Real *)out[0], /*  outMACD */
+/* Generated */                 (TA_Real *)out[1], /*  outMACDSignal */
+/* Generated */                 (TA_Real *)out[2] /*  outMACDHist */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MACDFIX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2382,6 +4457,25 @@
 /* Generated */ {
 /* Generated */    return TA_MACDFIX_Lookback(params->optIn[0].data.optInInteger /* optInSignalPeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MACDFIX_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_MACDFIX(
+/* Generated */                 startIdx,
+/* Generated */                 endIdx,
+/* Generated */                 (const TA_Real *)in[0], /* inReal */
+/* Generated */                 params->optIn[0].data.optInInteger, /* optInSignalPeriod*/
+/* Generated */                 outBegIdx, 
+/* Generated */                 outNBElement, 
+/* Generated */                 (TA_Real *)out[0], /*  outMACD */
+/* Generated */                 (TA_Real *)out[1], /*  outMACDSignal */
+/* Generated */                 (TA_Real *)out[2] /*  outMACDHist */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MAMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2404,6 +4498,25 @@
 /* Generated */    return TA_MAMA_Lookback(params->optIn[0].data.optInReal, /* optInFastLimit*/
 /* Generated */                      params->optIn[1].data.optInReal /* optInSlowLimit*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MAMA_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_MAMA(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              (const TA_Real *)in[0], /* inReal */
+/* Generated */              params->optIn[0].data.optInReal, /* optInFastLimit*/
+/* Generated */              params->optIn[1].data.optInReal, /* optInSlowLimit*/
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              (TA_Real *)out[0], /*  outMAMA */
+/* Generated */              (TA_Real *)out[1] /*  outFAMA */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MAVP_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2428,6 +4541,26 @@
 /* Generated */                      params->optIn[1].data.optInInteger, /* optInMaxPeriod*/
 /* Generated */                      (TA_MAType)params->optIn[2].data.optInInteger /* optInMAType*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MAVP_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_MAVP(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              (const TA_Real *)in[0], /* inReal */
+/* Generated */              (const TA_Real *)in[1], /* inPeriods */
+/* Generated */              params->optIn[0].data.optInInteger, /* optInMinPeriod*/
+/* Generated */              params->optIn[1].data.optInInteger, /* optInMaxPeriod*/
+/* Generated */              (TA_MAType)params->optIn[2].data.optInInteger, /* optInMAType*/
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MAX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2447,6 +4580,23 @@
 /* Generated */ {
 /* Generated */    return TA_MAX_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MAX_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_MAX(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inReal */
+/* Generated */             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MAXINDEX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2466,6 +4616,23 @@
 /* Generated */ {
 /* Generated */    return TA_MAXINDEX_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MAXINDEX_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_MAXINDEX(
+/* Generated */                  startIdx,
+/* Generated */                  endIdx,
+/* Generated */                  (const TA_Real *)in[0], /* inReal */
+/* Generated */                  params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                  outBegIdx, 
+/* Generated */                  outNBElement, 
+/* Generated */                  (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MEDPRICE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2486,6 +4653,24 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_MEDPRICE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MEDPRICE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_MEDPRICE(
+/* Generated */                  startIdx,
+/* Generated */                  endIdx,
+/* Generated */                  (const TA_Real *)in[0], /* inHigh */
+/* Generated */                  (const TA_Real *)in[1], /* inLow */
+/* Generated */                  outBegIdx, 
+/* Generated */                  outNBElement, 
+/* Generated */                  (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MFI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2508,6 +4693,26 @@
 /* Generated */ {
 /* Generated */    return TA_MFI_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MFI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_MFI(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inHigh */
+/* Generated */             (const TA_Real *)in[1], /* inLow */
+/* Generated */             (const TA_Real *)in[2], /* inClose */
+/* Generated */             (const TA_Real *)in[3], /* inVolume */
+/* Generated */             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MIDPOINT_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2527,6 +4732,23 @@
 /* Generated */ {
 /* Generated */    return TA_MIDPOINT_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MIDPOINT_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_MIDPOINT(
+/* Generated */                  startIdx,
+/* Generated */                  endIdx,
+/* Generated */                  (const TA_Real *)in[0], /* inReal */
+/* Generated */                  params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                  outBegIdx, 
+/* Generated */                  outNBElement, 
+/* Generated */                  (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MIDPRICE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2547,6 +4769,24 @@
 /* Generated */ {
 /* Generated */    return TA_MIDPRICE_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MIDPRICE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_MIDPRICE(
+/* Generated */                  startIdx,
+/* Generated */                  endIdx,
+/* Generated */                  (const TA_Real *)in[0], /* inHigh */
+/* Generated */                  (const TA_Real *)in[1], /* inLow */
+/* Generated */                  params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                  outBegIdx, 
+/* Generated */                  outNBElement, 
+/* Generated */                  (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MIN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2566,6 +4806,23 @@
 /* Generated */ {
 /* Generated */    return TA_MIN_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MIN_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_MIN(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inReal */
+/* Generated */             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MININDEX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2585,6 +4842,23 @@
 /* Generated */ {
 /* Generated */    return TA_MININDEX_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MININDEX_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_MININDEX(
+/* Generated */                  startIdx,
+/* Generated */                  endIdx,
+/* Generated */                  (const TA_Real *)in[0], /* inReal */
+/* Generated */                  params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                  outBegIdx, 
+/* Generated */                  outNBElement, 
+/* Generated */                  (TA_Integer *)out[0] /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MINMAX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2605,7 +4879,47 @@
 /* Generated */ {
 /* Generated */    return TA_MINMAX_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
-/* Generated */ TA_RetCode TA_MINMAXINDEX_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */ TA_RetCode TA_MINMAX_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_MINMAX(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                (const TA_Real *)in[0], /* inReal */
+/* Generated */                params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                (TA_Real *)out[0], /*  outMin */
+/* Generated */                (TA_Real *)out[1] /*  outMax */ );
+/* Generated */ }
+/* Generated */ TA_RetCode TA_MINMAXINDEX_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_MINMAXINDEX(
+/* Generated */                     startIdx,
+/* Generated */                     endIdx,
+/* Generated */                     params->in[0].data.inReal, /* inReal */
+/* Generated */                     params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                     outBegIdx, 
+/* Generated */                     outNBElement, 
+/* Generated */                     params->out[0].data.outInteger, /*  outMinIdx */
+/* Generated */                     params->out[1].data.outInteger /*  outMaxIdx */ );
+/* Generated */ }
+/* Generated */ unsigned int TA_MINMAXINDEX_FramePPLB( const TA_ParamHolderPriv *params )
+/* Generated */ {
+/* Generated */    return TA_MINMAXINDEX_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
+/* Generated */ }
+/* Generated */ TA_RetCode TA_MINMAXINDEX_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
 /* Generated */                           int           *outBegIdx,
@@ -2614,16 +4928,12 @@
 /* Generated */    return TA_MINMAXINDEX(
 /* Generated */                     startIdx,
 /* Generated */                     endIdx,
-/* Generated */                     params->in[0].data.inReal, /* inReal */
+/* Generated */                     (const TA_Real *)in[0], /* inReal */
 /* Generated */                     params->optIn[0].data.optInInteger, /* optInTimePeriod*/
 /* Generated */                     outBegIdx, 
 /* Generated */                     outNBElement, 
-/* Generated */                     params->out[0].data.outInteger, /*  outMinIdx */
-/* Generated */                     params->out[1].data.outInteger /*  outMaxIdx */ );
-/* Generated */ }
-/* Generated */ unsigned int TA_MINMAXINDEX_FramePPLB( const TA_ParamHolderPriv *params )
-/* Generated */ {
-/* Generated */    return TA_MINMAXINDEX_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
+/* Generated */                     (TA_Integer *)out[0], /*  outMinIdx */
+/* Generated */                     (TA_Integer *)out[1] /*  outMaxIdx */ );
 /* Generated */ }
 /* Generated */ TA_RetCode TA_MINUS_DI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -2646,6 +4956,25 @@
 /* Generated */ {
 /* Generated */    return TA_MINUS_DI_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MINUS_DI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_MINUS_DI(
+/* Generated */                  startIdx,
+/* Generated */                  endIdx,
+/* Generated */                  (const TA_Real *)in[0], /* inHigh */
+/* Generated */                  (const TA_Real *)in[1], /* inLow */
+/* Generated */                  (const TA_Real *)in[2], /* inClose */
+/* Generated */                  params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                  outBegIdx, 
+/* Generated */                  outNBElement, 
+/* Generated */                  (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MINUS_DM_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2666,6 +4995,24 @@
 /* Generated */ {
 /* Generated */    return TA_MINUS_DM_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MINUS_DM_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_MINUS_DM(
+/* Generated */                  startIdx,
+/* Generated */                  endIdx,
+/* Generated */                  (const TA_Real *)in[0], /* inHigh */
+/* Generated */                  (const TA_Real *)in[1], /* inLow */
+/* Generated */                  params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                  outBegIdx, 
+/* Generated */                  outNBElement, 
+/* Generated */                  (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MOM_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2685,6 +5032,23 @@
 /* Generated */ {
 /* Generated */    return TA_MOM_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MOM_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_MOM(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inReal */
+/* Generated */             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MULT_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2705,6 +5069,24 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_MULT_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MULT_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_MULT(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              (const TA_Real *)in[0], /* inReal0 */
+/* Generated */              (const TA_Real *)in[1], /* inReal1 */
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_NATR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2726,6 +5108,25 @@
 /* Generated */ {
 /* Generated */    return TA_NATR_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_NATR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_NATR(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              (const TA_Real *)in[0], /* inHigh */
+/* Generated */              (const TA_Real *)in[1], /* inLow */
+/* Generated */              (const TA_Real *)in[2], /* inClose */
+/* Generated */              params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_OBV_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2746,6 +5147,24 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_OBV_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_OBV_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_OBV(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inReal */
+/* Generated */             (const TA_Real *)in[1], /* inVolume */
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_PLUS_DI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2767,6 +5186,25 @@
 /* Generated */ {
 /* Generated */    return TA_PLUS_DI_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_PLUS_DI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_PLUS_DI(
+/* Generated */                 startIdx,
+/* Generated */                 endIdx,
+/* Generated */                 (const TA_Real *)in[0], /* inHigh */
+/* Generated */                 (const TA_Real *)in[1], /* inLow */
+/* Generated */                 (const TA_Real *)in[2], /* inClose */
+/* Generated */                 params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                 outBegIdx, 
+/* Generated */                 outNBElement, 
+/* Generated */                 (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_PLUS_DM_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2787,6 +5225,24 @@
 /* Generated */ {
 /* Generated */    return TA_PLUS_DM_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_PLUS_DM_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_PLUS_DM(
+/* Generated */                 startIdx,
+/* Generated */                 endIdx,
+/* Generated */                 (const TA_Real *)in[0], /* inHigh */
+/* Generated */                 (const TA_Real *)in[1], /* inLow */
+/* Generated */                 params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                 outBegIdx, 
+/* Generated */                 outNBElement, 
+/* Generated */                 (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_PPO_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2810,6 +5266,25 @@
 /* Generated */                     params->optIn[1].data.optInInteger, /* optInSlowPeriod*/
 /* Generated */                     (TA_MAType)params->optIn[2].data.optInInteger /* optInMAType*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_PPO_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_PPO(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inReal */
+/* Generated */             params->optIn[0].data.optInInteger, /* optInFastPeriod*/
+/* Generated */             params->optIn[1].data.optInInteger, /* optInSlowPeriod*/
+/* Generated */             (TA_MAType)params->optIn[2].data.optInInteger, /* optInMAType*/
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ROC_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2829,6 +5304,23 @@
 /* Generated */ {
 /* Generated */    return TA_ROC_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ROC_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_ROC(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inReal */
+/* Generated */             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ROCP_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2848,6 +5340,23 @@
 /* Generated */ {
 /* Generated */    return TA_ROCP_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ROCP_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_ROCP(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              (const TA_Real *)in[0], /* inReal */
+/* Generated */              params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ROCR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2867,6 +5376,23 @@
 /* Generated */ {
 /* Generated */    return TA_ROCR_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ROCR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_ROCR(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              (const TA_Real *)in[0], /* inReal */
+/* Generated */              params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ROCR100_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2886,6 +5412,23 @@
 /* Generated */ {
 /* Generated */    return TA_ROCR100_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ROCR100_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_ROCR100(
+/* Generated */                 startIdx,
+/* Generated */                 endIdx,
+/* Generated */                 (const TA_Real *)in[0], /* inReal */
+/* Generated */                 params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                 outBegIdx, 
+/* Generated */                 outNBElement, 
+/* Generated */                 (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_RSI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2905,6 +5448,23 @@
 /* Generated */ {
 /* Generated */    return TA_RSI_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_RSI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_RSI(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inReal */
+/* Generated */             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_SAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2927,6 +5487,25 @@
 /* Generated */    return TA_SAR_Lookback(params->optIn[0].data.optInReal, /* optInAcceleration*/
 /* Generated */                     params->optIn[1].data.optInReal /* optInMaximum*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_SAR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_SAR(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inHigh */
+/* Generated */             (const TA_Real *)in[1], /* inLow */
+/* Generated */             params->optIn[0].data.optInReal, /* optInAcceleration*/
+/* Generated */             params->optIn[1].data.optInReal, /* optInMaximum*/
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_SAREXT_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2961,6 +5540,31 @@
 /* Generated */                        params->optIn[6].data.optInReal, /* optInAccelerationShort*/
 /* Generated */                        params->optIn[7].data.optInReal /* optInAccelerationMaxShort*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_SAREXT_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_SAREXT(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                (const TA_Real *)in[0], /* inHigh */
+/* Generated */                (const TA_Real *)in[1], /* inLow */
+/* Generated */                params->optIn[0].data.optInReal, /* optInStartValue*/
+/* Generated */                params->optIn[1].data.optInReal, /* optInOffsetOnReverse*/
+/* Generated */                params->optIn[2].data.optInReal, /* optInAccelerationInitLong*/
+/* Generated */                params->optIn[3].data.optInReal, /* optInAccelerationLong*/
+/* Generated */                params->optIn[4].data.optInReal, /* optInAccelerationMaxLong*/
+/* Generated */                params->optIn[5].data.optInReal, /* optInAccelerationInitShort*/
+/* Generated */                params->optIn[6].data.optInReal, /* optInAccelerationShort*/
+/* Generated */                params->optIn[7].data.optInReal, /* optInAccelerationMaxShort*/
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_SIN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2980,6 +5584,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_SIN_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_SIN_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_SIN(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inReal */
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_SINH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2999,6 +5620,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_SINH_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_SINH_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_SINH(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              (const TA_Real *)in[0], /* inReal */
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_SMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3018,6 +5656,23 @@
 /* Generated */ {
 /* Generated */    return TA_SMA_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_SMA_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_SMA(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inReal */
+/* Generated */             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_SQRT_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3037,6 +5692,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_SQRT_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_SQRT_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_SQRT(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              (const TA_Real *)in[0], /* inReal */
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_STDDEV_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3058,6 +5730,24 @@
 /* Generated */    return TA_STDDEV_Lookback(params->optIn[0].data.optInInteger, /* optInTimePeriod*/
 /* Generated */                        params->optIn[1].data.optInReal /* optInNbDev*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_STDDEV_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_STDDEV(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                (const TA_Real *)in[0], /* inReal */
+/* Generated */                params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                params->optIn[1].data.optInReal, /* optInNbDev*/
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_STOCH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3088,6 +5778,30 @@
 /* Generated */                       params->optIn[3].data.optInInteger, /* optInSlowD_Period*/
 /* Generated */                       (TA_MAType)params->optIn[4].data.optInInteger /* optInSlowD_MAType*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_STOCH_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_STOCH(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               (const TA_Real *)in[0], /* inHigh */
+/* Generated */               (const TA_Real *)in[1], /* inLow */
+/* Generated */               (const TA_Real *)in[2], /* inClose */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInFastK_Period*/
+/* Generated */               params->optIn[1].data.optInInteger, /* optInSlowK_Period*/
+/* Generated */               (TA_MAType)params->optIn[2].data.optInInteger, /* optInSlowK_MAType*/
+/* Generated */               params->optIn[3].data.optInInteger, /* optInSlowD_Period*/
+/* Generated */               (TA_MAType)params->optIn[4].data.optInInteger, /* optInSlowD_MAType*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               (TA_Real *)out[0], /*  outSlowK */
+/* Generated */               (TA_Real *)out[1] /*  outSlowD */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_STOCHF_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3114,6 +5828,28 @@
 /* Generated */                        params->optIn[1].data.optInInteger, /* optInFastD_Period*/
 /* Generated */                        (TA_MAType)params->optIn[2].data.optInInteger /* optInFastD_MAType*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_STOCHF_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_STOCHF(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                (const TA_Real *)in[0], /* inHigh */
+/* Generated */                (const TA_Real *)in[1], /* inLow */
+/* Generated */                (const TA_Real *)in[2], /* inClose */
+/* Generated */                params->optIn[0].data.optInInteger, /* optInFastK_Period*/
+/* Generated */                params->optIn[1].data.optInInteger, /* optInFastD_Period*/
+/* Generated */                (TA_MAType)params->optIn[2].data.optInInteger, /* optInFastD_MAType*/
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                (TA_Real *)out[0], /*  outFastK */
+/* Generated */                (TA_Real *)out[1] /*  outFastD */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_STOCHRSI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3140,6 +5876,27 @@
 /* Generated */                          params->optIn[2].data.optInInteger, /* optInFastD_Period*/
 /* Generated */                          (TA_MAType)params->optIn[3].data.optInInteger /* optInFastD_MAType*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_STOCHRSI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_STOCHRSI(
+/* Generated */                  startIdx,
+/* Generated */                  endIdx,
+/* Generated */                  (const TA_Real *)in[0], /* inReal */
+/* Generated */                  params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                  params->optIn[1].data.optInInteger, /* optInFastK_Period*/
+/* Generated */                  params->optIn[2].data.optInInteger, /* optInFastD_Period*/
+/* Generated */                  (TA_MAType)params->optIn[3].data.optInInteger, /* optInFastD_MAType*/
+/* Generated */                  outBegIdx, 
+/* Generated */                  outNBElement, 
+/* Generated */                  (TA_Real *)out[0], /*  outFastK */
+/* Generated */                  (TA_Real *)out[1] /*  outFastD */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_SUB_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3160,6 +5917,24 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_SUB_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_SUB_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_SUB(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inReal0 */
+/* Generated */             (const TA_Real *)in[1], /* inReal1 */
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_SUM_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3179,6 +5954,23 @@
 /* Generated */ {
 /* Generated */    return TA_SUM_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_SUM_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_SUM(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inReal */
+/* Generated */             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_T3_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3200,6 +5992,24 @@
 /* Generated */    return TA_T3_Lookback(params->optIn[0].data.optInInteger, /* optInTimePeriod*/
 /* Generated */                    params->optIn[1].data.optInReal /* optInVFactor*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_T3_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_T3(
+/* Generated */            startIdx,
+/* Generated */            endIdx,
+/* Generated */            (const TA_Real *)in[0], /* inReal */
+/* Generated */            params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */            params->optIn[1].data.optInReal, /* optInVFactor*/
+/* Generated */            outBegIdx, 
+/* Generated */            outNBElement, 
+/* Generated */            (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_TAN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3219,6 +6029,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_TAN_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_TAN_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_TAN(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inReal */
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_TANH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3238,6 +6065,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_TANH_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_TANH_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_TANH(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              (const TA_Real *)in[0], /* inReal */
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_TEMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3257,6 +6101,23 @@
 /* Generated */ {
 /* Generated */    return TA_TEMA_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_TEMA_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_TEMA(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              (const TA_Real *)in[0], /* inReal */
+/* Generated */              params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_TRANGE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3278,6 +6139,25 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_TRANGE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_TRANGE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_TRANGE(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                (const TA_Real *)in[0], /* inHigh */
+/* Generated */                (const TA_Real *)in[1], /* inLow */
+/* Generated */                (const TA_Real *)in[2], /* inClose */
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_TRIMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3297,6 +6177,23 @@
 /* Generated */ {
 /* Generated */    return TA_TRIMA_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_TRIMA_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_TRIMA(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               (const TA_Real *)in[0], /* inReal */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_TRIX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3316,6 +6213,23 @@
 /* Generated */ {
 /* Generated */    return TA_TRIX_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_TRIX_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_TRIX(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              (const TA_Real *)in[0], /* inReal */
+/* Generated */              params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_TSF_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3335,6 +6249,23 @@
 /* Generated */ {
 /* Generated */    return TA_TSF_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_TSF_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_TSF(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inReal */
+/* Generated */             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_TYPPRICE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3356,6 +6287,25 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_TYPPRICE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_TYPPRICE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_TYPPRICE(
+/* Generated */                  startIdx,
+/* Generated */                  endIdx,
+/* Generated */                  (const TA_Real *)in[0], /* inHigh */
+/* Generated */                  (const TA_Real *)in[1], /* inLow */
+/* Generated */                  (const TA_Real *)in[2], /* inClose */
+/* Generated */                  outBegIdx, 
+/* Generated */                  outNBElement, 
+/* Generated */                  (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ULTOSC_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3381,6 +6331,27 @@
 /* Generated */                        params->optIn[1].data.optInInteger, /* optInTimePeriod2*/
 /* Generated */                        params->optIn[2].data.optInInteger /* optInTimePeriod3*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ULTOSC_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_ULTOSC(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                (const TA_Real *)in[0], /* inHigh */
+/* Generated */                (const TA_Real *)in[1], /* inLow */
+/* Generated */                (const TA_Real *)in[2], /* inClose */
+/* Generated */                params->optIn[0].data.optInInteger, /* optInTimePeriod1*/
+/* Generated */                params->optIn[1].data.optInInteger, /* optInTimePeriod2*/
+/* Generated */                params->optIn[2].data.optInInteger, /* optInTimePeriod3*/
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_VAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3402,6 +6373,24 @@
 /* Generated */    return TA_VAR_Lookback(params->optIn[0].data.optInInteger, /* optInTimePeriod*/
 /* Generated */                     params->optIn[1].data.optInReal /* optInNbDev*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_VAR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_VAR(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inReal */
+/* Generated */             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */             params->optIn[1].data.optInReal, /* optInNbDev*/
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_WCLPRICE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3423,6 +6412,25 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_WCLPRICE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_WCLPRICE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    (void)params;
+/* Generated */    return TA_WCLPRICE(
+/* Generated */                  startIdx,
+/* Generated */                  endIdx,
+/* Generated */                  (const TA_Real *)in[0], /* inHigh */
+/* Generated */                  (const TA_Real *)in[1], /* inLow */
+/* Generated */                  (const TA_Real *)in[2], /* inClose */
+/* Generated */                  outBegIdx, 
+/* Generated */                  outNBElement, 
+/* Generated */                  (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_WILLR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3444,6 +6452,25 @@
 /* Generated */ {
 /* Generated */    return TA_WILLR_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_WILLR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_WILLR(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               (const TA_Real *)in[0], /* inHigh */
+/* Generated */               (const TA_Real *)in[1], /* inLow */
+/* Generated */               (const TA_Real *)in[2], /* inClose */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_WMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3463,6 +6490,23 @@
 /* Generated */ {
 /* Generated */    return TA_WMA_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_WMA_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_WMA(
+/* Generated */             startIdx,
+/* Generated */             endIdx,
+/* Generated */             (const TA_Real *)in[0], /* inReal */
+/* Generated */             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */             outBegIdx, 
+/* Generated */             outNBElement, 
+/* Generated */             (TA_Real *)out[0] /*  outReal */ );
+/* Generated */ }
 
 /***************/
 /* End of File */
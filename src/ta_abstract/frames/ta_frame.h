@@ -59,6 +59,14 @@
 ;
 /* Generated */ unsigned int TA_ACCBANDS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ACCBANDS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ACOS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -68,6 +76,14 @@
 ;
 /* Generated */ unsigned int TA_ACOS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ACOS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_AD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -77,6 +93,14 @@
 ;
 /* Generated */ unsigned int TA_AD_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_AD_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ADD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -86,6 +110,14 @@
 ;
 /* Generated */ unsigned int TA_ADD_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ADD_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ADOSC_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -95,6 +127,14 @@
 ;
 /* Generated */ unsigned int TA_ADOSC_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ADOSC_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ADX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -104,6 +144,14 @@
 ;
 /* Generated */ unsigned int TA_ADX_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ADX_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ADXR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -113,6 +161,14 @@
 ;
 /* Generated */ unsigned int TA_ADXR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ADXR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_APO_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -122,6 +178,14 @@
 ;
 /* Generated */ unsigned int TA_APO_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_APO_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_AROON_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -131,6 +195,14 @@
 ;
 /* Generated */ unsigned int TA_AROON_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_AROON_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_AROONOSC_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -140,6 +212,14 @@
 ;
 /* Generated */ unsigned int TA_AROONOSC_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_AROONOSC_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ASIN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -149,6 +229,14 @@
 ;
 /* Generated */ unsigned int TA_ASIN_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ASIN_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ATAN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -158,6 +246,14 @@
 ;
 /* Generated */ unsigned int TA_ATAN_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ATAN_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ATR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -167,6 +263,14 @@
 ;
 /* Generated */ unsigned int TA_ATR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ATR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_AVGPRICE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -176,6 +280,14 @@
 ;
 /* Generated */ unsigned int TA_AVGPRICE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_AVGPRICE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_AVGDEV_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -185,6 +297,14 @@
 ;
 /* Generated */ unsigned int TA_AVGDEV_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_AVGDEV_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_BBANDS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -194,6 +314,14 @@
 ;
 /* Generated */ unsigned int TA_BBANDS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_BBANDS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_BETA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -203,6 +331,14 @@
 ;
 /* Generated */ unsigned int TA_BETA_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_BETA_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_BOP_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -212,6 +348,14 @@
 ;
 /* Generated */ unsigned int TA_BOP_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_BOP_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CCI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -221,6 +365,14 @@
 ;
 /* Generated */ unsigned int TA_CCI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CCI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDL2CROWS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -230,6 +382,14 @@
 ;
 /* Generated */ unsigned int TA_CDL2CROWS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDL2CROWS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDL3BLACKCROWS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -239,6 +399,14 @@
 ;
 /* Generated */ unsigned int TA_CDL3BLACKCROWS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDL3BLACKCROWS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDL3INSIDE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -248,6 +416,14 @@
 ;
 /* Generated */ unsigned int TA_CDL3INSIDE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDL3INSIDE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDL3LINESTRIKE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -257,6 +433,14 @@
 ;
 /* Generated */ unsigned int TA_CDL3LINESTRIKE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDL3LINESTRIKE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDL3OUTSIDE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -266,6 +450,14 @@
 ;
 /* Generated */ unsigned int TA_CDL3OUTSIDE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDL3OUTSIDE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDL3STARSINSOUTH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -275,6 +467,14 @@
 ;
 /* Generated */ unsigned int TA_CDL3STARSINSOUTH_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDL3STARSINSOUTH_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDL3WHITESOLDIERS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -284,6 +484,14 @@
 ;
 /* Generated */ unsigned int TA_CDL3WHITESOLDIERS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDL3WHITESOLDIERS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLABANDONEDBABY_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -293,6 +501,14 @@
 ;
 /* Generated */ unsigned int TA_CDLABANDONEDBABY_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLABANDONEDBABY_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLADVANCEBLOCK_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -302,6 +518,14 @@
 ;
 /* Generated */ unsigned int TA_CDLADVANCEBLOCK_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLADVANCEBLOCK_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLBELTHOLD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -311,6 +535,14 @@
 ;
 /* Generated */ unsigned int TA_CDLBELTHOLD_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLBELTHOLD_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLBREAKAWAY_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -320,6 +552,14 @@
 ;
 /* Generated */ unsigned int TA_CDLBREAKAWAY_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLBREAKAWAY_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLCLOSINGMARUBOZU_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -329,6 +569,14 @@
 ;
 /* Generated */ unsigned int TA_CDLCLOSINGMARUBOZU_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLCLOSINGMARUBOZU_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLCONCEALBABYSWALL_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -338,6 +586,14 @@
 ;
 /* Generated */ unsigned int TA_CDLCONCEALBABYSWALL_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLCONCEALBABYSWALL_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLCOUNTERATTACK_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -347,6 +603,14 @@
 ;
 /* Generated */ unsigned int TA_CDLCOUNTERATTACK_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLCOUNTERATTACK_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLDARKCLOUDCOVER_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -356,6 +620,14 @@
 ;
 /* Generated */ unsigned int TA_CDLDARKCLOUDCOVER_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLDARKCLOUDCOVER_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLDOJI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -365,6 +637,14 @@
 ;
 /* Generated */ unsigned int TA_CDLDOJI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLDOJI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLDOJISTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -374,6 +654,14 @@
 ;
 /* Generated */ unsigned int TA_CDLDOJISTAR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLDOJISTAR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLDRAGONFLYDOJI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -383,6 +671,14 @@
 ;
 /* Generated */ unsigned int TA_CDLDRAGONFLYDOJI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLDRAGONFLYDOJI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLENGULFING_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -392,6 +688,14 @@
 ;
 /* Generated */ unsigned int TA_CDLENGULFING_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLENGULFING_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLEVENINGDOJISTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -401,6 +705,14 @@
 ;
 /* Generated */ unsigned int TA_CDLEVENINGDOJISTAR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLEVENINGDOJISTAR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLEVENINGSTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -410,6 +722,14 @@
 ;
 /* Generated */ unsigned int TA_CDLEVENINGSTAR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLEVENINGSTAR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLGAPSIDESIDEWHITE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -419,6 +739,14 @@
 ;
 /* Generated */ unsigned int TA_CDLGAPSIDESIDEWHITE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLGAPSIDESIDEWHITE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLGRAVESTONEDOJI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -428,6 +756,14 @@
 ;
 /* Generated */ unsigned int TA_CDLGRAVESTONEDOJI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLGRAVESTONEDOJI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLHAMMER_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -437,6 +773,14 @@
 ;
 /* Generated */ unsigned int TA_CDLHAMMER_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLHAMMER_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLHANGINGMAN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -446,6 +790,14 @@
 ;
 /* Generated */ unsigned int TA_CDLHANGINGMAN_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLHANGINGMAN_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLHARAMI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -455,6 +807,14 @@
 ;
 /* Generated */ unsigned int TA_CDLHARAMI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLHARAMI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLHARAMICROSS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -464,6 +824,14 @@
 ;
 /* Generated */ unsigned int TA_CDLHARAMICROSS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLHARAMICROSS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLHIGHWAVE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -473,6 +841,14 @@
 ;
 /* Generated */ unsigned int TA_CDLHIGHWAVE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLHIGHWAVE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLHIKKAKE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -482,6 +858,14 @@
 ;
 /* Generated */ unsigned int TA_CDLHIKKAKE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLHIKKAKE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLHIKKAKEMOD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -491,6 +875,14 @@
 ;
 /* Generated */ unsigned int TA_CDLHIKKAKEMOD_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLHIKKAKEMOD_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLHOMINGPIGEON_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -500,6 +892,14 @@
 ;
 /* Generated */ unsigned int TA_CDLHOMINGPIGEON_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLHOMINGPIGEON_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLIDENTICAL3CROWS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -509,17 +909,33 @@
 ;
 /* Generated */ unsigned int TA_CDLIDENTICAL3CROWS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
-
-/* Generated */ TA_RetCode TA_CDLINNECK_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */ TA_RetCode TA_CDLIDENTICAL3CROWS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
 /* Generated */                           int           *outBegIdx,
 /* Generated */                           int           *outNBElement )
 ;
-/* Generated */ unsigned int TA_CDLINNECK_FramePPLB( const TA_ParamHolderPriv *params )
-;
 
-/* Generated */ TA_RetCode TA_CDLINVERTEDHAMMER_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */ TA_RetCode TA_CDLINNECK_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
+/* Generated */ unsigned int TA_CDLINNECK_FramePPLB( const TA_ParamHolderPriv *params )
+;
+/* Generated */ TA_RetCode TA_CDLINNECK_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
+
+/* Generated */ TA_RetCode TA_CDLINVERTEDHAMMER_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
 /* Generated */                           int           *outBegIdx,
@@ -527,6 +943,14 @@
 ;
 /* Generated */ unsigned int TA_CDLINVERTEDHAMMER_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLINVERTEDHAMMER_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLKICKING_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -536,6 +960,14 @@
 ;
 /* Generated */ unsigned int TA_CDLKICKING_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLKICKING_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLKICKINGBYLENGTH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -545,6 +977,14 @@
 ;
 /* Generated */ unsigned int TA_CDLKICKINGBYLENGTH_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLKICKINGBYLENGTH_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLLADDERBOTTOM_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -554,6 +994,14 @@
 ;
 /* Generated */ unsigned int TA_CDLLADDERBOTTOM_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLLADDERBOTTOM_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLLONGLEGGEDDOJI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -563,6 +1011,14 @@
 ;
 /* Generated */ unsigned int TA_CDLLONGLEGGEDDOJI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLLONGLEGGEDDOJI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLLONGLINE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -572,6 +1028,14 @@
 ;
 /* Generated */ unsigned int TA_CDLLONGLINE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLLONGLINE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLMARUBOZU_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -581,6 +1045,14 @@
 ;
 /* Generated */ unsigned int TA_CDLMARUBOZU_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLMARUBOZU_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLMATCHINGLOW_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -590,6 +1062,14 @@
 ;
 /* Generated */ unsigned int TA_CDLMATCHINGLOW_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLMATCHINGLOW_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLMATHOLD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -599,6 +1079,14 @@
 ;
 /* Generated */ unsigned int TA_CDLMATHOLD_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLMATHOLD_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLMORNINGDOJISTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -608,6 +1096,14 @@
 ;
 /* Generated */ unsigned int TA_CDLMORNINGDOJISTAR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLMORNINGDOJISTAR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLMORNINGSTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -617,6 +1113,14 @@
 ;
 /* Generated */ unsigned int TA_CDLMORNINGSTAR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLMORNINGSTAR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLONNECK_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -626,6 +1130,14 @@
 ;
 /* Generated */ unsigned int TA_CDLONNECK_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLONNECK_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLPIERCING_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -635,6 +1147,14 @@
 ;
 /* Generated */ unsigned int TA_CDLPIERCING_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLPIERCING_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLRICKSHAWMAN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -644,6 +1164,14 @@
 ;
 /* Generated */ unsigned int TA_CDLRICKSHAWMAN_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLRICKSHAWMAN_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLRISEFALL3METHODS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -653,6 +1181,14 @@
 ;
 /* Generated */ unsigned int TA_CDLRISEFALL3METHODS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLRISEFALL3METHODS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLSEPARATINGLINES_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -662,6 +1198,14 @@
 ;
 /* Generated */ unsigned int TA_CDLSEPARATINGLINES_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLSEPARATINGLINES_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLSHOOTINGSTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -671,6 +1215,14 @@
 ;
 /* Generated */ unsigned int TA_CDLSHOOTINGSTAR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLSHOOTINGSTAR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLSHORTLINE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -680,6 +1232,14 @@
 ;
 /* Generated */ unsigned int TA_CDLSHORTLINE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLSHORTLINE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLSPINNINGTOP_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -689,6 +1249,14 @@
 ;
 /* Generated */ unsigned int TA_CDLSPINNINGTOP_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLSPINNINGTOP_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLSTALLEDPATTERN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -698,6 +1266,14 @@
 ;
 /* Generated */ unsigned int TA_CDLSTALLEDPATTERN_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLSTALLEDPATTERN_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLSTICKSANDWICH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -707,6 +1283,14 @@
 ;
 /* Generated */ unsigned int TA_CDLSTICKSANDWICH_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLSTICKSANDWICH_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLTAKURI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -716,6 +1300,14 @@
 ;
 /* Generated */ unsigned int TA_CDLTAKURI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLTAKURI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLTASUKIGAP_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -725,6 +1317,14 @@
 ;
 /* Generated */ unsigned int TA_CDLTASUKIGAP_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLTASUKIGAP_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLTHRUSTING_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -734,6 +1334,14 @@
 ;
 /* Generated */ unsigned int TA_CDLTHRUSTING_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLTHRUSTING_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLTRISTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -743,6 +1351,14 @@
 ;
 /* Generated */ unsigned int TA_CDLTRISTAR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLTRISTAR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLUNIQUE3RIVER_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -752,6 +1368,14 @@
 ;
 /* Generated */ unsigned int TA_CDLUNIQUE3RIVER_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLUNIQUE3RIVER_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLUPSIDEGAP2CROWS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -761,6 +1385,14 @@
 ;
 /* Generated */ unsigned int TA_CDLUPSIDEGAP2CROWS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLUPSIDEGAP2CROWS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLXSIDEGAP3METHODS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -770,6 +1402,14 @@
 ;
 /* Generated */ unsigned int TA_CDLXSIDEGAP3METHODS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLXSIDEGAP3METHODS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CEIL_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -779,6 +1419,14 @@
 ;
 /* Generated */ unsigned int TA_CEIL_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CEIL_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CMO_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -788,6 +1436,14 @@
 ;
 /* Generated */ unsigned int TA_CMO_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CMO_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CORREL_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -797,6 +1453,14 @@
 ;
 /* Generated */ unsigned int TA_CORREL_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CORREL_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_COS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -806,6 +1470,14 @@
 ;
 /* Generated */ unsigned int TA_COS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_COS_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_COSH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -815,6 +1487,14 @@
 ;
 /* Generated */ unsigned int TA_COSH_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_COSH_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_DEMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -824,6 +1504,14 @@
 ;
 /* Generated */ unsigned int TA_DEMA_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_DEMA_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_DIV_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -833,6 +1521,14 @@
 ;
 /* Generated */ unsigned int TA_DIV_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_DIV_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_DX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -842,6 +1538,14 @@
 ;
 /* Generated */ unsigned int TA_DX_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_DX_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_EMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -851,6 +1555,14 @@
 ;
 /* Generated */ unsigned int TA_EMA_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_EMA_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_EXP_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -860,6 +1572,14 @@
 ;
 /* Generated */ unsigned int TA_EXP_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_EXP_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_FLOOR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -869,6 +1589,14 @@
 ;
 /* Generated */ unsigned int TA_FLOOR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_FLOOR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_HT_DCPERIOD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -878,6 +1606,14 @@
 ;
 /* Generated */ unsigned int TA_HT_DCPERIOD_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_HT_DCPERIOD_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_HT_DCPHASE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -887,6 +1623,14 @@
 ;
 /* Generated */ unsigned int TA_HT_DCPHASE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_HT_DCPHASE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_HT_PHASOR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -896,6 +1640,14 @@
 ;
 /* Generated */ unsigned int TA_HT_PHASOR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_HT_PHASOR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_HT_SINE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -905,6 +1657,14 @@
 ;
 /* Generated */ unsigned int TA_HT_SINE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_HT_SINE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_HT_TRENDLINE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -914,6 +1674,14 @@
 ;
 /* Generated */ unsigned int TA_HT_TRENDLINE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_HT_TRENDLINE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_HT_TRENDMODE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -923,6 +1691,14 @@
 ;
 /* Generated */ unsigned int TA_HT_TRENDMODE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_HT_TRENDMODE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_IMI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -932,6 +1708,14 @@
 ;
 /* Generated */ unsigned int TA_IMI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_IMI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_KAMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -941,6 +1725,14 @@
 ;
 /* Generated */ unsigned int TA_KAMA_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_KAMA_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_LINEARREG_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -950,6 +1742,14 @@
 ;
 /* Generated */ unsigned int TA_LINEARREG_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_LINEARREG_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_LINEARREG_ANGLE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -959,6 +1759,14 @@
 ;
 /* Generated */ unsigned int TA_LINEARREG_ANGLE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_LINEARREG_ANGLE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_LINEARREG_INTERCEPT_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -968,6 +1776,14 @@
 ;
 /* Generated */ unsigned int TA_LINEARREG_INTERCEPT_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_LINEARREG_INTERCEPT_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_LINEARREG_SLOPE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -977,6 +1793,14 @@
 ;
 /* Generated */ unsigned int TA_LINEARREG_SLOPE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_LINEARREG_SLOPE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_LN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -986,6 +1810,14 @@
 ;
 /* Generated */ unsigned int TA_LN_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_LN_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_LOG10_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -995,6 +1827,14 @@
 ;
 /* Generated */ unsigned int TA_LOG10_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_LOG10_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1004,6 +1844,14 @@
 ;
 /* Generated */ unsigned int TA_MA_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MA_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MACD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1013,6 +1861,14 @@
 ;
 /* Generated */ unsigned int TA_MACD_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MACD_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MACDEXT_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1022,6 +1878,14 @@
 ;
 /* Generated */ unsigned int TA_MACDEXT_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MACDEXT_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MACDFIX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1031,6 +1895,14 @@
 ;
 /* Generated */ unsigned int TA_MACDFIX_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MACDFIX_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MAMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1038,17 +1910,33 @@
 /* Generated */                           int           *outBegIdx,
 /* Generated */                           int           *outNBElement )
 ;
-/* Generated */ unsigned int TA_MAMA_FramePPLB( const TA_ParamHolderPriv *params )
+/* Generated */ unsigned int TA_MAMA_FramePPLB( const TA_ParamHolderPriv *params )
+;
+/* Generated */ TA_RetCode TA_MAMA_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
+
+/* Generated */ TA_RetCode TA_MAVP_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
+/* Generated */ unsigned int TA_MAVP_FramePPLB( const TA_ParamHolderPriv *params )
 ;
-
-/* Generated */ TA_RetCode TA_MAVP_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */ TA_RetCode TA_MAVP_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
 /* Generated */                           int           *outBegIdx,
 /* Generated */                           int           *outNBElement )
 ;
-/* Generated */ unsigned int TA_MAVP_FramePPLB( const TA_ParamHolderPriv *params )
-;
 
 /* Generated */ TA_RetCode TA_MAX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1058,6 +1946,14 @@
 ;
 /* Generated */ unsigned int TA_MAX_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MAX_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MAXINDEX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1067,6 +1963,14 @@
 ;
 /* Generated */ unsigned int TA_MAXINDEX_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MAXINDEX_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MEDPRICE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1076,6 +1980,14 @@
 ;
 /* Generated */ unsigned int TA_MEDPRICE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MEDPRICE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MFI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1085,6 +1997,14 @@
 ;
 /* Generated */ unsigned int TA_MFI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MFI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MIDPOINT_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1094,6 +2014,14 @@
 ;
 /* Generated */ unsigned int TA_MIDPOINT_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MIDPOINT_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MIDPRICE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1103,6 +2031,14 @@
 ;
 /* Generated */ unsigned int TA_MIDPRICE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MIDPRICE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MIN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1112,6 +2048,14 @@
 ;
 /* Generated */ unsigned int TA_MIN_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MIN_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MININDEX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1121,6 +2065,14 @@
 ;
 /* Generated */ unsigned int TA_MININDEX_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MININDEX_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MINMAX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1130,6 +2082,14 @@
 ;
 /* Generated */ unsigned int TA_MINMAX_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MINMAX_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MINMAXINDEX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1139,6 +2099,14 @@
 ;
 /* Generated */ unsigned int TA_MINMAXINDEX_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MINMAXINDEX_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MINUS_DI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1148,6 +2116,14 @@
 ;
 /* Generated */ unsigned int TA_MINUS_DI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MINUS_DI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MINUS_DM_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1157,6 +2133,14 @@
 ;
 /* Generated */ unsigned int TA_MINUS_DM_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MINUS_DM_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MOM_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1166,6 +2150,14 @@
 ;
 /* Generated */ unsigned int TA_MOM_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MOM_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MULT_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1175,6 +2167,14 @@
 ;
 /* Generated */ unsigned int TA_MULT_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MULT_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_NATR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1184,6 +2184,14 @@
 ;
 /* Generated */ unsigned int TA_NATR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_NATR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_OBV_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1193,6 +2201,14 @@
 ;
 /* Generated */ unsigned int TA_OBV_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_OBV_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_PLUS_DI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1202,6 +2218,14 @@
 ;
 /* Generated */ unsigned int TA_PLUS_DI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_PLUS_DI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_PLUS_DM_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1211,6 +2235,14 @@
 ;
 /* Generated */ unsigned int TA_PLUS_DM_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_PLUS_DM_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_PPO_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1220,6 +2252,14 @@
 ;
 /* Generated */ unsigned int TA_PPO_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_PPO_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ROC_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1229,6 +2269,14 @@
 ;
 /* Generated */ unsigned int TA_ROC_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ROC_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ROCP_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1238,6 +2286,14 @@
 ;
 /* Generated */ unsigned int TA_ROCP_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ROCP_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ROCR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1247,6 +2303,14 @@
 ;
 /* Generated */ unsigned int TA_ROCR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ROCR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ROCR100_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1256,6 +2320,14 @@
 ;
 /* Generated */ unsigned int TA_ROCR100_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ROCR100_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_RSI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1265,6 +2337,14 @@
 ;
 /* Generated */ unsigned int TA_RSI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_RSI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_SAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1274,6 +2354,14 @@
 ;
 /* Generated */ unsigned int TA_SAR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_SAR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_SAREXT_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1283,6 +2371,14 @@
 ;
 /* Generated */ unsigned int TA_SAREXT_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_SAREXT_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_SIN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1292,6 +2388,14 @@
 ;
 /* Generated */ unsigned int TA_SIN_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_SIN_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_SINH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1301,6 +2405,14 @@
 ;
 /* Generated */ unsigned int TA_SINH_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_SINH_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_SMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1310,6 +2422,14 @@
 ;
 /* Generated */ unsigned int TA_SMA_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_SMA_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_SQRT_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1319,6 +2439,14 @@
 ;
 /* Generated */ unsigned int TA_SQRT_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_SQRT_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_STDDEV_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1328,6 +2456,14 @@
 ;
 /* Generated */ unsigned int TA_STDDEV_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_STDDEV_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_STOCH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1337,6 +2473,14 @@
 ;
 /* Generated */ unsigned int TA_STOCH_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_STOCH_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_STOCHF_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1346,6 +2490,14 @@
 ;
 /* Generated */ unsigned int TA_STOCHF_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_STOCHF_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_STOCHRSI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1355,6 +2507,14 @@
 ;
 /* Generated */ unsigned int TA_STOCHRSI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_STOCHRSI_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_SUB_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1364,6 +2524,14 @@
 ;
 /* Generated */ unsigned int TA_SUB_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_SUB_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_SUM_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1373,6 +2541,14 @@
 ;
 /* Generated */ unsigned int TA_SUM_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_SUM_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_T3_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1382,6 +2558,14 @@
 ;
 /* Generated */ unsigned int TA_T3_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_T3_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_TAN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1391,6 +2575,14 @@
 ;
 /* Generated */ unsigned int TA_TAN_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_TAN_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_TANH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1400,6 +2592,14 @@
 ;
 /* Generated */ unsigned int TA_TANH_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_TANH_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_TEMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1409,6 +2609,14 @@
 ;
 /* Generated */ unsigned int TA_TEMA_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_TEMA_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_TRANGE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1418,6 +2626,14 @@
 ;
 /* Generated */ unsigned int TA_TRANGE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_TRANGE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_TRIMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1427,6 +2643,14 @@
 ;
 /* Generated */ unsigned int TA_TRIMA_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_TRIMA_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_TRIX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1436,6 +2660,14 @@
 ;
 /* Generated */ unsigned int TA_TRIX_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_TRIX_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_TSF_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1445,6 +2677,14 @@
 ;
 /* Generated */ unsigned int TA_TSF_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_TSF_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_TYPPRICE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1454,6 +2694,14 @@
 ;
 /* Generated */ unsigned int TA_TYPPRICE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_TYPPRICE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ULTOSC_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1463,6 +2711,14 @@
 ;
 /* Generated */ unsigned int TA_ULTOSC_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ULTOSC_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_VAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1472,6 +2728,14 @@
 ;
 /* Generated */ unsigned int TA_VAR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_VAR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_WCLPRICE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1481,6 +2745,14 @@
 ;
 /* Generated */ unsigned int TA_WCLPRICE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_WCLPRICE_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_WILLR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1490,6 +2762,14 @@
 ;
 /* Generated */ unsigned int TA_WILLR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_WILLR_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_WMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1499,6 +2779,14 @@
 ;
 /* Generated */ unsigned int TA_WMA_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_WMA_FramePPDirect( const TA_ParamHolderPriv *params,
+/* Generated */                           const void * const *in,
+/* Generated */                           void * const       *out,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 
 #endif
@@ -62,9 +62,11 @@
 #include <ctype.h>
 #include "ta_common.h"
 #include "ta_memory.h"
+#include "ta_global.h"
 #include "ta_abstract.h"
 #include "ta_def_ui.h"
 #include "ta_frame_priv.h"
+#include "ta_func_stats.h"
 
 #include <limits.h>
 
@@ -109,6 +111,14 @@ extern const unsigned int TA_DEF_TableASize, TA_DEF_TableBSize,
     */
    extern const TA_FuncDef **TA_PerGroupFuncDef[];
    extern const unsigned int TA_PerGroupSize[];
+
+   /* The functions by id, and the perfect hash of their name. */
+   extern const TA_FuncDef *TA_FuncDefById[];
+   extern const unsigned int TA_FuncIdMax;
+   extern const unsigned int TA_FuncHashNbBucket;
+   extern const unsigned int TA_FuncHashNbSlot;
+   extern const unsigned short TA_FuncHashSeed[];
+   extern const unsigned short TA_FuncHashId[];
 #endif
 
 /**** Global variables definitions.    ****/
@@ -140,6 +150,7 @@ typedef struct
    static TA_RetCode getFuncNameByIdx( TA_GroupId groupId,
                                        unsigned int idx,
                                        const char **stringPtr );
+   static unsigned int findFuncId( const char *name );
 #endif
 
 /**** Local variables definitions.     ****/
@@ -371,15 +382,17 @@ TA_RetCode TA_FuncTableFree( TA_StringTable *table )
 
 TA_RetCode TA_GetFuncHandle( const char *name, const TA_FuncHandle **handle )
 {
-   char firstChar, tmp;
+#ifndef TA_GEN_CODE
+   unsigned int id;
+#else
+   char tmp;
    const TA_FuncDef **funcDefTable;
    const TA_FuncDef *funcDef;
    const TA_FuncInfo *funcInfo;
    unsigned int i, funcDefTableSize;
+#endif
 
-   /* A TA_FuncHandle is internally a TA_FuncDef. Let's find it
-    * by using the alphabetical tables.
-    */
+   /* A TA_FuncHandle is internally a TA_FuncDef. */
    if( (name == NULL) || (handle == NULL) )
    {
       return TA_BAD_PARAM;
@@ -387,14 +400,24 @@ TA_RetCode TA_GetFuncHandle( const char *name, const TA_FuncHandle **handle )
 
    *handle = NULL;
 
-   firstChar = name[0];
-
-   if( firstChar == '\0' )
+   if( name[0] == '\0' )
    {
       return TA_BAD_PARAM;
    }
 
-   tmp = (char)tolower( firstChar );
+#ifndef TA_GEN_CODE
+   /* Use the perfect hash of the names. */
+   id = findFuncId( name );
+   if( id == 0 )
+   {
+      return TA_FUNC_NOT_FOUND;
+   }
+
+   *handle = (TA_FuncHandle *)TA_FuncDefById[id];
+   return TA_SUCCESS;
+#else
+   /* In gen_code, use the alphabetical tables. */
+   tmp = (char)tolower( name[0] );
 
    if( (tmp < 'a') || (tmp > 'z') )
    {
@@ -431,6 +454,93 @@ TA_RetCode TA_GetFuncHandle( const char *name, const TA_FuncHandle **handle )
    }
 
    return TA_FUNC_NOT_FOUND;
+#endif
+}
+
+TA_RetCode TA_GetFuncId( const TA_FuncHandle *handle, unsigned int *id )
+{
+   const TA_FuncDef *funcDef;
+
+   if( !handle || !id )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   *id = 0;
+
+   funcDef = (const TA_FuncDef *)handle;
+   if( (funcDef->magicNumber != TA_FUNC_DEF_MAGIC_NB) || !funcDef->funcInfo )
+   {
+      return TA_INVALID_HANDLE;
+   }
+
+#ifndef TA_GEN_CODE
+   *id = findFuncId( funcDef->funcInfo->name );
+   if( (*id == 0) || (TA_FuncDefById[*id] != funcDef) )
+   {
+      *id = 0;
+      return TA_INVALID_HANDLE;
+   }
+
+   return TA_SUCCESS;
+#else
+   return TA_NOT_SUPPORTED;
+#endif
+}
+
+TA_RetCode TA_GetFuncHandleById( unsigned int id, const TA_FuncHandle **handle )
+{
+   if( !handle )
+   {
+      return TA_BAD_PARAM;
+   }
+
+#ifndef TA_GEN_CODE
+   if( (id == 0) || (id > TA_FuncIdMax) || !TA_FuncDefById[id] )
+   {
+      *handle = NULL;
+      return TA_FUNC_NOT_FOUND;
+   }
+
+   *handle = (TA_FuncHandle *)TA_FuncDefById[id];
+   return TA_SUCCESS;
+#else
+   (void)id;
+   *handle = NULL;
+   return TA_NOT_SUPPORTED;
+#endif
+}
+
+unsigned int TA_GetFuncIdMax( void )
+{
+#ifndef TA_GEN_CODE
+   return TA_FuncIdMax;
+#else
+   return 0;
+#endif
+}
+
+/* FNV-1a, with the bits mixed at the end so that each
+ * seed gives a different distribution of the names.
+ */
+unsigned int TA_INT_FuncNameHash( const char *name, unsigned int seed )
+{
+   unsigned int hash;
+
+   hash = 2166136261U^(seed*0x9E3779B9U);
+   while( *name )
+   {
+      hash ^= (unsigned char)*name++;
+      hash *= 16777619U;
+   }
+
+   hash ^= hash >> 16;
+   hash *= 0x85EBCA6BU;
+   hash ^= hash >> 13;
+   hash *= 0xC2B2AE35U;
+   hash ^= hash >> 16;
+
+   return hash;
 }
 
 TA_RetCode TA_GetFuncInfo(  const TA_FuncHandle *handle,
@@ -1156,6 +1266,7 @@ TA_RetCode TA_CallFunc( const TA_ParamHolder *param,
    const TA_FuncDef *funcDef;
    const TA_FuncInfo *funcInfo;
    TA_FrameFunction function;
+   TA_FUNC_STATS_DECL
 
    if( (param == NULL) ||
        (outBegIdx == NULL) ||
@@ -1190,12 +1301,61 @@ TA_RetCode TA_CallFunc( const TA_ParamHolder *param,
    if( !function ) return TA_INTERNAL_ERROR(2);
 
    /* Perform the function call. */
+   TA_FUNC_STATS_BEGIN
    retCode = (*function)( paramHolderPriv, startIdx, endIdx,
                           outBegIdx, outNbElement );
+   TA_FUNC_STATS_END( funcDef, startIdx, endIdx )
+   return retCode;
+}
+
+TA_RetCode TA_CallFuncContext( const TA_Context     *context,
+                               const TA_ParamHolder *param,
+                               TA_Integer            startIdx,
+                               TA_Integer            endIdx,
+                               TA_Integer           *outBegIdx,
+                               TA_Integer           *outNbElement )
+{
+   TA_RetCode retCode;
+   const TA_Context *prevContext;
+
+   if( !context )
+      return TA_BAD_PARAM;
+
+   prevContext = TA_ThreadContext;
+
+   retCode = TA_SetThreadContext( context );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   retCode = TA_CallFunc( param, startIdx, endIdx, outBegIdx, outNbElement );
+
+   TA_ThreadContext = prevContext;
+
    return retCode;
 }
 
 /**** Local functions definitions.     ****/
+#ifndef TA_GEN_CODE
+/* Return 0 when the name is not a function. */
+static unsigned int findFuncId( const char *name )
+{
+   const TA_FuncDef *funcDef;
+   unsigned int bucket, id;
+
+   bucket = TA_INT_FuncNameHash( name, 0 )&(TA_FuncHashNbBucket-1);
+   id = TA_FuncHashId[TA_INT_FuncNameHash( name, TA_FuncHashSeed[bucket] )&(TA_FuncHashNbSlot-1)];
+   if( id == 0 )
+      return 0;
+
+   /* The slot of another name, or of nothing. */
+   funcDef = TA_FuncDefById[id];
+   if( !funcDef || !funcDef->funcInfo || (strcmp( funcDef->funcInfo->name, name ) != 0) )
+      return 0;
+
+   return id;
+}
+#endif
+
 static TA_RetCode getGroupId( const char *groupString, unsigned int *groupId )
 {
    unsigned int i;
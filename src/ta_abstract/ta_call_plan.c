@@ -0,0 +1,318 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ */
+
+/* Description:
+ *   Call plans (see TA_CallPlanAlloc).
+ *
+ *   A plan holds its own copy of the optional inputs, already
+ *   checked, with the direct frame of the TA function (see
+ *   TA_FrameDirect). The direct frame calls the TA function with the
+ *   pointers of the inputs and outputs as given, so running a plan is
+ *   only this call.
+ *
+ *   A plan is never modified once allocated. TA_CallPlanRunWith only
+ *   passes other pointers, so the same plan can be run by many threads
+ *   at the same time.
+ */
+
+/**** Headers ****/
+#include <stddef.h>
+#include <string.h>
+
+#include "ta_common.h"
+#include "ta_memory.h"
+#include "ta_global.h"
+#include "ta_abstract.h"
+#include "ta_magic_nb.h"
+#include "ta_def_ui.h"
+#include "ta_frame_priv.h"
+#include "ta_func_stats.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+
+/* Largest number of parameters of the TA functions. */
+#define TA_CALL_PLAN_MAX_INPUT     3
+#define TA_CALL_PLAN_MAX_OPT_INPUT 12
+#define TA_CALL_PLAN_MAX_OUTPUT    3
+
+/* A price input is up to 6 pointers (open, high,
+ * low, close, volume and open interest).
+ */
+#define TA_CALL_PLAN_MAX_INPUT_PTR (TA_CALL_PLAN_MAX_INPUT*6)
+
+struct TA_CallPlan
+{
+   unsigned int magicNb;
+
+   const TA_FuncDef *funcDef;
+   TA_FrameDirect function;
+
+   /* Only the optional inputs of params are used,
+    * they point on optIn.
+    */
+   TA_ParamHolderPriv params;
+   TA_ParamHolderOptInput optIn[TA_CALL_PLAN_MAX_OPT_INPUT];
+
+   /* Inputs and outputs of the TA_ParamHolder, in
+    * the order of TA_BatchSymbol (for TA_CallPlanRun).
+    */
+   const void *in[TA_CALL_PLAN_MAX_INPUT_PTR];
+   void *out[TA_CALL_PLAN_MAX_OUTPUT];
+};
+
+/**** Local functions declarations.    ****/
+static void getParamPtrs( const TA_ParamHolderPriv *params,
+                          const void **inPtr,
+                          void **outPtr );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_CallPlanAlloc( const TA_ParamHolder *params, TA_CallPlan **plan )
+{
+   const TA_ParamHolderPriv *paramHolderPriv;
+   const TA_FuncInfo *funcInfo;
+   const TA_FuncDef *funcDef;
+   TA_CallPlan *newPlan;
+
+   if( !plan )
+      return TA_BAD_PARAM;
+
+   *plan = NULL;
+
+   if( !params )
+      return TA_BAD_PARAM;
+
+   /* Same checks as TA_CallFunc, done once. */
+   paramHolderPriv = (const TA_ParamHolderPriv *)(params->hiddenData);
+   if( paramHolderPriv->magicNumber != TA_PARAM_HOLDER_PRIV_MAGIC_NB )
+      return TA_INVALID_PARAM_HOLDER;
+
+   if( paramHolderPriv->inBitmap != 0 )
+      return TA_INPUT_NOT_ALL_INITIALIZE;
+
+   if( paramHolderPriv->outBitmap != 0 )
+      return TA_OUTPUT_NOT_ALL_INITIALIZE;
+
+   funcInfo = paramHolderPriv->funcInfo;
+   if( !funcInfo ) return TA_INVALID_HANDLE;
+   funcDef = (const TA_FuncDef *)funcInfo->handle;
+   if( !funcDef ) return TA_INTERNAL_ERROR(2);
+   if( !funcDef->direct ) return TA_INTERNAL_ERROR(2);
+
+   if( (funcInfo->nbInput > TA_CALL_PLAN_MAX_INPUT) ||
+       (funcInfo->nbOptInput > TA_CALL_PLAN_MAX_OPT_INPUT) ||
+       (funcInfo->nbOutput > TA_CALL_PLAN_MAX_OUTPUT) )
+      return TA_NOT_SUPPORTED;
+
+   newPlan = (TA_CallPlan *)TA_Malloc( sizeof( TA_CallPlan ) );
+   if( !newPlan )
+      return TA_ALLOC_ERR;
+
+   memset( newPlan, 0, sizeof( TA_CallPlan ) );
+   newPlan->magicNb  = TA_CALL_PLAN_MAGIC_NB;
+   newPlan->funcDef  = funcDef;
+   newPlan->function = funcDef->direct;
+
+   if( funcInfo->nbOptInput )
+      memcpy( newPlan->optIn, paramHolderPriv->optIn,
+              sizeof( TA_ParamHolderOptInput )*funcInfo->nbOptInput );
+
+   newPlan->params = *paramHolderPriv;
+   newPlan->params.in    = NULL;
+   newPlan->params.optIn = funcInfo->nbOptInput? newPlan->optIn : NULL;
+   newPlan->params.out   = NULL;
+
+   getParamPtrs( paramHolderPriv, newPlan->in, newPlan->out );
+
+   *plan = newPlan;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_CallPlanFree( TA_CallPlan *plan )
+{
+   if( !plan )
+      return TA_SUCCESS;
+
+   if( plan->magicNb != TA_CALL_PLAN_MAGIC_NB )
+      return TA_INVALID_HANDLE;
+
+   plan->magicNb = 0;
+   TA_Free( plan );
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_CallPlanRun( const TA_CallPlan *plan,
+                           TA_Integer         startIdx,
+                           TA_Integer         endIdx,
+                           TA_Integer        *outBegIdx,
+                           TA_Integer        *outNbElement )
+{
+   TA_RetCode retCode;
+   TA_FUNC_STATS_DECL
+
+   if( !plan || !outBegIdx || !outNbElement )
+      return TA_BAD_PARAM;
+
+   if( plan->magicNb != TA_CALL_PLAN_MAGIC_NB )
+      return TA_INVALID_HANDLE;
+
+   TA_FUNC_STATS_BEGIN
+   retCode = (*plan->function)( &plan->params, plan->in, plan->out,
+                                startIdx, endIdx, outBegIdx, outNbElement );
+   TA_FUNC_STATS_END( plan->funcDef, startIdx, endIdx )
+
+   return retCode;
+}
+
+TA_RetCode TA_CallPlanRunWith( const TA_CallPlan *plan,
+                               const void * const *in,
+                               void * const       *out,
+                               TA_Integer          startIdx,
+                               TA_Integer          endIdx,
+                               TA_Integer         *outBegIdx,
+                               TA_Integer         *outNbElement )
+{
+   TA_RetCode retCode;
+   TA_FUNC_STATS_DECL
+
+   if( !plan || !out || !outBegIdx || !outNbElement )
+      return TA_BAD_PARAM;
+
+   if( plan->magicNb != TA_CALL_PLAN_MAGIC_NB )
+      return TA_INVALID_HANDLE;
+
+   if( !in && (plan->params.funcInfo->nbInput != 0) )
+      return TA_BAD_PARAM;
+
+   TA_FUNC_STATS_BEGIN
+   retCode = (*plan->function)( &plan->params, in, out,
+                                startIdx, endIdx, outBegIdx, outNbElement );
+   TA_FUNC_STATS_END( plan->funcDef, startIdx, endIdx )
+
+   return retCode;
+}
+
+TA_RetCode TA_CallPlanLookback( const TA_CallPlan *plan, TA_Integer *lookback )
+{
+   if( !plan || !lookback )
+      return TA_BAD_PARAM;
+
+   if( plan->magicNb != TA_CALL_PLAN_MAGIC_NB )
+      return TA_INVALID_HANDLE;
+
+   if( !plan->funcDef->lookback )
+      return TA_INTERNAL_ERROR(2);
+
+   /* Not kept in the plan: it depends on the settings
+    * of the calling thread (unstable period etc.).
+    */
+   *lookback = (TA_Integer)(*plan->funcDef->lookback)( &plan->params );
+
+   return TA_SUCCESS;
+}
+
+/**** Local functions definitions.     ****/
+static void getParamPtrs( const TA_ParamHolderPriv *params,
+                          const void **inPtr,
+                          void **outPtr )
+{
+   const TA_ParamHolderInput *in;
+   const TA_ParamHolderOutput *out;
+   unsigned int i;
+
+   for( i=0; i < params->funcInfo->nbInput; i++ )
+   {
+      in = &params->in[i];
+
+      switch( in->inputInfo->type )
+      {
+      case TA_Input_Price:
+         #define GET_PRICE(lowerParam,upperParam) \
+         { \
+            if( in->inputInfo->flags & TA_IN_PRICE_##upperParam ) \
+               *inPtr++ = in->data.inPrice.lowerParam; \
+         }
+         GET_PRICE( open, OPEN );
+         GET_PRICE( high, HIGH );
+         GET_PRICE( low, LOW );
+         GET_PRICE( close, CLOSE );
+         GET_PRICE( volume, VOLUME );
+         GET_PRICE( openInterest, OPENINTEREST );
+         #undef GET_PRICE
+         break;
+      case TA_Input_Integer:
+         *inPtr++ = in->data.inInteger;
+         break;
+      default:
+         *inPtr++ = in->data.inReal;
+         break;
+      }
+   }
+
+   for( i=0; i < params->funcInfo->nbOutput; i++ )
+   {
+      out = &params->out[i];
+      if( out->outputInfo->type == TA_Output_Integer )
+         outPtr[i] = out->data.outInteger;
+      else
+         outPtr[i] = out->data.outReal;
+   }
+}
@@ -169,8 +169,16 @@ typedef struct
    /* Entry point of the TA function and its lookback function. */
    const TA_FrameFunction function;
    const TA_FrameLookback lookback;
+
+   /* Entry point taking the inputs and outputs as pointers. */
+   const TA_FrameDirect   direct;
 } TA_FuncDef;
 
+/* Hash of a function name, for the perfect hash generated
+ * by gen_code (see TA_GetFuncHandle).
+ */
+unsigned int TA_INT_FuncNameHash( const char *name, unsigned int seed );
+
 /* The following MACROs are helpers being used in
  * the tables\table<a..z>.c files.
  */
@@ -193,7 +201,8 @@ typedef struct
       (const TA_OptInputParameterInfo * const)&TA_##name##_OptInputs[0], \
       (const TA_OutputParameterInfo   * const)&TA_##name##_Outputs[0],   \
       TA_##name##_FramePP, \
-      TA_##name##_FramePPLB \
+      TA_##name##_FramePPLB, \
+      TA_##name##_FramePPDirect \
    }; \
    TA_FuncInfo TA_INFO_##name = \
    { \
@@ -229,6 +238,7 @@ typedef struct
       (const TA_OptInputParameterInfo * const)&TA_##name##_OptInputs[0], \
       (const TA_OutputParameterInfo   * const)&TA_##name##_Outputs[0],   \
       NULL, \
+      NULL, \
       NULL \
    }; \
    TA_FuncInfo TA_INFO_##name = \
@@ -125,4 +125,16 @@ typedef TA_RetCode (*TA_FrameFunction)( const TA_ParamHolderPriv *params,
 
 typedef unsigned int (*TA_FrameLookback)( const TA_ParamHolderPriv *params );
 
+/* Same as TA_FrameFunction, but the inputs and outputs are taken from
+ * arrays of pointers, in the order of TA_BatchSymbol (see ta_abstract.h).
+ * Only the optional inputs are taken from 'params'.
+ */
+typedef TA_RetCode (*TA_FrameDirect)( const TA_ParamHolderPriv *params,
+                                      const void * const *in,
+                                      void * const       *out,
+                                      TA_Integer  startIdx,
+                                      TA_Integer  endIdx,
+                                      TA_Integer *outBegIdx,
+                                      TA_Integer *outNbElement );
+
 #endif
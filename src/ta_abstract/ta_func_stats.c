@@ -0,0 +1,405 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ */
+
+/* Description:
+ *   Statistics of the calls of each function (see TA_GetFuncStats).
+ *
+ *   Compiled only when TA_FUNC_STATS is defined. Otherwise the
+ *   hooks in the callers are empty and the functions below only
+ *   return TA_NOT_SUPPORTED.
+ *
+ *   Each thread counts its calls in its own block, so the threads
+ *   never share a cache line while counting. The block is allocated
+ *   at the first call counted by the thread, and given to another
+ *   thread when it exits. TA_GetFuncStats adds all the blocks.
+ *
+ *   The counters are read and written atomically (relaxed), so
+ *   TA_GetFuncStats and TA_ResetFuncStats can run while other
+ *   threads are counting. A call ending during them may be seen
+ *   only for some of its counters.
+ *
+ *   The counters of a function are at its stable id (see
+ *   TA_GetFuncId) in each block.
+ */
+
+/**** Headers ****/
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined( TA_FUNC_STATS ) && !defined( TA_GEN_CODE )
+   #if defined( _WIN32 )
+      #include <windows.h>
+   #else
+      #include <pthread.h>
+      #include <time.h>
+   #endif
+#endif
+
+#include "ta_common.h"
+#include "ta_memory.h"
+#include "ta_global.h"
+#include "ta_abstract.h"
+#include "ta_magic_nb.h"
+#include "ta_def_ui.h"
+#include "ta_func_stats.h"
+
+#if defined( TA_FUNC_STATS ) && !defined( TA_GEN_CODE )
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+volatile int TA_FuncStatsEnabled = 0;
+
+/**** Local declarations.              ****/
+
+/* A lock which does not need to be initialized. */
+#if defined( _WIN32 )
+   typedef SRWLOCK TA_StatsLock;
+   #define TA_STATS_LOCK_INIT     SRWLOCK_INIT
+   #define TA_STATS_LOCK(l)       AcquireSRWLockExclusive(l)
+   #define TA_STATS_UNLOCK(l)     ReleaseSRWLockExclusive(l)
+#else
+   typedef pthread_mutex_t TA_StatsLock;
+   #define TA_STATS_LOCK_INIT     PTHREAD_MUTEX_INITIALIZER
+   #define TA_STATS_LOCK(l)       pthread_mutex_lock(l)
+   #define TA_STATS_UNLOCK(l)     pthread_mutex_unlock(l)
+#endif
+
+/* Relaxed atomic access to the counters. */
+#if defined( _MSC_VER )
+   #define TA_STATS_LOAD(ptr)             ((unsigned long long)InterlockedCompareExchange64( (LONG64 volatile *)(ptr), 0, 0 ))
+   #define TA_STATS_STORE(ptr,val)        InterlockedExchange64( (LONG64 volatile *)(ptr), (LONG64)(val) )
+   #define TA_STATS_ADD(ptr,val)          InterlockedExchangeAdd64( (LONG64 volatile *)(ptr), (LONG64)(val) )
+   #define TA_STATS_CAS(ptr,expected,val) (InterlockedCompareExchange64( (LONG64 volatile *)(ptr), (LONG64)(val), (LONG64)(expected) ) == (LONG64)(expected))
+#else
+   #define TA_STATS_LOAD(ptr)             __atomic_load_n( (ptr), __ATOMIC_RELAXED )
+   #define TA_STATS_STORE(ptr,val)        __atomic_store_n( (ptr), (val), __ATOMIC_RELAXED )
+   #define TA_STATS_ADD(ptr,val)          __atomic_fetch_add( (ptr), (val), __ATOMIC_RELAXED )
+   #define TA_STATS_CAS(ptr,expected,val) __atomic_compare_exchange_n( (ptr), &(expected), (val), 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED )
+#endif
+
+typedef struct TA_FuncStatsBlock
+{
+   struct TA_FuncStatsBlock *next;
+
+   /* 0 once the thread using this block has exited. */
+   int inUse;
+
+   /* One per function id, from 1 to nbFuncId. */
+   TA_FuncStats stats[1];
+} TA_FuncStatsBlock;
+
+/**** Local functions declarations.    ****/
+static TA_RetCode initStats( void );
+static TA_FuncStatsBlock *getBlock( void );
+static unsigned long long nowNs( void );
+
+#if defined( _WIN32 )
+static void WINAPI releaseBlock( void *block );
+#else
+static void releaseBlock( void *block );
+#endif
+
+/**** Local variables definitions.     ****/
+static TA_StatsLock statsLock = TA_STATS_LOCK_INIT;
+
+/* Set by the first TA_SetFuncStats( 1 ). */
+static unsigned int nbFuncId = 0;
+
+/* All the blocks, never freed (a thread may still be counting). */
+static TA_FuncStatsBlock *blockList = NULL;
+
+static TA_THREAD_LOCAL TA_FuncStatsBlock *threadBlock = NULL;
+
+/* To know when a thread exits (see releaseBlock). */
+#if defined( _WIN32 )
+static DWORD blockKey = FLS_OUT_OF_INDEXES;
+#else
+static pthread_key_t blockKey;
+#endif
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_SetFuncStats( int enable )
+{
+   TA_RetCode retCode;
+
+   retCode = TA_SUCCESS;
+
+   TA_STATS_LOCK( &statsLock );
+   if( enable && !nbFuncId )
+      retCode = initStats();
+   if( retCode == TA_SUCCESS )
+      TA_FuncStatsEnabled = enable? 1 : 0;
+   TA_STATS_UNLOCK( &statsLock );
+
+   return retCode;
+}
+
+TA_RetCode TA_GetFuncStats( const TA_FuncHandle *handle, TA_FuncStats *stats )
+{
+   const TA_FuncStatsBlock *block;
+   TA_FuncStats *blockStats;
+   unsigned long long maxNs;
+   unsigned int id;
+
+   if( !handle || !stats )
+      return TA_BAD_PARAM;
+
+   memset( stats, 0, sizeof( TA_FuncStats ) );
+
+   if( TA_GetFuncId( handle, &id ) != TA_SUCCESS )
+      return TA_INVALID_HANDLE;
+
+   TA_STATS_LOCK( &statsLock );
+
+   /* The blocks have no counter for an id above nbFuncId. */
+   for( block=blockList; block && (id <= nbFuncId); block=block->next )
+   {
+      blockStats = (TA_FuncStats *)&block->stats[id-1];
+      stats->nbCall  += TA_STATS_LOAD( &blockStats->nbCall );
+      stats->nbBar   += TA_STATS_LOAD( &blockStats->nbBar );
+      stats->totalNs += TA_STATS_LOAD( &blockStats->totalNs );
+      stats->nbAlloc += TA_STATS_LOAD( &blockStats->nbAlloc );
+      maxNs = TA_STATS_LOAD( &blockStats->maxNs );
+      if( maxNs > stats->maxNs )
+         stats->maxNs = maxNs;
+   }
+
+   TA_STATS_UNLOCK( &statsLock );
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ResetFuncStats( void )
+{
+   TA_FuncStatsBlock *block;
+   TA_FuncStats *stats;
+   unsigned int i;
+
+   TA_STATS_LOCK( &statsLock );
+   for( block=blockList; block; block=block->next )
+   {
+      for( i=0; i < nbFuncId; i++ )
+      {
+         stats = &block->stats[i];
+         TA_STATS_STORE( &stats->nbCall, 0 );
+         TA_STATS_STORE( &stats->nbBar, 0 );
+         TA_STATS_STORE( &stats->totalNs, 0 );
+         TA_STATS_STORE( &stats->maxNs, 0 );
+         TA_STATS_STORE( &stats->nbAlloc, 0 );
+      }
+   }
+   TA_STATS_UNLOCK( &statsLock );
+
+   return TA_SUCCESS;
+}
+
+void TA_INT_FuncStatsBegin( TA_FuncStatsCall *call )
+{
+   call->nbAlloc = TA_ThreadNbAlloc;
+   call->startNs = nowNs();
+}
+
+void TA_INT_FuncStatsEnd( TA_FuncStatsCall *call, const TA_FuncDef *funcDef,
+                          TA_Integer startIdx, TA_Integer endIdx )
+{
+   TA_FuncStatsBlock *block;
+   TA_FuncStats *stats;
+   unsigned long long elapsedNs, maxNs;
+   unsigned int id;
+
+   elapsedNs = nowNs()-call->startNs;
+
+   block = threadBlock;
+   if( !block )
+   {
+      block = getBlock();
+      if( !block )
+         return;
+   }
+
+   if( (TA_GetFuncId( (const TA_FuncHandle *)funcDef, &id ) != TA_SUCCESS) ||
+       (id > nbFuncId) )
+      return;
+
+   stats = &block->stats[id-1];
+   TA_STATS_ADD( &stats->nbCall, 1 );
+   if( endIdx >= startIdx )
+      TA_STATS_ADD( &stats->nbBar, (unsigned long long)(endIdx-startIdx+1) );
+   TA_STATS_ADD( &stats->totalNs, elapsedNs );
+   maxNs = TA_STATS_LOAD( &stats->maxNs );
+   while( (elapsedNs > maxNs) && !TA_STATS_CAS( &stats->maxNs, maxNs, elapsedNs ) )
+      maxNs = TA_STATS_LOAD( &stats->maxNs );
+   TA_STATS_ADD( &stats->nbAlloc, TA_ThreadNbAlloc-call->nbAlloc );
+}
+
+/**** Local functions definitions.     ****/
+
+/* Called with statsLock locked. */
+static TA_RetCode initStats( void )
+{
+   if( TA_GetFuncIdMax() == 0 )
+      return TA_INTERNAL_ERROR(185);
+
+   #if defined( _WIN32 )
+   blockKey = FlsAlloc( releaseBlock );
+   if( blockKey == FLS_OUT_OF_INDEXES )
+   #else
+   if( pthread_key_create( &blockKey, releaseBlock ) != 0 )
+   #endif
+      return TA_ALLOC_ERR;
+
+   nbFuncId = TA_GetFuncIdMax();
+
+   return TA_SUCCESS;
+}
+
+/* The block of the current thread, the one of an exited
+ * thread when there is one.
+ */
+static TA_FuncStatsBlock *getBlock( void )
+{
+   TA_FuncStatsBlock *block;
+
+   TA_STATS_LOCK( &statsLock );
+
+   for( block=blockList; block && block->inUse; block=block->next );
+
+   if( !block )
+   {
+      /* malloc instead of TA_Malloc, for not counting it. */
+      block = (TA_FuncStatsBlock *)calloc( 1, sizeof( TA_FuncStatsBlock )+
+                                              sizeof( TA_FuncStats )*(nbFuncId-1) );
+      if( block )
+      {
+         block->next = blockList;
+         blockList = block;
+      }
+   }
+
+   if( block )
+   {
+      block->inUse = 1;
+      #if defined( _WIN32 )
+      FlsSetValue( blockKey, block );
+      #else
+      pthread_setspecific( blockKey, block );
+      #endif
+   }
+
+   TA_STATS_UNLOCK( &statsLock );
+
+   threadBlock = block;
+
+   return block;
+}
+
+/* Called when a thread exits (by the FLS callback on Windows).
+ * Its counters stay in the statistics, the next thread adds to them.
+ */
+#if defined( _WIN32 )
+static void WINAPI releaseBlock( void *block )
+#else
+static void releaseBlock( void *block )
+#endif
+{
+   TA_STATS_LOCK( &statsLock );
+   ((TA_FuncStatsBlock *)block)->inUse = 0;
+   TA_STATS_UNLOCK( &statsLock );
+}
+
+static unsigned long long nowNs( void )
+{
+#if defined( _WIN32 )
+   static LARGE_INTEGER frequency;
+   LARGE_INTEGER counter;
+
+   if( frequency.QuadPart == 0 )
+      QueryPerformanceFrequency( &frequency );
+   QueryPerformanceCounter( &counter );
+
+   return (unsigned long long)(counter.QuadPart/frequency.QuadPart)*1000000000ULL+
+          (unsigned long long)(counter.QuadPart%frequency.QuadPart)*1000000000ULL/
+          (unsigned long long)frequency.QuadPart;
+#else
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return (unsigned long long)ts.tv_sec*1000000000ULL+(unsigned long long)ts.tv_nsec;
+#endif
+}
+
+#else
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_SetFuncStats( int enable )
+{
+   (void)enable;
+   return TA_NOT_SUPPORTED;
+}
+
+TA_RetCode TA_GetFuncStats( const TA_FuncHandle *handle, TA_FuncStats *stats )
+{
+   (void)handle;
+   if( stats )
+      memset( stats, 0, sizeof( TA_FuncStats ) );
+   return TA_NOT_SUPPORTED;
+}
+
+TA_RetCode TA_ResetFuncStats( void )
+{
+   return TA_NOT_SUPPORTED;
+}
+
+#endif
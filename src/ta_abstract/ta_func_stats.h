@@ -0,0 +1,92 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/* Hooks of the statistics of the calls (see ta_func_stats.c).
+ *
+ * Used only internaly by the ta_abstract module. They are empty
+ * unless the library is built with TA_FUNC_STATS defined.
+ */
+
+#ifndef TA_FUNC_STATS_H
+#define TA_FUNC_STATS_H
+
+#ifndef TA_DEF_UI_H
+   #include "ta_def_ui.h"
+#endif
+
+#if defined( TA_FUNC_STATS ) && !defined( TA_GEN_CODE )
+
+typedef struct
+{
+   int enabled;
+   unsigned long long startNs;
+   unsigned long long nbAlloc;
+} TA_FuncStatsCall;
+
+/* Not 0 while the calls are counted (see TA_SetFuncStats). */
+extern volatile int TA_FuncStatsEnabled;
+
+void TA_INT_FuncStatsBegin( TA_FuncStatsCall *call );
+void TA_INT_FuncStatsEnd( TA_FuncStatsCall *call, const TA_FuncDef *funcDef,
+                          TA_Integer startIdx, TA_Integer endIdx );
+
+/* Usage:
+ *    TA_FUNC_STATS_DECL
+ *    ...
+ *    TA_FUNC_STATS_BEGIN
+ *    retCode = (*function)( ... );
+ *    TA_FUNC_STATS_END( funcDef, startIdx, endIdx )
+ */
+#define TA_FUNC_STATS_DECL TA_FuncStatsCall funcStatsCall;
+
+#define TA_FUNC_STATS_BEGIN { \
+   funcStatsCall.enabled = TA_FuncStatsEnabled; \
+   if( funcStatsCall.enabled ) \
+      TA_INT_FuncStatsBegin( &funcStatsCall ); \
+}
+
+#define TA_FUNC_STATS_END(funcDef,startIdx,endIdx) { \
+   if( funcStatsCall.enabled ) \
+      TA_INT_FuncStatsEnd( &funcStatsCall, funcDef, startIdx, endIdx ); \
+}
+
+#else
+
+#define TA_FUNC_STATS_DECL
+#define TA_FUNC_STATS_BEGIN
+#define TA_FUNC_STATS_END(funcDef,startIdx,endIdx)
+
+#endif
+
+#endif
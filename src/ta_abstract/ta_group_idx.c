@@ -40,9 +40,19 @@
  *       TA_PerGroupFuncDef
  *       TA_PerGroupSize
  *       TA_TotalNbFunction
+ *       TA_FuncDefById
+ *       TA_FuncIdMax
+ *       TA_FuncHashNbBucket
+ *       TA_FuncHashNbSlot
+ *       TA_FuncHashSeed
+ *       TA_FuncHashId
  *
  * These constant allows mainly to speed optimize functionality related to
  * sequential access to TA_DefFunc by TA_GroupId (see ta_abstract.c)
+ *
+ * TA_FuncDefById gives the function of each id (see ta_func_id.txt) and
+ * the TA_FuncHashXXX are the perfect hash of the function names used by
+ * TA_GetFuncHandle.
  */
 #include <stddef.h>
 #include "ta_def_ui.h"
@@ -448,6 +458,202 @@ SIZE_GROUP_7+
 SIZE_GROUP_8+
 SIZE_GROUP_9;
 
+/* Generated */ const TA_FuncDef *TA_FuncDefById[162] = {
+NULL,
+&TA_DEF_ACCBANDS,
+&TA_DEF_ACOS,
+&TA_DEF_AD,
+&TA_DEF_ADD,
+&TA_DEF_ADOSC,
+&TA_DEF_ADX,
+&TA_DEF_ADXR,
+&TA_DEF_APO,
+&TA_DEF_AROON,
+&TA_DEF_AROONOSC,
+&TA_DEF_ASIN,
+&TA_DEF_ATAN,
+&TA_DEF_ATR,
+&TA_DEF_AVGPRICE,
+&TA_DEF_AVGDEV,
+&TA_DEF_BBANDS,
+&TA_DEF_BETA,
+&TA_DEF_BOP,
+&TA_DEF_CCI,
+&TA_DEF_CDL2CROWS,
+&TA_DEF_CDL3BLACKCROWS,
+&TA_DEF_CDL3INSIDE,
+&TA_DEF_CDL3LINESTRIKE,
+&TA_DEF_CDL3OUTSIDE,
+&TA_DEF_CDL3STARSINSOUTH,
+&TA_DEF_CDL3WHITESOLDIERS,
+&TA_DEF_CDLABANDONEDBABY,
+&TA_DEF_CDLADVANCEBLOCK,
+&TA_DEF_CDLBELTHOLD,
+&TA_DEF_CDLBREAKAWAY,
+&TA_DEF_CDLCLOSINGMARUBOZU,
+&TA_DEF_CDLCONCEALBABYSWALL,
+&TA_DEF_CDLCOUNTERATTACK,
+&TA_DEF_CDLDARKCLOUDCOVER,
+&TA_DEF_CDLDOJI,
+&TA_DEF_CDLDOJISTAR,
+&TA_DEF_CDLDRAGONFLYDOJI,
+&TA_DEF_CDLENGULFING,
+&TA_DEF_CDLEVENINGDOJISTAR,
+&TA_DEF_CDLEVENINGSTAR,
+&TA_DEF_CDLGAPSIDESIDEWHITE,
+&TA_DEF_CDLGRAVESTONEDOJI,
+&TA_DEF_CDLHAMMER,
+&TA_DEF_CDLHANGINGMAN,
+&TA_DEF_CDLHARAMI,
+&TA_DEF_CDLHARAMICROSS,
+&TA_DEF_CDLHIGHWAVE,
+&TA_DEF_CDLHIKKAKE,
+&TA_DEF_CDLHIKKAKEMOD,
+&TA_DEF_CDLHOMINGPIGEON,
+&TA_DEF_CDLIDENTICAL3CROWS,
+&TA_DEF_CDLINNECK,
+&TA_DEF_CDLINVERTEDHAMMER,
+&TA_DEF_CDLKICKING,
+&TA_DEF_CDLKICKINGBYLENGTH,
+&TA_DEF_CDLLADDERBOTTOM,
+&TA_DEF_CDLLONGLEGGEDDOJI,
+&TA_DEF_CDLLONGLINE,
+&TA_DEF_CDLMARUBOZU,
+&TA_DEF_CDLMATCHINGLOW,
+&TA_DEF_CDLMATHOLD,
+&TA_DEF_CDLMORNINGDOJISTAR,
+&TA_DEF_CDLMORNINGSTAR,
+&TA_DEF_CDLONNECK,
+&TA_DEF_CDLPIERCING,
+&TA_DEF_CDLRICKSHAWMAN,
+&TA_DEF_CDLRISEFALL3METHODS,
+&TA_DEF_CDLSEPARATINGLINES,
+&TA_DEF_CDLSHOOTINGSTAR,
+&TA_DEF_CDLSHORTLINE,
+&TA_DEF_CDLSPINNINGTOP,
+&TA_DEF_CDLSTALLEDPATTERN,
+&TA_DEF_CDLSTICKSANDWICH,
+&TA_DEF_CDLTAKURI,
+&TA_DEF_CDLTASUKIGAP,
+&TA_DEF_CDLTHRUSTING,
+&TA_DEF_CDLTRISTAR,
+&TA_DEF_CDLUNIQUE3RIVER,
+&TA_DEF_CDLUPSIDEGAP2CROWS,
+&TA_DEF_CDLXSIDEGAP3METHODS,
+&TA_DEF_CEIL,
+&TA_DEF_CMO,
+&TA_DEF_CORREL,
+&TA_DEF_COS,
+&TA_DEF_COSH,
+&TA_DEF_DEMA,
+&TA_DEF_DIV,
+&TA_DEF_DX,
+&TA_DEF_EMA,
+&TA_DEF_EXP,
+&TA_DEF_FLOOR,
+&TA_DEF_HT_DCPERIOD,
+&TA_DEF_HT_DCPHASE,
+&TA_DEF_HT_PHASOR,
+&TA_DEF_HT_SINE,
+&TA_DEF_HT_TRENDLINE,
+&TA_DEF_HT_TRENDMODE,
+&TA_DEF_IMI,
+&TA_DEF_KAMA,
+&TA_DEF_LINEARREG,
+&TA_DEF_LINEARREG_ANGLE,
+&TA_DEF_LINEARREG_INTERCEPT,
+&TA_DEF_LINEARREG_SLOPE,
+&TA_DEF_LN,
+&TA_DEF_LOG10,
+&TA_DEF_MA,
+&TA_DEF_MACD,
+&TA_DEF_MACDEXT,
+&TA_DEF_MACDFIX,
+&TA_DEF_MAMA,
+&TA_DEF_MAVP,
+&TA_DEF_MAX,
+&TA_DEF_MAXINDEX,
+&TA_DEF_MEDPRICE,
+&TA_DEF_MFI,
+&TA_DEF_MIDPOINT,
+&TA_DEF_MIDPRICE,
+&TA_DEF_MIN,
+&TA_DEF_MININDEX,
+&TA_DEF_MINMAX,
+&TA_DEF_MINMAXINDEX,
+&TA_DEF_MINUS_DI,
+&TA_DEF_MINUS_DM,
+&TA_DEF_MOM,
+&TA_DEF_MULT,
+&TA_DEF_NATR,
+&TA_DEF_OBV,
+&TA_DEF_PLUS_DI,
+&TA_DEF_PLUS_DM,
+&TA_DEF_PPO,
+&TA_DEF_ROC,
+&TA_DEF_ROCP,
+&TA_DEF_ROCR,
+&TA_DEF_ROCR100,
+&TA_DEF_RSI,
+&TA_DEF_SAR,
+&TA_DEF_SAREXT,
+&TA_DEF_SIN,
+&TA_DEF_SINH,
+&TA_DEF_SMA,
+&TA_DEF_SQRT,
+&TA_DEF_STDDEV,
+&TA_DEF_STOCH,
+&TA_DEF_STOCHF,
+&TA_DEF_STOCHRSI,
+&TA_DEF_SUB,
+&TA_DEF_SUM,
+&TA_DEF_T3,
+&TA_DEF_TAN,
+&TA_DEF_TANH,
+&TA_DEF_TEMA,
+&TA_DEF_TRANGE,
+&TA_DEF_TRIMA,
+&TA_DEF_TRIX,
+&TA_DEF_TSF,
+&TA_DEF_TYPPRICE,
+&TA_DEF_ULTOSC,
+&TA_DEF_VAR,
+&TA_DEF_WCLPRICE,
+&TA_DEF_WILLR,
+&TA_DEF_WMA
+/* Generated */ };
+
+/* Generated */ const unsigned int TA_FuncIdMax = 161;
+
+/* Generated */ const unsigned int TA_FuncHashNbBucket = 64;
+/* Generated */ const unsigned int TA_FuncHashNbSlot = 256;
+
+/* Generated */ const unsigned short TA_FuncHashSeed[64] = {
+0,3,1,1,1,2,1,5,1,2,2,1,2,2,5,1,
+1,1,2,1,9,1,1,1,1,5,2,1,1,1,2,7,
+0,3,1,1,1,2,1,1,3,4,2,5,5,1,1,19,
+17,2,5,4,12,6,2,7,4,3,5,1,0,5,4,4
+/* Generated */ };
+
+/* Generated */ const unsigned short TA_FuncHashId[256] = {
+123,0,116,0,152,0,104,0,0,139,13,0,57,0,71,12,
+146,122,72,26,0,143,23,0,158,114,53,0,141,113,137,16,
+0,78,76,0,0,4,0,101,58,129,0,94,0,0,0,154,
+0,0,54,46,132,47,9,51,125,3,74,109,99,102,108,0,
+0,70,41,24,86,19,6,0,0,0,83,0,0,0,142,29,
+0,2,136,124,138,95,8,0,97,0,45,82,28,0,0,134,
+38,0,84,119,0,73,156,0,0,128,118,92,66,49,140,0,
+39,107,0,80,89,64,0,161,145,0,0,130,0,0,0,10,
+33,67,30,0,48,0,79,150,20,0,96,0,91,0,100,18,
+75,93,0,1,103,87,0,43,0,133,7,153,0,22,0,37,
+21,35,0,0,131,147,126,62,0,56,90,155,55,121,0,34,
+11,0,0,0,135,0,106,0,68,27,77,0,65,0,0,61,
+98,0,112,149,157,120,52,110,25,0,0,0,0,0,32,17,
+0,44,0,151,63,0,36,42,0,88,69,115,5,0,0,40,
+0,159,50,148,14,0,105,0,0,81,15,0,0,144,0,85,
+0,160,0,0,0,0,0,117,60,59,0,0,31,111,127,0
+/* Generated */ };
+
 /***************/
 /* End of File */
 /***************/
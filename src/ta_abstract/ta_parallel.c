@@ -0,0 +1,1186 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ *  101826 MF   Split the running sums in TA_MATH_FAST, one queue per thread.
+ *  101826 MF   Balance the symbols of a batch among the queues by length.
+ *  101826 MF   Split CCI and the linear regressions in TA_MATH_STRICT,
+ *              give the allocator and a workspace to the other threads.
+ */
+
+/* Description:
+ *   Parallel execution of the TA functions (see TA_CallFuncParallel
+ *   and TA_CallFuncBatch).
+ *
+ *   The output of some functions at one bar is calculated only from
+ *   the "lookback" bars before it, the same way whatever the start of
+ *   the range. Such a range can be split in chunks, each chunk being
+ *   the same call as TA_CallFunc with a smaller range. The input before
+ *   each chunk is read by the function itself (the overlap), and each
+ *   chunk writes directly at its place in the output of the caller.
+ *
+ *   The chunks are many more than the threads. Each thread (including
+ *   the caller) has its own queue of consecutive chunks, taken from the
+ *   head. A thread whose queue is empty steals the second half of the
+ *   chunks left in the queue of another thread, so a thread slowed down
+ *   by the system does not delay the others. The threads lock only the
+ *   queue they take from, never all at once.
+ *
+ *   The functions with a recursive state (EMA, SAR, OBV...) cannot be
+ *   split and are simply called by the caller thread.
+ *
+ *   The CCI and the linear regressions (LINEARREG..., TSF) start their
+ *   sums again from scratch every optInTimePeriod bars from the start
+ *   of the range (the CCI sums its circular buffer from the same slot).
+ *   Their chunks are made a multiple of optInTimePeriod, so each chunk
+ *   starts where TA_CallFunc would start its sums again, and the output
+ *   is identical in TA_MATH_STRICT too.
+ *
+ *   The other functions keeping running sums over their window (SMA,
+ *   WMA, VAR, STDDEV, CORREL, BETA, SUM and the candlesticks) carry
+ *   their sums from the start of the range to its end. Their state at
+ *   the start of a chunk depends on every bar before it, so it cannot
+ *   be found without doing all these bars first, which is the same work
+ *   as TA_CallFunc. They are split only in TA_MATH_FAST: each chunk
+ *   then starts its sums again from the bars of its overlap, so the
+ *   output differs from the one of TA_CallFunc by the rounding errors
+ *   the running sums accumulated along the range.
+ *
+ *   A batch is the same function called for many symbols. Each symbol,
+ *   starting with the longest series, goes in the queue with the fewest
+ *   bars so far. The queues so start with about the same work, and the
+ *   stealing takes care of the rest, so the threads all finish at about
+ *   the same time.
+ *
+ *   The other threads use the allocator of the caller thread
+ *   (TA_SetThreadAllocator), except a TA_Arena which only the caller
+ *   can allocate from. For the functions having a TA_XXX_Workspace,
+ *   the caller also allocates a workspace with a slice per thread,
+ *   large enough for any item of the job, so the temporary buffers of
+ *   the items are not taken from the heap (see TA_INT_TempAlloc).
+ */
+
+/**** Headers ****/
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined( _WIN32 )
+   #include <windows.h>
+#else
+   #include <pthread.h>
+   #include <unistd.h>
+#endif
+
+#include "ta_common.h"
+#include "ta_memory.h"
+#include "ta_global.h"
+#include "ta_abstract.h"
+#include "ta_def_ui.h"
+#include "ta_frame_priv.h"
+#include "ta_func_stats.h"
+#include "ta_func_ext.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+#if defined( _WIN32 )
+   typedef CRITICAL_SECTION   TA_Mutex;
+   typedef CONDITION_VARIABLE TA_Cond;
+   typedef HANDLE             TA_Thread;
+   #define TA_MUTEX_INIT(m)       InitializeCriticalSection(m)
+   #define TA_MUTEX_DESTROY(m)    DeleteCriticalSection(m)
+   #define TA_MUTEX_LOCK(m)       EnterCriticalSection(m)
+   #define TA_MUTEX_UNLOCK(m)     LeaveCriticalSection(m)
+   #define TA_COND_INIT(c)        InitializeConditionVariable(c)
+   #define TA_COND_DESTROY(c)
+   #define TA_COND_WAIT(c,m)      SleepConditionVariableCS(c,m,INFINITE)
+   #define TA_COND_BROADCAST(c)   WakeAllConditionVariable(c)
+   #define TA_THREAD_FUNC         DWORD WINAPI
+   #define TA_THREAD_RETURN       0
+#else
+   typedef pthread_mutex_t    TA_Mutex;
+   typedef pthread_cond_t     TA_Cond;
+   typedef pthread_t          TA_Thread;
+   #define TA_MUTEX_INIT(m)       pthread_mutex_init(m,NULL)
+   #define TA_MUTEX_DESTROY(m)    pthread_mutex_destroy(m)
+   #define TA_MUTEX_LOCK(m)       pthread_mutex_lock(m)
+   #define TA_MUTEX_UNLOCK(m)     pthread_mutex_unlock(m)
+   #define TA_COND_INIT(c)        pthread_cond_init(c,NULL)
+   #define TA_COND_DESTROY(c)     pthread_cond_destroy(c)
+   #define TA_COND_WAIT(c,m)      pthread_cond_wait(c,m)
+   #define TA_COND_BROADCAST(c)   pthread_cond_broadcast(c)
+   #define TA_THREAD_FUNC         void *
+   #define TA_THREAD_RETURN       NULL
+#endif
+
+/* Smallest chunk worth a thread. The chunks are also
+ * kept much larger than the lookback, else most of the
+ * work would be in the overlap.
+ */
+#define TA_PARALLEL_MIN_CHUNK     4096
+#define TA_PARALLEL_LOOKBACK_MULT 8
+
+/* Number of chunks per thread for balancing the work. */
+#define TA_PARALLEL_CHUNK_PER_THREAD 4
+
+/* The TA functions have at most 3 outputs. */
+#define TA_PARALLEL_MAX_OUTPUT 3
+
+/* Symbol of a batch, the longest are done first. */
+typedef struct
+{
+   TA_Integer   nbBars;
+   unsigned int idx;
+   unsigned int queue;
+} TA_BatchOrder;
+
+/* Items of a job given to one thread, from head to tail-1. The
+ * owner takes them from the head, the other threads steal from
+ * the tail.
+ */
+typedef struct
+{
+   TA_ThreadPool *pool;
+   TA_Mutex mutex;
+   int head;
+   int tail;
+} TA_WorkQueue;
+
+/* Work being split among the threads. An item
+ * is a chunk or a symbol.
+ */
+typedef struct TA_ParallelJob TA_ParallelJob;
+
+struct TA_ParallelJob
+{
+   TA_RetCode (*runItem)( const TA_ParallelJob *job, int item );
+
+   const TA_ParamHolderPriv *params;
+   TA_FrameFunction function;
+   TA_FrameDirect direct;
+
+   /* The settings of the caller for all the threads. */
+   const TA_Context *context;
+   const TA_Allocator *allocator;
+
+   /* Slice of workspaceSize double for each thread, NULL
+    * when the temporary buffers are taken from the heap.
+    */
+   double *workspace;
+   int workspaceSize;
+
+   /* TA_CallFuncParallel: the range in chunks. */
+   TA_Integer outBegIdx;
+   TA_Integer endIdx;
+   TA_Integer chunkSize;
+
+   /* TA_CallFuncBatch: the symbols. */
+   TA_BatchSymbol *symbol;
+   const TA_BatchOrder *order;
+
+   /* First item of each queue, NULL for the same number of
+    * items in each queue.
+    */
+   const int *queueFirst;
+
+   int nbItem;
+
+   /* Protected by the mutex of the pool. */
+   int nbWorker;     /* Worker threads still using this job. */
+   TA_RetCode retCode;
+};
+
+struct TA_ThreadPool
+{
+   unsigned int magicNb;
+
+   unsigned int nbThread; /* Including the caller. */
+   TA_Thread *thread;
+
+   /* One queue per thread, the caller is the first one. */
+   unsigned int nbQueue;
+   TA_WorkQueue *queue;
+
+   /* One call at the time, the others wait. */
+   TA_Mutex callMutex;
+
+   TA_Mutex mutex;
+   TA_Cond  workCond;
+   TA_Cond  doneCond;
+   TA_ParallelJob *job;
+   unsigned int jobId;
+   int shutdown;
+};
+
+/* The functions split outside of the groups where all
+ * the functions are (see isParallel).
+ */
+static const char *parallelFuncName[] =
+{
+   "AROON", "AROONOSC", "AVGDEV", "BOP", "MIDPOINT", "MIDPRICE", "MOM",
+   "ROC", "ROCP", "ROCR", "ROCR100", "TRANGE", "WILLR"
+};
+
+#define NB_PARALLEL_FUNC (sizeof(parallelFuncName)/sizeof(const char *))
+
+/* The functions starting their sums again every optInTimePeriod
+ * bars, split in chunks of a multiple of optInTimePeriod.
+ */
+static const char *parallelPeriodFuncName[] =
+{
+   "CCI", "LINEARREG", "LINEARREG_ANGLE", "LINEARREG_INTERCEPT",
+   "LINEARREG_SLOPE", "TSF"
+};
+
+#define NB_PARALLEL_PERIOD_FUNC (sizeof(parallelPeriodFuncName)/sizeof(const char *))
+
+/* The functions carrying running sums along the range, split only
+ * in TA_MATH_FAST (with the group "Pattern Recognition" and SUM).
+ */
+static const char *parallelSumFuncName[] =
+{
+   "BETA", "CORREL", "SMA", "STDDEV", "VAR", "WMA"
+};
+
+#define NB_PARALLEL_SUM_FUNC (sizeof(parallelSumFuncName)/sizeof(const char *))
+
+/* Optional inputs of the functions having a TA_XXX_Workspace. */
+#define OPT_IN_INTEGER(i) (params->optIn[i].data.optInInteger)
+#define OPT_IN_MATYPE(i)  ((TA_MAType)params->optIn[i].data.optInInteger)
+
+/**** Local functions declarations.    ****/
+static int isParallel( const TA_ParamHolderPriv *params, const TA_FuncDef *funcDef );
+static int timePeriod( const TA_ParamHolderPriv *params );
+static int itemWorkspace( const TA_ParamHolderPriv *params,
+                          TA_Integer startIdx, TA_Integer endIdx );
+static void allocWorkspace( TA_ParallelJob *job, unsigned int nbThread, int size );
+static TA_RetCode runChunk( const TA_ParallelJob *job, int chunk );
+static TA_RetCode runSymbol( const TA_ParallelJob *job, int item );
+static int compareOrder( const void *a, const void *b );
+static int compareQueue( const void *a, const void *b );
+static TA_RetCode balanceOrder( TA_BatchOrder *order, unsigned int nbSymbol,
+                                unsigned int nbQueue, int *queueFirst );
+static void runParallel( TA_ThreadPool *pool, TA_ParallelJob *job );
+static void runJob( TA_ThreadPool *pool, TA_ParallelJob *job, unsigned int self );
+static TA_Workspace *setWorkspace( const TA_ParallelJob *job, unsigned int self,
+                                   TA_Workspace *workspace );
+static TA_RetCode doItem( const TA_ParallelJob *job, int item );
+static int stealItems( TA_ThreadPool *pool, unsigned int self );
+static TA_THREAD_FUNC workerThread( void *arg );
+static unsigned int nbCore( void );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_ThreadPoolAlloc( TA_ThreadPool **pool, unsigned int nbThread )
+{
+   TA_ThreadPool *newPool;
+   unsigned int i;
+   int failed;
+
+   if( !pool )
+      return TA_BAD_PARAM;
+
+   *pool = NULL;
+
+   if( nbThread == 0 )
+      nbThread = nbCore();
+
+   newPool = (TA_ThreadPool *)TA_Malloc( sizeof( TA_ThreadPool ) );
+   if( !newPool )
+      return TA_ALLOC_ERR;
+
+   memset( newPool, 0, sizeof( TA_ThreadPool ) );
+   newPool->thread = (TA_Thread *)TA_Malloc( sizeof(TA_Thread)*nbThread );
+   newPool->queue  = (TA_WorkQueue *)TA_Malloc( sizeof(TA_WorkQueue)*nbThread );
+   if( !newPool->thread || !newPool->queue )
+   {
+      TA_Free( newPool->thread );
+      TA_Free( newPool->queue );
+      TA_Free( newPool );
+      return TA_ALLOC_ERR;
+   }
+
+   newPool->magicNb = TA_THREAD_POOL_MAGIC_NB;
+   TA_MUTEX_INIT( &newPool->callMutex );
+   TA_MUTEX_INIT( &newPool->mutex );
+   TA_COND_INIT( &newPool->workCond );
+   TA_COND_INIT( &newPool->doneCond );
+
+   for( i=0; i < nbThread; i++ )
+   {
+      newPool->queue[i].pool = newPool;
+      newPool->queue[i].head = 0;
+      newPool->queue[i].tail = 0;
+      TA_MUTEX_INIT( &newPool->queue[i].mutex );
+   }
+   newPool->nbQueue = nbThread;
+
+   /* The caller is the first thread, start the others. */
+   newPool->nbThread = 1;
+   failed = 0;
+   for( i=1; (i < nbThread) && !failed; i++ )
+   {
+      #if defined( _WIN32 )
+         newPool->thread[i] = CreateThread( NULL, 0, workerThread, &newPool->queue[i], 0, NULL );
+         failed = (newPool->thread[i] == NULL);
+      #else
+         failed = pthread_create( &newPool->thread[i], NULL, workerThread, &newPool->queue[i] );
+      #endif
+      if( !failed )
+         newPool->nbThread++;
+   }
+
+   if( failed )
+   {
+      TA_ThreadPoolFree( newPool );
+      return TA_ALLOC_ERR;
+   }
+
+   *pool = newPool;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ThreadPoolFree( TA_ThreadPool *pool )
+{
+   unsigned int i;
+
+   if( !pool )
+      return TA_SUCCESS;
+
+   if( pool->magicNb != TA_THREAD_POOL_MAGIC_NB )
+      return TA_INVALID_HANDLE;
+
+   TA_MUTEX_LOCK( &pool->mutex );
+   pool->shutdown = 1;
+   TA_COND_BROADCAST( &pool->workCond );
+   TA_MUTEX_UNLOCK( &pool->mutex );
+
+   for( i=1; i < pool->nbThread; i++ )
+   {
+      #if defined( _WIN32 )
+         WaitForSingleObject( pool->thread[i], INFINITE );
+         CloseHandle( pool->thread[i] );
+      #else
+         pthread_join( pool->thread[i], NULL );
+      #endif
+   }
+
+   for( i=0; i < pool->nbQueue; i++ )
+      TA_MUTEX_DESTROY( &pool->queue[i].mutex );
+
+   TA_COND_DESTROY( &pool->doneCond );
+   TA_COND_DESTROY( &pool->workCond );
+   TA_MUTEX_DESTROY( &pool->mutex );
+   TA_MUTEX_DESTROY( &pool->callMutex );
+
+   pool->magicNb = 0;
+   TA_Free( pool->queue );
+   TA_Free( pool->thread );
+   TA_Free( pool );
+
+   return TA_SUCCESS;
+}
+
+unsigned int TA_ThreadPoolGetNbThread( const TA_ThreadPool *pool )
+{
+   if( !pool || (pool->magicNb != TA_THREAD_POOL_MAGIC_NB) )
+      return 0;
+
+   return pool->nbThread;
+}
+
+TA_RetCode TA_CallFuncParallel( TA_ThreadPool        *pool,
+                                const TA_ParamHolder *param,
+                                TA_Integer            startIdx,
+                                TA_Integer            endIdx,
+                                TA_Integer           *outBegIdx,
+                                TA_Integer           *outNbElement )
+{
+   const TA_ParamHolderPriv *paramHolderPriv;
+   const TA_FuncDef *funcDef;
+   TA_ParallelJob job;
+   TA_Integer lookback, begIdx, nbElement, chunkSize, minChunkSize;
+   unsigned int nbChunk;
+   int chunkMultiple;
+
+   if( !pool || (pool->magicNb != TA_THREAD_POOL_MAGIC_NB) )
+      return TA_BAD_PARAM;
+
+   if( (param == NULL) ||
+       (outBegIdx == NULL) ||
+       (outNbElement == NULL) )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   paramHolderPriv = (TA_ParamHolderPriv *)(param->hiddenData);
+   if( paramHolderPriv->magicNumber != TA_PARAM_HOLDER_PRIV_MAGIC_NB )
+   {
+      return TA_INVALID_PARAM_HOLDER;
+   }
+
+   if( (paramHolderPriv->inBitmap != 0) || (paramHolderPriv->outBitmap != 0) ||
+       !paramHolderPriv->funcInfo )
+   {
+      /* TA_CallFunc reports the problem. */
+      return TA_CallFunc( param, startIdx, endIdx, outBegIdx, outNbElement );
+   }
+
+   funcDef = (const TA_FuncDef *)paramHolderPriv->funcInfo->handle;
+   if( !funcDef || !funcDef->function || !funcDef->lookback )
+      return TA_INTERNAL_ERROR(2);
+
+   /* Check the range as the TA function would. */
+   chunkMultiple = isParallel( paramHolderPriv, funcDef );
+   if( (startIdx < 0) || (endIdx < 0) || (endIdx < startIdx) || !chunkMultiple )
+      return TA_CallFunc( param, startIdx, endIdx, outBegIdx, outNbElement );
+
+   /* The first output is at the lookback. The range
+    * given to TA_CallFunc stays the one of the caller.
+    */
+   lookback = (TA_Integer)(*funcDef->lookback)( paramHolderPriv );
+   begIdx = startIdx;
+   if( (lookback < 0) || (begIdx < lookback) )
+      begIdx = lookback;
+
+   /* Too small to be worth splitting. */
+   nbElement = endIdx-begIdx+1;
+   minChunkSize = TA_PARALLEL_LOOKBACK_MULT*lookback;
+   if( minChunkSize < TA_PARALLEL_MIN_CHUNK )
+      minChunkSize = TA_PARALLEL_MIN_CHUNK;
+   if( (pool->nbThread < 2) || (nbElement < 2*minChunkSize) )
+      return TA_CallFunc( param, startIdx, endIdx, outBegIdx, outNbElement );
+
+   chunkSize = nbElement/(TA_Integer)(pool->nbThread*TA_PARALLEL_CHUNK_PER_THREAD);
+   if( chunkSize < minChunkSize )
+      chunkSize = minChunkSize;
+   chunkSize = ((chunkSize+chunkMultiple-1)/chunkMultiple)*chunkMultiple;
+   nbChunk = (unsigned int)((nbElement+chunkSize-1)/chunkSize);
+
+   memset( &job, 0, sizeof( job ) );
+   job.runItem   = runChunk;
+   job.params    = paramHolderPriv;
+   job.function  = funcDef->function;
+   job.context   = TA_ThreadContext;
+   job.allocator = TA_GetThreadAllocator();
+   job.outBegIdx = begIdx;
+   job.endIdx    = endIdx;
+   job.chunkSize = chunkSize;
+   job.nbItem    = (int)nbChunk;
+   job.retCode   = TA_SUCCESS;
+
+   /* All the chunks are at most chunkSize bars. */
+   allocWorkspace( &job, pool->nbThread,
+                   itemWorkspace( paramHolderPriv, begIdx, begIdx+chunkSize-1 ) );
+
+   runParallel( pool, &job );
+
+   TA_Free( job.workspace );
+
+   if( job.retCode != TA_SUCCESS )
+   {
+      *outBegIdx    = 0;
+      *outNbElement = 0;
+      return job.retCode;
+   }
+
+   *outBegIdx    = begIdx;
+   *outNbElement = nbElement;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_CallFuncBatch( TA_ThreadPool        *pool,
+                             const TA_ParamHolder *params,
+                             TA_BatchSymbol       *symbol,
+                             unsigned int          nbSymbol )
+{
+   const TA_ParamHolderPriv *paramHolderPriv;
+   const TA_FuncDef *funcDef;
+   TA_BatchOrder *order;
+   TA_ParallelJob job;
+   TA_RetCode retCode;
+   unsigned int i, nbThread;
+   int *queueFirst, size, workspaceSize;
+
+   if( pool && (pool->magicNb != TA_THREAD_POOL_MAGIC_NB) )
+      return TA_BAD_PARAM;
+
+   if( !params || (!symbol && (nbSymbol != 0)) )
+      return TA_BAD_PARAM;
+
+   paramHolderPriv = (TA_ParamHolderPriv *)(params->hiddenData);
+   if( paramHolderPriv->magicNumber != TA_PARAM_HOLDER_PRIV_MAGIC_NB )
+   {
+      return TA_INVALID_PARAM_HOLDER;
+   }
+
+   if( !paramHolderPriv->funcInfo )
+      return TA_INVALID_HANDLE;
+
+   funcDef = (const TA_FuncDef *)paramHolderPriv->funcInfo->handle;
+   if( !funcDef || !funcDef->direct )
+      return TA_INTERNAL_ERROR(2);
+
+   if( nbSymbol == 0 )
+      return TA_SUCCESS;
+
+   /* The longest series first. */
+   order = (TA_BatchOrder *)TA_Malloc( sizeof(TA_BatchOrder)*nbSymbol );
+   if( !order )
+      return TA_ALLOC_ERR;
+
+   workspaceSize = 0;
+   for( i=0; i < nbSymbol; i++ )
+   {
+      order[i].nbBars = symbol[i].endIdx-symbol[i].startIdx+1;
+      order[i].idx    = i;
+      order[i].queue  = 0;
+
+      size = itemWorkspace( paramHolderPriv, symbol[i].startIdx, symbol[i].endIdx );
+      if( size > workspaceSize )
+         workspaceSize = size;
+   }
+   qsort( order, nbSymbol, sizeof(TA_BatchOrder), compareOrder );
+
+   /* Give about the same number of bars to each thread. */
+   queueFirst = NULL;
+   nbThread   = TA_ThreadPoolGetNbThread( pool );
+   if( nbThread == 0 )
+      nbThread = 1;
+   if( nbThread > 1 )
+   {
+      queueFirst = (int *)TA_Malloc( sizeof(int)*(nbThread+1) );
+      retCode = queueFirst? balanceOrder( order, nbSymbol, nbThread, queueFirst ) : TA_ALLOC_ERR;
+      if( retCode != TA_SUCCESS )
+      {
+         TA_Free( queueFirst );
+         TA_Free( order );
+         return retCode;
+      }
+   }
+
+   memset( &job, 0, sizeof( job ) );
+   job.runItem    = runSymbol;
+   job.params     = paramHolderPriv;
+   job.direct     = funcDef->direct;
+   job.context    = TA_ThreadContext;
+   job.allocator  = TA_GetThreadAllocator();
+   job.symbol     = symbol;
+   job.order      = order;
+   job.queueFirst = queueFirst;
+   job.nbItem     = (int)nbSymbol;
+   job.retCode    = TA_SUCCESS;
+
+   allocWorkspace( &job, nbThread, workspaceSize );
+
+   runParallel( pool, &job );
+
+   TA_Free( job.workspace );
+   TA_Free( queueFirst );
+   TA_Free( order );
+
+   return job.retCode;
+}
+
+/**** Local functions definitions.     ****/
+/* The functions calculating each output from the bars of its window
+ * alone, always the same way: the element-wise functions, and the
+ * ones using only the extremes of the window, a few bars or sums
+ * done again for each output. Also the ones starting their sums
+ * again every optInTimePeriod bars and, in TA_MATH_FAST, the ones
+ * carrying running sums along the range.
+ *
+ * Returns 0 when the function is not split, else the number of bars
+ * the size of the chunks must be a multiple of.
+ */
+static int isParallel( const TA_ParamHolderPriv *params, const TA_FuncDef *funcDef )
+{
+   const TA_FuncInfo *funcInfo;
+   unsigned int i;
+   int isFast;
+
+   funcInfo = params->funcInfo;
+   if( funcInfo->nbOutput > TA_PARALLEL_MAX_OUTPUT )
+      return 0;
+
+   isFast = (TA_ThreadContext->mathMode == TA_MATH_FAST);
+
+   switch( funcDef->groupId )
+   {
+   case TA_GroupId_MathTransform:
+   case TA_GroupId_PriceTransform:
+      return 1;
+   case TA_GroupId_MathOperators:
+      /* MAXINDEX, MININDEX and MINMAXINDEX are never split: the
+       * index kept for tied values depends on the bar where the
+       * search started. SUM is a running sum.
+       */
+      if( strstr( funcInfo->name, "INDEX" ) != NULL )
+         return 0;
+      if( strcmp( funcInfo->name, "SUM" ) == 0 )
+         return isFast;
+      return 1;
+   case TA_GroupId_PatternRecognition:
+      /* The candle averages are running sums. */
+      return isFast;
+   default:
+      break;
+   }
+
+   for( i=0; i < NB_PARALLEL_FUNC; i++ )
+   {
+      if( strcmp( funcInfo->name, parallelFuncName[i] ) == 0 )
+         return 1;
+   }
+
+   for( i=0; i < NB_PARALLEL_PERIOD_FUNC; i++ )
+   {
+      if( strcmp( funcInfo->name, parallelPeriodFuncName[i] ) == 0 )
+         return timePeriod( params );
+   }
+
+   for( i=0; isFast && (i < NB_PARALLEL_SUM_FUNC); i++ )
+   {
+      if( strcmp( funcInfo->name, parallelSumFuncName[i] ) == 0 )
+         return 1;
+   }
+
+   return 0;
+}
+
+/* The optInTimePeriod of the function, 0 when it has
+ * none or when it is out of range.
+ */
+static int timePeriod( const TA_ParamHolderPriv *params )
+{
+   const TA_OptInputParameterInfo *optInputInfo;
+   TA_Integer period;
+   unsigned int i;
+
+   for( i=0; i < params->funcInfo->nbOptInput; i++ )
+   {
+      optInputInfo = params->optIn[i].optInputInfo;
+      if( strcmp( optInputInfo->paramName, "optInTimePeriod" ) != 0 )
+         continue;
+
+      period = params->optIn[i].data.optInInteger;
+      if( period == TA_INTEGER_DEFAULT )
+         period = (TA_Integer)optInputInfo->defaultValue;
+
+      /* TA_CallFunc reports a bad period. */
+      return ((period >= 1) && (period <= 100000))? (int)period : 0;
+   }
+
+   return 0;
+}
+
+/* Number of double needed for the temporary buffers of the function
+ * called over startIdx..endIdx (see TA_XXX_Workspace), 0 when none
+ * or when the function has no TA_XXX_Workspace.
+ */
+static int itemWorkspace( const TA_ParamHolderPriv *params,
+                          TA_Integer startIdx, TA_Integer endIdx )
+{
+   const char *name;
+   int size, period;
+
+   name = params->funcInfo->name;
+   if( strcmp( name, "AVGDEV" ) == 0 )
+   {
+      /* Only the tree of TA_MATH_FAST, the same one as the CCI. */
+      period = timePeriod( params );
+      if( (period == 0) || (endIdx < startIdx) || !TA_AVGDEV_USE_TREE(period) )
+         return 0;
+      size = TA_INT_AvgDevTreeWorkspace( period, endIdx-startIdx+1 );
+   }
+   else if( strcmp( name, "CCI" ) == 0 )
+      size = TA_CCI_Workspace( startIdx, endIdx, OPT_IN_INTEGER(0) );
+   else if( strcmp( name, "DEMA" ) == 0 )
+      size = TA_DEMA_Workspace( startIdx, endIdx, OPT_IN_INTEGER(0) );
+   else if( strcmp( name, "TEMA" ) == 0 )
+      size = TA_TEMA_Workspace( startIdx, endIdx, OPT_IN_INTEGER(0) );
+   else if( strcmp( name, "TRIX" ) == 0 )
+      size = TA_TRIX_Workspace( startIdx, endIdx, OPT_IN_INTEGER(0) );
+   else if( strcmp( name, "MA" ) == 0 )
+      size = TA_MA_Workspace( startIdx, endIdx, OPT_IN_INTEGER(0), OPT_IN_MATYPE(1) );
+   else if( strcmp( name, "APO" ) == 0 )
+      size = TA_APO_Workspace( startIdx, endIdx, OPT_IN_INTEGER(0), OPT_IN_INTEGER(1),
+                               OPT_IN_MATYPE(2) );
+   else if( strcmp( name, "PPO" ) == 0 )
+      size = TA_PPO_Workspace( startIdx, endIdx, OPT_IN_INTEGER(0), OPT_IN_INTEGER(1),
+                               OPT_IN_MATYPE(2) );
+   else if( strcmp( name, "MACD" ) == 0 )
+      size = TA_MACD_Workspace( startIdx, endIdx, OPT_IN_INTEGER(0), OPT_IN_INTEGER(1),
+                                OPT_IN_INTEGER(2) );
+   else if( strcmp( name, "MACDEXT" ) == 0 )
+      size = TA_MACDEXT_Workspace( startIdx, endIdx, OPT_IN_INTEGER(0), OPT_IN_MATYPE(1),
+                                   OPT_IN_INTEGER(2), OPT_IN_MATYPE(3),
+                                   OPT_IN_INTEGER(4), OPT_IN_MATYPE(5) );
+   else if( strcmp( name, "STOCHF" ) == 0 )
+      size = TA_STOCHF_Workspace( startIdx, endIdx, OPT_IN_INTEGER(0), OPT_IN_INTEGER(1),
+                                  OPT_IN_MATYPE(2) );
+   else if( strcmp( name, "STOCH" ) == 0 )
+      size = TA_STOCH_Workspace( startIdx, endIdx, OPT_IN_INTEGER(0), OPT_IN_INTEGER(1),
+                                 OPT_IN_MATYPE(2), OPT_IN_INTEGER(3), OPT_IN_MATYPE(4) );
+   else if( strcmp( name, "STOCHRSI" ) == 0 )
+      size = TA_STOCHRSI_Workspace( startIdx, endIdx, OPT_IN_INTEGER(0), OPT_IN_INTEGER(1),
+                                    OPT_IN_INTEGER(2), OPT_IN_MATYPE(3) );
+   else if( strcmp( name, "NATR" ) == 0 )
+      size = TA_NATR_Workspace( startIdx, endIdx, OPT_IN_INTEGER(0) );
+   else if( strcmp( name, "ADXR" ) == 0 )
+      size = TA_ADXR_Workspace( startIdx, endIdx, OPT_IN_INTEGER(0) );
+   else if( strcmp( name, "MFI" ) == 0 )
+      size = TA_MFI_Workspace( startIdx, endIdx, OPT_IN_INTEGER(0) );
+   else
+      size = 0;
+
+   /* Negative for the bad parameters, reported by the function. */
+   return size > 0? size : 0;
+}
+
+/* Allocate (with the allocator of the caller) a slice of 'size'
+ * double for each thread. Without it, the temporary buffers are
+ * simply taken from the heap.
+ */
+static void allocWorkspace( TA_ParallelJob *job, unsigned int nbThread, int size )
+{
+   job->workspace     = NULL;
+   job->workspaceSize = 0;
+
+   if( (size <= 0) || ((size_t)size > ((size_t)-1)/sizeof(double)/nbThread) )
+      return;
+
+   job->workspace = (double *)TA_Malloc( sizeof(double)*(size_t)size*nbThread );
+   if( job->workspace )
+      job->workspaceSize = size;
+}
+
+static TA_RetCode runChunk( const TA_ParallelJob *job, int chunk )
+{
+   TA_ParamHolderPriv params;
+   TA_ParamHolderOutput out[TA_PARALLEL_MAX_OUTPUT];
+   TA_Integer startIdx, endIdx, offset, begIdx, nbElement;
+   TA_RetCode retCode;
+   unsigned int i;
+   TA_FUNC_STATS_DECL
+
+   startIdx = job->outBegIdx+chunk*job->chunkSize;
+   endIdx   = startIdx+job->chunkSize-1;
+   if( endIdx > job->endIdx )
+      endIdx = job->endIdx;
+
+   /* Same parameters, but the outputs start where this
+    * chunk goes in the outputs of the caller.
+    */
+   params = *job->params;
+   offset = startIdx-job->outBegIdx;
+   for( i=0; i < params.funcInfo->nbOutput; i++ )
+   {
+      out[i] = job->params->out[i];
+      if( out[i].outputInfo->type == TA_Output_Integer )
+         out[i].data.outInteger += offset;
+      else
+         out[i].data.outReal += offset;
+   }
+   params.out = out;
+
+   TA_FUNC_STATS_BEGIN
+   retCode = (*job->function)( &params, startIdx, endIdx, &begIdx, &nbElement );
+   TA_FUNC_STATS_END( (const TA_FuncDef *)params.funcInfo->handle, startIdx, endIdx )
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   if( (begIdx != startIdx) || (nbElement != endIdx-startIdx+1) )
+      return TA_INTERNAL_ERROR(183);
+
+   return TA_SUCCESS;
+}
+
+static TA_RetCode runSymbol( const TA_ParallelJob *job, int item )
+{
+   TA_BatchSymbol *symbol;
+   TA_FUNC_STATS_DECL
+
+   symbol = &job->symbol[job->order[item].idx];
+   symbol->outBegIdx    = 0;
+   symbol->outNbElement = 0;
+
+   if( !symbol->out || (!symbol->in && (job->params->funcInfo->nbInput != 0)) )
+   {
+      symbol->retCode = TA_BAD_PARAM;
+      return TA_BAD_PARAM;
+   }
+
+   /* Same optional inputs, with the inputs and
+    * outputs of this symbol.
+    */
+   TA_FUNC_STATS_BEGIN
+   symbol->retCode = (*job->direct)( job->params, symbol->in, symbol->out,
+                                     symbol->startIdx, symbol->endIdx,
+                                     &symbol->outBegIdx, &symbol->outNbElement );
+   TA_FUNC_STATS_END( (const TA_FuncDef *)job->params->funcInfo->handle,
+                      symbol->startIdx, symbol->endIdx )
+
+   return symbol->retCode;
+}
+
+static int compareOrder( const void *a, const void *b )
+{
+   const TA_BatchOrder *orderA, *orderB;
+
+   orderA = (const TA_BatchOrder *)a;
+   orderB = (const TA_BatchOrder *)b;
+
+   if( orderA->nbBars != orderB->nbBars )
+      return orderA->nbBars > orderB->nbBars? -1 : 1;
+
+   /* Same order as given by the caller. */
+   return orderA->idx < orderB->idx? -1 : (orderA->idx > orderB->idx);
+}
+
+/* Same as compareOrder, within each queue. */
+static int compareQueue( const void *a, const void *b )
+{
+   const TA_BatchOrder *orderA, *orderB;
+
+   orderA = (const TA_BatchOrder *)a;
+   orderB = (const TA_BatchOrder *)b;
+
+   if( orderA->queue != orderB->queue )
+      return orderA->queue < orderB->queue? -1 : 1;
+
+   return compareOrder( a, b );
+}
+
+/* Put each symbol (sorted longest first) in the queue with the fewest
+ * bars so far, then sort the symbols by queue. The symbols of queue i
+ * are then from queueFirst[i] to queueFirst[i+1]-1, still the longest
+ * first.
+ */
+static TA_RetCode balanceOrder( TA_BatchOrder *order, unsigned int nbSymbol,
+                                unsigned int nbQueue, int *queueFirst )
+{
+   double *nbQueueBars;
+   unsigned int i, j, best;
+
+   nbQueueBars = (double *)TA_Malloc( sizeof(double)*nbQueue );
+   if( !nbQueueBars )
+      return TA_ALLOC_ERR;
+
+   for( j=0; j < nbQueue; j++ )
+      nbQueueBars[j] = 0.0;
+
+   for( i=0; i < nbSymbol; i++ )
+   {
+      best = 0;
+      for( j=1; j < nbQueue; j++ )
+      {
+         if( nbQueueBars[j] < nbQueueBars[best] )
+            best = j;
+      }
+
+      /* A symbol without bars still costs a call. */
+      order[i].queue = best;
+      if( order[i].nbBars > 0 )
+         nbQueueBars[best] += (double)order[i].nbBars;
+      else
+         nbQueueBars[best] += 1.0;
+   }
+
+   TA_Free( nbQueueBars );
+
+   qsort( order, nbSymbol, sizeof(TA_BatchOrder), compareQueue );
+
+   j = 0;
+   for( i=0; i < nbSymbol; i++ )
+   {
+      while( j <= order[i].queue )
+         queueFirst[j++] = (int)i;
+   }
+   while( j <= nbQueue )
+      queueFirst[j++] = (int)nbSymbol;
+
+   return TA_SUCCESS;
+}
+
+/* Do the job with all the threads of the pool,
+ * or only with the caller when there is no pool.
+ */
+static void runParallel( TA_ThreadPool *pool, TA_ParallelJob *job )
+{
+   TA_Workspace workspace, *prevWorkspace;
+   TA_RetCode retCode;
+   unsigned int i;
+   int item;
+
+   if( !pool || (pool->nbThread < 2) )
+   {
+      prevWorkspace = setWorkspace( job, 0, &workspace );
+      for( item=0; item < job->nbItem; item++ )
+      {
+         retCode = doItem( job, item );
+         if( retCode != TA_SUCCESS )
+            job->retCode = retCode;
+      }
+      TA_ThreadWorkspace = prevWorkspace;
+      return;
+   }
+
+   TA_MUTEX_LOCK( &pool->callMutex );
+
+   /* Each thread gets consecutive items, the same number in each
+    * queue unless given by the job. No worker uses the queues until
+    * the job is given below.
+    */
+   for( i=0; i < pool->nbThread; i++ )
+   {
+      if( job->queueFirst )
+      {
+         pool->queue[i].head = job->queueFirst[i];
+         pool->queue[i].tail = job->queueFirst[i+1];
+      }
+      else
+      {
+         pool->queue[i].head = (int)(((unsigned int)job->nbItem*i)/pool->nbThread);
+         pool->queue[i].tail = (int)(((unsigned int)job->nbItem*(i+1))/pool->nbThread);
+      }
+   }
+
+   TA_MUTEX_LOCK( &pool->mutex );
+   pool->job = job;
+   pool->jobId++;
+   TA_COND_BROADCAST( &pool->workCond );
+   TA_MUTEX_UNLOCK( &pool->mutex );
+
+   runJob( pool, job, 0 );
+
+   /* All the queues are empty, wait for the items
+    * still being done by the other threads.
+    */
+   TA_MUTEX_LOCK( &pool->mutex );
+   while( job->nbWorker != 0 )
+      TA_COND_WAIT( &pool->doneCond, &pool->mutex );
+   pool->job = NULL;
+   TA_MUTEX_UNLOCK( &pool->mutex );
+
+   TA_MUTEX_UNLOCK( &pool->callMutex );
+}
+
+/* Do the items of the queue of thread 'self', then the ones
+ * stolen from the other threads, until all the queues are empty.
+ */
+static void runJob( TA_ThreadPool *pool, TA_ParallelJob *job, unsigned int self )
+{
+   TA_Workspace workspace, *prevWorkspace;
+   TA_WorkQueue *queue;
+   TA_RetCode retCode;
+   int item;
+
+   prevWorkspace = setWorkspace( job, self, &workspace );
+
+   queue = &pool->queue[self];
+   for( ;; )
+   {
+      TA_MUTEX_LOCK( &queue->mutex );
+      item = -1;
+      if( queue->head < queue->tail )
+         item = queue->head++;
+      TA_MUTEX_UNLOCK( &queue->mutex );
+
+      if( item < 0 )
+      {
+         if( !stealItems( pool, self ) )
+            break;
+         continue;
+      }
+
+      retCode = doItem( job, item );
+      if( retCode != TA_SUCCESS )
+      {
+         TA_MUTEX_LOCK( &pool->mutex );
+         job->retCode = retCode;
+         TA_MUTEX_UNLOCK( &pool->mutex );
+      }
+   }
+
+   TA_ThreadWorkspace = prevWorkspace;
+}
+
+/* Make the slice of thread 'self' the workspace of the calling
+ * thread, when the job has one. Returns the previous workspace.
+ */
+static TA_Workspace *setWorkspace( const TA_ParallelJob *job, unsigned int self,
+                                   TA_Workspace *workspace )
+{
+   TA_Workspace *prevWorkspace;
+
+   prevWorkspace = TA_ThreadWorkspace;
+   if( job->workspace )
+   {
+      workspace->begin = job->workspace+(size_t)self*(size_t)job->workspaceSize;
+      workspace->next  = workspace->begin;
+      workspace->end   = workspace->begin+job->workspaceSize;
+      TA_ThreadWorkspace = workspace;
+   }
+
+   return prevWorkspace;
+}
+
+static TA_RetCode doItem( const TA_ParallelJob *job, int item )
+{
+   /* Each item has the whole slice of the thread. */
+   if( job->workspace )
+      TA_ThreadWorkspace->next = TA_ThreadWorkspace->begin;
+
+   return (*job->runItem)( job, item );
+}
+
+/* Move the second half of the items left in the queue of another
+ * thread into the (empty) queue of thread 'self'. Returns 0 when
+ * all the queues are empty.
+ */
+static int stealItems( TA_ThreadPool *pool, unsigned int self )
+{
+   TA_WorkQueue *victim;
+   unsigned int i;
+   int head, tail;
+
+   for( i=1; i < pool->nbThread; i++ )
+   {
+      victim = &pool->queue[(self+i)%pool->nbThread];
+
+      TA_MUTEX_LOCK( &victim->mutex );
+      tail = victim->tail;
+      head = victim->head+(victim->tail-victim->head)/2;
+      victim->tail = head;
+      TA_MUTEX_UNLOCK( &victim->mutex );
+
+      if( head < tail )
+      {
+         TA_MUTEX_LOCK( &pool->queue[self].mutex );
+         pool->queue[self].head = head;
+         pool->queue[self].tail = tail;
+         TA_MUTEX_UNLOCK( &pool->queue[self].mutex );
+         return 1;
+      }
+   }
+
+   return 0;
+}
+
+static TA_THREAD_FUNC workerThread( void *arg )
+{
+   TA_ThreadPool *pool;
+   TA_ParallelJob *job;
+   const TA_Context *prevContext;
+   const TA_Allocator *prevAllocator;
+   unsigned int jobId, self;
+
+   pool  = ((TA_WorkQueue *)arg)->pool;
+   self  = (unsigned int)((TA_WorkQueue *)arg-pool->queue);
+   jobId = 0;
+
+   TA_MUTEX_LOCK( &pool->mutex );
+   for( ;; )
+   {
+      while( !pool->shutdown && (!pool->job || (pool->jobId == jobId)) )
+         TA_COND_WAIT( &pool->workCond, &pool->mutex );
+
+      if( pool->shutdown )
+         break;
+
+      job   = pool->job;
+      jobId = pool->jobId;
+      job->nbWorker++;
+      TA_MUTEX_UNLOCK( &pool->mutex );
+
+      /* Same settings as the caller. Only the caller can allocate
+       * from its TA_Arena, the allocator shared by all the threads
+       * (or malloc) is used instead.
+       */
+      prevContext   = TA_ThreadContext;
+      prevAllocator = TA_GetThreadAllocator();
+      TA_ThreadContext = job->context;
+      if( !TA_INT_AllocatorIsOwned( job->allocator ) )
+         TA_SetThreadAllocator( job->allocator );
+      runJob( pool, job, self );
+      TA_SetThreadAllocator( prevAllocator );
+      TA_ThreadContext = prevContext;
+
+      TA_MUTEX_LOCK( &pool->mutex );
+      if( --job->nbWorker == 0 )
+         TA_COND_BROADCAST( &pool->doneCond );
+   }
+   TA_MUTEX_UNLOCK( &pool->mutex );
+
+   return TA_THREAD_RETURN;
+}
+
+static unsigned int nbCore( void )
+{
+   #if defined( _WIN32 )
+      SYSTEM_INFO info;
+
+      GetSystemInfo( &info );
+      return info.dwNumberOfProcessors > 0? (unsigned int)info.dwNumberOfProcessors : 1;
+   #else
+      long nb;
+
+      nb = sysconf( _SC_NPROCESSORS_ONLN );
+      return nb > 0? (unsigned int)nb : 1;
+   #endif
+}
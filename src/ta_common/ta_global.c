@@ -48,6 +48,7 @@
  *              and call to TA_RestoreCandleDefaultSettings in TA_Initialize
  *  041106 MF   Add prefix to theGlobals to avoid clash with other libs.
  *  040707 MF   Change global initialization to eliminate Mac OS X link error.
+ *  101826 MF   Add TA_Context for per-thread settings.
  */
 
 /* Description:
@@ -63,6 +64,7 @@
 #include "ta_magic_nb.h"
 #include "ta_global.h"
 #include "ta_func.h"
+#include "ta_memory.h"
 
 /**** External functions declarations. ****/
 /* None */
@@ -73,15 +75,24 @@
 /**** Global variables definitions.    ****/
 
 /* The entry point for all globals */
-TA_LibcPriv ta_theGlobals = {0,{{0,0,0}},0,0,0,0,(TA_Compatibility)0,{0},{{(TA_CandleSettingType)0,(TA_RangeType)0,0,0}}};
+TA_LibcPriv ta_theGlobals = {0,{{0,0,0}},0,0,0,0,{0,(TA_Compatibility)0,(TA_MathMode)0,{0},{{(TA_CandleSettingType)0,(TA_RangeType)0,0,0}}}};
 
 TA_LibcPriv *TA_Globals = &ta_theGlobals;
 
+TA_THREAD_LOCAL const TA_Context *TA_ThreadContext = &ta_theGlobals.context;
+
 /**** Local declarations.              ****/
 /* None */
 
 /**** Local functions declarations.    ****/
-/* None */
+static TA_RetCode setCandleSettings( TA_CandleSetting *candleSettings,
+                                     TA_CandleSettingType settingType,
+                                     TA_RangeType rangeType,
+                                     int avgPeriod,
+                                     double factor );
+
+static TA_RetCode restoreCandleDefaultSettings( TA_CandleSetting *candleSettings,
+                                                TA_CandleSettingType settingType );
 
 /**** Local variables definitions.     ****/
 /* None */
@@ -94,6 +105,7 @@ TA_RetCode TA_Initialize( void )
     */
    memset( TA_Globals, 0, sizeof( TA_LibcPriv ) );
    TA_Globals->magicNb = TA_LIBC_PRIV_MAGIC_NB;
+   TA_Globals->context.magicNb = TA_CONTEXT_MAGIC_NB;
 
    /*** At this point, TA_Shutdown can be called to clean-up. ***/
 
@@ -119,19 +131,210 @@ TA_RetCode TA_SetCandleSettings( TA_CandleSettingType settingType,
                                  int avgPeriod,
                                  double factor )
 {
-    /*printf("setcdlset:%d  ",settingType);*/
+   return setCandleSettings( TA_Globals->context.candleSettings,
+                             settingType, rangeType, avgPeriod, factor );
+}
+
+TA_RetCode TA_RestoreCandleDefaultSettings( TA_CandleSettingType settingType )
+{
+   return restoreCandleDefaultSettings( TA_Globals->context.candleSettings, settingType );
+}
+
+TA_RetCode TA_ContextAlloc( TA_Context **context )
+{
+   TA_Context *newContext;
+
+   if( !context )
+      return TA_BAD_PARAM;
+
+   *context = NULL;
+
+   if( TA_Globals->magicNb != TA_LIBC_PRIV_MAGIC_NB )
+      return TA_LIB_NOT_INITIALIZE;
+
+   newContext = (TA_Context *)TA_Malloc( sizeof( TA_Context ) );
+   if( !newContext )
+      return TA_ALLOC_ERR;
+
+   /* Start with the settings currently used by all threads. */
+   *newContext = TA_Globals->context;
+   newContext->magicNb = TA_CONTEXT_MAGIC_NB;
+
+   *context = newContext;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ContextFree( TA_Context *context )
+{
+   if( context )
+   {
+      if( context->magicNb != TA_CONTEXT_MAGIC_NB )
+         return TA_INVALID_HANDLE;
+
+      /* Invalidate the object in case of a dangling pointer. */
+      memset( context, 0, sizeof( TA_Context ) );
+      TA_Free( context );
+   }
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ContextSetUnstablePeriod( TA_Context   *context,
+                                        TA_FuncUnstId id,
+                                        unsigned int  unstablePeriod )
+{
+   int i;
+
+   if( !context || (context->magicNb != TA_CONTEXT_MAGIC_NB) )
+      return TA_INVALID_HANDLE;
+
+   if( id > TA_FUNC_UNST_ALL )
+      return TA_BAD_PARAM;
+
+   if( id == TA_FUNC_UNST_ALL )
+   {
+      for( i=0; i < (int)TA_FUNC_UNST_ALL; i++ )
+         context->unstablePeriod[i] = unstablePeriod;
+   }
+   else
+      context->unstablePeriod[id] = unstablePeriod;
+
+   return TA_SUCCESS;
+}
+
+unsigned int TA_ContextGetUnstablePeriod( const TA_Context *context,
+                                          TA_FuncUnstId id )
+{
+   if( !context || (context->magicNb != TA_CONTEXT_MAGIC_NB) )
+      return 0;
+
+   if( id >= TA_FUNC_UNST_ALL )
+      return 0;
+
+   return context->unstablePeriod[id];
+}
+
+TA_RetCode TA_ContextSetCompatibility( TA_Context *context,
+                                       TA_Compatibility value )
+{
+   if( !context || (context->magicNb != TA_CONTEXT_MAGIC_NB) )
+      return TA_INVALID_HANDLE;
+
+   context->compatibility = value;
+
+   return TA_SUCCESS;
+}
+
+TA_Compatibility TA_ContextGetCompatibility( const TA_Context *context )
+{
+   if( !context || (context->magicNb != TA_CONTEXT_MAGIC_NB) )
+      return TA_COMPATIBILITY_DEFAULT;
+
+   return context->compatibility;
+}
+
+TA_RetCode TA_ContextSetMathMode( TA_Context *context, TA_MathMode mode )
+{
+   if( !context || (context->magicNb != TA_CONTEXT_MAGIC_NB) )
+      return TA_INVALID_HANDLE;
+
+   if( (mode != TA_MATH_STRICT) && (mode != TA_MATH_FAST) )
+      return TA_BAD_PARAM;
+
+   context->mathMode = mode;
+
+   return TA_SUCCESS;
+}
+
+TA_MathMode TA_ContextGetMathMode( const TA_Context *context )
+{
+   if( !context || (context->magicNb != TA_CONTEXT_MAGIC_NB) )
+      return TA_MATH_STRICT;
+
+   return context->mathMode;
+}
+
+TA_RetCode TA_SetMathMode( TA_MathMode mode )
+{
+   if( (mode != TA_MATH_STRICT) && (mode != TA_MATH_FAST) )
+      return TA_BAD_PARAM;
+
+   TA_Globals->context.mathMode = mode;
+
+   return TA_SUCCESS;
+}
+
+TA_MathMode TA_GetMathMode( void )
+{
+   return TA_Globals->context.mathMode;
+}
+
+TA_RetCode TA_ContextSetCandleSettings( TA_Context *context,
+                                        TA_CandleSettingType settingType,
+                                        TA_RangeType rangeType,
+                                        int avgPeriod,
+                                        double factor )
+{
+   if( !context || (context->magicNb != TA_CONTEXT_MAGIC_NB) )
+      return TA_INVALID_HANDLE;
+
+   return setCandleSettings( context->candleSettings,
+                             settingType, rangeType, avgPeriod, factor );
+}
+
+TA_RetCode TA_ContextRestoreCandleDefaultSettings( TA_Context *context,
+                                                   TA_CandleSettingType settingType )
+{
+   if( !context || (context->magicNb != TA_CONTEXT_MAGIC_NB) )
+      return TA_INVALID_HANDLE;
+
+   return restoreCandleDefaultSettings( context->candleSettings, settingType );
+}
+
+TA_RetCode TA_SetThreadContext( const TA_Context *context )
+{
+   if( !context )
+   {
+      /* Back to the settings shared by all threads. */
+      TA_ThreadContext = &TA_Globals->context;
+      return TA_SUCCESS;
+   }
+
+   if( context->magicNb != TA_CONTEXT_MAGIC_NB )
+      return TA_INVALID_HANDLE;
+
+   TA_ThreadContext = context;
+
+   return TA_SUCCESS;
+}
+
+const TA_Context *TA_GetThreadContext( void )
+{
+   if( TA_ThreadContext == &TA_Globals->context )
+      return NULL;
+
+   return TA_ThreadContext;
+}
+
+/**** Local functions definitions.     ****/
+static TA_RetCode setCandleSettings( TA_CandleSetting *candleSettings,
+                                     TA_CandleSettingType settingType,
+                                     TA_RangeType rangeType,
+                                     int avgPeriod,
+                                     double factor )
+{
     if( settingType >= TA_AllCandleSettings )
         return TA_BAD_PARAM;
-    TA_Globals->candleSettings[settingType].settingType = settingType;
-    TA_Globals->candleSettings[settingType].rangeType = rangeType;
-    TA_Globals->candleSettings[settingType].avgPeriod = avgPeriod;
-    TA_Globals->candleSettings[settingType].factor = factor;
-    /*printf("cdlset: %d %d %d %f\n",TA_Globals->candleSettings[settingType].settingType,TA_Globals->candleSettings[settingType].rangeType,
-        TA_Globals->candleSettings[settingType].avgPeriod,TA_Globals->candleSettings[settingType].factor);*/
+    candleSettings[settingType].settingType = settingType;
+    candleSettings[settingType].rangeType = rangeType;
+    candleSettings[settingType].avgPeriod = avgPeriod;
+    candleSettings[settingType].factor = factor;
     return TA_SUCCESS;
 }
 
-TA_RetCode TA_RestoreCandleDefaultSettings( TA_CandleSettingType settingType )
+static TA_RetCode restoreCandleDefaultSettings( TA_CandleSetting *candleSettings,
+                                                TA_CandleSettingType settingType )
 {
     const TA_CandleSetting TA_CandleDefaultSettings[] = {
         /* real body is long when it's longer than the average of the 10 previous candles' real body */
@@ -166,13 +369,8 @@ TA_RetCode TA_RestoreCandleDefaultSettings( TA_CandleSettingType settingType )
         return TA_BAD_PARAM;
     if( settingType == TA_AllCandleSettings )
         for( i = 0; i < TA_AllCandleSettings; ++i )
-            TA_Globals->candleSettings[i] = TA_CandleDefaultSettings[i];
+            candleSettings[i] = TA_CandleDefaultSettings[i];
     else
-        TA_Globals->candleSettings[settingType] = TA_CandleDefaultSettings[settingType];
+        candleSettings[settingType] = TA_CandleDefaultSettings[settingType];
     return TA_SUCCESS;
 }
-
-/**** Local functions definitions.     ****/
-/* None */
-
-
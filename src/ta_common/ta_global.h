@@ -17,6 +17,32 @@ typedef struct {
     double                  factor;
 } TA_CandleSetting;
 
+/* This is the hidden implementation of TA_Context.
+ * Holds all the settings changing the output of the TA functions.
+ */
+struct TA_Context
+{
+   unsigned int magicNb; /* Unique identifier of this object. */
+
+   /* For handling the compatibility with other software */
+   TA_Compatibility compatibility;
+
+   /* Precision of the math transforms. */
+   TA_MathMode mathMode;
+
+   /* For handling the unstable period of some TA function. */
+   unsigned int unstablePeriod[TA_FUNC_UNST_ALL];
+
+   /* For handling the candlestick global settings */
+   TA_CandleSetting candleSettings[TA_AllCandleSettings];
+};
+
+#if defined( _MSC_VER )
+   #define TA_THREAD_LOCAL __declspec(thread)
+#else
+   #define TA_THREAD_LOCAL __thread
+#endif
+
 /* This interface is used exclusively INTERNALY to the TA-LIB.
  * There is nothing for the end-user here ;->
  */
@@ -100,14 +126,8 @@ typedef struct
 
    const char *localCachePath;
 
-   /* For handling the compatibility with other software */
-   TA_Compatibility compatibility;
-
-   /* For handling the unstable period of some TA function. */
-   unsigned int unstablePeriod[TA_FUNC_UNST_ALL];
-
-   /* For handling the candlestick global settings */
-   TA_CandleSetting candleSettings[TA_AllCandleSettings];
+   /* The settings used by threads without a TA_Context. */
+   TA_Context context;
 
 } TA_LibcPriv;
 
@@ -116,4 +136,17 @@ typedef struct
  */
 extern TA_LibcPriv *TA_Globals;
 
+/* The settings used by the TA functions called from the current
+ * thread. Points on TA_Globals->context unless TA_SetThreadContext
+ * was called with a TA_Context.
+ */
+extern TA_THREAD_LOCAL const TA_Context *TA_ThreadContext;
+
+#if defined( TA_FUNC_STATS )
+/* Number of TA_Malloc done by the current thread
+ * (for TA_GetFuncStats, see ta_func_stats.c).
+ */
+extern TA_THREAD_LOCAL unsigned long long TA_ThreadNbAlloc;
+#endif
+
 #endif
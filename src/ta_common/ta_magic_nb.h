@@ -27,5 +27,9 @@
 #define TA_PMREPORT_MAGIC_NB            0xA210B210
 #define TA_TRADEREPORT_MAGIC_NB         0xA211B211
 #define TA_HISTORY_MAGIC_NB             0xA212B212
+#define TA_CONTEXT_MAGIC_NB             0xA213B213
+#define TA_ARENA_MAGIC_NB               0xA214B214
+#define TA_THREAD_POOL_MAGIC_NB         0xA215B215
+#define TA_CALL_PLAN_MAGIC_NB           0xA216B216
 
 #endif
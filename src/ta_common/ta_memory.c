@@ -0,0 +1,505 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ */
+
+/* Description:
+ *   Memory allocation of TA-Lib (TA_Malloc, TA_Realloc and TA_Free).
+ *
+ *   The memory comes from the allocator of the calling thread
+ *   (TA_SetThreadAllocator), else from the allocator shared by all
+ *   threads (TA_SetAllocator), else from malloc/free.
+ *
+ *   Each allocation is preceded by a header keeping the allocator
+ *   used and the size. TA_Free gives the memory back to the same
+ *   allocator even if the allocator of the thread was changed since.
+ *
+ *   TA_Arena is an allocator for a single thread. The sizes are
+ *   rounded up to a power of 2, and the memory freed is kept in one
+ *   free list per size for being re-used by the next allocations of
+ *   that size. New memory is taken sequentially from large blocks,
+ *   which are given back to the system only by TA_ArenaFree.
+ *
+ *   The thread doing the first allocation owns the arena, the
+ *   allocations from any other thread fail. The free lists are used
+ *   only by the owner. Memory freed by another thread is pushed on a
+ *   lock-free list, which the owner moves to its free lists when it
+ *   needs more memory.
+ */
+
+/**** Headers ****/
+#include <stdlib.h>
+#include <string.h>
+
+#include "ta_common.h"
+#include "ta_magic_nb.h"
+#include "ta_global.h"
+#include "ta_memory.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+#if defined( TA_FUNC_STATS )
+TA_THREAD_LOCAL unsigned long long TA_ThreadNbAlloc = 0;
+#endif
+
+/**** Local declarations.              ****/
+
+/* The pointers shared between the threads are read and written
+ * atomically (the volatile of Visual Studio is atomic).
+ */
+#if defined( _MSC_VER )
+   #include <windows.h>
+   #define TA_SHARED_PTR(type,name)       type * volatile name
+   #define TA_PTR_LOAD(ptr)               (*(ptr))
+   #define TA_PTR_STORE(ptr,val)          (*(ptr) = (val))
+   #define TA_PTR_EXCHANGE(ptr,val)       InterlockedExchangePointer( (PVOID volatile *)(ptr), (PVOID)(val) )
+   #define TA_PTR_CAS(ptr,expected,val)   (InterlockedCompareExchangePointer( (PVOID volatile *)(ptr), (PVOID)(val), (PVOID)(expected) ) == (PVOID)(expected))
+   #define TA_SHARED_ID(name)             LONGLONG volatile name
+   #define TA_ID_LOAD(ptr)                (*(ptr))
+   #define TA_ID_CAS(ptr,expected,val)    (InterlockedCompareExchange64( (ptr), (val), (expected) ) == (expected))
+   #define TA_ID_NEXT(ptr)                InterlockedIncrement64( (ptr) )
+#else
+   #define TA_SHARED_PTR(type,name)       type *name
+   #define TA_PTR_LOAD(ptr)               __atomic_load_n( (ptr), __ATOMIC_ACQUIRE )
+   #define TA_PTR_STORE(ptr,val)          __atomic_store_n( (ptr), (val), __ATOMIC_RELEASE )
+   #define TA_PTR_EXCHANGE(ptr,val)       __atomic_exchange_n( (ptr), (val), __ATOMIC_ACQ_REL )
+   #define TA_PTR_CAS(ptr,expected,val)   __atomic_compare_exchange_n( (ptr), &(expected), (val), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE )
+   #define TA_SHARED_ID(name)             long long name
+   #define TA_ID_LOAD(ptr)                __atomic_load_n( (ptr), __ATOMIC_ACQUIRE )
+   #define TA_ID_CAS(ptr,expected,val)    __atomic_compare_exchange_n( (ptr), &(expected), (val), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE )
+   #define TA_ID_NEXT(ptr)                __atomic_add_fetch( (ptr), 1, __ATOMIC_RELAXED )
+#endif
+
+/* Header preceding each allocation. Its size keeps the
+ * alignment of the memory returned by the allocator.
+ */
+typedef union
+{
+   struct
+   {
+      const TA_Allocator *allocator; /* NULL for malloc/free */
+      size_t size;                   /* Size requested. */
+   } info;
+   double align[2];
+} TA_MemHeader;
+
+/* The free lists are for the sizes 2^TA_ARENA_MIN_CLASS
+ * and up (the smallest must hold a pointer).
+ */
+#define TA_ARENA_MIN_CLASS     4
+#define TA_ARENA_NB_CLASS      (sizeof(size_t)*8)
+#define TA_ARENA_DEFAULT_BLOCK (1024*1024)
+
+typedef union TA_ArenaBlock
+{
+   union TA_ArenaBlock *next;
+   double align[2];
+} TA_ArenaBlock;
+
+struct TA_Arena
+{
+   unsigned int magicNb;
+
+   /* Allocator used by TA-Lib, its opaque is this arena. */
+   TA_Allocator allocator;
+
+   size_t blockSize;
+
+   /* All the blocks, and the space not yet used in the current one. */
+   TA_ArenaBlock *block;
+   char *next;
+   char *end;
+
+   /* Memory freed by the owner, by power of 2. */
+   void *freeList[TA_ARENA_NB_CLASS];
+
+   /* Id of the thread owning the arena (see threadId), set by
+    * the first allocation. Zero until then.
+    */
+   TA_SHARED_ID(owner);
+
+   /* Memory freed by the other threads (TA_ArenaRemote). */
+   TA_SHARED_PTR(void,remoteFree);
+};
+
+/* Memory freed by a thread other than the owner. The smallest
+ * size class has room for it.
+ */
+typedef struct
+{
+   void *next;
+   int   sizeClass;
+} TA_ArenaRemote;
+
+/**** Local functions declarations.    ****/
+static void *arenaAlloc( void *opaque, size_t size );
+static void  arenaFree ( void *opaque, void *ptr, size_t size );
+static int   arenaClass( size_t size );
+static TA_ArenaBlock *arenaNewBlock( TA_Arena *arena, size_t size );
+static void  arenaTakeRemote( TA_Arena *arena );
+static long long arenaThreadId( void );
+
+/**** Local variables definitions.     ****/
+static TA_SHARED_PTR(const TA_Allocator,globalAllocator) = NULL;
+static TA_THREAD_LOCAL const TA_Allocator *threadAllocator = NULL;
+
+/* Identifies the calling thread, given by arenaThreadId. The ids are
+ * never re-used, unlike the address of a thread local variable which
+ * can be the same for a thread started after another one exits.
+ */
+static TA_SHARED_ID(lastThreadId) = 0;
+static TA_THREAD_LOCAL long long threadId = 0;
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_SetAllocator( const TA_Allocator *allocator )
+{
+   if( allocator && (!allocator->allocFunc || !allocator->freeFunc) )
+      return TA_BAD_PARAM;
+
+   TA_PTR_STORE( &globalAllocator, allocator );
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_SetThreadAllocator( const TA_Allocator *allocator )
+{
+   if( allocator && (!allocator->allocFunc || !allocator->freeFunc) )
+      return TA_BAD_PARAM;
+
+   threadAllocator = allocator;
+
+   return TA_SUCCESS;
+}
+
+const TA_Allocator *TA_GetThreadAllocator( void )
+{
+   return threadAllocator;
+}
+
+TA_RetCode TA_ArenaAlloc( TA_Arena **arena, size_t blockSize )
+{
+   TA_Arena *newArena;
+
+   if( !arena )
+      return TA_BAD_PARAM;
+
+   *arena = NULL;
+
+   /* The arena is not allocated from itself, simply use malloc. */
+   newArena = (TA_Arena *)malloc( sizeof( TA_Arena ) );
+   if( !newArena )
+      return TA_ALLOC_ERR;
+
+   memset( newArena, 0, sizeof( TA_Arena ) );
+   newArena->magicNb = TA_ARENA_MAGIC_NB;
+   newArena->allocator.allocFunc = arenaAlloc;
+   newArena->allocator.freeFunc  = arenaFree;
+   newArena->allocator.opaque    = newArena;
+   newArena->blockSize = blockSize? blockSize : TA_ARENA_DEFAULT_BLOCK;
+
+   *arena = newArena;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ArenaFree( TA_Arena *arena )
+{
+   TA_ArenaBlock *block, *nextBlock;
+
+   if( !arena )
+      return TA_SUCCESS;
+
+   if( arena->magicNb != TA_ARENA_MAGIC_NB )
+      return TA_INVALID_HANDLE;
+
+   block = arena->block;
+   while( block )
+   {
+      nextBlock = block->next;
+      free( block );
+      block = nextBlock;
+   }
+
+   arena->magicNb = 0;
+   free( arena );
+
+   return TA_SUCCESS;
+}
+
+const TA_Allocator *TA_ArenaGetAllocator( const TA_Arena *arena )
+{
+   if( !arena || (arena->magicNb != TA_ARENA_MAGIC_NB) )
+      return NULL;
+
+   return &arena->allocator;
+}
+
+int TA_INT_AllocatorIsOwned( const TA_Allocator *allocator )
+{
+   return allocator && (allocator->allocFunc == arenaAlloc);
+}
+
+void *TA_INT_Malloc( size_t size )
+{
+   const TA_Allocator *allocator;
+   TA_MemHeader *header;
+
+   if( size > ((size_t)-1)-sizeof(TA_MemHeader) )
+      return NULL;
+
+#if defined( TA_FUNC_STATS )
+   TA_ThreadNbAlloc++;
+#endif
+
+   allocator = threadAllocator? threadAllocator : TA_PTR_LOAD( &globalAllocator );
+   if( allocator )
+      header = (TA_MemHeader *)allocator->allocFunc( allocator->opaque, sizeof(TA_MemHeader)+size );
+   else
+      header = (TA_MemHeader *)malloc( sizeof(TA_MemHeader)+size );
+
+   if( !header )
+      return NULL;
+
+   header->info.allocator = allocator;
+   header->info.size      = size;
+
+   return header+1;
+}
+
+void *TA_INT_Realloc( void *ptr, size_t size )
+{
+   TA_MemHeader *header;
+   void *newPtr;
+
+   if( !ptr )
+      return TA_INT_Malloc( size );
+
+   header = ((TA_MemHeader *)ptr)-1;
+
+   /* Grow in place when everything comes from malloc. */
+   if( !header->info.allocator && !threadAllocator && !TA_PTR_LOAD( &globalAllocator ) )
+   {
+      if( size > ((size_t)-1)-sizeof(TA_MemHeader) )
+         return NULL;
+
+      header = (TA_MemHeader *)realloc( header, sizeof(TA_MemHeader)+size );
+      if( !header )
+         return NULL;
+
+      header->info.size = size;
+      return header+1;
+   }
+
+   newPtr = TA_INT_Malloc( size );
+   if( !newPtr )
+      return NULL;
+
+   memcpy( newPtr, ptr, size < header->info.size? size : header->info.size );
+   TA_INT_Free( ptr );
+
+   return newPtr;
+}
+
+void TA_INT_Free( void *ptr )
+{
+   const TA_Allocator *allocator;
+   TA_MemHeader *header;
+
+   if( !ptr )
+      return;
+
+   header    = ((TA_MemHeader *)ptr)-1;
+   allocator = header->info.allocator;
+   if( allocator )
+      allocator->freeFunc( allocator->opaque, header, sizeof(TA_MemHeader)+header->info.size );
+   else
+      free( header );
+}
+
+/**** Local functions definitions.     ****/
+static int arenaClass( size_t size )
+{
+   int sizeClass;
+
+   sizeClass = TA_ARENA_MIN_CLASS;
+   while( ((size_t)1 << sizeClass) < size )
+      sizeClass++;
+
+   return sizeClass;
+}
+
+static TA_ArenaBlock *arenaNewBlock( TA_Arena *arena, size_t size )
+{
+   TA_ArenaBlock *block;
+
+   block = (TA_ArenaBlock *)malloc( sizeof(TA_ArenaBlock)+size );
+   if( !block )
+      return NULL;
+
+   block->next  = arena->block;
+   arena->block = block;
+
+   return block;
+}
+
+static void arenaTakeRemote( TA_Arena *arena )
+{
+   TA_ArenaRemote *remote, *nextRemote;
+
+   remote = (TA_ArenaRemote *)TA_PTR_EXCHANGE( &arena->remoteFree, NULL );
+   while( remote )
+   {
+      nextRemote = (TA_ArenaRemote *)remote->next;
+      *(void **)remote = arena->freeList[remote->sizeClass];
+      arena->freeList[remote->sizeClass] = remote;
+      remote = nextRemote;
+   }
+}
+
+static long long arenaThreadId( void )
+{
+   if( !threadId )
+      threadId = TA_ID_NEXT( &lastThreadId );
+
+   return threadId;
+}
+
+static void *arenaAlloc( void *opaque, size_t size )
+{
+   TA_Arena *arena;
+   TA_ArenaBlock *block;
+   long long owner, self;
+   size_t classSize;
+   void *ptr;
+   int sizeClass;
+
+   arena = (TA_Arena *)opaque;
+
+   /* Only the owner allocates. */
+   self  = arenaThreadId();
+   owner = TA_ID_LOAD( &arena->owner );
+   if( !owner )
+   {
+      (void)TA_ID_CAS( &arena->owner, owner, self );
+      owner = TA_ID_LOAD( &arena->owner );
+   }
+   if( owner != self )
+      return NULL;
+
+   if( size > (((size_t)-1) >> 1) )
+      return NULL;
+
+   sizeClass = arenaClass( size );
+   classSize = (size_t)1 << sizeClass;
+
+   /* Re-use the memory freed first. */
+   ptr = arena->freeList[sizeClass];
+   if( !ptr && TA_PTR_LOAD( &arena->remoteFree ) )
+   {
+      arenaTakeRemote( arena );
+      ptr = arena->freeList[sizeClass];
+   }
+   if( ptr )
+   {
+      arena->freeList[sizeClass] = *(void **)ptr;
+      return ptr;
+   }
+
+   if( classSize > (size_t)(arena->end-arena->next) )
+   {
+      if( classSize > arena->blockSize )
+      {
+         /* Its own block, the current block is still used
+          * for the smaller sizes.
+          */
+         block = arenaNewBlock( arena, classSize );
+         return block? (void *)(block+1) : NULL;
+      }
+
+      block = arenaNewBlock( arena, arena->blockSize );
+      if( !block )
+         return NULL;
+
+      arena->next = (char *)(block+1);
+      arena->end  = arena->next+arena->blockSize;
+   }
+
+   ptr = arena->next;
+   arena->next += classSize;
+
+   return ptr;
+}
+
+static void arenaFree( void *opaque, void *ptr, size_t size )
+{
+   TA_Arena *arena;
+   TA_ArenaRemote *remote;
+   void *head;
+   int sizeClass;
+
+   arena = (TA_Arena *)opaque;
+
+   sizeClass = arenaClass( size );
+   if( TA_ID_LOAD( &arena->owner ) == arenaThreadId() )
+   {
+      *(void **)ptr = arena->freeList[sizeClass];
+      arena->freeList[sizeClass] = ptr;
+      return;
+   }
+
+   /* Freed by another thread, the owner takes it back later. */
+   remote = (TA_ArenaRemote *)ptr;
+   remote->sizeClass = sizeClass;
+   do
+   {
+      head = TA_PTR_LOAD( &arena->remoteFree );
+      remote->next = head;
+   } while( !TA_PTR_CAS( &arena->remoteFree, head, remote ) );
+}
@@ -8,13 +8,30 @@
 
    #include <stdlib.h>
 
-   /* Interface macros */
-   #define TA_Malloc(a)       malloc(a)
-   #define TA_Realloc(a,b)    realloc((a),(b))
-   #define TA_Free(a)         free(a)
+   /* Interface macros (see TA_SetAllocator in ta_common.h) */
+   #define TA_Malloc(a)       TA_INT_Malloc(a)
+   #define TA_Realloc(a,b)    TA_INT_Realloc((a),(b))
+   #define TA_Free(a)         TA_INT_Free(a)
 
    #define FREE_IF_NOT_NULL(x) { if((x)!=NULL) {TA_Free((void *)(x)); (x)=NULL;} }
 
+   void *TA_INT_Malloc ( size_t size );
+   void *TA_INT_Realloc( void *ptr, size_t size );
+   void  TA_INT_Free   ( void *ptr );
+
+   /* Non-zero when only the thread owning the allocator can
+    * allocate from it (a TA_Arena).
+    */
+   int TA_INT_AllocatorIsOwned( const TA_Allocator *allocator );
+
+   /* Temporary buffers needed while a TA function executes.
+    * Taken from the workspace provided by the caller when there
+    * is one and it has enough space left (see TA_XXX_WS in
+    * ta_func_ext.h), else from the heap.
+    */
+   void *TA_INT_TempAlloc( size_t size );
+   void  TA_INT_TempFree ( void *ptr );
+
 #endif /* !defined(_MANAGED) && !defined( _JAVA ) && !defined( _RUST )*/
 
 
@@ -56,11 +73,11 @@
 #else
    #define ARRAY_VTYPE_REF(type,name)             type *name
    #define ARRAY_VTYPE_LOCAL(type,name,size)      type name[size]
-   #define ARRAY_VTYPE_ALLOC(type,name,size)      name = (type *)TA_Malloc( sizeof(type)*(size))
+   #define ARRAY_VTYPE_ALLOC(type,name,size)      name = (type *)TA_INT_TempAlloc( sizeof(type)*(size))
    #define ARRAY_VTYPE_COPY(type,dest,src,size)   memcpy(dest,src,sizeof(type)*(size))
    #define ARRAY_VTYPE_MEMMOVE(type,dest,destIdx,src,srcIdx,size) memmove( &dest[destIdx], &src[srcIdx], (size)*sizeof(type) )
-   #define ARRAY_VTYPE_FREE(type,name)            TA_Free(name)
-   #define ARRAY_VTYPE_FREE_COND(type,cond,name)  if( cond ){ TA_Free(name); }
+   #define ARRAY_VTYPE_FREE(type,name)            TA_INT_TempFree(name)
+   #define ARRAY_VTYPE_FREE_COND(type,cond,name)  if( cond ){ TA_INT_TempFree(name); }
 #endif
 
 /* ARRAY : Macros to manipulate arrays of double. */
@@ -101,6 +118,9 @@
  *
  * Depending of the language/platform, the globals might be in reality
  * a private member variable of an object...
+ *
+ * In C, these are the settings of the TA_Context used by the
+ * calling thread (see TA_SetThreadContext).
  */
 #if defined( _MANAGED )
    #define TA_GLOBALS_UNSTABLE_PERIOD(x,y) (Globals->unstablePeriod[(int)(FuncUnstId::y)])
@@ -109,8 +129,8 @@
    #define TA_GLOBALS_UNSTABLE_PERIOD(x,y) (this.unstablePeriod[FuncUnstId.y.ordinal()])
    #define TA_GLOBALS_COMPATIBILITY        (this.compatibility)
 #else
-   #define TA_GLOBALS_UNSTABLE_PERIOD(x,y) (TA_Globals->unstablePeriod[x])
-   #define TA_GLOBALS_COMPATIBILITY        (TA_Globals->compatibility)
+   #define TA_GLOBALS_UNSTABLE_PERIOD(x,y) (TA_ThreadContext->unstablePeriod[x])
+   #define TA_GLOBALS_COMPATIBILITY        (TA_ThreadContext->compatibility)
 #endif
 
 
@@ -258,6 +278,12 @@
          return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr); \
    }
 
+#define CIRCBUF_INIT_PAIR(Id1,Id2,Type,Size) \
+   { \
+      CIRCBUF_INIT(Id1,Type,Size); \
+      CIRCBUF_INIT(Id2,Type,Size); \
+   }
+
 #define CIRCBUF_DESTROY(Id)
 
 /* Use this macro to access the member when type is a class or a struct. */
@@ -299,6 +325,12 @@
       Id = new Type[maxIdx_##Id+1]; \
    }
 
+#define CIRCBUF_INIT_PAIR(Id1,Id2,Type,Size) \
+   { \
+      CIRCBUF_INIT(Id1,Type,Size); \
+      CIRCBUF_INIT(Id2,Type,Size); \
+   }
+
 #define CIRCBUF_DESTROY(Id)
 
 /* Use this macro to access the member when type is a class or a struct. */
@@ -316,11 +348,11 @@
 
 #define CIRCBUF_INIT(Id,Type,Size) \
    { \
-      if( Size < 1 ) \
+      if( (Size) < 1 ) \
          return TA_INTERNAL_ERROR(137); \
-      if( (int)Size > (int)(sizeof(local_##Id)/sizeof(Type)) ) \
+      if( (int)(Size) > (int)(sizeof(local_##Id)/sizeof(Type)) ) \
       { \
-         Id = TA_Malloc( sizeof(Type)*Size ); \
+         Id = TA_INT_TempAlloc( sizeof(Type)*(Size) ); \
          if( !Id ) \
             return TA_ALLOC_ERR; \
       } \
@@ -339,10 +371,31 @@
       Id##_Idx = 0; \
    }
 
+/* Same as CIRCBUF_INIT for two buffers of the same size. The
+ * first buffer is freed if the second cannot be allocated.
+ */
+#define CIRCBUF_INIT_PAIR(Id1,Id2,Type,Size) \
+   { \
+      CIRCBUF_INIT(Id1,Type,Size); \
+      if( (int)(Size) > (int)(sizeof(local_##Id2)/sizeof(Type)) ) \
+      { \
+         Id2 = TA_INT_TempAlloc( sizeof(Type)*(Size) ); \
+         if( !Id2 ) \
+         { \
+            CIRCBUF_DESTROY(Id1); \
+            return TA_ALLOC_ERR; \
+         } \
+      } \
+      else \
+         Id2 = &local_##Id2[0]; \
+      maxIdx_##Id2 = (Size-1); \
+      Id2##_Idx = 0; \
+   }
+
 #define CIRCBUF_DESTROY(Id) \
    { \
       if( Id != &local_##Id[0] ) \
-         TA_Free( Id ); \
+         TA_INT_TempFree( Id ); \
    }
 
 /* Use this macro to access the member when Type is a class or a struct. */
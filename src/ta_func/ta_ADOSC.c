@@ -320,10 +320,8 @@ double outReal[],
    { \
       high  = inHigh[today]; \
       low   = inLow[today]; \
-      tmp   = high-low; \
       close = inClose[today]; \
-      if( tmp > 0.0 ) \
-         ad += (((close-low)-(high-close))/tmp)*((double)inVolume[today]); \
+      TA_AD_ADD(ad,high,low,close,inVolume[today],tmp); \
       today++; \
    }
 
@@ -349,8 +347,8 @@ double outReal[],
    while( today < startIdx )
    {
       CALCULATE_AD;
-      fastEMA = (fastk*ad)+(one_minus_fastk*fastEMA);
-      slowEMA = (slowk*ad)+(one_minus_slowk*slowEMA);
+      fastEMA = TA_T3_EMA_STEP(fastEMA,ad,fastk,one_minus_fastk);
+      slowEMA = TA_T3_EMA_STEP(slowEMA,ad,slowk,one_minus_slowk);
    }
 
    /* Perform the calculation for the requested range */
@@ -358,8 +356,8 @@ double outReal[],
    while( today <= endIdx )
    {
       CALCULATE_AD;
-      fastEMA = (fastk*ad)+(one_minus_fastk*fastEMA);
-      slowEMA = (slowk*ad)+(one_minus_slowk*slowEMA);
+      fastEMA = TA_T3_EMA_STEP(fastEMA,ad,fastk,one_minus_fastk);
+      slowEMA = TA_T3_EMA_STEP(slowEMA,ad,slowk,one_minus_slowk);
 
       outReal[outIdx++] = fastEMA - slowEMA;
    }
@@ -482,10 +480,8 @@ double outReal[],
 /* Generated */    { \
 /* Generated */       high  = inHigh[today]; \
 /* Generated */       low   = inLow[today]; \
-/* Generated */       tmp   = high-low; \
 /* Generated */       close = inClose[today]; \
-/* Generated */       if( tmp > 0.0 ) \
-/* Generated */          ad += (((close-low)-(high-close))/tmp)*((double)inVolume[today]); \
+/* Generated */       TA_AD_ADD(ad,high,low,close,inVolume[today],tmp); \
 /* Generated */       today++; \
 /* Generated */    }
 /* Generated */    fastk = PER_TO_K( optInFastPeriod );
@@ -498,15 +494,15 @@ double outReal[],
 /* Generated */    while( today < startIdx )
 /* Generated */    {
 /* Generated */       CALCULATE_AD;
-/* Generated */       fastEMA = (fastk*ad)+(one_minus_fastk*fastEMA);
-/* Generated */       slowEMA = (slowk*ad)+(one_minus_slowk*slowEMA);
+/* Generated */       fastEMA = TA_T3_EMA_STEP(fastEMA,ad,fastk,one_minus_fastk);
+/* Generated */       slowEMA = TA_T3_EMA_STEP(slowEMA,ad,slowk,one_minus_slowk);
 /* Generated */    }
 /* Generated */    outIdx = 0;
 /* Generated */    while( today <= endIdx )
 /* Generated */    {
 /* Generated */       CALCULATE_AD;
-/* Generated */       fastEMA = (fastk*ad)+(one_minus_fastk*fastEMA);
-/* Generated */       slowEMA = (slowk*ad)+(one_minus_slowk*slowEMA);
+/* Generated */       fastEMA = TA_T3_EMA_STEP(fastEMA,ad,fastk,one_minus_fastk);
+/* Generated */       slowEMA = TA_T3_EMA_STEP(slowEMA,ad,slowk,one_minus_slowk);
 /* Generated */       outReal[outIdx++] = fastEMA - slowEMA;
 /* Generated */    }
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
@@ -258,7 +258,7 @@ double outReal[],
       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
    }
 
-   ARRAY_ALLOC( adx, endIdx-startIdx+optInTimePeriod );
+   ARRAY_ALLOC( adx, TA_ADXR_ADX_SIZE(startIdx,endIdx,optInTimePeriod) );
    #if !defined( _JAVA )
       if( !adx )
          return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
@@ -379,7 +379,7 @@ double outReal[],
 /* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
 /* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */    }
-/* Generated */    ARRAY_ALLOC( adx, endIdx-startIdx+optInTimePeriod );
+/* Generated */    ARRAY_ALLOC( adx, TA_ADXR_ADX_SIZE(startIdx,endIdx,optInTimePeriod) );
 /* Generated */    #if !defined( _JAVA )
 /* Generated */       if( !adx )
 /* Generated */          return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
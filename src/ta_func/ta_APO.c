@@ -261,7 +261,7 @@ double outReal[],
    /* Insert TA function code here. */
 
    /* Allocate an intermediate buffer. */
-   ARRAY_ALLOC(tempBuffer, (endIdx-startIdx+1) );
+   ARRAY_ALLOC(tempBuffer, TA_PO_MA_SIZE(startIdx,endIdx) );
    #if !defined(_JAVA)
       if( !tempBuffer )
          return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
@@ -507,7 +507,7 @@ TA_RetCode TA_PREFIX(INT_PO)( int    startIdx,
 /* Generated */     #endif 
 /* Generated */  #endif
 /* Generated */  #endif 
-/* Generated */    ARRAY_ALLOC(tempBuffer, (endIdx-startIdx+1) );
+/* Generated */    ARRAY_ALLOC(tempBuffer, TA_PO_MA_SIZE(startIdx,endIdx) );
 /* Generated */    #if !defined(_JAVA)
 /* Generated */       if( !tempBuffer )
 /* Generated */          return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
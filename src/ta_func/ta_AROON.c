@@ -185,7 +185,9 @@ double outAroonUp[],
 	/* insert local variable here */
    double lowest, highest, tmp, factor;
    int outIdx;
-   int trailingIdx, lowestIdx, highestIdx, today, i;
+   int trailingIdx, lowestIdx, highestIdx, today;
+   WINDOW_EXTREME_VARIABLES(lowestWindow);
+   WINDOW_EXTREME_VARIABLES(highestWindow);
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -261,24 +263,16 @@ double outAroonUp[],
    highest     = 0.0;
    factor      = (double)100.0/(double)optInTimePeriod;
 
+   INIT_WINDOW_EXTREME_PAIR(lowestWindow,highestWindow,optInTimePeriod+1);
+
    while( today <= endIdx )
    {
       /* Keep track of the lowestIdx */
       tmp = inLow[today];
       if( lowestIdx < trailingIdx )
       {
-        lowestIdx = trailingIdx;
+        WINDOW_LOWEST_LAST_FIND(lowestWindow,inLow,trailingIdx,today,lowestIdx);
         lowest = inLow[lowestIdx];
-        i = lowestIdx;
-        while( ++i<=today )
-        {
-           tmp = inLow[i];
-           if( tmp <= lowest )
-           {
-              lowestIdx = i;
-              lowest = tmp;
-           }
-        }
       }
       else if( tmp <= lowest )
       {
@@ -290,18 +284,8 @@ double outAroonUp[],
       tmp = inHigh[today];
       if( highestIdx < trailingIdx )
       {
-        highestIdx = trailingIdx;
+        WINDOW_HIGHEST_LAST_FIND(highestWindow,inHigh,trailingIdx,today,highestIdx);
         highest = inHigh[highestIdx];
-        i = highestIdx;
-        while( ++i<=today )
-        {
-           tmp = inHigh[i];
-           if( tmp >= highest )
-           {
-              highestIdx = i;
-              highest = tmp;
-           }
-        }
       }
       else if( tmp >= highest )
       {
@@ -320,6 +304,9 @@ double outAroonUp[],
       today++;
    }
 
+   FREE_WINDOW_EXTREME(lowestWindow);
+   FREE_WINDOW_EXTREME(highestWindow);
+
    /* Keep the outBegIdx relative to the
     * caller input before returning.
     */
@@ -386,7 +373,9 @@ double outAroonUp[],
 /* Generated */ {
 /* Generated */    double lowest, highest, tmp, factor;
 /* Generated */    int outIdx;
-/* Generated */    int trailingIdx, lowestIdx, highestIdx, today, i;
+/* Generated */    int trailingIdx, lowestIdx, highestIdx, today;
+/* Generated */    WINDOW_EXTREME_VARIABLES(lowestWindow);
+/* Generated */    WINDOW_EXTREME_VARIABLES(highestWindow);
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -426,23 +415,14 @@ double outAroonUp[],
 /* Generated */    lowest      = 0.0;
 /* Generated */    highest     = 0.0;
 /* Generated */    factor      = (double)100.0/(double)optInTimePeriod;
+/* Generated */    INIT_WINDOW_EXTREME_PAIR(lowestWindow,highestWindow,optInTimePeriod+1);
 /* Generated */    while( today <= endIdx )
 /* Generated */    {
 /* Generated */       tmp = inLow[today];
 /* Generated */       if( lowestIdx < trailingIdx )
 /* Generated */       {
-/* Generated */         lowestIdx = trailingIdx;
+/* Generated */         WINDOW_LOWEST_LAST_FIND(lowestWindow,inLow,trailingIdx,today,lowestIdx);
 /* Generated */         lowest = inLow[lowestIdx];
-/* Generated */         i = lowestIdx;
-/* Generated */         while( ++i<=today )
-/* Generated */         {
-/* Generated */            tmp = inLow[i];
-/* Generated */            if( tmp <= lowest )
-/* Generated */            {
-/* Generated */               lowestIdx = i;
-/* Generated */               lowest = tmp;
-/* Generated */            }
-/* Generated */         }
 /* Generated */       }
 /* Generated */       else if( tmp <= lowest )
 /* Generated */       {
@@ -452,18 +432,8 @@ double outAroonUp[],
 /* Generated */       tmp = inHigh[today];
 /* Generated */       if( highestIdx < trailingIdx )
 /* Generated */       {
-/* Generated */         highestIdx = trailingIdx;
+/* Generated */         WINDOW_HIGHEST_LAST_FIND(highestWindow,inHigh,trailingIdx,today,highestIdx);
 /* Generated */         highest = inHigh[highestIdx];
-/* Generated */         i = highestIdx;
-/* Generated */         while( ++i<=today )
-/* Generated */         {
-/* Generated */            tmp = inHigh[i];
-/* Generated */            if( tmp >= highest )
-/* Generated */            {
-/* Generated */               highestIdx = i;
-/* Generated */               highest = tmp;
-/* Generated */            }
-/* Generated */         }
 /* Generated */       }
 /* Generated */       else if( tmp >= highest )
 /* Generated */       {
@@ -476,6 +446,8 @@ double outAroonUp[],
 /* Generated */       trailingIdx++;
 /* Generated */       today++;
 /* Generated */    }
+/* Generated */    FREE_WINDOW_EXTREME(lowestWindow);
+/* Generated */    FREE_WINDOW_EXTREME(highestWindow);
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
@@ -181,7 +181,9 @@ double outReal[],
 	/* insert local variable here */
    double lowest, highest, tmp, factor, aroon;
    int outIdx;
-   int trailingIdx, lowestIdx, highestIdx, today, i;
+   int trailingIdx, lowestIdx, highestIdx, today;
+   WINDOW_EXTREME_VARIABLES(lowestWindow);
+   WINDOW_EXTREME_VARIABLES(highestWindow);
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -262,24 +264,16 @@ double outReal[],
    highest     = 0.0;
    factor      = (double)100.0/(double)optInTimePeriod;
 
+   INIT_WINDOW_EXTREME_PAIR(lowestWindow,highestWindow,optInTimePeriod+1);
+
    while( today <= endIdx )
    {
       /* Keep track of the lowestIdx */
       tmp = inLow[today];
       if( lowestIdx < trailingIdx )
       {
-        lowestIdx = trailingIdx;
+        WINDOW_LOWEST_LAST_FIND(lowestWindow,inLow,trailingIdx,today,lowestIdx);
         lowest = inLow[lowestIdx];
-        i = lowestIdx;
-        while( ++i<=today )
-        {
-           tmp = inLow[i];
-           if( tmp <= lowest )
-           {
-              lowestIdx = i;
-              lowest = tmp;
-           }
-        }
       }
       else if( tmp <= lowest )
       {
@@ -291,18 +285,8 @@ double outReal[],
       tmp = inHigh[today];
       if( highestIdx < trailingIdx )
       {
-        highestIdx = trailingIdx;
+        WINDOW_HIGHEST_LAST_FIND(highestWindow,inHigh,trailingIdx,today,highestIdx);
         highest = inHigh[highestIdx];
-        i = highestIdx;
-        while( ++i<=today )
-        {
-           tmp = inHigh[i];
-           if( tmp >= highest )
-           {
-              highestIdx = i;
-              highest = tmp;
-           }
-        }
       }
       else if( tmp >= highest )
       {
@@ -330,6 +314,9 @@ double outReal[],
       today++;
    }
 
+   FREE_WINDOW_EXTREME(lowestWindow);
+   FREE_WINDOW_EXTREME(highestWindow);
+
    /* Keep the outBegIdx relative to the
     * caller input before returning.
     */
@@ -392,7 +379,9 @@ double outReal[],
 /* Generated */ {
 /* Generated */    double lowest, highest, tmp, factor, aroon;
 /* Generated */    int outIdx;
-/* Generated */    int trailingIdx, lowestIdx, highestIdx, today, i;
+/* Generated */    int trailingIdx, lowestIdx, highestIdx, today;
+/* Generated */    WINDOW_EXTREME_VARIABLES(lowestWindow);
+/* Generated */    WINDOW_EXTREME_VARIABLES(highestWindow);
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -430,23 +419,14 @@ double outReal[],
 /* Generated */    lowest      = 0.0;
 /* Generated */    highest     = 0.0;
 /* Generated */    factor      = (double)100.0/(double)optInTimePeriod;
+/* Generated */    INIT_WINDOW_EXTREME_PAIR(lowestWindow,highestWindow,optInTimePeriod+1);
 /* Generated */    while( today <= endIdx )
 /* Generated */    {
 /* Generated */       tmp = inLow[today];
 /* Generated */       if( lowestIdx < trailingIdx )
 /* Generated */       {
-/* Generated */         lowestIdx = trailingIdx;
+/* Generated */         WINDOW_LOWEST_LAST_FIND(lowestWindow,inLow,trailingIdx,today,lowestIdx);
 /* Generated */         lowest = inLow[lowestIdx];
-/* Generated */         i = lowestIdx;
-/* Generated */         while( ++i<=today )
-/* Generated */         {
-/* Generated */            tmp = inLow[i];
-/* Generated */            if( tmp <= lowest )
-/* Generated */            {
-/* Generated */               lowestIdx = i;
-/* Generated */               lowest = tmp;
-/* Generated */            }
-/* Generated */         }
 /* Generated */       }
 /* Generated */       else if( tmp <= lowest )
 /* Generated */       {
@@ -456,18 +436,8 @@ double outReal[],
 /* Generated */       tmp = inHigh[today];
 /* Generated */       if( highestIdx < trailingIdx )
 /* Generated */       {
-/* Generated */         highestIdx = trailingIdx;
+/* Generated */         WINDOW_HIGHEST_LAST_FIND(highestWindow,inHigh,trailingIdx,today,highestIdx);
 /* Generated */         highest = inHigh[highestIdx];
-/* Generated */         i = highestIdx;
-/* Generated */         while( ++i<=today )
-/* Generated */         {
-/* Generated */            tmp = inHigh[i];
-/* Generated */            if( tmp >= highest )
-/* Generated */            {
-/* Generated */               highestIdx = i;
-/* Generated */               highest = tmp;
-/* Generated */            }
-/* Generated */         }
 /* Generated */       }
 /* Generated */       else if( tmp >= highest )
 /* Generated */       {
@@ -480,6 +450,8 @@ double outReal[],
 /* Generated */       trailingIdx++;
 /* Generated */       today++;
 /* Generated */    }
+/* Generated */    FREE_WINDOW_EXTREME(lowestWindow);
+/* Generated */    FREE_WINDOW_EXTREME(highestWindow);
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
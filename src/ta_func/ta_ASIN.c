@@ -184,6 +184,16 @@ double outReal[],
 /**** END GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 
    /* Insert TA function code here. */
+#if !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )
+   /* Use the SIMD instructions when possible (see ta_vec.c). */
+   if( FUNCTION_CALL(INT_VecMath)( TA_VEC_ASIN, &inReal[startIdx], outReal, endIdx-startIdx+1 ) )
+   {
+      VALUE_HANDLE_DEREF(outNBElement) = endIdx-startIdx+1;
+      VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+#endif
+
    for( i=startIdx, outIdx=0; i <= endIdx; i++, outIdx++ )
    {
       outReal[outIdx] = std_asin(inReal[i]);
@@ -256,6 +266,14 @@ double outReal[],
 /* Generated */     #endif 
 /* Generated */  #endif
 /* Generated */  #endif 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )
+/* Generated */    if( FUNCTION_CALL(INT_VecMath)( TA_VEC_ASIN, &inReal[startIdx], outReal, endIdx-startIdx+1 ) )
+/* Generated */    {
+/* Generated */       VALUE_HANDLE_DEREF(outNBElement) = endIdx-startIdx+1;
+/* Generated */       VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    }
+/* Generated */ #endif
 /* Generated */    for( i=startIdx, outIdx=0; i <= endIdx; i++, outIdx++ )
 /* Generated */    {
 /* Generated */       outReal[outIdx] = std_asin(inReal[i]);
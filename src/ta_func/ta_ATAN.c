@@ -186,6 +186,16 @@ double outReal[],
    /* Insert TA function code here. */
 
    /* Default return values */
+#if !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )
+   /* Use the SIMD instructions when possible (see ta_vec.c). */
+   if( FUNCTION_CALL(INT_VecMath)( TA_VEC_ATAN, &inReal[startIdx], outReal, endIdx-startIdx+1 ) )
+   {
+      VALUE_HANDLE_DEREF(outNBElement) = endIdx-startIdx+1;
+      VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+#endif
+
    for( i=startIdx, outIdx=0; i <= endIdx; i++, outIdx++ )
    {
       outReal[outIdx] = std_atan(inReal[i]);
@@ -258,6 +268,14 @@ double outReal[],
 /* Generated */     #endif 
 /* Generated */  #endif
 /* Generated */  #endif 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )
+/* Generated */    if( FUNCTION_CALL(INT_VecMath)( TA_VEC_ATAN, &inReal[startIdx], outReal, endIdx-startIdx+1 ) )
+/* Generated */    {
+/* Generated */       VALUE_HANDLE_DEREF(outNBElement) = endIdx-startIdx+1;
+/* Generated */       VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    }
+/* Generated */ #endif
 /* Generated */    for( i=startIdx, outIdx=0; i <= endIdx; i++, outIdx++ )
 /* Generated */    {
 /* Generated */       outReal[outIdx] = std_atan(inReal[i]);
@@ -309,9 +309,7 @@ double outReal[],
    /* Skip the unstable period. */
    while( outIdx != 0 )
    {
-      prevATR *= optInTimePeriod - 1;
-      prevATR += tempBuffer[today++];
-      prevATR /= optInTimePeriod;
+      prevATR = TA_WILDER_STEP(prevATR,tempBuffer[today++],optInTimePeriod);
       outIdx--;
    }
 
@@ -326,9 +324,7 @@ double outReal[],
 
    while( --nbATR != 0 )
    {
-      prevATR *= optInTimePeriod - 1;
-      prevATR += tempBuffer[today++];
-      prevATR /= optInTimePeriod;
+      prevATR = TA_WILDER_STEP(prevATR,tempBuffer[today++],optInTimePeriod);
       outReal[outIdx++] = prevATR;
    }
 
@@ -462,9 +458,7 @@ double outReal[],
 /* Generated */    outIdx = TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_ATR,Atr);
 /* Generated */    while( outIdx != 0 )
 /* Generated */    {
-/* Generated */       prevATR *= optInTimePeriod - 1;
-/* Generated */       prevATR += tempBuffer[today++];
-/* Generated */       prevATR /= optInTimePeriod;
+/* Generated */       prevATR = TA_WILDER_STEP(prevATR,tempBuffer[today++],optInTimePeriod);
 /* Generated */       outIdx--;
 /* Generated */    }
 /* Generated */    outIdx = 1;
@@ -472,9 +466,7 @@ double outReal[],
 /* Generated */    nbATR = (endIdx - startIdx)+1;
 /* Generated */    while( --nbATR != 0 )
 /* Generated */    {
-/* Generated */       prevATR *= optInTimePeriod - 1;
-/* Generated */       prevATR += tempBuffer[today++];
-/* Generated */       prevATR /= optInTimePeriod;
+/* Generated */       prevATR = TA_WILDER_STEP(prevATR,tempBuffer[today++],optInTimePeriod);
 /* Generated */       outReal[outIdx++] = prevATR;
 /* Generated */    }
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
@@ -225,6 +225,46 @@ double outReal[],
 
 	outIdx = 0;
 
+#if !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )
+	/* For a long period, find the deviations using
+	 * a Fenwick tree instead when the math mode is
+	 * TA_MATH_FAST (see ta_utility.h).
+	 */
+	if( TA_AVGDEV_USE_TREE(optInTimePeriod) ) {
+		ENUM_DECLARATION(RetCode) retCode;
+		TA_AvgDevTree tree;
+		int nbOutput, i;
+
+		retCode = TA_INT_AvgDevTreeAlloc( &tree, optInTimePeriod, endIdx-today+1 );
+		if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) ) {
+			VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+			VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+			return retCode;
+		}
+
+		while (today <= endIdx) {
+			nbOutput = endIdx-today+1;
+			if( nbOutput > tree.maxNbOutput )
+				nbOutput = tree.maxNbOutput;
+
+			for (i = 0; i < nbOutput+lookback; i++) {
+				tree.value[i] = inReal[today-lookback+i];
+			}
+			TA_INT_AvgDevTreeCalc( &tree, nbOutput );
+
+			for (i = 0; i < nbOutput; i++) {
+				outReal[outIdx++] = tree.sumDev[i]/optInTimePeriod;
+			}
+			today += nbOutput;
+		}
+
+		TA_INT_AvgDevTreeFree( &tree );
+		VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+
+		return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+	}
+#endif
+
 	while (today <= endIdx) {
 	   	double todaySum, todayDev;
 		int i;
@@ -329,6 +369,35 @@ double outReal[],
 /* Generated */ 	}
 /* Generated */ 	VALUE_HANDLE_DEREF(outBegIdx) = today;
 /* Generated */ 	outIdx = 0;
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )
+/* Generated */ 	if( TA_AVGDEV_USE_TREE(optInTimePeriod) ) {
+/* Generated */ 		ENUM_DECLARATION(RetCode) retCode;
+/* Generated */ 		TA_AvgDevTree tree;
+/* Generated */ 		int nbOutput, i;
+/* Generated */ 		retCode = TA_INT_AvgDevTreeAlloc( &tree, optInTimePeriod, endIdx-today+1 );
+/* Generated */ 		if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) ) {
+/* Generated */ 			VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */ 			VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */ 			return retCode;
+/* Generated */ 		}
+/* Generated */ 		while (today <= endIdx) {
+/* Generated */ 			nbOutput = endIdx-today+1;
+/* Generated */ 			if( nbOutput > tree.maxNbOutput )
+/* Generated */ 				nbOutput = tree.maxNbOutput;
+/* Generated */ 			for (i = 0; i < nbOutput+lookback; i++) {
+/* Generated */ 				tree.value[i] = inReal[today-lookback+i];
+/* Generated */ 			}
+/* Generated */ 			TA_INT_AvgDevTreeCalc( &tree, nbOutput );
+/* Generated */ 			for (i = 0; i < nbOutput; i++) {
+/* Generated */ 				outReal[outIdx++] = tree.sumDev[i]/optInTimePeriod;
+/* Generated */ 			}
+/* Generated */ 			today += nbOutput;
+/* Generated */ 		}
+/* Generated */ 		TA_INT_AvgDevTreeFree( &tree );
+/* Generated */ 		VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+/* Generated */ 		return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */ 	}
+/* Generated */ #endif
 /* Generated */ 	while (today <= endIdx) {
 /* Generated */ 	   	double todaySum, todayDev;
 /* Generated */ 		int i;
@@ -205,6 +205,18 @@ double outReal[],
 
    /* Average price = (High + Low + Open + Close) / 4 */
 
+#if !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST ) && !defined( USE_SINGLE_PRECISION_INPUT )
+   /* Use the SIMD instructions when possible (see ta_vec.c). */
+   if( TA_INT_VecArith( TA_VEC_AVGPRICE, &inOpen[startIdx], &inHigh[startIdx],
+                        &inLow[startIdx], &inClose[startIdx],
+                        outReal, endIdx-startIdx+1 ) )
+   {
+      VALUE_HANDLE_DEREF(outNBElement) = endIdx-startIdx+1;
+      VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+#endif
+
    outIdx = 0;
 
    for( i=startIdx; i <= endIdx; i++ )
@@ -294,6 +306,16 @@ double outReal[],
 /* Generated */     #endif 
 /* Generated */  #endif
 /* Generated */  #endif 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST ) && !defined( USE_SINGLE_PRECISION_INPUT )
+/* Generated */    if( TA_INT_VecArith( TA_VEC_AVGPRICE, &inOpen[startIdx], &inHigh[startIdx],
+/* Generated */                         &inLow[startIdx], &inClose[startIdx],
+/* Generated */                         outReal, endIdx-startIdx+1 ) )
+/* Generated */    {
+/* Generated */       VALUE_HANDLE_DEREF(outNBElement) = endIdx-startIdx+1;
+/* Generated */       VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    }
+/* Generated */ #endif
 /* Generated */    outIdx = 0;
 /* Generated */    for( i=startIdx; i <= endIdx; i++ )
 /* Generated */    {
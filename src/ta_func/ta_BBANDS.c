@@ -238,8 +238,9 @@ double outRealLowerBand[],
 {
    /* Insert local variables here. */
    ENUM_DECLARATION(RetCode) retCode;
-   int i;
+   int i, outIdx, trailingIdx, lookbackTotal;
    double tempReal, tempReal2;
+   double periodTotal1, periodTotal2, meanValue1, meanValue2;
    ARRAY_REF(tempBuffer1);
    ARRAY_REF(tempBuffer2);
 
@@ -340,6 +341,76 @@ double outRealLowerBand[],
    #endif
 
 
+   /* With a simple moving average, the middle band and the
+    * standard deviation are calculated in one pass: the sum and
+    * the sum of squares of the period slide together, and the
+    * three bands are written directly (no temporary buffer).
+    *
+    * The operations are the same as TA_INT_SMA followed by
+    * TA_INT_stddev_using_precalc_ma, so are the outputs.
+    */
+   if( optInMAType == ENUM_VALUE(MAType,TA_MAType_SMA,Sma) )
+   {
+      lookbackTotal = optInTimePeriod-1;
+      if( startIdx < lookbackTotal )
+         startIdx = lookbackTotal;
+
+      if( startIdx > endIdx )
+      {
+         VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+         VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+         return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+      }
+
+      /* Add-up the initial period, except for the last value. */
+      periodTotal1 = 0.0;
+      periodTotal2 = 0.0;
+      trailingIdx  = startIdx-lookbackTotal;
+      i = trailingIdx;
+      while( i < startIdx )
+      {
+         tempReal = inReal[i++];
+         periodTotal1 += tempReal;
+         tempReal *= tempReal;
+         periodTotal2 += tempReal;
+      }
+
+      /* The input is read before writing the outputs at the
+       * same index, so inReal can be one of the outputs.
+       */
+      outIdx = 0;
+      do
+      {
+         tempReal = inReal[i++];
+         periodTotal1 += tempReal;
+         tempReal *= tempReal;
+         periodTotal2 += tempReal;
+         meanValue1 = periodTotal1/optInTimePeriod;
+         meanValue2 = periodTotal2/optInTimePeriod;
+
+         tempReal = inReal[trailingIdx++];
+         periodTotal1 -= tempReal;
+         tempReal *= tempReal;
+         periodTotal2 -= tempReal;
+
+         meanValue2 -= meanValue1*meanValue1;
+         if( !TA_IS_ZERO_OR_NEG(meanValue2) )
+            tempReal = std_sqrt(meanValue2);
+         else
+            tempReal = (double)0.0;
+
+         outRealMiddleBand[outIdx] = meanValue1;
+         outRealUpperBand[outIdx]  = meanValue1 + (tempReal * optInNbDevUp);
+         outRealLowerBand[outIdx]  = meanValue1 - (tempReal * optInNbDevDn);
+         outIdx++;
+      } while( i <= endIdx );
+
+      VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+      VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
    /* Calculate the middle band, which is a moving average.
     * The other two bands will simply add/substract the
     * standard deviation from this middle band.
@@ -355,27 +426,14 @@ double outRealLowerBand[],
    }
 
    /* Calculate the standard deviation into tempBuffer2. */
-   if( optInMAType == ENUM_VALUE(MAType,TA_MAType_SMA,Sma) )
-   {
-      /* A small speed optimization by re-using the
-       * already calculated SMA.
-       */
-       FUNCTION_CALL(INT_stddev_using_precalc_ma)( inReal, tempBuffer1,
-                                                   (int)VALUE_HANDLE_DEREF(outBegIdx), (int)VALUE_HANDLE_DEREF(outNBElement),
-                                                   optInTimePeriod, tempBuffer2 );
-   }
-   else
-   {
-      /* Calculate the Standard Deviation */
-      retCode = FUNCTION_CALL(STDDEV)( (int)VALUE_HANDLE_DEREF(outBegIdx), endIdx, inReal,
-                                       optInTimePeriod, 1.0,
-                                       outBegIdx, outNBElement, tempBuffer2 );
+   retCode = FUNCTION_CALL(STDDEV)( (int)VALUE_HANDLE_DEREF(outBegIdx), endIdx, inReal,
+                                    optInTimePeriod, 1.0,
+                                    outBegIdx, outNBElement, tempBuffer2 );
 
-      if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
-      {
-         VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-         return retCode;
-      }
+   if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return retCode;
    }
 
    /* Copy the MA calculation into the middle band ouput, unless
@@ -525,8 +583,9 @@ double outRealLowerBand[],
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    ENUM_DECLARATION(RetCode) retCode;
-/* Generated */    int i;
+/* Generated */    int i, outIdx, trailingIdx, lookbackTotal;
 /* Generated */    double tempReal, tempReal2;
+/* Generated */    double periodTotal1, periodTotal2, meanValue1, meanValue2;
 /* Generated */    ARRAY_REF(tempBuffer1);
 /* Generated */    ARRAY_REF(tempBuffer2);
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
@@ -594,6 +653,55 @@ double outRealLowerBand[],
 /* Generated */       if( (tempBuffer1 == inReal) || (tempBuffer2 == inReal) )
 /* Generated */          return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
 /* Generated */    #endif
+/* Generated */    if( optInMAType == ENUM_VALUE(MAType,TA_MAType_SMA,Sma) )
+/* Generated */    {
+/* Generated */       lookbackTotal = optInTimePeriod-1;
+/* Generated */       if( startIdx < lookbackTotal )
+/* Generated */          startIdx = lookbackTotal;
+/* Generated */       if( startIdx > endIdx )
+/* Generated */       {
+/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */          return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */       }
+/* Generated */       periodTotal1 = 0.0;
+/* Generated */       periodTotal2 = 0.0;
+/* Generated */       trailingIdx  = startIdx-lookbackTotal;
+/* Generated */       i = trailingIdx;
+/* Generated */       while( i < startIdx )
+/* Generated */       {
+/* Generated */          tempReal = inReal[i++];
+/* Generated */          periodTotal1 += tempReal;
+/* Generated */          tempReal *= tempReal;
+/* Generated */          periodTotal2 += tempReal;
+/* Generated */       }
+/* Generated */       outIdx = 0;
+/* Generated */       do
+/* Generated */       {
+/* Generated */          tempReal = inReal[i++];
+/* Generated */          periodTotal1 += tempReal;
+/* Generated */          tempReal *= tempReal;
+/* Generated */          periodTotal2 += tempReal;
+/* Generated */          meanValue1 = periodTotal1/optInTimePeriod;
+/* Generated */          meanValue2 = periodTotal2/optInTimePeriod;
+/* Generated */          tempReal = inReal[trailingIdx++];
+/* Generated */          periodTotal1 -= tempReal;
+/* Generated */          tempReal *= tempReal;
+/* Generated */          periodTotal2 -= tempReal;
+/* Generated */          meanValue2 -= meanValue1*meanValue1;
+/* Generated */          if( !TA_IS_ZERO_OR_NEG(meanValue2) )
+/* Generated */             tempReal = std_sqrt(meanValue2);
+/* Generated */          else
+/* Generated */             tempReal = (double)0.0;
+/* Generated */          outRealMiddleBand[outIdx] = meanValue1;
+/* Generated */          outRealUpperBand[outIdx]  = meanValue1 + (tempReal * optInNbDevUp);
+/* Generated */          outRealLowerBand[outIdx]  = meanValue1 - (tempReal * optInNbDevDn);
+/* Generated */          outIdx++;
+/* Generated */       } while( i <= endIdx );
+/* Generated */       VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+/* Generated */       VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    }
 /* Generated */    retCode = FUNCTION_CALL(MA)( startIdx, endIdx, inReal,
 /* Generated */                                 optInTimePeriod, optInMAType,
 /* Generated */                                 outBegIdx, outNBElement, tempBuffer1 );
@@ -602,22 +710,13 @@ double outRealLowerBand[],
 /* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
 /* Generated */       return retCode;
 /* Generated */    }
-/* Generated */    if( optInMAType == ENUM_VALUE(MAType,TA_MAType_SMA,Sma) )
-/* Generated */    {
-/* Generated */        FUNCTION_CALL(INT_stddev_using_precalc_ma)( inReal, tempBuffer1,
-/* Generated */                                                    (int)VALUE_HANDLE_DEREF(outBegIdx), (int)VALUE_HANDLE_DEREF(outNBElement),
-/* Generated */                                                    optInTimePeriod, tempBuffer2 );
-/* Generated */    }
-/* Generated */    else
+/* Generated */    retCode = FUNCTION_CALL(STDDEV)( (int)VALUE_HANDLE_DEREF(outBegIdx), endIdx, inReal,
+/* Generated */                                     optInTimePeriod, 1.0,
+/* Generated */                                     outBegIdx, outNBElement, tempBuffer2 );
+/* Generated */    if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
 /* Generated */    {
-/* Generated */       retCode = FUNCTION_CALL(STDDEV)( (int)VALUE_HANDLE_DEREF(outBegIdx), endIdx, inReal,
-/* Generated */                                        optInTimePeriod, 1.0,
-/* Generated */                                        outBegIdx, outNBElement, tempBuffer2 );
-/* Generated */       if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
-/* Generated */       {
-/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-/* Generated */          return retCode;
-/* Generated */       }
+/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */       return retCode;
 /* Generated */    }
 /* Generated */    #if !defined(USE_SINGLE_PRECISION_INPUT)
 /* Generated */       if( tempBuffer1 != outRealMiddleBand )
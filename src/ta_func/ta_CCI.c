@@ -191,7 +191,7 @@ double outReal[],
    /* This ptr will points on a circular buffer of
     * at least "optInTimePeriod" element.
     */
-   CIRCBUF_PROLOG(circBuffer,double,30);
+   CIRCBUF_PROLOG(circBuffer,double,TA_CCI_LOCAL_SIZE);
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -249,6 +249,66 @@ double outReal[],
       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
    }
 
+   outIdx = 0;
+
+#if !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )
+   /* For a long period, find the average and the deviations
+    * using a Fenwick tree instead when the math mode is
+    * TA_MATH_FAST (see ta_utility.h).
+    */
+   if( TA_AVGDEV_USE_TREE(optInTimePeriod) )
+   {
+      ENUM_DECLARATION(RetCode) retCode;
+      TA_AvgDevTree tree;
+      int nbOutput, k;
+
+      retCode = TA_INT_AvgDevTreeAlloc( &tree, optInTimePeriod, endIdx-startIdx+1 );
+      if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+      {
+         VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+         VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+         return retCode;
+      }
+
+      i = startIdx;
+      while( i <= endIdx )
+      {
+         nbOutput = endIdx-i+1;
+         if( nbOutput > tree.maxNbOutput )
+            nbOutput = tree.maxNbOutput;
+
+         for( j=0; j < nbOutput+lookbackTotal; j++ )
+         {
+            k = i-lookbackTotal+j;
+            tree.value[j] = (inHigh[k]+inLow[k]+inClose[k])/3;
+         }
+         TA_INT_AvgDevTreeCalc( &tree, nbOutput );
+
+         for( j=0; j < nbOutput; j++ )
+         {
+            lastValue  = tree.value[j+lookbackTotal];
+            theAverage = tree.mean[j];
+            tempReal2  = tree.sumDev[j];
+            tempReal   = lastValue-theAverage;
+
+            if( (tempReal != 0.0) && (tempReal2 != 0.0) )
+            {
+               outReal[outIdx++] = tempReal/(0.015*(tempReal2/optInTimePeriod));
+            }
+            else
+               outReal[outIdx++] = 0.0;
+         }
+         i += nbOutput;
+      }
+
+      TA_INT_AvgDevTreeFree( &tree );
+      VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+      VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+#endif
+
    /* Allocate a circular buffer equal to the requested
     * period.
     */
@@ -274,7 +334,6 @@ double outReal[],
     * Note that this algorithm allows the inReal and
     * outReal to be the same buffer.
     */
-   outIdx = 0;
    do
    {
       lastValue = (inHigh[i]+inLow[i]+inClose[i])/3;
@@ -376,7 +435,7 @@ double outReal[],
 /* Generated */ {
 /* Generated */    double tempReal, tempReal2, theAverage, lastValue;
 /* Generated */    int i, j, outIdx, lookbackTotal;
-/* Generated */    CIRCBUF_PROLOG(circBuffer,double,30);
+/* Generated */    CIRCBUF_PROLOG(circBuffer,double,TA_CCI_LOCAL_SIZE);
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -407,6 +466,53 @@ double outReal[],
 /* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
 /* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */    }
+/* Generated */    outIdx = 0;
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )
+/* Generated */    if( TA_AVGDEV_USE_TREE(optInTimePeriod) )
+/* Generated */    {
+/* Generated */       ENUM_DECLARATION(RetCode) retCode;
+/* Generated */       TA_AvgDevTree tree;
+/* Generated */       int nbOutput, k;
+/* Generated */       retCode = TA_INT_AvgDevTreeAlloc( &tree, optInTimePeriod, endIdx-startIdx+1 );
+/* Generated */       if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+/* Generated */       {
+/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */          return retCode;
+/* Generated */       }
+/* Generated */       i = startIdx;
+/* Generated */       while( i <= endIdx )
+/* Generated */       {
+/* Generated */          nbOutput = endIdx-i+1;
+/* Generated */          if( nbOutput > tree.maxNbOutput )
+/* Generated */             nbOutput = tree.maxNbOutput;
+/* Generated */          for( j=0; j < nbOutput+lookbackTotal; j++ )
+/* Generated */          {
+/* Generated */             k = i-lookbackTotal+j;
+/* Generated */             tree.value[j] = (inHigh[k]+inLow[k]+inClose[k])/3;
+/* Generated */          }
+/* Generated */          TA_INT_AvgDevTreeCalc( &tree, nbOutput );
+/* Generated */          for( j=0; j < nbOutput; j++ )
+/* Generated */          {
+/* Generated */             lastValue  = tree.value[j+lookbackTotal];
+/* Generated */             theAverage = tree.mean[j];
+/* Generated */             tempReal2  = tree.sumDev[j];
+/* Generated */             tempReal   = lastValue-theAverage;
+/* Generated */             if( (tempReal != 0.0) && (tempReal2 != 0.0) )
+/* Generated */             {
+/* Generated */                outReal[outIdx++] = tempReal/(0.015*(tempReal2/optInTimePeriod));
+/* Generated */             }
+/* Generated */             else
+/* Generated */                outReal[outIdx++] = 0.0;
+/* Generated */          }
+/* Generated */          i += nbOutput;
+/* Generated */       }
+/* Generated */       TA_INT_AvgDevTreeFree( &tree );
+/* Generated */       VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+/* Generated */       VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    }
+/* Generated */ #endif
 /* Generated */    CIRCBUF_INIT( circBuffer, double, optInTimePeriod );
 /* Generated */    i=startIdx-lookbackTotal;
 /* Generated */    if( optInTimePeriod > 1 )
@@ -418,7 +524,6 @@ double outReal[],
 /* Generated */          CIRCBUF_NEXT(circBuffer);
 /* Generated */       }
 /* Generated */    }
-/* Generated */    outIdx = 0;
 /* Generated */    do
 /* Generated */    {
 /* Generated */       lastValue = (inHigh[i]+inLow[i]+inClose[i])/3;
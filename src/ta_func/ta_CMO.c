@@ -304,10 +304,7 @@ double outReal[],
          tempValue1 = inReal[today++];
          tempValue2 = tempValue1 - prevValue;
          prevValue  = tempValue1;
-         if( tempValue2 < 0 )
-            prevLoss -= tempValue2;
-         else
-            prevGain += tempValue2;
+         TA_GAIN_LOSS_ADD(prevGain,prevLoss,tempValue2);
       }
 
 
@@ -347,10 +344,7 @@ double outReal[],
       tempValue1 = inReal[today++];
       tempValue2 = tempValue1 - prevValue;
       prevValue  = tempValue1;
-      if( tempValue2 < 0 )
-         prevLoss -= tempValue2;
-      else
-         prevGain += tempValue2;
+      TA_GAIN_LOSS_ADD(prevGain,prevLoss,tempValue2);
    }
 
 
@@ -390,15 +384,7 @@ double outReal[],
          tempValue2 = tempValue1 - prevValue;
          prevValue  = tempValue1;
 
-         prevLoss *= (optInTimePeriod-1);
-         prevGain *= (optInTimePeriod-1);
-         if( tempValue2 < 0 )
-            prevLoss -= tempValue2;
-         else
-            prevGain += tempValue2;
-
-         prevLoss /= optInTimePeriod;
-         prevGain /= optInTimePeriod;
+         TA_GAIN_LOSS_STEP(prevGain,prevLoss,tempValue2,optInTimePeriod);
 
          today++;
       }
@@ -413,15 +399,7 @@ double outReal[],
       tempValue2 = tempValue1 - prevValue;
       prevValue  = tempValue1;
 
-      prevLoss *= (optInTimePeriod-1);
-      prevGain *= (optInTimePeriod-1);
-      if( tempValue2 < 0 )
-         prevLoss -= tempValue2;
-      else
-         prevGain += tempValue2;
-
-      prevLoss /= optInTimePeriod;
-      prevGain /= optInTimePeriod;
+      TA_GAIN_LOSS_STEP(prevGain,prevLoss,tempValue2,optInTimePeriod);
       tempValue1 = prevGain+prevLoss;
       if( !TA_IS_ZERO(tempValue1) )
          outReal[outIdx++] = 100.0*((prevGain-prevLoss)/tempValue1);
@@ -543,10 +521,7 @@ double outReal[],
 /* Generated */          tempValue1 = inReal[today++];
 /* Generated */          tempValue2 = tempValue1 - prevValue;
 /* Generated */          prevValue  = tempValue1;
-/* Generated */          if( tempValue2 < 0 )
-/* Generated */             prevLoss -= tempValue2;
-/* Generated */          else
-/* Generated */             prevGain += tempValue2;
+/* Generated */          TA_GAIN_LOSS_ADD(prevGain,prevLoss,tempValue2);
 /* Generated */       }
 /* Generated */       tempValue1 = prevLoss/optInTimePeriod;
 /* Generated */       tempValue2 = prevGain/optInTimePeriod;
@@ -573,10 +548,7 @@ double outReal[],
 /* Generated */       tempValue1 = inReal[today++];
 /* Generated */       tempValue2 = tempValue1 - prevValue;
 /* Generated */       prevValue  = tempValue1;
-/* Generated */       if( tempValue2 < 0 )
-/* Generated */          prevLoss -= tempValue2;
-/* Generated */       else
-/* Generated */          prevGain += tempValue2;
+/* Generated */       TA_GAIN_LOSS_ADD(prevGain,prevLoss,tempValue2);
 /* Generated */    }
 /* Generated */    prevLoss /= optInTimePeriod;
 /* Generated */    prevGain /= optInTimePeriod;
@@ -595,14 +567,7 @@ double outReal[],
 /* Generated */          tempValue1 = inReal[today];
 /* Generated */          tempValue2 = tempValue1 - prevValue;
 /* Generated */          prevValue  = tempValue1;
-/* Generated */          prevLoss *= (optInTimePeriod-1);
-/* Generated */          prevGain *= (optInTimePeriod-1);
-/* Generated */          if( tempValue2 < 0 )
-/* Generated */             prevLoss -= tempValue2;
-/* Generated */          else
-/* Generated */             prevGain += tempValue2;
-/* Generated */          prevLoss /= optInTimePeriod;
-/* Generated */          prevGain /= optInTimePeriod;
+/* Generated */          TA_GAIN_LOSS_STEP(prevGain,prevLoss,tempValue2,optInTimePeriod);
 /* Generated */          today++;
 /* Generated */       }
 /* Generated */    }
@@ -611,14 +576,7 @@ double outReal[],
 /* Generated */       tempValue1 = inReal[today++];
 /* Generated */       tempValue2 = tempValue1 - prevValue;
 /* Generated */       prevValue  = tempValue1;
-/* Generated */       prevLoss *= (optInTimePeriod-1);
-/* Generated */       prevGain *= (optInTimePeriod-1);
-/* Generated */       if( tempValue2 < 0 )
-/* Generated */          prevLoss -= tempValue2;
-/* Generated */       else
-/* Generated */          prevGain += tempValue2;
-/* Generated */       prevLoss /= optInTimePeriod;
-/* Generated */       prevGain /= optInTimePeriod;
+/* Generated */       TA_GAIN_LOSS_STEP(prevGain,prevLoss,tempValue2,optInTimePeriod);
 /* Generated */       tempValue1 = prevGain+prevLoss;
 /* Generated */       if( !TA_IS_ZERO(tempValue1) )
 /* Generated */          outReal[outIdx++] = 100.0*((prevGain-prevLoss)/tempValue1);
@@ -267,7 +267,7 @@ double outReal[],
     * calculation.
     */
    #if defined(USE_SINGLE_PRECISION_INPUT) || defined( USE_SUBARRAY )
-      tempInt = lookbackTotal+(endIdx-startIdx)+1;
+      tempInt = TA_DEMA_EMA1_SIZE(startIdx,endIdx,lookbackEMA);
       ARRAY_ALLOC(firstEMA, tempInt );
       #if !defined( _JAVA )
          if( !firstEMA )
@@ -278,7 +278,7 @@ double outReal[],
          firstEMA = outReal;
       else
       {
-         tempInt = lookbackTotal+(endIdx-startIdx)+1;
+         tempInt = TA_DEMA_EMA1_SIZE(startIdx,endIdx,lookbackEMA);
          ARRAY_ALLOC(firstEMA, tempInt );
          #if !defined( _JAVA )
             if( !firstEMA )
@@ -304,7 +304,7 @@ double outReal[],
    }
 
    /* Allocate a temporary buffer for storing the EMA of the EMA. */
-   ARRAY_ALLOC(secondEMA, VALUE_HANDLE_GET(firstEMANbElement));
+   ARRAY_ALLOC(secondEMA, TA_DEMA_EMA2_SIZE(startIdx,endIdx,lookbackEMA));
 
    #if !defined( _JAVA )
       if( !secondEMA )
@@ -446,7 +446,7 @@ double outReal[],
 /* Generated */    if( startIdx > endIdx )
 /* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */    #if defined(USE_SINGLE_PRECISION_INPUT) || defined( USE_SUBARRAY )
-/* Generated */       tempInt = lookbackTotal+(endIdx-startIdx)+1;
+/* Generated */       tempInt = TA_DEMA_EMA1_SIZE(startIdx,endIdx,lookbackEMA);
 /* Generated */       ARRAY_ALLOC(firstEMA, tempInt );
 /* Generated */       #if !defined( _JAVA )
 /* Generated */          if( !firstEMA )
@@ -457,7 +457,7 @@ double outReal[],
 /* Generated */          firstEMA = outReal;
 /* Generated */       else
 /* Generated */       {
-/* Generated */          tempInt = lookbackTotal+(endIdx-startIdx)+1;
+/* Generated */          tempInt = TA_DEMA_EMA1_SIZE(startIdx,endIdx,lookbackEMA);
 /* Generated */          ARRAY_ALLOC(firstEMA, tempInt );
 /* Generated */          #if !defined( _JAVA )
 /* Generated */             if( !firstEMA )
@@ -475,7 +475,7 @@ double outReal[],
 /* Generated */       ARRAY_FREE_COND( firstEMA != outReal, firstEMA );
 /* Generated */       return retCode;
 /* Generated */    }
-/* Generated */    ARRAY_ALLOC(secondEMA, VALUE_HANDLE_GET(firstEMANbElement));
+/* Generated */    ARRAY_ALLOC(secondEMA, TA_DEMA_EMA2_SIZE(startIdx,endIdx,lookbackEMA));
 /* Generated */    #if !defined( _JAVA )
 /* Generated */       if( !secondEMA )
 /* Generated */       {
@@ -191,6 +191,17 @@ double outReal[],
 
    /* Insert TA function code here. */
 
+#if !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST ) && !defined( USE_SINGLE_PRECISION_INPUT )
+   /* Use the SIMD instructions when possible (see ta_vec.c). */
+   if( TA_INT_VecArith( TA_VEC_DIV, &inReal0[startIdx], &inReal1[startIdx], NULL, NULL,
+                        outReal, endIdx-startIdx+1 ) )
+   {
+      VALUE_HANDLE_DEREF(outNBElement) = endIdx-startIdx+1;
+      VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+#endif
+
    for( i=startIdx, outIdx=0; i <= endIdx; i++, outIdx++ )
    {
       outReal[outIdx] = inReal0[i]/inReal1[i];
@@ -268,6 +279,15 @@ double outReal[],
 /* Generated */     #endif 
 /* Generated */  #endif
 /* Generated */  #endif 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST ) && !defined( USE_SINGLE_PRECISION_INPUT )
+/* Generated */    if( TA_INT_VecArith( TA_VEC_DIV, &inReal0[startIdx], &inReal1[startIdx], NULL, NULL,
+/* Generated */                         outReal, endIdx-startIdx+1 ) )
+/* Generated */    {
+/* Generated */       VALUE_HANDLE_DEREF(outNBElement) = endIdx-startIdx+1;
+/* Generated */       VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    }
+/* Generated */ #endif
 /* Generated */    for( i=startIdx, outIdx=0; i <= endIdx; i++, outIdx++ )
 /* Generated */    {
 /* Generated */       outReal[outIdx] = inReal0[i]/inReal1[i];
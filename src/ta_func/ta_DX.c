@@ -389,16 +389,8 @@ double outReal[],
       diffM    = prevLow-tempReal;   /* Minus Delta */
       prevLow  = tempReal;
 
-      if( (diffM > 0) && (diffP < diffM) )
-      {
-          /* Case 2 and 4: +DM=0,-DM=diffM */
-          prevMinusDM += diffM;
-      }
-      else if( (diffP > 0) && (diffP > diffM) )
-      {
-          /* Case 1 and 3: +DM=diffP,-DM=0 */
-          prevPlusDM += diffP;
-      }
+      prevMinusDM += TA_MINUS_DM1(diffP,diffM);
+      prevPlusDM  += TA_PLUS_DM1(diffP,diffM);
 
       TRUE_RANGE(prevHigh,prevLow,prevClose,tempReal);
       prevTR += tempReal;
@@ -421,23 +413,12 @@ double outReal[],
       diffM    = prevLow-tempReal;   /* Minus Delta */
       prevLow  = tempReal;
 
-      prevMinusDM -= prevMinusDM/optInTimePeriod;
-      prevPlusDM  -= prevPlusDM/optInTimePeriod;
-
-      if( (diffM > 0) && (diffP < diffM) )
-      {
-         /* Case 2 and 4: +DM=0,-DM=diffM */
-         prevMinusDM += diffM;
-      }
-      else if( (diffP > 0) && (diffP > diffM) )
-      {
-         /* Case 1 and 3: +DM=diffP,-DM=0 */
-         prevPlusDM += diffP;
-      }
+      prevMinusDM = TA_WILDER_SUM_STEP(prevMinusDM,TA_MINUS_DM1(diffP,diffM),optInTimePeriod);
+      prevPlusDM  = TA_WILDER_SUM_STEP(prevPlusDM,TA_PLUS_DM1(diffP,diffM),optInTimePeriod);
 
       /* Calculate the prevTR */
       TRUE_RANGE(prevHigh,prevLow,prevClose,tempReal);
-      prevTR = prevTR - (prevTR/optInTimePeriod) + tempReal;
+      prevTR = TA_WILDER_SUM_STEP(prevTR,tempReal,optInTimePeriod);
       prevClose = inClose[today];
    }
 
@@ -468,23 +449,12 @@ double outReal[],
       diffM    = prevLow-tempReal;   /* Minus Delta */
       prevLow  = tempReal;
 
-      prevMinusDM -= prevMinusDM/optInTimePeriod;
-      prevPlusDM  -= prevPlusDM/optInTimePeriod;
-
-      if( (diffM > 0) && (diffP < diffM) )
-      {
-         /* Case 2 and 4: +DM=0,-DM=diffM */
-         prevMinusDM += diffM;
-      }
-      else if( (diffP > 0) && (diffP > diffM) )
-      {
-         /* Case 1 and 3: +DM=diffP,-DM=0 */
-         prevPlusDM += diffP;
-      }
+      prevMinusDM = TA_WILDER_SUM_STEP(prevMinusDM,TA_MINUS_DM1(diffP,diffM),optInTimePeriod);
+      prevPlusDM  = TA_WILDER_SUM_STEP(prevPlusDM,TA_PLUS_DM1(diffP,diffM),optInTimePeriod);
 
       /* Calculate the prevTR */
       TRUE_RANGE(prevHigh,prevLow,prevClose,tempReal);
-      prevTR = prevTR - (prevTR/optInTimePeriod) + tempReal;
+      prevTR = TA_WILDER_SUM_STEP(prevTR,tempReal,optInTimePeriod);
       prevClose = inClose[today];
 
       /* Calculate the DX. The value is rounded (see Wilder book). */
@@ -633,14 +603,8 @@ double outReal[],
 /* Generated */       tempReal = inLow[today];
 /* Generated */       diffM    = prevLow-tempReal;   
 /* Generated */       prevLow  = tempReal;
-/* Generated */       if( (diffM > 0) && (diffP < diffM) )
-/* Generated */       {
-/* Generated */           prevMinusDM += diffM;
-/* Generated */       }
-/* Generated */       else if( (diffP > 0) && (diffP > diffM) )
-/* Generated */       {
-/* Generated */           prevPlusDM += diffP;
-/* Generated */       }
+/* Generated */       prevMinusDM += TA_MINUS_DM1(diffP,diffM);
+/* Generated */       prevPlusDM  += TA_PLUS_DM1(diffP,diffM);
 /* Generated */       TRUE_RANGE(prevHigh,prevLow,prevClose,tempReal);
 /* Generated */       prevTR += tempReal;
 /* Generated */       prevClose = inClose[today];
@@ -655,18 +619,10 @@ double outReal[],
 /* Generated */       tempReal = inLow[today];
 /* Generated */       diffM    = prevLow-tempReal;   
 /* Generated */       prevLow  = tempReal;
-/* Generated */       prevMinusDM -= prevMinusDM/optInTimePeriod;
-/* Generated */       prevPlusDM  -= prevPlusDM/optInTimePeriod;
-/* Generated */       if( (diffM > 0) && (diffP < diffM) )
-/* Generated */       {
-/* Generated */          prevMinusDM += diffM;
-/* Generated */       }
-/* Generated */       else if( (diffP > 0) && (diffP > diffM) )
-/* Generated */       {
-/* Generated */          prevPlusDM += diffP;
-/* Generated */       }
+/* Generated */       prevMinusDM = TA_WILDER_SUM_STEP(prevMinusDM,TA_MINUS_DM1(diffP,diffM),optInTimePeriod);
+/* Generated */       prevPlusDM  = TA_WILDER_SUM_STEP(prevPlusDM,TA_PLUS_DM1(diffP,diffM),optInTimePeriod);
 /* Generated */       TRUE_RANGE(prevHigh,prevLow,prevClose,tempReal);
-/* Generated */       prevTR = prevTR - (prevTR/optInTimePeriod) + tempReal;
+/* Generated */       prevTR = TA_WILDER_SUM_STEP(prevTR,tempReal,optInTimePeriod);
 /* Generated */       prevClose = inClose[today];
 /* Generated */    }
 /* Generated */    if( !TA_IS_ZERO(prevTR) )
@@ -691,18 +647,10 @@ double outReal[],
 /* Generated */       tempReal = inLow[today];
 /* Generated */       diffM    = prevLow-tempReal;   
 /* Generated */       prevLow  = tempReal;
-/* Generated */       prevMinusDM -= prevMinusDM/optInTimePeriod;
-/* Generated */       prevPlusDM  -= prevPlusDM/optInTimePeriod;
-/* Generated */       if( (diffM > 0) && (diffP < diffM) )
-/* Generated */       {
-/* Generated */          prevMinusDM += diffM;
-/* Generated */       }
-/* Generated */       else if( (diffP > 0) && (diffP > diffM) )
-/* Generated */       {
-/* Generated */          prevPlusDM += diffP;
-/* Generated */       }
+/* Generated */       prevMinusDM = TA_WILDER_SUM_STEP(prevMinusDM,TA_MINUS_DM1(diffP,diffM),optInTimePeriod);
+/* Generated */       prevPlusDM  = TA_WILDER_SUM_STEP(prevPlusDM,TA_PLUS_DM1(diffP,diffM),optInTimePeriod);
 /* Generated */       TRUE_RANGE(prevHigh,prevLow,prevClose,tempReal);
-/* Generated */       prevTR = prevTR - (prevTR/optInTimePeriod) + tempReal;
+/* Generated */       prevTR = TA_WILDER_SUM_STEP(prevTR,tempReal,optInTimePeriod);
 /* Generated */       prevClose = inClose[today];
 /* Generated */       if( !TA_IS_ZERO(prevTR))
 /* Generated */       {
@@ -357,7 +357,7 @@ TA_RetCode TA_PREFIX(INT_EMA)( int               startIdx,
     * but do not write it in the output.
     */
    while( today <= startIdx )
-      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+      prevMA = TA_EMA_STEP(prevMA,inReal[today++],optInK_1);
 
    /* Write the first value. */
    outReal[0] = prevMA;
@@ -366,7 +366,7 @@ TA_RetCode TA_PREFIX(INT_EMA)( int               startIdx,
    /* Calculate the remaining range. */
    while( today <= endIdx )
    {
-      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+      prevMA = TA_EMA_STEP(prevMA,inReal[today++],optInK_1);
       outReal[outIdx++] = prevMA;
    }
 
@@ -516,12 +516,12 @@ TA_RetCode TA_PREFIX(INT_EMA)( int               startIdx,
 /* Generated */       today = 1;
 /* Generated */    }
 /* Generated */    while( today <= startIdx )
-/* Generated */       prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+/* Generated */       prevMA = TA_EMA_STEP(prevMA,inReal[today++],optInK_1);
 /* Generated */    outReal[0] = prevMA;
 /* Generated */    outIdx = 1;
 /* Generated */    while( today <= endIdx )
 /* Generated */    {
-/* Generated */       prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+/* Generated */       prevMA = TA_EMA_STEP(prevMA,inReal[today++],optInK_1);
 /* Generated */       outReal[outIdx++] = prevMA;
 /* Generated */    }
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
@@ -276,20 +276,12 @@ double outReal[],
     */
    trailingValue = tempReal2;
 
-   /* Calculate the efficiency ratio */
-   if( (sumROC1 <= periodROC) || TA_IS_ZERO(sumROC1))
-      tempReal = 1.0;
-   else
-      tempReal = std_fabs(periodROC/sumROC1);
-
-   /* Calculate the smoothing constant */
-   tempReal  = (tempReal*constDiff)+constMax;
-   tempReal *= tempReal;
-
-   /* Calculate the KAMA like an EMA, using the
-    * smoothing constant as the adaptive factor.
+   /* Calculate the efficiency ratio and the smoothing constant,
+    * then the KAMA like an EMA, using the smoothing constant as
+    * the adaptive factor.
     */
-   prevKAMA = ((inReal[today++]-prevKAMA)*tempReal) + prevKAMA;
+   TA_KAMA_STEP(prevKAMA,inReal[today],periodROC,sumROC1,tempReal,constMax,constDiff);
+   today++;
 
    /* 'today' keep track of where the processing is within the
     * input.
@@ -308,28 +300,19 @@ double outReal[],
        *  - Remove trailing ROC1
        *  - Add new ROC1
        */
-      sumROC1 -= std_fabs(trailingValue-tempReal2);
-      sumROC1 += std_fabs(tempReal-inReal[today-1]);
+      TA_KAMA_ROC_STEP(sumROC1,trailingValue,tempReal2,tempReal,inReal[today-1]);
 
       /* Save the trailing value. Do this because inReal
        * and outReal can be pointers to the same buffer.
        */
       trailingValue = tempReal2;
 
-      /* Calculate the efficiency ratio */
-      if( (sumROC1 <= periodROC) || TA_IS_ZERO(sumROC1) )
-         tempReal = 1.0;
-      else
-         tempReal = std_fabs(periodROC/sumROC1);
-
-      /* Calculate the smoothing constant */
-      tempReal  = (tempReal*constDiff)+constMax;
-      tempReal *= tempReal;
-
-      /* Calculate the KAMA like an EMA, using the
-       * smoothing constant as the adaptive factor.
+      /* Calculate the efficiency ratio and the smoothing constant,
+       * then the KAMA like an EMA, using the smoothing constant as
+       * the adaptive factor.
        */
-      prevKAMA = ((inReal[today++]-prevKAMA)*tempReal) + prevKAMA;
+      TA_KAMA_STEP(prevKAMA,inReal[today],periodROC,sumROC1,tempReal,constMax,constDiff);
+      today++;
    }
 
    /* Write the first value. */
@@ -348,28 +331,19 @@ double outReal[],
        *  - Remove trailing ROC1
        *  - Add new ROC1
        */
-      sumROC1 -= std_fabs(trailingValue-tempReal2);
-      sumROC1 += std_fabs(tempReal-inReal[today-1]);
+      TA_KAMA_ROC_STEP(sumROC1,trailingValue,tempReal2,tempReal,inReal[today-1]);
 
       /* Save the trailing value. Do this because inReal
        * and outReal can be pointers to the same buffer.
        */
       trailingValue = tempReal2;
 
-      /* Calculate the efficiency ratio */
-      if( (sumROC1 <= periodROC) || TA_IS_ZERO(sumROC1) )
-         tempReal = 1.0;
-      else
-         tempReal = std_fabs(periodROC / sumROC1);
-
-      /* Calculate the smoothing constant */
-      tempReal  = (tempReal*constDiff)+constMax;
-      tempReal *= tempReal;
-
-      /* Calculate the KAMA like an EMA, using the
-       * smoothing constant as the adaptive factor.
+      /* Calculate the efficiency ratio and the smoothing constant,
+       * then the KAMA like an EMA, using the smoothing constant as
+       * the adaptive factor.
        */
-      prevKAMA = ((inReal[today++]-prevKAMA)*tempReal) + prevKAMA;
+      TA_KAMA_STEP(prevKAMA,inReal[today],periodROC,sumROC1,tempReal,constMax,constDiff);
+      today++;
       outReal[outIdx++] = prevKAMA;
    }
 
@@ -478,28 +452,17 @@ double outReal[],
 /* Generated */    tempReal2 = inReal[trailingIdx++];
 /* Generated */    periodROC = tempReal-tempReal2;
 /* Generated */    trailingValue = tempReal2;
-/* Generated */    if( (sumROC1 <= periodROC) || TA_IS_ZERO(sumROC1))
-/* Generated */       tempReal = 1.0;
-/* Generated */    else
-/* Generated */       tempReal = std_fabs(periodROC/sumROC1);
-/* Generated */    tempReal  = (tempReal*constDiff)+constMax;
-/* Generated */    tempReal *= tempReal;
-/* Generated */    prevKAMA = ((inReal[today++]-prevKAMA)*tempReal) + prevKAMA;
+/* Generated */    TA_KAMA_STEP(prevKAMA,inReal[today],periodROC,sumROC1,tempReal,constMax,constDiff);
+/* Generated */    today++;
 /* Generated */    while( today <= startIdx )
 /* Generated */    {
 /* Generated */       tempReal  = inReal[today];
 /* Generated */       tempReal2 = inReal[trailingIdx++];
 /* Generated */       periodROC = tempReal-tempReal2;
-/* Generated */       sumROC1 -= std_fabs(trailingValue-tempReal2);
-/* Generated */       sumROC1 += std_fabs(tempReal-inReal[today-1]);
+/* Generated */       TA_KAMA_ROC_STEP(sumROC1,trailingValue,tempReal2,tempReal,inReal[today-1]);
 /* Generated */       trailingValue = tempReal2;
-/* Generated */       if( (sumROC1 <= periodROC) || TA_IS_ZERO(sumROC1) )
-/* Generated */          tempReal = 1.0;
-/* Generated */       else
-/* Generated */          tempReal = std_fabs(periodROC/sumROC1);
-/* Generated */       tempReal  = (tempReal*constDiff)+constMax;
-/* Generated */       tempReal *= tempReal;
-/* Generated */       prevKAMA = ((inReal[today++]-prevKAMA)*tempReal) + prevKAMA;
+/* Generated */       TA_KAMA_STEP(prevKAMA,inReal[today],periodROC,sumROC1,tempReal,constMax,constDiff);
+/* Generated */       today++;
 /* Generated */    }
 /* Generated */    outReal[0] = prevKAMA;
 /* Generated */    outIdx = 1;
@@ -509,16 +472,10 @@ double outReal[],
 /* Generated */       tempReal  = inReal[today];
 /* Generated */       tempReal2 = inReal[trailingIdx++];
 /* Generated */       periodROC = tempReal-tempReal2;
-/* Generated */       sumROC1 -= std_fabs(trailingValue-tempReal2);
-/* Generated */       sumROC1 += std_fabs(tempReal-inReal[today-1]);
+/* Generated */       TA_KAMA_ROC_STEP(sumROC1,trailingValue,tempReal2,tempReal,inReal[today-1]);
 /* Generated */       trailingValue = tempReal2;
-/* Generated */       if( (sumROC1 <= periodROC) || TA_IS_ZERO(sumROC1) )
-/* Generated */          tempReal = 1.0;
-/* Generated */       else
-/* Generated */          tempReal = std_fabs(periodROC / sumROC1);
-/* Generated */       tempReal  = (tempReal*constDiff)+constMax;
-/* Generated */       tempReal *= tempReal;
-/* Generated */       prevKAMA = ((inReal[today++]-prevKAMA)*tempReal) + prevKAMA;
+/* Generated */       TA_KAMA_STEP(prevKAMA,inReal[today],periodROC,sumROC1,tempReal,constMax,constDiff);
+/* Generated */       today++;
 /* Generated */       outReal[outIdx++] = prevKAMA;
 /* Generated */    }
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
@@ -176,7 +176,7 @@ double outReal[],
 	/* insert local variable here */
    int outIdx;
 
-   int today, lookbackTotal;
+   int today, trailingIdx, anchorIdx, lookbackTotal;
    double SumX, SumXY, SumY, SumXSqr, Divisor;
 
    double m;
@@ -257,17 +257,46 @@ double outReal[],
    SumXSqr = optInTimePeriod * ( optInTimePeriod - 1 ) * ( 2 * optInTimePeriod - 1 ) / 6;
    Divisor = SumX * SumX - optInTimePeriod * SumXSqr;
 
+   /* SumY and SumXY are updated incrementally from one price bar
+    * to the next instead of being re-calculated over the whole
+    * period. They are still re-calculated from scratch every
+    * optInTimePeriod price bar to stop the accumulation of
+    * rounding errors. That remains O(1) per price bar.
+    */
+   trailingIdx = today-lookbackTotal;
+   anchorIdx   = today;
+   SumXY       = 0.0;
+   SumY        = 0.0;
+
    while( today <= endIdx )
    {
-     SumXY = 0;
-     SumY = 0;
-     for( i = optInTimePeriod; i-- != 0; )
+     if( today == anchorIdx )
      {
-       SumY += tempValue1 = inReal[today - i];
-       SumXY += (double)i * tempValue1;
+       SumXY = 0;
+       SumY = 0;
+       for( i = optInTimePeriod; i-- != 0; )
+       {
+         SumY += tempValue1 = inReal[today - i];
+         SumXY += (double)i * tempValue1;
+       }
+       anchorIdx = today+optInTimePeriod;
      }
+     else
+       SumY += inReal[today];
+
      m = ( optInTimePeriod * SumXY - SumX * SumY) / Divisor;
+
+     /* Get the trailing value before writing the output, the
+      * input and output can be the same buffer.
+      */
+     tempValue1 = inReal[trailingIdx++];
      outReal[outIdx++] = std_atan(m) * ( 180.0 / PI );
+
+     /* Slide to the next price bar. The weight of every value
+      * increases by one and the trailing value is dropped.
+      */
+     SumXY += SumY - (double)optInTimePeriod * tempValue1;
+     SumY  -= tempValue1;
      today++;
    }
 
@@ -325,7 +354,7 @@ double outReal[],
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    int outIdx;
-/* Generated */    int today, lookbackTotal;
+/* Generated */    int today, trailingIdx, anchorIdx, lookbackTotal;
 /* Generated */    double SumX, SumXY, SumY, SumXSqr, Divisor;
 /* Generated */    double m;
 /* Generated */    int i;
@@ -364,17 +393,30 @@ double outReal[],
 /* Generated */    SumX = optInTimePeriod * ( optInTimePeriod - 1 ) * 0.5;
 /* Generated */    SumXSqr = optInTimePeriod * ( optInTimePeriod - 1 ) * ( 2 * optInTimePeriod - 1 ) / 6;
 /* Generated */    Divisor = SumX * SumX - optInTimePeriod * SumXSqr;
+/* Generated */    trailingIdx = today-lookbackTotal;
+/* Generated */    anchorIdx   = today;
+/* Generated */    SumXY       = 0.0;
+/* Generated */    SumY        = 0.0;
 /* Generated */    while( today <= endIdx )
 /* Generated */    {
-/* Generated */      SumXY = 0;
-/* Generated */      SumY = 0;
-/* Generated */      for( i = optInTimePeriod; i-- != 0; )
+/* Generated */      if( today == anchorIdx )
 /* Generated */      {
-/* Generated */        SumY += tempValue1 = inReal[today - i];
-/* Generated */        SumXY += (double)i * tempValue1;
+/* Generated */        SumXY = 0;
+/* Generated */        SumY = 0;
+/* Generated */        for( i = optInTimePeriod; i-- != 0; )
+/* Generated */        {
+/* Generated */          SumY += tempValue1 = inReal[today - i];
+/* Generated */          SumXY += (double)i * tempValue1;
+/* Generated */        }
+/* Generated */        anchorIdx = today+optInTimePeriod;
 /* Generated */      }
+/* Generated */      else
+/* Generated */        SumY += inReal[today];
 /* Generated */      m = ( optInTimePeriod * SumXY - SumX * SumY) / Divisor;
+/* Generated */      tempValue1 = inReal[trailingIdx++];
 /* Generated */      outReal[outIdx++] = std_atan(m) * ( 180.0 / PI );
+/* Generated */      SumXY += SumY - (double)optInTimePeriod * tempValue1;
+/* Generated */      SumY  -= tempValue1;
 /* Generated */      today++;
 /* Generated */    }
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
@@ -335,7 +335,7 @@ double outReal[],
       /* The optInTimePeriod is ignored and the FAMA output of the MAMA
        * is ignored.
        */
-      ARRAY_ALLOC(dummyBuffer, (endIdx-startIdx+1) );
+      ARRAY_ALLOC(dummyBuffer, TA_MAMA_FAMA_SIZE(startIdx,endIdx) );
 
       #if !defined( _JAVA )
          if( !dummyBuffer )
@@ -484,7 +484,7 @@ double outReal[],
 /* Generated */                                      outBegIdx, outNBElement, outReal );
 /* Generated */       break;
 /* Generated */    case ENUM_CASE(MAType, TA_MAType_MAMA, Mama):
-/* Generated */       ARRAY_ALLOC(dummyBuffer, (endIdx-startIdx+1) );
+/* Generated */       ARRAY_ALLOC(dummyBuffer, TA_MAMA_FAMA_SIZE(startIdx,endIdx) );
 /* Generated */       #if !defined( _JAVA )
 /* Generated */          if( !dummyBuffer )
 /* Generated */             return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
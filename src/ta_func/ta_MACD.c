@@ -444,7 +444,7 @@ TA_RetCode TA_PREFIX(INT_MACD)( int    startIdx,
    }
 
    /* Allocate intermediate buffer for fast/slow EMA. */
-   tempInteger = (endIdx-startIdx)+1+lookbackSignal;
+   tempInteger = TA_MACD_MA_SIZE(startIdx,endIdx,lookbackSignal);
    ARRAY_ALLOC( fastEMABuffer, tempInteger );
    #if !defined( _JAVA )
       if( !fastEMABuffer )
@@ -751,7 +751,7 @@ TA_RetCode TA_PREFIX(INT_MACD)( int    startIdx,
 /* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
 /* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */    }
-/* Generated */    tempInteger = (endIdx-startIdx)+1+lookbackSignal;
+/* Generated */    tempInteger = TA_MACD_MA_SIZE(startIdx,endIdx,lookbackSignal);
 /* Generated */    ARRAY_ALLOC( fastEMABuffer, tempInteger );
 /* Generated */    #if !defined( _JAVA )
 /* Generated */       if( !fastEMABuffer )
@@ -403,7 +403,7 @@ double outMACDHist[],
    }
 
    /* Allocate intermediate buffer for fast/slow MA. */
-   tempInteger = (endIdx-startIdx)+1+lookbackSignal;
+   tempInteger = TA_MACD_MA_SIZE(startIdx,endIdx,lookbackSignal);
    ARRAY_ALLOC( fastMABuffer, tempInteger );
    #if !defined( _JAVA )
       if( !fastMABuffer )
@@ -668,7 +668,7 @@ double outMACDHist[],
 /* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
 /* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */    }
-/* Generated */    tempInteger = (endIdx-startIdx)+1+lookbackSignal;
+/* Generated */    tempInteger = TA_MACD_MA_SIZE(startIdx,endIdx,lookbackSignal);
 /* Generated */    ARRAY_ALLOC( fastMABuffer, tempInteger );
 /* Generated */    #if !defined( _JAVA )
 /* Generated */       if( !fastMABuffer )
@@ -42,6 +42,7 @@
  *  MMDDYY BY     Description
  *  -------------------------------------------------------------------
  *  021807 MF     Initial Version
+ *  101826 MF     Calculate each period only where needed.
  */
 
 /**** START GENCODE SECTION 1 - DO NOT DELETE THIS LINE ****/
@@ -208,8 +209,12 @@ double outReal[],
 {
    /* insert local variable here */
    int i, j, lookbackTotal, outputSize, tempInt, curPeriod;
+   int firstIdx, lastIdx, lowestPeriod, nbSum, nbRunningSum;
+   double periodTotal, periodError, tempReal, tempReal2, tempReal3;
    ARRAY_INT_REF(localPeriodArray);
+   ARRAY_INT_REF(localLastIdxArray);
    ARRAY_REF(localOutputArray);
+   ARRAY_REF(localSumArray);
    VALUE_HANDLE_INT(localBegIdx);
    VALUE_HANDLE_INT(localNbElement);
    ENUM_DECLARATION(RetCode) retCode;
@@ -296,67 +301,202 @@ double outReal[],
    outputSize = endIdx - tempInt + 1;
 
    /* Allocate intermediate local buffer. */
-   ARRAY_ALLOC(localOutputArray,outputSize);
    ARRAY_INT_ALLOC(localPeriodArray,outputSize);
 
    /* Copy caller array of period into local buffer.
     * At the same time, truncate to min/max.
+    *
+    * When optInMinPeriod is greater than optInMaxPeriod, the
+    * period is clamped to optInMaxPeriod. The lookback is the
+    * one of optInMaxPeriod, so a longer period would not have
+    * enough data.
 	*/
    for( i=0; i < outputSize; i++ )
    {
       tempInt = (int)(inPeriods[startIdx+i]);
 	  if( tempInt < optInMinPeriod )
 		  tempInt = optInMinPeriod;
-	  else if( tempInt > optInMaxPeriod )
+	  if( tempInt > optInMaxPeriod )
           tempInt = optInMaxPeriod;
       localPeriodArray[i] = tempInt;
    }
 
-   /* Process each element of the input.
-    * For each possible period value, the MA is calculated
-	* only once.
-	* The outReal is then fill up for all element with
-	* the same period.
-	* A local flag (value 0) is set in localPeriodArray
-	* to avoid doing a second time the same calculation.
-	*/
-   for( i=0; i < outputSize; i++ )
+   if( (optInMAType == ENUM_VALUE(MAType,TA_MAType_SMA,Sma)) ||
+       (optInMAType == ENUM_VALUE(MAType,TA_MAType_WMA,Wma)) )
+   {
+      /* The SMA and WMA of any period are differences of
+       * running sums, so every output is calculated only
+       * with its own period.
+       *
+       * For the window x[s]..x[e] and the running sums
+       *   S(k) = x[0]+...+x[k-1]
+       *   W(k) = 0*x[0]+1*x[1]+...+(k-1)*x[k-1]
+       * the WMA numerator x[s]+2*x[s+1]+...+p*x[e] is
+       *   (W(e+1)-W(s)) - (s-1)*(S(e+1)-S(s))
+       *
+       * The rounding error of each running sum is accumulated
+       * separately (TwoSum). This keeps the differences as
+       * accurate as a direct sum even when the running sums
+       * become large.
+       */
+      if( optInMAType == ENUM_VALUE(MAType,TA_MAType_WMA,Wma) )
+         nbRunningSum = 2;
+      else
+         nbRunningSum = 1;
+      tempInt = startIdx-lookbackTotal;
+      nbSum   = endIdx-tempInt+2;
+      ARRAY_ALLOC(localSumArray,2*nbRunningSum*nbSum);
+      #if !defined( _JAVA )
+         if( !localSumArray )
+         {
+            ARRAY_INT_FREE(localPeriodArray);
+            VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+            VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+            return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+         }
+      #endif
+
+      /* localSumArray holds S, its error, then W and its error. */
+      for( j=0; j < 2*nbRunningSum*nbSum; j += 2*nbSum )
+      {
+         periodTotal = 0.0;
+         periodError = 0.0;
+         localSumArray[j] = 0.0;
+         localSumArray[j+nbSum] = 0.0;
+         for( i=1; i < nbSum; i++ )
+         {
+            tempReal = inReal[tempInt+i-1];
+            if( j != 0 )
+               tempReal *= (double)(i-1);
+            tempReal2    = periodTotal+tempReal;
+            tempReal3    = tempReal2-periodTotal;
+            periodError += (periodTotal-(tempReal2-tempReal3))+(tempReal-tempReal3);
+            periodTotal  = tempReal2;
+            localSumArray[j+i] = periodTotal;
+            localSumArray[j+nbSum+i] = periodError;
+         }
+      }
+
+      for( i=0; i < outputSize; i++ )
+      {
+         j = lookbackTotal+1+i;
+         curPeriod = localPeriodArray[i];
+         tempInt   = j-curPeriod;
+         tempReal  = (localSumArray[j]-localSumArray[tempInt]) +
+                     (localSumArray[nbSum+j]-localSumArray[nbSum+tempInt]);
+         if( nbRunningSum == 2 )
+         {
+            tempReal2 = (localSumArray[2*nbSum+j]-localSumArray[2*nbSum+tempInt]) +
+                        (localSumArray[3*nbSum+j]-localSumArray[3*nbSum+tempInt]);
+            tempReal  = tempReal2-(double)(tempInt-1)*tempReal;
+            outReal[i] = tempReal/((curPeriod*(curPeriod+1))>>1);
+         }
+         else
+            outReal[i] = tempReal/curPeriod;
+      }
+
+      ARRAY_FREE(localSumArray);
+   }
+   else if( optInMAType == ENUM_VALUE(MAType,TA_MAType_MAMA,Mama) )
+   {
+      /* The period is ignored by the MAMA, so it is
+       * calculated only once.
+       */
+      ARRAY_ALLOC(localOutputArray,outputSize);
+      retCode = FUNCTION_CALL(MA)( startIdx, endIdx, inReal,
+                                   optInMaxPeriod, optInMAType,
+                                   VALUE_HANDLE_OUT(localBegIdx),VALUE_HANDLE_OUT(localNbElement),localOutputArray );
+
+      if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+      {
+         ARRAY_FREE(localOutputArray);
+         ARRAY_INT_FREE(localPeriodArray);
+         VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+         VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+         return retCode;
+      }
+
+      for( i=0; i < outputSize; i++ )
+         outReal[i] = localOutputArray[i];
+
+      ARRAY_FREE(localOutputArray);
+   }
+   else
    {
-	   curPeriod = localPeriodArray[i];
-	   if( curPeriod != 0 )
-	   {
-           /* TODO: This portion of the function can be slightly speed
-            *       optimized by making the function without unstable period
-	        *       start their calculation at 'startIdx+i' instead of startIdx.
-	        */
+      /* Find the last output using each period. */
+      lowestPeriod = optInMinPeriod < optInMaxPeriod? optInMinPeriod : optInMaxPeriod;
+      ARRAY_INT_ALLOC(localLastIdxArray,optInMaxPeriod-lowestPeriod+1);
+      #if !defined( _JAVA )
+         if( !localLastIdxArray )
+         {
+            ARRAY_INT_FREE(localPeriodArray);
+            VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+            VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+            return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+         }
+      #endif
+      for( i=0; i < outputSize; i++ )
+         localLastIdxArray[localPeriodArray[i]-lowestPeriod] = i;
+
+      ARRAY_ALLOC(localOutputArray,outputSize);
 
-		   /* Calculation of the MA required. */
-		   retCode = FUNCTION_CALL(MA)( startIdx, endIdx, inReal,
-			                            curPeriod, optInMAType,
-									    VALUE_HANDLE_OUT(localBegIdx),VALUE_HANDLE_OUT(localNbElement),localOutputArray );
+      /* Process each element of the input.
+       * For each possible period value, the MA is calculated
+       * only once and only up to the last output using
+       * that period.
+       *
+       * The TRIMA has no unstable period, so it is also
+       * started at the first output using that period. The
+       * other MA must start at startIdx, else their values
+       * would depend on where each period is first used.
+       *
+       * The outReal is then fill up for all element with
+       * the same period.
+       * A local flag (value 0) is set in localPeriodArray
+       * to avoid doing a second time the same calculation.
+       */
+      for( i=0; i < outputSize; i++ )
+      {
+         curPeriod = localPeriodArray[i];
+         if( curPeriod != 0 )
+         {
+            lastIdx = localLastIdxArray[curPeriod-lowestPeriod];
+            if( optInMAType == ENUM_VALUE(MAType,TA_MAType_TRIMA,Trima) )
+               firstIdx = i;
+            else
+               firstIdx = 0;
 
-           if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
-		   {
-              ARRAY_FREE(localOutputArray);
-			  ARRAY_INT_FREE(localPeriodArray);
-              VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-              VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-              return retCode;
-	       }
+            /* Calculation of the MA required. */
+            retCode = FUNCTION_CALL(MA)( startIdx+firstIdx, startIdx+lastIdx, inReal,
+                                         curPeriod, optInMAType,
+                                         VALUE_HANDLE_OUT(localBegIdx),VALUE_HANDLE_OUT(localNbElement),localOutputArray );
 
-		   outReal[i] = localOutputArray[i];
-		   for( j=i+1; j < outputSize; j++ )
-		   {
-			   if( localPeriodArray[j] == curPeriod )
-			   {
-				   localPeriodArray[j] = 0; /* Flag to avoid recalculation */
-				   outReal[j] = localOutputArray[j];
-			   }
-		   }
-	   }
+            if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+            {
+               ARRAY_FREE(localOutputArray);
+               ARRAY_INT_FREE(localPeriodArray);
+               ARRAY_INT_FREE(localLastIdxArray);
+               VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+               VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+               return retCode;
+            }
+
+            outReal[i] = localOutputArray[i-firstIdx];
+            for( j=i+1; j <= lastIdx; j++ )
+            {
+               if( localPeriodArray[j] == curPeriod )
+               {
+                  localPeriodArray[j] = 0; /* Flag to avoid recalculation */
+                  outReal[j] = localOutputArray[j-firstIdx];
+               }
+            }
+         }
+      }
+
+      ARRAY_FREE(localOutputArray);
+      ARRAY_INT_FREE(localLastIdxArray);
    }
 
-   ARRAY_FREE(localOutputArray);
    ARRAY_INT_FREE(localPeriodArray);
 
    /* Done. Inform the caller of the success. */
@@ -425,8 +565,12 @@ double outReal[],
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    int i, j, lookbackTotal, outputSize, tempInt, curPeriod;
+/* Generated */    int firstIdx, lastIdx, lowestPeriod, nbSum, nbRunningSum;
+/* Generated */    double periodTotal, periodError, tempReal, tempReal2, tempReal3;
 /* Generated */    ARRAY_INT_REF(localPeriodArray);
+/* Generated */    ARRAY_INT_REF(localLastIdxArray);
 /* Generated */    ARRAY_REF(localOutputArray);
+/* Generated */    ARRAY_REF(localSumArray);
 /* Generated */    VALUE_HANDLE_INT(localBegIdx);
 /* Generated */    VALUE_HANDLE_INT(localNbElement);
 /* Generated */    ENUM_DECLARATION(RetCode) retCode;
@@ -481,45 +625,143 @@ double outReal[],
 /* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */    }
 /* Generated */    outputSize = endIdx - tempInt + 1;
-/* Generated */    ARRAY_ALLOC(localOutputArray,outputSize);
 /* Generated */    ARRAY_INT_ALLOC(localPeriodArray,outputSize);
 /* Generated */    for( i=0; i < outputSize; i++ )
 /* Generated */    {
 /* Generated */       tempInt = (int)(inPeriods[startIdx+i]);
 /* Generated */ 	  if( tempInt < optInMinPeriod )
 /* Generated */ 		  tempInt = optInMinPeriod;
-/* Generated */ 	  else if( tempInt > optInMaxPeriod )
+/* Generated */ 	  if( tempInt > optInMaxPeriod )
 /* Generated */           tempInt = optInMaxPeriod;
 /* Generated */       localPeriodArray[i] = tempInt;
 /* Generated */    }
-/* Generated */    for( i=0; i < outputSize; i++ )
+/* Generated */    if( (optInMAType == ENUM_VALUE(MAType,TA_MAType_SMA,Sma)) ||
+/* Generated */        (optInMAType == ENUM_VALUE(MAType,TA_MAType_WMA,Wma)) )
+/* Generated */    {
+/* Generated */       if( optInMAType == ENUM_VALUE(MAType,TA_MAType_WMA,Wma) )
+/* Generated */          nbRunningSum = 2;
+/* Generated */       else
+/* Generated */          nbRunningSum = 1;
+/* Generated */       tempInt = startIdx-lookbackTotal;
+/* Generated */       nbSum   = endIdx-tempInt+2;
+/* Generated */       ARRAY_ALLOC(localSumArray,2*nbRunningSum*nbSum);
+/* Generated */       #if !defined( _JAVA )
+/* Generated */          if( !localSumArray )
+/* Generated */          {
+/* Generated */             ARRAY_INT_FREE(localPeriodArray);
+/* Generated */             VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */             VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */             return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+/* Generated */          }
+/* Generated */       #endif
+/* Generated */       for( j=0; j < 2*nbRunningSum*nbSum; j += 2*nbSum )
+/* Generated */       {
+/* Generated */          periodTotal = 0.0;
+/* Generated */          periodError = 0.0;
+/* Generated */          localSumArray[j] = 0.0;
+/* Generated */          localSumArray[j+nbSum] = 0.0;
+/* Generated */          for( i=1; i < nbSum; i++ )
+/* Generated */          {
+/* Generated */             tempReal = inReal[tempInt+i-1];
+/* Generated */             if( j != 0 )
+/* Generated */                tempReal *= (double)(i-1);
+/* Generated */             tempReal2    = periodTotal+tempReal;
+/* Generated */             tempReal3    = tempReal2-periodTotal;
+/* Generated */             periodError += (periodTotal-(tempReal2-tempReal3))+(tempReal-tempReal3);
+/* Generated */             periodTotal  = tempReal2;
+/* Generated */             localSumArray[j+i] = periodTotal;
+/* Generated */             localSumArray[j+nbSum+i] = periodError;
+/* Generated */          }
+/* Generated */       }
+/* Generated */       for( i=0; i < outputSize; i++ )
+/* Generated */       {
+/* Generated */          j = lookbackTotal+1+i;
+/* Generated */          curPeriod = localPeriodArray[i];
+/* Generated */          tempInt   = j-curPeriod;
+/* Generated */          tempReal  = (localSumArray[j]-localSumArray[tempInt]) +
+/* Generated */                      (localSumArray[nbSum+j]-localSumArray[nbSum+tempInt]);
+/* Generated */          if( nbRunningSum == 2 )
+/* Generated */          {
+/* Generated */             tempReal2 = (localSumArray[2*nbSum+j]-localSumArray[2*nbSum+tempInt]) +
+/* Generated */                         (localSumArray[3*nbSum+j]-localSumArray[3*nbSum+tempInt]);
+/* Generated */             tempReal  = tempReal2-(double)(tempInt-1)*tempReal;
+/* Generated */             outReal[i] = tempReal/((curPeriod*(curPeriod+1))>>1);
+/* Generated */          }
+/* Generated */          else
+/* Generated */             outReal[i] = tempReal/curPeriod;
+/* Generated */       }
+/* Generated */       ARRAY_FREE(localSumArray);
+/* Generated */    }
+/* Generated */    else if( optInMAType == ENUM_VALUE(MAType,TA_MAType_MAMA,Mama) )
+/* Generated */    {
+/* Generated */       ARRAY_ALLOC(localOutputArray,outputSize);
+/* Generated */       retCode = FUNCTION_CALL(MA)( startIdx, endIdx, inReal,
+/* Generated */                                    optInMaxPeriod, optInMAType,
+/* Generated */                                    VALUE_HANDLE_OUT(localBegIdx),VALUE_HANDLE_OUT(localNbElement),localOutputArray );
+/* Generated */       if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+/* Generated */       {
+/* Generated */          ARRAY_FREE(localOutputArray);
+/* Generated */          ARRAY_INT_FREE(localPeriodArray);
+/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */          return retCode;
+/* Generated */       }
+/* Generated */       for( i=0; i < outputSize; i++ )
+/* Generated */          outReal[i] = localOutputArray[i];
+/* Generated */       ARRAY_FREE(localOutputArray);
+/* Generated */    }
+/* Generated */    else
 /* Generated */    {
-/* Generated */ 	   curPeriod = localPeriodArray[i];
-/* Generated */ 	   if( curPeriod != 0 )
-/* Generated */ 	   {
-/* Generated */ 		   retCode = FUNCTION_CALL(MA)( startIdx, endIdx, inReal,
-/* Generated */ 			                            curPeriod, optInMAType,
-/* Generated */ 									    VALUE_HANDLE_OUT(localBegIdx),VALUE_HANDLE_OUT(localNbElement),localOutputArray );
-/* Generated */            if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
-/* Generated */ 		   {
-/* Generated */               ARRAY_FREE(localOutputArray);
-/* Generated */ 			  ARRAY_INT_FREE(localPeriodArray);
-/* Generated */               VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-/* Generated */               VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-/* Generated */               return retCode;
-/* Generated */ 	       }
-/* Generated */ 		   outReal[i] = localOutputArray[i];
-/* Generated */ 		   for( j=i+1; j < outputSize; j++ )
-/* Generated */ 		   {
-/* Generated */ 			   if( localPeriodArray[j] == curPeriod )
-/* Generated */ 			   {
-/* Generated */ 				   localPeriodArray[j] = 0; 
-/* Generated */ 				   outReal[j] = localOutputArray[j];
-/* Generated */ 			   }
-/* Generated */ 		   }
-/* Generated */ 	   }
+/* Generated */       lowestPeriod = optInMinPeriod < optInMaxPeriod? optInMinPeriod : optInMaxPeriod;
+/* Generated */       ARRAY_INT_ALLOC(localLastIdxArray,optInMaxPeriod-lowestPeriod+1);
+/* Generated */       #if !defined( _JAVA )
+/* Generated */          if( !localLastIdxArray )
+/* Generated */          {
+/* Generated */             ARRAY_INT_FREE(localPeriodArray);
+/* Generated */             VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */             VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */             return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+/* Generated */          }
+/* Generated */       #endif
+/* Generated */       for( i=0; i < outputSize; i++ )
+/* Generated */          localLastIdxArray[localPeriodArray[i]-lowestPeriod] = i;
+/* Generated */       ARRAY_ALLOC(localOutputArray,outputSize);
+/* Generated */       for( i=0; i < outputSize; i++ )
+/* Generated */       {
+/* Generated */          curPeriod = localPeriodArray[i];
+/* Generated */          if( curPeriod != 0 )
+/* Generated */          {
+/* Generated */             lastIdx = localLastIdxArray[curPeriod-lowestPeriod];
+/* Generated */             if( optInMAType == ENUM_VALUE(MAType,TA_MAType_TRIMA,Trima) )
+/* Generated */                firstIdx = i;
+/* Generated */             else
+/* Generated */                firstIdx = 0;
+/* Generated */             retCode = FUNCTION_CALL(MA)( startIdx+firstIdx, startIdx+lastIdx, inReal,
+/* Generated */                                          curPeriod, optInMAType,
+/* Generated */                                          VALUE_HANDLE_OUT(localBegIdx),VALUE_HANDLE_OUT(localNbElement),localOutputArray );
+/* Generated */             if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+/* Generated */             {
+/* Generated */                ARRAY_FREE(localOutputArray);
+/* Generated */                ARRAY_INT_FREE(localPeriodArray);
+/* Generated */                ARRAY_INT_FREE(localLastIdxArray);
+/* Generated */                VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */                VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */                return retCode;
+/* Generated */             }
+/* Generated */             outReal[i] = localOutputArray[i-firstIdx];
+/* Generated */             for( j=i+1; j <= lastIdx; j++ )
+/* Generated */             {
+/* Generated */                if( localPeriodArray[j] == curPeriod )
+/* Generated */                {
+/* Generated */                   localPeriodArray[j] = 0; 
+/* Generated */                   outReal[j] = localOutputArray[j-firstIdx];
+/* Generated */                }
+/* Generated */             }
+/* Generated */          }
+/* Generated */       }
+/* Generated */       ARRAY_FREE(localOutputArray);
+/* Generated */       ARRAY_INT_FREE(localLastIdxArray);
 /* Generated */    }
-/* Generated */    ARRAY_FREE(localOutputArray);
 /* Generated */    ARRAY_INT_FREE(localPeriodArray);
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outputSize;
@@ -180,7 +180,8 @@ double outReal[],
    /* Insert local variables here. */
    double highest, tmp;
    int outIdx, nbInitialElementNeeded;
-   int trailingIdx, today, i, highestIdx;
+   int trailingIdx, today, highestIdx;
+   WINDOW_EXTREME_VARIABLES(highestWindow);
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -246,24 +247,16 @@ double outReal[],
    highestIdx  = -1;
    highest     = 0.0;
 
+   INIT_WINDOW_EXTREME(highestWindow,optInTimePeriod);
+
    while( today <= endIdx )
    {
       tmp = inReal[today];
 
       if( highestIdx < trailingIdx )
       {
-        highestIdx = trailingIdx;
+        WINDOW_HIGHEST_FIND(highestWindow,inReal,trailingIdx,today,highestIdx);
         highest = inReal[highestIdx];
-        i = highestIdx;
-        while( ++i<=today )
-        {
-           tmp = inReal[i];
-           if( tmp > highest )
-           {
-              highestIdx = i;
-              highest = tmp;
-           }
-        }
       }
       else if( tmp >= highest )
       {
@@ -276,6 +269,8 @@ double outReal[],
       today++;
    }
 
+   FREE_WINDOW_EXTREME(highestWindow);
+
    /* Keep the outBegIdx relative to the
     * caller input before returning.
     */
@@ -334,7 +329,8 @@ double outReal[],
 /* Generated */ {
 /* Generated */    double highest, tmp;
 /* Generated */    int outIdx, nbInitialElementNeeded;
-/* Generated */    int trailingIdx, today, i, highestIdx;
+/* Generated */    int trailingIdx, today, highestIdx;
+/* Generated */    WINDOW_EXTREME_VARIABLES(highestWindow);
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -369,23 +365,14 @@ double outReal[],
 /* Generated */    trailingIdx = startIdx-nbInitialElementNeeded;
 /* Generated */    highestIdx  = -1;
 /* Generated */    highest     = 0.0;
+/* Generated */    INIT_WINDOW_EXTREME(highestWindow,optInTimePeriod);
 /* Generated */    while( today <= endIdx )
 /* Generated */    {
 /* Generated */       tmp = inReal[today];
 /* Generated */       if( highestIdx < trailingIdx )
 /* Generated */       {
-/* Generated */         highestIdx = trailingIdx;
+/* Generated */         WINDOW_HIGHEST_FIND(highestWindow,inReal,trailingIdx,today,highestIdx);
 /* Generated */         highest = inReal[highestIdx];
-/* Generated */         i = highestIdx;
-/* Generated */         while( ++i<=today )
-/* Generated */         {
-/* Generated */            tmp = inReal[i];
-/* Generated */            if( tmp > highest )
-/* Generated */            {
-/* Generated */               highestIdx = i;
-/* Generated */               highest = tmp;
-/* Generated */            }
-/* Generated */         }
 /* Generated */       }
 /* Generated */       else if( tmp >= highest )
 /* Generated */       {
@@ -396,6 +383,7 @@ double outReal[],
 /* Generated */       trailingIdx++;
 /* Generated */       today++;
 /* Generated */    }
+/* Generated */    FREE_WINDOW_EXTREME(highestWindow);
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
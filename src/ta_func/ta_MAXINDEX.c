@@ -175,7 +175,8 @@ mut outNBElement,
    /* Insert local variables here. */
    double highest, tmp;
    int outIdx, nbInitialElementNeeded;
-   int trailingIdx, today, i, highestIdx;
+   int trailingIdx, today, highestIdx;
+   WINDOW_EXTREME_VARIABLES(highestWindow);
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -241,24 +242,16 @@ mut outNBElement,
    highestIdx  = -1;
    highest     = 0.0;
 
+   INIT_WINDOW_EXTREME(highestWindow,optInTimePeriod);
+
    while( today <= endIdx )
    {
       tmp = inReal[today];
 
       if( highestIdx < trailingIdx )
       {
-        highestIdx = trailingIdx;
+        WINDOW_HIGHEST_FIND(highestWindow,inReal,trailingIdx,today,highestIdx);
         highest = inReal[highestIdx];
-        i = highestIdx;
-        while( ++i<=today )
-        {
-           tmp = inReal[i];
-           if( tmp > highest )
-           {
-              highestIdx = i;
-              highest = tmp;
-           }
-        }
       }
       else if( tmp >= highest )
       {
@@ -271,6 +264,8 @@ mut outNBElement,
       today++;
    }
 
+   FREE_WINDOW_EXTREME(highestWindow);
+
    /* Keep the outBegIdx relative to the
     * caller input before returning.
     */
@@ -329,7 +324,8 @@ mut outNBElement,
 /* Generated */ {
 /* Generated */    double highest, tmp;
 /* Generated */    int outIdx, nbInitialElementNeeded;
-/* Generated */    int trailingIdx, today, i, highestIdx;
+/* Generated */    int trailingIdx, today, highestIdx;
+/* Generated */    WINDOW_EXTREME_VARIABLES(highestWindow);
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -364,23 +360,14 @@ mut outNBElement,
 /* Generated */    trailingIdx = startIdx-nbInitialElementNeeded;
 /* Generated */    highestIdx  = -1;
 /* Generated */    highest     = 0.0;
+/* Generated */    INIT_WINDOW_EXTREME(highestWindow,optInTimePeriod);
 /* Generated */    while( today <= endIdx )
 /* Generated */    {
 /* Generated */       tmp = inReal[today];
 /* Generated */       if( highestIdx < trailingIdx )
 /* Generated */       {
-/* Generated */         highestIdx = trailingIdx;
+/* Generated */         WINDOW_HIGHEST_FIND(highestWindow,inReal,trailingIdx,today,highestIdx);
 /* Generated */         highest = inReal[highestIdx];
-/* Generated */         i = highestIdx;
-/* Generated */         while( ++i<=today )
-/* Generated */         {
-/* Generated */            tmp = inReal[i];
-/* Generated */            if( tmp > highest )
-/* Generated */            {
-/* Generated */               highestIdx = i;
-/* Generated */               highest = tmp;
-/* Generated */            }
-/* Generated */         }
 /* Generated */       }
 /* Generated */       else if( tmp >= highest )
 /* Generated */       {
@@ -391,6 +378,7 @@ mut outNBElement,
 /* Generated */       trailingIdx++;
 /* Generated */       today++;
 /* Generated */    }
+/* Generated */    FREE_WINDOW_EXTREME(highestWindow);
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
@@ -210,7 +210,7 @@ double outReal[],
    double tempValue1, tempValue2;
    int lookbackTotal, outIdx, i, today;
 
-   CIRCBUF_PROLOG_CLASS( mflow, MoneyFlow, 50 ); /* Id, Type, Static Size */
+   CIRCBUF_PROLOG_CLASS( mflow, MoneyFlow, TA_MFI_LOCAL_SIZE ); /* Id, Type, Static Size */
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -463,7 +463,7 @@ double outReal[],
 /* Generated */    double posSumMF, negSumMF, prevValue;
 /* Generated */    double tempValue1, tempValue2;
 /* Generated */    int lookbackTotal, outIdx, i, today;
-/* Generated */    CIRCBUF_PROLOG_CLASS( mflow, MoneyFlow, 50 ); 
+/* Generated */    CIRCBUF_PROLOG_CLASS( mflow, MoneyFlow, TA_MFI_LOCAL_SIZE ); 
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
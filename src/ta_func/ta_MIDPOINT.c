@@ -177,7 +177,9 @@ double outReal[],
 
    double lowest, highest, tmp;
    int outIdx, nbInitialElementNeeded;
-   int trailingIdx, today, i;
+   int trailingIdx, today, highestIdx, lowestIdx;
+   WINDOW_EXTREME_VARIABLES(highestWindow);
+   WINDOW_EXTREME_VARIABLES(lowestWindow);
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -248,22 +250,47 @@ double outReal[],
    outIdx = 0;
    today       = startIdx;
    trailingIdx = startIdx-nbInitialElementNeeded;
+   highestIdx  = -1;
+   lowestIdx   = -1;
+   highest     = 0.0;
+   lowest      = 0.0;
+
+   INIT_WINDOW_EXTREME_PAIR(highestWindow,lowestWindow,optInTimePeriod);
 
    while( today <= endIdx )
    {
-      lowest  = inReal[trailingIdx++];
-      highest = lowest;
-      for( i=trailingIdx; i <= today; i++ )
+      tmp = inReal[today];
+
+      if( highestIdx < trailingIdx )
+      {
+        WINDOW_HIGHEST_FIND(highestWindow,inReal,trailingIdx,today,highestIdx);
+        highest = inReal[highestIdx];
+      }
+      else if( tmp >= highest )
+      {
+        highestIdx = today;
+        highest = tmp;
+      }
+
+      if( lowestIdx < trailingIdx )
+      {
+        WINDOW_LOWEST_FIND(lowestWindow,inReal,trailingIdx,today,lowestIdx);
+        lowest = inReal[lowestIdx];
+      }
+      else if( tmp <= lowest )
       {
-         tmp = inReal[i];
-         if( tmp < lowest ) lowest= tmp;
-         else if( tmp > highest) highest = tmp;
+        lowestIdx = today;
+        lowest = tmp;
       }
 
       outReal[outIdx++] = (highest+lowest)/2.0;
+      trailingIdx++;
       today++;
    }
 
+   FREE_WINDOW_EXTREME(highestWindow);
+   FREE_WINDOW_EXTREME(lowestWindow);
+
    /* Keep the outBegIdx relative to the
     * caller input before returning.
     */
@@ -322,7 +349,9 @@ double outReal[],
 /* Generated */ {
 /* Generated */    double lowest, highest, tmp;
 /* Generated */    int outIdx, nbInitialElementNeeded;
-/* Generated */    int trailingIdx, today, i;
+/* Generated */    int trailingIdx, today, highestIdx, lowestIdx;
+/* Generated */    WINDOW_EXTREME_VARIABLES(highestWindow);
+/* Generated */    WINDOW_EXTREME_VARIABLES(lowestWindow);
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -355,19 +384,40 @@ double outReal[],
 /* Generated */    outIdx = 0;
 /* Generated */    today       = startIdx;
 /* Generated */    trailingIdx = startIdx-nbInitialElementNeeded;
+/* Generated */    highestIdx  = -1;
+/* Generated */    lowestIdx   = -1;
+/* Generated */    highest     = 0.0;
+/* Generated */    lowest      = 0.0;
+/* Generated */    INIT_WINDOW_EXTREME_PAIR(highestWindow,lowestWindow,optInTimePeriod);
 /* Generated */    while( today <= endIdx )
 /* Generated */    {
-/* Generated */       lowest  = inReal[trailingIdx++];
-/* Generated */       highest = lowest;
-/* Generated */       for( i=trailingIdx; i <= today; i++ )
+/* Generated */       tmp = inReal[today];
+/* Generated */       if( highestIdx < trailingIdx )
+/* Generated */       {
+/* Generated */         WINDOW_HIGHEST_FIND(highestWindow,inReal,trailingIdx,today,highestIdx);
+/* Generated */         highest = inReal[highestIdx];
+/* Generated */       }
+/* Generated */       else if( tmp >= highest )
+/* Generated */       {
+/* Generated */         highestIdx = today;
+/* Generated */         highest = tmp;
+/* Generated */       }
+/* Generated */       if( lowestIdx < trailingIdx )
+/* Generated */       {
+/* Generated */         WINDOW_LOWEST_FIND(lowestWindow,inReal,trailingIdx,today,lowestIdx);
+/* Generated */         lowest = inReal[lowestIdx];
+/* Generated */       }
+/* Generated */       else if( tmp <= lowest )
 /* Generated */       {
-/* Generated */          tmp = inReal[i];
-/* Generated */          if( tmp < lowest ) lowest= tmp;
-/* Generated */          else if( tmp > highest) highest = tmp;
+/* Generated */         lowestIdx = today;
+/* Generated */         lowest = tmp;
 /* Generated */       }
 /* Generated */       outReal[outIdx++] = (highest+lowest)/2.0;
+/* Generated */       trailingIdx++;
 /* Generated */       today++;
 /* Generated */    }
+/* Generated */    FREE_WINDOW_EXTREME(highestWindow);
+/* Generated */    FREE_WINDOW_EXTREME(lowestWindow);
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
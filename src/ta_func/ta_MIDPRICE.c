@@ -180,7 +180,9 @@ double outReal[],
 	/* insert local variable here */
    double lowest, highest, tmp;
    int outIdx, nbInitialElementNeeded;
-   int trailingIdx, today, i;
+   int trailingIdx, today, highestIdx, lowestIdx;
+   WINDOW_EXTREME_VARIABLES(highestWindow);
+   WINDOW_EXTREME_VARIABLES(lowestWindow);
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -252,24 +254,47 @@ double outReal[],
    outIdx = 0;
    today       = startIdx;
    trailingIdx = startIdx-nbInitialElementNeeded;
+   highestIdx  = -1;
+   lowestIdx   = -1;
+   highest     = 0.0;
+   lowest      = 0.0;
+
+   INIT_WINDOW_EXTREME_PAIR(highestWindow,lowestWindow,optInTimePeriod);
 
    while( today <= endIdx )
    {
-      lowest  = inLow[trailingIdx];
-      highest = inHigh[trailingIdx];
-      trailingIdx++;
-      for( i=trailingIdx; i <= today; i++ )
+      tmp = inHigh[today];
+      if( highestIdx < trailingIdx )
+      {
+        WINDOW_HIGHEST_FIND(highestWindow,inHigh,trailingIdx,today,highestIdx);
+        highest = inHigh[highestIdx];
+      }
+      else if( tmp >= highest )
+      {
+        highestIdx = today;
+        highest = tmp;
+      }
+
+      tmp = inLow[today];
+      if( lowestIdx < trailingIdx )
       {
-         tmp = inLow[i];
-         if( tmp < lowest ) lowest= tmp;
-         tmp = inHigh[i];
-         if( tmp > highest) highest = tmp;
+        WINDOW_LOWEST_FIND(lowestWindow,inLow,trailingIdx,today,lowestIdx);
+        lowest = inLow[lowestIdx];
+      }
+      else if( tmp <= lowest )
+      {
+        lowestIdx = today;
+        lowest = tmp;
       }
 
       outReal[outIdx++] = (highest+lowest)/2.0;
+      trailingIdx++;
       today++;
    }
 
+   FREE_WINDOW_EXTREME(highestWindow);
+   FREE_WINDOW_EXTREME(lowestWindow);
+
    /* Keep the outBegIdx relative to the
     * caller input before returning.
     */
@@ -332,7 +357,9 @@ double outReal[],
 /* Generated */ {
 /* Generated */    double lowest, highest, tmp;
 /* Generated */    int outIdx, nbInitialElementNeeded;
-/* Generated */    int trailingIdx, today, i;
+/* Generated */    int trailingIdx, today, highestIdx, lowestIdx;
+/* Generated */    WINDOW_EXTREME_VARIABLES(highestWindow);
+/* Generated */    WINDOW_EXTREME_VARIABLES(lowestWindow);
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -366,21 +393,41 @@ double outReal[],
 /* Generated */    outIdx = 0;
 /* Generated */    today       = startIdx;
 /* Generated */    trailingIdx = startIdx-nbInitialElementNeeded;
+/* Generated */    highestIdx  = -1;
+/* Generated */    lowestIdx   = -1;
+/* Generated */    highest     = 0.0;
+/* Generated */    lowest      = 0.0;
+/* Generated */    INIT_WINDOW_EXTREME_PAIR(highestWindow,lowestWindow,optInTimePeriod);
 /* Generated */    while( today <= endIdx )
 /* Generated */    {
-/* Generated */       lowest  = inLow[trailingIdx];
-/* Generated */       highest = inHigh[trailingIdx];
-/* Generated */       trailingIdx++;
-/* Generated */       for( i=trailingIdx; i <= today; i++ )
+/* Generated */       tmp = inHigh[today];
+/* Generated */       if( highestIdx < trailingIdx )
 /* Generated */       {
-/* Generated */          tmp = inLow[i];
-/* Generated */          if( tmp < lowest ) lowest= tmp;
-/* Generated */          tmp = inHigh[i];
-/* Generated */          if( tmp > highest) highest = tmp;
+/* Generated */         WINDOW_HIGHEST_FIND(highestWindow,inHigh,trailingIdx,today,highestIdx);
+/* Generated */         highest = inHigh[highestIdx];
+/* Generated */       }
+/* Generated */       else if( tmp >= highest )
+/* Generated */       {
+/* Generated */         highestIdx = today;
+/* Generated */         highest = tmp;
+/* Generated */       }
+/* Generated */       tmp = inLow[today];
+/* Generated */       if( lowestIdx < trailingIdx )
+/* Generated */       {
+/* Generated */         WINDOW_LOWEST_FIND(lowestWindow,inLow,trailingIdx,today,lowestIdx);
+/* Generated */         lowest = inLow[lowestIdx];
+/* Generated */       }
+/* Generated */       else if( tmp <= lowest )
+/* Generated */       {
+/* Generated */         lowestIdx = today;
+/* Generated */         lowest = tmp;
 /* Generated */       }
 /* Generated */       outReal[outIdx++] = (highest+lowest)/2.0;
+/* Generated */       trailingIdx++;
 /* Generated */       today++;
 /* Generated */    }
+/* Generated */    FREE_WINDOW_EXTREME(highestWindow);
+/* Generated */    FREE_WINDOW_EXTREME(lowestWindow);
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
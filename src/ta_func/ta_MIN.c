@@ -180,7 +180,8 @@ double outReal[],
    /* Insert local variables here. */
    double lowest, tmp;
    int outIdx, nbInitialElementNeeded;
-   int trailingIdx, lowestIdx, today, i;
+   int trailingIdx, lowestIdx, today;
+   WINDOW_EXTREME_VARIABLES(lowestWindow);
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -246,24 +247,16 @@ double outReal[],
    lowestIdx   = -1;
    lowest      = 0.0;
 
+   INIT_WINDOW_EXTREME(lowestWindow,optInTimePeriod);
+
    while( today <= endIdx )
    {
       tmp = inReal[today];
 
       if( lowestIdx < trailingIdx )
       {
-        lowestIdx = trailingIdx;
+        WINDOW_LOWEST_FIND(lowestWindow,inReal,trailingIdx,today,lowestIdx);
         lowest = inReal[lowestIdx];
-        i = lowestIdx;
-        while( ++i<=today )
-        {
-           tmp = inReal[i];
-           if( tmp < lowest )
-           {
-              lowestIdx = i;
-              lowest = tmp;
-           }
-        }
       }
       else if( tmp <= lowest )
       {
@@ -276,6 +269,8 @@ double outReal[],
       today++;
    }
 
+   FREE_WINDOW_EXTREME(lowestWindow);
+
    /* Keep the outBegIdx relative to the
     * caller input before returning.
     */
@@ -334,7 +329,8 @@ double outReal[],
 /* Generated */ {
 /* Generated */    double lowest, tmp;
 /* Generated */    int outIdx, nbInitialElementNeeded;
-/* Generated */    int trailingIdx, lowestIdx, today, i;
+/* Generated */    int trailingIdx, lowestIdx, today;
+/* Generated */    WINDOW_EXTREME_VARIABLES(lowestWindow);
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -369,23 +365,14 @@ double outReal[],
 /* Generated */    trailingIdx = startIdx-nbInitialElementNeeded;
 /* Generated */    lowestIdx   = -1;
 /* Generated */    lowest      = 0.0;
+/* Generated */    INIT_WINDOW_EXTREME(lowestWindow,optInTimePeriod);
 /* Generated */    while( today <= endIdx )
 /* Generated */    {
 /* Generated */       tmp = inReal[today];
 /* Generated */       if( lowestIdx < trailingIdx )
 /* Generated */       {
-/* Generated */         lowestIdx = trailingIdx;
+/* Generated */         WINDOW_LOWEST_FIND(lowestWindow,inReal,trailingIdx,today,lowestIdx);
 /* Generated */         lowest = inReal[lowestIdx];
-/* Generated */         i = lowestIdx;
-/* Generated */         while( ++i<=today )
-/* Generated */         {
-/* Generated */            tmp = inReal[i];
-/* Generated */            if( tmp < lowest )
-/* Generated */            {
-/* Generated */               lowestIdx = i;
-/* Generated */               lowest = tmp;
-/* Generated */            }
-/* Generated */         }
 /* Generated */       }
 /* Generated */       else if( tmp <= lowest )
 /* Generated */       {
@@ -396,6 +383,7 @@ double outReal[],
 /* Generated */       trailingIdx++;
 /* Generated */       today++;
 /* Generated */    }
+/* Generated */    FREE_WINDOW_EXTREME(lowestWindow);
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
@@ -175,7 +175,8 @@ mut outNBElement,
    /* Insert local variables here. */
    double lowest, tmp;
    int outIdx, nbInitialElementNeeded;
-   int trailingIdx, lowestIdx, today, i;
+   int trailingIdx, lowestIdx, today;
+   WINDOW_EXTREME_VARIABLES(lowestWindow);
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -241,24 +242,16 @@ mut outNBElement,
    lowestIdx   = -1;
    lowest      = 0.0;
 
+   INIT_WINDOW_EXTREME(lowestWindow,optInTimePeriod);
+
    while( today <= endIdx )
    {
       tmp = inReal[today];
 
       if( lowestIdx < trailingIdx )
       {
-        lowestIdx = trailingIdx;
+        WINDOW_LOWEST_FIND(lowestWindow,inReal,trailingIdx,today,lowestIdx);
         lowest = inReal[lowestIdx];
-        i = lowestIdx;
-        while( ++i<=today )
-        {
-           tmp = inReal[i];
-           if( tmp < lowest )
-           {
-              lowestIdx = i;
-              lowest = tmp;
-           }
-        }
       }
       else if( tmp <= lowest )
       {
@@ -271,6 +264,8 @@ mut outNBElement,
       today++;
    }
 
+   FREE_WINDOW_EXTREME(lowestWindow);
+
    /* Keep the outBegIdx relative to the
     * caller input before returning.
     */
@@ -329,7 +324,8 @@ mut outNBElement,
 /* Generated */ {
 /* Generated */    double lowest, tmp;
 /* Generated */    int outIdx, nbInitialElementNeeded;
-/* Generated */    int trailingIdx, lowestIdx, today, i;
+/* Generated */    int trailingIdx, lowestIdx, today;
+/* Generated */    WINDOW_EXTREME_VARIABLES(lowestWindow);
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -364,23 +360,14 @@ mut outNBElement,
 /* Generated */    trailingIdx = startIdx-nbInitialElementNeeded;
 /* Generated */    lowestIdx   = -1;
 /* Generated */    lowest      = 0.0;
+/* Generated */    INIT_WINDOW_EXTREME(lowestWindow,optInTimePeriod);
 /* Generated */    while( today <= endIdx )
 /* Generated */    {
 /* Generated */       tmp = inReal[today];
 /* Generated */       if( lowestIdx < trailingIdx )
 /* Generated */       {
-/* Generated */         lowestIdx = trailingIdx;
+/* Generated */         WINDOW_LOWEST_FIND(lowestWindow,inReal,trailingIdx,today,lowestIdx);
 /* Generated */         lowest = inReal[lowestIdx];
-/* Generated */         i = lowestIdx;
-/* Generated */         while( ++i<=today )
-/* Generated */         {
-/* Generated */            tmp = inReal[i];
-/* Generated */            if( tmp < lowest )
-/* Generated */            {
-/* Generated */               lowestIdx = i;
-/* Generated */               lowest = tmp;
-/* Generated */            }
-/* Generated */         }
 /* Generated */       }
 /* Generated */       else if( tmp <= lowest )
 /* Generated */       {
@@ -391,6 +378,7 @@ mut outNBElement,
 /* Generated */       trailingIdx++;
 /* Generated */       today++;
 /* Generated */    }
+/* Generated */    FREE_WINDOW_EXTREME(lowestWindow);
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
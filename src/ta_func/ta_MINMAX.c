@@ -180,7 +180,9 @@ double outMax[],
    /* Insert local variables here. */
    double highest, lowest, tmpHigh, tmpLow;
    int outIdx, nbInitialElementNeeded;
-   int trailingIdx, today, i, highestIdx, lowestIdx;
+   int trailingIdx, today, highestIdx, lowestIdx;
+   WINDOW_EXTREME_VARIABLES(highestWindow);
+   WINDOW_EXTREME_VARIABLES(lowestWindow);
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -251,24 +253,16 @@ double outMax[],
    lowestIdx   = -1;
    lowest      = 0.0;
 
+   INIT_WINDOW_EXTREME_PAIR(highestWindow,lowestWindow,optInTimePeriod);
+
    while( today <= endIdx )
    {
       tmpLow = tmpHigh = inReal[today];
 
       if( highestIdx < trailingIdx )
       {
-        highestIdx = trailingIdx;
+        WINDOW_HIGHEST_FIND(highestWindow,inReal,trailingIdx,today,highestIdx);
         highest = inReal[highestIdx];
-        i = highestIdx;
-        while( ++i<=today )
-        {
-           tmpHigh = inReal[i];
-           if( tmpHigh > highest )
-           {
-              highestIdx = i;
-              highest = tmpHigh;
-           }
-        }
       }
       else if( tmpHigh >= highest )
       {
@@ -278,18 +272,8 @@ double outMax[],
 
       if( lowestIdx < trailingIdx )
       {
-        lowestIdx = trailingIdx;
+        WINDOW_LOWEST_FIND(lowestWindow,inReal,trailingIdx,today,lowestIdx);
         lowest = inReal[lowestIdx];
-        i = lowestIdx;
-        while( ++i<=today )
-        {
-           tmpLow = inReal[i];
-           if( tmpLow < lowest )
-           {
-              lowestIdx = i;
-              lowest = tmpLow;
-           }
-        }
       }
       else if( tmpLow <= lowest )
       {
@@ -304,6 +288,9 @@ double outMax[],
       today++;
    }
 
+   FREE_WINDOW_EXTREME(highestWindow);
+   FREE_WINDOW_EXTREME(lowestWindow);
+
    /* Keep the outBegIdx relative to the
     * caller input before returning.
     */
@@ -366,7 +353,9 @@ double outMax[],
 /* Generated */ {
 /* Generated */    double highest, lowest, tmpHigh, tmpLow;
 /* Generated */    int outIdx, nbInitialElementNeeded;
-/* Generated */    int trailingIdx, today, i, highestIdx, lowestIdx;
+/* Generated */    int trailingIdx, today, highestIdx, lowestIdx;
+/* Generated */    WINDOW_EXTREME_VARIABLES(highestWindow);
+/* Generated */    WINDOW_EXTREME_VARIABLES(lowestWindow);
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -405,23 +394,14 @@ double outMax[],
 /* Generated */    highest     = 0.0;
 /* Generated */    lowestIdx   = -1;
 /* Generated */    lowest      = 0.0;
+/* Generated */    INIT_WINDOW_EXTREME_PAIR(highestWindow,lowestWindow,optInTimePeriod);
 /* Generated */    while( today <= endIdx )
 /* Generated */    {
 /* Generated */       tmpLow = tmpHigh = inReal[today];
 /* Generated */       if( highestIdx < trailingIdx )
 /* Generated */       {
-/* Generated */         highestIdx = trailingIdx;
+/* Generated */         WINDOW_HIGHEST_FIND(highestWindow,inReal,trailingIdx,today,highestIdx);
 /* Generated */         highest = inReal[highestIdx];
-/* Generated */         i = highestIdx;
-/* Generated */         while( ++i<=today )
-/* Generated */         {
-/* Generated */            tmpHigh = inReal[i];
-/* Generated */            if( tmpHigh > highest )
-/* Generated */            {
-/* Generated */               highestIdx = i;
-/* Generated */               highest = tmpHigh;
-/* Generated */            }
-/* Generated */         }
 /* Generated */       }
 /* Generated */       else if( tmpHigh >= highest )
 /* Generated */       {
@@ -430,18 +410,8 @@ double outMax[],
 /* Generated */       }
 /* Generated */       if( lowestIdx < trailingIdx )
 /* Generated */       {
-/* Generated */         lowestIdx = trailingIdx;
+/* Generated */         WINDOW_LOWEST_FIND(lowestWindow,inReal,trailingIdx,today,lowestIdx);
 /* Generated */         lowest = inReal[lowestIdx];
-/* Generated */         i = lowestIdx;
-/* Generated */         while( ++i<=today )
-/* Generated */         {
-/* Generated */            tmpLow = inReal[i];
-/* Generated */            if( tmpLow < lowest )
-/* Generated */            {
-/* Generated */               lowestIdx = i;
-/* Generated */               lowest = tmpLow;
-/* Generated */            }
-/* Generated */         }
 /* Generated */       }
 /* Generated */       else if( tmpLow <= lowest )
 /* Generated */       {
@@ -454,6 +424,8 @@ double outMax[],
 /* Generated */       trailingIdx++;
 /* Generated */       today++;
 /* Generated */    }
+/* Generated */    FREE_WINDOW_EXTREME(highestWindow);
+/* Generated */    FREE_WINDOW_EXTREME(lowestWindow);
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
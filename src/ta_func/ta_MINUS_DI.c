@@ -424,11 +424,7 @@ double outReal[],
       tempReal = inLow[today];
       diffM    = prevLow-tempReal;   /* Minus Delta */
       prevLow  = tempReal;
-      if( (diffM > 0) && (diffP < diffM) )
-      {
-         /* Case 2 and 4: +DM=0,-DM=diffM */
-         prevMinusDM += diffM;
-      }
+      prevMinusDM += TA_MINUS_DM1(diffP,diffM);
 
       TRUE_RANGE(prevHigh,prevLow,prevClose,tempReal);
       prevTR += tempReal;
@@ -451,20 +447,11 @@ double outReal[],
       tempReal = inLow[today];
       diffM    = prevLow-tempReal;   /* Minus Delta */
       prevLow  = tempReal;
-      if( (diffM > 0) && (diffP < diffM) )
-      {
-         /* Case 2 and 4: +DM=0,-DM=diffM */
-         prevMinusDM = prevMinusDM - (prevMinusDM/optInTimePeriod) + diffM;
-      }
-      else
-      {
-         /* Case 1,3,5 and 7 */
-         prevMinusDM = prevMinusDM - (prevMinusDM/optInTimePeriod);
-      }
+      prevMinusDM = TA_WILDER_SUM_STEP(prevMinusDM,TA_MINUS_DM1(diffP,diffM),optInTimePeriod);
 
       /* Calculate the prevTR */
       TRUE_RANGE(prevHigh,prevLow,prevClose,tempReal);
-      prevTR = prevTR - (prevTR/optInTimePeriod) + tempReal;
+      prevTR = TA_WILDER_SUM_STEP(prevTR,tempReal,optInTimePeriod);
       prevClose = inClose[today];
    }
 
@@ -488,20 +475,11 @@ double outReal[],
       tempReal = inLow[today];
       diffM    = prevLow-tempReal;   /* Minus Delta */
       prevLow  = tempReal;
-      if( (diffM > 0) && (diffP < diffM) )
-      {
-         /* Case 2 and 4: +DM=0,-DM=diffM */
-         prevMinusDM = prevMinusDM - (prevMinusDM/optInTimePeriod) + diffM;
-      }
-      else
-      {
-         /* Case 1,3,5 and 7 */
-         prevMinusDM = prevMinusDM - (prevMinusDM/optInTimePeriod);
-      }
+      prevMinusDM = TA_WILDER_SUM_STEP(prevMinusDM,TA_MINUS_DM1(diffP,diffM),optInTimePeriod);
 
       /* Calculate the prevTR */
       TRUE_RANGE(prevHigh,prevLow,prevClose,tempReal);
-      prevTR = prevTR - (prevTR/optInTimePeriod) + tempReal;
+      prevTR = TA_WILDER_SUM_STEP(prevTR,tempReal,optInTimePeriod);
       prevClose = inClose[today];
 
       /* Calculate the DI. The value is rounded (see Wilder book). */
@@ -669,10 +647,7 @@ double outReal[],
 /* Generated */       tempReal = inLow[today];
 /* Generated */       diffM    = prevLow-tempReal;   
 /* Generated */       prevLow  = tempReal;
-/* Generated */       if( (diffM > 0) && (diffP < diffM) )
-/* Generated */       {
-/* Generated */          prevMinusDM += diffM;
-/* Generated */       }
+/* Generated */       prevMinusDM += TA_MINUS_DM1(diffP,diffM);
 /* Generated */       TRUE_RANGE(prevHigh,prevLow,prevClose,tempReal);
 /* Generated */       prevTR += tempReal;
 /* Generated */       prevClose = inClose[today];
@@ -687,16 +662,9 @@ double outReal[],
 /* Generated */       tempReal = inLow[today];
 /* Generated */       diffM    = prevLow-tempReal;   
 /* Generated */       prevLow  = tempReal;
-/* Generated */       if( (diffM > 0) && (diffP < diffM) )
-/* Generated */       {
-/* Generated */          prevMinusDM = prevMinusDM - (prevMinusDM/optInTimePeriod) + diffM;
-/* Generated */       }
-/* Generated */       else
-/* Generated */       {
-/* Generated */          prevMinusDM = prevMinusDM - (prevMinusDM/optInTimePeriod);
-/* Generated */       }
+/* Generated */       prevMinusDM = TA_WILDER_SUM_STEP(prevMinusDM,TA_MINUS_DM1(diffP,diffM),optInTimePeriod);
 /* Generated */       TRUE_RANGE(prevHigh,prevLow,prevClose,tempReal);
-/* Generated */       prevTR = prevTR - (prevTR/optInTimePeriod) + tempReal;
+/* Generated */       prevTR = TA_WILDER_SUM_STEP(prevTR,tempReal,optInTimePeriod);
 /* Generated */       prevClose = inClose[today];
 /* Generated */    }
 /* Generated */    if( !TA_IS_ZERO(prevTR) )
@@ -713,16 +681,9 @@ double outReal[],
 /* Generated */       tempReal = inLow[today];
 /* Generated */       diffM    = prevLow-tempReal;   
 /* Generated */       prevLow  = tempReal;
-/* Generated */       if( (diffM > 0) && (diffP < diffM) )
-/* Generated */       {
-/* Generated */          prevMinusDM = prevMinusDM - (prevMinusDM/optInTimePeriod) + diffM;
-/* Generated */       }
-/* Generated */       else
-/* Generated */       {
-/* Generated */          prevMinusDM = prevMinusDM - (prevMinusDM/optInTimePeriod);
-/* Generated */       }
+/* Generated */       prevMinusDM = TA_WILDER_SUM_STEP(prevMinusDM,TA_MINUS_DM1(diffP,diffM),optInTimePeriod);
 /* Generated */       TRUE_RANGE(prevHigh,prevLow,prevClose,tempReal);
-/* Generated */       prevTR = prevTR - (prevTR/optInTimePeriod) + tempReal;
+/* Generated */       prevTR = TA_WILDER_SUM_STEP(prevTR,tempReal,optInTimePeriod);
 /* Generated */       prevClose = inClose[today];
 /* Generated */       if( !TA_IS_ZERO(prevTR) )
 /* Generated */          outReal[outIdx++] = round_pos(100.0*(prevMinusDM/prevTR));
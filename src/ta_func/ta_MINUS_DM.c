@@ -362,11 +362,7 @@ double outReal[],
       diffM    = prevLow-tempReal;   /* Minus Delta */
       prevLow  = tempReal;
 
-      if( (diffM > 0) && (diffP < diffM) )
-      {
-         /* Case 2 and 4: +DM=0,-DM=diffM */
-         prevMinusDM += diffM;
-      }
+      prevMinusDM += TA_MINUS_DM1(diffP,diffM);
    }
 
    /* Process subsequent DM */
@@ -382,16 +378,7 @@ double outReal[],
       tempReal = inLow[today];
       diffM    = prevLow-tempReal;   /* Minus Delta */
       prevLow  = tempReal;
-      if( (diffM > 0) && (diffP < diffM) )
-      {
-         /* Case 2 and 4: +DM=0,-DM=diffM */
-         prevMinusDM = prevMinusDM - (prevMinusDM/optInTimePeriod) + diffM;
-      }
-      else
-      {
-         /* Case 1,3,5 and 7 */
-         prevMinusDM = prevMinusDM - (prevMinusDM/optInTimePeriod);
-      }
+      prevMinusDM = TA_WILDER_SUM_STEP(prevMinusDM,TA_MINUS_DM1(diffP,diffM),optInTimePeriod);
    }
 
    /* Now start to write the output in
@@ -410,16 +397,7 @@ double outReal[],
       diffM    = prevLow-tempReal;  /* Minus Delta */
       prevLow  = tempReal;
 
-      if( (diffM > 0) && (diffP < diffM) )
-      {
-         /* Case 2 and 4: +DM=0,-DM=diffM */
-         prevMinusDM = prevMinusDM - (prevMinusDM/optInTimePeriod) + diffM;
-      }
-      else
-      {
-         /* Case 1,3,5 and 7 */
-         prevMinusDM = prevMinusDM - (prevMinusDM/optInTimePeriod);
-      }
+      prevMinusDM = TA_WILDER_SUM_STEP(prevMinusDM,TA_MINUS_DM1(diffP,diffM),optInTimePeriod);
 
       outReal[outIdx++] = prevMinusDM;
    }
@@ -559,10 +537,7 @@ double outReal[],
 /* Generated */       tempReal = inLow[today];
 /* Generated */       diffM    = prevLow-tempReal;   
 /* Generated */       prevLow  = tempReal;
-/* Generated */       if( (diffM > 0) && (diffP < diffM) )
-/* Generated */       {
-/* Generated */          prevMinusDM += diffM;
-/* Generated */       }
+/* Generated */       prevMinusDM += TA_MINUS_DM1(diffP,diffM);
 /* Generated */    }
 /* Generated */    i = TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_MINUS_DM,MinusDM);
 /* Generated */    while( i-- != 0 )
@@ -574,14 +549,7 @@ double outReal[],
 /* Generated */       tempReal = inLow[today];
 /* Generated */       diffM    = prevLow-tempReal;   
 /* Generated */       prevLow  = tempReal;
-/* Generated */       if( (diffM > 0) && (diffP < diffM) )
-/* Generated */       {
-/* Generated */          prevMinusDM = prevMinusDM - (prevMinusDM/optInTimePeriod) + diffM;
-/* Generated */       }
-/* Generated */       else
-/* Generated */       {
-/* Generated */          prevMinusDM = prevMinusDM - (prevMinusDM/optInTimePeriod);
-/* Generated */       }
+/* Generated */       prevMinusDM = TA_WILDER_SUM_STEP(prevMinusDM,TA_MINUS_DM1(diffP,diffM),optInTimePeriod);
 /* Generated */    }
 /* Generated */    outReal[0] = prevMinusDM;
 /* Generated */    outIdx = 1;
@@ -594,14 +562,7 @@ double outReal[],
 /* Generated */       tempReal = inLow[today];
 /* Generated */       diffM    = prevLow-tempReal;  
 /* Generated */       prevLow  = tempReal;
-/* Generated */       if( (diffM > 0) && (diffP < diffM) )
-/* Generated */       {
-/* Generated */          prevMinusDM = prevMinusDM - (prevMinusDM/optInTimePeriod) + diffM;
-/* Generated */       }
-/* Generated */       else
-/* Generated */       {
-/* Generated */          prevMinusDM = prevMinusDM - (prevMinusDM/optInTimePeriod);
-/* Generated */       }
+/* Generated */       prevMinusDM = TA_WILDER_SUM_STEP(prevMinusDM,TA_MINUS_DM1(diffP,diffM),optInTimePeriod);
 /* Generated */       outReal[outIdx++] = prevMinusDM;
 /* Generated */    }
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
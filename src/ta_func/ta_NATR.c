@@ -42,6 +42,9 @@
  *  MMDDYY BY     Description
  *  -------------------------------------------------------------------
  *  060306 MF     Initial Version
+ *  101826 MF     Fix a zero close writing over the first output.
+ *  101826 MF     Use the close of the output bar when startIdx is
+ *                after the lookback.
  */
 
 /**** START GENCODE SECTION 1 - DO NOT DELETE THIS LINE ****/
@@ -283,7 +286,7 @@ double outReal[],
    }
 
    /* Allocate an intermediate buffer for TRANGE. */
-   ARRAY_ALLOC(tempBuffer, lookbackTotal+(endIdx-startIdx)+1 );
+   ARRAY_ALLOC(tempBuffer, TA_NATR_TRANGE_SIZE(startIdx,endIdx,lookbackTotal) );
 
    /* Do TRANGE in the intermediate buffer. */
    retCode = FUNCTION_CALL(TRANGE)( (startIdx-lookbackTotal+1), endIdx,
@@ -324,9 +327,7 @@ double outReal[],
    /* Skip the unstable period. */
    while( outIdx != 0 )
    {
-      prevATR *= optInTimePeriod - 1;
-      prevATR += tempBuffer[today++];
-      prevATR /= optInTimePeriod;
+      prevATR = TA_WILDER_STEP(prevATR,tempBuffer[today++],optInTimePeriod);
       outIdx--;
    }
 
@@ -334,7 +335,7 @@ double outReal[],
     * provided outReal.
     */
    outIdx = 1;
-   tempValue = inClose[today];
+   tempValue = inClose[startIdx];
    if( !TA_IS_ZERO(tempValue) )
       outReal[0] = (prevATR/tempValue)*100.0;
    else
@@ -345,14 +346,12 @@ double outReal[],
 
    while( --nbATR != 0 )
    {
-      prevATR *= optInTimePeriod - 1;
-      prevATR += tempBuffer[today++];
-      prevATR /= optInTimePeriod;
-      tempValue = inClose[today];
+      prevATR = TA_WILDER_STEP(prevATR,tempBuffer[today++],optInTimePeriod);
+      tempValue = inClose[startIdx+outIdx];
       if( !TA_IS_ZERO(tempValue) )
          outReal[outIdx] = (prevATR/tempValue)*100.0;
       else
-         outReal[0] = 0.0;
+         outReal[outIdx] = 0.0;
       outIdx++;
    }
 
@@ -461,7 +460,7 @@ double outReal[],
 /* Generated */                                     inHigh, inLow, inClose,
 /* Generated */                                     outBegIdx, outNBElement, outReal );
 /* Generated */    }
-/* Generated */    ARRAY_ALLOC(tempBuffer, lookbackTotal+(endIdx-startIdx)+1 );
+/* Generated */    ARRAY_ALLOC(tempBuffer, TA_NATR_TRANGE_SIZE(startIdx,endIdx,lookbackTotal) );
 /* Generated */    retCode = FUNCTION_CALL(TRANGE)( (startIdx-lookbackTotal+1), endIdx,
 /* Generated */                                     inHigh, inLow, inClose,
 /* Generated */                                     VALUE_HANDLE_OUT(outBegIdx1), VALUE_HANDLE_OUT(outNbElement1),
@@ -486,13 +485,11 @@ double outReal[],
 /* Generated */    outIdx = TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_NATR,Natr);
 /* Generated */    while( outIdx != 0 )
 /* Generated */    {
-/* Generated */       prevATR *= optInTimePeriod - 1;
-/* Generated */       prevATR += tempBuffer[today++];
-/* Generated */       prevATR /= optInTimePeriod;
+/* Generated */       prevATR = TA_WILDER_STEP(prevATR,tempBuffer[today++],optInTimePeriod);
 /* Generated */       outIdx--;
 /* Generated */    }
 /* Generated */    outIdx = 1;
-/* Generated */    tempValue = inClose[today];
+/* Generated */    tempValue = inClose[startIdx];
 /* Generated */    if( !TA_IS_ZERO(tempValue) )
 /* Generated */       outReal[0] = (prevATR/tempValue)*100.0;
 /* Generated */    else
@@ -500,14 +497,12 @@ double outReal[],
 /* Generated */    nbATR = (endIdx - startIdx)+1;
 /* Generated */    while( --nbATR != 0 )
 /* Generated */    {
-/* Generated */       prevATR *= optInTimePeriod - 1;
-/* Generated */       prevATR += tempBuffer[today++];
-/* Generated */       prevATR /= optInTimePeriod;
-/* Generated */       tempValue = inClose[today];
+/* Generated */       prevATR = TA_WILDER_STEP(prevATR,tempBuffer[today++],optInTimePeriod);
+/* Generated */       tempValue = inClose[startIdx+outIdx];
 /* Generated */       if( !TA_IS_ZERO(tempValue) )
 /* Generated */          outReal[outIdx] = (prevATR/tempValue)*100.0;
 /* Generated */       else
-/* Generated */          outReal[0] = 0.0;
+/* Generated */          outReal[outIdx] = 0.0;
 /* Generated */       outIdx++;
 /* Generated */    }
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
@@ -423,11 +423,7 @@ double outReal[],
       tempReal = inLow[today];
       diffM    = prevLow-tempReal;   /* Minus Delta */
       prevLow  = tempReal;
-      if( (diffP > 0) && (diffP > diffM) )
-      {
-         /* Case 1 and 3: +DM=diffP,-DM=0 */
-         prevPlusDM += diffP;
-      }
+      prevPlusDM += TA_PLUS_DM1(diffP,diffM);
 
       TRUE_RANGE(prevHigh,prevLow,prevClose,tempReal);
       prevTR += tempReal;
@@ -450,20 +446,11 @@ double outReal[],
       tempReal = inLow[today];
       diffM    = prevLow-tempReal;   /* Minus Delta */
       prevLow  = tempReal;
-      if( (diffP > 0) && (diffP > diffM) )
-      {
-         /* Case 1 and 3: +DM=diffP,-DM=0 */
-         prevPlusDM = prevPlusDM - (prevPlusDM/optInTimePeriod) + diffP;
-      }
-      else
-      {
-         /* Case 2,4,5 and 7 */
-         prevPlusDM = prevPlusDM - (prevPlusDM/optInTimePeriod);
-      }
+      prevPlusDM = TA_WILDER_SUM_STEP(prevPlusDM,TA_PLUS_DM1(diffP,diffM),optInTimePeriod);
 
       /* Calculate the prevTR */
       TRUE_RANGE(prevHigh,prevLow,prevClose,tempReal);
-      prevTR = prevTR - (prevTR/optInTimePeriod) + tempReal;
+      prevTR = TA_WILDER_SUM_STEP(prevTR,tempReal,optInTimePeriod);
       prevClose = inClose[today];
    }
 
@@ -487,20 +474,11 @@ double outReal[],
       tempReal = inLow[today];
       diffM    = prevLow-tempReal;   /* Minus Delta */
       prevLow  = tempReal;
-      if( (diffP > 0) && (diffP > diffM) )
-      {
-         /* Case 1 and 3: +DM=diffP,-DM=0 */
-         prevPlusDM = prevPlusDM - (prevPlusDM/optInTimePeriod) + diffP;
-      }
-      else
-      {
-         /* Case 2,4,5 and 7 */
-         prevPlusDM = prevPlusDM - (prevPlusDM/optInTimePeriod);
-      }
+      prevPlusDM = TA_WILDER_SUM_STEP(prevPlusDM,TA_PLUS_DM1(diffP,diffM),optInTimePeriod);
 
       /* Calculate the prevTR */
       TRUE_RANGE(prevHigh,prevLow,prevClose,tempReal);
-      prevTR = prevTR - (prevTR/optInTimePeriod) + tempReal;
+      prevTR = TA_WILDER_SUM_STEP(prevTR,tempReal,optInTimePeriod);
       prevClose = inClose[today];
 
       /* Calculate the DI. The value is rounded (see Wilder book). */
@@ -669,10 +647,7 @@ double outReal[],
 /* Generated */       tempReal = inLow[today];
 /* Generated */       diffM    = prevLow-tempReal;   
 /* Generated */       prevLow  = tempReal;
-/* Generated */       if( (diffP > 0) && (diffP > diffM) )
-/* Generated */       {
-/* Generated */          prevPlusDM += diffP;
-/* Generated */       }
+/* Generated */       prevPlusDM += TA_PLUS_DM1(diffP,diffM);
 /* Generated */       TRUE_RANGE(prevHigh,prevLow,prevClose,tempReal);
 /* Generated */       prevTR += tempReal;
 /* Generated */       prevClose = inClose[today];
@@ -687,16 +662,9 @@ double outReal[],
 /* Generated */       tempReal = inLow[today];
 /* Generated */       diffM    = prevLow-tempReal;   
 /* Generated */       prevLow  = tempReal;
-/* Generated */       if( (diffP > 0) && (diffP > diffM) )
-/* Generated */       {
-/* Generated */          prevPlusDM = prevPlusDM - (prevPlusDM/optInTimePeriod) + diffP;
-/* Generated */       }
-/* Generated */       else
-/* Generated */       {
-/* Generated */          prevPlusDM = prevPlusDM - (prevPlusDM/optInTimePeriod);
-/* Generated */       }
+/* Generated */       prevPlusDM = TA_WILDER_SUM_STEP(prevPlusDM,TA_PLUS_DM1(diffP,diffM),optInTimePeriod);
 /* Generated */       TRUE_RANGE(prevHigh,prevLow,prevClose,tempReal);
-/* Generated */       prevTR = prevTR - (prevTR/optInTimePeriod) + tempReal;
+/* Generated */       prevTR = TA_WILDER_SUM_STEP(prevTR,tempReal,optInTimePeriod);
 /* Generated */       prevClose = inClose[today];
 /* Generated */    }
 /* Generated */    if( !TA_IS_ZERO(prevTR) )
@@ -713,16 +681,9 @@ double outReal[],
 /* Generated */       tempReal = inLow[today];
 /* Generated */       diffM    = prevLow-tempReal;   
 /* Generated */       prevLow  = tempReal;
-/* Generated */       if( (diffP > 0) && (diffP > diffM) )
-/* Generated */       {
-/* Generated */          prevPlusDM = prevPlusDM - (prevPlusDM/optInTimePeriod) + diffP;
-/* Generated */       }
-/* Generated */       else
-/* Generated */       {
-/* Generated */          prevPlusDM = prevPlusDM - (prevPlusDM/optInTimePeriod);
-/* Generated */       }
+/* Generated */       prevPlusDM = TA_WILDER_SUM_STEP(prevPlusDM,TA_PLUS_DM1(diffP,diffM),optInTimePeriod);
 /* Generated */       TRUE_RANGE(prevHigh,prevLow,prevClose,tempReal);
-/* Generated */       prevTR = prevTR - (prevTR/optInTimePeriod) + tempReal;
+/* Generated */       prevTR = TA_WILDER_SUM_STEP(prevTR,tempReal,optInTimePeriod);
 /* Generated */       prevClose = inClose[today];
 /* Generated */       if( !TA_IS_ZERO(prevTR) )
 /* Generated */          outReal[outIdx++] = round_pos(100.0*(prevPlusDM/prevTR));
@@ -363,11 +363,7 @@ double outReal[],
       diffM    = prevLow-tempReal;   /* Minus Delta */
       prevLow  = tempReal;
 
-      if( (diffP > 0) && (diffP > diffM) )
-      {
-         /* Case 1 and 3: +DM=diffP,-DM=0 */
-         prevPlusDM += diffP;
-      }
+      prevPlusDM += TA_PLUS_DM1(diffP,diffM);
    }
 
    /* Process subsequent DM */
@@ -383,16 +379,7 @@ double outReal[],
       tempReal = inLow[today];
       diffM    = prevLow-tempReal;   /* Minus Delta */
       prevLow  = tempReal;
-      if( (diffP > 0) && (diffP > diffM) )
-      {
-         /* Case 1 and 3: +DM=diffP,-DM=0 */
-         prevPlusDM = prevPlusDM - (prevPlusDM/optInTimePeriod) + diffP;
-      }
-      else
-      {
-         /* Case 2,4,5 and 7 */
-         prevPlusDM = prevPlusDM - (prevPlusDM/optInTimePeriod);
-      }
+      prevPlusDM = TA_WILDER_SUM_STEP(prevPlusDM,TA_PLUS_DM1(diffP,diffM),optInTimePeriod);
    }
 
    /* Now start to write the output in
@@ -411,16 +398,7 @@ double outReal[],
       diffM    = prevLow-tempReal;   /* Minus Delta */
       prevLow  = tempReal;
 
-      if( (diffP > 0) && (diffP > diffM) )
-      {
-         /* Case 1 and 3: +DM=diffP,-DM=0 */
-         prevPlusDM = prevPlusDM - (prevPlusDM/optInTimePeriod) + diffP;
-      }
-      else
-      {
-         /* Case 2,4,5 and 7 */
-         prevPlusDM = prevPlusDM - (prevPlusDM/optInTimePeriod);
-      }
+      prevPlusDM = TA_WILDER_SUM_STEP(prevPlusDM,TA_PLUS_DM1(diffP,diffM),optInTimePeriod);
 
       outReal[outIdx++] = prevPlusDM;
    }
@@ -560,10 +538,7 @@ double outReal[],
 /* Generated */       tempReal = inLow[today];
 /* Generated */       diffM    = prevLow-tempReal;   
 /* Generated */       prevLow  = tempReal;
-/* Generated */       if( (diffP > 0) && (diffP > diffM) )
-/* Generated */       {
-/* Generated */          prevPlusDM += diffP;
-/* Generated */       }
+/* Generated */       prevPlusDM += TA_PLUS_DM1(diffP,diffM);
 /* Generated */    }
 /* Generated */    i = TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_PLUS_DM,PlusDM);
 /* Generated */    while( i-- != 0 )
@@ -575,14 +550,7 @@ double outReal[],
 /* Generated */       tempReal = inLow[today];
 /* Generated */       diffM    = prevLow-tempReal;   
 /* Generated */       prevLow  = tempReal;
-/* Generated */       if( (diffP > 0) && (diffP > diffM) )
-/* Generated */       {
-/* Generated */          prevPlusDM = prevPlusDM - (prevPlusDM/optInTimePeriod) + diffP;
-/* Generated */       }
-/* Generated */       else
-/* Generated */       {
-/* Generated */          prevPlusDM = prevPlusDM - (prevPlusDM/optInTimePeriod);
-/* Generated */       }
+/* Generated */       prevPlusDM = TA_WILDER_SUM_STEP(prevPlusDM,TA_PLUS_DM1(diffP,diffM),optInTimePeriod);
 /* Generated */    }
 /* Generated */    outReal[0] = prevPlusDM;
 /* Generated */    outIdx = 1;
@@ -595,14 +563,7 @@ double outReal[],
 /* Generated */       tempReal = inLow[today];
 /* Generated */       diffM    = prevLow-tempReal;   
 /* Generated */       prevLow  = tempReal;
-/* Generated */       if( (diffP > 0) && (diffP > diffM) )
-/* Generated */       {
-/* Generated */          prevPlusDM = prevPlusDM - (prevPlusDM/optInTimePeriod) + diffP;
-/* Generated */       }
-/* Generated */       else
-/* Generated */       {
-/* Generated */          prevPlusDM = prevPlusDM - (prevPlusDM/optInTimePeriod);
-/* Generated */       }
+/* Generated */       prevPlusDM = TA_WILDER_SUM_STEP(prevPlusDM,TA_PLUS_DM1(diffP,diffM),optInTimePeriod);
 /* Generated */       outReal[outIdx++] = prevPlusDM;
 /* Generated */    }
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
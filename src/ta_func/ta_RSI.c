@@ -309,10 +309,7 @@ double outReal[],
          tempValue1 = inReal[today++];
          tempValue2 = tempValue1 - prevValue;
          prevValue  = tempValue1;
-         if( tempValue2 < 0 )
-            prevLoss -= tempValue2;
-         else
-            prevGain += tempValue2;
+         TA_GAIN_LOSS_ADD(prevGain,prevLoss,tempValue2);
       }
 
 
@@ -351,10 +348,7 @@ double outReal[],
       tempValue1 = inReal[today++];
       tempValue2 = tempValue1 - prevValue;
       prevValue  = tempValue1;
-      if( tempValue2 < 0 )
-         prevLoss -= tempValue2;
-      else
-         prevGain += tempValue2;
+      TA_GAIN_LOSS_ADD(prevGain,prevLoss,tempValue2);
    }
 
 
@@ -394,15 +388,7 @@ double outReal[],
          tempValue2 = tempValue1 - prevValue;
          prevValue  = tempValue1;
 
-         prevLoss *= (optInTimePeriod-1);
-         prevGain *= (optInTimePeriod-1);
-         if( tempValue2 < 0 )
-            prevLoss -= tempValue2;
-         else
-            prevGain += tempValue2;
-
-         prevLoss /= optInTimePeriod;
-         prevGain /= optInTimePeriod;
+         TA_GAIN_LOSS_STEP(prevGain,prevLoss,tempValue2,optInTimePeriod);
 
          today++;
       }
@@ -417,15 +403,7 @@ double outReal[],
       tempValue2 = tempValue1 - prevValue;
       prevValue  = tempValue1;
 
-      prevLoss *= (optInTimePeriod-1);
-      prevGain *= (optInTimePeriod-1);
-      if( tempValue2 < 0 )
-         prevLoss -= tempValue2;
-      else
-         prevGain += tempValue2;
-
-      prevLoss /= optInTimePeriod;
-      prevGain /= optInTimePeriod;
+      TA_GAIN_LOSS_STEP(prevGain,prevLoss,tempValue2,optInTimePeriod);
       tempValue1 = prevGain+prevLoss;
       if( !TA_IS_ZERO(tempValue1) )
          outReal[outIdx++] = 100.0*(prevGain/tempValue1);
@@ -548,10 +526,7 @@ double outReal[],
 /* Generated */          tempValue1 = inReal[today++];
 /* Generated */          tempValue2 = tempValue1 - prevValue;
 /* Generated */          prevValue  = tempValue1;
-/* Generated */          if( tempValue2 < 0 )
-/* Generated */             prevLoss -= tempValue2;
-/* Generated */          else
-/* Generated */             prevGain += tempValue2;
+/* Generated */          TA_GAIN_LOSS_ADD(prevGain,prevLoss,tempValue2);
 /* Generated */       }
 /* Generated */       tempValue1 = prevLoss/optInTimePeriod;
 /* Generated */       tempValue2 = prevGain/optInTimePeriod;
@@ -577,10 +552,7 @@ double outReal[],
 /* Generated */       tempValue1 = inReal[today++];
 /* Generated */       tempValue2 = tempValue1 - prevValue;
 /* Generated */       prevValue  = tempValue1;
-/* Generated */       if( tempValue2 < 0 )
-/* Generated */          prevLoss -= tempValue2;
-/* Generated */       else
-/* Generated */          prevGain += tempValue2;
+/* Generated */       TA_GAIN_LOSS_ADD(prevGain,prevLoss,tempValue2);
 /* Generated */    }
 /* Generated */    prevLoss /= optInTimePeriod;
 /* Generated */    prevGain /= optInTimePeriod;
@@ -599,14 +571,7 @@ double outReal[],
 /* Generated */          tempValue1 = inReal[today];
 /* Generated */          tempValue2 = tempValue1 - prevValue;
 /* Generated */          prevValue  = tempValue1;
-/* Generated */          prevLoss *= (optInTimePeriod-1);
-/* Generated */          prevGain *= (optInTimePeriod-1);
-/* Generated */          if( tempValue2 < 0 )
-/* Generated */             prevLoss -= tempValue2;
-/* Generated */          else
-/* Generated */             prevGain += tempValue2;
-/* Generated */          prevLoss /= optInTimePeriod;
-/* Generated */          prevGain /= optInTimePeriod;
+/* Generated */          TA_GAIN_LOSS_STEP(prevGain,prevLoss,tempValue2,optInTimePeriod);
 /* Generated */          today++;
 /* Generated */       }
 /* Generated */    }
@@ -615,14 +580,7 @@ double outReal[],
 /* Generated */       tempValue1 = inReal[today++];
 /* Generated */       tempValue2 = tempValue1 - prevValue;
 /* Generated */       prevValue  = tempValue1;
-/* Generated */       prevLoss *= (optInTimePeriod-1);
-/* Generated */       prevGain *= (optInTimePeriod-1);
-/* Generated */       if( tempValue2 < 0 )
-/* Generated */          prevLoss -= tempValue2;
-/* Generated */       else
-/* Generated */          prevGain += tempValue2;
-/* Generated */       prevLoss /= optInTimePeriod;
-/* Generated */       prevGain /= optInTimePeriod;
+/* Generated */       TA_GAIN_LOSS_STEP(prevGain,prevLoss,tempValue2,optInTimePeriod);
 /* Generated */       tempValue1 = prevGain+prevLoss;
 /* Generated */       if( !TA_IS_ZERO(tempValue1) )
 /* Generated */          outReal[outIdx++] = 100.0*(prevGain/tempValue1);
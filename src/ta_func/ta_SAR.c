@@ -384,136 +384,8 @@ double outReal[],
       SAR_ROUNDING(newLow);
       SAR_ROUNDING(newHigh);
 
-      if( isLong == 1 )
-      {
-         /* Switch to short if the low penetrates the SAR value. */
-         if( newLow <= sar )
-         {
-            /* Switch and Overide the SAR with the ep */
-            isLong = 0;
-            sar = ep;
-
-            /* Make sure the overide SAR is within
-             * yesterday's and today's range.
-             */
-            if( sar < prevHigh )
-               sar = prevHigh;
-            if( sar < newHigh )
-               sar = newHigh;
-
-            /* Output the overide SAR  */
-            outReal[outIdx++] = sar;
-
-            /* Adjust af and ep */
-            af = optInAcceleration;
-            ep = newLow;
-
-            /* Calculate the new SAR */
-            sar = sar + af * (ep - sar);
-            SAR_ROUNDING( sar );
-
-            /* Make sure the new SAR is within
-             * yesterday's and today's range.
-             */
-            if( sar < prevHigh )
-               sar = prevHigh;
-            if( sar < newHigh )
-               sar = newHigh;
-         }
-         else
-         {
-            /* No switch */
-
-            /* Output the SAR (was calculated in the previous iteration) */
-            outReal[outIdx++] = sar;
-
-            /* Adjust af and ep. */
-            if( newHigh > ep )
-            {
-               ep = newHigh;
-               af += optInAcceleration;
-               if( af > optInMaximum )
-                  af = optInMaximum;
-            }
-
-            /* Calculate the new SAR */
-            sar = sar + af * (ep - sar);
-            SAR_ROUNDING( sar );
-
-            /* Make sure the new SAR is within
-             * yesterday's and today's range.
-             */
-            if( sar > prevLow )
-               sar = prevLow;
-            if( sar > newLow )
-               sar = newLow;
-         }
-      }
-      else
-      {
-         /* Switch to long if the high penetrates the SAR value. */
-         if( newHigh >= sar )
-         {
-            /* Switch and Overide the SAR with the ep */
-            isLong = 1;
-            sar = ep;
-
-            /* Make sure the overide SAR is within
-             * yesterday's and today's range.
-             */
-            if( sar > prevLow )
-               sar = prevLow;
-            if( sar > newLow )
-               sar = newLow;
-
-            /* Output the overide SAR  */
-            outReal[outIdx++] = sar;
-
-            /* Adjust af and ep */
-            af = optInAcceleration;
-            ep = newHigh;
-
-            /* Calculate the new SAR */
-            sar = sar + af * (ep - sar);
-            SAR_ROUNDING( sar );
-
-            /* Make sure the new SAR is within
-             * yesterday's and today's range.
-             */
-            if( sar > prevLow )
-               sar = prevLow;
-            if( sar > newLow )
-               sar = newLow;
-         }
-         else
-         {
-            /* No switch */
-
-            /* Output the SAR (was calculated in the previous iteration) */
-            outReal[outIdx++] = sar;
-
-            /* Adjust af and ep. */
-            if( newLow < ep )
-            {
-               ep = newLow;
-               af += optInAcceleration;
-               if( af > optInMaximum )
-                  af = optInMaximum;
-            }
-
-            /* Calculate the new SAR */
-            sar = sar + af * (ep - sar);
-            SAR_ROUNDING( sar );
-
-            /* Make sure the new SAR is within
-             * yesterday's and today's range.
-             */
-            if( sar < prevHigh )
-               sar = prevHigh;
-            if( sar < newHigh )
-               sar = newHigh;
-         }
-      }
+      TA_SAR_STEP( isLong, sar, ep, af, prevHigh, prevLow, newHigh, newLow,
+                   optInAcceleration, optInMaximum, outReal[outIdx++] );
    }
 
    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
@@ -661,82 +533,8 @@ double outReal[],
 /* Generated */       todayIdx++;
 /* Generated */       SAR_ROUNDING(newLow);
 /* Generated */       SAR_ROUNDING(newHigh);
-/* Generated */       if( isLong == 1 )
-/* Generated */       {
-/* Generated */          if( newLow <= sar )
-/* Generated */          {
-/* Generated */             isLong = 0;
-/* Generated */             sar = ep;
-/* Generated */             if( sar < prevHigh )
-/* Generated */                sar = prevHigh;
-/* Generated */             if( sar < newHigh )
-/* Generated */                sar = newHigh;
-/* Generated */             outReal[outIdx++] = sar;
-/* Generated */             af = optInAcceleration;
-/* Generated */             ep = newLow;
-/* Generated */             sar = sar + af * (ep - sar);
-/* Generated */             SAR_ROUNDING( sar );
-/* Generated */             if( sar < prevHigh )
-/* Generated */                sar = prevHigh;
-/* Generated */             if( sar < newHigh )
-/* Generated */                sar = newHigh;
-/* Generated */          }
-/* Generated */          else
-/* Generated */          {
-/* Generated */             outReal[outIdx++] = sar;
-/* Generated */             if( newHigh > ep )
-/* Generated */             {
-/* Generated */                ep = newHigh;
-/* Generated */                af += optInAcceleration;
-/* Generated */                if( af > optInMaximum )
-/* Generated */                   af = optInMaximum;
-/* Generated */             }
-/* Generated */             sar = sar + af * (ep - sar);
-/* Generated */             SAR_ROUNDING( sar );
-/* Generated */             if( sar > prevLow )
-/* Generated */                sar = prevLow;
-/* Generated */             if( sar > newLow )
-/* Generated */                sar = newLow;
-/* Generated */          }
-/* Generated */       }
-/* Generated */       else
-/* Generated */       {
-/* Generated */          if( newHigh >= sar )
-/* Generated */          {
-/* Generated */             isLong = 1;
-/* Generated */             sar = ep;
-/* Generated */             if( sar > prevLow )
-/* Generated */                sar = prevLow;
-/* Generated */             if( sar > newLow )
-/* Generated */                sar = newLow;
-/* Generated */             outReal[outIdx++] = sar;
-/* Generated */             af = optInAcceleration;
-/* Generated */             ep = newHigh;
-/* Generated */             sar = sar + af * (ep - sar);
-/* Generated */             SAR_ROUNDING( sar );
-/* Generated */             if( sar > prevLow )
-/* Generated */                sar = prevLow;
-/* Generated */             if( sar > newLow )
-/* Generated */                sar = newLow;
-/* Generated */          }
-/* Generated */          else
-/* Generated */          {
-/* Generated */             outReal[outIdx++] = sar;
-/* Generated */             if( newLow < ep )
-/* Generated */             {
-/* Generated */                ep = newLow;
-/* Generated */                af += optInAcceleration;
-/* Generated */                if( af > optInMaximum )
-/* Generated */                   af = optInMaximum;
-/* Generated */             }
-/* Generated */             sar = sar + af * (ep - sar);
-/* Generated */             SAR_ROUNDING( sar );
-/* Generated */             if( sar < prevHigh )
-/* Generated */                sar = prevHigh;
-/* Generated */             if( sar < newHigh )
-/* Generated */                sar = newHigh;
-/* Generated */          }
-/* Generated */       }
+/* Generated */       TA_SAR_STEP( isLong, sar, ep, af, prevHigh, prevLow, newHigh, newLow,
+/* Generated */                    optInAcceleration, optInMaximum, outReal[outIdx++] );
 /* Generated */    }
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
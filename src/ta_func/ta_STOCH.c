@@ -270,7 +270,9 @@ double outSlowD[],
    ARRAY_REF( tempBuffer );
    int outIdx, lowestIdx, highestIdx;
    int lookbackTotal, lookbackK, lookbackKSlow, lookbackDSlow;
-   int trailingIdx, today, i;
+   int trailingIdx, today;
+   WINDOW_EXTREME_VARIABLES(lowestWindow);
+   WINDOW_EXTREME_VARIABLES(highestWindow);
    #if !defined( _MANAGED ) && !defined(USE_SINGLE_PRECISION_INPUT) &&!defined(_JAVA)
    int bufferIsAllocated;
    #endif
@@ -418,6 +420,8 @@ double outSlowD[],
    lowestIdx   = highestIdx = -1;
    diff = highest = lowest  = 0.0;
 
+   INIT_WINDOW_EXTREME_PAIR(lowestWindow,highestWindow,optInFastK_Period);
+
    /* Allocate a temporary buffer large enough to
     * store the K.
     *
@@ -433,7 +437,7 @@ double outSlowD[],
        * its allocated size is not guarantee to be as large as
        * the input.
        */
-      ARRAY_ALLOC( tempBuffer, endIdx-today+1 );
+      ARRAY_ALLOC( tempBuffer, TA_STOCH_K_SIZE(today,endIdx) );
    #else
       if( (outSlowK == inHigh) ||
           (outSlowK == inLow)  ||
@@ -452,7 +456,7 @@ double outSlowD[],
          #if !defined( _MANAGED ) && !defined(_JAVA)
             bufferIsAllocated = 1;
          #endif
-         ARRAY_ALLOC( tempBuffer, endIdx-today+1 );
+         ARRAY_ALLOC( tempBuffer, TA_STOCH_K_SIZE(today,endIdx) );
       }
    #endif
 
@@ -463,18 +467,8 @@ double outSlowD[],
       tmp = inLow[today];
       if( lowestIdx < trailingIdx )
       {
-         lowestIdx = trailingIdx;
+         WINDOW_LOWEST_FIND(lowestWindow,inLow,trailingIdx,today,lowestIdx);
          lowest = inLow[lowestIdx];
-         i = lowestIdx;
-         while( ++i<=today )
-         {
-            tmp = inLow[i];
-            if( tmp < lowest )
-            {
-               lowestIdx = i;
-               lowest = tmp;
-            }
-         }
          diff = (highest - lowest)/100.0;
       }
       else if( tmp <= lowest )
@@ -488,18 +482,8 @@ double outSlowD[],
       tmp = inHigh[today];
       if( highestIdx < trailingIdx )
       {
-         highestIdx = trailingIdx;
+         WINDOW_HIGHEST_FIND(highestWindow,inHigh,trailingIdx,today,highestIdx);
          highest = inHigh[highestIdx];
-         i = highestIdx;
-         while( ++i<=today )
-         {
-            tmp = inHigh[i];
-            if( tmp > highest )
-            {
-               highestIdx = i;
-               highest = tmp;
-            }
-         }
          diff = (highest - lowest)/100.0;
       }
       else if( tmp >= highest )
@@ -519,6 +503,9 @@ double outSlowD[],
       today++;
    }
 
+   FREE_WINDOW_EXTREME(lowestWindow);
+   FREE_WINDOW_EXTREME(highestWindow);
+
    /* Un-smoothed K calculation completed. This K calculation is not returned
     * to the caller. It is always smoothed and then return.
     * Some documentation will refer to the smoothed version as being
@@ -662,7 +649,9 @@ double outSlowD[],
 /* Generated */    ARRAY_REF( tempBuffer );
 /* Generated */    int outIdx, lowestIdx, highestIdx;
 /* Generated */    int lookbackTotal, lookbackK, lookbackKSlow, lookbackDSlow;
-/* Generated */    int trailingIdx, today, i;
+/* Generated */    int trailingIdx, today;
+/* Generated */    WINDOW_EXTREME_VARIABLES(lowestWindow);
+/* Generated */    WINDOW_EXTREME_VARIABLES(highestWindow);
 /* Generated */    #if !defined( _MANAGED ) && !defined(USE_SINGLE_PRECISION_INPUT) &&!defined(_JAVA)
 /* Generated */    int bufferIsAllocated;
 /* Generated */    #endif
@@ -726,11 +715,12 @@ double outSlowD[],
 /* Generated */    today       = trailingIdx+lookbackK;
 /* Generated */    lowestIdx   = highestIdx = -1;
 /* Generated */    diff = highest = lowest  = 0.0;
+/* Generated */    INIT_WINDOW_EXTREME_PAIR(lowestWindow,highestWindow,optInFastK_Period);
 /* Generated */    #if !defined( _MANAGED ) && !defined(USE_SINGLE_PRECISION_INPUT) && !defined( _JAVA )
 /* Generated */       bufferIsAllocated = 0;
 /* Generated */    #endif
 /* Generated */    #if defined(USE_SINGLE_PRECISION_INPUT) || defined( USE_SUBARRAY )
-/* Generated */       ARRAY_ALLOC( tempBuffer, endIdx-today+1 );
+/* Generated */       ARRAY_ALLOC( tempBuffer, TA_STOCH_K_SIZE(today,endIdx) );
 /* Generated */    #else
 /* Generated */       if( (outSlowK == inHigh) ||
 /* Generated */           (outSlowK == inLow)  ||
@@ -749,7 +739,7 @@ double outSlowD[],
 /* Generated */          #if !defined( _MANAGED ) && !defined(_JAVA)
 /* Generated */             bufferIsAllocated = 1;
 /* Generated */          #endif
-/* Generated */          ARRAY_ALLOC( tempBuffer, endIdx-today+1 );
+/* Generated */          ARRAY_ALLOC( tempBuffer, TA_STOCH_K_SIZE(today,endIdx) );
 /* Generated */       }
 /* Generated */    #endif
 /* Generated */    while( today <= endIdx )
@@ -757,18 +747,8 @@ double outSlowD[],
 /* Generated */       tmp = inLow[today];
 /* Generated */       if( lowestIdx < trailingIdx )
 /* Generated */       {
-/* Generated */          lowestIdx = trailingIdx;
+/* Generated */          WINDOW_LOWEST_FIND(lowestWindow,inLow,trailingIdx,today,lowestIdx);
 /* Generated */          lowest = inLow[lowestIdx];
-/* Generated */          i = lowestIdx;
-/* Generated */          while( ++i<=today )
-/* Generated */          {
-/* Generated */             tmp = inLow[i];
-/* Generated */             if( tmp < lowest )
-/* Generated */             {
-/* Generated */                lowestIdx = i;
-/* Generated */                lowest = tmp;
-/* Generated */             }
-/* Generated */          }
 /* Generated */          diff = (highest - lowest)/100.0;
 /* Generated */       }
 /* Generated */       else if( tmp <= lowest )
@@ -780,18 +760,8 @@ double outSlowD[],
 /* Generated */       tmp = inHigh[today];
 /* Generated */       if( highestIdx < trailingIdx )
 /* Generated */       {
-/* Generated */          highestIdx = trailingIdx;
+/* Generated */          WINDOW_HIGHEST_FIND(highestWindow,inHigh,trailingIdx,today,highestIdx);
 /* Generated */          highest = inHigh[highestIdx];
-/* Generated */          i = highestIdx;
-/* Generated */          while( ++i<=today )
-/* Generated */          {
-/* Generated */             tmp = inHigh[i];
-/* Generated */             if( tmp > highest )
-/* Generated */             {
-/* Generated */                highestIdx = i;
-/* Generated */                highest = tmp;
-/* Generated */             }
-/* Generated */          }
 /* Generated */          diff = (highest - lowest)/100.0;
 /* Generated */       }
 /* Generated */       else if( tmp >= highest )
@@ -807,6 +777,8 @@ double outSlowD[],
 /* Generated */       trailingIdx++;
 /* Generated */       today++;
 /* Generated */    }
+/* Generated */    FREE_WINDOW_EXTREME(lowestWindow);
+/* Generated */    FREE_WINDOW_EXTREME(highestWindow);
 /* Generated */    retCode = FUNCTION_CALL_DOUBLE(MA)( 0, outIdx-1,
 /* Generated */                                        tempBuffer, optInSlowK_Period,
 /* Generated */                                        optInSlowK_MAType,
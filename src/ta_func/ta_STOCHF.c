@@ -233,7 +233,9 @@ double outFastD[],
    ARRAY_REF( tempBuffer );
    int outIdx, lowestIdx, highestIdx;
    int lookbackTotal, lookbackK, lookbackFastD;
-   int trailingIdx, today, i;
+   int trailingIdx, today;
+   WINDOW_EXTREME_VARIABLES(lowestWindow);
+   WINDOW_EXTREME_VARIABLES(highestWindow);
 
    #if !defined( _MANAGED ) && !defined(USE_SINGLE_PRECISION_INPUT) && !defined( _JAVA )
    int bufferIsAllocated;
@@ -368,6 +370,8 @@ double outFastD[],
    lowestIdx   = highestIdx = -1;
    diff = highest = lowest  = 0.0;
 
+   INIT_WINDOW_EXTREME_PAIR(lowestWindow,highestWindow,optInFastK_Period);
+
    /* Allocate a temporary buffer large enough to
     * store the K.
     *
@@ -383,7 +387,7 @@ double outFastD[],
        * its allocated size is not guarantee to be as large as
        * the input.
        */
-      ARRAY_ALLOC( tempBuffer, endIdx-today+1 );
+      ARRAY_ALLOC( tempBuffer, TA_STOCH_K_SIZE(today,endIdx) );
    #else
       if( (outFastK == inHigh) ||
           (outFastK == inLow)  ||
@@ -402,7 +406,7 @@ double outFastD[],
          #if !defined( _MANAGED ) && !defined( _JAVA )
             bufferIsAllocated = 1;
          #endif
-         ARRAY_ALLOC(tempBuffer, endIdx-today+1 );
+         ARRAY_ALLOC(tempBuffer, TA_STOCH_K_SIZE(today,endIdx) );
       }
    #endif
 
@@ -413,18 +417,8 @@ double outFastD[],
       tmp = inLow[today];
       if( lowestIdx < trailingIdx )
       {
-         lowestIdx = trailingIdx;
+         WINDOW_LOWEST_FIND(lowestWindow,inLow,trailingIdx,today,lowestIdx);
          lowest = inLow[lowestIdx];
-         i = lowestIdx;
-         while( ++i<=today )
-         {
-            tmp = inLow[i];
-            if( tmp < lowest )
-            {
-               lowestIdx = i;
-               lowest = tmp;
-            }
-         }
          diff = (highest - lowest)/100.0;
       }
       else if( tmp <= lowest )
@@ -438,18 +432,8 @@ double outFastD[],
       tmp = inHigh[today];
       if( highestIdx < trailingIdx )
       {
-         highestIdx = trailingIdx;
+         WINDOW_HIGHEST_FIND(highestWindow,inHigh,trailingIdx,today,highestIdx);
          highest = inHigh[highestIdx];
-         i = highestIdx;
-         while( ++i<=today )
-         {
-            tmp = inHigh[i];
-            if( tmp > highest )
-            {
-               highestIdx = i;
-               highest = tmp;
-            }
-         }
          diff = (highest - lowest)/100.0;
       }
       else if( tmp >= highest )
@@ -469,6 +453,9 @@ double outFastD[],
       today++;
    }
 
+   FREE_WINDOW_EXTREME(lowestWindow);
+   FREE_WINDOW_EXTREME(highestWindow);
+
    /* Fast-K calculation completed. This K calculation is returned
     * to the caller. It is smoothed to become Fast-D.
     */
@@ -593,7 +580,9 @@ double outFastD[],
 /* Generated */    ARRAY_REF( tempBuffer );
 /* Generated */    int outIdx, lowestIdx, highestIdx;
 /* Generated */    int lookbackTotal, lookbackK, lookbackFastD;
-/* Generated */    int trailingIdx, today, i;
+/* Generated */    int trailingIdx, today;
+/* Generated */    WINDOW_EXTREME_VARIABLES(lowestWindow);
+/* Generated */    WINDOW_EXTREME_VARIABLES(highestWindow);
 /* Generated */    #if !defined( _MANAGED ) && !defined(USE_SINGLE_PRECISION_INPUT) && !defined( _JAVA )
 /* Generated */    int bufferIsAllocated;
 /* Generated */    #endif
@@ -646,11 +635,12 @@ double outFastD[],
 /* Generated */    today       = trailingIdx+lookbackK;
 /* Generated */    lowestIdx   = highestIdx = -1;
 /* Generated */    diff = highest = lowest  = 0.0;
+/* Generated */    INIT_WINDOW_EXTREME_PAIR(lowestWindow,highestWindow,optInFastK_Period);
 /* Generated */    #if !defined( _MANAGED ) && !defined(USE_SINGLE_PRECISION_INPUT) && !defined( _JAVA )
 /* Generated */       bufferIsAllocated = 0;
 /* Generated */    #endif
 /* Generated */    #if defined(USE_SINGLE_PRECISION_INPUT) || defined( USE_SUBARRAY )
-/* Generated */       ARRAY_ALLOC( tempBuffer, endIdx-today+1 );
+/* Generated */       ARRAY_ALLOC( tempBuffer, TA_STOCH_K_SIZE(today,endIdx) );
 /* Generated */    #else
 /* Generated */       if( (outFastK == inHigh) ||
 /* Generated */           (outFastK == inLow)  ||
@@ -669,7 +659,7 @@ double outFastD[],
 /* Generated */          #if !defined( _MANAGED ) && !defined( _JAVA )
 /* Generated */             bufferIsAllocated = 1;
 /* Generated */          #endif
-/* Generated */          ARRAY_ALLOC(tempBuffer, endIdx-today+1 );
+/* Generated */          ARRAY_ALLOC(tempBuffer, TA_STOCH_K_SIZE(today,endIdx) );
 /* Generated */       }
 /* Generated */    #endif
 /* Generated */    while( today <= endIdx )
@@ -677,18 +667,8 @@ double outFastD[],
 /* Generated */       tmp = inLow[today];
 /* Generated */       if( lowestIdx < trailingIdx )
 /* Generated */       {
-/* Generated */          lowestIdx = trailingIdx;
+/* Generated */          WINDOW_LOWEST_FIND(lowestWindow,inLow,trailingIdx,today,lowestIdx);
 /* Generated */          lowest = inLow[lowestIdx];
-/* Generated */          i = lowestIdx;
-/* Generated */          while( ++i<=today )
-/* Generated */          {
-/* Generated */             tmp = inLow[i];
-/* Generated */             if( tmp < lowest )
-/* Generated */             {
-/* Generated */                lowestIdx = i;
-/* Generated */                lowest = tmp;
-/* Generated */             }
-/* Generated */          }
 /* Generated */          diff = (highest - lowest)/100.0;
 /* Generated */       }
 /* Generated */       else if( tmp <= lowest )
@@ -700,18 +680,8 @@ double outFastD[],
 /* Generated */       tmp = inHigh[today];
 /* Generated */       if( highestIdx < trailingIdx )
 /* Generated */       {
-/* Generated */          highestIdx = trailingIdx;
+/* Generated */          WINDOW_HIGHEST_FIND(highestWindow,inHigh,trailingIdx,today,highestIdx);
 /* Generated */          highest = inHigh[highestIdx];
-/* Generated */          i = highestIdx;
-/* Generated */          while( ++i<=today )
-/* Generated */          {
-/* Generated */             tmp = inHigh[i];
-/* Generated */             if( tmp > highest )
-/* Generated */             {
-/* Generated */                highestIdx = i;
-/* Generated */                highest = tmp;
-/* Generated */             }
-/* Generated */          }
 /* Generated */          diff = (highest - lowest)/100.0;
 /* Generated */       }
 /* Generated */       else if( tmp >= highest )
@@ -727,6 +697,8 @@ double outFastD[],
 /* Generated */       trailingIdx++;
 /* Generated */       today++;
 /* Generated */    }
+/* Generated */    FREE_WINDOW_EXTREME(lowestWindow);
+/* Generated */    FREE_WINDOW_EXTREME(highestWindow);
 /* Generated */    retCode = FUNCTION_CALL_DOUBLE(MA)( 0, outIdx-1,
 /* Generated */                                        tempBuffer, optInFastD_Period,
 /* Generated */                                        optInFastD_MAType,
@@ -342,7 +342,7 @@ double outFastD[],
 
    VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
 
-   tempArraySize = (endIdx - startIdx) + 1 + lookbackSTOCHF;
+   tempArraySize = TA_STOCHRSI_RSI_SIZE(startIdx,endIdx,lookbackSTOCHF);
 
    ARRAY_ALLOC( tempRSIBuffer, tempArraySize );
 
@@ -505,7 +505,7 @@ double outFastD[],
 /* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */    }
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
-/* Generated */    tempArraySize = (endIdx - startIdx) + 1 + lookbackSTOCHF;
+/* Generated */    tempArraySize = TA_STOCHRSI_RSI_SIZE(startIdx,endIdx,lookbackSTOCHF);
 /* Generated */    ARRAY_ALLOC( tempRSIBuffer, tempArraySize );
 /* Generated */    retCode = FUNCTION_CALL(RSI)(startIdx-lookbackSTOCHF,
 /* Generated */                                 endIdx,
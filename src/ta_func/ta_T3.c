@@ -287,7 +287,7 @@ double outReal[],
    tempReal = e1;
    for( i=optInTimePeriod-1; i > 0 ; i-- )
    {
-      e1 = (k*inReal[today++])+(one_minus_k*e1);
+      e1 = TA_T3_EMA_STEP(e1,inReal[today++],k,one_minus_k);
       tempReal += e1;
    }
    e2 = tempReal / optInTimePeriod;
@@ -296,8 +296,8 @@ double outReal[],
    tempReal = e2;
    for( i=optInTimePeriod-1; i > 0 ; i-- )
    {
-      e1  = (k*inReal[today++])+(one_minus_k*e1);
-      e2  = (k*e1)+(one_minus_k*e2);
+      e1 = TA_T3_EMA_STEP(e1,inReal[today++],k,one_minus_k);
+      e2 = TA_T3_EMA_STEP(e2,e1,k,one_minus_k);
       tempReal += e2;
    }
    e3 = tempReal / optInTimePeriod;
@@ -306,9 +306,9 @@ double outReal[],
    tempReal = e3;
    for( i=optInTimePeriod-1; i > 0 ; i-- )
    {
-      e1  = (k*inReal[today++])+(one_minus_k*e1);
-      e2  = (k*e1)+(one_minus_k*e2);
-      e3  = (k*e2)+(one_minus_k*e3);
+      e1 = TA_T3_EMA_STEP(e1,inReal[today++],k,one_minus_k);
+      e2 = TA_T3_EMA_STEP(e2,e1,k,one_minus_k);
+      e3 = TA_T3_EMA_STEP(e3,e2,k,one_minus_k);
       tempReal += e3;
    }
    e4 = tempReal / optInTimePeriod;
@@ -317,10 +317,10 @@ double outReal[],
    tempReal = e4;
    for( i=optInTimePeriod-1; i > 0 ; i-- )
    {
-      e1  = (k*inReal[today++])+(one_minus_k*e1);
-      e2  = (k*e1)+(one_minus_k*e2);
-      e3  = (k*e2)+(one_minus_k*e3);
-      e4  = (k*e3)+(one_minus_k*e4);
+      e1 = TA_T3_EMA_STEP(e1,inReal[today++],k,one_minus_k);
+      e2 = TA_T3_EMA_STEP(e2,e1,k,one_minus_k);
+      e3 = TA_T3_EMA_STEP(e3,e2,k,one_minus_k);
+      e4 = TA_T3_EMA_STEP(e4,e3,k,one_minus_k);
       tempReal += e4;
    }
    e5 = tempReal / optInTimePeriod;
@@ -329,11 +329,11 @@ double outReal[],
    tempReal = e5;
    for( i=optInTimePeriod-1; i > 0 ; i-- )
    {
-      e1  = (k*inReal[today++])+(one_minus_k*e1);
-      e2  = (k*e1)+(one_minus_k*e2);
-      e3  = (k*e2)+(one_minus_k*e3);
-      e4  = (k*e3)+(one_minus_k*e4);
-      e5  = (k*e4)+(one_minus_k*e5);
+      e1 = TA_T3_EMA_STEP(e1,inReal[today++],k,one_minus_k);
+      e2 = TA_T3_EMA_STEP(e2,e1,k,one_minus_k);
+      e3 = TA_T3_EMA_STEP(e3,e2,k,one_minus_k);
+      e4 = TA_T3_EMA_STEP(e4,e3,k,one_minus_k);
+      e5 = TA_T3_EMA_STEP(e5,e4,k,one_minus_k);
       tempReal += e5;
    }
    e6 = tempReal / optInTimePeriod;
@@ -342,12 +342,12 @@ double outReal[],
    while( today <= startIdx )
    {
       /* Do the calculation but do not write the output */
-      e1  = (k*inReal[today++])+(one_minus_k*e1);
-      e2  = (k*e1)+(one_minus_k*e2);
-      e3  = (k*e2)+(one_minus_k*e3);
-      e4  = (k*e3)+(one_minus_k*e4);
-      e5  = (k*e4)+(one_minus_k*e5);
-      e6  = (k*e5)+(one_minus_k*e6);
+      e1 = TA_T3_EMA_STEP(e1,inReal[today++],k,one_minus_k);
+      e2 = TA_T3_EMA_STEP(e2,e1,k,one_minus_k);
+      e3 = TA_T3_EMA_STEP(e3,e2,k,one_minus_k);
+      e4 = TA_T3_EMA_STEP(e4,e3,k,one_minus_k);
+      e5 = TA_T3_EMA_STEP(e5,e4,k,one_minus_k);
+      e6 = TA_T3_EMA_STEP(e6,e5,k,one_minus_k);
    }
 
    /* Calculate the constants */
@@ -359,18 +359,18 @@ double outReal[],
 
    /* Write the first output */
    outIdx = 0;
-  	outReal[outIdx++] = c1*e6+c2*e5+c3*e4+c4*e3;
+   outReal[outIdx++] = TA_T3_VALUE(e3,e4,e5,e6,c1,c2,c3,c4);
 
    /* Calculate and output the remaining of the range. */
    while( today <= endIdx )
    {
-      e1  = (k*inReal[today++])+(one_minus_k*e1);
-      e2  = (k*e1)+(one_minus_k*e2);
-      e3  = (k*e2)+(one_minus_k*e3);
-      e4  = (k*e3)+(one_minus_k*e4);
-      e5  = (k*e4)+(one_minus_k*e5);
-      e6  = (k*e5)+(one_minus_k*e6);
-      outReal[outIdx++] = c1*e6+c2*e5+c3*e4+c4*e3;
+      e1 = TA_T3_EMA_STEP(e1,inReal[today++],k,one_minus_k);
+      e2 = TA_T3_EMA_STEP(e2,e1,k,one_minus_k);
+      e3 = TA_T3_EMA_STEP(e3,e2,k,one_minus_k);
+      e4 = TA_T3_EMA_STEP(e4,e3,k,one_minus_k);
+      e5 = TA_T3_EMA_STEP(e5,e4,k,one_minus_k);
+      e6 = TA_T3_EMA_STEP(e6,e5,k,one_minus_k);
+      outReal[outIdx++] = TA_T3_VALUE(e3,e4,e5,e6,c1,c2,c3,c4);
    }
 
    /* Indicates to the caller the number of output
@@ -482,56 +482,56 @@ double outReal[],
 /* Generated */    tempReal = e1;
 /* Generated */    for( i=optInTimePeriod-1; i > 0 ; i-- )
 /* Generated */    {
-/* Generated */       e1 = (k*inReal[today++])+(one_minus_k*e1);
+/* Generated */       e1 = TA_T3_EMA_STEP(e1,inReal[today++],k,one_minus_k);
 /* Generated */       tempReal += e1;
 /* Generated */    }
 /* Generated */    e2 = tempReal / optInTimePeriod;
 /* Generated */    tempReal = e2;
 /* Generated */    for( i=optInTimePeriod-1; i > 0 ; i-- )
 /* Generated */    {
-/* Generated */       e1  = (k*inReal[today++])+(one_minus_k*e1);
-/* Generated */       e2  = (k*e1)+(one_minus_k*e2);
+/* Generated */       e1 = TA_T3_EMA_STEP(e1,inReal[today++],k,one_minus_k);
+/* Generated */       e2 = TA_T3_EMA_STEP(e2,e1,k,one_minus_k);
 /* Generated */       tempReal += e2;
 /* Generated */    }
 /* Generated */    e3 = tempReal / optInTimePeriod;
 /* Generated */    tempReal = e3;
 /* Generated */    for( i=optInTimePeriod-1; i > 0 ; i-- )
 /* Generated */    {
-/* Generated */       e1  = (k*inReal[today++])+(one_minus_k*e1);
-/* Generated */       e2  = (k*e1)+(one_minus_k*e2);
-/* Generated */       e3  = (k*e2)+(one_minus_k*e3);
+/* Generated */       e1 = TA_T3_EMA_STEP(e1,inReal[today++],k,one_minus_k);
+/* Generated */       e2 = TA_T3_EMA_STEP(e2,e1,k,one_minus_k);
+/* Generated */       e3 = TA_T3_EMA_STEP(e3,e2,k,one_minus_k);
 /* Generated */       tempReal += e3;
 /* Generated */    }
 /* Generated */    e4 = tempReal / optInTimePeriod;
 /* Generated */    tempReal = e4;
 /* Generated */    for( i=optInTimePeriod-1; i > 0 ; i-- )
 /* Generated */    {
-/* Generated */       e1  = (k*inReal[today++])+(one_minus_k*e1);
-/* Generated */       e2  = (k*e1)+(one_minus_k*e2);
-/* Generated */       e3  = (k*e2)+(one_minus_k*e3);
-/* Generated */       e4  = (k*e3)+(one_minus_k*e4);
+/* Generated */       e1 = TA_T3_EMA_STEP(e1,inReal[today++],k,one_minus_k);
+/* Generated */       e2 = TA_T3_EMA_STEP(e2,e1,k,one_minus_k);
+/* Generated */       e3 = TA_T3_EMA_STEP(e3,e2,k,one_minus_k);
+/* Generated */       e4 = TA_T3_EMA_STEP(e4,e3,k,one_minus_k);
 /* Generated */       tempReal += e4;
 /* Generated */    }
 /* Generated */    e5 = tempReal / optInTimePeriod;
 /* Generated */    tempReal = e5;
 /* Generated */    for( i=optInTimePeriod-1; i > 0 ; i-- )
 /* Generated */    {
-/* Generated */       e1  = (k*inReal[today++])+(one_minus_k*e1);
-/* Generated */       e2  = (k*e1)+(one_minus_k*e2);
-/* Generated */       e3  = (k*e2)+(one_minus_k*e3);
-/* Generated */       e4  = (k*e3)+(one_minus_k*e4);
-/* Generated */       e5  = (k*e4)+(one_minus_k*e5);
+/* Generated */       e1 = TA_T3_EMA_STEP(e1,inReal[today++],k,one_minus_k);
+/* Generated */       e2 = TA_T3_EMA_STEP(e2,e1,k,one_minus_k);
+/* Generated */       e3 = TA_T3_EMA_STEP(e3,e2,k,one_minus_k);
+/* Generated */       e4 = TA_T3_EMA_STEP(e4,e3,k,one_minus_k);
+/* Generated */       e5 = TA_T3_EMA_STEP(e5,e4,k,one_minus_k);
 /* Generated */       tempReal += e5;
 /* Generated */    }
 /* Generated */    e6 = tempReal / optInTimePeriod;
 /* Generated */    while( today <= startIdx )
 /* Generated */    {
-/* Generated */       e1  = (k*inReal[today++])+(one_minus_k*e1);
-/* Generated */       e2  = (k*e1)+(one_minus_k*e2);
-/* Generated */       e3  = (k*e2)+(one_minus_k*e3);
-/* Generated */       e4  = (k*e3)+(one_minus_k*e4);
-/* Generated */       e5  = (k*e4)+(one_minus_k*e5);
-/* Generated */       e6  = (k*e5)+(one_minus_k*e6);
+/* Generated */       e1 = TA_T3_EMA_STEP(e1,inReal[today++],k,one_minus_k);
+/* Generated */       e2 = TA_T3_EMA_STEP(e2,e1,k,one_minus_k);
+/* Generated */       e3 = TA_T3_EMA_STEP(e3,e2,k,one_minus_k);
+/* Generated */       e4 = TA_T3_EMA_STEP(e4,e3,k,one_minus_k);
+/* Generated */       e5 = TA_T3_EMA_STEP(e5,e4,k,one_minus_k);
+/* Generated */       e6 = TA_T3_EMA_STEP(e6,e5,k,one_minus_k);
 /* Generated */    }
 /* Generated */    tempReal = optInVFactor * optInVFactor;
 /* Generated */    c1 = -(tempReal * optInVFactor);
@@ -539,16 +539,16 @@ double outReal[],
 /* Generated */    c3 = -6.0 * tempReal - 3.0 * (optInVFactor-c1);
 /* Generated */    c4 = 1.0 + 3.0 * optInVFactor - c1 + 3.0 * tempReal;
 /* Generated */    outIdx = 0;
-/* Generated */   	outReal[outIdx++] = c1*e6+c2*e5+c3*e4+c4*e3;
+/* Generated */    outReal[outIdx++] = TA_T3_VALUE(e3,e4,e5,e6,c1,c2,c3,c4);
 /* Generated */    while( today <= endIdx )
 /* Generated */    {
-/* Generated */       e1  = (k*inReal[today++])+(one_minus_k*e1);
-/* Generated */       e2  = (k*e1)+(one_minus_k*e2);
-/* Generated */       e3  = (k*e2)+(one_minus_k*e3);
-/* Generated */       e4  = (k*e3)+(one_minus_k*e4);
-/* Generated */       e5  = (k*e4)+(one_minus_k*e5);
-/* Generated */       e6  = (k*e5)+(one_minus_k*e6);
-/* Generated */       outReal[outIdx++] = c1*e6+c2*e5+c3*e4+c4*e3;
+/* Generated */       e1 = TA_T3_EMA_STEP(e1,inReal[today++],k,one_minus_k);
+/* Generated */       e2 = TA_T3_EMA_STEP(e2,e1,k,one_minus_k);
+/* Generated */       e3 = TA_T3_EMA_STEP(e3,e2,k,one_minus_k);
+/* Generated */       e4 = TA_T3_EMA_STEP(e4,e3,k,one_minus_k);
+/* Generated */       e5 = TA_T3_EMA_STEP(e5,e4,k,one_minus_k);
+/* Generated */       e6 = TA_T3_EMA_STEP(e6,e5,k,one_minus_k);
+/* Generated */       outReal[outIdx++] = TA_T3_VALUE(e3,e4,e5,e6,c1,c2,c3,c4);
 /* Generated */    }
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
@@ -269,7 +269,7 @@ double outReal[],
       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 
    /* Allocate a temporary buffer for the firstEMA. */
-   tempInt = lookbackTotal+(endIdx-startIdx)+1;
+   tempInt = TA_TEMA_EMA1_SIZE(startIdx,endIdx,lookbackEMA);
    ARRAY_ALLOC(firstEMA,tempInt);
    #if !defined( _JAVA )
       if( !firstEMA )
@@ -293,7 +293,7 @@ double outReal[],
    }
 
    /* Allocate a temporary buffer for storing the EMA2 */
-   ARRAY_ALLOC(secondEMA,VALUE_HANDLE_GET(firstEMANbElement));
+   ARRAY_ALLOC(secondEMA,TA_TEMA_EMA2_SIZE(startIdx,endIdx,lookbackEMA));
    #if !defined( _JAVA ) && !defined( USE_SUBARRAY )
       if( !secondEMA )
       {
@@ -450,7 +450,7 @@ double outReal[],
 /* Generated */       startIdx = lookbackTotal;
 /* Generated */    if( startIdx > endIdx )
 /* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
-/* Generated */    tempInt = lookbackTotal+(endIdx-startIdx)+1;
+/* Generated */    tempInt = TA_TEMA_EMA1_SIZE(startIdx,endIdx,lookbackEMA);
 /* Generated */    ARRAY_ALLOC(firstEMA,tempInt);
 /* Generated */    #if !defined( _JAVA )
 /* Generated */       if( !firstEMA )
@@ -466,7 +466,7 @@ double outReal[],
 /* Generated */       ARRAY_FREE( firstEMA );
 /* Generated */       return retCode;
 /* Generated */    }
-/* Generated */    ARRAY_ALLOC(secondEMA,VALUE_HANDLE_GET(firstEMANbElement));
+/* Generated */    ARRAY_ALLOC(secondEMA,TA_TEMA_EMA2_SIZE(startIdx,endIdx,lookbackEMA));
 /* Generated */    #if !defined( _JAVA ) && !defined( USE_SUBARRAY )
 /* Generated */       if( !secondEMA )
 /* Generated */       {
@@ -45,6 +45,8 @@
  *  112400 MF   Template creation.
  *  052603 MF   Adapt code to compile with .NET Managed C++
  *  020605 AA   Fix #1117656. NULL pointer assignement.
+ *  101826 MF   Fix output shifted by one EMA lookback when startIdx
+ *              is after the lookback.
  */
 
 /**** START GENCODE SECTION 1 - DO NOT DELETE THIS LINE ****/
@@ -236,7 +238,7 @@ double outReal[],
 
    VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
 
-   nbElementToOutput = (endIdx-startIdx)+1+totalLookback;
+   nbElementToOutput = TA_TRIX_EMA_SIZE(startIdx,endIdx,totalLookback);
 
    /* Allocate a temporary buffer for performing
     * the calculation.
@@ -252,9 +254,11 @@ double outReal[],
       }
    #endif
 
-   /* Calculate the first EMA */
+   /* Calculate the first EMA. INT_EMA adds its own lookback
+    * to the start of its output.
+    */
    k = PER_TO_K(optInTimePeriod);
-   retCode = FUNCTION_CALL(INT_EMA)( (startIdx-totalLookback), endIdx, inReal,
+   retCode = FUNCTION_CALL(INT_EMA)( (startIdx-totalLookback)+emaLookback, endIdx, inReal,
                                      optInTimePeriod, k,
                                      VALUE_HANDLE_OUT(begIdx), VALUE_HANDLE_OUT(nbElement),
 								     tempBuffer );
@@ -416,7 +420,7 @@ double outReal[],
 /* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */    }
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
-/* Generated */    nbElementToOutput = (endIdx-startIdx)+1+totalLookback;
+/* Generated */    nbElementToOutput = TA_TRIX_EMA_SIZE(startIdx,endIdx,totalLookback);
 /* Generated */    ARRAY_ALLOC(tempBuffer, nbElementToOutput );
 /* Generated */    #if !defined( _JAVA ) && !defined( USE_SUBARRAY )
 /* Generated */       if( !tempBuffer )
@@ -427,7 +431,7 @@ double outReal[],
 /* Generated */       }
 /* Generated */    #endif
 /* Generated */    k = PER_TO_K(optInTimePeriod);
-/* Generated */    retCode = FUNCTION_CALL(INT_EMA)( (startIdx-totalLookback), endIdx, inReal,
+/* Generated */    retCode = FUNCTION_CALL(INT_EMA)( (startIdx-totalLookback)+emaLookback, endIdx, inReal,
 /* Generated */                                      optInTimePeriod, k,
 /* Generated */                                      VALUE_HANDLE_OUT(begIdx), VALUE_HANDLE_OUT(nbElement),
 /* Generated */ 								     tempBuffer );
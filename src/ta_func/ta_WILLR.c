@@ -186,7 +186,9 @@ double outReal[],
    double lowest, highest, tmp, diff;
    int outIdx, nbInitialElementNeeded;
    int trailingIdx, lowestIdx, highestIdx;
-   int today, i;
+   int today;
+   WINDOW_EXTREME_VARIABLES(lowestWindow);
+   WINDOW_EXTREME_VARIABLES(highestWindow);
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -258,24 +260,16 @@ double outReal[],
    lowestIdx   = highestIdx = -1;
    diff = highest = lowest  = 0.0;
 
+   INIT_WINDOW_EXTREME_PAIR(lowestWindow,highestWindow,optInTimePeriod);
+
    while( today <= endIdx )
    {
       /* Set the lowest low */
       tmp = inLow[today];
       if( lowestIdx < trailingIdx )
       {
-         lowestIdx = trailingIdx;
+         WINDOW_LOWEST_FIND(lowestWindow,inLow,trailingIdx,today,lowestIdx);
          lowest = inLow[lowestIdx];
-         i = lowestIdx;
-         while( ++i<=today )
-         {
-            tmp = inLow[i];
-            if( tmp < lowest )
-            {
-               lowestIdx = i;
-               lowest = tmp;
-            }
-         }
          diff = (highest - lowest)/(-100.0);
       }
       else if( tmp <= lowest )
@@ -289,18 +283,8 @@ double outReal[],
       tmp = inHigh[today];
       if( highestIdx < trailingIdx )
       {
-         highestIdx = trailingIdx;
+         WINDOW_HIGHEST_FIND(highestWindow,inHigh,trailingIdx,today,highestIdx);
          highest = inHigh[highestIdx];
-         i = highestIdx;
-         while( ++i<=today )
-         {
-            tmp = inHigh[i];
-            if( tmp > highest )
-            {
-               highestIdx = i;
-               highest = tmp;
-            }
-         }
          diff = (highest - lowest)/(-100.0);
       }
       else if( tmp >= highest )
@@ -319,6 +303,9 @@ double outReal[],
       today++;
    }
 
+   FREE_WINDOW_EXTREME(lowestWindow);
+   FREE_WINDOW_EXTREME(highestWindow);
+
    /* Keep the outBegIdx relative to the
     * caller input before returning.
     */
@@ -386,7 +373,9 @@ double outReal[],
 /* Generated */    double lowest, highest, tmp, diff;
 /* Generated */    int outIdx, nbInitialElementNeeded;
 /* Generated */    int trailingIdx, lowestIdx, highestIdx;
-/* Generated */    int today, i;
+/* Generated */    int today;
+/* Generated */    WINDOW_EXTREME_VARIABLES(lowestWindow);
+/* Generated */    WINDOW_EXTREME_VARIABLES(highestWindow);
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -423,23 +412,14 @@ double outReal[],
 /* Generated */    trailingIdx = startIdx-nbInitialElementNeeded;
 /* Generated */    lowestIdx   = highestIdx = -1;
 /* Generated */    diff = highest = lowest  = 0.0;
+/* Generated */    INIT_WINDOW_EXTREME_PAIR(lowestWindow,highestWindow,optInTimePeriod);
 /* Generated */    while( today <= endIdx )
 /* Generated */    {
 /* Generated */       tmp = inLow[today];
 /* Generated */       if( lowestIdx < trailingIdx )
 /* Generated */       {
-/* Generated */          lowestIdx = trailingIdx;
+/* Generated */          WINDOW_LOWEST_FIND(lowestWindow,inLow,trailingIdx,today,lowestIdx);
 /* Generated */          lowest = inLow[lowestIdx];
-/* Generated */          i = lowestIdx;
-/* Generated */          while( ++i<=today )
-/* Generated */          {
-/* Generated */             tmp = inLow[i];
-/* Generated */             if( tmp < lowest )
-/* Generated */             {
-/* Generated */                lowestIdx = i;
-/* Generated */                lowest = tmp;
-/* Generated */             }
-/* Generated */          }
 /* Generated */          diff = (highest - lowest)/(-100.0);
 /* Generated */       }
 /* Generated */       else if( tmp <= lowest )
@@ -451,18 +431,8 @@ double outReal[],
 /* Generated */       tmp = inHigh[today];
 /* Generated */       if( highestIdx < trailingIdx )
 /* Generated */       {
-/* Generated */          highestIdx = trailingIdx;
+/* Generated */          WINDOW_HIGHEST_FIND(highestWindow,inHigh,trailingIdx,today,highestIdx);
 /* Generated */          highest = inHigh[highestIdx];
-/* Generated */          i = highestIdx;
-/* Generated */          while( ++i<=today )
-/* Generated */          {
-/* Generated */             tmp = inHigh[i];
-/* Generated */             if( tmp > highest )
-/* Generated */             {
-/* Generated */                highestIdx = i;
-/* Generated */                highest = tmp;
-/* Generated */             }
-/* Generated */          }
 /* Generated */          diff = (highest - lowest)/(-100.0);
 /* Generated */       }
 /* Generated */       else if( tmp >= highest )
@@ -478,6 +448,8 @@ double outReal[],
 /* Generated */       trailingIdx++;
 /* Generated */       today++;
 /* Generated */    }
+/* Generated */    FREE_WINDOW_EXTREME(lowestWindow);
+/* Generated */    FREE_WINDOW_EXTREME(highestWindow);
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
@@ -0,0 +1,1981 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ */
+
+/* Description:
+ *   Recognize many candlestick patterns in one pass on the same
+ *   input.
+ *
+ *   Each TA_CDLXXX compares the candles with averages of the ranges
+ *   of the previous candles (see TA_SetCandleSettings). These
+ *   averages come from a running total for each candle setting used
+ *   by the pattern: the total starts with the sum of the avgPeriod
+ *   ranges before the first candle compared, then the range of the
+ *   next candle is added and the range of the oldest is subtracted
+ *   after each bar.
+ *
+ *   Such a running total depends only on the candle setting and on
+ *   the index of the first range summed. Here, each distinct
+ *   (setting, first index) running total is calculated only once and
+ *   is shared by all the patterns needing it, and so is the average
+ *   calculated from it. The floating point operations are done in
+ *   the same order as the TA_CDLXXX, so the outputs are identical.
+ *
+ *   The recognition of each pattern is the same code as in its
+ *   TA_CDLXXX.
+ */
+
+/**** Headers ****/
+#include <math.h>
+
+#include "ta_func_ext.h"
+#include "ta_memory.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+
+/* The bars are done by blocks: the running totals are first advanced
+ * over the block (keeping the average of each window), then each
+ * pattern is recognized on all the bars of the block.
+ *
+ * The patterns compare with the averages of at most the 4 previous
+ * candles, so a block keeps the averages of CDL_ALL_NB_SHIFT-1 more
+ * windows.
+ */
+#define CDL_ALL_BLOCK     256
+#define CDL_ALL_NB_SHIFT  5
+#define CDL_ALL_BLOCK_AVG (CDL_ALL_BLOCK+CDL_ALL_NB_SHIFT-1)
+
+/* Average of the SET candle setting for the candle IDX, for the
+ * pattern recognized at the bar i. Same value as TA_CANDLEAVERAGE with
+ * the running total of the pattern.
+ */
+#define CDL_AVG(SET,IDX) \
+    (avgRow[(TA_##SET*CDL_ALL_NB_SHIFT)+(i-(IDX))][(IDX)-blockIdx+(CDL_ALL_NB_SHIFT-1)])
+
+/* Output of the pattern recognized at the bar i. */
+#define CDL_OUTPUT(VALUE) \
+   if( i >= begIdx ) \
+   { \
+      if( outRow ) \
+         outRow[i-begIdx] = VALUE; \
+      if( outMask && (VALUE != 0) ) \
+         outMask[i-startIdx] |= bit; \
+   }
+
+/* Running total of the ranges of a candle setting. windowIdx is the
+ * index of the first range in 'sum' (of the candle compared when
+ * avgPeriod is zero).
+ */
+typedef struct
+{
+   TA_CandleSettingType setting;
+   TA_RangeType         rangeType;
+   int                  avgPeriod;
+   double               factor;
+   int                  windowIdx;
+   double               sum;
+} CdlAllTotal;
+
+/* State of one of the requested patterns. */
+typedef struct
+{
+   TA_CDLPattern pattern;
+   int           firstIdx;      /* First bar recognized.              */
+   int           begIdx;        /* First bar output.                  */
+   double        penetration;
+   int           patternIdx;    /* CDLHIKKAKE and CDLHIKKAKEMOD only. */
+   int           patternResult;
+
+   /* Averages of the windows of the block, for each
+    * candle setting and candle before the bar.
+    */
+   const double *avgRow[TA_AllCandleSettings*CDL_ALL_NB_SHIFT];
+} CdlAllPattern;
+
+/* Candle settings used by each pattern, with the number of bars
+ * before the current one of the candle compared to the average.
+ */
+typedef struct
+{
+   TA_CDLPattern        pattern;
+   TA_CandleSettingType setting;
+   int                  shift;
+} CdlAllAverage;
+
+static const CdlAllAverage cdlAllAverage[] =
+{
+   { TA_CDLPattern_2CROWS,           TA_BodyLong,        2 },
+   { TA_CDLPattern_3BLACKCROWS,      TA_ShadowVeryShort, 2 },
+   { TA_CDLPattern_3BLACKCROWS,      TA_ShadowVeryShort, 1 },
+   { TA_CDLPattern_3BLACKCROWS,      TA_ShadowVeryShort, 0 },
+   { TA_CDLPattern_3INSIDE,          TA_BodyLong,        2 },
+   { TA_CDLPattern_3INSIDE,          TA_BodyShort,       1 },
+   { TA_CDLPattern_3LINESTRIKE,      TA_Near,            3 },
+   { TA_CDLPattern_3LINESTRIKE,      TA_Near,            2 },
+   { TA_CDLPattern_3STARSINSOUTH,    TA_BodyLong,        2 },
+   { TA_CDLPattern_3STARSINSOUTH,    TA_BodyShort,       0 },
+   { TA_CDLPattern_3STARSINSOUTH,    TA_ShadowLong,      2 },
+   { TA_CDLPattern_3STARSINSOUTH,    TA_ShadowVeryShort, 1 },
+   { TA_CDLPattern_3STARSINSOUTH,    TA_ShadowVeryShort, 0 },
+   { TA_CDLPattern_3WHITESOLDIERS,   TA_BodyShort,       0 },
+   { TA_CDLPattern_3WHITESOLDIERS,   TA_Far,             2 },
+   { TA_CDLPattern_3WHITESOLDIERS,   TA_Far,             1 },
+   { TA_CDLPattern_3WHITESOLDIERS,   TA_Near,            2 },
+   { TA_CDLPattern_3WHITESOLDIERS,   TA_Near,            1 },
+   { TA_CDLPattern_3WHITESOLDIERS,   TA_ShadowVeryShort, 2 },
+   { TA_CDLPattern_3WHITESOLDIERS,   TA_ShadowVeryShort, 1 },
+   { TA_CDLPattern_3WHITESOLDIERS,   TA_ShadowVeryShort, 0 },
+   { TA_CDLPattern_ABANDONEDBABY,    TA_BodyDoji,        1 },
+   { TA_CDLPattern_ABANDONEDBABY,    TA_BodyLong,        2 },
+   { TA_CDLPattern_ABANDONEDBABY,    TA_BodyShort,       0 },
+   { TA_CDLPattern_ADVANCEBLOCK,     TA_BodyLong,        2 },
+   { TA_CDLPattern_ADVANCEBLOCK,     TA_Far,             2 },
+   { TA_CDLPattern_ADVANCEBLOCK,     TA_Far,             1 },
+   { TA_CDLPattern_ADVANCEBLOCK,     TA_Near,            2 },
+   { TA_CDLPattern_ADVANCEBLOCK,     TA_Near,            1 },
+   { TA_CDLPattern_ADVANCEBLOCK,     TA_ShadowLong,      0 },
+   { TA_CDLPattern_ADVANCEBLOCK,     TA_ShadowShort,     2 },
+   { TA_CDLPattern_ADVANCEBLOCK,     TA_ShadowShort,     1 },
+   { TA_CDLPattern_ADVANCEBLOCK,     TA_ShadowShort,     0 },
+   { TA_CDLPattern_BELTHOLD,         TA_BodyLong,        0 },
+   { TA_CDLPattern_BELTHOLD,         TA_ShadowVeryShort, 0 },
+   { TA_CDLPattern_BREAKAWAY,        TA_BodyLong,        4 },
+   { TA_CDLPattern_CLOSINGMARUBOZU,  TA_BodyLong,        0 },
+   { TA_CDLPattern_CLOSINGMARUBOZU,  TA_ShadowVeryShort, 0 },
+   { TA_CDLPattern_CONCEALBABYSWALL, TA_ShadowVeryShort, 3 },
+   { TA_CDLPattern_CONCEALBABYSWALL, TA_ShadowVeryShort, 2 },
+   { TA_CDLPattern_CONCEALBABYSWALL, TA_ShadowVeryShort, 1 },
+   { TA_CDLPattern_COUNTERATTACK,    TA_BodyLong,        1 },
+   { TA_CDLPattern_COUNTERATTACK,    TA_BodyLong,        0 },
+   { TA_CDLPattern_COUNTERATTACK,    TA_Equal,           1 },
+   { TA_CDLPattern_DARKCLOUDCOVER,   TA_BodyLong,        1 },
+   { TA_CDLPattern_DOJI,             TA_BodyDoji,        0 },
+   { TA_CDLPattern_DOJISTAR,         TA_BodyDoji,        0 },
+   { TA_CDLPattern_DOJISTAR,         TA_BodyLong,        1 },
+   { TA_CDLPattern_DRAGONFLYDOJI,    TA_BodyDoji,        0 },
+   { TA_CDLPattern_DRAGONFLYDOJI,    TA_ShadowVeryShort, 0 },
+   { TA_CDLPattern_EVENINGDOJISTAR,  TA_BodyDoji,        1 },
+   { TA_CDLPattern_EVENINGDOJISTAR,  TA_BodyLong,        2 },
+   { TA_CDLPattern_EVENINGDOJISTAR,  TA_BodyShort,       0 },
+   { TA_CDLPattern_EVENINGSTAR,      TA_BodyLong,        2 },
+   { TA_CDLPattern_EVENINGSTAR,      TA_BodyShort,       1 },
+   { TA_CDLPattern_EVENINGSTAR,      TA_BodyShort,       0 },
+   { TA_CDLPattern_GAPSIDESIDEWHITE, TA_Equal,           1 },
+   { TA_CDLPattern_GAPSIDESIDEWHITE, TA_Near,            1 },
+   { TA_CDLPattern_GRAVESTONEDOJI,   TA_BodyDoji,        0 },
+   { TA_CDLPattern_GRAVESTONEDOJI,   TA_ShadowVeryShort, 0 },
+   { TA_CDLPattern_HAMMER,           TA_BodyShort,       0 },
+   { TA_CDLPattern_HAMMER,           TA_Near,            1 },
+   { TA_CDLPattern_HAMMER,           TA_ShadowLong,      0 },
+   { TA_CDLPattern_HAMMER,           TA_ShadowVeryShort, 0 },
+   { TA_CDLPattern_HANGINGMAN,       TA_BodyShort,       0 },
+   { TA_CDLPattern_HANGINGMAN,       TA_Near,            1 },
+   { TA_CDLPattern_HANGINGMAN,       TA_ShadowLong,      0 },
+   { TA_CDLPattern_HANGINGMAN,       TA_ShadowVeryShort, 0 },
+   { TA_CDLPattern_HARAMI,           TA_BodyLong,        1 },
+   { TA_CDLPattern_HARAMI,           TA_BodyShort,       0 },
+   { TA_CDLPattern_HARAMICROSS,      TA_BodyDoji,        0 },
+   { TA_CDLPattern_HARAMICROSS,      TA_BodyLong,        1 },
+   { TA_CDLPattern_HIGHWAVE,         TA_BodyShort,       0 },
+   { TA_CDLPattern_HIGHWAVE,         TA_ShadowVeryLong,  0 },
+   { TA_CDLPattern_HIKKAKEMOD,       TA_Near,            2 },
+   { TA_CDLPattern_HOMINGPIGEON,     TA_BodyLong,        1 },
+   { TA_CDLPattern_HOMINGPIGEON,     TA_BodyShort,       0 },
+   { TA_CDLPattern_IDENTICAL3CROWS,  TA_Equal,           2 },
+   { TA_CDLPattern_IDENTICAL3CROWS,  TA_Equal,           1 },
+   { TA_CDLPattern_IDENTICAL3CROWS,  TA_ShadowVeryShort, 2 },
+   { TA_CDLPattern_IDENTICAL3CROWS,  TA_ShadowVeryShort, 1 },
+   { TA_CDLPattern_IDENTICAL3CROWS,  TA_ShadowVeryShort, 0 },
+   { TA_CDLPattern_INNECK,           TA_BodyLong,        1 },
+   { TA_CDLPattern_INNECK,           TA_Equal,           1 },
+   { TA_CDLPattern_INVERTEDHAMMER,   TA_BodyShort,       0 },
+   { TA_CDLPattern_INVERTEDHAMMER,   TA_ShadowLong,      0 },
+   { TA_CDLPattern_INVERTEDHAMMER,   TA_ShadowVeryShort, 0 },
+   { TA_CDLPattern_KICKING,          TA_BodyLong,        1 },
+   { TA_CDLPattern_KICKING,          TA_BodyLong,        0 },
+   { TA_CDLPattern_KICKING,          TA_ShadowVeryShort, 1 },
+   { TA_CDLPattern_KICKING,          TA_ShadowVeryShort, 0 },
+   { TA_CDLPattern_KICKINGBYLENGTH,  TA_BodyLong,        1 },
+   { TA_CDLPattern_KICKINGBYLENGTH,  TA_BodyLong,        0 },
+   { TA_CDLPattern_KICKINGBYLENGTH,  TA_ShadowVeryShort, 1 },
+   { TA_CDLPattern_KICKINGBYLENGTH,  TA_ShadowVeryShort, 0 },
+   { TA_CDLPattern_LADDERBOTTOM,     TA_ShadowVeryShort, 1 },
+   { TA_CDLPattern_LONGLEGGEDDOJI,   TA_BodyDoji,        0 },
+   { TA_CDLPattern_LONGLEGGEDDOJI,   TA_ShadowLong,      0 },
+   { TA_CDLPattern_LONGLINE,         TA_BodyLong,        0 },
+   { TA_CDLPattern_LONGLINE,         TA_ShadowShort,     0 },
+   { TA_CDLPattern_MARUBOZU,         TA_BodyLong,        0 },
+   { TA_CDLPattern_MARUBOZU,         TA_ShadowVeryShort, 0 },
+   { TA_CDLPattern_MATCHINGLOW,      TA_Equal,           1 },
+   { TA_CDLPattern_MATHOLD,          TA_BodyLong,        4 },
+   { TA_CDLPattern_MATHOLD,          TA_BodyShort,       3 },
+   { TA_CDLPattern_MATHOLD,          TA_BodyShort,       2 },
+   { TA_CDLPattern_MATHOLD,          TA_BodyShort,       1 },
+   { TA_CDLPattern_MORNINGDOJISTAR,  TA_BodyDoji,        1 },
+   { TA_CDLPattern_MORNINGDOJISTAR,  TA_BodyLong,        2 },
+   { TA_CDLPattern_MORNINGDOJISTAR,  TA_BodyShort,       0 },
+   { TA_CDLPattern_MORNINGSTAR,      TA_BodyLong,        2 },
+   { TA_CDLPattern_MORNINGSTAR,      TA_BodyShort,       1 },
+   { TA_CDLPattern_MORNINGSTAR,      TA_BodyShort,       0 },
+   { TA_CDLPattern_ONNECK,           TA_BodyLong,        1 },
+   { TA_CDLPattern_ONNECK,           TA_Equal,           1 },
+   { TA_CDLPattern_PIERCING,         TA_BodyLong,        1 },
+   { TA_CDLPattern_PIERCING,         TA_BodyLong,        0 },
+   { TA_CDLPattern_RICKSHAWMAN,      TA_BodyDoji,        0 },
+   { TA_CDLPattern_RICKSHAWMAN,      TA_Near,            0 },
+   { TA_CDLPattern_RICKSHAWMAN,      TA_ShadowLong,      0 },
+   { TA_CDLPattern_RISEFALL3METHODS, TA_BodyLong,        4 },
+   { TA_CDLPattern_RISEFALL3METHODS, TA_BodyLong,        0 },
+   { TA_CDLPattern_RISEFALL3METHODS, TA_BodyShort,       3 },
+   { TA_CDLPattern_RISEFALL3METHODS, TA_BodyShort,       2 },
+   { TA_CDLPattern_RISEFALL3METHODS, TA_BodyShort,       1 },
+   { TA_CDLPattern_SEPARATINGLINES,  TA_BodyLong,        0 },
+   { TA_CDLPattern_SEPARATINGLINES,  TA_Equal,           1 },
+   { TA_CDLPattern_SEPARATINGLINES,  TA_ShadowVeryShort, 0 },
+   { TA_CDLPattern_SHOOTINGSTAR,     TA_BodyShort,       0 },
+   { TA_CDLPattern_SHOOTINGSTAR,     TA_ShadowLong,      0 },
+   { TA_CDLPattern_SHOOTINGSTAR,     TA_ShadowVeryShort, 0 },
+   { TA_CDLPattern_SHORTLINE,        TA_BodyShort,       0 },
+   { TA_CDLPattern_SHORTLINE,        TA_ShadowShort,     0 },
+   { TA_CDLPattern_SPINNINGTOP,      TA_BodyShort,       0 },
+   { TA_CDLPattern_STALLEDPATTERN,   TA_BodyLong,        2 },
+   { TA_CDLPattern_STALLEDPATTERN,   TA_BodyLong,        1 },
+   { TA_CDLPattern_STALLEDPATTERN,   TA_BodyShort,       0 },
+   { TA_CDLPattern_STALLEDPATTERN,   TA_Near,            2 },
+   { TA_CDLPattern_STALLEDPATTERN,   TA_Near,            1 },
+   { TA_CDLPattern_STALLEDPATTERN,   TA_ShadowVeryShort, 1 },
+   { TA_CDLPattern_STICKSANDWICH,    TA_Equal,           2 },
+   { TA_CDLPattern_TAKURI,           TA_BodyDoji,        0 },
+   { TA_CDLPattern_TAKURI,           TA_ShadowVeryLong,  0 },
+   { TA_CDLPattern_TAKURI,           TA_ShadowVeryShort, 0 },
+   { TA_CDLPattern_TASUKIGAP,        TA_Near,            1 },
+   { TA_CDLPattern_THRUSTING,        TA_BodyLong,        1 },
+   { TA_CDLPattern_THRUSTING,        TA_Equal,           1 },
+   { TA_CDLPattern_TRISTAR,          TA_BodyDoji,        2 },
+   { TA_CDLPattern_UNIQUE3RIVER,     TA_BodyLong,        2 },
+   { TA_CDLPattern_UNIQUE3RIVER,     TA_BodyShort,       0 },
+   { TA_CDLPattern_UPSIDEGAP2CROWS,  TA_BodyLong,        2 },
+   { TA_CDLPattern_UPSIDEGAP2CROWS,  TA_BodyShort,       1 }
+};
+
+#define CDL_ALL_NB_AVERAGE ((int)(sizeof(cdlAllAverage)/sizeof(cdlAllAverage[0])))
+
+/**** Local functions declarations.    ****/
+static int cdlAllLookback( TA_CDLPattern pattern, double optInPenetration );
+
+static TA_RetCode cdlAll( int    startIdx,
+                          int    endIdx,
+                          const double inOpen[],
+                          const double inHigh[],
+                          const double inLow[],
+                          const double inClose[],
+                          const TA_CDLPattern optInPatterns[],
+                          int           optInNbPattern,
+                          double        optInPenetration,
+                          int           outBegIdx[],
+                          int           outNBElement[],
+                          int           outInteger[],
+                          UInt64        outMask[] );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_CDL_ALL( int    startIdx,
+                       int    endIdx,
+                       const double inOpen[],
+                       const double inHigh[],
+                       const double inLow[],
+                       const double inClose[],
+                       const TA_CDLPattern optInPatterns[],
+                       int           optInNbPattern,
+                       double        optInPenetration,
+                       int           outBegIdx[],
+                       int           outNBElement[],
+                       int           outInteger[],
+                       UInt64        outMask[] )
+{
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      if( !inOpen || !inHigh || !inLow || !inClose )
+         return TA_BAD_PARAM;
+   #endif
+
+   return cdlAll( startIdx, endIdx, inOpen, inHigh, inLow, inClose,
+                  optInPatterns, optInNbPattern, optInPenetration,
+                  outBegIdx, outNBElement, outInteger, outMask );
+}
+
+TA_RetCode TA_S_CDL_ALL( int    startIdx,
+                         int    endIdx,
+                         const float  inOpen[],
+                         const float  inHigh[],
+                         const float  inLow[],
+                         const float  inClose[],
+                         const TA_CDLPattern optInPatterns[],
+                         int           optInNbPattern,
+                         double        optInPenetration,
+                         int           outBegIdx[],
+                         int           outNBElement[],
+                         int           outInteger[],
+                         UInt64        outMask[] )
+{
+   int i, nbInput;
+   double *inputs;
+   TA_RetCode retCode;
+
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      if( !inOpen || !inHigh || !inLow || !inClose )
+         return TA_BAD_PARAM;
+      if( (startIdx < 0) || (endIdx < startIdx) )
+         return (startIdx < 0)? TA_OUT_OF_RANGE_START_INDEX : TA_OUT_OF_RANGE_END_INDEX;
+   #endif
+
+   /* The candle macros index the inputs directly, so
+    * the prices are first converted to double.
+    */
+   nbInput = endIdx+1;
+   inputs = (double *)TA_Malloc( sizeof(double)*4*nbInput );
+   if( !inputs )
+      return TA_ALLOC_ERR;
+
+   for( i=0; i < nbInput; i++ )
+   {
+      inputs[i]           = inOpen[i];
+      inputs[nbInput+i]   = inHigh[i];
+      inputs[2*nbInput+i] = inLow[i];
+      inputs[3*nbInput+i] = inClose[i];
+   }
+
+   retCode = cdlAll( startIdx, endIdx, inputs, &inputs[nbInput],
+                     &inputs[2*nbInput], &inputs[3*nbInput],
+                     optInPatterns, optInNbPattern, optInPenetration,
+                     outBegIdx, outNBElement, outInteger, outMask );
+
+   TA_Free( inputs );
+   return retCode;
+}
+
+/**** Local functions definitions.     ****/
+static int cdlAllLookback( TA_CDLPattern pattern, double optInPenetration )
+{
+   switch( pattern )
+   {
+   case TA_CDLPattern_2CROWS:           return TA_CDL2CROWS_Lookback();
+   case TA_CDLPattern_3BLACKCROWS:      return TA_CDL3BLACKCROWS_Lookback();
+   case TA_CDLPattern_3INSIDE:          return TA_CDL3INSIDE_Lookback();
+   case TA_CDLPattern_3LINESTRIKE:      return TA_CDL3LINESTRIKE_Lookback();
+   case TA_CDLPattern_3OUTSIDE:         return TA_CDL3OUTSIDE_Lookback();
+   case TA_CDLPattern_3STARSINSOUTH:    return TA_CDL3STARSINSOUTH_Lookback();
+   case TA_CDLPattern_3WHITESOLDIERS:   return TA_CDL3WHITESOLDIERS_Lookback();
+   case TA_CDLPattern_ABANDONEDBABY:    return TA_CDLABANDONEDBABY_Lookback( optInPenetration );
+   case TA_CDLPattern_ADVANCEBLOCK:     return TA_CDLADVANCEBLOCK_Lookback();
+   case TA_CDLPattern_BELTHOLD:         return TA_CDLBELTHOLD_Lookback();
+   case TA_CDLPattern_BREAKAWAY:        return TA_CDLBREAKAWAY_Lookback();
+   case TA_CDLPattern_CLOSINGMARUBOZU:  return TA_CDLCLOSINGMARUBOZU_Lookback();
+   case TA_CDLPattern_CONCEALBABYSWALL: return TA_CDLCONCEALBABYSWALL_Lookback();
+   case TA_CDLPattern_COUNTERATTACK:    return TA_CDLCOUNTERATTACK_Lookback();
+   case TA_CDLPattern_DARKCLOUDCOVER:   return TA_CDLDARKCLOUDCOVER_Lookback( optInPenetration );
+   case TA_CDLPattern_DOJI:             return TA_CDLDOJI_Lookback();
+   case TA_CDLPattern_DOJISTAR:         return TA_CDLDOJISTAR_Lookback();
+   case TA_CDLPattern_DRAGONFLYDOJI:    return TA_CDLDRAGONFLYDOJI_Lookback();
+   case TA_CDLPattern_ENGULFING:        return TA_CDLENGULFING_Lookback();
+   case TA_CDLPattern_EVENINGDOJISTAR:  return TA_CDLEVENINGDOJISTAR_Lookback( optInPenetration );
+   case TA_CDLPattern_EVENINGSTAR:      return TA_CDLEVENINGSTAR_Lookback( optInPenetration );
+   case TA_CDLPattern_GAPSIDESIDEWHITE: return TA_CDLGAPSIDESIDEWHITE_Lookback();
+   case TA_CDLPattern_GRAVESTONEDOJI:   return TA_CDLGRAVESTONEDOJI_Lookback();
+   case TA_CDLPattern_HAMMER:           return TA_CDLHAMMER_Lookback();
+   case TA_CDLPattern_HANGINGMAN:       return TA_CDLHANGINGMAN_Lookback();
+   case TA_CDLPattern_HARAMI:           return TA_CDLHARAMI_Lookback();
+   case TA_CDLPattern_HARAMICROSS:      return TA_CDLHARAMICROSS_Lookback();
+   case TA_CDLPattern_HIGHWAVE:         return TA_CDLHIGHWAVE_Lookback();
+   case TA_CDLPattern_HIKKAKE:          return TA_CDLHIKKAKE_Lookback();
+   case TA_CDLPattern_HIKKAKEMOD:       return TA_CDLHIKKAKEMOD_Lookback();
+   case TA_CDLPattern_HOMINGPIGEON:     return TA_CDLHOMINGPIGEON_Lookback();
+   case TA_CDLPattern_IDENTICAL3CROWS:  return TA_CDLIDENTICAL3CROWS_Lookback();
+   case TA_CDLPattern_INNECK:           return TA_CDLINNECK_Lookback();
+   case TA_CDLPattern_INVERTEDHAMMER:   return TA_CDLINVERTEDHAMMER_Lookback();
+   case TA_CDLPattern_KICKING:          return TA_CDLKICKING_Lookback();
+   case TA_CDLPattern_KICKINGBYLENGTH:  return TA_CDLKICKINGBYLENGTH_Lookback();
+   case TA_CDLPattern_LADDERBOTTOM:     return TA_CDLLADDERBOTTOM_Lookback();
+   case TA_CDLPattern_LONGLEGGEDDOJI:   return TA_CDLLONGLEGGEDDOJI_Lookback();
+   case TA_CDLPattern_LONGLINE:         return TA_CDLLONGLINE_Lookback();
+   case TA_CDLPattern_MARUBOZU:         return TA_CDLMARUBOZU_Lookback();
+   case TA_CDLPattern_MATCHINGLOW:      return TA_CDLMATCHINGLOW_Lookback();
+   case TA_CDLPattern_MATHOLD:          return TA_CDLMATHOLD_Lookback( optInPenetration );
+   case TA_CDLPattern_MORNINGDOJISTAR:  return TA_CDLMORNINGDOJISTAR_Lookback( optInPenetration );
+   case TA_CDLPattern_MORNINGSTAR:      return TA_CDLMORNINGSTAR_Lookback( optInPenetration );
+   case TA_CDLPattern_ONNECK:           return TA_CDLONNECK_Lookback();
+   case TA_CDLPattern_PIERCING:         return TA_CDLPIERCING_Lookback();
+   case TA_CDLPattern_RICKSHAWMAN:      return TA_CDLRICKSHAWMAN_Lookback();
+   case TA_CDLPattern_RISEFALL3METHODS: return TA_CDLRISEFALL3METHODS_Lookback();
+   case TA_CDLPattern_SEPARATINGLINES:  return TA_CDLSEPARATINGLINES_Lookback();
+   case TA_CDLPattern_SHOOTINGSTAR:     return TA_CDLSHOOTINGSTAR_Lookback();
+   case TA_CDLPattern_SHORTLINE:        return TA_CDLSHORTLINE_Lookback();
+   case TA_CDLPattern_SPINNINGTOP:      return TA_CDLSPINNINGTOP_Lookback();
+   case TA_CDLPattern_STALLEDPATTERN:   return TA_CDLSTALLEDPATTERN_Lookback();
+   case TA_CDLPattern_STICKSANDWICH:    return TA_CDLSTICKSANDWICH_Lookback();
+   case TA_CDLPattern_TAKURI:           return TA_CDLTAKURI_Lookback();
+   case TA_CDLPattern_TASUKIGAP:        return TA_CDLTASUKIGAP_Lookback();
+   case TA_CDLPattern_THRUSTING:        return TA_CDLTHRUSTING_Lookback();
+   case TA_CDLPattern_TRISTAR:          return TA_CDLTRISTAR_Lookback();
+   case TA_CDLPattern_UNIQUE3RIVER:     return TA_CDLUNIQUE3RIVER_Lookback();
+   case TA_CDLPattern_UPSIDEGAP2CROWS:  return TA_CDLUPSIDEGAP2CROWS_Lookback();
+   case TA_CDLPattern_XSIDEGAP3METHODS: return TA_CDLXSIDEGAP3METHODS_Lookback();
+   default: return -1;
+   }
+}
+
+static TA_RetCode cdlAll( int    startIdx,
+                          int    endIdx,
+                          const double inOpen[],
+                          const double inHigh[],
+                          const double inLow[],
+                          const double inClose[],
+                          const TA_CDLPattern optInPatterns[],
+                          int           optInNbPattern,
+                          double        optInPenetration,
+                          int           outBegIdx[],
+                          int           outNBElement[],
+                          int           outInteger[],
+                          UInt64        outMask[] )
+{
+   int i, j, k, a, shift, firstSum, firstIdx, nbOutput, nbTotal, value;
+   int sweepIdx, blockIdx, blockEnd, avgIdx, begIdx;
+   int avgPeriod, windowIdx, lastIdx;
+   TA_RangeType rangeType;
+   double periodTotal, factor;
+   int *outRow;
+   double penetration;
+   double *blockAvg, *avg;
+   const double **avgRow;
+   UInt64 bit;
+   CdlAllPattern *patterns, *pat;
+   CdlAllTotal *total, *t;
+
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      if( startIdx < 0 )
+         return TA_OUT_OF_RANGE_START_INDEX;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return TA_OUT_OF_RANGE_END_INDEX;
+      if( !optInPatterns || (optInNbPattern < 1) )
+         return TA_BAD_PARAM;
+      for( k=0; k < optInNbPattern; k++ )
+      {
+         if( ((int)optInPatterns[k] < 0) || ((int)optInPatterns[k] >= TA_CDL_NB_PATTERN) )
+            return TA_BAD_PARAM;
+      }
+      if( (optInPenetration != TA_REAL_DEFAULT) &&
+          ((optInPenetration < 0.000000e+0) || (optInPenetration > 3.000000e+37)) )
+         return TA_BAD_PARAM;
+      if( !outBegIdx || !outNBElement || (!outInteger && !outMask) )
+         return TA_BAD_PARAM;
+   #endif
+
+   nbOutput = endIdx-startIdx+1;
+   if( outMask )
+   {
+      for( i=0; i < nbOutput; i++ )
+         outMask[i] = 0;
+   }
+
+   /* At most one total for each average of each pattern. */
+   nbTotal = 0;
+   for( k=0; k < optInNbPattern; k++ )
+   {
+      for( j=0; j < CDL_ALL_NB_AVERAGE; j++ )
+      {
+         if( cdlAllAverage[j].pattern == optInPatterns[k] )
+            nbTotal++;
+      }
+   }
+
+   patterns = (CdlAllPattern *)TA_Malloc( sizeof(CdlAllPattern)*optInNbPattern );
+   total    = (CdlAllTotal *)TA_Malloc( sizeof(CdlAllTotal)*(nbTotal+1) );
+   blockAvg = (double *)TA_Malloc( sizeof(double)*CDL_ALL_BLOCK_AVG*(nbTotal+1) );
+   if( !patterns || !total || !blockAvg )
+   {
+      if( patterns ) TA_Free( patterns );
+      if( total ) TA_Free( total );
+      if( blockAvg ) TA_Free( blockAvg );
+      return TA_ALLOC_ERR;
+   }
+
+   nbTotal  = 0;
+   sweepIdx = endIdx+1;
+   for( k=0; k < optInNbPattern; k++ )
+   {
+      pat = &patterns[k];
+      pat->pattern = optInPatterns[k];
+
+      /* Each pattern has its own default penetration. */
+      penetration = optInPenetration;
+      if( penetration == TA_REAL_DEFAULT )
+      {
+         switch( pat->pattern )
+         {
+         case TA_CDLPattern_DARKCLOUDCOVER:
+         case TA_CDLPattern_MATHOLD:
+            penetration = 5.000000e-1;
+            break;
+         default:
+            penetration = 3.000000e-1;
+            break;
+         }
+      }
+      pat->penetration = penetration;
+
+      pat->begIdx = cdlAllLookback( pat->pattern, penetration );
+      if( startIdx > pat->begIdx )
+         pat->begIdx = startIdx;
+
+      if( pat->begIdx > endIdx )
+      {
+         outBegIdx[k]    = 0;
+         outNBElement[k] = 0;
+         pat->firstIdx   = endIdx+1;
+         continue;
+      }
+
+      outBegIdx[k]    = pat->begIdx;
+      outNBElement[k] = endIdx-pat->begIdx+1;
+
+      /* The hikkake is also searched in the 3 bars
+       * before the first output (for the confirmation).
+       */
+      pat->firstIdx = pat->begIdx;
+      if( (pat->pattern == TA_CDLPattern_HIKKAKE) ||
+          (pat->pattern == TA_CDLPattern_HIKKAKEMOD) )
+         pat->firstIdx -= 3;
+      pat->patternIdx    = 0;
+      pat->patternResult = 0;
+
+      if( pat->firstIdx < sweepIdx )
+         sweepIdx = pat->firstIdx;
+
+      for( j=0; j < TA_AllCandleSettings*CDL_ALL_NB_SHIFT; j++ )
+         pat->avgRow[j] = blockAvg;
+
+      /* Find (or start) the running total of each average. At the
+       * bar firstIdx, the first range summed for the candle 'shift'
+       * bars before is firstIdx-shift-avgPeriod.
+       */
+      for( j=0; j < CDL_ALL_NB_AVERAGE; j++ )
+      {
+         if( cdlAllAverage[j].pattern != pat->pattern )
+            continue;
+
+         shift    = cdlAllAverage[j].shift;
+         firstSum = pat->firstIdx-shift-TA_ThreadContext->candleSettings[cdlAllAverage[j].setting].avgPeriod;
+
+         for( a=0; a < nbTotal; a++ )
+         {
+            if( (total[a].setting == cdlAllAverage[j].setting) && (total[a].windowIdx == firstSum) )
+               break;
+         }
+
+         if( a == nbTotal )
+         {
+            t = &total[nbTotal++];
+            t->setting   = cdlAllAverage[j].setting;
+            t->rangeType = TA_ThreadContext->candleSettings[t->setting].rangeType;
+            t->avgPeriod = TA_ThreadContext->candleSettings[t->setting].avgPeriod;
+            t->factor    = TA_ThreadContext->candleSettings[t->setting].factor;
+            t->windowIdx = firstSum;
+            t->sum = 0;
+            for( i=firstSum; i < firstSum+t->avgPeriod; i++ )
+               t->sum += TA_CANDLERANGE_OF( t->rangeType, i );
+         }
+
+         pat->avgRow[(cdlAllAverage[j].setting*CDL_ALL_NB_SHIFT)+shift] = &blockAvg[a*CDL_ALL_BLOCK_AVG];
+      }
+   }
+
+   for( blockIdx=sweepIdx; blockIdx <= endIdx; blockIdx += CDL_ALL_BLOCK )
+   {
+      blockEnd = blockIdx+CDL_ALL_BLOCK-1;
+      if( blockEnd > endIdx )
+         blockEnd = endIdx;
+
+      /* Advance each total up to the window of the last bar of the
+       * block, keeping the averages from the window of the candle
+       * CDL_ALL_NB_SHIFT-1 bars before the first bar. A total
+       * starting after this block is left as is.
+       *
+       * The averages are calculated with TA_CANDLEAVERAGE_OF,
+       * as TA_CANDLEAVERAGE does in each TA_CDLXXX.
+       */
+      for( a=0; a < nbTotal; a++ )
+      {
+         t   = &total[a];
+         avg = &blockAvg[a*CDL_ALL_BLOCK_AVG];
+
+         /* Keep the averages of the last windows of the previous block. */
+         if( blockIdx != sweepIdx )
+         {
+            for( j=0; j < CDL_ALL_NB_SHIFT-1; j++ )
+               avg[j] = avg[CDL_ALL_BLOCK+j];
+         }
+
+         avgPeriod = t->avgPeriod;
+         lastIdx   = blockEnd-avgPeriod;
+         if( t->windowIdx > lastIdx )
+            continue;
+
+         rangeType   = t->rangeType;
+         factor      = t->factor;
+         windowIdx   = t->windowIdx;
+         periodTotal = t->sum;
+         avgIdx = windowIdx-(blockIdx-(CDL_ALL_NB_SHIFT-1)-avgPeriod);
+         if( avgPeriod == 0 )
+         {
+            while( windowIdx <= lastIdx )
+            {
+               avg[avgIdx++] = TA_CANDLEAVERAGE_OF( rangeType, avgPeriod, factor, 0.0, windowIdx );
+               windowIdx++;
+            }
+            t->windowIdx = windowIdx;
+            continue;
+         }
+
+         for( ;; )
+         {
+            avg[avgIdx++] = TA_CANDLEAVERAGE_OF( rangeType, avgPeriod, factor, periodTotal, windowIdx );
+            if( windowIdx == lastIdx )
+               break;
+            periodTotal += TA_CANDLERANGE_OF( rangeType, windowIdx+avgPeriod )
+                         - TA_CANDLERANGE_OF( rangeType, windowIdx );
+            windowIdx++;
+         }
+         t->windowIdx = windowIdx;
+         t->sum       = periodTotal;
+      }
+
+      for( k=0; k < optInNbPattern; k++ )
+      {
+         pat = &patterns[k];
+         firstIdx = pat->firstIdx;
+         if( firstIdx > blockEnd )
+            continue;
+         if( firstIdx < blockIdx )
+            firstIdx = blockIdx;
+
+         begIdx      = pat->begIdx;
+         outRow      = outInteger? &outInteger[k*nbOutput] : NULL;
+         avgRow      = pat->avgRow;
+         penetration = pat->penetration;
+         bit         = ((UInt64)1) << pat->pattern;
+
+         switch( pat->pattern )
+         {
+         case TA_CDLPattern_2CROWS:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_CANDLECOLOR(i-2) == 1 &&                             // 1st: white
+                   TA_REALBODY(i-2) > CDL_AVG( BodyLong, i-2 ) &&          //      long
+                   TA_CANDLECOLOR(i-1) == -1 &&                            // 2nd: black
+                   TA_REALBODYGAPUP(i-1,i-2) &&                            //      gapping up
+                   TA_CANDLECOLOR(i) == -1 &&                              // 3rd: black
+                   inOpen[i] < inOpen[i-1] && inOpen[i] > inClose[i-1] &&  //      opening within 2nd rb
+                   inClose[i] > inOpen[i-2] && inClose[i] < inClose[i-2]   //      closing within 1st rb
+                 )
+                   value = -100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_3BLACKCROWS:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_CANDLECOLOR(i-3) == 1 &&                                 // white
+                   TA_CANDLECOLOR(i-2) == -1 &&                                // 1st black
+                   TA_LOWERSHADOW(i-2) < CDL_AVG( ShadowVeryShort, i-2 ) &&
+                                                                               // very short lower shadow
+                   TA_CANDLECOLOR(i-1) == -1 &&                                // 2nd black
+                   TA_LOWERSHADOW(i-1) < CDL_AVG( ShadowVeryShort, i-1 ) &&
+                                                                               // very short lower shadow
+                   TA_CANDLECOLOR(i) == -1 &&                                  // 3rd black
+                   TA_LOWERSHADOW(i) < CDL_AVG( ShadowVeryShort, i ) &&
+                                                                               // very short lower shadow
+                   inOpen[i-1] < inOpen[i-2] && inOpen[i-1] > inClose[i-2] &&  // 2nd black opens within 1st black's rb
+                   inOpen[i] < inOpen[i-1] && inOpen[i] > inClose[i-1] &&      // 3rd black opens within 2nd black's rb
+                   inHigh[i-3] > inClose[i-2] &&                               // 1st black closes under prior candle's high
+                   inClose[i-2] > inClose[i-1] &&                              // three declining
+                   inClose[i-1] > inClose[i]                                   // three declining
+                 )
+                   value = -100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_3INSIDE:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i-2) > CDL_AVG( BodyLong, i-2 ) &&                                     // 1st: long
+                   TA_REALBODY(i-1) <= CDL_AVG( BodyShort, i-1 ) &&                                   // 2nd: short
+                   max( inClose[i-1], inOpen[i-1] ) < max( inClose[i-2], inOpen[i-2] ) &&             //      engulfed by 1st
+                   min( inClose[i-1], inOpen[i-1] ) > min( inClose[i-2], inOpen[i-2] ) &&
+                   ( ( TA_CANDLECOLOR(i-2) == 1 && TA_CANDLECOLOR(i) == -1 && inClose[i] < inOpen[i-2] ) // 3rd: opposite to 1st
+                     ||                                                                               //      and closing out
+                     ( TA_CANDLECOLOR(i-2) == -1 && TA_CANDLECOLOR(i) == 1 && inClose[i] > inOpen[i-2] )
+                   )
+                 )
+                   value = -TA_CANDLECOLOR(i-2) * 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_3LINESTRIKE:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_CANDLECOLOR(i-3) == TA_CANDLECOLOR(i-2) &&                          // three with same color
+                   TA_CANDLECOLOR(i-2) == TA_CANDLECOLOR(i-1) &&
+                   TA_CANDLECOLOR(i) == -TA_CANDLECOLOR(i-1) &&                           // 4th opposite color
+                                                                                          // 2nd opens within/near 1st rb
+                   inOpen[i-2] >= min( inOpen[i-3], inClose[i-3] ) - CDL_AVG( Near, i-3 ) &&
+                   inOpen[i-2] <= max( inOpen[i-3], inClose[i-3] ) + CDL_AVG( Near, i-3 ) &&
+                                                                                          // 3rd opens within/near 2nd rb
+                   inOpen[i-1] >= min( inOpen[i-2], inClose[i-2] ) - CDL_AVG( Near, i-2 ) &&
+                   inOpen[i-1] <= max( inOpen[i-2], inClose[i-2] ) + CDL_AVG( Near, i-2 ) &&
+                   (
+                       (                                                                  // if three white
+                           TA_CANDLECOLOR(i-1) == 1 &&
+                           inClose[i-1] > inClose[i-2] && inClose[i-2] > inClose[i-3] &&  // consecutive higher closes
+                           inOpen[i] > inClose[i-1] &&                                    // 4th opens above prior close
+                           inClose[i] < inOpen[i-3]                                       // 4th closes below 1st open
+                       ) ||
+                       (                                                                  // if three black
+                           TA_CANDLECOLOR(i-1) == -1 &&
+                           inClose[i-1] < inClose[i-2] && inClose[i-2] < inClose[i-3] &&  // consecutive lower closes
+                           inOpen[i] < inClose[i-1] &&                                    // 4th opens below prior close
+                           inClose[i] > inOpen[i-3]                                       // 4th closes above 1st open
+                       )
+                   )
+                 )
+                   value = TA_CANDLECOLOR(i-1) * 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_3OUTSIDE:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( ( TA_CANDLECOLOR(i-1) == 1 && TA_CANDLECOLOR(i-2) == -1 &&  // white engulfs black
+                     inClose[i-1] > inOpen[i-2] && inOpen[i-1] < inClose[i-2] &&
+                     inClose[i] > inClose[i-1]                                 // third candle higher
+                   )
+                   ||
+                   ( TA_CANDLECOLOR(i-1) == -1 && TA_CANDLECOLOR(i-2) == 1 &&  // black engulfs white
+                     inOpen[i-1] > inClose[i-2] && inClose[i-1] < inOpen[i-2] &&
+                     inClose[i] < inClose[i-1]                                 // third candle lower
+                   )
+                 )
+                   value = TA_CANDLECOLOR(i-1) * 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_3STARSINSOUTH:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_CANDLECOLOR(i-2) == -1 &&                                 // 1st black
+                   TA_CANDLECOLOR(i-1) == -1 &&                                 // 2nd black
+                   TA_CANDLECOLOR(i) == -1 &&                                   // 3rd black
+                                                                                // 1st: long
+                   TA_REALBODY(i-2) > CDL_AVG( BodyLong, i-2 ) &&
+                                                                                //      with long lower shadow
+                   TA_LOWERSHADOW(i-2) > CDL_AVG( ShadowLong, i-2 ) &&
+                   TA_REALBODY(i-1) < TA_REALBODY(i-2) &&                       // 2nd: smaller candle
+                   inOpen[i-1] > inClose[i-2] && inOpen[i-1] <= inHigh[i-2] &&  //      that opens higher but within 1st range
+                   inLow[i-1] < inClose[i-2] &&                                 //      and trades lower than 1st close
+                   inLow[i-1] >= inLow[i-2] &&                                  //      but not lower than 1st low
+                                                                                //      and has a lower shadow
+                   TA_LOWERSHADOW(i-1) > CDL_AVG( ShadowVeryShort, i-1 ) &&
+                                                                                // 3rd: small marubozu
+                   TA_REALBODY(i) < CDL_AVG( BodyShort, i ) &&
+                   TA_LOWERSHADOW(i) < CDL_AVG( ShadowVeryShort, i ) &&
+                   TA_UPPERSHADOW(i) < CDL_AVG( ShadowVeryShort, i ) &&
+                   inLow[i] > inLow[i-1] && inHigh[i] < inHigh[i-1]             //      engulfed by prior candle's range
+                 )
+                   value = 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_3WHITESOLDIERS:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_CANDLECOLOR(i-2) == 1 &&                                  // 1st white
+                   TA_UPPERSHADOW(i-2) < CDL_AVG( ShadowVeryShort, i-2 ) &&
+                                                                                // very short upper shadow
+                   TA_CANDLECOLOR(i-1) == 1 &&                                  // 2nd white
+                   TA_UPPERSHADOW(i-1) < CDL_AVG( ShadowVeryShort, i-1 ) &&
+                                                                                // very short upper shadow
+                   TA_CANDLECOLOR(i) == 1 &&                                    // 3rd white
+                   TA_UPPERSHADOW(i) < CDL_AVG( ShadowVeryShort, i ) &&
+                                                                                // very short upper shadow
+                   inClose[i] > inClose[i-1] && inClose[i-1] > inClose[i-2] &&  // consecutive higher closes
+                   inOpen[i-1] > inOpen[i-2] &&                                 // 2nd opens within/near 1st real body
+                   inOpen[i-1] <= inClose[i-2] + CDL_AVG( Near, i-2 ) &&
+                   inOpen[i] > inOpen[i-1] &&                                   // 3rd opens within/near 2nd real body
+                   inOpen[i] <= inClose[i-1] + CDL_AVG( Near, i-1 ) &&
+                   TA_REALBODY(i-1) > TA_REALBODY(i-2) - CDL_AVG( Far, i-2 ) &&
+                                                                                // 2nd not far shorter than 1st
+                   TA_REALBODY(i) > TA_REALBODY(i-1) - CDL_AVG( Far, i-1 ) &&
+                                                                                // 3rd not far shorter than 2nd
+                   TA_REALBODY(i) > CDL_AVG( BodyShort, i )                     // not short real body
+                 )
+                   value = 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_ABANDONEDBABY:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i-2) > CDL_AVG( BodyLong, i-2 ) &&                     // 1st: long
+                   TA_REALBODY(i-1) <= CDL_AVG( BodyDoji, i-1 ) &&                    // 2nd: doji
+                   TA_REALBODY(i) > CDL_AVG( BodyShort, i ) &&                        // 3rd: longer than short
+                   ( ( TA_CANDLECOLOR(i-2) == 1 &&                                    // 1st white
+                       TA_CANDLECOLOR(i) == -1 &&                                     // 3rd black
+                       inClose[i] < inClose[i-2] - TA_REALBODY(i-2) * penetration &&  // 3rd closes well within 1st rb
+                       TA_CANDLEGAPUP(i-1,i-2) &&                                     // upside gap between 1st and 2nd
+                       TA_CANDLEGAPDOWN(i,i-1)                                        // downside gap between 2nd and 3rd
+                     )
+                     ||
+                     (
+                       TA_CANDLECOLOR(i-2) == -1 &&                                   // 1st black
+                       TA_CANDLECOLOR(i) == 1 &&                                      // 3rd white
+                       inClose[i] > inClose[i-2] + TA_REALBODY(i-2) * penetration &&  // 3rd closes well within 1st rb
+                       TA_CANDLEGAPDOWN(i-1,i-2) &&                                   // downside gap between 1st and 2nd
+                       TA_CANDLEGAPUP(i,i-1)                                          // upside gap between 2nd and 3rd
+                     )
+                   )
+                 )
+                   value = TA_CANDLECOLOR(i) * 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_ADVANCEBLOCK:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_CANDLECOLOR(i-2) == 1 &&                                  // 1st white
+                   TA_CANDLECOLOR(i-1) == 1 &&                                  // 2nd white
+                   TA_CANDLECOLOR(i) == 1 &&                                    // 3rd white
+                   inClose[i] > inClose[i-1] && inClose[i-1] > inClose[i-2] &&  // consecutive higher closes
+                   inOpen[i-1] > inOpen[i-2] &&                                 // 2nd opens within/near 1st real body
+                   inOpen[i-1] <= inClose[i-2] + CDL_AVG( Near, i-2 ) &&
+                   inOpen[i] > inOpen[i-1] &&                                   // 3rd opens within/near 2nd real body
+                   inOpen[i] <= inClose[i-1] + CDL_AVG( Near, i-1 ) &&
+                   TA_REALBODY(i-2) > CDL_AVG( BodyLong, i-2 ) &&               // 1st: long real body
+                   TA_UPPERSHADOW(i-2) < CDL_AVG( ShadowShort, i-2 ) &&
+                                                                                // 1st: short upper shadow
+                   (
+                                                                                // ( 2 far smaller than 1 && 3 not longer than 2 )
+                                                                                // advance blocked with the 2nd, 3rd must not carry on the advance
+                       (
+                           TA_REALBODY(i-1) < TA_REALBODY(i-2) - CDL_AVG( Far, i-2 ) &&
+                           TA_REALBODY(i) < TA_REALBODY(i-1) + CDL_AVG( Near, i-1 )
+                       ) ||
+                                                                                // 3 far smaller than 2
+                                                                                // advance blocked with the 3rd
+                       (
+                           TA_REALBODY(i) < TA_REALBODY(i-1) - CDL_AVG( Far, i-1 )
+                       ) ||
+                                                                                // ( 3 smaller than 2 && 2 smaller than 1 && (3 or 2 not short upper shadow) )
+                                                                                // advance blocked with progressively smaller real bodies and some upper shadows
+                       (
+                           TA_REALBODY(i) < TA_REALBODY(i-1) &&
+                           TA_REALBODY(i-1) < TA_REALBODY(i-2) &&
+                           (
+                               TA_UPPERSHADOW(i) > CDL_AVG( ShadowShort, i ) ||
+                               TA_UPPERSHADOW(i-1) > CDL_AVG( ShadowShort, i-1 )
+                           )
+                       ) ||
+                                                                                // ( 3 smaller than 2 && 3 long upper shadow )
+                                                                                // advance blocked with 3rd candle's long upper shadow and smaller body
+                       (
+                           TA_REALBODY(i) < TA_REALBODY(i-1) &&
+                           TA_UPPERSHADOW(i) > CDL_AVG( ShadowLong, i )
+                       )
+                   )
+                 )
+                   value = -100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_BELTHOLD:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i) > CDL_AVG( BodyLong, i ) &&  // long body
+                   (
+                     (                                         // white body and very short lower shadow
+                       TA_CANDLECOLOR(i) == 1 &&
+                       TA_LOWERSHADOW(i) < CDL_AVG( ShadowVeryShort, i )
+                     ) ||
+                     (                                         // black body and very short upper shadow
+                       TA_CANDLECOLOR(i) == -1 &&
+                       TA_UPPERSHADOW(i) < CDL_AVG( ShadowVeryShort, i )
+                     )
+                   ) )
+                   value = TA_CANDLECOLOR(i) * 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_BREAKAWAY:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i-4) > CDL_AVG( BodyLong, i-4 ) &&               // 1st long
+                   TA_CANDLECOLOR(i-4) == TA_CANDLECOLOR(i-3) &&                // 1st, 2nd, 4th same color, 5th opposite
+                   TA_CANDLECOLOR(i-3) == TA_CANDLECOLOR(i-1) &&
+                   TA_CANDLECOLOR(i-1) == -TA_CANDLECOLOR(i) &&
+                   (
+                     ( TA_CANDLECOLOR(i-4) == -1 &&                             // when 1st is black:
+                       TA_REALBODYGAPDOWN(i-3,i-4) &&                           // 2nd gaps down
+                       inHigh[i-2] < inHigh[i-3] && inLow[i-2] < inLow[i-3] &&  // 3rd has lower high and low than 2nd
+                       inHigh[i-1] < inHigh[i-2] && inLow[i-1] < inLow[i-2] &&  // 4th has lower high and low than 3rd
+                       inClose[i] > inOpen[i-3] && inClose[i] < inClose[i-4]    // 5th closes inside the gap
+                     )
+                     ||
+                     ( TA_CANDLECOLOR(i-4) == 1 &&                              // when 1st is white:
+                       TA_REALBODYGAPUP(i-3,i-4) &&                             // 2nd gaps up
+                       inHigh[i-2] > inHigh[i-3] && inLow[i-2] > inLow[i-3] &&  // 3rd has higher high and low than 2nd
+                       inHigh[i-1] > inHigh[i-2] && inLow[i-1] > inLow[i-2] &&  // 4th has higher high and low than 3rd
+                       inClose[i] < inOpen[i-3] && inClose[i] > inClose[i-4]    // 5th closes inside the gap
+                     )
+                   )
+                 )
+                   value = TA_CANDLECOLOR(i) * 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_CLOSINGMARUBOZU:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i) > CDL_AVG( BodyLong, i ) &&  // long body
+                   (
+                     (                                         // white body and very short lower shadow
+                       TA_CANDLECOLOR(i) == 1 &&
+                       TA_UPPERSHADOW(i) < CDL_AVG( ShadowVeryShort, i )
+                     ) ||
+                     (                                         // black body and very short upper shadow
+                       TA_CANDLECOLOR(i) == -1 &&
+                       TA_LOWERSHADOW(i) < CDL_AVG( ShadowVeryShort, i )
+                     )
+                   ) )
+                   value = TA_CANDLECOLOR(i) * 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_CONCEALBABYSWALL:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_CANDLECOLOR(i-3) == -1 &&                      // 1st black
+                   TA_CANDLECOLOR(i-2) == -1 &&                      // 2nd black
+                   TA_CANDLECOLOR(i-1) == -1 &&                      // 3rd black
+                   TA_CANDLECOLOR(i) == -1 &&                        // 4th black
+                                                                     // 1st: marubozu
+                   TA_LOWERSHADOW(i-3) < CDL_AVG( ShadowVeryShort, i-3 ) &&
+                   TA_UPPERSHADOW(i-3) < CDL_AVG( ShadowVeryShort, i-3 ) &&
+                                                                     // 2nd: marubozu
+                   TA_LOWERSHADOW(i-2) < CDL_AVG( ShadowVeryShort, i-2 ) &&
+                   TA_UPPERSHADOW(i-2) < CDL_AVG( ShadowVeryShort, i-2 ) &&
+                   TA_REALBODYGAPDOWN(i-1,i-2) &&                    // 3rd: opens gapping down
+                                                                     //      and HAS an upper shadow
+                   TA_UPPERSHADOW(i-1) > CDL_AVG( ShadowVeryShort, i-1 ) &&
+                   inHigh[i-1] > inClose[i-2] &&                     //      that extends into the prior body
+                   inHigh[i] > inHigh[i-1] && inLow[i] < inLow[i-1]  // 4th: engulfs the 3rd including the shadows
+                 )
+                   value = 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_COUNTERATTACK:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_CANDLECOLOR(i-1) == -TA_CANDLECOLOR(i) &&           // opposite candles
+                   TA_REALBODY(i-1) > CDL_AVG( BodyLong, i-1 ) &&         // 1st long
+                   TA_REALBODY(i) > CDL_AVG( BodyLong, i ) &&             // 2nd long
+                   inClose[i] <= inClose[i-1] + CDL_AVG( Equal, i-1 ) &&  // equal closes
+                   inClose[i] >= inClose[i-1] - CDL_AVG( Equal, i-1 )
+                 )
+                   value = TA_CANDLECOLOR(i) * 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_DARKCLOUDCOVER:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_CANDLECOLOR(i-1) == 1 &&                     // 1st: white
+                   TA_REALBODY(i-1) > CDL_AVG( BodyLong, i-1 ) &&  //      long
+                   TA_CANDLECOLOR(i) == -1 &&                      // 2nd: black
+                   inOpen[i] > inHigh[i-1] &&                      //      open above prior high
+                   inClose[i] > inOpen[i-1] &&                     //      close within prior body
+                   inClose[i] < inClose[i-1] - TA_REALBODY(i-1) * penetration
+                 )
+                   value = -100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_DOJI:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i) <= CDL_AVG( BodyDoji, i ) )
+                   value = 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_DOJISTAR:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i-1) > CDL_AVG( BodyLong, i-1 ) &&                // 1st: long real body
+                   TA_REALBODY(i) <= CDL_AVG( BodyDoji, i ) &&                   // 2nd: doji
+                   ( ( TA_CANDLECOLOR(i-1) == 1 && TA_REALBODYGAPUP(i,i-1) )     //        that gaps up if 1st is white
+                       ||
+                     ( TA_CANDLECOLOR(i-1) == -1 && TA_REALBODYGAPDOWN(i,i-1) )  //      or down if 1st is black
+                   ) )
+                   value = -TA_CANDLECOLOR(i-1) * 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_DRAGONFLYDOJI:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i) <= CDL_AVG( BodyDoji, i ) &&
+                   TA_UPPERSHADOW(i) < CDL_AVG( ShadowVeryShort, i ) &&
+                   TA_LOWERSHADOW(i) > CDL_AVG( ShadowVeryShort, i )
+                 )
+                   value = 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_ENGULFING:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( ( TA_CANDLECOLOR(i) == 1 && TA_CANDLECOLOR(i-1) == -1 &&  // white engulfs black
+                     ( ( inClose[i] >= inOpen[i-1] && inOpen[i] < inClose[i-1] ) ||
+                       ( inClose[i] > inOpen[i-1] && inOpen[i] <= inClose[i-1] )
+                     )
+                   )
+                   ||
+                   ( TA_CANDLECOLOR(i) == -1 && TA_CANDLECOLOR(i-1) == 1 &&  // black engulfs white
+                     ( ( inOpen[i] >= inClose[i-1] && inClose[i] < inOpen[i-1] ) ||
+                       ( inOpen[i] > inClose[i-1] && inClose[i] <= inOpen[i-1] )
+                     )
+                   )
+                 )
+                   if( inOpen[i] != inClose[i-1] && inClose[i] != inOpen[i-1] )
+                       value = TA_CANDLECOLOR(i) * 100;
+                   else
+                       value = TA_CANDLECOLOR(i) * 80;
+               else
+                   value = 0;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_EVENINGDOJISTAR:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i-2) > CDL_AVG( BodyLong, i-2 ) &&              // 1st: long
+                   TA_CANDLECOLOR(i-2) == 1 &&                                 //           white
+                   TA_REALBODY(i-1) <= CDL_AVG( BodyDoji, i-1 ) &&             // 2nd: doji
+                   TA_REALBODYGAPUP(i-1,i-2) &&                                //           gapping up
+                   TA_REALBODY(i) > CDL_AVG( BodyShort, i ) &&                 // 3rd: longer than short
+                   TA_CANDLECOLOR(i) == -1 &&                                  //          black real body
+                   inClose[i] < inClose[i-2] - TA_REALBODY(i-2) * penetration  //               closing well within 1st rb
+                 )
+                   value = -100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_EVENINGSTAR:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i-2) > CDL_AVG( BodyLong, i-2 ) &&              // 1st: long
+                   TA_CANDLECOLOR(i-2) == 1 &&                                 //           white
+                   TA_REALBODY(i-1) <= CDL_AVG( BodyShort, i-1 ) &&            // 2nd: short
+                   TA_REALBODYGAPUP(i-1,i-2) &&                                //            gapping up
+                   TA_REALBODY(i) > CDL_AVG( BodyShort, i ) &&                 // 3rd: longer than short
+                   TA_CANDLECOLOR(i) == -1 &&                                  //          black real body
+                   inClose[i] < inClose[i-2] - TA_REALBODY(i-2) * penetration  //               closing well within 1st rb
+                 )
+                   value = -100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_GAPSIDESIDEWHITE:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if(
+                   (                                                             // upside or downside gap between the 1st candle and both the next 2 candles
+                     ( TA_REALBODYGAPUP(i-1,i-2) && TA_REALBODYGAPUP(i,i-2) )
+                     ||
+                     ( TA_REALBODYGAPDOWN(i-1,i-2) && TA_REALBODYGAPDOWN(i,i-2) )
+                   ) &&
+                   TA_CANDLECOLOR(i-1) == 1 &&                                   // 2nd: white
+                   TA_CANDLECOLOR(i) == 1 &&                                     // 3rd: white
+                   TA_REALBODY(i) >= TA_REALBODY(i-1) - CDL_AVG( Near, i-1 ) &&  // same size 2 and 3
+                   TA_REALBODY(i) <= TA_REALBODY(i-1) + CDL_AVG( Near, i-1 ) &&
+                   inOpen[i] >= inOpen[i-1] - CDL_AVG( Equal, i-1 ) &&           // same open 2 and 3
+                   inOpen[i] <= inOpen[i-1] + CDL_AVG( Equal, i-1 )
+                 )
+                   value = ( TA_REALBODYGAPUP(i-1,i-2) ? 100 : -100 );
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_GRAVESTONEDOJI:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i) <= CDL_AVG( BodyDoji, i ) &&
+                   TA_LOWERSHADOW(i) < CDL_AVG( ShadowVeryShort, i ) &&
+                   TA_UPPERSHADOW(i) > CDL_AVG( ShadowVeryShort, i )
+                 )
+                   value = 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_HAMMER:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i) < CDL_AVG( BodyShort, i ) &&                        // small rb
+                   TA_LOWERSHADOW(i) > CDL_AVG( ShadowLong, i ) &&                    // long lower shadow
+                   TA_UPPERSHADOW(i) < CDL_AVG( ShadowVeryShort, i ) &&               // very short upper shadow
+                   min( inClose[i], inOpen[i] ) <= inLow[i-1] + CDL_AVG( Near, i-1 )  // rb near the prior candle's lows
+                 )
+                   value = 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_HANGINGMAN:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i) < CDL_AVG( BodyShort, i ) &&                         // small rb
+                   TA_LOWERSHADOW(i) > CDL_AVG( ShadowLong, i ) &&                     // long lower shadow
+                   TA_UPPERSHADOW(i) < CDL_AVG( ShadowVeryShort, i ) &&                // very short upper shadow
+                   min( inClose[i], inOpen[i] ) >= inHigh[i-1] - CDL_AVG( Near, i-1 )  // rb near the prior candle's highs
+                 )
+                   value = -100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_HARAMI:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i-1) > CDL_AVG( BodyLong, i-1 ) &&                                // 1st: long
+                   TA_REALBODY(i) <= CDL_AVG( BodyShort, i )                                     // 2nd: short
+                 )
+                   if ( max( inClose[i], inOpen[i] ) < max( inClose[i-1], inOpen[i-1] ) &&       // 2nd is engulfed by 1st
+                        min( inClose[i], inOpen[i] ) > min( inClose[i-1], inOpen[i-1] )
+                      )
+                       value = -TA_CANDLECOLOR(i-1) * 100;
+                   else
+                       if ( max( inClose[i], inOpen[i] ) <= max( inClose[i-1], inOpen[i-1] ) &&  // 2nd is engulfed by 1st
+                            min( inClose[i], inOpen[i] ) >= min( inClose[i-1], inOpen[i-1] )     // (one end of real body can match;
+                          )                                                                      // engulfing guaranteed by "long" and "short")
+                           value = -TA_CANDLECOLOR(i-1) * 80;
+                       else
+                           value = 0;
+               else
+                   value = 0;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_HARAMICROSS:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i-1) > CDL_AVG( BodyLong, i-1 ) &&                                // 1st: long
+                   TA_REALBODY(i) <= CDL_AVG( BodyDoji, i ) )                                    // 2nd: doji
+                   if ( max( inClose[i], inOpen[i] ) < max( inClose[i-1], inOpen[i-1] ) &&       // 2nd is engulfed by 1st
+                        min( inClose[i], inOpen[i] ) > min( inClose[i-1], inOpen[i-1] )
+                      )
+                       value = -TA_CANDLECOLOR(i-1) * 100;
+                   else
+                       if ( max( inClose[i], inOpen[i] ) <= max( inClose[i-1], inOpen[i-1] ) &&  // 2nd is engulfed by 1st
+                            min( inClose[i], inOpen[i] ) >= min( inClose[i-1], inOpen[i-1] )     // (one end of real body can match;
+                          )                                                                      // engulfing guaranteed by "long" and "doji")
+                           value = -TA_CANDLECOLOR(i-1) * 80;
+                       else
+                           value = 0;
+               else
+                   value = 0;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_HIGHWAVE:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i) < CDL_AVG( BodyShort, i ) &&
+                   TA_UPPERSHADOW(i) > CDL_AVG( ShadowVeryLong, i ) &&
+                   TA_LOWERSHADOW(i) > CDL_AVG( ShadowVeryLong, i ) )
+                   value = TA_CANDLECOLOR(i) * 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_HIKKAKE:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( inHigh[i-1] < inHigh[i-2] && inLow[i-1] > inLow[i-2] &&                     // 1st + 2nd: lower high and higher low
+                   ( ( inHigh[i] < inHigh[i-1] && inLow[i] < inLow[i-1] )                      // (bull) 3rd: lower high and lower low
+                     ||
+                     ( inHigh[i] > inHigh[i-1] && inLow[i] > inLow[i-1] )                      // (bear) 3rd: higher high and higher low
+                   )
+               ) {
+                   pat->patternResult = 100 * ( inHigh[i] < inHigh[i-1] ? 1 : -1 );
+                   pat->patternIdx = i;
+                   value = pat->patternResult;
+               } else
+                   /* search for confirmation if hikkake was no more than 3 bars ago */
+                   if( i <= pat->patternIdx+3 &&
+                       ( ( pat->patternResult > 0 && inClose[i] > inHigh[pat->patternIdx-1] )  // close higher than the high of 2nd
+                         ||
+                         ( pat->patternResult < 0 && inClose[i] < inLow[pat->patternIdx-1] )   // close lower than the low of 2nd
+                       )
+                   ) {
+                       value = pat->patternResult + 100 * ( pat->patternResult > 0 ? 1 : -1 );
+                       pat->patternIdx = 0;
+                   } else
+                       value = 0;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_HIKKAKEMOD:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( inHigh[i-2] < inHigh[i-3] && inLow[i-2] > inLow[i-3] &&                     // 2nd: lower high and higher low than 1st
+                   inHigh[i-1] < inHigh[i-2] && inLow[i-1] > inLow[i-2] &&                     // 3rd: lower high and higher low than 2nd
+                   ( ( inHigh[i] < inHigh[i-1] && inLow[i] < inLow[i-1] &&                     // (bull) 4th: lower high and lower low
+                       inClose[i-2] <= inLow[i-2] + CDL_AVG( Near, i-2 )
+                                                                                               // (bull) 2nd: close near the low
+                     )
+                     ||
+                     ( inHigh[i] > inHigh[i-1] && inLow[i] > inLow[i-1] &&                     // (bear) 4th: higher high and higher low
+                       inClose[i-2] >= inHigh[i-2] - CDL_AVG( Near, i-2 )
+                                                                                               // (bull) 2nd: close near the top
+                     )
+                   )
+               ) {
+                   pat->patternResult = 100 * ( inHigh[i] < inHigh[i-1] ? 1 : -1 );
+                   pat->patternIdx = i;
+                   value = pat->patternResult;
+               } else
+                   /* search for confirmation if modified hikkake was no more than 3 bars ago */
+                   if( i <= pat->patternIdx+3 &&
+                       ( ( pat->patternResult > 0 && inClose[i] > inHigh[pat->patternIdx-1] )  // close higher than the high of 3rd
+                         ||
+                         ( pat->patternResult < 0 && inClose[i] < inLow[pat->patternIdx-1] )   // close lower than the low of 3rd
+                       )
+                   ) {
+                       value = pat->patternResult + 100 * ( pat->patternResult > 0 ? 1 : -1 );
+                       pat->patternIdx = 0;
+                   } else
+                       value = 0;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_HOMINGPIGEON:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_CANDLECOLOR(i-1) == -1 &&                    // 1st black
+                   TA_CANDLECOLOR(i) == -1 &&                      // 2nd black
+                   TA_REALBODY(i-1) > CDL_AVG( BodyLong, i-1 ) &&  // 1st long
+                   TA_REALBODY(i) <= CDL_AVG( BodyShort, i ) &&    // 2nd short
+                   inOpen[i] < inOpen[i-1] &&                      // 2nd engulfed by 1st
+                   inClose[i] > inClose[i-1]
+                 )
+                   value = 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_IDENTICAL3CROWS:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_CANDLECOLOR(i-2) == -1 &&    // 1st black
+                                                   // very short lower shadow
+                   TA_LOWERSHADOW(i-2) < CDL_AVG( ShadowVeryShort, i-2 ) &&
+                   TA_CANDLECOLOR(i-1) == -1 &&    // 2nd black
+                                                   // very short lower shadow
+                   TA_LOWERSHADOW(i-1) < CDL_AVG( ShadowVeryShort, i-1 ) &&
+                   TA_CANDLECOLOR(i) == -1 &&      // 3rd black
+                                                   // very short lower shadow
+                   TA_LOWERSHADOW(i) < CDL_AVG( ShadowVeryShort, i ) &&
+                   inClose[i-2] > inClose[i-1] &&  // three declining
+                   inClose[i-1] > inClose[i] &&
+                                                   // 2nd black opens very close to 1st close
+                   inOpen[i-1] <= inClose[i-2] + CDL_AVG( Equal, i-2 ) &&
+                   inOpen[i-1] >= inClose[i-2] - CDL_AVG( Equal, i-2 ) &&
+                                                   // 3rd black opens very close to 2nd close
+                   inOpen[i] <= inClose[i-1] + CDL_AVG( Equal, i-1 ) &&
+                   inOpen[i] >= inClose[i-1] - CDL_AVG( Equal, i-1 )
+                 )
+                   value = -100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_INNECK:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_CANDLECOLOR(i-1) == -1 &&                           // 1st: black
+                   TA_REALBODY(i-1) > CDL_AVG( BodyLong, i-1 ) &&         //  long
+                   TA_CANDLECOLOR(i) == 1 &&                              // 2nd: white
+                   inOpen[i] < inLow[i-1] &&                              //  open below prior low
+                   inClose[i] <= inClose[i-1] + CDL_AVG( Equal, i-1 ) &&  //  close slightly into prior body
+                   inClose[i] >= inClose[i-1]
+                 )
+                   value = -100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_INVERTEDHAMMER:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i) < CDL_AVG( BodyShort, i ) &&           // small rb
+                   TA_UPPERSHADOW(i) > CDL_AVG( ShadowLong, i ) &&       // long upper shadow
+                   TA_LOWERSHADOW(i) < CDL_AVG( ShadowVeryShort, i ) &&  // very short lower shadow
+                   TA_REALBODYGAPDOWN(i, i-1) )                          // gap down
+                   value = 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_KICKING:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_CANDLECOLOR(i-1) == -TA_CANDLECOLOR(i) &&  // opposite candles
+                                                                 // 1st marubozu
+                   TA_REALBODY(i-1) > CDL_AVG( BodyLong, i-1 ) &&
+                   TA_UPPERSHADOW(i-1) < CDL_AVG( ShadowVeryShort, i-1 ) &&
+                   TA_LOWERSHADOW(i-1) < CDL_AVG( ShadowVeryShort, i-1 ) &&
+                                                                 // 2nd marubozu
+                   TA_REALBODY(i) > CDL_AVG( BodyLong, i ) &&
+                   TA_UPPERSHADOW(i) < CDL_AVG( ShadowVeryShort, i ) &&
+                   TA_LOWERSHADOW(i) < CDL_AVG( ShadowVeryShort, i ) &&
+                                                                 // gap
+                   (
+                     ( TA_CANDLECOLOR(i-1) == -1 && TA_CANDLEGAPUP(i,i-1) )
+                     ||
+                     ( TA_CANDLECOLOR(i-1) == 1 && TA_CANDLEGAPDOWN(i,i-1) )
+                   )
+                 )
+                   value = TA_CANDLECOLOR(i) * 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_KICKINGBYLENGTH:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_CANDLECOLOR(i-1) == -TA_CANDLECOLOR(i) &&  // opposite candles
+                                                                 // 1st marubozu
+                   TA_REALBODY(i-1) > CDL_AVG( BodyLong, i-1 ) &&
+                   TA_UPPERSHADOW(i-1) < CDL_AVG( ShadowVeryShort, i-1 ) &&
+                   TA_LOWERSHADOW(i-1) < CDL_AVG( ShadowVeryShort, i-1 ) &&
+                                                                 // 2nd marubozu
+                   TA_REALBODY(i) > CDL_AVG( BodyLong, i ) &&
+                   TA_UPPERSHADOW(i) < CDL_AVG( ShadowVeryShort, i ) &&
+                   TA_LOWERSHADOW(i) < CDL_AVG( ShadowVeryShort, i ) &&
+                                                                 // gap
+                   (
+                     ( TA_CANDLECOLOR(i-1) == -1 && TA_CANDLEGAPUP(i,i-1) )
+                     ||
+                     ( TA_CANDLECOLOR(i-1) == 1 && TA_CANDLEGAPDOWN(i,i-1) )
+                   )
+                 )
+                   value = TA_CANDLECOLOR( ( TA_REALBODY(i) > TA_REALBODY(i-1) ? i : i-1 ) ) * 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_LADDERBOTTOM:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if(
+                   TA_CANDLECOLOR(i-4) == -1 && TA_CANDLECOLOR(i-3) == -1 && TA_CANDLECOLOR(i-2) == -1 && // 3 black candlesticks
+                   inOpen[i-4] > inOpen[i-3] && inOpen[i-3] > inOpen[i-2] &&                          // with consecutively lower opens
+                   inClose[i-4] > inClose[i-3] && inClose[i-3] > inClose[i-2] &&                      // and closes
+                   TA_CANDLECOLOR(i-1) == -1 &&                                                       // 4th: black with an upper shadow
+                   TA_UPPERSHADOW(i-1) > CDL_AVG( ShadowVeryShort, i-1 ) &&
+                   TA_CANDLECOLOR(i) == 1 &&                                                          // 5th: white
+                   inOpen[i] > inOpen[i-1] &&                                                         // that opens above prior candle's body
+                   inClose[i] > inHigh[i-1]                                                           // and closes above prior candle's high
+                 )
+                   value = 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_LONGLEGGEDDOJI:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i) <= CDL_AVG( BodyDoji, i ) &&
+                   ( TA_LOWERSHADOW(i) > CDL_AVG( ShadowLong, i )
+                     ||
+                     TA_UPPERSHADOW(i) > CDL_AVG( ShadowLong, i )
+                   )
+                 )
+                   value = 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_LONGLINE:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i) > CDL_AVG( BodyLong, i ) &&
+                   TA_UPPERSHADOW(i) < CDL_AVG( ShadowShort, i ) &&
+                   TA_LOWERSHADOW(i) < CDL_AVG( ShadowShort, i ) )
+                   value = TA_CANDLECOLOR(i) * 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_MARUBOZU:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i) > CDL_AVG( BodyLong, i ) &&
+                   TA_UPPERSHADOW(i) < CDL_AVG( ShadowVeryShort, i ) &&
+                   TA_LOWERSHADOW(i) < CDL_AVG( ShadowVeryShort, i ) )
+                   value = TA_CANDLECOLOR(i) * 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_MATCHINGLOW:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_CANDLECOLOR(i-1) == -1 &&                           // first black
+                   TA_CANDLECOLOR(i) == -1 &&                             // second black
+                   inClose[i] <= inClose[i-1] + CDL_AVG( Equal, i-1 ) &&  // 1st and 2nd same close
+                   inClose[i] >= inClose[i-1] - CDL_AVG( Equal, i-1 )
+                 )
+                   value = 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_MATHOLD:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if(  // 1st long, then 3 small
+                   TA_REALBODY(i-4) > CDL_AVG( BodyLong, i-4 ) &&
+                   TA_REALBODY(i-3) < CDL_AVG( BodyShort, i-3 ) &&
+                   TA_REALBODY(i-2) < CDL_AVG( BodyShort, i-2 ) &&
+                   TA_REALBODY(i-1) < CDL_AVG( BodyShort, i-1 ) &&
+                    // white, black, 2 black or white, white
+                   TA_CANDLECOLOR(i-4) == 1 &&
+                   TA_CANDLECOLOR(i-3) == -1 &&
+                   TA_CANDLECOLOR(i) == 1 &&
+                    // upside gap 1st to 2nd
+                   TA_REALBODYGAPUP(i-3,i-4) &&
+                    // 3rd to 4th hold within 1st: a part of the real body must be within 1st real body
+                   min(inOpen[i-2], inClose[i-2]) < inClose[i-4] &&
+                   min(inOpen[i-1], inClose[i-1]) < inClose[i-4] &&
+                    // reaction days penetrate first body less than penetration percent
+                   min(inOpen[i-2], inClose[i-2]) > inClose[i-4] - TA_REALBODY(i-4) * penetration &&
+                   min(inOpen[i-1], inClose[i-1]) > inClose[i-4] - TA_REALBODY(i-4) * penetration &&
+                    // 2nd to 4th are falling
+                   max(inClose[i-2], inOpen[i-2]) < inOpen[i-3] &&
+                   max(inClose[i-1], inOpen[i-1]) < max(inClose[i-2], inOpen[i-2]) &&
+                    // 5th opens above the prior close
+                   inOpen[i] > inClose[i-1] &&
+                    // 5th closes above the highest high of the reaction days
+                   inClose[i] > max(max(inHigh[i-3], inHigh[i-2]), inHigh[i-1])
+                 )
+                   value = 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_MORNINGDOJISTAR:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i-2) > CDL_AVG( BodyLong, i-2 ) &&              // 1st: long
+                   TA_CANDLECOLOR(i-2) == -1 &&                                //           black
+                   TA_REALBODY(i-1) <= CDL_AVG( BodyDoji, i-1 ) &&             // 2nd: doji
+                   TA_REALBODYGAPDOWN(i-1,i-2) &&                              //           gapping down
+                   TA_REALBODY(i) > CDL_AVG( BodyShort, i ) &&                 // 3rd: longer than short
+                   TA_CANDLECOLOR(i) == 1 &&                                   //          white real body
+                   inClose[i] > inClose[i-2] + TA_REALBODY(i-2) * penetration  //               closing well within 1st rb
+                 )
+                   value = 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_MORNINGSTAR:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i-2) > CDL_AVG( BodyLong, i-2 ) &&              // 1st: long
+                   TA_CANDLECOLOR(i-2) == -1 &&                                //           black
+                   TA_REALBODY(i-1) <= CDL_AVG( BodyShort, i-1 ) &&            // 2nd: short
+                   TA_REALBODYGAPDOWN(i-1,i-2) &&                              //            gapping down
+                   TA_REALBODY(i) > CDL_AVG( BodyShort, i ) &&                 // 3rd: longer than short
+                   TA_CANDLECOLOR(i) == 1 &&                                   //          black real body
+                   inClose[i] > inClose[i-2] + TA_REALBODY(i-2) * penetration  //               closing well within 1st rb
+                 )
+                   value = 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_ONNECK:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_CANDLECOLOR(i-1) == -1 &&                         // 1st: black
+                   TA_REALBODY(i-1) > CDL_AVG( BodyLong, i-1 ) &&       //      long
+                   TA_CANDLECOLOR(i) == 1 &&                            // 2nd: white
+                   inOpen[i] < inLow[i-1] &&                            //   open below prior low
+                   inClose[i] <= inLow[i-1] + CDL_AVG( Equal, i-1 ) &&  //   close equal to prior low
+                   inClose[i] >= inLow[i-1] - CDL_AVG( Equal, i-1 )
+                 )
+                   value = -100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_PIERCING:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_CANDLECOLOR(i-1) == -1 &&                        // 1st: black
+                   TA_REALBODY(i-1) > CDL_AVG( BodyLong, i-1 ) &&      //      long
+                   TA_CANDLECOLOR(i) == 1 &&                           // 2nd: white
+                   TA_REALBODY(i) > CDL_AVG( BodyLong, i ) &&          //      long
+                   inOpen[i] < inLow[i-1] &&                           //      open below prior low
+                   inClose[i] < inOpen[i-1] &&                         //      close within prior body
+                   inClose[i] > inClose[i-1] + TA_REALBODY(i-1) * 0.5  //        above midpoint
+                 )
+                   value = 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_RICKSHAWMAN:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i) <= CDL_AVG( BodyDoji, i ) &&      // doji
+                   TA_LOWERSHADOW(i) > CDL_AVG( ShadowLong, i ) &&  // long shadow
+                   TA_UPPERSHADOW(i) > CDL_AVG( ShadowLong, i ) &&  // long shadow
+                   (                                                // body near midpoint
+                       min( inOpen[i], inClose[i] )
+                           <= inLow[i] + TA_HIGHLOWRANGE(i) / 2 + CDL_AVG( Near, i )
+                       &&
+                       max( inOpen[i], inClose[i] )
+                           >= inLow[i] + TA_HIGHLOWRANGE(i) / 2 - CDL_AVG( Near, i )
+                   )
+                 )
+                   value = 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_RISEFALL3METHODS:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if(  // 1st long, then 3 small, 5th long
+                   TA_REALBODY(i-4) > CDL_AVG( BodyLong, i-4 ) &&
+                   TA_REALBODY(i-3) < CDL_AVG( BodyShort, i-3 ) &&
+                   TA_REALBODY(i-2) < CDL_AVG( BodyShort, i-2 ) &&
+                   TA_REALBODY(i-1) < CDL_AVG( BodyShort, i-1 ) &&
+                   TA_REALBODY(i)   > CDL_AVG( BodyLong, i ) &&
+                    // white, 3 black, white  ||  black, 3 white, black
+                   TA_CANDLECOLOR(i-4) == -TA_CANDLECOLOR(i-3) &&
+                   TA_CANDLECOLOR(i-3) ==  TA_CANDLECOLOR(i-2) &&
+                   TA_CANDLECOLOR(i-2) ==  TA_CANDLECOLOR(i-1) &&
+                   TA_CANDLECOLOR(i-1) == -TA_CANDLECOLOR(i) &&
+                    // 2nd to 4th hold within 1st: a part of the real body must be within 1st range
+                   min(inOpen[i-3], inClose[i-3]) < inHigh[i-4] && max(inOpen[i-3], inClose[i-3]) > inLow[i-4] &&
+                   min(inOpen[i-2], inClose[i-2]) < inHigh[i-4] && max(inOpen[i-2], inClose[i-2]) > inLow[i-4] &&
+                   min(inOpen[i-1], inClose[i-1]) < inHigh[i-4] && max(inOpen[i-1], inClose[i-1]) > inLow[i-4] &&
+                    // 2nd to 4th are falling (rising)
+                   inClose[i-2] * TA_CANDLECOLOR(i-4) < inClose[i-3] * TA_CANDLECOLOR(i-4) &&
+                   inClose[i-1] * TA_CANDLECOLOR(i-4) < inClose[i-2] * TA_CANDLECOLOR(i-4) &&
+                    // 5th opens above (below) the prior close
+                   inOpen[i] * TA_CANDLECOLOR(i-4) > inClose[i-1] * TA_CANDLECOLOR(i-4) &&
+                    // 5th closes above (below) the 1st close
+                   inClose[i] * TA_CANDLECOLOR(i-4) > inClose[i-4] * TA_CANDLECOLOR(i-4)
+                 )
+                   value = 100 * TA_CANDLECOLOR(i-4);
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_SEPARATINGLINES:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_CANDLECOLOR(i-1) == -TA_CANDLECOLOR(i) &&         // opposite candles
+                   inOpen[i] <= inOpen[i-1] + CDL_AVG( Equal, i-1 ) &&  // same open
+                   inOpen[i] >= inOpen[i-1] - CDL_AVG( Equal, i-1 ) &&
+                   TA_REALBODY(i) > CDL_AVG( BodyLong, i ) &&           // belt hold: long body
+                   (
+                     ( TA_CANDLECOLOR(i) == 1 &&                        // with no lower shadow if bullish
+                       TA_LOWERSHADOW(i) < CDL_AVG( ShadowVeryShort, i )
+                     )
+                     ||
+                     ( TA_CANDLECOLOR(i) == -1 &&                       // with no upper shadow if bearish
+                       TA_UPPERSHADOW(i) < CDL_AVG( ShadowVeryShort, i )
+                     )
+                   )
+                 )
+                   value = TA_CANDLECOLOR(i) * 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_SHOOTINGSTAR:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i) < CDL_AVG( BodyShort, i ) &&           // small rb
+                   TA_UPPERSHADOW(i) > CDL_AVG( ShadowLong, i ) &&       // long upper shadow
+                   TA_LOWERSHADOW(i) < CDL_AVG( ShadowVeryShort, i ) &&  // very short lower shadow
+                   TA_REALBODYGAPUP(i, i-1) )                            // gap up
+                   value = -100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_SHORTLINE:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i) < CDL_AVG( BodyShort, i ) &&
+                   TA_UPPERSHADOW(i) < CDL_AVG( ShadowShort, i ) &&
+                   TA_LOWERSHADOW(i) < CDL_AVG( ShadowShort, i ) )
+                   value = TA_CANDLECOLOR(i) * 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_SPINNINGTOP:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i) < CDL_AVG( BodyShort, i ) &&
+                   TA_UPPERSHADOW(i) > TA_REALBODY(i) &&
+                   TA_LOWERSHADOW(i) > TA_REALBODY(i)
+                 )
+                   value = TA_CANDLECOLOR(i) * 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_STALLEDPATTERN:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_CANDLECOLOR(i-2) == 1 &&                                  // 1st white
+                   TA_CANDLECOLOR(i-1) == 1 &&                                  // 2nd white
+                   TA_CANDLECOLOR(i) == 1 &&                                    // 3rd white
+                   inClose[i] > inClose[i-1] && inClose[i-1] > inClose[i-2] &&  // consecutive higher closes
+                   TA_REALBODY(i-2) > CDL_AVG( BodyLong, i-2 ) &&               // 1st: long real body
+                   TA_REALBODY(i-1) > CDL_AVG( BodyLong, i-1 ) &&               // 2nd: long real body
+                                                                                // very short upper shadow
+                   TA_UPPERSHADOW(i-1) < CDL_AVG( ShadowVeryShort, i-1 ) &&
+                                                                                // opens within/near 1st real body
+                   inOpen[i-1] > inOpen[i-2] &&
+                   inOpen[i-1] <= inClose[i-2] + CDL_AVG( Near, i-2 ) &&
+                   TA_REALBODY(i) < CDL_AVG( BodyShort, i ) &&                  // 3rd: small real body
+                                                                                // rides on the shoulder of 2nd real body
+                   inOpen[i] >= inClose[i-1] - TA_REALBODY(i) - CDL_AVG( Near, i-1 )
+                 )
+                   value = -100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_STICKSANDWICH:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_CANDLECOLOR(i-2) == -1 &&                           // first black
+                   TA_CANDLECOLOR(i-1) == 1 &&                            // second white
+                   TA_CANDLECOLOR(i) == -1 &&                             // third black
+                   inLow[i-1] > inClose[i-2] &&                           // 2nd low > prior close
+                   inClose[i] <= inClose[i-2] + CDL_AVG( Equal, i-2 ) &&  // 1st and 3rd same close
+                   inClose[i] >= inClose[i-2] - CDL_AVG( Equal, i-2 )
+                 )
+                   value = 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_TAKURI:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i) <= CDL_AVG( BodyDoji, i ) &&
+                   TA_UPPERSHADOW(i) < CDL_AVG( ShadowVeryShort, i ) &&
+                   TA_LOWERSHADOW(i) > CDL_AVG( ShadowVeryLong, i )
+                 )
+                   value = 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_TASUKIGAP:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if(
+                   (
+                       TA_REALBODYGAPUP(i-1,i-2) &&                            // upside gap
+                       TA_CANDLECOLOR(i-1) == 1 &&                             // 1st: white
+                       TA_CANDLECOLOR(i) == -1 &&                              // 2nd: black
+                       inOpen[i] < inClose[i-1] && inOpen[i] > inOpen[i-1] &&  //      that opens within the white rb
+                       inClose[i] < inOpen[i-1] &&                             //      and closes under the white rb
+                       inClose[i] > max(inClose[i-2], inOpen[i-2]) &&          //      inside the gap
+                                                                               // size of 2 rb near the same
+                       std_fabs(TA_REALBODY(i-1) - TA_REALBODY(i)) < CDL_AVG( Near, i-1 )
+                   ) ||
+                   (
+                       TA_REALBODYGAPDOWN(i-1,i-2) &&                          // downside gap
+                       TA_CANDLECOLOR(i-1) == -1 &&                            // 1st: black
+                       TA_CANDLECOLOR(i) == 1 &&                               // 2nd: white
+                       inOpen[i] < inOpen[i-1] && inOpen[i] > inClose[i-1] &&  //      that opens within the black rb
+                       inClose[i] > inOpen[i-1] &&                             //      and closes above the black rb
+                       inClose[i] < min(inClose[i-2], inOpen[i-2]) &&          //      inside the gap
+                                                                               // size of 2 rb near the same
+                       std_fabs(TA_REALBODY(i-1) - TA_REALBODY(i)) < CDL_AVG( Near, i-1 )
+                   )
+               )
+                   value = TA_CANDLECOLOR(i-1) * 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_THRUSTING:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_CANDLECOLOR(i-1) == -1 &&                          // 1st: black
+                   TA_REALBODY(i-1) > CDL_AVG( BodyLong, i-1 ) &&        //  long
+                   TA_CANDLECOLOR(i) == 1 &&                             // 2nd: white
+                   inOpen[i] < inLow[i-1] &&                             //  open below prior low
+                   inClose[i] > inClose[i-1] + CDL_AVG( Equal, i-1 ) &&  //  close into prior body
+                   inClose[i] <= inClose[i-1] + TA_REALBODY(i-1) * 0.5   //   under the midpoint
+                 )
+                   value = -100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_TRISTAR:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i-2) <= CDL_AVG( BodyDoji, i-2 ) &&                 // 1st: doji
+                   TA_REALBODY(i-1) <= CDL_AVG( BodyDoji, i-2 ) &&                 // 2nd: doji
+                   TA_REALBODY(i) <= CDL_AVG( BodyDoji, i-2 ) ) {                  // 3rd: doji
+                   if ( TA_REALBODYGAPUP(i-1,i-2)                                  // 2nd gaps up
+                        &&
+                        max(inOpen[i],inClose[i]) < max(inOpen[i-1],inClose[i-1])  // 3rd is not higher than 2nd
+                      )
+                       value = -100;
+                   if ( TA_REALBODYGAPDOWN(i-1,i-2)                                // 2nd gaps down
+                        &&
+                        min(inOpen[i],inClose[i]) > min(inOpen[i-1],inClose[i-1])  // 3rd is not lower than 2nd
+                      )
+                       value = +100;
+               }
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_UNIQUE3RIVER:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_REALBODY(i-2) > CDL_AVG( BodyLong, i-2 ) &&                // 1st: long
+                   TA_CANDLECOLOR(i-2) == -1 &&                                  //      black
+                   TA_CANDLECOLOR(i-1) == -1 &&                                  // 2nd: black
+                   inClose[i-1] > inClose[i-2] && inOpen[i-1] <= inOpen[i-2] &&  //      harami
+                   inLow[i-1] < inLow[i-2] &&                                    //      lower low
+                   TA_REALBODY(i) < CDL_AVG( BodyShort, i ) &&                   // 3rd: short
+                   TA_CANDLECOLOR(i) == 1 &&                                     //      white
+                   inOpen[i] > inLow[i-1]                                        //      open not lower
+                 )
+                   value = 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_UPSIDEGAP2CROWS:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_CANDLECOLOR(i-2) == 1 &&                              // 1st: white
+                   TA_REALBODY(i-2) > CDL_AVG( BodyLong, i-2 ) &&           //      long
+                   TA_CANDLECOLOR(i-1) == -1 &&                             // 2nd: black
+                   TA_REALBODY(i-1) <= CDL_AVG( BodyShort, i-1 ) &&         //      short
+                   TA_REALBODYGAPUP(i-1,i-2) &&                             //      gapping up
+                   TA_CANDLECOLOR(i) == -1 &&                               // 3rd: black
+                   inOpen[i] > inOpen[i-1] && inClose[i] < inClose[i-1] &&  // 3rd: engulfing prior rb
+                   inClose[i] > inClose[i-2]                                //      closing above 1st
+                 )
+                   value = -100;
+               CDL_OUTPUT( value );
+            }
+            break;
+
+         case TA_CDLPattern_XSIDEGAP3METHODS:
+            for( i=firstIdx; i <= blockEnd; i++ )
+            {
+               value = 0;
+               if( TA_CANDLECOLOR(i-2) == TA_CANDLECOLOR(i-1) &&   // 1st and 2nd of same color
+                   TA_CANDLECOLOR(i-1) == -TA_CANDLECOLOR(i) &&    // 3rd opposite color
+                   inOpen[i] < max(inClose[i-1], inOpen[i-1]) &&   // 3rd opens within 2nd rb
+                   inOpen[i] > min(inClose[i-1], inOpen[i-1]) &&
+                   inClose[i] < max(inClose[i-2], inOpen[i-2]) &&  // 3rd closes within 1st rb
+                   inClose[i] > min(inClose[i-2], inOpen[i-2]) &&
+                   ( (
+                       TA_CANDLECOLOR(i-2) == 1 &&                 // when 1st is white
+                       TA_REALBODYGAPUP(i-1,i-2)                   // upside gap
+                     ) ||
+                     (
+                       TA_CANDLECOLOR(i-2) == -1 &&                // when 1st is black
+                       TA_REALBODYGAPDOWN(i-1,i-2)                 // downside gap
+                     )
+                   )
+               )
+                   value = TA_CANDLECOLOR(i-2) * 100;
+               CDL_OUTPUT( value );
+            }
+            break;
+         default:
+            break;
+         }
+      }
+   }
+
+   TA_Free( patterns );
+   TA_Free( total );
+   TA_Free( blockAvg );
+
+   return TA_SUCCESS;
+}
@@ -0,0 +1,538 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ *  101826 MF   Start each output from the same bar as its function.
+ */
+
+/* Description:
+ *   Calculate all the outputs of the directional movement family
+ *   (TRANGE, ATR, NATR, PLUS_DM, MINUS_DM, PLUS_DI, MINUS_DI, DX,
+ *   ADX and ADXR) with a single pass on the price bars.
+ *
+ *   The true range and the one period directional movements are
+ *   evaluated once per bar and are shared by all the Wilder's
+ *   smoothings. The calculations are the ones of the individual
+ *   functions (see ta_ADX.c for the explanation), ADXR is done
+ *   without the intermediate ADX buffer of ta_ADXR.c.
+ *
+ *   The Wilder's smoothings are unstable, so each output must start
+ *   its smoothing at the same bar as its own function would: the
+ *   lookback of the function (with its unstable period) before the
+ *   first output. The outputs starting at the same bar share one
+ *   smoothing (see DmChain). With the default unstable periods,
+ *   there are four: PLUS_DM/MINUS_DM, ATR/NATR/PLUS_DI/MINUS_DI/DX,
+ *   ADX and ADXR.
+ */
+
+/**** Headers ****/
+#include <math.h>
+
+#include "ta_func_ext.h"
+#include "ta_memory.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+
+/* Only one of the double or float inputs are not NULL. */
+#define DM_PRICE(in,idx) (inHigh? in[idx] : (double)in##Float[idx])
+
+/* The functions calculated by TA_DM_ALL (TRANGE has no smoothing). */
+typedef enum
+{
+   DM_ALL_ATR,
+   DM_ALL_NATR,
+   DM_ALL_PLUS_DM,
+   DM_ALL_MINUS_DM,
+   DM_ALL_PLUS_DI,
+   DM_ALL_MINUS_DI,
+   DM_ALL_DX,
+   DM_ALL_ADX,
+   DM_ALL_ADXR,
+   DM_ALL_NB_FUNC
+} DmAllFunc;
+
+/* The Wilder's smoothings starting at the same bar. */
+typedef struct
+{
+   int firstIdx;    /* Bar where the smoothings start.   */
+   int firstADXIdx; /* Bar of the first ADX.             */
+   int doATR, doDI, doDX, doADX;
+
+   double prevMinusDM, prevPlusDM, prevTR, prevATR;
+   double minusDI, plusDI, dx, sumDX, prevADX;
+} DmChain;
+
+/**** Local functions declarations.    ****/
+static TA_RetCode dmAll( int    startIdx,
+                         int    endIdx,
+                         const double inHigh[],
+                         const double inLow[],
+                         const double inClose[],
+                         const float  inHighFloat[],
+                         const float  inLowFloat[],
+                         const float  inCloseFloat[],
+                         int           optInTimePeriod,
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double        outTrueRange[],
+                         double        outATR[],
+                         double        outNATR[],
+                         double        outPlusDM[],
+                         double        outMinusDM[],
+                         double        outPlusDI[],
+                         double        outMinusDI[],
+                         double        outDX[],
+                         double        outADX[],
+                         double        outADXR[] );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+int TA_DM_ALL_Lookback( int optInTimePeriod )
+{
+   int lookback, tempInt;
+
+   /* All the outputs are calculated with the longest lookback,
+    * which is the one of ADXR unless an unstable period makes
+    * another function longer.
+    */
+   lookback = TA_ADXR_Lookback( optInTimePeriod );
+   if( lookback < 0 )
+      return -1;
+
+   tempInt = TA_ATR_Lookback( optInTimePeriod );
+   if( tempInt > lookback ) lookback = tempInt;
+   tempInt = TA_NATR_Lookback( optInTimePeriod );
+   if( tempInt > lookback ) lookback = tempInt;
+   tempInt = TA_PLUS_DM_Lookback( optInTimePeriod );
+   if( tempInt > lookback ) lookback = tempInt;
+   tempInt = TA_MINUS_DM_Lookback( optInTimePeriod );
+   if( tempInt > lookback ) lookback = tempInt;
+   tempInt = TA_PLUS_DI_Lookback( optInTimePeriod );
+   if( tempInt > lookback ) lookback = tempInt;
+   tempInt = TA_MINUS_DI_Lookback( optInTimePeriod );
+   if( tempInt > lookback ) lookback = tempInt;
+   tempInt = TA_DX_Lookback( optInTimePeriod );
+   if( tempInt > lookback ) lookback = tempInt;
+   tempInt = TA_ADX_Lookback( optInTimePeriod );
+   if( tempInt > lookback ) lookback = tempInt;
+
+   return lookback;
+}
+
+TA_RetCode TA_DM_ALL( int    startIdx,
+                      int    endIdx,
+                      const double inHigh[],
+                      const double inLow[],
+                      const double inClose[],
+                      int           optInTimePeriod,
+                      int          *outBegIdx,
+                      int          *outNBElement,
+                      double        outTrueRange[],
+                      double        outATR[],
+                      double        outNATR[],
+                      double        outPlusDM[],
+                      double        outMinusDM[],
+                      double        outPlusDI[],
+                      double        outMinusDI[],
+                      double        outDX[],
+                      double        outADX[],
+                      double        outADXR[] )
+{
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      if( !inHigh || !inLow || !inClose )
+         return TA_BAD_PARAM;
+   #endif
+
+   return dmAll( startIdx, endIdx, inHigh, inLow, inClose, NULL, NULL, NULL,
+                 optInTimePeriod, outBegIdx, outNBElement,
+                 outTrueRange, outATR, outNATR, outPlusDM, outMinusDM,
+                 outPlusDI, outMinusDI, outDX, outADX, outADXR );
+}
+
+TA_RetCode TA_S_DM_ALL( int    startIdx,
+                        int    endIdx,
+                        const float  inHigh[],
+                        const float  inLow[],
+                        const float  inClose[],
+                        int           optInTimePeriod,
+                        int          *outBegIdx,
+                        int          *outNBElement,
+                        double        outTrueRange[],
+                        double        outATR[],
+                        double        outNATR[],
+                        double        outPlusDM[],
+                        double        outMinusDM[],
+                        double        outPlusDI[],
+                        double        outMinusDI[],
+                        double        outDX[],
+                        double        outADX[],
+                        double        outADXR[] )
+{
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      if( !inHigh || !inLow || !inClose )
+         return TA_BAD_PARAM;
+   #endif
+
+   return dmAll( startIdx, endIdx, NULL, NULL, NULL, inHigh, inLow, inClose,
+                 optInTimePeriod, outBegIdx, outNBElement,
+                 outTrueRange, outATR, outNATR, outPlusDM, outMinusDM,
+                 outPlusDI, outMinusDI, outDX, outADX, outADXR );
+}
+
+/**** Local functions definitions.     ****/
+static TA_RetCode dmAll( int    startIdx,
+                         int    endIdx,
+                         const double inHigh[],
+                         const double inLow[],
+                         const double inClose[],
+                         const float  inHighFloat[],
+                         const float  inLowFloat[],
+                         const float  inCloseFloat[],
+                         int           optInTimePeriod,
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double        outTrueRange[],
+                         double        outATR[],
+                         double        outNATR[],
+                         double        outPlusDM[],
+                         double        outMinusDM[],
+                         double        outPlusDI[],
+                         double        outMinusDI[],
+                         double        outDX[],
+                         double        outADX[],
+                         double        outADXR[] )
+{
+   int today, lookbackTotal, outIdx, firstIdx, f, c, nbChain;
+   double prevHigh, prevLow, prevClose;
+   double todayHigh, todayLow, todayClose;
+   double trueRange, tempReal, diffP, diffM, plusDM1, minusDM1;
+   int lookback[DM_ALL_NB_FUNC];
+   int isRequested[DM_ALL_NB_FUNC];
+   int chainOf[DM_ALL_NB_FUNC];
+   DmChain chain[DM_ALL_NB_FUNC];
+   DmChain *ch;
+   int dxIsValid;
+
+   /* Keep the last (optInTimePeriod-1) ADX for the ADXR. */
+   CIRCBUF_PROLOG(adxBuffer,double,30);
+
+   #define TRUE_RANGE(TH,TL,YC,OUT) {\
+      OUT = TH-TL; \
+      tempReal = std_fabs(TH-YC); \
+      if( tempReal > OUT ) \
+         OUT = tempReal; \
+      tempReal = std_fabs(TL-YC); \
+      if( tempReal > OUT ) \
+         OUT = tempReal; \
+   }
+
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      if( startIdx < 0 )
+         return TA_OUT_OF_RANGE_START_INDEX;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return TA_OUT_OF_RANGE_END_INDEX;
+      if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+         optInTimePeriod = 14;
+      else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+         return TA_BAD_PARAM;
+      if( !outBegIdx || !outNBElement )
+         return TA_BAD_PARAM;
+      if( !outTrueRange && !outATR && !outNATR && !outPlusDM && !outMinusDM &&
+          !outPlusDI && !outMinusDI && !outDX && !outADX && !outADXR )
+         return TA_BAD_PARAM;
+   #endif
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = TA_DM_ALL_Lookback( optInTimePeriod );
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      *outBegIdx    = 0;
+      *outNBElement = 0;
+      return TA_SUCCESS;
+   }
+
+   lookback[DM_ALL_ATR]      = TA_ATR_Lookback( optInTimePeriod );
+   lookback[DM_ALL_NATR]     = TA_NATR_Lookback( optInTimePeriod );
+   lookback[DM_ALL_PLUS_DM]  = TA_PLUS_DM_Lookback( optInTimePeriod );
+   lookback[DM_ALL_MINUS_DM] = TA_MINUS_DM_Lookback( optInTimePeriod );
+   lookback[DM_ALL_PLUS_DI]  = TA_PLUS_DI_Lookback( optInTimePeriod );
+   lookback[DM_ALL_MINUS_DI] = TA_MINUS_DI_Lookback( optInTimePeriod );
+   lookback[DM_ALL_DX]       = TA_DX_Lookback( optInTimePeriod );
+   lookback[DM_ALL_ADX]      = TA_ADX_Lookback( optInTimePeriod );
+   lookback[DM_ALL_ADXR]     = TA_ADXR_Lookback( optInTimePeriod );
+
+   isRequested[DM_ALL_ATR]      = outATR != NULL;
+   isRequested[DM_ALL_NATR]     = outNATR != NULL;
+   isRequested[DM_ALL_PLUS_DM]  = outPlusDM != NULL;
+   isRequested[DM_ALL_MINUS_DM] = outMinusDM != NULL;
+   isRequested[DM_ALL_PLUS_DI]  = outPlusDI != NULL;
+   isRequested[DM_ALL_MINUS_DI] = outMinusDI != NULL;
+   isRequested[DM_ALL_DX]       = outDX != NULL;
+   isRequested[DM_ALL_ADX]      = outADX != NULL;
+   isRequested[DM_ALL_ADXR]     = outADXR != NULL;
+
+   /* One chain of smoothings for each distinct starting bar
+    * among the requested functions.
+    */
+   nbChain = 0;
+   for( f=0; f < DM_ALL_NB_FUNC; f++ )
+   {
+      chainOf[f] = -1;
+      if( !isRequested[f] )
+         continue;
+
+      firstIdx = startIdx-lookback[f];
+      for( c=0; c < nbChain; c++ )
+      {
+         if( chain[c].firstIdx == firstIdx )
+            break;
+      }
+
+      ch = &chain[c];
+      if( c == nbChain )
+      {
+         nbChain++;
+         ch->firstIdx    = firstIdx;
+         ch->firstADXIdx = firstIdx + (2*optInTimePeriod) - 1;
+         ch->doATR = ch->doDI = ch->doDX = ch->doADX = 0;
+         ch->prevMinusDM = ch->prevPlusDM = ch->prevTR = ch->prevATR = 0.0;
+         ch->minusDI = ch->plusDI = ch->dx = ch->sumDX = ch->prevADX = 0.0;
+      }
+      chainOf[f] = c;
+
+      switch( f )
+      {
+      case DM_ALL_ATR:
+      case DM_ALL_NATR:
+         ch->doATR = 1;
+         break;
+      case DM_ALL_PLUS_DI:
+      case DM_ALL_MINUS_DI:
+         ch->doDI = 1;
+         break;
+      case DM_ALL_DX:
+         ch->doDI = ch->doDX = 1;
+         break;
+      case DM_ALL_ADX:
+      case DM_ALL_ADXR:
+         ch->doDI = ch->doDX = ch->doADX = 1;
+         break;
+      }
+   }
+
+   if( outADXR )
+   {
+      CIRCBUF_INIT(adxBuffer,double,optInTimePeriod-1);
+   }
+   else
+   {
+      CIRCBUF_INIT_LOCAL_ONLY(adxBuffer,double);
+   }
+
+   /* The true range and the one period DM are calculated once
+    * per bar from the first bar needed by any chain. Each chain
+    * adds up its first (optInTimePeriod-1) DM and TR, then does
+    * the Wilder's smoothing (see ta_ADX.c). For the ATR, the
+    * first value is the average of the first optInTimePeriod TR
+    * (see ta_ATR.c).
+    */
+   today     = startIdx - lookbackTotal;
+   prevHigh  = DM_PRICE(inHigh,today);
+   prevLow   = DM_PRICE(inLow,today);
+   prevClose = DM_PRICE(inClose,today);
+   outIdx    = 0;
+   while( today < endIdx )
+   {
+      today++;
+
+      /* Read all the inputs of today before writing any
+       * output (the outputs can be the same as the inputs).
+       */
+      todayHigh  = DM_PRICE(inHigh,today);
+      todayLow   = DM_PRICE(inLow,today);
+      todayClose = DM_PRICE(inClose,today);
+
+      diffP    = todayHigh-prevHigh; /* Plus Delta */
+      prevHigh = todayHigh;
+      diffM    = prevLow-todayLow;   /* Minus Delta */
+      prevLow  = todayLow;
+
+      plusDM1  = TA_PLUS_DM1(diffP,diffM);
+      minusDM1 = TA_MINUS_DM1(diffP,diffM);
+
+      TRUE_RANGE(prevHigh,prevLow,prevClose,trueRange);
+      prevClose = todayClose;
+
+      for( c=0; c < nbChain; c++ )
+      {
+         ch = &chain[c];
+         if( today <= ch->firstIdx )
+            continue;
+
+         if( today < ch->firstIdx+optInTimePeriod )
+         {
+            /* Add up the initial DM and TR. */
+            ch->prevMinusDM += minusDM1;
+            ch->prevPlusDM  += plusDM1;
+            ch->prevTR      += trueRange;
+            continue;
+         }
+
+         if( ch->doATR )
+         {
+            if( today == ch->firstIdx+optInTimePeriod )
+               ch->prevATR = (ch->prevTR+trueRange)/optInTimePeriod;
+            else
+               ch->prevATR = TA_WILDER_STEP(ch->prevATR,trueRange,optInTimePeriod);
+         }
+
+         ch->prevMinusDM = TA_WILDER_SUM_STEP(ch->prevMinusDM,minusDM1,optInTimePeriod);
+         ch->prevPlusDM  = TA_WILDER_SUM_STEP(ch->prevPlusDM,plusDM1,optInTimePeriod);
+         ch->prevTR      = TA_WILDER_SUM_STEP(ch->prevTR,trueRange,optInTimePeriod);
+
+         if( !ch->doDI )
+            continue;
+
+         /* Calculate the DI and the DX. When the DX can't be
+          * calculated, the DX output repeats the previous value
+          * (0 for the first output) and the ADX is unchanged.
+          */
+         ch->minusDI = 0.0;
+         ch->plusDI  = 0.0;
+         dxIsValid   = 0;
+         if( !TA_IS_ZERO(ch->prevTR) )
+         {
+            ch->minusDI = 100.0*(ch->prevMinusDM/ch->prevTR);
+            ch->plusDI  = 100.0*(ch->prevPlusDM/ch->prevTR);
+            if( ch->doDX )
+            {
+               tempReal = ch->minusDI+ch->plusDI;
+               if( !TA_IS_ZERO(tempReal) )
+               {
+                  ch->dx = 100.0*(std_fabs(ch->minusDI-ch->plusDI)/tempReal);
+                  dxIsValid = 1;
+               }
+            }
+         }
+         if( !dxIsValid && (today == startIdx) )
+            ch->dx = 0.0;
+
+         if( ch->doADX )
+         {
+            if( today <= ch->firstADXIdx )
+            {
+               /* Add up all the initial DX. */
+               if( dxIsValid )
+                  ch->sumDX += ch->dx;
+               if( today == ch->firstADXIdx )
+                  ch->prevADX = ch->sumDX / optInTimePeriod;
+            }
+            else if( dxIsValid )
+               ch->prevADX = ((ch->prevADX*(optInTimePeriod-1))+ch->dx)/optInTimePeriod;
+         }
+      }
+
+      if( today >= startIdx )
+      {
+         #define DM_CHAIN(f) (&chain[chainOf[f]])
+         if( outTrueRange ) outTrueRange[outIdx] = trueRange;
+         if( outATR ) outATR[outIdx] = DM_CHAIN(DM_ALL_ATR)->prevATR;
+         if( outNATR )
+         {
+            if( !TA_IS_ZERO(todayClose) )
+               outNATR[outIdx] = (DM_CHAIN(DM_ALL_NATR)->prevATR/todayClose)*100.0;
+            else
+               outNATR[outIdx] = 0.0;
+         }
+         if( outPlusDM  ) outPlusDM[outIdx]  = DM_CHAIN(DM_ALL_PLUS_DM)->prevPlusDM;
+         if( outMinusDM ) outMinusDM[outIdx] = DM_CHAIN(DM_ALL_MINUS_DM)->prevMinusDM;
+         if( outPlusDI  ) outPlusDI[outIdx]  = DM_CHAIN(DM_ALL_PLUS_DI)->plusDI;
+         if( outMinusDI ) outMinusDI[outIdx] = DM_CHAIN(DM_ALL_MINUS_DI)->minusDI;
+         if( outDX      ) outDX[outIdx]      = DM_CHAIN(DM_ALL_DX)->dx;
+         if( outADX     ) outADX[outIdx]     = DM_CHAIN(DM_ALL_ADX)->prevADX;
+         if( outADXR    ) outADXR[outIdx]    = (DM_CHAIN(DM_ALL_ADXR)->prevADX+adxBuffer[adxBuffer_Idx])/2.0;
+         outIdx++;
+      }
+
+      /* Remember the ADX needed by the ADXR. */
+      if( outADXR && (today >= DM_CHAIN(DM_ALL_ADXR)->firstADXIdx) )
+      {
+         adxBuffer[adxBuffer_Idx] = DM_CHAIN(DM_ALL_ADXR)->prevADX;
+         CIRCBUF_NEXT(adxBuffer);
+      }
+      #undef DM_CHAIN
+   }
+
+   if( outADXR )
+   {
+      CIRCBUF_DESTROY(adxBuffer);
+   }
+
+   *outBegIdx    = startIdx;
+   *outNBElement = outIdx;
+
+   return TA_SUCCESS;
+}
@@ -0,0 +1,545 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ */
+
+/* Description:
+ *   TA_F_XXX: functions with float input, float output and float
+ *   calculation (see ta_func_ext.h for the error bounds).
+ *
+ *   One rounding is enough for the element-wise functions. The sums
+ *   of SMA and the recursion of EMA would instead accumulate the
+ *   rounding errors over the series, so they are kept as an unevaluated
+ *   sum hi+lo of two float (Knuth's two-sum gives the exact rounding
+ *   error of each addition). The lo part is added back before each
+ *   output is rounded to a float.
+ *
+ *   The two-sum needs each operation to be rounded to float, which is
+ *   the case with SSE (x64 or -mfpmath=sse), but not with the x87
+ *   unit keeping more precision in its registers.
+ */
+
+/* A multiply-add fused by the compiler in some loops but not in others
+ * would give different outputs for TA_F_EMA and TA_F_EMA_PANEL.
+ */
+#if defined( __clang__ )
+   #pragma clang fp contract(off)
+#elif defined( __GNUC__ )
+   #pragma GCC optimize ("fp-contract=off")
+#endif
+
+/**** Headers ****/
+#include "ta_func_ext.h"
+#include "ta_memory.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+
+/* Check the parameters common to all the functions. */
+#define FLOAT_CHECK_PARAM() { \
+   if( startIdx < 0 ) \
+      return TA_OUT_OF_RANGE_START_INDEX; \
+   if( (endIdx < 0) || (endIdx < startIdx) ) \
+      return TA_OUT_OF_RANGE_END_INDEX; \
+   if( !outBegIdx || !outNBElement || !outReal ) \
+      return TA_BAD_PARAM; \
+}
+
+/* Same as the loop of the element-wise TA functions. */
+#define FLOAT_LOOP(expr) { \
+   for( i=startIdx, outIdx=0; i <= endIdx; i++, outIdx++ ) \
+      outReal[outIdx] = expr; \
+   *outBegIdx    = startIdx; \
+   *outNBElement = outIdx; \
+}
+
+/* a+b = s+e exactly. 's' must not be 'a' or 'b'. */
+#define FLOAT_TWO_SUM(a,b,s,e) { \
+   s  = (a)+(b); \
+   bb = s-(a); \
+   e  = ((a)-(s-bb))+((b)-bb); \
+}
+
+/* hi+lo += value, with |lo| kept below half an ulp of hi. */
+#define FLOAT_ADD(hi,lo,value) { \
+   FLOAT_TWO_SUM(hi,value,tempHi,tempLo); \
+   tempLo += lo; \
+   hi = tempHi+tempLo; \
+   lo = tempLo-(hi-tempHi); \
+}
+
+/* Same as TA_EMA_STEP for the value hi+lo. The input is
+ * compared to the whole value and the rounding error of
+ * the new value goes into lo.
+ */
+#define FLOAT_EMA_STEP(hi,lo,value) { \
+   tempLo = ((((value)-(hi))-(lo))*k)+(lo); \
+   FLOAT_TWO_SUM(hi,tempLo,tempHi,lo); \
+   hi = tempHi; \
+}
+
+/* Row of the bar 'idx' in a panel. */
+#define PANEL_ROW(panel,idx) (&(panel)[(size_t)(idx)*(size_t)stride])
+
+/**** Local functions declarations.    ****/
+/* None */
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_F_ADD( int    startIdx,
+                     int    endIdx,
+                     const float inReal0[],
+                     const float inReal1[],
+                     int          *outBegIdx,
+                     int          *outNBElement,
+                     float         outReal[] )
+{
+   int i, outIdx;
+
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      FLOAT_CHECK_PARAM();
+      if( !inReal0 || !inReal1 )
+         return TA_BAD_PARAM;
+   #endif
+
+   FLOAT_LOOP( inReal0[i]+inReal1[i] );
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_F_SUB( int    startIdx,
+                     int    endIdx,
+                     const float inReal0[],
+                     const float inReal1[],
+                     int          *outBegIdx,
+                     int          *outNBElement,
+                     float         outReal[] )
+{
+   int i, outIdx;
+
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      FLOAT_CHECK_PARAM();
+      if( !inReal0 || !inReal1 )
+         return TA_BAD_PARAM;
+   #endif
+
+   FLOAT_LOOP( inReal0[i]-inReal1[i] );
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_F_MULT( int    startIdx,
+                      int    endIdx,
+                      const float inReal0[],
+                      const float inReal1[],
+                      int          *outBegIdx,
+                      int          *outNBElement,
+                      float         outReal[] )
+{
+   int i, outIdx;
+
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      FLOAT_CHECK_PARAM();
+      if( !inReal0 || !inReal1 )
+         return TA_BAD_PARAM;
+   #endif
+
+   FLOAT_LOOP( inReal0[i]*inReal1[i] );
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_F_DIV( int    startIdx,
+                     int    endIdx,
+                     const float inReal0[],
+                     const float inReal1[],
+                     int          *outBegIdx,
+                     int          *outNBElement,
+                     float         outReal[] )
+{
+   int i, outIdx;
+
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      FLOAT_CHECK_PARAM();
+      if( !inReal0 || !inReal1 )
+         return TA_BAD_PARAM;
+   #endif
+
+   FLOAT_LOOP( inReal0[i]/inReal1[i] );
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_F_AVGPRICE( int    startIdx,
+                          int    endIdx,
+                          const float inOpen[],
+                          const float inHigh[],
+                          const float inLow[],
+                          const float inClose[],
+                          int          *outBegIdx,
+                          int          *outNBElement,
+                          float         outReal[] )
+{
+   int i, outIdx;
+
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      FLOAT_CHECK_PARAM();
+      if( !inOpen || !inHigh || !inLow || !inClose )
+         return TA_BAD_PARAM;
+   #endif
+
+   FLOAT_LOOP( (inHigh[i]+inLow[i]+inClose[i]+inOpen[i])/4.0f );
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_F_MEDPRICE( int    startIdx,
+                          int    endIdx,
+                          const float inHigh[],
+                          const float inLow[],
+                          int          *outBegIdx,
+                          int          *outNBElement,
+                          float         outReal[] )
+{
+   int i, outIdx;
+
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      FLOAT_CHECK_PARAM();
+      if( !inHigh || !inLow )
+         return TA_BAD_PARAM;
+   #endif
+
+   FLOAT_LOOP( (inHigh[i]+inLow[i])/2.0f );
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_F_TYPPRICE( int    startIdx,
+                          int    endIdx,
+                          const float inHigh[],
+                          const float inLow[],
+                          const float inClose[],
+                          int          *outBegIdx,
+                          int          *outNBElement,
+                          float         outReal[] )
+{
+   int i, outIdx;
+
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      FLOAT_CHECK_PARAM();
+      if( !inHigh || !inLow || !inClose )
+         return TA_BAD_PARAM;
+   #endif
+
+   FLOAT_LOOP( (inHigh[i]+inLow[i]+inClose[i])/3.0f );
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_F_WCLPRICE( int    startIdx,
+                          int    endIdx,
+                          const float inHigh[],
+                          const float inLow[],
+                          const float inClose[],
+                          int          *outBegIdx,
+                          int          *outNBElement,
+                          float         outReal[] )
+{
+   int i, outIdx;
+
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      FLOAT_CHECK_PARAM();
+      if( !inHigh || !inLow || !inClose )
+         return TA_BAD_PARAM;
+   #endif
+
+   FLOAT_LOOP( (inHigh[i]+inLow[i]+(inClose[i]*2.0f))/4.0f );
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_F_SMA( int    startIdx,
+                     int    endIdx,
+                     const float inReal[],
+                     int           optInTimePeriod, /* From 2 to 100000 */
+                     int          *outBegIdx,
+                     int          *outNBElement,
+                     float         outReal[] )
+{
+   float periodTotal, periodError, tempReal;
+   float tempHi, tempLo, bb;
+   int i, outIdx, trailingIdx, lookbackTotal;
+
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      FLOAT_CHECK_PARAM();
+      if( !inReal )
+         return TA_BAD_PARAM;
+      if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+         optInTimePeriod = 30;
+      else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+         return TA_BAD_PARAM;
+   #endif
+
+   *outBegIdx    = 0;
+   *outNBElement = 0;
+
+   lookbackTotal = TA_SMA_Lookback( optInTimePeriod );
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+   if( startIdx > endIdx )
+      return TA_SUCCESS;
+
+   /* Same loop as TA_INT_SMA, with the total of
+    * the period kept as periodTotal+periodError.
+    */
+   periodTotal = 0.0f;
+   periodError = 0.0f;
+   trailingIdx = startIdx-lookbackTotal;
+   i = trailingIdx;
+   while( i < startIdx )
+   {
+      FLOAT_ADD( periodTotal, periodError, inReal[i] );
+      i++;
+   }
+
+   /* inReal and outReal can be the same buffer. */
+   outIdx = 0;
+   do
+   {
+      FLOAT_ADD( periodTotal, periodError, inReal[i] );
+      i++;
+      tempReal = periodTotal+periodError;
+      FLOAT_ADD( periodTotal, periodError, -inReal[trailingIdx] );
+      trailingIdx++;
+      outReal[outIdx++] = tempReal/(float)optInTimePeriod;
+   } while( i <= endIdx );
+
+   *outBegIdx    = startIdx;
+   *outNBElement = outIdx;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_F_EMA( int    startIdx,
+                     int    endIdx,
+                     const float inReal[],
+                     int           optInTimePeriod, /* From 2 to 100000 */
+                     int          *outBegIdx,
+                     int          *outNBElement,
+                     float         outReal[] )
+{
+   float prevHi, prevLo, k;
+   float tempHi, tempLo, bb;
+   int today, outIdx, lookbackTotal;
+
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      FLOAT_CHECK_PARAM();
+      if( !inReal )
+         return TA_BAD_PARAM;
+      if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+         optInTimePeriod = 30;
+      else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+         return TA_BAD_PARAM;
+   #endif
+
+   *outBegIdx    = 0;
+   *outNBElement = 0;
+
+   lookbackTotal = TA_EMA_Lookback( optInTimePeriod );
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+   if( startIdx > endIdx )
+      return TA_SUCCESS;
+
+   /* Same seed as TA_INT_EMA. */
+   k = (float)PER_TO_K( optInTimePeriod );
+   prevHi = 0.0f;
+   prevLo = 0.0f;
+   if( TA_GLOBALS_COMPATIBILITY == TA_COMPATIBILITY_DEFAULT )
+   {
+      today = startIdx-lookbackTotal;
+      while( today < startIdx-lookbackTotal+optInTimePeriod )
+      {
+         FLOAT_ADD( prevHi, prevLo, inReal[today] );
+         today++;
+      }
+      prevHi = (prevHi+prevLo)/(float)optInTimePeriod;
+      prevLo = 0.0f;
+   }
+   else
+   {
+      prevHi = inReal[0];
+      today  = 1;
+   }
+
+   /* Skip the unstable period. */
+   while( today <= startIdx )
+   {
+      FLOAT_EMA_STEP( prevHi, prevLo, inReal[today] );
+      today++;
+   }
+
+   /* inReal and outReal can be the same buffer. */
+   outReal[0] = prevHi;
+   outIdx = 1;
+   while( today <= endIdx )
+   {
+      FLOAT_EMA_STEP( prevHi, prevLo, inReal[today] );
+      today++;
+      outReal[outIdx++] = prevHi;
+   }
+
+   *outBegIdx    = startIdx;
+   *outNBElement = outIdx;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_F_EMA_PANEL( int    startIdx,
+                           int    endIdx,
+                           int    nbSymbol,
+                           int    stride,
+                           const float inReal[],
+                           int           optInTimePeriod, /* From 2 to 100000 */
+                           int          *outBegIdx,
+                           int          *outNBElement,
+                           float         outReal[] )
+{
+   const float *in;
+   float *out, *prev;
+   float k, tempHi, tempLo, bb;
+   int i, s, today, outIdx, lookbackTotal;
+   ARRAY_VTYPE_REF(float,prevLo);
+
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      FLOAT_CHECK_PARAM();
+      if( !inReal || (nbSymbol < 1) || (stride < nbSymbol) )
+         return TA_BAD_PARAM;
+      if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+         optInTimePeriod = 30;
+      else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+         return TA_BAD_PARAM;
+   #endif
+
+   *outBegIdx    = 0;
+   *outNBElement = 0;
+
+   lookbackTotal = TA_EMA_Lookback( optInTimePeriod );
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+   if( startIdx > endIdx )
+      return TA_SUCCESS;
+
+   ARRAY_VTYPE_ALLOC(float,prevLo,nbSymbol);
+   if( !prevLo )
+      return TA_ALLOC_ERR;
+
+   /* Same as TA_F_EMA for each column, the hi part being
+    * the previous output row.
+    */
+   k    = (float)PER_TO_K( optInTimePeriod );
+   prev = outReal;
+   for( s=0; s < nbSymbol; s++ )
+   {
+      prev[s]   = 0.0f;
+      prevLo[s] = 0.0f;
+   }
+   if( TA_GLOBALS_COMPATIBILITY == TA_COMPATIBILITY_DEFAULT )
+   {
+      today = startIdx-lookbackTotal;
+      for( i=0; i < optInTimePeriod; i++ )
+      {
+         in = PANEL_ROW(inReal,today++);
+         for( s=0; s < nbSymbol; s++ )
+            FLOAT_ADD( prev[s], prevLo[s], in[s] );
+      }
+      for( s=0; s < nbSymbol; s++ )
+      {
+         prev[s]   = (prev[s]+prevLo[s])/(float)optInTimePeriod;
+         prevLo[s] = 0.0f;
+      }
+   }
+   else
+   {
+      for( s=0; s < nbSymbol; s++ )
+         prev[s] = inReal[s];
+      today = 1;
+   }
+
+   /* Skip the unstable period. */
+   while( today <= startIdx )
+   {
+      in = PANEL_ROW(inReal,today++);
+      for( s=0; s < nbSymbol; s++ )
+         FLOAT_EMA_STEP( prev[s], prevLo[s], in[s] );
+   }
+
+   outIdx = 1;
+   while( today <= endIdx )
+   {
+      in  = PANEL_ROW(inReal,today++);
+      out = PANEL_ROW(outReal,outIdx++);
+      for( s=0; s < nbSymbol; s++ )
+      {
+         out[s] = prev[s];
+         FLOAT_EMA_STEP( out[s], prevLo[s], in[s] );
+      }
+      prev = out;
+   }
+
+   ARRAY_VTYPE_FREE(float,prevLo);
+
+   *outBegIdx    = startIdx;
+   *outNBElement = outIdx;
+
+   return TA_SUCCESS;
+}
+
+/**** Local functions definitions.     ****/
+/* None */
@@ -0,0 +1,789 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ *  101826 MF   Start each output from the same bar as its function.
+ */
+
+/* Description:
+ *   Calculate all the outputs of the Hilbert Transform family
+ *   (HT_DCPERIOD, HT_DCPHASE, HT_PHASOR, HT_SINE, HT_TRENDLINE,
+ *   HT_TRENDMODE and MAMA) with a single pass of the price
+ *   smoother and of the Hilbert Transform.
+ *
+ *   The calculation is the one of the individual functions (see
+ *   ta_HT_TRENDMODE.c and ta_MAMA.c). These are unstable, so each
+ *   output must start its calculation at the same bar as its own
+ *   function would: the lookback of the function (with its unstable
+ *   period) before the first output. HT_DCPERIOD, HT_PHASOR and MAMA
+ *   also warm up the price smoother on 9 bars instead of 34.
+ *
+ *   The outputs starting at the same bar with the same warm-up share
+ *   a single pass (see htPass). With the default unstable periods,
+ *   there are two passes: one for HT_DCPHASE, HT_SINE, HT_TRENDLINE
+ *   and HT_TRENDMODE, one for HT_DCPERIOD, HT_PHASOR and MAMA.
+ *
+ *   Only the parts needed by the outputs of a pass are done, in
+ *   particular the dominant cycle phase (the most expensive part) is
+ *   skipped in the pass of HT_DCPERIOD, HT_PHASOR and MAMA.
+ */
+
+/**** Headers ****/
+#include <math.h>
+
+#include "ta_func_ext.h"
+#include "ta_memory.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+
+/* Only one of inReal and inRealFloat is not NULL. */
+#define HT_PRICE(idx) (inReal? inReal[idx] : (double)inRealFloat[idx])
+
+/* The functions calculated by TA_HT_ALL. */
+typedef enum
+{
+   HT_ALL_DCPERIOD,
+   HT_ALL_DCPHASE,
+   HT_ALL_PHASOR,
+   HT_ALL_SINE,
+   HT_ALL_TRENDLINE,
+   HT_ALL_TRENDMODE,
+   HT_ALL_MAMA,
+   HT_ALL_NB_FUNC
+} HtAllFunc;
+
+/**** Local functions declarations.    ****/
+static TA_RetCode htAll( int    startIdx,
+                         int    endIdx,
+                         const double inReal[],
+                         const float  inRealFloat[],
+                         double        optInFastLimit,
+                         double        optInSlowLimit,
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double        outDCPeriod[],
+                         double        outDCPhase[],
+                         double        outInPhase[],
+                         double        outQuadrature[],
+                         double        outSine[],
+                         double        outLeadSine[],
+                         double        outTrendline[],
+                         int           outTrendMode[],
+                         double        outMAMA[],
+                         double        outFAMA[] );
+
+static void htPass( int    firstIdx,
+                    int    nbWarmup,
+                    int    startIdx,
+                    int    endIdx,
+                    const double inReal[],
+                    const float  inRealFloat[],
+                    double        optInFastLimit,
+                    double        optInSlowLimit,
+                    double        outDCPeriod[],
+                    double        outDCPhase[],
+                    double        outInPhase[],
+                    double        outQuadrature[],
+                    double        outSine[],
+                    double        outLeadSine[],
+                    double        outTrendline[],
+                    int           outTrendMode[],
+                    double        outMAMA[],
+                    double        outFAMA[] );
+
+/**** Local variables definitions.     ****/
+
+/* Number of bars on which each function warms up its price
+ * smoother, after the first 3 bars.
+ */
+static const int htAllWarmup[HT_ALL_NB_FUNC] = { 9, 34, 9, 34, 34, 34, 9 };
+
+/**** Global functions definitions.   ****/
+int TA_HT_ALL_Lookback( double optInFastLimit, double optInSlowLimit )
+{
+   int lookback, tempInt;
+
+   /* All the outputs start at the longest lookback. */
+   lookback = TA_HT_DCPHASE_Lookback();
+   tempInt = TA_HT_SINE_Lookback();
+   if( tempInt > lookback ) lookback = tempInt;
+   tempInt = TA_HT_TRENDLINE_Lookback();
+   if( tempInt > lookback ) lookback = tempInt;
+   tempInt = TA_HT_TRENDMODE_Lookback();
+   if( tempInt > lookback ) lookback = tempInt;
+   tempInt = TA_HT_DCPERIOD_Lookback();
+   if( tempInt > lookback ) lookback = tempInt;
+   tempInt = TA_HT_PHASOR_Lookback();
+   if( tempInt > lookback ) lookback = tempInt;
+   tempInt = TA_MAMA_Lookback( optInFastLimit, optInSlowLimit );
+   if( tempInt < 0 )
+      return -1;
+   if( tempInt > lookback ) lookback = tempInt;
+
+   return lookback;
+}
+
+TA_RetCode TA_HT_ALL( int    startIdx,
+                      int    endIdx,
+                      const double inReal[],
+                      double        optInFastLimit,
+                      double        optInSlowLimit,
+                      int          *outBegIdx,
+                      int          *outNBElement,
+                      double        outDCPeriod[],
+                      double        outDCPhase[],
+                      double        outInPhase[],
+                      double        outQuadrature[],
+                      double        outSine[],
+                      double        outLeadSine[],
+                      double        outTrendline[],
+                      int           outTrendMode[],
+                      double        outMAMA[],
+                      double        outFAMA[] )
+{
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      if( !inReal )
+         return TA_BAD_PARAM;
+   #endif
+
+   return htAll( startIdx, endIdx, inReal, NULL,
+                 optInFastLimit, optInSlowLimit,
+                 outBegIdx, outNBElement,
+                 outDCPeriod, outDCPhase, outInPhase, outQuadrature,
+                 outSine, outLeadSine, outTrendline, outTrendMode,
+                 outMAMA, outFAMA );
+}
+
+TA_RetCode TA_S_HT_ALL( int    startIdx,
+                        int    endIdx,
+                        const float  inReal[],
+                        double        optInFastLimit,
+                        double        optInSlowLimit,
+                        int          *outBegIdx,
+                        int          *outNBElement,
+                        double        outDCPeriod[],
+                        double        outDCPhase[],
+                        double        outInPhase[],
+                        double        outQuadrature[],
+                        double        outSine[],
+                        double        outLeadSine[],
+                        double        outTrendline[],
+                        int           outTrendMode[],
+                        double        outMAMA[],
+                        double        outFAMA[] )
+{
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      if( !inReal )
+         return TA_BAD_PARAM;
+   #endif
+
+   return htAll( startIdx, endIdx, NULL, inReal,
+                 optInFastLimit, optInSlowLimit,
+                 outBegIdx, outNBElement,
+                 outDCPeriod, outDCPhase, outInPhase, outQuadrature,
+                 outSine, outLeadSine, outTrendline, outTrendMode,
+                 outMAMA, outFAMA );
+}
+
+/**** Local functions definitions.     ****/
+static TA_RetCode htAll( int    startIdx,
+                         int    endIdx,
+                         const double inReal[],
+                         const float  inRealFloat[],
+                         double        optInFastLimit,
+                         double        optInSlowLimit,
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double        outDCPeriod[],
+                         double        outDCPhase[],
+                         double        outInPhase[],
+                         double        outQuadrature[],
+                         double        outSine[],
+                         double        outLeadSine[],
+                         double        outTrendline[],
+                         int           outTrendMode[],
+                         double        outMAMA[],
+                         double        outFAMA[] )
+{
+   int lookbackTotal, f, g, p, nbPass, lastPass;
+   int lookback[HT_ALL_NB_FUNC];
+   int isRequested[HT_ALL_NB_FUNC];
+   int isOverInput[HT_ALL_NB_FUNC];
+   int passOf[HT_ALL_NB_FUNC];
+   int passFunc[HT_ALL_NB_FUNC];
+
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      if( startIdx < 0 )
+         return TA_OUT_OF_RANGE_START_INDEX;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return TA_OUT_OF_RANGE_END_INDEX;
+      if( optInFastLimit == TA_REAL_DEFAULT )
+         optInFastLimit = 5.000000e-1;
+      else if( (optInFastLimit < 1.000000e-2) || (optInFastLimit > 9.900000e-1) )
+         return TA_BAD_PARAM;
+      if( optInSlowLimit == TA_REAL_DEFAULT )
+         optInSlowLimit = 5.000000e-2;
+      else if( (optInSlowLimit < 1.000000e-2) || (optInSlowLimit > 9.900000e-1) )
+         return TA_BAD_PARAM;
+      if( !outBegIdx || !outNBElement )
+         return TA_BAD_PARAM;
+      if( !outDCPeriod && !outDCPhase && !outInPhase && !outQuadrature &&
+          !outSine && !outLeadSine && !outTrendline && !outTrendMode &&
+          !outMAMA && !outFAMA )
+         return TA_BAD_PARAM;
+   #endif
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = TA_HT_ALL_Lookback( optInFastLimit, optInSlowLimit );
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      *outBegIdx    = 0;
+      *outNBElement = 0;
+      return TA_SUCCESS;
+   }
+
+   lookback[HT_ALL_DCPERIOD]  = TA_HT_DCPERIOD_Lookback();
+   lookback[HT_ALL_DCPHASE]   = TA_HT_DCPHASE_Lookback();
+   lookback[HT_ALL_PHASOR]    = TA_HT_PHASOR_Lookback();
+   lookback[HT_ALL_SINE]      = TA_HT_SINE_Lookback();
+   lookback[HT_ALL_TRENDLINE] = TA_HT_TRENDLINE_Lookback();
+   lookback[HT_ALL_TRENDMODE] = TA_HT_TRENDMODE_Lookback();
+   lookback[HT_ALL_MAMA]      = TA_MAMA_Lookback( optInFastLimit, optInSlowLimit );
+
+   isRequested[HT_ALL_DCPERIOD]  = outDCPeriod != NULL;
+   isRequested[HT_ALL_DCPHASE]   = outDCPhase != NULL;
+   isRequested[HT_ALL_PHASOR]    = (outInPhase != NULL) || (outQuadrature != NULL);
+   isRequested[HT_ALL_SINE]      = (outSine != NULL) || (outLeadSine != NULL);
+   isRequested[HT_ALL_TRENDLINE] = outTrendline != NULL;
+   isRequested[HT_ALL_TRENDMODE] = outTrendMode != NULL;
+   isRequested[HT_ALL_MAMA]      = (outMAMA != NULL) || (outFAMA != NULL);
+
+   /* An output can be the input buffer (only for double). */
+   #define HT_IS_INPUT(out) (inReal && ((const void *)(out) == (const void *)inReal))
+   isOverInput[HT_ALL_DCPERIOD]  = HT_IS_INPUT(outDCPeriod);
+   isOverInput[HT_ALL_DCPHASE]   = HT_IS_INPUT(outDCPhase);
+   isOverInput[HT_ALL_PHASOR]    = HT_IS_INPUT(outInPhase) || HT_IS_INPUT(outQuadrature);
+   isOverInput[HT_ALL_SINE]      = HT_IS_INPUT(outSine) || HT_IS_INPUT(outLeadSine);
+   isOverInput[HT_ALL_TRENDLINE] = HT_IS_INPUT(outTrendline);
+   isOverInput[HT_ALL_TRENDMODE] = HT_IS_INPUT(outTrendMode);
+   isOverInput[HT_ALL_MAMA]      = HT_IS_INPUT(outMAMA) || HT_IS_INPUT(outFAMA);
+   #undef HT_IS_INPUT
+
+   /* One pass is done for each distinct starting bar and warm-up
+    * among the requested functions.
+    */
+   nbPass   = 0;
+   lastPass = -1;
+   for( f=0; f < HT_ALL_NB_FUNC; f++ )
+   {
+      passOf[f] = -1;
+      if( !isRequested[f] )
+         continue;
+
+      for( g=0; g < f; g++ )
+      {
+         if( (passOf[g] >= 0) &&
+             (lookback[g] == lookback[f]) &&
+             (htAllWarmup[g] == htAllWarmup[f]) )
+         {
+            passOf[f] = passOf[g];
+            break;
+         }
+      }
+
+      if( passOf[f] < 0 )
+      {
+         passFunc[nbPass] = f;
+         passOf[f] = nbPass++;
+      }
+
+      if( isOverInput[f] )
+         lastPass = passOf[f];
+   }
+
+   /* The other passes read the input again from an earlier bar, so
+    * the pass writing over the input must be the last one.
+    */
+   if( (lastPass >= 0) && (lastPass != nbPass-1) )
+   {
+      for( f=0; f < HT_ALL_NB_FUNC; f++ )
+      {
+         if( passOf[f] == lastPass )
+            passOf[f] = nbPass-1;
+         else if( passOf[f] == nbPass-1 )
+            passOf[f] = lastPass;
+      }
+      f = passFunc[lastPass];
+      passFunc[lastPass] = passFunc[nbPass-1];
+      passFunc[nbPass-1] = f;
+   }
+
+   for( p=0; p < nbPass; p++ )
+   {
+      f = passFunc[p];
+      htPass( startIdx-lookback[f], htAllWarmup[f], startIdx, endIdx,
+              inReal, inRealFloat, optInFastLimit, optInSlowLimit,
+              (passOf[HT_ALL_DCPERIOD]  == p)? outDCPeriod   : NULL,
+              (passOf[HT_ALL_DCPHASE]   == p)? outDCPhase    : NULL,
+              (passOf[HT_ALL_PHASOR]    == p)? outInPhase    : NULL,
+              (passOf[HT_ALL_PHASOR]    == p)? outQuadrature : NULL,
+              (passOf[HT_ALL_SINE]      == p)? outSine       : NULL,
+              (passOf[HT_ALL_SINE]      == p)? outLeadSine   : NULL,
+              (passOf[HT_ALL_TRENDLINE] == p)? outTrendline  : NULL,
+              (passOf[HT_ALL_TRENDMODE] == p)? outTrendMode  : NULL,
+              (passOf[HT_ALL_MAMA]      == p)? outMAMA       : NULL,
+              (passOf[HT_ALL_MAMA]      == p)? outFAMA       : NULL );
+   }
+
+   *outBegIdx    = startIdx;
+   *outNBElement = endIdx-startIdx+1;
+
+   return TA_SUCCESS;
+}
+
+/* Calculates the outputs that are not NULL for the bars from startIdx
+ * to endIdx. The calculation starts at firstIdx, with the price
+ * smoother warmed up on nbWarmup bars after the first 3 bars.
+ */
+static void htPass( int    firstIdx,
+                    int    nbWarmup,
+                    int    startIdx,
+                    int    endIdx,
+                    const double inReal[],
+                    const float  inRealFloat[],
+                    double        optInFastLimit,
+                    double        optInSlowLimit,
+                    double        outDCPeriod[],
+                    double        outDCPhase[],
+                    double        outInPhase[],
+                    double        outQuadrature[],
+                    double        outSine[],
+                    double        outLeadSine[],
+                    double        outTrendline[],
+                    int           outTrendMode[],
+                    double        outMAMA[],
+                    double        outFAMA[] )
+{
+   int outIdx, i;
+   int today;
+   double tempReal, tempReal2;
+
+   double adjustedPrevPeriod, period;
+
+   /* Variable used for the price smoother (a weighted moving average). */
+   int trailingWMAIdx;
+   double periodWMASum, periodWMASub, trailingWMAValue;
+   double smoothedValue;
+
+   /* Variable to keep track of the last 3 ITrend */
+   double iTrend1, iTrend2, iTrend3;
+
+   /* Variables used for the Hilbert Transormation */
+   CONSTANT_DOUBLE(a) = 0.0962;
+   CONSTANT_DOUBLE(b) = 0.5769;
+   double hilbertTempReal;
+   int hilbertIdx;
+
+   HILBERT_VARIABLES( detrender );
+   HILBERT_VARIABLES( Q1 );
+   HILBERT_VARIABLES( jI );
+   HILBERT_VARIABLES( jQ );
+
+   double Q2, I2, prevQ2, prevI2, Re, Im;
+
+   double I1ForOddPrev2,  I1ForOddPrev3;
+   double I1ForEvenPrev2, I1ForEvenPrev3;
+   double I1;
+
+   double rad2Deg, deg2Rad, constDeg2RadBy360;
+
+   double todayValue, smoothPeriod;
+
+   /* Variable used to keep track of the previous
+    * smooth price. In the case of this algorithm,
+    * we will never need more than 50 values.
+    */
+   #define SMOOTH_PRICE_SIZE 50
+   CIRCBUF_PROLOG(smoothPrice,double,SMOOTH_PRICE_SIZE);
+   int idx;
+
+   /* Variable used to calculate the dominant cycle phase */
+   int DCPeriodInt;
+   double DCPhase, DCPeriod, imagPart, realPart;
+
+   /* Variable used to calculate the trend mode */
+   int daysInTrend, trend;
+   double prevDCPhase, trendline;
+   double prevSine, prevLeadSine, sine, leadSine;
+
+   /* Variable used to calculate MAMA */
+   double mama, fama, prevPhase;
+
+   /* Which part of the calculation is needed. */
+   int doPhase, doTrendline, doMAMA;
+
+   doPhase     = outDCPhase || outSine || outLeadSine || outTrendMode;
+   doTrendline = outTrendline || outTrendMode;
+   doMAMA      = outMAMA || outFAMA;
+
+   CIRCBUF_INIT_LOCAL_ONLY(smoothPrice,double);
+
+   iTrend1 = iTrend2 = iTrend3 = 0.0;
+   daysInTrend  = 0;
+   prevDCPhase  = DCPhase  = 0.0;
+   prevSine     = sine     = 0.0;
+   prevLeadSine = leadSine = 0.0;
+   trendline    = 0.0;
+   mama         = fama     = 0.0;
+   prevPhase    = 0.0;
+
+   /* The following could be replaced by constant eventually. */
+   tempReal = std_atan(1);
+   rad2Deg = 45.0/tempReal;
+   deg2Rad = 1.0/rad2Deg;
+   constDeg2RadBy360 = tempReal*8.0;
+
+   /* Initialize the price smoother, which is simply a weighted
+    * moving average of the price.
+    */
+   trailingWMAIdx = firstIdx;
+   today = trailingWMAIdx;
+
+   tempReal = HT_PRICE(today); today++;
+   periodWMASub = tempReal;
+   periodWMASum = tempReal;
+   tempReal = HT_PRICE(today); today++;
+   periodWMASub += tempReal;
+   periodWMASum += tempReal*2.0;
+   tempReal = HT_PRICE(today); today++;
+   periodWMASub += tempReal;
+   periodWMASum += tempReal*3.0;
+
+   trailingWMAValue = 0.0;
+
+   #define DO_PRICE_WMA(varNewPrice,varToStoreSmoothedValue) { \
+      periodWMASub     += varNewPrice; \
+      periodWMASub     -= trailingWMAValue; \
+      periodWMASum     += varNewPrice*4.0; \
+      trailingWMAValue  = HT_PRICE(trailingWMAIdx); \
+      trailingWMAIdx++; \
+      varToStoreSmoothedValue = periodWMASum*0.1; \
+      periodWMASum -= periodWMASub; \
+   }
+
+   i = nbWarmup;
+   do
+   {
+      tempReal = HT_PRICE(today); today++;
+      DO_PRICE_WMA(tempReal,smoothedValue);
+   } while( --i != 0);
+
+   hilbertIdx = 0;
+
+   INIT_HILBERT_VARIABLES(detrender);
+   INIT_HILBERT_VARIABLES(Q1);
+   INIT_HILBERT_VARIABLES(jI);
+   INIT_HILBERT_VARIABLES(jQ);
+
+   period = 0.0;
+   outIdx = 0;
+
+   prevI2 = prevQ2 = 0.0;
+   Re     = Im     = 0.0;
+   I1ForOddPrev3 = I1ForEvenPrev3 = 0.0;
+   I1ForOddPrev2 = I1ForEvenPrev2 = 0.0;
+   smoothPeriod  = 0.0;
+
+   for( i=0; i < SMOOTH_PRICE_SIZE; i++ )
+      smoothPrice[i] = 0.0;
+
+   while( today <= endIdx )
+   {
+      adjustedPrevPeriod = (0.075*period)+0.54;
+
+      todayValue = HT_PRICE(today);
+      DO_PRICE_WMA(todayValue,smoothedValue);
+
+      /* Remember the smoothedValue into the smoothPrice
+       * circular buffer.
+       */
+      smoothPrice[smoothPrice_Idx] = smoothedValue;
+
+      if( (today%2) == 0 )
+      {
+         /* Do the Hilbert Transforms for even price bar */
+         DO_HILBERT_EVEN(detrender,smoothedValue);
+         DO_HILBERT_EVEN(Q1,detrender);
+         DO_HILBERT_EVEN(jI,I1ForEvenPrev3);
+         DO_HILBERT_EVEN(jQ,Q1);
+         if( ++hilbertIdx == 3 )
+            hilbertIdx = 0;
+
+         Q2 = (0.2*(Q1 + jI)) + (0.8*prevQ2);
+         I2 = (0.2*(I1ForEvenPrev3 - jQ)) + (0.8*prevI2);
+
+         /* The variable I1 is the detrender delayed for
+          * 3 price bars.
+          */
+         I1 = I1ForEvenPrev3;
+         I1ForOddPrev3 = I1ForOddPrev2;
+         I1ForOddPrev2 = detrender;
+      }
+      else
+      {
+         /* Do the Hilbert Transforms for odd price bar */
+         DO_HILBERT_ODD(detrender,smoothedValue);
+         DO_HILBERT_ODD(Q1,detrender);
+         DO_HILBERT_ODD(jI,I1ForOddPrev3);
+         DO_HILBERT_ODD(jQ,Q1);
+
+         Q2 = (0.2*(Q1 + jI)) + (0.8*prevQ2);
+         I2 = (0.2*(I1ForOddPrev3 - jQ)) + (0.8*prevI2);
+
+         I1 = I1ForOddPrev3;
+         I1ForEvenPrev3 = I1ForEvenPrev2;
+         I1ForEvenPrev2 = detrender;
+      }
+
+      if( doMAMA )
+      {
+         /* Put Alpha in tempReal2 */
+         if( I1 != 0.0 )
+            tempReal2 = (std_atan(Q1/I1)*rad2Deg);
+         else
+            tempReal2 = 0.0;
+
+         /* Put Delta Phase into tempReal */
+         tempReal  = prevPhase - tempReal2;
+         prevPhase = tempReal2;
+         if( tempReal < 1.0 )
+            tempReal = 1.0;
+
+         /* Put Alpha into tempReal */
+         if( tempReal > 1.0 )
+         {
+            tempReal = optInFastLimit/tempReal;
+            if( tempReal < optInSlowLimit )
+               tempReal = optInSlowLimit;
+         }
+         else
+         {
+            tempReal = optInFastLimit;
+         }
+
+         /* Calculate MAMA, FAMA */
+         mama = (tempReal*todayValue)+((1-tempReal)*mama);
+         tempReal *= 0.5;
+         fama = (tempReal*mama)+((1-tempReal)*fama);
+      }
+
+      /* Adjust the period for next price bar */
+      Re = (0.2*((I2*prevI2)+(Q2*prevQ2)))+(0.8*Re);
+      Im = (0.2*((I2*prevQ2)-(Q2*prevI2)))+(0.8*Im);
+      prevQ2 = Q2;
+      prevI2 = I2;
+      tempReal = period;
+      if( (Im != 0.0) && (Re != 0.0) )
+         period = 360.0 / (std_atan(Im/Re)*rad2Deg);
+      tempReal2 = 1.5*tempReal;
+      if( period > tempReal2)
+         period = tempReal2;
+      tempReal2 = 0.67*tempReal;
+      if( period < tempReal2 )
+         period = tempReal2;
+      if( period < 6 )
+         period = 6;
+      else if( period > 50 )
+         period = 50;
+      period = (0.2*period) + (0.8 * tempReal);
+
+      smoothPeriod = (0.33*period)+(0.67*smoothPeriod);
+
+      if( doPhase )
+      {
+         /* Compute Dominant Cycle Phase */
+         prevDCPhase = DCPhase;
+         DCPeriod    = smoothPeriod+0.5;
+         DCPeriodInt = (int)DCPeriod;
+         realPart = 0.0;
+         imagPart = 0.0;
+
+         /* idx is used to iterate for up to 50 of the last
+          * value of smoothPrice.
+          */
+         idx = smoothPrice_Idx;
+         for( i=0; i < DCPeriodInt; i++ )
+         {
+            tempReal  = ((double)i*constDeg2RadBy360)/(double)DCPeriodInt;
+            tempReal2 = smoothPrice[idx];
+            realPart += std_sin(tempReal)*tempReal2;
+            imagPart += std_cos(tempReal)*tempReal2;
+            if( idx == 0 )
+               idx = SMOOTH_PRICE_SIZE-1;
+            else
+               idx--;
+         }
+
+         tempReal = std_fabs(imagPart);
+         if( tempReal > 0.0 )
+            DCPhase = std_atan(realPart/imagPart)*rad2Deg;
+         else if( tempReal <= 0.01 )
+         {
+            if( realPart < 0.0 )
+               DCPhase -= 90.0;
+            else if( realPart > 0.0 )
+               DCPhase += 90.0;
+         }
+         DCPhase += 90.0;
+
+         /* Compensate for one bar lag of the weighted moving average */
+         DCPhase += 360.0 / smoothPeriod;
+         if( imagPart < 0.0 )
+            DCPhase += 180.0;
+         if( DCPhase > 315.0 )
+            DCPhase -= 360.0;
+
+         prevSine     = sine;
+         prevLeadSine = leadSine;
+         sine     = std_sin(DCPhase*deg2Rad);
+         leadSine = std_sin((DCPhase+45)*deg2Rad);
+      }
+
+      if( doTrendline )
+      {
+         /* Compute Trendline */
+         DCPeriod    = smoothPeriod+0.5;
+         DCPeriodInt = (int)DCPeriod;
+
+         idx = today;
+         tempReal = 0.0;
+         for( i=0; i < DCPeriodInt; i++ )
+         {
+            tempReal += HT_PRICE(idx);
+            idx--;
+         }
+
+         if( DCPeriodInt > 0 )
+            tempReal = tempReal/(double)DCPeriodInt;
+
+         trendline = (4.0*tempReal + 3.0*iTrend1 + 2.0*iTrend2 + iTrend3) / 10.0;
+         iTrend3   = iTrend2;
+         iTrend2   = iTrend1;
+         iTrend1   = tempReal;
+      }
+
+      if( outTrendMode )
+      {
+         /* Compute the trend Mode , and assume trend by default */
+         trend = 1;
+
+         /* Measure days in trend from last crossing of the SineWave Indicator lines */
+         if( ((sine > leadSine) && (prevSine <= prevLeadSine)) ||
+             ((sine < leadSine) && (prevSine >= prevLeadSine)) )
+         {
+            daysInTrend = 0;
+            trend = 0;
+         }
+
+         daysInTrend++;
+
+         if( daysInTrend < (0.5*smoothPeriod) )
+            trend = 0;
+
+         tempReal = DCPhase - prevDCPhase;
+         if( (smoothPeriod != 0.0) &&
+             ((tempReal > (0.67*360.0/smoothPeriod)) && (tempReal < (1.5*360.0/smoothPeriod))) )
+         {
+            trend = 0;
+         }
+
+         tempReal = smoothPrice[smoothPrice_Idx];
+         if( (trendline != 0.0) && (std_fabs( (tempReal - trendline)/trendline ) >= 0.015) )
+            trend = 1;
+      }
+      else
+         trend = 0;
+
+      if( today >= startIdx )
+      {
+         if( outDCPeriod )   outDCPeriod[outIdx]   = smoothPeriod;
+         if( outDCPhase )    outDCPhase[outIdx]    = DCPhase;
+         if( outInPhase )    outInPhase[outIdx]    = I1;
+         if( outQuadrature ) outQuadrature[outIdx] = Q1;
+         if( outSine )       outSine[outIdx]       = sine;
+         if( outLeadSine )   outLeadSine[outIdx]   = leadSine;
+         if( outTrendline )  outTrendline[outIdx]  = trendline;
+         if( outTrendMode )  outTrendMode[outIdx]  = trend;
+         if( outMAMA )       outMAMA[outIdx]       = mama;
+         if( outFAMA )       outFAMA[outIdx]       = fama;
+         outIdx++;
+      }
+
+      /* Ooof... let's do the next price bar now! */
+      CIRCBUF_NEXT(smoothPrice);
+      today++;
+   }
+
+   #undef DO_PRICE_WMA
+}
@@ -0,0 +1,255 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ */
+
+/* Description:
+ *   Calculate all the outputs of the linear regression family
+ *   (LINEARREG, LINEARREG_SLOPE, LINEARREG_INTERCEPT, LINEARREG_ANGLE
+ *   and TSF) in a single pass.
+ *
+ *   The sums are maintained incrementally exactly like in the
+ *   individual functions (see ta_LINEARREG.c), so the outputs
+ *   are identical.
+ */
+
+/**** Headers ****/
+#include <math.h>
+
+#include "ta_func_ext.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+
+/* Loop shared by the double and float input variant. */
+#define LINEARREG_ALL_LOOP \
+   { \
+      while( today <= endIdx ) \
+      { \
+        if( today == anchorIdx ) \
+        { \
+          SumXY = 0; \
+          SumY = 0; \
+          for( i = optInTimePeriod; i-- != 0; ) \
+          { \
+            SumY += tempValue1 = inReal[today - i]; \
+            SumXY += (double)i * tempValue1; \
+          } \
+          anchorIdx = today+optInTimePeriod; \
+        } \
+        else \
+          SumY += inReal[today]; \
+        \
+        m = ( optInTimePeriod * SumXY - SumX * SumY) / Divisor; \
+        b = ( SumY - m * SumX ) / (double)optInTimePeriod; \
+        \
+        /* Must be read before writing the outputs. */ \
+        tempValue1 = inReal[trailingIdx++]; \
+        \
+        if( outLinearReg ) outLinearReg[outIdx] = b + m * (double)(optInTimePeriod-1); \
+        if( outSlope )     outSlope[outIdx]     = m; \
+        if( outIntercept ) outIntercept[outIdx] = b; \
+        if( outAngle )     outAngle[outIdx]     = std_atan(m) * ( 180.0 / PI ); \
+        if( outTSF )       outTSF[outIdx]       = b + m * (double)optInTimePeriod; \
+        outIdx++; \
+        \
+        SumXY += SumY - (double)optInTimePeriod * tempValue1; \
+        SumY  -= tempValue1; \
+        today++; \
+      } \
+   }
+
+/**** Local functions declarations.    ****/
+/* None */
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+int TA_LINEARREG_ALL_Lookback( int optInTimePeriod )
+{
+   return TA_LINEARREG_Lookback( optInTimePeriod );
+}
+
+TA_RetCode TA_LINEARREG_ALL( int    startIdx,
+                             int    endIdx,
+                             const double inReal[],
+                             int           optInTimePeriod,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outLinearReg[],
+                             double        outSlope[],
+                             double        outIntercept[],
+                             double        outAngle[],
+                             double        outTSF[] )
+{
+   int outIdx;
+   int today, trailingIdx, anchorIdx, lookbackTotal;
+   double SumX, SumXY, SumY, SumXSqr, Divisor;
+   double m, b;
+   int i;
+   double tempValue1;
+
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      if( startIdx < 0 )
+         return TA_OUT_OF_RANGE_START_INDEX;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return TA_OUT_OF_RANGE_END_INDEX;
+      if( !inReal )
+         return TA_BAD_PARAM;
+      if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+         optInTimePeriod = 14;
+      else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+         return TA_BAD_PARAM;
+      if( !outBegIdx || !outNBElement )
+         return TA_BAD_PARAM;
+      if( !outLinearReg && !outSlope && !outIntercept && !outAngle && !outTSF )
+         return TA_BAD_PARAM;
+   #endif
+
+   lookbackTotal = TA_LINEARREG_Lookback( optInTimePeriod );
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   if( startIdx > endIdx )
+   {
+      *outBegIdx    = 0;
+      *outNBElement = 0;
+      return TA_SUCCESS;
+   }
+
+   outIdx      = 0;
+   today       = startIdx;
+   trailingIdx = today-lookbackTotal;
+   anchorIdx   = today;
+   SumXY       = 0.0;
+   SumY        = 0.0;
+
+   SumX = optInTimePeriod * ( optInTimePeriod - 1 ) * 0.5;
+   SumXSqr = optInTimePeriod * ( optInTimePeriod - 1 ) * ( 2 * optInTimePeriod - 1 ) / 6;
+   Divisor = SumX * SumX - optInTimePeriod * SumXSqr;
+
+   LINEARREG_ALL_LOOP
+
+   *outBegIdx    = startIdx;
+   *outNBElement = outIdx;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_S_LINEARREG_ALL( int    startIdx,
+                               int    endIdx,
+                               const float  inReal[],
+                               int           optInTimePeriod,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outLinearReg[],
+                               double        outSlope[],
+                               double        outIntercept[],
+                               double        outAngle[],
+                               double        outTSF[] )
+{
+   int outIdx;
+   int today, trailingIdx, anchorIdx, lookbackTotal;
+   double SumX, SumXY, SumY, SumXSqr, Divisor;
+   double m, b;
+   int i;
+   double tempValue1;
+
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      if( startIdx < 0 )
+         return TA_OUT_OF_RANGE_START_INDEX;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return TA_OUT_OF_RANGE_END_INDEX;
+      if( !inReal )
+         return TA_BAD_PARAM;
+      if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+         optInTimePeriod = 14;
+      else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+         return TA_BAD_PARAM;
+      if( !outBegIdx || !outNBElement )
+         return TA_BAD_PARAM;
+      if( !outLinearReg && !outSlope && !outIntercept && !outAngle && !outTSF )
+         return TA_BAD_PARAM;
+   #endif
+
+   lookbackTotal = TA_LINEARREG_Lookback( optInTimePeriod );
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   if( startIdx > endIdx )
+   {
+      *outBegIdx    = 0;
+      *outNBElement = 0;
+      return TA_SUCCESS;
+   }
+
+   outIdx      = 0;
+   today       = startIdx;
+   trailingIdx = today-lookbackTotal;
+   anchorIdx   = today;
+   SumXY       = 0.0;
+   SumY        = 0.0;
+
+   SumX = optInTimePeriod * ( optInTimePeriod - 1 ) * 0.5;
+   SumXSqr = optInTimePeriod * ( optInTimePeriod - 1 ) * ( 2 * optInTimePeriod - 1 ) / 6;
+   Divisor = SumX * SumX - optInTimePeriod * SumXSqr;
+
+   LINEARREG_ALL_LOOP
+
+   *outBegIdx    = startIdx;
+   *outNBElement = outIdx;
+
+   return TA_SUCCESS;
+}
@@ -0,0 +1,927 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ */
+
+/* Description:
+ *   Calculate a moving average for many periods on the same input.
+ *
+ *   The SMA, WMA and TRIMA of any period are differences of
+ *   running sums of the input. For the relative index j of the
+ *   input x[j], these running sums are
+ *     S(k) = x[0]+...+x[k-1]
+ *     T(k) = S(0)+...+S(k-1)
+ *
+ *   For the window x[a+1]..x[e] of n values:
+ *     SMA   numerator = S(e+1)-S(a+1)
+ *
+ *   The WMA weights x[j] by (j-a), that is the number of S(e+1)-S(t)
+ *   including x[j] for t from a+1 to e:
+ *     WMA   numerator = n*S(e+1) - (T(e+1)-T(a+1))
+ *
+ *   The TRIMA is a SMA of h2 SMA of h1 values (h2=n/2+1 and h1=n+1-h2,
+ *   see ta_TRIMA.c), so its numerator is a sum of h2 differences of S:
+ *     TRIMA numerator = (T(e+2)-T(e+2-h2)) - (T(a+1+h2)-T(a+1))
+ *
+ *   The running sums are calculated only once for all the periods.
+ *   The rounding error of each running sum is accumulated separately
+ *   (TwoSum, same as ta_MAVP.c), this keeps the differences as
+ *   accurate as a direct sum even when the running sums become large.
+ *
+ *   The EMA, DEMA, TEMA, T3 and TRIX are recursive. For these, the
+ *   EMA of all the periods are advanced together for each input,
+ *   their state is kept side by side (one row of state per EMA level,
+ *   one column per period). The EMA of the EMA are done from the same
+ *   state, so there is no intermediate buffer of the length of the
+ *   input. Each period starts with the same seed as the function
+ *   called alone (see TA_INT_EMA and ta_T3.c), so the outputs are
+ *   identical.
+ */
+
+/**** Headers ****/
+#include "ta_func_ext.h"
+#include "ta_memory.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+
+/* Only one of inReal and inRealFloat is not NULL. */
+#define MA_PRICE(idx) (inReal? inReal[idx] : (double)inRealFloat[idx])
+
+/* The outputs are done by block of bars, for all the periods.
+ * This keeps in the cache the part of the running sums
+ * used by the block.
+ */
+#define MA_MULTI_BLOCK_SIZE 2048
+
+/* Add a value to a running sum, its rounding error is
+ * accumulated separately (TwoSum).
+ */
+#define SUM_ADD(value) { \
+   tempReal2    = periodTotal+value; \
+   tempReal3    = tempReal2-periodTotal; \
+   periodError += (periodTotal-(tempReal2-tempReal3))+(value-tempReal3); \
+   periodTotal  = tempReal2; \
+}
+
+/* Difference of a running sum (with its accumulated error)
+ * between two indexes.
+ */
+#define SUM_DIFF(sum,err,hiIdx,loIdx) \
+   (((sum)[hiIdx]-(sum)[loIdx])+((err)[hiIdx]-(err)[loIdx]))
+
+/* The EMA family handled by emaMulti. */
+typedef enum
+{
+   EMA_MULTI_EMA,
+   EMA_MULTI_DEMA,
+   EMA_MULTI_TEMA,
+   EMA_MULTI_T3,
+   EMA_MULTI_TRIX
+} EmaMultiType;
+
+/* State of emaMulti, one value per period in each row. Rows 0
+ * to 5 are the EMA levels, row 6 is the smoothing factor and
+ * row 7 is either (1-k) for the T3 or the previous EMA for the
+ * TRIX.
+ */
+#define EMA_MULTI_MAX_LEVEL 6
+#define EMA_MULTI_NB_ROW    8
+#define EMA_STATE(row,j)    state[((row)*nbActive)+(j)]
+
+/* The periods are advanced by group of EMA_MULTI_GROUP, all the
+ * bars of a group are done before the next group. The state of a
+ * group is in local arrays (the outputs cannot alias them), so
+ * the compiler can keep it in registers and vectorize the group.
+ * This also limits the number of output rows written together.
+ */
+#define EMA_MULTI_GROUP 8
+
+/* Same volume factor as TA_MA uses for the T3. */
+#define EMA_MULTI_T3_VFACTOR 0.7
+
+/**** Local functions declarations.    ****/
+static TA_RetCode checkMultiParam( int    startIdx,
+                                   int    endIdx,
+                                   const int     optInTimePeriods[],
+                                   int           optInNbPeriod,
+                                   int           optInMinPeriod,
+                                   int           outBegIdx[],
+                                   int           outNBElement[],
+                                   double        outReal[] );
+
+static TA_RetCode emaMulti( int    startIdx,
+                            int    endIdx,
+                            const double inReal[],
+                            const float  inRealFloat[],
+                            const int     optInTimePeriods[],
+                            int           optInNbPeriod,
+                            EmaMultiType  type,
+                            int           outBegIdx[],
+                            int           outNBElement[],
+                            double        outReal[] );
+
+static void emaMultiSteps( const double inReal[],
+                           const float  inRealFloat[],
+                           EmaMultiType type,
+                           int          nbActive,
+                           int          firstJ,
+                           int          lastJ,
+                           int          fromIdx,
+                           int          toIdx,
+                           double       state[],
+                           const int    rowOffset[],
+                           const double coef[],
+                           double       outReal[] );
+
+static TA_RetCode maMulti( int    startIdx,
+                           int    endIdx,
+                           const double inReal[],
+                           const float  inRealFloat[],
+                           const int     optInTimePeriods[],
+                           int           optInNbPeriod,
+                           TA_MAType     optInMAType,
+                           int           outBegIdx[],
+                           int           outNBElement[],
+                           double        outReal[] );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_MA_MULTI( int    startIdx,
+                        int    endIdx,
+                        const double inReal[],
+                        const int     optInTimePeriods[],
+                        int           optInNbPeriod,
+                        TA_MAType     optInMAType,
+                        int           outBegIdx[],
+                        int           outNBElement[],
+                        double        outReal[] )
+{
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      if( !inReal )
+         return TA_BAD_PARAM;
+   #endif
+
+   return maMulti( startIdx, endIdx, inReal, NULL,
+                   optInTimePeriods, optInNbPeriod, optInMAType,
+                   outBegIdx, outNBElement, outReal );
+}
+
+TA_RetCode TA_S_MA_MULTI( int    startIdx,
+                          int    endIdx,
+                          const float  inReal[],
+                          const int     optInTimePeriods[],
+                          int           optInNbPeriod,
+                          TA_MAType     optInMAType,
+                          int           outBegIdx[],
+                          int           outNBElement[],
+                          double        outReal[] )
+{
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      if( !inReal )
+         return TA_BAD_PARAM;
+   #endif
+
+   return maMulti( startIdx, endIdx, NULL, inReal,
+                   optInTimePeriods, optInNbPeriod, optInMAType,
+                   outBegIdx, outNBElement, outReal );
+}
+
+TA_RetCode TA_TRIX_MULTI( int    startIdx,
+                          int    endIdx,
+                          const double inReal[],
+                          const int     optInTimePeriods[],
+                          int           optInNbPeriod,
+                          int           outBegIdx[],
+                          int           outNBElement[],
+                          double        outReal[] )
+{
+   TA_RetCode retCode;
+
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      if( !inReal )
+         return TA_BAD_PARAM;
+   #endif
+
+   retCode = checkMultiParam( startIdx, endIdx, optInTimePeriods, optInNbPeriod, 2,
+                              outBegIdx, outNBElement, outReal );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   return emaMulti( startIdx, endIdx, inReal, NULL,
+                    optInTimePeriods, optInNbPeriod, EMA_MULTI_TRIX,
+                    outBegIdx, outNBElement, outReal );
+}
+
+TA_RetCode TA_S_TRIX_MULTI( int    startIdx,
+                            int    endIdx,
+                            const float  inReal[],
+                            const int     optInTimePeriods[],
+                            int           optInNbPeriod,
+                            int           outBegIdx[],
+                            int           outNBElement[],
+                            double        outReal[] )
+{
+   TA_RetCode retCode;
+
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      if( !inReal )
+         return TA_BAD_PARAM;
+   #endif
+
+   retCode = checkMultiParam( startIdx, endIdx, optInTimePeriods, optInNbPeriod, 2,
+                              outBegIdx, outNBElement, outReal );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   return emaMulti( startIdx, endIdx, NULL, inReal,
+                    optInTimePeriods, optInNbPeriod, EMA_MULTI_TRIX,
+                    outBegIdx, outNBElement, outReal );
+}
+
+/**** Local functions definitions.     ****/
+static TA_RetCode checkMultiParam( int    startIdx,
+                                   int    endIdx,
+                                   const int     optInTimePeriods[],
+                                   int           optInNbPeriod,
+                                   int           optInMinPeriod,
+                                   int           outBegIdx[],
+                                   int           outNBElement[],
+                                   double        outReal[] )
+{
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      int k, period;
+
+      if( startIdx < 0 )
+         return TA_OUT_OF_RANGE_START_INDEX;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return TA_OUT_OF_RANGE_END_INDEX;
+      if( !optInTimePeriods || (optInNbPeriod < 1) )
+         return TA_BAD_PARAM;
+      for( k=0; k < optInNbPeriod; k++ )
+      {
+         period = optInTimePeriods[k];
+         if( (period != TA_INTEGER_DEFAULT) && ((period < optInMinPeriod) || (period > 100000)) )
+            return TA_BAD_PARAM;
+      }
+      if( !outBegIdx || !outNBElement || !outReal )
+         return TA_BAD_PARAM;
+   #else
+      UNUSED_VARIABLE(startIdx);
+      UNUSED_VARIABLE(endIdx);
+      UNUSED_VARIABLE(optInTimePeriods);
+      UNUSED_VARIABLE(optInNbPeriod);
+      UNUSED_VARIABLE(optInMinPeriod);
+      UNUSED_VARIABLE(outBegIdx);
+      UNUSED_VARIABLE(outNBElement);
+      UNUSED_VARIABLE(outReal);
+   #endif
+
+   return TA_SUCCESS;
+}
+
+static TA_RetCode maMulti( int    startIdx,
+                           int    endIdx,
+                           const double inReal[],
+                           const float  inRealFloat[],
+                           const int     optInTimePeriods[],
+                           int           optInNbPeriod,
+                           TA_MAType     optInMAType,
+                           int           outBegIdx[],
+                           int           outNBElement[],
+                           double        outReal[] )
+{
+   int i, k, today, period, half, lookback, maxLookback;
+   int base, nbSum, nbOutput;
+   int blockStart, blockEnd, firstIdx, a, e;
+   double tempReal, tempReal2, tempReal3, periodTotal, periodError, divider;
+   double *sumArray, *S, *SErr, *T, *TErr, *out;
+   TA_RetCode retCode;
+
+   retCode = checkMultiParam( startIdx, endIdx, optInTimePeriods, optInNbPeriod, 1,
+                              outBegIdx, outNBElement, outReal );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   switch( optInMAType )
+   {
+   case TA_MAType_SMA:
+   case TA_MAType_WMA:
+   case TA_MAType_TRIMA:
+      break;
+   case TA_MAType_EMA:
+      return emaMulti( startIdx, endIdx, inReal, inRealFloat,
+                       optInTimePeriods, optInNbPeriod, EMA_MULTI_EMA,
+                       outBegIdx, outNBElement, outReal );
+   case TA_MAType_DEMA:
+      return emaMulti( startIdx, endIdx, inReal, inRealFloat,
+                       optInTimePeriods, optInNbPeriod, EMA_MULTI_DEMA,
+                       outBegIdx, outNBElement, outReal );
+   case TA_MAType_TEMA:
+      return emaMulti( startIdx, endIdx, inReal, inRealFloat,
+                       optInTimePeriods, optInNbPeriod, EMA_MULTI_TEMA,
+                       outBegIdx, outNBElement, outReal );
+   case TA_MAType_T3:
+      return emaMulti( startIdx, endIdx, inReal, inRealFloat,
+                       optInTimePeriods, optInNbPeriod, EMA_MULTI_T3,
+                       outBegIdx, outNBElement, outReal );
+   default:
+      return TA_BAD_PARAM;
+   }
+
+   /* Each period has its own row of (endIdx-startIdx+1) outputs. */
+   nbOutput = endIdx-startIdx+1;
+
+   maxLookback = 0;
+   for( k=0; k < optInNbPeriod; k++ )
+   {
+      period = optInTimePeriods[k];
+      if( period == TA_INTEGER_DEFAULT )
+         period = 30;
+      if( period-1 > maxLookback )
+         maxLookback = period-1;
+   }
+
+   /* The running sums start at the first input
+    * needed by any of the periods.
+    */
+   base = startIdx-maxLookback;
+   if( base < 0 )
+      base = 0;
+   nbSum = endIdx-base+2;
+
+   /* sumArray holds S and its error, then T and its
+    * error. T needs one more value than S.
+    */
+   if( optInMAType == TA_MAType_SMA )
+      sumArray = (double *)TA_Malloc( sizeof(double)*2*nbSum );
+   else
+      sumArray = (double *)TA_Malloc( sizeof(double)*2*(2*nbSum+1) );
+   if( !sumArray )
+      return TA_ALLOC_ERR;
+
+   S    = sumArray;
+   SErr = &sumArray[nbSum];
+   T    = &sumArray[2*nbSum];
+   TErr = &sumArray[3*nbSum+1];
+
+   periodTotal = 0.0;
+   periodError = 0.0;
+   S[0] = SErr[0] = 0.0;
+   for( i=1; i < nbSum; i++ )
+   {
+      tempReal = MA_PRICE(base+i-1);
+      SUM_ADD(tempReal);
+      S[i]    = periodTotal;
+      SErr[i] = periodError;
+   }
+
+   if( optInMAType != TA_MAType_SMA )
+   {
+      /* The error of S is added to the error of T. */
+      periodTotal = 0.0;
+      periodError = 0.0;
+      T[0] = TErr[0] = 0.0;
+      for( i=1; i <= nbSum; i++ )
+      {
+         tempReal = S[i-1];
+         SUM_ADD(tempReal);
+         periodError += SErr[i-1];
+         T[i]    = periodTotal;
+         TErr[i] = periodError;
+      }
+   }
+
+   for( k=0; k < optInNbPeriod; k++ )
+   {
+      period = optInTimePeriods[k];
+      if( period == TA_INTEGER_DEFAULT )
+         period = 30;
+      lookback = period-1;
+      if( startIdx > lookback )
+         outBegIdx[k] = startIdx;
+      else
+         outBegIdx[k] = lookback;
+
+      if( outBegIdx[k] > endIdx )
+      {
+         outBegIdx[k]    = 0;
+         outNBElement[k] = 0;
+      }
+      else
+         outNBElement[k] = endIdx-outBegIdx[k]+1;
+   }
+
+   for( blockStart=startIdx; blockStart <= endIdx; blockStart += MA_MULTI_BLOCK_SIZE )
+   {
+      blockEnd = blockStart+MA_MULTI_BLOCK_SIZE-1;
+      if( blockEnd > endIdx )
+         blockEnd = endIdx;
+
+      for( k=0; k < optInNbPeriod; k++ )
+      {
+         if( outNBElement[k] == 0 )
+            continue;
+
+         firstIdx = outBegIdx[k];
+         if( firstIdx < blockStart )
+            firstIdx = blockStart;
+         if( firstIdx > blockEnd )
+            continue;
+
+         period = optInTimePeriods[k];
+         if( period == TA_INTEGER_DEFAULT )
+            period = 30;
+         out = &outReal[k*nbOutput+firstIdx-outBegIdx[k]];
+
+         if( period == 1 )
+         {
+            /* Same as TA_MA, the input is copied. */
+            for( today=firstIdx; today <= blockEnd; today++ )
+               *out++ = MA_PRICE(today);
+            continue;
+         }
+
+         /* e is the relative index of the last input of the window
+          * and a the one before the first input of the window.
+          */
+         e = firstIdx-base;
+         a = e-period;
+         switch( optInMAType )
+         {
+         case TA_MAType_SMA:
+            for( today=firstIdx; today <= blockEnd; today++, a++, e++ )
+               *out++ = SUM_DIFF(S,SErr,e+1,a+1)/period;
+            break;
+
+         case TA_MAType_WMA:
+            divider = (double)period*(double)(period+1)*0.5;
+            for( today=firstIdx; today <= blockEnd; today++, a++, e++ )
+            {
+               tempReal  = (double)period*S[e+1]-SUM_DIFF(T,TErr,e+1,a+1);
+               tempReal += (double)period*SErr[e+1];
+               *out++ = tempReal/divider;
+            }
+            break;
+
+         default:
+            /* TRIMA */
+            half    = (period>>1)+1;
+            divider = (double)half*(double)(period+1-half);
+            for( today=firstIdx; today <= blockEnd; today++, a++, e++ )
+            {
+               tempReal = SUM_DIFF(T,TErr,e+2,e+2-half)-SUM_DIFF(T,TErr,a+1+half,a+1);
+               *out++ = tempReal/divider;
+            }
+            break;
+         }
+      }
+   }
+
+   TA_Free( sumArray );
+
+   return TA_SUCCESS;
+}
+
+static TA_RetCode emaMulti( int    startIdx,
+                            int    endIdx,
+                            const double inReal[],
+                            const float  inRealFloat[],
+                            const int     optInTimePeriods[],
+                            int           optInNbPeriod,
+                            EmaMultiType  type,
+                            int           outBegIdx[],
+                            int           outNBElement[],
+                            double        outReal[] )
+{
+   int j, k, today, period, lookback, lookbackEMA, level, nbLevel;
+   int i, nbOutput, nbActive, firstEMAIdx, chainIdx, metastock;
+   int cnt[EMA_MULTI_MAX_LEVEL];
+   double e[EMA_MULTI_MAX_LEVEL], sum[EMA_MULTI_MAX_LEVEL];
+   double coef[4];
+   double tempReal, prevEMA, optInK_1, oneMinusK;
+   double *state;
+   int *rowOffset, *periodIdx;
+
+   switch( type )
+   {
+   case EMA_MULTI_EMA:  nbLevel = 1; break;
+   case EMA_MULTI_DEMA: nbLevel = 2; break;
+   case EMA_MULTI_T3:   nbLevel = 6; break;
+   default:             nbLevel = 3; break;
+   }
+
+   /* Same coefficients as ta_T3.c */
+   tempReal = EMA_MULTI_T3_VFACTOR*EMA_MULTI_T3_VFACTOR;
+   coef[0] = -(tempReal*EMA_MULTI_T3_VFACTOR);
+   coef[1] = 3.0*(tempReal-coef[0]);
+   coef[2] = -6.0*tempReal-3.0*(EMA_MULTI_T3_VFACTOR-coef[0]);
+   coef[3] = 1.0+3.0*EMA_MULTI_T3_VFACTOR-coef[0]+3.0*tempReal;
+
+   /* The T3 does not use the compatibility setting. */
+   metastock = (type != EMA_MULTI_T3) &&
+               (TA_GLOBALS_COMPATIBILITY != TA_COMPATIBILITY_DEFAULT);
+
+   nbOutput = endIdx-startIdx+1;
+   nbActive = 0;
+   for( k=0; k < optInNbPeriod; k++ )
+   {
+      period = optInTimePeriods[k];
+      if( period == TA_INTEGER_DEFAULT )
+         period = 30;
+
+      if( (period == 1) && (type != EMA_MULTI_TRIX) )
+      {
+         /* Same as TA_MA, the input is copied. */
+         outBegIdx[k]    = startIdx;
+         outNBElement[k] = nbOutput;
+         for( today=startIdx; today <= endIdx; today++ )
+            outReal[k*nbOutput+today-startIdx] = MA_PRICE(today);
+         continue;
+      }
+
+      switch( type )
+      {
+      case EMA_MULTI_EMA:  lookback = TA_EMA_Lookback( period ); break;
+      case EMA_MULTI_DEMA: lookback = TA_DEMA_Lookback( period ); break;
+      case EMA_MULTI_TEMA: lookback = TA_TEMA_Lookback( period ); break;
+      case EMA_MULTI_T3:   lookback = TA_T3_Lookback( period, EMA_MULTI_T3_VFACTOR ); break;
+      default:             lookback = TA_TRIX_Lookback( period ); break;
+      }
+
+      if( startIdx > lookback )
+         outBegIdx[k] = startIdx;
+      else
+         outBegIdx[k] = lookback;
+
+      if( outBegIdx[k] > endIdx )
+      {
+         outBegIdx[k]    = 0;
+         outNBElement[k] = 0;
+         continue;
+      }
+
+      outNBElement[k] = endIdx-outBegIdx[k]+1;
+      nbActive++;
+   }
+
+   if( nbActive == 0 )
+      return TA_SUCCESS;
+
+   state     = (double *)TA_Malloc( sizeof(double)*EMA_MULTI_NB_ROW*nbActive );
+   rowOffset = (int *)TA_Malloc( sizeof(int)*2*nbActive );
+   if( !state || !rowOffset )
+   {
+      if( state )
+         TA_Free( state );
+      if( rowOffset )
+         TA_Free( rowOffset );
+      return TA_ALLOC_ERR;
+   }
+
+   /* The state of the periods is sorted by their first output
+    * (insertion sort, same order for equal first outputs).
+    */
+   periodIdx = &rowOffset[nbActive];
+   j = 0;
+   for( k=0; k < optInNbPeriod; k++ )
+   {
+      period = optInTimePeriods[k];
+      if( period == TA_INTEGER_DEFAULT )
+         period = 30;
+      if( (outNBElement[k] == 0) || ((period == 1) && (type != EMA_MULTI_TRIX)) )
+         continue;
+
+      for( i=j; (i > 0) && (outBegIdx[periodIdx[i-1]] > outBegIdx[k]); i-- )
+         periodIdx[i] = periodIdx[i-1];
+      periodIdx[i] = k;
+      j++;
+   }
+
+   /* Each period is first done alone up to its first output,
+    * with the same seeding as the function called alone.
+    */
+   for( j=0; j < nbActive; j++ )
+   {
+      k = periodIdx[j];
+      period = optInTimePeriods[k];
+      if( period == TA_INTEGER_DEFAULT )
+         period = 30;
+
+      rowOffset[j] = k*nbOutput-outBegIdx[k];
+
+      if( type == EMA_MULTI_T3 )
+      {
+         lookback    = TA_T3_Lookback( period, EMA_MULTI_T3_VFACTOR );
+         lookbackEMA = 0;
+         optInK_1    = 2.0/(period+1.0);
+         firstEMAIdx = outBegIdx[k];
+         chainIdx    = outBegIdx[k]-lookback;
+      }
+      else
+      {
+         /* Each EMA level delays its output by lookbackEMA. The
+          * first level outputs from firstEMAIdx.
+          */
+         lookbackEMA = TA_EMA_Lookback( period );
+         optInK_1    = PER_TO_K( period );
+         firstEMAIdx = outBegIdx[k]-((nbLevel-1)*lookbackEMA);
+         if( type == EMA_MULTI_TRIX )
+            firstEMAIdx--;
+         if( metastock )
+            chainIdx = 0;
+         else
+            chainIdx = firstEMAIdx-lookbackEMA;
+      }
+      oneMinusK = 1.0-optInK_1;
+
+      for( level=0; level < EMA_MULTI_MAX_LEVEL; level++ )
+      {
+         cnt[level] = 0;
+         sum[level] = 0.0;
+         e[level]   = 0.0;
+      }
+      prevEMA = 0.0;
+
+      for( today=chainIdx; today <= outBegIdx[k]; today++ )
+      {
+         /* tempReal is the input of each level, the
+          * loop stops at the first level without output.
+          */
+         tempReal = MA_PRICE(today);
+         for( level=0; level < nbLevel; level++ )
+         {
+            if( type == EMA_MULTI_T3 )
+            {
+               /* Each level starts with the SMA of its first
+                * 'period' inputs, the first one being the
+                * SMA of the level below.
+                */
+               if( cnt[level] < period )
+               {
+                  sum[level] += tempReal;
+                  if( ++cnt[level] < period )
+                     break;
+                  e[level] = sum[level]/period;
+               }
+               else
+                  e[level] = (optInK_1*tempReal)+(oneMinusK*e[level]);
+            }
+            else
+            {
+               if( metastock && (cnt[level] == 0) )
+                  e[level] = tempReal;
+               else if( !metastock && (cnt[level] < period) )
+               {
+                  sum[level] += tempReal;
+                  if( cnt[level]+1 == period )
+                     e[level] = sum[level]/period;
+               }
+               else
+                  e[level] = TA_EMA_STEP(e[level],tempReal,optInK_1);
+               cnt[level]++;
+
+               if( level == 0 )
+               {
+                  if( today < firstEMAIdx )
+                     break;
+               }
+               else if( cnt[level] <= lookbackEMA )
+                  break;
+            }
+            tempReal = e[level];
+         }
+
+         if( level < nbLevel )
+            continue;
+
+         if( today == outBegIdx[k] )
+         {
+            switch( type )
+            {
+            case EMA_MULTI_EMA:
+               tempReal = e[0];
+               break;
+            case EMA_MULTI_DEMA:
+               tempReal = (2.0*e[0])-e[1];
+               break;
+            case EMA_MULTI_TEMA:
+               tempReal = e[2]+((3.0*e[0])-(3.0*e[1]));
+               break;
+            case EMA_MULTI_T3:
+               tempReal = coef[0]*e[5]+coef[1]*e[4]+coef[2]*e[3]+coef[3]*e[2];
+               break;
+            default:
+               if( prevEMA != 0.0 )
+                  tempReal = ((e[2]/prevEMA)-1.0)*100.0;
+               else
+                  tempReal = 0.0;
+               break;
+            }
+            outReal[rowOffset[j]+today] = tempReal;
+         }
+         prevEMA = e[nbLevel-1];
+      }
+
+      for( level=0; level < EMA_MULTI_MAX_LEVEL; level++ )
+         EMA_STATE(level,j) = e[level];
+      EMA_STATE(6,j) = optInK_1;
+      if( type == EMA_MULTI_T3 )
+         EMA_STATE(7,j) = oneMinusK;
+      else
+         EMA_STATE(7,j) = prevEMA;
+   }
+
+   /* Then the periods are advanced together. A period joins
+    * the ones before it after its first output.
+    */
+   for( j=0; j < nbActive; j++ )
+   {
+      if( j+1 < nbActive )
+         today = outBegIdx[periodIdx[j+1]];
+      else
+         today = endIdx;
+      emaMultiSteps( inReal, inRealFloat, type, nbActive, 0, j,
+                     outBegIdx[periodIdx[j]]+1, today, state, rowOffset, coef, outReal );
+   }
+
+   TA_Free( state );
+   TA_Free( rowOffset );
+
+   return TA_SUCCESS;
+}
+
+/* Advance the periods firstJ to lastJ of the state from fromIdx
+ * to toIdx, and write their outputs.
+ */
+static void emaMultiSteps( const double inReal[],
+                           const float  inRealFloat[],
+                           EmaMultiType type,
+                           int          nbActive,
+                           int          firstJ,
+                           int          lastJ,
+                           int          fromIdx,
+                           int          toIdx,
+                           double       state[],
+                           const int    rowOffset[],
+                           const double coef[],
+                           double       outReal[] )
+{
+   int i, j, g, nbInGroup, today, level;
+   double tempReal, c1, c2, c3, c4;
+   double e[EMA_MULTI_MAX_LEVEL][EMA_MULTI_GROUP];
+   double k[EMA_MULTI_GROUP], extra[EMA_MULTI_GROUP], out[EMA_MULTI_GROUP];
+
+   c1 = coef[0];
+   c2 = coef[1];
+   c3 = coef[2];
+   c4 = coef[3];
+
+   for( j=firstJ; j <= lastJ; j += EMA_MULTI_GROUP )
+   {
+      /* A partial group repeats its last period, only
+       * the periods of the group are written back.
+       */
+      nbInGroup = lastJ-j+1;
+      if( nbInGroup > EMA_MULTI_GROUP )
+         nbInGroup = EMA_MULTI_GROUP;
+
+      for( g=0; g < EMA_MULTI_GROUP; g++ )
+      {
+         i = j+((g < nbInGroup)? g : nbInGroup-1);
+         for( level=0; level < EMA_MULTI_MAX_LEVEL; level++ )
+            e[level][g] = EMA_STATE(level,i);
+         k[g]     = EMA_STATE(6,i);
+         extra[g] = EMA_STATE(7,i);
+      }
+
+      for( today=fromIdx; today <= toIdx; today++ )
+      {
+         tempReal = MA_PRICE(today);
+
+         switch( type )
+         {
+         case EMA_MULTI_EMA:
+            for( g=0; g < EMA_MULTI_GROUP; g++ )
+            {
+               e[0][g] = TA_EMA_STEP(e[0][g],tempReal,k[g]);
+               out[g]  = e[0][g];
+            }
+            break;
+
+         case EMA_MULTI_DEMA:
+            for( g=0; g < EMA_MULTI_GROUP; g++ )
+            {
+               e[0][g] = TA_EMA_STEP(e[0][g],tempReal,k[g]);
+               e[1][g] = TA_EMA_STEP(e[1][g],e[0][g],k[g]);
+               out[g]  = (2.0*e[0][g])-e[1][g];
+            }
+            break;
+
+         case EMA_MULTI_TEMA:
+            for( g=0; g < EMA_MULTI_GROUP; g++ )
+            {
+               e[0][g] = TA_EMA_STEP(e[0][g],tempReal,k[g]);
+               e[1][g] = TA_EMA_STEP(e[1][g],e[0][g],k[g]);
+               e[2][g] = TA_EMA_STEP(e[2][g],e[1][g],k[g]);
+               out[g]  = e[2][g]+((3.0*e[0][g])-(3.0*e[1][g]));
+            }
+            break;
+
+         case EMA_MULTI_T3:
+            /* extra is (1-k). */
+            for( g=0; g < EMA_MULTI_GROUP; g++ )
+            {
+               e[0][g] = (k[g]*tempReal)+(extra[g]*e[0][g]);
+               e[1][g] = (k[g]*e[0][g])+(extra[g]*e[1][g]);
+               e[2][g] = (k[g]*e[1][g])+(extra[g]*e[2][g]);
+               e[3][g] = (k[g]*e[2][g])+(extra[g]*e[3][g]);
+               e[4][g] = (k[g]*e[3][g])+(extra[g]*e[4][g]);
+               e[5][g] = (k[g]*e[4][g])+(extra[g]*e[5][g]);
+               out[g]  = c1*e[5][g]+c2*e[4][g]+c3*e[3][g]+c4*e[2][g];
+            }
+            break;
+
+         default:
+            /* TRIX, the 1-day ROC of the triple EMA.
+             * extra is the previous triple EMA.
+             */
+            for( g=0; g < EMA_MULTI_GROUP; g++ )
+            {
+               e[0][g] = TA_EMA_STEP(e[0][g],tempReal,k[g]);
+               e[1][g] = TA_EMA_STEP(e[1][g],e[0][g],k[g]);
+               e[2][g] = TA_EMA_STEP(e[2][g],e[1][g],k[g]);
+               if( extra[g] != 0.0 )
+                  out[g] = ((e[2][g]/extra[g])-1.0)*100.0;
+               else
+                  out[g] = 0.0;
+               extra[g] = e[2][g];
+            }
+            break;
+         }
+
+         for( g=0; g < nbInGroup; g++ )
+            outReal[rowOffset[j+g]+today] = out[g];
+      }
+
+      for( g=0; g < nbInGroup; g++ )
+      {
+         for( level=0; level < EMA_MULTI_MAX_LEVEL; level++ )
+            EMA_STATE(level,j+g) = e[level][g];
+         EMA_STATE(7,j+g) = extra[g];
+      }
+   }
+}
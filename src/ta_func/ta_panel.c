@@ -0,0 +1,620 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ */
+
+/* Description:
+ *   Recursive functions (EMA, RSI, ATR and KAMA) for many symbols at
+ *   once, with the input and output in a "panel" layout.
+ *
+ *   A panel has one row per bar and one column per symbol: the value
+ *   of the symbol s at the bar i is at panel[i*stride+s]. The stride
+ *   can be larger than the number of symbols, for aligning the rows.
+ *
+ *   A recursive function cannot be vectorized along the time, each
+ *   value depends on the previous one. But the symbols are independent,
+ *   so each step is done for a whole row with a loop over the symbols
+ *   that the compiler vectorizes (the SIMD lanes are symbols). Instead
+ *   of one long chain of dependent operations per symbol, there are
+ *   nbSymbol independent ones at each step.
+ *
+ *   Each symbol has the exact same floating point operations, in the
+ *   same order, as the function called for this symbol alone, so the
+ *   outputs are identical. The branches are written as selections of
+ *   the values computed on both paths, which gives the same result.
+ *   The conditions must not short-circuit, else the loop keeps a
+ *   branch and is not vectorized. Check with -fopt-info-vec (GCC) when
+ *   changing these loops.
+ *
+ *   The previous value of the recursion is kept in the previous output
+ *   row, the other states (RSI and KAMA) in a row of temporary memory.
+ */
+
+/* GCC moves an operation used on one side of a selection into a
+ * branch, and then keeps the branch because the operation could raise
+ * a floating point exception. The TA functions do not use these
+ * exceptions, and the values calculated are the same.
+ */
+#if defined( __GNUC__ ) && !defined( __clang__ )
+   #pragma GCC optimize ("no-trapping-math")
+#endif
+
+/**** Headers ****/
+#include <math.h>
+#include "ta_func_ext.h"
+#include "ta_memory.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+
+/* Row of the bar 'idx' in a panel. */
+#define PANEL_ROW(panel,idx) (&(panel)[(size_t)(idx)*(size_t)stride])
+
+/* Check the parameters common to all the functions. */
+#define PANEL_CHECK_PARAM() { \
+   if( startIdx < 0 ) \
+      return TA_OUT_OF_RANGE_START_INDEX; \
+   if( (endIdx < 0) || (endIdx < startIdx) ) \
+      return TA_OUT_OF_RANGE_END_INDEX; \
+   if( (nbSymbol < 1) || (stride < nbSymbol) ) \
+      return TA_BAD_PARAM; \
+   if( !outBegIdx || !outNBElement || !outReal ) \
+      return TA_BAD_PARAM; \
+}
+
+/* Same as TA_IS_ZERO, without the short-circuit. */
+#define PANEL_IS_ZERO(v) (std_fabs(v) < TA_EPSILON)
+
+/* Same as TA_TRANGE, for the bar of the rows high, low
+ * and of the row prevClose for the previous bar.
+ */
+#define PANEL_TRANGE(s,greatest) { \
+   greatest = high[s]-low[s]; \
+   val2 = std_fabs( prevClose[s]-high[s] ); \
+   greatest = val2 > greatest? val2 : greatest; \
+   val3 = std_fabs( prevClose[s]-low[s] ); \
+   greatest = val3 > greatest? val3 : greatest; \
+}
+
+/* Same as TA_RSI, one step of Wilder's smoothing
+ * of the gain and the loss.
+ */
+#define PANEL_RSI_STEP(s) { \
+   tempValue2 = in[s]-prev[s]; \
+   lossValue  = prevLoss[s]*(optInTimePeriod-1); \
+   gainValue  = prevGain[s]*(optInTimePeriod-1); \
+   lossValue  = tempValue2 < 0? lossValue-tempValue2 : lossValue; \
+   gainValue  = tempValue2 < 0? gainValue : gainValue+tempValue2; \
+   prevLoss[s] = lossValue/optInTimePeriod; \
+   prevGain[s] = gainValue/optInTimePeriod; \
+}
+
+/* Sum of the gains and losses of the initial period. The sum
+ * not changed gets 0.0 added, which leaves it the same (the sums
+ * are never -0.0). Only one selection, two on the same condition
+ * are not vectorized here.
+ */
+#define PANEL_RSI_SUM(s) { \
+   tempValue2 = in[s]-prev[s]; \
+   tempValue3 = tempValue2 < 0? tempValue2 : 0.0; \
+   prevLoss[s] -= tempValue3; \
+   prevGain[s] += tempValue2-tempValue3; \
+}
+
+#define PANEL_RSI_VALUE(s) { \
+   tempValue1 = prevGain[s]+prevLoss[s]; \
+   out[s] = !PANEL_IS_ZERO(tempValue1)? 100.0*(prevGain[s]/tempValue1) : 0.0; \
+}
+
+/* Same as TA_KAMA, one step for the input row 'in'. */
+#define PANEL_KAMA_STEP(s,prevKAMA) { \
+   periodROC = in[s]-trailing[s]; \
+   sumROC1[s] -= std_fabs(prevTrailing[s]-trailing[s]); \
+   sumROC1[s] += std_fabs(in[s]-prev[s]); \
+   tempReal = std_fabs(periodROC/sumROC1[s]); \
+   tempReal = (sumROC1[s] <= periodROC)? 1.0 : tempReal; \
+   tempReal = PANEL_IS_ZERO(sumROC1[s])? 1.0 : tempReal; \
+   tempReal = (tempReal*constDiff)+constMax; \
+   tempReal *= tempReal; \
+   prevKAMA = ((in[s]-prevKAMA)*tempReal) + prevKAMA; \
+}
+
+/**** Local functions declarations.    ****/
+/* None */
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_EMA_PANEL( int    startIdx,
+                         int    endIdx,
+                         int    nbSymbol,
+                         int    stride,
+                         const double inReal[],
+                         int           optInTimePeriod,
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double        outReal[] )
+{
+   const double *in;
+   double *out, *prev;
+   double k;
+   int i, s, today, outIdx, lookbackTotal;
+
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      PANEL_CHECK_PARAM();
+      if( !inReal )
+         return TA_BAD_PARAM;
+      if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+         optInTimePeriod = 30;
+      else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+         return TA_BAD_PARAM;
+   #endif
+
+   *outBegIdx    = 0;
+   *outNBElement = 0;
+
+   lookbackTotal = TA_EMA_Lookback( optInTimePeriod );
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+   if( startIdx > endIdx )
+      return TA_SUCCESS;
+
+   /* Same seed as TA_INT_EMA, in the first output row. */
+   k    = PER_TO_K( optInTimePeriod );
+   prev = outReal;
+   if( TA_GLOBALS_COMPATIBILITY == TA_COMPATIBILITY_DEFAULT )
+   {
+      today = startIdx-lookbackTotal;
+      for( s=0; s < nbSymbol; s++ )
+         prev[s] = 0.0;
+      for( i=0; i < optInTimePeriod; i++ )
+      {
+         in = PANEL_ROW(inReal,today++);
+         for( s=0; s < nbSymbol; s++ )
+            prev[s] += in[s];
+      }
+      for( s=0; s < nbSymbol; s++ )
+         prev[s] /= optInTimePeriod;
+   }
+   else
+   {
+      for( s=0; s < nbSymbol; s++ )
+         prev[s] = inReal[s];
+      today = 1;
+   }
+
+   /* Skip the unstable period. */
+   while( today <= startIdx )
+   {
+      in = PANEL_ROW(inReal,today++);
+      for( s=0; s < nbSymbol; s++ )
+         prev[s] = TA_EMA_STEP(prev[s],in[s],k);
+   }
+
+   outIdx = 1;
+   while( today <= endIdx )
+   {
+      in  = PANEL_ROW(inReal,today++);
+      out = PANEL_ROW(outReal,outIdx++);
+      for( s=0; s < nbSymbol; s++ )
+         out[s] = TA_EMA_STEP(prev[s],in[s],k);
+      prev = out;
+   }
+
+   *outBegIdx    = startIdx;
+   *outNBElement = outIdx;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_RSI_PANEL( int    startIdx,
+                         int    endIdx,
+                         int    nbSymbol,
+                         int    stride,
+                         const double inReal[],
+                         int           optInTimePeriod,
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double        outReal[] )
+{
+   const double *in, *prev, *first;
+   double *out;
+   double tempValue1, tempValue2, tempValue3, gainValue, lossValue;
+   int i, s, today, outIdx, lookbackTotal;
+   ARRAY_REF(prevGain);
+   ARRAY_REF(prevLoss);
+
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      PANEL_CHECK_PARAM();
+      if( !inReal )
+         return TA_BAD_PARAM;
+      if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+         optInTimePeriod = 14;
+      else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+         return TA_BAD_PARAM;
+   #endif
+
+   *outBegIdx    = 0;
+   *outNBElement = 0;
+
+   lookbackTotal = TA_RSI_Lookback( optInTimePeriod );
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+   if( startIdx > endIdx )
+      return TA_SUCCESS;
+
+   ARRAY_ALLOC(prevGain,2*nbSymbol);
+   if( !prevGain )
+      return TA_ALLOC_ERR;
+   prevLoss = &prevGain[nbSymbol];
+
+   outIdx = 0;
+   today  = startIdx-lookbackTotal;
+   first  = PANEL_ROW(inReal,today);
+
+   /* The additional first output of Metastock (see TA_RSI). */
+   if( (TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_RSI,Rsi) == 0) &&
+       (TA_GLOBALS_COMPATIBILITY == TA_COMPATIBILITY_METASTOCK) )
+   {
+      /* The first bar is compared to itself (no gain or loss). */
+      for( s=0; s < nbSymbol; s++ )
+      {
+         prevGain[s] = 0.0;
+         prevLoss[s] = 0.0;
+      }
+      for( i=1; i < optInTimePeriod; i++ )
+      {
+         prev = PANEL_ROW(inReal,today+i-1);
+         in   = PANEL_ROW(inReal,today+i);
+         for( s=0; s < nbSymbol; s++ )
+            PANEL_RSI_SUM(s);
+      }
+
+      out = PANEL_ROW(outReal,outIdx++);
+      for( s=0; s < nbSymbol; s++ )
+      {
+         lossValue  = prevLoss[s]/optInTimePeriod;
+         gainValue  = prevGain[s]/optInTimePeriod;
+         tempValue1 = gainValue+lossValue;
+         out[s] = !PANEL_IS_ZERO(tempValue1)? 100*(gainValue/tempValue1) : 0.0;
+      }
+
+      if( today+optInTimePeriod > endIdx )
+      {
+         ARRAY_FREE(prevGain);
+         *outBegIdx    = startIdx;
+         *outNBElement = outIdx;
+         return TA_SUCCESS;
+      }
+   }
+
+   /* Initial period, same for Classic and Metastock. */
+   for( s=0; s < nbSymbol; s++ )
+   {
+      prevGain[s] = 0.0;
+      prevLoss[s] = 0.0;
+   }
+   prev = first;
+   today++;
+   for( i=optInTimePeriod; i > 0; i-- )
+   {
+      in = PANEL_ROW(inReal,today++);
+      for( s=0; s < nbSymbol; s++ )
+         PANEL_RSI_SUM(s);
+      prev = in;
+   }
+   for( s=0; s < nbSymbol; s++ )
+   {
+      prevLoss[s] /= optInTimePeriod;
+      prevGain[s] /= optInTimePeriod;
+   }
+
+   if( today > startIdx )
+   {
+      out = PANEL_ROW(outReal,outIdx++);
+      for( s=0; s < nbSymbol; s++ )
+         PANEL_RSI_VALUE(s);
+   }
+   else
+   {
+      /* Skip the unstable period. */
+      while( today < startIdx )
+      {
+         in = PANEL_ROW(inReal,today++);
+         for( s=0; s < nbSymbol; s++ )
+            PANEL_RSI_STEP(s);
+         prev = in;
+      }
+   }
+
+   while( today <= endIdx )
+   {
+      in  = PANEL_ROW(inReal,today++);
+      out = PANEL_ROW(outReal,outIdx++);
+      for( s=0; s < nbSymbol; s++ )
+      {
+         PANEL_RSI_STEP(s);
+         PANEL_RSI_VALUE(s);
+      }
+      prev = in;
+   }
+
+   ARRAY_FREE(prevGain);
+
+   *outBegIdx    = startIdx;
+   *outNBElement = outIdx;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ATR_PANEL( int    startIdx,
+                         int    endIdx,
+                         int    nbSymbol,
+                         int    stride,
+                         const double inHigh[],
+                         const double inLow[],
+                         const double inClose[],
+                         int           optInTimePeriod,
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double        outReal[] )
+{
+   const double *high, *low, *prevClose;
+   double *out, *prev;
+   double greatest, val2, val3;
+   int i, s, today, outIdx, lookbackTotal;
+
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      PANEL_CHECK_PARAM();
+      if( !inHigh || !inLow || !inClose )
+         return TA_BAD_PARAM;
+      if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+         optInTimePeriod = 14;
+      else if( ((int)optInTimePeriod < 1) || ((int)optInTimePeriod > 100000) )
+         return TA_BAD_PARAM;
+   #endif
+
+   *outBegIdx    = 0;
+   *outNBElement = 0;
+
+   lookbackTotal = TA_ATR_Lookback( optInTimePeriod );
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+   if( startIdx > endIdx )
+      return TA_SUCCESS;
+
+   /* No smoothing, same as TA_TRANGE. */
+   if( optInTimePeriod <= 1 )
+   {
+      outIdx = 0;
+      for( today=startIdx; today <= endIdx; today++ )
+      {
+         high      = PANEL_ROW(inHigh,today);
+         low       = PANEL_ROW(inLow,today);
+         prevClose = PANEL_ROW(inClose,today-1);
+         out       = PANEL_ROW(outReal,outIdx++);
+         for( s=0; s < nbSymbol; s++ )
+         {
+            PANEL_TRANGE(s,greatest);
+            out[s] = greatest;
+         }
+      }
+
+      *outBegIdx    = startIdx;
+      *outNBElement = outIdx;
+      return TA_SUCCESS;
+   }
+
+   /* First ATR is the average of the first true ranges,
+    * same as TA_INT_SMA.
+    */
+   prev  = outReal;
+   today = startIdx-lookbackTotal+1;
+   for( s=0; s < nbSymbol; s++ )
+      prev[s] = 0.0;
+   for( i=0; i < optInTimePeriod; i++, today++ )
+   {
+      high      = PANEL_ROW(inHigh,today);
+      low       = PANEL_ROW(inLow,today);
+      prevClose = PANEL_ROW(inClose,today-1);
+      for( s=0; s < nbSymbol; s++ )
+      {
+         PANEL_TRANGE(s,greatest);
+         prev[s] += greatest;
+      }
+   }
+   for( s=0; s < nbSymbol; s++ )
+      prev[s] /= optInTimePeriod;
+
+   /* Skip the unstable period, then Wilder's smoothing. */
+   for( i=TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_ATR,Atr); i > 0; i-- )
+   {
+      high      = PANEL_ROW(inHigh,today);
+      low       = PANEL_ROW(inLow,today);
+      prevClose = PANEL_ROW(inClose,today-1);
+      today++;
+      for( s=0; s < nbSymbol; s++ )
+      {
+         PANEL_TRANGE(s,greatest);
+         prev[s] = TA_WILDER_STEP(prev[s],greatest,optInTimePeriod);
+      }
+   }
+
+   outIdx = 1;
+   while( today <= endIdx )
+   {
+      high      = PANEL_ROW(inHigh,today);
+      low       = PANEL_ROW(inLow,today);
+      prevClose = PANEL_ROW(inClose,today-1);
+      out       = PANEL_ROW(outReal,outIdx++);
+      today++;
+      for( s=0; s < nbSymbol; s++ )
+      {
+         PANEL_TRANGE(s,greatest);
+         out[s] = TA_WILDER_STEP(prev[s],greatest,optInTimePeriod);
+      }
+      prev = out;
+   }
+
+   *outBegIdx    = startIdx;
+   *outNBElement = outIdx;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_KAMA_PANEL( int    startIdx,
+                          int    endIdx,
+                          int    nbSymbol,
+                          int    stride,
+                          const double inReal[],
+                          int           optInTimePeriod,
+                          int          *outBegIdx,
+                          int          *outNBElement,
+                          double        outReal[] )
+{
+   const double constMax  = 2.0/(30.0+1.0);
+   const double constDiff = 2.0/(2.0+1.0) - constMax;
+   const double *in, *prev, *trailing, *prevTrailing;
+   double *out, *prevKAMA;
+   double tempReal, periodROC;
+   int i, s, today, outIdx, lookbackTotal, trailingIdx;
+   ARRAY_REF(sumROC1);
+
+   #ifndef TA_FUNC_NO_RANGE_CHECK
+      PANEL_CHECK_PARAM();
+      if( !inReal )
+         return TA_BAD_PARAM;
+      if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+         optInTimePeriod = 30;
+      else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+         return TA_BAD_PARAM;
+   #endif
+
+   *outBegIdx    = 0;
+   *outNBElement = 0;
+
+   lookbackTotal = TA_KAMA_Lookback( optInTimePeriod );
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+   if( startIdx > endIdx )
+      return TA_SUCCESS;
+
+   ARRAY_ALLOC(sumROC1,nbSymbol);
+   if( !sumROC1 )
+      return TA_ALLOC_ERR;
+
+   /* Sum of the 1-bar differences over the period. */
+   today = startIdx-lookbackTotal;
+   trailingIdx = today;
+   for( s=0; s < nbSymbol; s++ )
+      sumROC1[s] = 0.0;
+   for( i=optInTimePeriod; i > 0; i-- )
+   {
+      prev = PANEL_ROW(inReal,today++);
+      in   = PANEL_ROW(inReal,today);
+      for( s=0; s < nbSymbol; s++ )
+         sumROC1[s] += std_fabs(prev[s]-in[s]);
+   }
+
+   /* First KAMA, from the previous price (same as TA_KAMA). */
+   prevKAMA = outReal;
+   prev     = PANEL_ROW(inReal,today-1);
+   in       = PANEL_ROW(inReal,today++);
+   trailing = PANEL_ROW(inReal,trailingIdx++);
+   for( s=0; s < nbSymbol; s++ )
+   {
+      periodROC = in[s]-trailing[s];
+      tempReal  = std_fabs(periodROC/sumROC1[s]);
+      tempReal  = (sumROC1[s] <= periodROC)? 1.0 : tempReal;
+      tempReal  = PANEL_IS_ZERO(sumROC1[s])? 1.0 : tempReal;
+      tempReal  = (tempReal*constDiff)+constMax;
+      tempReal *= tempReal;
+      prevKAMA[s] = ((in[s]-prev[s])*tempReal) + prev[s];
+   }
+
+   /* Skip the unstable period. */
+   while( today <= startIdx )
+   {
+      prevTrailing = trailing;
+      prev     = in;
+      in       = PANEL_ROW(inReal,today++);
+      trailing = PANEL_ROW(inReal,trailingIdx++);
+      for( s=0; s < nbSymbol; s++ )
+         PANEL_KAMA_STEP(s,prevKAMA[s]);
+   }
+
+   outIdx = 1;
+   while( today <= endIdx )
+   {
+      prevTrailing = trailing;
+      prev     = in;
+      in       = PANEL_ROW(inReal,today++);
+      trailing = PANEL_ROW(inReal,trailingIdx++);
+      out      = PANEL_ROW(outReal,outIdx++);
+      for( s=0; s < nbSymbol; s++ )
+      {
+         out[s] = prevKAMA[s];
+         PANEL_KAMA_STEP(s,out[s]);
+      }
+      prevKAMA = out;
+   }
+
+   ARRAY_FREE(sumROC1);
+
+   *outBegIdx    = startIdx;
+   *outNBElement = outIdx;
+
+   return TA_SUCCESS;
+}
@@ -0,0 +1,1583 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ *  101826 MF   Add DEMA, TEMA, TRIX, MACD, MACDFIX, SAR and ADOSC.
+ */
+
+/* Description:
+ *   Streaming (tick-by-tick) implementation of the recursive TA functions.
+ *
+ *   Each update replicates, one price bar at a time, the exact sequence
+ *   of floating point operations done by the batch function when called
+ *   with startIdx=0. This is what makes the outputs bit-identical.
+ *
+ *   The recursion steps are shared with the batch functions through the
+ *   TA_EMA_STEP, TA_WILDER_STEP, TA_SAR_STEP and TA_AD_ADD macros
+ *   (see ta_utility.h).
+ */
+
+/**** Headers ****/
+#include <string.h>
+#include <math.h>
+
+#include "ta_stream.h"
+#include "ta_magic_nb.h"
+#include "ta_memory.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef enum
+{
+   TA_STREAM_EMA,
+   TA_STREAM_RSI,
+   TA_STREAM_CMO,
+   TA_STREAM_KAMA,
+   TA_STREAM_T3,
+   TA_STREAM_TRANGE,
+   TA_STREAM_ATR,
+   TA_STREAM_NATR,
+   TA_STREAM_PLUS_DM,
+   TA_STREAM_MINUS_DM,
+   TA_STREAM_PLUS_DI,
+   TA_STREAM_MINUS_DI,
+   TA_STREAM_DX,
+   TA_STREAM_ADX,
+   TA_STREAM_ADXR,
+   TA_STREAM_DEMA,
+   TA_STREAM_TEMA,
+   TA_STREAM_TRIX,
+   TA_STREAM_MACD,
+   TA_STREAM_SAR,
+   TA_STREAM_ADOSC
+} TA_StreamId;
+
+/* Price bar expected by the TA_StreamUpdateXXX functions. */
+typedef enum
+{
+   TA_STREAM_INPUT_REAL,
+   TA_STREAM_INPUT_HL,
+   TA_STREAM_INPUT_HLC,
+   TA_STREAM_INPUT_HLCV
+} TA_StreamInput;
+
+/* One EMA of the stream (see emaAdd). */
+typedef struct
+{
+   int    nbValue;   /* Values added so far. */
+   double sum;       /* Sum of the initial period. */
+   double prevMA;
+} TA_StreamEMA;
+
+/* Variables evolving as price bars are added.
+ * All are zero when the stream is allocated or reset.
+ */
+typedef struct
+{
+   double prevValue;
+   double prevHigh;
+   double prevLow;
+   double prevClose;
+
+   double sum;       /* Sum of the initial period. */
+   double prevMA;    /* KAMA.                      */
+
+   TA_StreamEMA ema[3]; /* EMA, DEMA, TEMA, TRIX, MACD and ADOSC. */
+
+   double prevGain;  /* RSI and CMO. */
+   double prevLoss;
+
+   double sumROC1;   /* KAMA. */
+   double trailingValue;
+
+   double e[6];      /* T3. */
+   int    nbSeeded;
+   int    phaseCount;
+
+   double prevTR;    /* ATR, NATR and the DM family. */
+   double prevPlusDM;
+   double prevMinusDM;
+   double sumDX;
+   double prevADX;
+
+   int    nbADX;     /* ADXR. */
+
+   int    isLong;    /* SAR. */
+   double af;
+   double ep;
+   double sar;
+
+   double ad;        /* ADOSC. */
+} TA_StreamVar;
+
+struct TA_Stream
+{
+   unsigned int magicNb;
+   TA_StreamId    id;
+   TA_StreamInput input;
+
+   /* Settings captured when the stream was allocated. */
+   int              optInTimePeriod;
+   int              unstablePeriod;
+   TA_Compatibility compatibility;
+   int              lookback;
+   int              adxLookback; /* ADXR only. */
+
+   double k;         /* T3. */
+   double one_minus_k;
+   double c1, c2, c3, c4;
+
+   /* Period, lookback and k of each EMA in var.ema[]. These are the
+    * cascaded EMA of the DEMA, TEMA and TRIX, the fast, slow and
+    * signal EMA of the MACD and the fast and slow EMA of the ADOSC.
+    */
+   int    emaPeriod[3];
+   int    emaLookback[3];
+   double emaK[3];
+   int    fastEMADelay; /* MACD only. First bar of the fast EMA. */
+
+   double optInAcceleration; /* SAR. */
+   double optInMaximum;
+
+   /* Circular buffer of optInTimePeriod values (KAMA and ADXR). */
+   double *window;
+
+   int    nbBars;    /* Number of price bar added so far. */
+   int    nbOutput;
+   double lastOutput[TA_STREAM_MAX_OUTPUT];
+
+   TA_StreamVar var;
+};
+
+/* Same as TRUE_RANGE in ta_ADX.c */
+#define STREAM_TRUE_RANGE(TH,TL,YC,OUT) {\
+      OUT = TH-TL; \
+      tempReal2 = std_fabs(TH-YC); \
+      if( tempReal2 > OUT ) \
+         OUT = tempReal2; \
+      tempReal2 = std_fabs(TL-YC); \
+      if( tempReal2 > OUT ) \
+         OUT = tempReal2; \
+   }
+
+/* Same as ta_SAR.c */
+#define SAR_ROUNDING(x)
+
+/* Validate and apply the default of an optInTimePeriod. */
+#define STREAM_CHECK_PERIOD(period,defaultValue,minValue) \
+   { \
+      if( (int)period == TA_INTEGER_DEFAULT ) \
+         period = defaultValue; \
+      else if( ((int)period < minValue) || ((int)period > 100000) ) \
+         return TA_BAD_PARAM; \
+   }
+
+/**** Local functions declarations.    ****/
+static TA_RetCode streamAlloc( TA_StreamId id,
+                               TA_StreamInput input,
+                               int optInTimePeriod,
+                               int unstablePeriod,
+                               int lookback,
+                               int windowSize,
+                               TA_Stream **stream );
+
+static TA_RetCode macdAlloc( int optInFastPeriod,
+                             int optInSlowPeriod,
+                             int optInSignalPeriod,
+                             TA_Stream **stream );
+
+static TA_RetCode checkUpdate( const TA_Stream *stream, TA_StreamInput input );
+static void       setEMA     ( TA_Stream *stream, int i, int period, double k );
+static int        emaAdd     ( TA_Stream *stream, int i, double value );
+
+static void updateEMA ( TA_Stream *stream, double inReal );
+static void updateRSI ( TA_Stream *stream, double inReal );
+static void updateKAMA( TA_Stream *stream, double inReal );
+static void updateT3  ( TA_Stream *stream, double inReal );
+static void updateATR ( TA_Stream *stream, double inHigh, double inLow, double inClose );
+static void updateDM  ( TA_Stream *stream, double inHigh, double inLow, double inClose );
+static void updateADX ( TA_Stream *stream, double inHigh, double inLow, double inClose );
+static void updateCascade( TA_Stream *stream, double inReal );
+static void updateMACD ( TA_Stream *stream, double inReal );
+static void updateSAR  ( TA_Stream *stream, double inHigh, double inLow );
+static void updateADOSC( TA_Stream *stream, double inHigh, double inLow, double inClose, double inVolume );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_EMA_StreamAlloc( int optInTimePeriod, TA_Stream **stream )
+{
+   TA_RetCode retCode;
+
+   if( !stream )
+      return TA_BAD_PARAM;
+   STREAM_CHECK_PERIOD( optInTimePeriod, 30, 2 );
+
+   retCode = streamAlloc( TA_STREAM_EMA, TA_STREAM_INPUT_REAL, optInTimePeriod,
+                          TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_EMA,Ema),
+                          LOOKBACK_CALL(EMA)(optInTimePeriod), 0, stream );
+   if( retCode == TA_SUCCESS )
+      setEMA( *stream, 0, optInTimePeriod, PER_TO_K(optInTimePeriod) );
+
+   return retCode;
+}
+
+TA_RetCode TA_RSI_StreamAlloc( int optInTimePeriod, TA_Stream **stream )
+{
+   if( !stream )
+      return TA_BAD_PARAM;
+   STREAM_CHECK_PERIOD( optInTimePeriod, 14, 2 );
+
+   return streamAlloc( TA_STREAM_RSI, TA_STREAM_INPUT_REAL, optInTimePeriod,
+                       TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_RSI,Rsi),
+                       LOOKBACK_CALL(RSI)(optInTimePeriod), 0, stream );
+}
+
+TA_RetCode TA_CMO_StreamAlloc( int optInTimePeriod, TA_Stream **stream )
+{
+   if( !stream )
+      return TA_BAD_PARAM;
+   STREAM_CHECK_PERIOD( optInTimePeriod, 14, 2 );
+
+   return streamAlloc( TA_STREAM_CMO, TA_STREAM_INPUT_REAL, optInTimePeriod,
+                       TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_CMO,Cmo),
+                       LOOKBACK_CALL(CMO)(optInTimePeriod), 0, stream );
+}
+
+TA_RetCode TA_KAMA_StreamAlloc( int optInTimePeriod, TA_Stream **stream )
+{
+   if( !stream )
+      return TA_BAD_PARAM;
+   STREAM_CHECK_PERIOD( optInTimePeriod, 30, 2 );
+
+   return streamAlloc( TA_STREAM_KAMA, TA_STREAM_INPUT_REAL, optInTimePeriod,
+                       TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_KAMA,Kama),
+                       LOOKBACK_CALL(KAMA)(optInTimePeriod),
+                       optInTimePeriod, stream );
+}
+
+TA_RetCode TA_T3_StreamAlloc( int optInTimePeriod, double optInVFactor, TA_Stream **stream )
+{
+   TA_RetCode retCode;
+   TA_Stream *newStream;
+   double tempReal;
+
+   if( !stream )
+      return TA_BAD_PARAM;
+   STREAM_CHECK_PERIOD( optInTimePeriod, 5, 2 );
+
+   if( optInVFactor == TA_REAL_DEFAULT )
+      optInVFactor = 7.000000e-1;
+   else if( (optInVFactor < 0.000000e+0) || (optInVFactor > 1.000000e+0) )
+      return TA_BAD_PARAM;
+
+   retCode = streamAlloc( TA_STREAM_T3, TA_STREAM_INPUT_REAL, optInTimePeriod,
+                          TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_T3,T3),
+                          LOOKBACK_CALL(T3)(optInTimePeriod,optInVFactor),
+                          0, stream );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   /* Same constants as calculated in TA_T3. */
+   newStream = *stream;
+   newStream->k           = 2.0/(optInTimePeriod+1.0);
+   newStream->one_minus_k = 1.0-newStream->k;
+
+   tempReal = optInVFactor * optInVFactor;
+   newStream->c1 = -(tempReal * optInVFactor);
+   newStream->c2 = 3.0 * (tempReal - newStream->c1);
+   newStream->c3 = -6.0 * tempReal - 3.0 * (optInVFactor-newStream->c1);
+   newStream->c4 = 1.0 + 3.0 * optInVFactor - newStream->c1 + 3.0 * tempReal;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_TRANGE_StreamAlloc( TA_Stream **stream )
+{
+   if( !stream )
+      return TA_BAD_PARAM;
+
+   return streamAlloc( TA_STREAM_TRANGE, TA_STREAM_INPUT_HLC, 1, 0,
+                       LOOKBACK_CALL(TRANGE)(), 0, stream );
+}
+
+TA_RetCode TA_ATR_StreamAlloc( int optInTimePeriod, TA_Stream **stream )
+{
+   if( !stream )
+      return TA_BAD_PARAM;
+   STREAM_CHECK_PERIOD( optInTimePeriod, 14, 1 );
+
+   return streamAlloc( TA_STREAM_ATR, TA_STREAM_INPUT_HLC, optInTimePeriod,
+                       TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_ATR,Atr),
+                       LOOKBACK_CALL(ATR)(optInTimePeriod), 0, stream );
+}
+
+TA_RetCode TA_NATR_StreamAlloc( int optInTimePeriod, TA_Stream **stream )
+{
+   if( !stream )
+      return TA_BAD_PARAM;
+   STREAM_CHECK_PERIOD( optInTimePeriod, 14, 1 );
+
+   return streamAlloc( TA_STREAM_NATR, TA_STREAM_INPUT_HLC, optInTimePeriod,
+                       TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_NATR,Natr),
+                       LOOKBACK_CALL(NATR)(optInTimePeriod), 0, stream );
+}
+
+TA_RetCode TA_PLUS_DM_StreamAlloc( int optInTimePeriod, TA_Stream **stream )
+{
+   if( !stream )
+      return TA_BAD_PARAM;
+   STREAM_CHECK_PERIOD( optInTimePeriod, 14, 1 );
+
+   return streamAlloc( TA_STREAM_PLUS_DM, TA_STREAM_INPUT_HLC, optInTimePeriod,
+                       TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_PLUS_DM,PlusDM),
+                       LOOKBACK_CALL(PLUS_DM)(optInTimePeriod), 0, stream );
+}
+
+TA_RetCode TA_MINUS_DM_StreamAlloc( int optInTimePeriod, TA_Stream **stream )
+{
+   if( !stream )
+      return TA_BAD_PARAM;
+   STREAM_CHECK_PERIOD( optInTimePeriod, 14, 1 );
+
+   return streamAlloc( TA_STREAM_MINUS_DM, TA_STREAM_INPUT_HLC, optInTimePeriod,
+                       TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_MINUS_DM,MinusDM),
+                       LOOKBACK_CALL(MINUS_DM)(optInTimePeriod), 0, stream );
+}
+
+TA_RetCode TA_PLUS_DI_StreamAlloc( int optInTimePeriod, TA_Stream **stream )
+{
+   if( !stream )
+      return TA_BAD_PARAM;
+   STREAM_CHECK_PERIOD( optInTimePeriod, 14, 1 );
+
+   return streamAlloc( TA_STREAM_PLUS_DI, TA_STREAM_INPUT_HLC, optInTimePeriod,
+                       TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_PLUS_DI,PlusDI),
+                       LOOKBACK_CALL(PLUS_DI)(optInTimePeriod), 0, stream );
+}
+
+TA_RetCode TA_MINUS_DI_StreamAlloc( int optInTimePeriod, TA_Stream **stream )
+{
+   if( !stream )
+      return TA_BAD_PARAM;
+   STREAM_CHECK_PERIOD( optInTimePeriod, 14, 1 );
+
+   return streamAlloc( TA_STREAM_MINUS_DI, TA_STREAM_INPUT_HLC, optInTimePeriod,
+                       TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_MINUS_DI,MinusDI),
+                       LOOKBACK_CALL(MINUS_DI)(optInTimePeriod), 0, stream );
+}
+
+TA_RetCode TA_DX_StreamAlloc( int optInTimePeriod, TA_Stream **stream )
+{
+   if( !stream )
+      return TA_BAD_PARAM;
+   STREAM_CHECK_PERIOD( optInTimePeriod, 14, 2 );
+
+   return streamAlloc( TA_STREAM_DX, TA_STREAM_INPUT_HLC, optInTimePeriod,
+                       TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_DX,Dx),
+                       LOOKBACK_CALL(DX)(optInTimePeriod), 0, stream );
+}
+
+TA_RetCode TA_ADX_StreamAlloc( int optInTimePeriod, TA_Stream **stream )
+{
+   if( !stream )
+      return TA_BAD_PARAM;
+   STREAM_CHECK_PERIOD( optInTimePeriod, 14, 2 );
+
+   return streamAlloc( TA_STREAM_ADX, TA_STREAM_INPUT_HLC, optInTimePeriod,
+                       TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_ADX,Adx),
+                       LOOKBACK_CALL(ADX)(optInTimePeriod), 0, stream );
+}
+
+TA_RetCode TA_ADXR_StreamAlloc( int optInTimePeriod, TA_Stream **stream )
+{
+   TA_RetCode retCode;
+
+   if( !stream )
+      return TA_BAD_PARAM;
+   STREAM_CHECK_PERIOD( optInTimePeriod, 14, 2 );
+
+   /* The ADXR embeds an ADX. Keep the last 'optInTimePeriod'
+    * ADX values in the window.
+    */
+   retCode = streamAlloc( TA_STREAM_ADXR, TA_STREAM_INPUT_HLC, optInTimePeriod,
+                          TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_ADX,Adx),
+                          LOOKBACK_CALL(ADXR)(optInTimePeriod),
+                          optInTimePeriod, stream );
+   if( retCode == TA_SUCCESS )
+      (*stream)->adxLookback = LOOKBACK_CALL(ADX)(optInTimePeriod);
+
+   return retCode;
+}
+
+TA_RetCode TA_DEMA_StreamAlloc( int optInTimePeriod, TA_Stream **stream )
+{
+   TA_RetCode retCode;
+   int i;
+
+   if( !stream )
+      return TA_BAD_PARAM;
+   STREAM_CHECK_PERIOD( optInTimePeriod, 30, 2 );
+
+   retCode = streamAlloc( TA_STREAM_DEMA, TA_STREAM_INPUT_REAL, optInTimePeriod,
+                          TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_EMA,Ema),
+                          LOOKBACK_CALL(DEMA)(optInTimePeriod), 0, stream );
+   if( retCode == TA_SUCCESS )
+   {
+      for( i=0; i < 2; i++ )
+         setEMA( *stream, i, optInTimePeriod, PER_TO_K(optInTimePeriod) );
+   }
+
+   return retCode;
+}
+
+TA_RetCode TA_TEMA_StreamAlloc( int optInTimePeriod, TA_Stream **stream )
+{
+   TA_RetCode retCode;
+   int i;
+
+   if( !stream )
+      return TA_BAD_PARAM;
+   STREAM_CHECK_PERIOD( optInTimePeriod, 30, 2 );
+
+   retCode = streamAlloc( TA_STREAM_TEMA, TA_STREAM_INPUT_REAL, optInTimePeriod,
+                          TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_EMA,Ema),
+                          LOOKBACK_CALL(TEMA)(optInTimePeriod), 0, stream );
+   if( retCode == TA_SUCCESS )
+   {
+      for( i=0; i < 3; i++ )
+         setEMA( *stream, i, optInTimePeriod, PER_TO_K(optInTimePeriod) );
+   }
+
+   return retCode;
+}
+
+TA_RetCode TA_TRIX_StreamAlloc( int optInTimePeriod, TA_Stream **stream )
+{
+   TA_RetCode retCode;
+   int i;
+
+   if( !stream )
+      return TA_BAD_PARAM;
+   STREAM_CHECK_PERIOD( optInTimePeriod, 30, 1 );
+
+   /* A period of 1 has no EMA lookback and is rejected
+    * by streamAlloc, same as TA_TRIX_Lookback.
+    */
+   retCode = streamAlloc( TA_STREAM_TRIX, TA_STREAM_INPUT_REAL, optInTimePeriod,
+                          TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_EMA,Ema),
+                          LOOKBACK_CALL(TRIX)(optInTimePeriod), 0, stream );
+   if( retCode == TA_SUCCESS )
+   {
+      for( i=0; i < 3; i++ )
+         setEMA( *stream, i, optInTimePeriod, PER_TO_K(optInTimePeriod) );
+   }
+
+   return retCode;
+}
+
+TA_RetCode TA_MACD_StreamAlloc( int optInFastPeriod,
+                                int optInSlowPeriod,
+                                int optInSignalPeriod,
+                                TA_Stream **stream )
+{
+   if( !stream )
+      return TA_BAD_PARAM;
+   STREAM_CHECK_PERIOD( optInFastPeriod, 12, 2 );
+   STREAM_CHECK_PERIOD( optInSlowPeriod, 26, 2 );
+
+   /* TA_MACD accepts a signal period of 1, but TA_EMA_Lookback
+    * does not and the batch output is then unreliable. Refuse it.
+    */
+   STREAM_CHECK_PERIOD( optInSignalPeriod, 9, 2 );
+
+   return macdAlloc( optInFastPeriod, optInSlowPeriod, optInSignalPeriod, stream );
+}
+
+TA_RetCode TA_MACDFIX_StreamAlloc( int optInSignalPeriod, TA_Stream **stream )
+{
+   if( !stream )
+      return TA_BAD_PARAM;
+   STREAM_CHECK_PERIOD( optInSignalPeriod, 9, 2 ); /* See TA_MACD_StreamAlloc. */
+
+   return macdAlloc( 0, 0, optInSignalPeriod, stream );
+}
+
+TA_RetCode TA_SAR_StreamAlloc( double optInAcceleration,
+                               double optInMaximum,
+                               TA_Stream **stream )
+{
+   TA_RetCode retCode;
+
+   if( !stream )
+      return TA_BAD_PARAM;
+
+   if( optInAcceleration == TA_REAL_DEFAULT )
+      optInAcceleration = 2.000000e-2;
+   else if( (optInAcceleration < 0.000000e+0) || (optInAcceleration > 3.000000e+37) )
+      return TA_BAD_PARAM;
+
+   if( optInMaximum == TA_REAL_DEFAULT )
+      optInMaximum = 2.000000e-1;
+   else if( (optInMaximum < 0.000000e+0) || (optInMaximum > 3.000000e+37) )
+      return TA_BAD_PARAM;
+
+   retCode = streamAlloc( TA_STREAM_SAR, TA_STREAM_INPUT_HL, 1, 0,
+                          LOOKBACK_CALL(SAR)(optInAcceleration,optInMaximum),
+                          0, stream );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   /* Same correction as TA_SAR when the acceleration
+    * is above the maximum.
+    */
+   if( optInAcceleration > optInMaximum )
+      optInAcceleration = optInMaximum;
+
+   (*stream)->optInAcceleration = optInAcceleration;
+   (*stream)->optInMaximum      = optInMaximum;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ADOSC_StreamAlloc( int optInFastPeriod,
+                                 int optInSlowPeriod,
+                                 TA_Stream **stream )
+{
+   TA_RetCode retCode;
+
+   if( !stream )
+      return TA_BAD_PARAM;
+   STREAM_CHECK_PERIOD( optInFastPeriod, 3, 2 );
+   STREAM_CHECK_PERIOD( optInSlowPeriod, 10, 2 );
+
+   retCode = streamAlloc( TA_STREAM_ADOSC, TA_STREAM_INPUT_HLCV, optInFastPeriod,
+                          TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_EMA,Ema),
+                          LOOKBACK_CALL(ADOSC)(optInFastPeriod,optInSlowPeriod),
+                          0, stream );
+   if( retCode == TA_SUCCESS )
+   {
+      setEMA( *stream, 0, optInFastPeriod, PER_TO_K(optInFastPeriod) );
+      setEMA( *stream, 1, optInSlowPeriod, PER_TO_K(optInSlowPeriod) );
+   }
+
+   return retCode;
+}
+
+TA_RetCode TA_StreamFree( TA_Stream *stream )
+{
+   if( !stream )
+      return TA_SUCCESS;
+
+   if( stream->magicNb != TA_STREAM_MAGIC_NB )
+      return TA_BAD_OBJECT;
+
+   stream->magicNb = 0;
+   FREE_IF_NOT_NULL( stream->window );
+   TA_Free( stream );
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_StreamReset( TA_Stream *stream )
+{
+   if( !stream )
+      return TA_BAD_PARAM;
+
+   if( stream->magicNb != TA_STREAM_MAGIC_NB )
+      return TA_BAD_OBJECT;
+
+   memset( &stream->var, 0, sizeof(TA_StreamVar) );
+   stream->nbBars     = 0;
+   stream->lastOutput[0] = 0.0;
+
+   return TA_SUCCESS;
+}
+
+int TA_StreamLookback( const TA_Stream *stream )
+{
+   if( !stream || (stream->magicNb != TA_STREAM_MAGIC_NB) )
+      return -1;
+
+   return stream->lookback;
+}
+
+int TA_StreamNbOutput( const TA_Stream *stream )
+{
+   if( !stream || (stream->magicNb != TA_STREAM_MAGIC_NB) )
+      return -1;
+
+   return stream->nbOutput;
+}
+
+TA_RetCode TA_StreamUpdate( TA_Stream *stream,
+                            double     inReal,
+                            int       *outNBElement,
+                            double    *outReal )
+{
+   TA_RetCode retCode;
+
+   retCode = checkUpdate( stream, TA_STREAM_INPUT_REAL );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   switch( stream->id )
+   {
+   case TA_STREAM_EMA:
+      updateEMA( stream, inReal );
+      break;
+   case TA_STREAM_RSI:
+   case TA_STREAM_CMO:
+      updateRSI( stream, inReal );
+      break;
+   case TA_STREAM_KAMA:
+      updateKAMA( stream, inReal );
+      break;
+   case TA_STREAM_T3:
+      updateT3( stream, inReal );
+      break;
+   case TA_STREAM_DEMA:
+   case TA_STREAM_TEMA:
+   case TA_STREAM_TRIX:
+      updateCascade( stream, inReal );
+      break;
+   case TA_STREAM_MACD:
+      updateMACD( stream, inReal );
+      break;
+   default:
+      return TA_INTERNAL_ERROR(181);
+   }
+   stream->nbBars++;
+
+   return TA_StreamPeek( stream, outNBElement, outReal );
+}
+
+TA_RetCode TA_StreamUpdateHLC( TA_Stream *stream,
+                               double     inHigh,
+                               double     inLow,
+                               double     inClose,
+                               int       *outNBElement,
+                               double    *outReal )
+{
+   TA_RetCode retCode;
+
+   retCode = checkUpdate( stream, TA_STREAM_INPUT_HLC );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   switch( stream->id )
+   {
+   case TA_STREAM_TRANGE:
+   case TA_STREAM_ATR:
+   case TA_STREAM_NATR:
+      updateATR( stream, inHigh, inLow, inClose );
+      break;
+   case TA_STREAM_PLUS_DM:
+   case TA_STREAM_MINUS_DM:
+   case TA_STREAM_PLUS_DI:
+   case TA_STREAM_MINUS_DI:
+   case TA_STREAM_DX:
+      updateDM( stream, inHigh, inLow, inClose );
+      break;
+   case TA_STREAM_ADX:
+   case TA_STREAM_ADXR:
+      updateADX( stream, inHigh, inLow, inClose );
+      break;
+   default:
+      return TA_INTERNAL_ERROR(182);
+   }
+   stream->nbBars++;
+
+   return TA_StreamPeek( stream, outNBElement, outReal );
+}
+
+TA_RetCode TA_StreamUpdateHL( TA_Stream *stream,
+                              double     inHigh,
+                              double     inLow,
+                              int       *outNBElement,
+                              double    *outReal )
+{
+   TA_RetCode retCode;
+
+   retCode = checkUpdate( stream, TA_STREAM_INPUT_HL );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   switch( stream->id )
+   {
+   case TA_STREAM_SAR:
+      updateSAR( stream, inHigh, inLow );
+      break;
+   default:
+      return TA_INTERNAL_ERROR(186);
+   }
+   stream->nbBars++;
+
+   return TA_StreamPeek( stream, outNBElement, outReal );
+}
+
+TA_RetCode TA_StreamUpdateHLCV( TA_Stream *stream,
+                                double     inHigh,
+                                double     inLow,
+                                double     inClose,
+                                double     inVolume,
+                                int       *outNBElement,
+                                double    *outReal )
+{
+   TA_RetCode retCode;
+
+   retCode = checkUpdate( stream, TA_STREAM_INPUT_HLCV );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   switch( stream->id )
+   {
+   case TA_STREAM_ADOSC:
+      updateADOSC( stream, inHigh, inLow, inClose, inVolume );
+      break;
+   default:
+      return TA_INTERNAL_ERROR(187);
+   }
+   stream->nbBars++;
+
+   return TA_StreamPeek( stream, outNBElement, outReal );
+}
+
+TA_RetCode TA_StreamPeek( const TA_Stream *stream,
+                          int             *outNBElement,
+                          double          *outReal )
+{
+   int isAvailable;
+
+   if( !stream )
+      return TA_BAD_PARAM;
+
+   if( stream->magicNb != TA_STREAM_MAGIC_NB )
+      return TA_BAD_OBJECT;
+
+   isAvailable = (stream->nbBars > stream->lookback);
+
+   if( outNBElement )
+      *outNBElement = isAvailable;
+
+   if( outReal && isAvailable )
+      *outReal = stream->lastOutput[0];
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_StreamPeekAll( const TA_Stream *stream,
+                             int             *outNBElement,
+                             double           outReal[] )
+{
+   int i, nbOutput;
+
+   if( !stream )
+      return TA_BAD_PARAM;
+
+   if( stream->magicNb != TA_STREAM_MAGIC_NB )
+      return TA_BAD_OBJECT;
+
+   nbOutput = (stream->nbBars > stream->lookback)? stream->nbOutput : 0;
+
+   if( outNBElement )
+      *outNBElement = nbOutput;
+
+   if( outReal )
+   {
+      for( i=0; i < nbOutput; i++ )
+         outReal[i] = stream->lastOutput[i];
+   }
+
+   return TA_SUCCESS;
+}
+
+/**** Local functions definitions.     ****/
+static TA_RetCode streamAlloc( TA_StreamId id,
+                               TA_StreamInput input,
+                               int optInTimePeriod,
+                               int unstablePeriod,
+                               int lookback,
+                               int windowSize,
+                               TA_Stream **stream )
+{
+   TA_Stream *newStream;
+
+   *stream = NULL;
+
+   if( lookback < 0 )
+      return TA_BAD_PARAM;
+
+   newStream = (TA_Stream *)TA_Malloc( sizeof(TA_Stream) );
+   if( !newStream )
+      return TA_ALLOC_ERR;
+
+   memset( newStream, 0, sizeof(TA_Stream) );
+
+   if( windowSize > 0 )
+   {
+      newStream->window = (double *)TA_Malloc( sizeof(double)*windowSize );
+      if( !newStream->window )
+      {
+         TA_Free( newStream );
+         return TA_ALLOC_ERR;
+      }
+   }
+
+   newStream->magicNb         = TA_STREAM_MAGIC_NB;
+   newStream->id              = id;
+   newStream->input           = input;
+   newStream->optInTimePeriod = optInTimePeriod;
+   newStream->unstablePeriod  = unstablePeriod;
+   newStream->compatibility   = TA_GLOBALS_COMPATIBILITY;
+   newStream->lookback        = lookback;
+   newStream->nbOutput        = 1;
+
+   *stream = newStream;
+
+   return TA_SUCCESS;
+}
+
+/* Same setup as TA_INT_MACD. A period of 0 is for the
+ * fix 12/26 MACD (TA_MACDFIX).
+ */
+static TA_RetCode macdAlloc( int optInFastPeriod,
+                             int optInSlowPeriod,
+                             int optInSignalPeriod,
+                             TA_Stream **stream )
+{
+   TA_RetCode retCode;
+   TA_Stream *newStream;
+   double k1, k2;
+   int tempInteger;
+
+   /* Make sure slow is really slower than
+    * the fast period! if not, swap...
+    */
+   if( optInSlowPeriod < optInFastPeriod )
+   {
+      tempInteger     = optInSlowPeriod;
+      optInSlowPeriod = optInFastPeriod;
+      optInFastPeriod = tempInteger;
+   }
+
+   if( optInSlowPeriod != 0 )
+      k1 = PER_TO_K(optInSlowPeriod);
+   else
+   {
+      optInSlowPeriod = 26;
+      k1 = (double)0.075; /* Fix 26 */
+   }
+
+   if( optInFastPeriod != 0 )
+      k2 = PER_TO_K(optInFastPeriod);
+   else
+   {
+      optInFastPeriod = 12;
+      k2 = (double)0.15; /* Fix 12 */
+   }
+
+   retCode = streamAlloc( TA_STREAM_MACD, TA_STREAM_INPUT_REAL, optInSignalPeriod,
+                          TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_EMA,Ema),
+                          LOOKBACK_CALL(EMA)(optInSignalPeriod)+LOOKBACK_CALL(EMA)(optInSlowPeriod),
+                          0, stream );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   newStream = *stream;
+   newStream->nbOutput = 3;
+   setEMA( newStream, 0, optInFastPeriod, k2 );
+   setEMA( newStream, 1, optInSlowPeriod, k1 );
+   setEMA( newStream, 2, optInSignalPeriod, PER_TO_K(optInSignalPeriod) );
+
+   /* TA_INT_MACD calculates both EMA from the same startIdx. Except
+    * for Metastock, the fast EMA is therefore seeded with the bars
+    * ending its initial period on the same bar as the slow EMA.
+    */
+   if( newStream->compatibility == TA_COMPATIBILITY_DEFAULT )
+      newStream->fastEMADelay = newStream->emaLookback[1]-newStream->emaLookback[0];
+
+   return TA_SUCCESS;
+}
+
+static TA_RetCode checkUpdate( const TA_Stream *stream, TA_StreamInput input )
+{
+   if( !stream )
+      return TA_BAD_PARAM;
+
+   if( stream->magicNb != TA_STREAM_MAGIC_NB )
+      return TA_BAD_OBJECT;
+
+   if( stream->input != input )
+      return TA_BAD_PARAM;
+
+   return TA_SUCCESS;
+}
+
+static void setEMA( TA_Stream *stream, int i, int period, double k )
+{
+   stream->emaPeriod[i]   = period;
+   stream->emaLookback[i] = LOOKBACK_CALL(EMA)(period);
+   stream->emaK[i]        = k;
+}
+
+/* Add a value to the EMA var.ema[i]. See TA_INT_EMA.
+ *
+ * Returns non-zero when the EMA has an output, meaning its
+ * lookback (including the unstable period) is satisfied.
+ */
+static int emaAdd( TA_Stream *stream, int i, double value )
+{
+   TA_StreamEMA *ema = &stream->var.ema[i];
+   int period = stream->emaPeriod[i];
+
+   if( stream->compatibility == TA_COMPATIBILITY_DEFAULT )
+   {
+      /* The seed is the simple average of the first period. */
+      if( ema->nbValue < period )
+      {
+         ema->sum += value;
+         if( ema->nbValue == period-1 )
+            ema->prevMA = ema->sum / period;
+      }
+      else
+         ema->prevMA = TA_EMA_STEP(ema->prevMA,value,stream->emaK[i]);
+   }
+   else
+   {
+      /* Metastock use the first value as the seed. */
+      if( ema->nbValue == 0 )
+         ema->prevMA = value;
+      else
+         ema->prevMA = TA_EMA_STEP(ema->prevMA,value,stream->emaK[i]);
+   }
+
+   return (ema->nbValue++ >= stream->emaLookback[i]);
+}
+
+/* See TA_EMA. */
+static void updateEMA( TA_Stream *stream, double inReal )
+{
+   emaAdd( stream, 0, inReal );
+   stream->lastOutput[0] = stream->var.ema[0].prevMA;
+}
+
+/* See TA_RSI and TA_CMO. */
+static void updateRSI( TA_Stream *stream, double inReal )
+{
+   TA_StreamVar *var = &stream->var;
+   int today = stream->nbBars;
+   int optInTimePeriod = stream->optInTimePeriod;
+   int isCMO = (stream->id == TA_STREAM_CMO);
+   double tempValue1, tempValue2, tempValue3, tempValue4;
+
+   if( today == 0 )
+   {
+      var->prevValue = inReal;
+      return;
+   }
+
+   tempValue2 = inReal - var->prevValue;
+   var->prevValue = inReal;
+
+   if( today <= optInTimePeriod )
+   {
+      /* Accumulate the initial "Average Gain" and "Average Loss". */
+      TA_GAIN_LOSS_ADD(var->prevGain,var->prevLoss,tempValue2);
+
+      if( today == optInTimePeriod-1 )
+      {
+         /* First output particular to Metastock when there is no
+          * unstable period. This bar is otherwise never output.
+          */
+         if( (stream->unstablePeriod == 0) &&
+             (stream->compatibility == TA_COMPATIBILITY_METASTOCK) )
+         {
+            tempValue1 = var->prevLoss/optInTimePeriod;
+            tempValue2 = var->prevGain/optInTimePeriod;
+            if( isCMO )
+            {
+               tempValue3 = tempValue2-tempValue1;
+               tempValue4 = tempValue1+tempValue2;
+               if( !TA_IS_ZERO(tempValue4) )
+                  stream->lastOutput[0] = 100*(tempValue3/tempValue4);
+               else
+                  stream->lastOutput[0] = 0.0;
+            }
+            else
+            {
+               tempValue1 = tempValue2+tempValue1;
+               if( !TA_IS_ZERO(tempValue1) )
+                  stream->lastOutput[0] = 100*(tempValue2/tempValue1);
+               else
+                  stream->lastOutput[0] = 0.0;
+            }
+         }
+         return;
+      }
+
+      if( today < optInTimePeriod )
+         return;
+
+      var->prevLoss /= optInTimePeriod;
+      var->prevGain /= optInTimePeriod;
+   }
+   else
+   {
+      /* Wilder's smoothing. */
+      TA_GAIN_LOSS_STEP(var->prevGain,var->prevLoss,tempValue2,optInTimePeriod);
+   }
+
+   tempValue1 = var->prevGain+var->prevLoss;
+   if( TA_IS_ZERO(tempValue1) )
+      stream->lastOutput[0] = 0.0;
+   else if( isCMO )
+      stream->lastOutput[0] = 100.0*((var->prevGain-var->prevLoss)/tempValue1);
+   else
+      stream->lastOutput[0] = 100.0*(var->prevGain/tempValue1);
+}
+
+/* See TA_KAMA. */
+static void updateKAMA( TA_Stream *stream, double inReal )
+{
+   CONSTANT_DOUBLE(constMax) = 2.0/(30.0+1.0);
+   CONSTANT_DOUBLE(constDiff) = 2.0/(2.0+1.0) - constMax;
+
+   TA_StreamVar *var = &stream->var;
+   int today = stream->nbBars;
+   int optInTimePeriod = stream->optInTimePeriod;
+   int windowIdx = today % optInTimePeriod;
+   double tempReal, tempReal2, periodROC;
+
+   if( today > 0 )
+   {
+      /* Summation of the 1-day price difference. */
+      tempReal = var->prevValue - inReal;
+      if( today <= optInTimePeriod )
+         var->sumROC1 += std_fabs(tempReal);
+   }
+
+   if( today < optInTimePeriod )
+   {
+      stream->window[windowIdx] = inReal;
+      var->prevValue = inReal;
+      return;
+   }
+
+   /* The window contains the 'optInTimePeriod' last values,
+    * so the oldest one is at the slot about to be overwritten.
+    */
+   tempReal2 = stream->window[windowIdx];
+   periodROC = inReal-tempReal2;
+
+   if( today == optInTimePeriod )
+   {
+      /* The yesterday price is used as the first previous KAMA. */
+      var->prevMA = var->prevValue;
+   }
+   else
+   {
+      /* Adjust sumROC1:
+       *  - Remove trailing ROC1
+       *  - Add new ROC1
+       */
+      TA_KAMA_ROC_STEP(var->sumROC1,var->trailingValue,tempReal2,inReal,var->prevValue);
+   }
+   var->trailingValue = tempReal2;
+
+   TA_KAMA_STEP(var->prevMA,inReal,periodROC,var->sumROC1,tempReal,constMax,constDiff);
+
+   stream->window[windowIdx] = inReal;
+   var->prevValue = inReal;
+   stream->lastOutput[0] = var->prevMA;
+}
+
+/* See TA_T3. The six EMA are seeded one after the other,
+ * each one from the average of the first period of the
+ * previous one.
+ */
+static void updateT3( TA_Stream *stream, double inReal )
+{
+   TA_StreamVar *var = &stream->var;
+   double *e = var->e;
+   double k = stream->k;
+   double one_minus_k = stream->one_minus_k;
+   int optInTimePeriod = stream->optInTimePeriod;
+   int i;
+
+   if( var->nbSeeded == 0 )
+   {
+      if( stream->nbBars == 0 )
+         var->sum = inReal;
+      else
+         var->sum += inReal;
+
+      if( stream->nbBars == optInTimePeriod-1 )
+      {
+         e[0] = var->sum / optInTimePeriod;
+         var->sum = e[0];
+         var->nbSeeded = 1;
+      }
+      return;
+   }
+
+   e[0] = TA_T3_EMA_STEP(e[0],inReal,k,one_minus_k);
+   for( i=1; i < var->nbSeeded; i++ )
+      e[i] = TA_T3_EMA_STEP(e[i],e[i-1],k,one_minus_k);
+
+   if( var->nbSeeded < 6 )
+   {
+      var->sum += e[var->nbSeeded-1];
+      if( ++var->phaseCount == optInTimePeriod-1 )
+      {
+         e[var->nbSeeded] = var->sum / optInTimePeriod;
+         var->sum = e[var->nbSeeded];
+         var->nbSeeded++;
+         var->phaseCount = 0;
+      }
+      if( var->nbSeeded < 6 )
+         return;
+   }
+
+   stream->lastOutput[0] = TA_T3_VALUE(e[2],e[3],e[4],e[5],stream->c1,stream->c2,stream->c3,stream->c4);
+}
+
+/* See TA_TRANGE, TA_ATR and TA_NATR. */
+static void updateATR( TA_Stream *stream, double inHigh, double inLow, double inClose )
+{
+   TA_StreamVar *var = &stream->var;
+   int today = stream->nbBars;
+   int optInTimePeriod = stream->optInTimePeriod;
+   double tempReal, tempReal2;
+
+   if( today == 0 )
+   {
+      var->prevClose = inClose;
+      return;
+   }
+
+   STREAM_TRUE_RANGE(inHigh,inLow,var->prevClose,tempReal);
+   var->prevClose = inClose;
+
+   /* No smoothing needed when the period is 1. */
+   if( (stream->id == TA_STREAM_TRANGE) || (optInTimePeriod <= 1) )
+   {
+      stream->lastOutput[0] = tempReal;
+      return;
+   }
+
+   /* First value of the ATR is a simple average of the TRANGE. */
+   if( today <= optInTimePeriod )
+   {
+      var->sum += tempReal;
+      if( today < optInTimePeriod )
+         return;
+      var->prevTR = var->sum / optInTimePeriod;
+   }
+   else
+      var->prevTR = TA_WILDER_STEP(var->prevTR,tempReal,optInTimePeriod);
+
+   if( stream->id == TA_STREAM_ATR )
+      stream->lastOutput[0] = var->prevTR;
+   else if( !TA_IS_ZERO(inClose) )
+      stream->lastOutput[0] = (var->prevTR/inClose)*100.0;
+   else
+      stream->lastOutput[0] = 0.0;
+}
+
+/* See TA_PLUS_DM, TA_MINUS_DM, TA_PLUS_DI, TA_MINUS_DI and TA_DX. */
+static void updateDM( TA_Stream *stream, double inHigh, double inLow, double inClose )
+{
+   TA_StreamVar *var = &stream->var;
+   TA_StreamId id = stream->id;
+   int today = stream->nbBars;
+   int optInTimePeriod = stream->optInTimePeriod;
+   int isInit;
+   double diffP, diffM, tempReal, tempReal2, trueRange, minusDI, plusDI;
+
+   if( today == 0 )
+   {
+      var->prevHigh  = inHigh;
+      var->prevLow   = inLow;
+      var->prevClose = inClose;
+      return;
+   }
+
+   diffP = inHigh-var->prevHigh; /* Plus Delta */
+   var->prevHigh = inHigh;
+   diffM = var->prevLow-inLow;   /* Minus Delta */
+   var->prevLow = inLow;
+
+   /* Keep only the DM1 of the bar. */
+   tempReal = TA_PLUS_DM1(diffP,diffM);
+   diffM    = TA_MINUS_DM1(diffP,diffM);
+   diffP    = tempReal;
+
+   if( optInTimePeriod <= 1 )
+   {
+      /* No smoothing needed. */
+      switch( id )
+      {
+      case TA_STREAM_PLUS_DM:
+         stream->lastOutput[0] = diffP;
+         break;
+      case TA_STREAM_MINUS_DM:
+         stream->lastOutput[0] = diffM;
+         break;
+      default:
+         tempReal = (id == TA_STREAM_PLUS_DI)? diffP : diffM;
+         if( tempReal > 0 )
+         {
+            STREAM_TRUE_RANGE(inHigh,inLow,var->prevClose,trueRange);
+            if( TA_IS_ZERO(trueRange) )
+               stream->lastOutput[0] = (double)0.0;
+            else
+               stream->lastOutput[0] = tempReal/trueRange;
+         }
+         else
+            stream->lastOutput[0] = (double)0.0;
+         break;
+      }
+      var->prevClose = inClose;
+      return;
+   }
+
+   /* Sum the DM1 and TR1 of the first (period-1) bars, then
+    * use the Wilder's smoothing.
+    */
+   isInit = (today < optInTimePeriod);
+   if( isInit )
+   {
+      var->prevPlusDM  += diffP;
+      var->prevMinusDM += diffM;
+   }
+   else
+   {
+      var->prevPlusDM  = TA_WILDER_SUM_STEP(var->prevPlusDM,diffP,optInTimePeriod);
+      var->prevMinusDM = TA_WILDER_SUM_STEP(var->prevMinusDM,diffM,optInTimePeriod);
+   }
+
+   if( (id == TA_STREAM_PLUS_DM) || (id == TA_STREAM_MINUS_DM) )
+   {
+      stream->lastOutput[0] = (id == TA_STREAM_PLUS_DM)? var->prevPlusDM : var->prevMinusDM;
+      return;
+   }
+
+   STREAM_TRUE_RANGE(inHigh,inLow,var->prevClose,tempReal);
+   if( isInit )
+      var->prevTR += tempReal;
+   else
+      var->prevTR = TA_WILDER_SUM_STEP(var->prevTR,tempReal,optInTimePeriod);
+   var->prevClose = inClose;
+
+   if( isInit )
+      return;
+
+   if( id == TA_STREAM_DX )
+   {
+      if( !TA_IS_ZERO(var->prevTR) )
+      {
+         minusDI  = 100.0*(var->prevMinusDM/var->prevTR);
+         plusDI   = 100.0*(var->prevPlusDM/var->prevTR);
+         tempReal = minusDI+plusDI;
+         if( !TA_IS_ZERO(tempReal) )
+            stream->lastOutput[0] = 100.0*(std_fabs(minusDI-plusDI)/tempReal);
+         else if( today == stream->lookback )
+            stream->lastOutput[0] = 0.0;
+      }
+      else if( today == stream->lookback )
+         stream->lastOutput[0] = 0.0;
+
+      /* Otherwise, the DX is the same as the previous bar. */
+   }
+   else if( !TA_IS_ZERO(var->prevTR) )
+   {
+      tempReal = (id == TA_STREAM_PLUS_DI)? var->prevPlusDM : var->prevMinusDM;
+      stream->lastOutput[0] = 100.0*(tempReal/var->prevTR);
+   }
+   else
+      stream->lastOutput[0] = 0.0;
+}
+
+/* See TA_ADX and TA_ADXR. */
+static void updateADX( TA_Stream *stream, double inHigh, double inLow, double inClose )
+{
+   TA_StreamVar *var = &stream->var;
+   int today = stream->nbBars;
+   int optInTimePeriod = stream->optInTimePeriod;
+   double diffP, diffM, tempReal, tempReal2, minusDI, plusDI;
+
+   if( today == 0 )
+   {
+      var->prevHigh  = inHigh;
+      var->prevLow   = inLow;
+      var->prevClose = inClose;
+      return;
+   }
+
+   diffP = inHigh-var->prevHigh; /* Plus Delta */
+   var->prevHigh = inHigh;
+   diffM = var->prevLow-inLow;   /* Minus Delta */
+   var->prevLow = inLow;
+
+   STREAM_TRUE_RANGE(inHigh,inLow,var->prevClose,tempReal);
+   var->prevClose = inClose;
+
+   if( today < optInTimePeriod )
+   {
+      /* Process the initial DM and TR */
+      var->prevMinusDM += TA_MINUS_DM1(diffP,diffM);
+      var->prevPlusDM  += TA_PLUS_DM1(diffP,diffM);
+      var->prevTR += tempReal;
+      return;
+   }
+
+   var->prevMinusDM = TA_WILDER_SUM_STEP(var->prevMinusDM,TA_MINUS_DM1(diffP,diffM),optInTimePeriod);
+   var->prevPlusDM  = TA_WILDER_SUM_STEP(var->prevPlusDM,TA_PLUS_DM1(diffP,diffM),optInTimePeriod);
+   var->prevTR = TA_WILDER_SUM_STEP(var->prevTR,tempReal,optInTimePeriod);
+
+   if( !TA_IS_ZERO(var->prevTR) )
+   {
+      minusDI  = 100.0*(var->prevMinusDM/var->prevTR);
+      plusDI   = 100.0*(var->prevPlusDM/var->prevTR);
+      tempReal = minusDI+plusDI;
+      if( !TA_IS_ZERO(tempReal) )
+      {
+         tempReal = 100.0*(std_fabs(minusDI-plusDI)/tempReal);
+         if( today < 2*optInTimePeriod )
+            var->sumDX += tempReal;   /* Add up all the initial DX. */
+         else
+            var->prevADX = TA_WILDER_STEP(var->prevADX,tempReal,optInTimePeriod);
+      }
+   }
+
+   /* The first ADX is the average of the initial DX. */
+   if( today == (2*optInTimePeriod)-1 )
+      var->prevADX = var->sumDX / optInTimePeriod;
+
+   if( today < (2*optInTimePeriod)-1 )
+      return;
+
+   if( stream->id == TA_STREAM_ADX )
+   {
+      stream->lastOutput[0] = var->prevADX;
+      return;
+   }
+
+   /* ADXR is the average of today ADX and the ADX of
+    * (period-1) bars ago.
+    */
+   if( today < stream->adxLookback )
+      return;
+
+   stream->window[var->nbADX % optInTimePeriod] = var->prevADX;
+   if( var->nbADX >= optInTimePeriod-1 )
+   {
+      tempReal2 = stream->window[(var->nbADX+1) % optInTimePeriod];
+      stream->lastOutput[0] = (var->prevADX+tempReal2)/2.0;
+   }
+   var->nbADX++;
+}
+
+/* See TA_DEMA, TA_TEMA and TA_TRIX. Each EMA is fed with the
+ * output of the previous one, starting at its first output.
+ */
+static void updateCascade( TA_Stream *stream, double inReal )
+{
+   TA_StreamVar *var = &stream->var;
+   double firstEMA, secondEMA, thirdEMA;
+
+   if( !emaAdd( stream, 0, inReal ) )
+      return;
+   firstEMA = var->ema[0].prevMA;
+
+   if( !emaAdd( stream, 1, firstEMA ) )
+      return;
+   secondEMA = var->ema[1].prevMA;
+
+   if( stream->id == TA_STREAM_DEMA )
+   {
+      stream->lastOutput[0] = (2.0*firstEMA) - secondEMA;
+      return;
+   }
+
+   if( !emaAdd( stream, 2, secondEMA ) )
+      return;
+   thirdEMA = var->ema[2].prevMA;
+
+   if( stream->id == TA_STREAM_TEMA )
+   {
+      stream->lastOutput[0] = thirdEMA;
+      stream->lastOutput[0] += (3.0*firstEMA) - (3.0*secondEMA);
+      return;
+   }
+
+   /* TRIX is the 1-day ROC of the triple EMA (see TA_ROC). */
+   if( var->ema[2].nbValue > stream->emaLookback[2]+1 )
+   {
+      if( var->prevValue != 0.0 )
+         stream->lastOutput[0] = ((thirdEMA / var->prevValue)-1.0)*100.0;
+      else
+         stream->lastOutput[0] = 0.0;
+   }
+   var->prevValue = thirdEMA;
+}
+
+/* See TA_INT_MACD. */
+static void updateMACD( TA_Stream *stream, double inReal )
+{
+   TA_StreamVar *var = &stream->var;
+   double macd;
+
+   if( stream->nbBars >= stream->fastEMADelay )
+      emaAdd( stream, 0, inReal );
+
+   /* The fast EMA has an output whenever the slow one does. */
+   if( !emaAdd( stream, 1, inReal ) )
+      return;
+   macd = var->ema[0].prevMA - var->ema[1].prevMA;
+
+   /* The signal is the EMA of the MACD line. */
+   if( !emaAdd( stream, 2, macd ) )
+      return;
+
+   stream->lastOutput[0] = macd;
+   stream->lastOutput[1] = var->ema[2].prevMA;
+   stream->lastOutput[2] = macd-var->ema[2].prevMA;
+}
+
+/* See TA_SAR. */
+static void updateSAR( TA_Stream *stream, double inHigh, double inLow )
+{
+   TA_StreamVar *var = &stream->var;
+   double prevHigh, prevLow, newHigh, newLow;
+
+   if( stream->nbBars == 0 )
+   {
+      var->prevHigh = inHigh;
+      var->prevLow  = inLow;
+      return;
+   }
+
+   if( stream->nbBars == 1 )
+   {
+      /* Identify if the initial direction is long or short
+       * from the -DM of the first two bars.
+       */
+      var->isLong = (TA_MINUS_DM1(inHigh-var->prevHigh,var->prevLow-inLow) > 0)? 0 : 1;
+      var->af = stream->optInAcceleration;
+
+      SAR_ROUNDING(var->prevHigh);
+      SAR_ROUNDING(var->prevLow);
+
+      if( var->isLong == 1 )
+      {
+         var->ep  = inHigh;
+         var->sar = var->prevLow;
+      }
+      else
+      {
+         var->ep  = inLow;
+         var->sar = var->prevHigh;
+      }
+
+      SAR_ROUNDING(var->sar);
+
+      /* Cheat on the previous bar for the first iteration. */
+      var->prevHigh = inHigh;
+      var->prevLow  = inLow;
+   }
+
+   prevHigh = var->prevHigh;
+   prevLow  = var->prevLow;
+   newHigh  = inHigh;
+   newLow   = inLow;
+
+   SAR_ROUNDING(newLow);
+   SAR_ROUNDING(newHigh);
+
+   TA_SAR_STEP( var->isLong, var->sar, var->ep, var->af,
+                prevHigh, prevLow, newHigh, newLow,
+                stream->optInAcceleration, stream->optInMaximum,
+                stream->lastOutput[0] );
+
+   var->prevHigh = newHigh;
+   var->prevLow  = newLow;
+}
+
+/* See TA_ADOSC. Both EMA are seeded with the first A/D value. */
+static void updateADOSC( TA_Stream *stream, double inHigh, double inLow, double inClose, double inVolume )
+{
+   TA_StreamVar *var = &stream->var;
+   double *fastEMA = &var->ema[0].prevMA;
+   double *slowEMA = &var->ema[1].prevMA;
+   double tmp, fastk, slowk;
+
+   TA_AD_ADD(var->ad,inHigh,inLow,inClose,inVolume,tmp);
+
+   if( stream->nbBars == 0 )
+   {
+      *fastEMA = var->ad;
+      *slowEMA = var->ad;
+   }
+   else
+   {
+      fastk = stream->emaK[0];
+      slowk = stream->emaK[1];
+      *fastEMA = TA_T3_EMA_STEP(*fastEMA,var->ad,fastk,1.0-fastk);
+      *slowEMA = TA_T3_EMA_STEP(*slowEMA,var->ad,slowk,1.0-slowk);
+   }
+
+   stream->lastOutput[0] = *fastEMA - *slowEMA;
+}
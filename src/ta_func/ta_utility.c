@@ -53,6 +53,8 @@
    #include "ta_memory.h"
 namespace TicTacTec { namespace TA { namespace Library {
 #else
+   #include <stdlib.h>
+   #include <string.h>
    #include "ta_utility.h"
    #include "ta_func.h"
    #include "ta_memory.h"
@@ -78,7 +80,7 @@ TA_RetCode TA_SetUnstablePeriod( TA_FuncUnstId id,
          #if defined( _MANAGED )
             Globals->unstablePeriod[(int)i] = unstablePeriod;
          #else
-            TA_Globals->unstablePeriod[i] = unstablePeriod;
+            TA_Globals->context.unstablePeriod[i] = unstablePeriod;
          #endif
 	  }
    }
@@ -87,7 +89,7 @@ TA_RetCode TA_SetUnstablePeriod( TA_FuncUnstId id,
          #if defined( _MANAGED )
             Globals->unstablePeriod[(int)id] = unstablePeriod;
          #else
-            TA_Globals->unstablePeriod[id] = unstablePeriod;
+            TA_Globals->context.unstablePeriod[id] = unstablePeriod;
          #endif
    }
 
@@ -106,7 +108,7 @@ unsigned int TA_GetUnstablePeriod( TA_FuncUnstId id )
    #if defined( _MANAGED )
       return Globals->unstablePeriod[(int)id];
    #else
-      return TA_Globals->unstablePeriod[id];
+      return TA_Globals->context.unstablePeriod[id];
    #endif
 }
 
@@ -116,7 +118,11 @@ unsigned int TA_GetUnstablePeriod( TA_FuncUnstId id )
 TA_RetCode TA_SetCompatibility( TA_Compatibility value )
 #endif
 {
-   TA_GLOBALS_COMPATIBILITY = value;
+   #if defined( _MANAGED )
+      TA_GLOBALS_COMPATIBILITY = value;
+   #else
+      TA_Globals->context.compatibility = value;
+   #endif
    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 }
 
@@ -126,8 +132,319 @@ TA_RetCode TA_SetCompatibility( TA_Compatibility value )
 TA_Compatibility TA_GetCompatibility( void )
 #endif
 {
-   return TA_GLOBALS_COMPATIBILITY;
+   #if defined( _MANAGED )
+      return TA_GLOBALS_COMPATIBILITY;
+   #else
+      return TA_Globals->context.compatibility;
+   #endif
+}
+
+#if !defined( _MANAGED )
+static void sortRank( TA_AvgDevTreeRank *data, TA_AvgDevTreeRank *temp, int nbValue );
+
+/* False for NaN and for an infinite value. */
+#define TREE_IS_FINITE(v) (((v)-(v)) == 0.0)
+
+/* True when the value a is ranked before the value b. */
+#define TREE_RANK_BEFORE(a,b) (TREE_IS_FINITE(a) && (!TREE_IS_FINITE(b) || ((a) < (b))))
+
+TA_THREAD_LOCAL TA_Workspace *TA_ThreadWorkspace = NULL;
+
+void *TA_INT_TempAlloc( size_t size )
+{
+   TA_Workspace *workspace;
+   double *ptr;
+   size_t nbDouble;
+
+   /* From the heap when the workspace is too small, which is
+    * only possible when the caller did not ask for its size
+    * with TA_XXX_Workspace.
+    */
+   workspace = TA_ThreadWorkspace;
+   nbDouble  = TA_WORKSPACE_NB_DOUBLE(size);
+   if( !workspace || (nbDouble > (size_t)(workspace->end-workspace->next)) )
+      return TA_Malloc( size );
+
+   ptr = workspace->next;
+   workspace->next += nbDouble;
+   return ptr;
+}
+
+void TA_INT_TempFree( void *ptr )
+{
+   TA_Workspace *workspace;
+
+   /* Nothing to free when taken from the workspace. */
+   workspace = TA_ThreadWorkspace;
+   if( workspace && ((double *)ptr >= workspace->begin) && ((double *)ptr < workspace->end) )
+      return;
+
+   TA_Free( ptr );
+}
+
+/* Blocks of a few periods amortize the ranking of the
+ * period-1 values overlapping with the previous block.
+ */
+#define AVGDEV_TREE_MAX_NB_OUTPUT(period,nbOutput) \
+   ((nbOutput) < 4*(period)? (nbOutput) : 4*(period))
+
+int TA_INT_AvgDevTreeWorkspace( int period, int nbOutput )
+{
+   int maxNbOutput, nbValue;
+
+   /* Same buffers as TA_INT_AvgDevTreeAlloc. */
+   maxNbOutput = AVGDEV_TREE_MAX_NB_OUTPUT(period,nbOutput);
+   nbValue     = maxNbOutput+period-1;
+
+   return nbValue + 2*maxNbOutput +
+          2*(int)TA_WORKSPACE_NB_DOUBLE(sizeof(TA_AvgDevTreeRank)*nbValue) +
+          (int)TA_WORKSPACE_NB_DOUBLE(sizeof(int)*nbValue) +
+          (int)TA_WORKSPACE_NB_DOUBLE(sizeof(TA_AvgDevTreeNode)*(nbValue+1));
+}
+
+TA_RetCode TA_INT_AvgDevTreeAlloc( TA_AvgDevTree *tree, int period, int nbOutput )
+{
+   int nbValue;
+
+   memset( tree, 0, sizeof(TA_AvgDevTree) );
+
+   tree->period      = period;
+   tree->maxNbOutput = AVGDEV_TREE_MAX_NB_OUTPUT(period,nbOutput);
+   nbValue = tree->maxNbOutput+period-1;
+
+   tree->value    = (double *)TA_INT_TempAlloc( sizeof(double)*nbValue );
+   tree->mean     = (double *)TA_INT_TempAlloc( sizeof(double)*tree->maxNbOutput );
+   tree->sumDev   = (double *)TA_INT_TempAlloc( sizeof(double)*tree->maxNbOutput );
+   tree->sorted   = (TA_AvgDevTreeRank *)TA_INT_TempAlloc( sizeof(TA_AvgDevTreeRank)*nbValue );
+   tree->sortTemp = (TA_AvgDevTreeRank *)TA_INT_TempAlloc( sizeof(TA_AvgDevTreeRank)*nbValue );
+   tree->rank     = (int *)TA_INT_TempAlloc( sizeof(int)*nbValue );
+   tree->node     = (TA_AvgDevTreeNode *)TA_INT_TempAlloc( sizeof(TA_AvgDevTreeNode)*(nbValue+1) );
+
+   if( !tree->value || !tree->mean || !tree->sumDev || !tree->sorted ||
+       !tree->sortTemp || !tree->rank || !tree->node )
+   {
+      TA_INT_AvgDevTreeFree( tree );
+      return TA_ALLOC_ERR;
+   }
+
+   return TA_SUCCESS;
+}
+
+void TA_INT_AvgDevTreeFree( TA_AvgDevTree *tree )
+{
+   TA_INT_TempFree( tree->value );
+   TA_INT_TempFree( tree->mean );
+   TA_INT_TempFree( tree->sumDev );
+   TA_INT_TempFree( tree->sorted );
+   TA_INT_TempFree( tree->sortTemp );
+   TA_INT_TempFree( tree->rank );
+   TA_INT_TempFree( tree->node );
+   memset( tree, 0, sizeof(TA_AvgDevTree) );
+}
+
+void TA_INT_AvgDevTreeCalc( TA_AvgDevTree *tree, int nbOutput )
+{
+   const double *value = tree->value;
+   const TA_AvgDevTreeRank *sorted = tree->sorted;
+   const int *rank = tree->rank;
+   TA_AvgDevTreeNode *node = tree->node;
+   int period = tree->period;
+   int nbValue, nbFinite, nbNotFinite, step, lo, hi, pos, i, j, count;
+   double periodTotal, mean, sumBelow, tempReal, notFinite;
+
+   nbValue = nbOutput+period-1;
+
+   /* Rank the values of this block (1 based). Equal values get
+    * consecutive ranks, so the search further down always finds
+    * all of them on the same side of the mean. The NaN and
+    * infinite values are ranked after all the others (see
+    * sortRank) and are never added to the tree.
+    */
+   for( i=0; i < nbValue; i++ )
+   {
+      tree->sorted[i].value = value[i];
+      tree->sorted[i].idx   = i;
+   }
+   sortRank( tree->sorted, tree->sortTemp, nbValue );
+   nbFinite = 0;
+   for( i=0; i < nbValue; i++ )
+   {
+      tree->rank[sorted[i].idx] = i+1;
+      if( TREE_IS_FINITE(sorted[i].value) )
+         nbFinite = i+1;
+   }
+
+   memset( node, 0, sizeof(TA_AvgDevTreeNode)*(nbValue+1) );
+
+   pos = 0;
+
+   /* Adds or removes the value idx. A value that is not finite
+    * is only counted: the window has no mean and deviation while
+    * it contains one.
+    */
+   #define TREE_UPDATE(idx,countDelta,sumDelta) \
+      { \
+         if( rank[idx] > nbFinite ) \
+         { \
+            nbNotFinite += countDelta; \
+            notFinite = value[idx]; \
+         } \
+         else \
+         { \
+            periodTotal += sumDelta; \
+            for( j=rank[idx]; j <= nbFinite; j += j & (-j) ) \
+            { \
+               node[j].count += countDelta; \
+               node[j].sum   += sumDelta; \
+            } \
+         } \
+      }
+
+   periodTotal = 0.0;
+   nbNotFinite = 0;
+   notFinite   = 0.0;
+   for( i=0; i < period-1; i++ )
+      TREE_UPDATE( i, 1, value[i] );
+
+   for( i=0; i < nbOutput; i++ )
+   {
+      tempReal = value[i+period-1];
+      TREE_UPDATE( i+period-1, 1, tempReal );
+
+      if( nbNotFinite > 0 )
+      {
+         /* NaN, as the sum of the direct calculation would be. */
+         tree->mean[i]   = notFinite-notFinite;
+         tree->sumDev[i] = tree->mean[i];
+         tempReal = value[i];
+         TREE_UPDATE( i, -1, -tempReal );
+         continue;
+      }
+
+      mean = periodTotal/period;
+
+      /* Find pos, the number of ranked values <= mean. Only
+       * the first nbFinite ranks are searched.
+       *
+       * The mean moves little from one output to the next, so
+       * the search gallops from the previous position.
+       */
+      if( (pos < nbFinite) && (sorted[pos].value <= mean) )
+      {
+         lo = pos+1;
+         step = 1;
+         hi = lo+1;
+         while( (hi <= nbFinite) && (sorted[hi-1].value <= mean) )
+         {
+            lo = hi;
+            step <<= 1;
+            hi = lo+step;
+         }
+         if( hi > nbFinite+1 )
+            hi = nbFinite+1;
+      }
+      else if( (pos > 0) && (sorted[pos-1].value > mean) )
+      {
+         hi = pos;
+         step = 1;
+         lo = hi-1;
+         while( (lo > 0) && (sorted[lo-1].value > mean) )
+         {
+            hi = lo;
+            step <<= 1;
+            lo = hi-step;
+         }
+         if( lo < 0 )
+            lo = 0;
+      }
+      else
+      {
+         lo = pos;
+         hi = pos+1;
+      }
+
+      while( hi-lo > 1 )
+      {
+         j = (lo+hi)>>1;
+         if( sorted[j-1].value <= mean )
+            lo = j;
+         else
+            hi = j;
+      }
+      pos = lo;
+
+      /* Count and sum of the values in the window <= mean. */
+      count = 0;
+      sumBelow = 0.0;
+      for( j=pos; j > 0; j -= j & (-j) )
+      {
+         count    += node[j].count;
+         sumBelow += node[j].sum;
+      }
+
+      tempReal = (mean*count-sumBelow) + ((periodTotal-sumBelow)-mean*(period-count));
+      tree->mean[i]   = mean;
+      tree->sumDev[i] = tempReal < 0.0? 0.0 : tempReal;
+
+      tempReal = value[i];
+      TREE_UPDATE( i, -1, -tempReal );
+   }
+
+   #undef TREE_UPDATE
+}
+
+/* Merge sort by value, using 'temp' of the same size. The sort is
+ * stable and the NaN and infinite values are ordered after all the
+ * finite values.
+ */
+static void sortRank( TA_AvgDevTreeRank *data, TA_AvgDevTreeRank *temp, int nbValue )
+{
+   TA_AvgDevTreeRank *src, *dst, *swap;
+   TA_AvgDevTreeRank tempRank;
+   int width, lo, mid, hi, i, j, k;
+
+   /* Insertion sort of small runs. */
+   #define SORT_RUN 16
+   for( lo=0; lo < nbValue; lo += SORT_RUN )
+   {
+      hi = lo+SORT_RUN < nbValue? lo+SORT_RUN : nbValue;
+      for( i=lo+1; i < hi; i++ )
+      {
+         tempRank = data[i];
+         for( j=i; (j > lo) && TREE_RANK_BEFORE(tempRank.value,data[j-1].value); j-- )
+            data[j] = data[j-1];
+         data[j] = tempRank;
+      }
+   }
+
+   src = data;
+   dst = temp;
+   for( width=SORT_RUN; width < nbValue; width <<= 1 )
+   {
+      for( lo=0; lo < nbValue; lo += 2*width )
+      {
+         mid = lo+width < nbValue? lo+width : nbValue;
+         hi  = lo+2*width < nbValue? lo+2*width : nbValue;
+         i = lo;
+         j = mid;
+         k = lo;
+         while( (i < mid) && (j < hi) )
+            dst[k++] = TREE_RANK_BEFORE(src[j].value,src[i].value)? src[j++] : src[i++];
+         while( i < mid )
+            dst[k++] = src[i++];
+         while( j < hi )
+            dst[k++] = src[j++];
+      }
+      swap = src;
+      src  = dst;
+      dst  = swap;
+   }
+   #undef SORT_RUN
+
+   if( src != data )
+      memcpy( data, src, sizeof(TA_AvgDevTreeRank)*nbValue );
 }
+#endif
 
 #if defined( _MANAGED )
 }}} // Close namespace TicTacTec::TA::Lib
@@ -170,6 +170,195 @@ void TA_S_INT_stddev_using_precalc_ma( const float  *inReal,
                                        double       *output );
 #endif
 
+/* Sliding window mean and sum of the absolute deviations from that mean
+ * (AVGDEV, CCI).
+ *
+ * The sum of the absolute deviations from the mean m only needs the
+ * count and sum of the values below m. These are obtained in
+ * O(log period) from a Fenwick tree indexed by the rank of the values.
+ *
+ * The values are processed by block: the caller fills 'value' with up to
+ * 'maxNbOutput'+period-1 consecutive values and TA_INT_AvgDevTreeCalc
+ * writes one mean/deviation for every complete window. The ranks are
+ * re-calculated for each block, which also keeps the rounding errors
+ * accumulated in the tree to a block.
+ *
+ * The direct calculation is faster for a period smaller than
+ * TA_AVGDEV_TREE_MIN_PERIOD.
+ *
+ * The outputs differ from the direct calculation by the rounding
+ * errors (less than 1e-12 relative), and the tree exists only in C. So
+ * it is used only when the math mode of the thread is TA_MATH_FAST
+ * (see TA_SetMathMode). By default the outputs are the same in every
+ * language.
+ *
+ * A window holding a NaN or an infinite value has a NaN mean and
+ * deviation, as with the direct calculation.
+ */
+#if !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )
+#define TA_AVGDEV_TREE_MIN_PERIOD 128
+
+#define TA_AVGDEV_USE_TREE(period) \
+   (((period) >= TA_AVGDEV_TREE_MIN_PERIOD) && (TA_ThreadContext->mathMode == TA_MATH_FAST))
+
+typedef struct
+{
+   double value;
+   int    idx;
+} TA_AvgDevTreeRank;
+
+typedef struct
+{
+   double sum;
+   int    count;
+} TA_AvgDevTreeNode;
+
+typedef struct
+{
+   int period;
+   int maxNbOutput;
+
+   double *value;   /* maxNbOutput+period-1, filled by the caller. */
+   double *mean;    /* maxNbOutput, output. */
+   double *sumDev;  /* maxNbOutput, output. */
+
+   TA_AvgDevTreeRank *sorted;
+   TA_AvgDevTreeRank *sortTemp;
+   int               *rank;
+   TA_AvgDevTreeNode *node;
+} TA_AvgDevTree;
+
+TA_RetCode TA_INT_AvgDevTreeAlloc( TA_AvgDevTree *tree, int period, int nbOutput );
+void TA_INT_AvgDevTreeCalc( TA_AvgDevTree *tree, int nbOutput );
+void TA_INT_AvgDevTreeFree( TA_AvgDevTree *tree );
+
+/* Size in double taken from the thread workspace by TA_INT_AvgDevTreeAlloc. */
+int TA_INT_AvgDevTreeWorkspace( int period, int nbOutput );
+#endif
+
+/* Number of elements of the temporary buffers of the TA functions.
+ *
+ * Used by the TA function when allocating the buffer and by its
+ * TA_XXX_Workspace (see ta_workspace.c), so the two cannot disagree.
+ * 'startIdx' is after being moved up for the lookback.
+ */
+#define TA_DEMA_EMA1_SIZE(startIdx,endIdx,lookbackEMA)   ((endIdx)-(startIdx)+1+2*(lookbackEMA))
+#define TA_DEMA_EMA2_SIZE(startIdx,endIdx,lookbackEMA)   ((endIdx)-(startIdx)+1+(lookbackEMA))
+#define TA_TEMA_EMA1_SIZE(startIdx,endIdx,lookbackEMA)   ((endIdx)-(startIdx)+1+3*(lookbackEMA))
+#define TA_TEMA_EMA2_SIZE(startIdx,endIdx,lookbackEMA)   ((endIdx)-(startIdx)+1+2*(lookbackEMA))
+#define TA_TRIX_EMA_SIZE(startIdx,endIdx,lookbackTotal)  ((endIdx)-(startIdx)+1+(lookbackTotal))
+#define TA_MAMA_FAMA_SIZE(startIdx,endIdx)               ((endIdx)-(startIdx)+1)
+#define TA_PO_MA_SIZE(startIdx,endIdx)                   ((endIdx)-(startIdx)+1)
+#define TA_MACD_MA_SIZE(startIdx,endIdx,lookbackSignal)  ((endIdx)-(startIdx)+1+(lookbackSignal))
+#define TA_STOCH_K_SIZE(today,endIdx)                    ((endIdx)-(today)+1)
+#define TA_STOCHRSI_RSI_SIZE(startIdx,endIdx,lookbackSTOCHF) ((endIdx)-(startIdx)+1+(lookbackSTOCHF))
+#define TA_NATR_TRANGE_SIZE(startIdx,endIdx,lookbackTotal) ((endIdx)-(startIdx)+1+(lookbackTotal))
+#define TA_ADXR_ADX_SIZE(startIdx,endIdx,optInTimePeriod) ((endIdx)-(startIdx)+(optInTimePeriod))
+
+/* Size of the local buffer of the circular buffers. A larger
+ * circular buffer is allocated (see CIRCBUF_INIT in ta_memory.h).
+ */
+#define TA_CCI_LOCAL_SIZE  30
+#define TA_MFI_LOCAL_SIZE  50
+
+/* Workspace provided by the caller for the temporary buffers
+ * (see TA_INT_TempAlloc in ta_memory.h).
+ *
+ * The buffers are taken one after the other and are not re-used
+ * within the same call, so the size needed is the sum of all the
+ * buffers allocated while the function executes (rounded up to a
+ * multiple of double each). A buffer not fitting in what is left
+ * of the workspace is taken from the heap.
+ */
+#if !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )
+typedef struct
+{
+   double *begin;
+   double *next;
+   double *end;
+} TA_Workspace;
+
+#define TA_WORKSPACE_NB_DOUBLE(size) (((size)+sizeof(double)-1)/sizeof(double))
+
+/* Size in double of a circular buffer of 'Size' elements of 'Type',
+ * zero when it fits in its local buffer of 'LocalSize'.
+ */
+#define CIRCBUF_WORKSPACE(Type,Size,LocalSize) \
+   ((Size) > (LocalSize)? (int)TA_WORKSPACE_NB_DOUBLE(sizeof(Type)*(Size)) : 0)
+
+/* NULL when the temporary buffers are taken from the heap. */
+extern TA_THREAD_LOCAL TA_Workspace *TA_ThreadWorkspace;
+#endif
+
+/* Element-wise functions calculated with SSE2, AVX2 or AVX-512
+ * instructions (see ta_vec.c).
+ *
+ * TA_INT_VecMath: out[i] = f(in[i]) for TA_VEC_EXP to TA_VEC_FLOOR.
+ * The transcendental functions (TA_VEC_EXP to TA_VEC_TANH) are
+ * approximated, so they are done only when the math mode of the
+ * thread is TA_MATH_FAST (see TA_SetMathMode). TA_VEC_SQRT, TA_VEC_CEIL
+ * and TA_VEC_FLOOR are exact and always done.
+ *
+ * TA_INT_VecArith: the operations of the math operators and of the
+ * price transforms. The inputs are in the same order as for the TA
+ * function (NULL when not used) and the operations are the same, so
+ * the outputs are identical.
+ *
+ * Both return 0 when the caller must do the calculation itself
+ * (strict math mode, CPU or compiler without the SIMD kernels).
+ * 'out' can be 'in'.
+ *
+ * TA_INT_VecSetLevel limits the instructions used (for the tests),
+ * TA_VEC_LEVEL_NONE going back to the best one of the CPU.
+ */
+#if !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )
+typedef enum
+{
+   TA_VEC_EXP,
+   TA_VEC_LN,
+   TA_VEC_LOG10,
+   TA_VEC_SIN,
+   TA_VEC_COS,
+   TA_VEC_TAN,
+   TA_VEC_ASIN,
+   TA_VEC_ACOS,
+   TA_VEC_ATAN,
+   TA_VEC_SINH,
+   TA_VEC_COSH,
+   TA_VEC_TANH,
+   TA_VEC_SQRT,
+   TA_VEC_CEIL,
+   TA_VEC_FLOOR,
+   TA_VEC_ADD,
+   TA_VEC_SUB,
+   TA_VEC_MULT,
+   TA_VEC_DIV,
+   TA_VEC_AVGPRICE,
+   TA_VEC_MEDPRICE,
+   TA_VEC_TYPPRICE,
+   TA_VEC_WCLPRICE
+} TA_VecOp;
+
+typedef enum
+{
+   TA_VEC_LEVEL_NONE,
+   TA_VEC_LEVEL_SSE2,
+   TA_VEC_LEVEL_AVX2,
+   TA_VEC_LEVEL_AVX512
+} TA_VecLevel;
+
+int TA_INT_VecMath  ( TA_VecOp op, const double *in, double *out, int nb );
+int TA_S_INT_VecMath( TA_VecOp op, const float  *in, double *out, int nb );
+
+int TA_INT_VecArith( TA_VecOp op,
+                     const double *in0, const double *in1,
+                     const double *in2, const double *in3,
+                     double *out, int nb );
+
+TA_VecLevel TA_INT_VecGetLevel( void );
+void        TA_INT_VecSetLevel( TA_VecLevel level );
+#endif
+
    /* Provides an equivalent to standard "math.h" functions. */
 #if defined( _MANAGED )
    #define std_floor Math::Floor
@@ -301,6 +490,149 @@ void TA_S_INT_stddev_using_precalc_ma( const float  *inReal,
 #define DO_HILBERT_ODD(varName,input)  DO_HILBERT_TRANSFORM(varName,input,Odd)
 #define DO_HILBERT_EVEN(varName,input) DO_HILBERT_TRANSFORM(varName,input,Even)
 
+/* The following macros are being used to find the highest (or lowest)
+ * value of a sliding window (MAX, MIN, WILLR, STOCH, AROON etc...).
+ *
+ * These functions track the extreme incrementally and only need to
+ * search the window when the extreme falls out of it. A plain re-scan
+ * costs O(period), and when the data is trending it happens on every
+ * price bar.
+ *
+ * Instead, the indexes of the candidates to the extreme are kept in a
+ * deque (a circular buffer of 'Size' int). A candidate is removed from
+ * the back when a more recent price bar is more extreme, and from the
+ * front when it leaves the window, so the front is always the extreme
+ * of the window. The price bars are added to the deque only when a
+ * search is done, starting at the first one still within the window.
+ * Each price bar is added and removed at most once, so the cost is
+ * amortized O(1) per price bar, and nothing is added when the window
+ * does not need to be searched.
+ *
+ * The result is the same as the re-scan, including which index is
+ * returned when more than one price bar have the extreme value:
+ *   WINDOW_HIGHEST_FIND/WINDOW_LOWEST_FIND: The oldest index.
+ *   WINDOW_HIGHEST_LAST_FIND/WINDOW_LOWEST_LAST_FIND: The most recent.
+ *
+ * Usage:
+ *   WINDOW_EXTREME_VARIABLES(varName): Declare the variables.
+ *   INIT_WINDOW_EXTREME(varName,Size): Size is the number of price bar
+ *                                      within the window.
+ *   INIT_WINDOW_EXTREME_PAIR(varName1,varName2,Size):
+ *                                      Same for two windows. Use it instead
+ *                                      of two INIT_WINDOW_EXTREME, so the
+ *                                      first window is not leaked when the
+ *                                      second cannot be allocated.
+ *   xxx_FIND(varName,data,trailingIdx,today,outIdx):
+ *                                      Set outIdx to the index of the
+ *                                      extreme within [trailingIdx..today].
+ *   FREE_WINDOW_EXTREME(varName):      Must be done before leaving the
+ *                                      function.
+ *
+ * Up to a Size of WINDOW_EXTREME_LOCAL_SIZE the deque is on the stack,
+ * above it is allocated like a CIRCBUF (from the thread workspace when
+ * there is one, WINDOW_EXTREME_WORKSPACE is the size taken from it).
+ *
+ * Only data within the window is accessed, so the input and output can
+ * still be the same buffer.
+ */
+#define WINDOW_EXTREME_LOCAL_SIZE 64
+
+#if !defined( _MANAGED ) && !defined( _JAVA ) && !defined( _RUST )
+#define WINDOW_EXTREME_WORKSPACE(Size) CIRCBUF_WORKSPACE(int,Size,WINDOW_EXTREME_LOCAL_SIZE)
+#endif
+
+#define WINDOW_EXTREME_VARIABLES(varName) \
+   CIRCBUF_PROLOG(varName,int,WINDOW_EXTREME_LOCAL_SIZE); \
+   int varName##_Back; \
+   int varName##_Nb; \
+   int varName##_Last; \
+   int varName##_i; \
+   int varName##_j; \
+   int varName##_n
+
+#define WINDOW_EXTREME_RESET(varName) \
+      varName##_Idx  = 0; \
+      varName##_Back = maxIdx_##varName; \
+      varName##_Nb   = 0; \
+      varName##_Last = -1;
+
+#define INIT_WINDOW_EXTREME(varName,Size) { \
+      CIRCBUF_INIT(varName,int,Size); \
+      WINDOW_EXTREME_RESET(varName) \
+      }
+
+#define INIT_WINDOW_EXTREME_PAIR(varName1,varName2,Size) { \
+      CIRCBUF_INIT_PAIR(varName1,varName2,int,Size); \
+      WINDOW_EXTREME_RESET(varName1) \
+      WINDOW_EXTREME_RESET(varName2) \
+      }
+
+#define FREE_WINDOW_EXTREME(varName) CIRCBUF_DESTROY(varName)
+
+#define WINDOW_EXTREME_FIND(varName,data,trailingIdx,today,outIdx,opRemove) { \
+      if( varName##_Last < (trailingIdx) ) \
+      { \
+         WINDOW_EXTREME_RESET(varName) \
+         varName##_Last = (trailingIdx)-1; \
+      } \
+      else \
+      { \
+         while( (varName##_Nb > 0) && (varName[varName##_Idx] < (trailingIdx)) ) \
+         { \
+            CIRCBUF_NEXT(varName); \
+            varName##_Nb--; \
+         } \
+      } \
+      if( varName##_Last < (today) ) \
+      { \
+         varName##_j = varName##_Back+(today)-varName##_Last; \
+         if( varName##_j > maxIdx_##varName ) \
+            varName##_j -= maxIdx_##varName+1; \
+         varName[varName##_j] = today; \
+         varName##_n = 1; \
+         for( varName##_i=(today)-1; varName##_i > varName##_Last; varName##_i-- ) \
+         { \
+            if( !(data[varName[varName##_j]] opRemove data[varName##_i]) ) \
+            { \
+               if( varName##_j == 0 ) \
+                  varName##_j = maxIdx_##varName; \
+               else \
+                  varName##_j--; \
+               varName[varName##_j] = varName##_i; \
+               varName##_n++; \
+            } \
+         } \
+         while( (varName##_Nb > 0) && (data[varName[varName##_j]] opRemove data[varName[varName##_Back]]) ) \
+         { \
+            if( varName##_Back == 0 ) \
+               varName##_Back = maxIdx_##varName; \
+            else \
+               varName##_Back--; \
+            varName##_Nb--; \
+         } \
+         varName##_Nb += varName##_n; \
+         for( ; varName##_n > 0; varName##_n-- ) \
+         { \
+            if( varName##_Back == maxIdx_##varName ) \
+               varName##_Back = 0; \
+            else \
+               varName##_Back++; \
+            varName[varName##_Back] = varName[varName##_j]; \
+            if( varName##_j == maxIdx_##varName ) \
+               varName##_j = 0; \
+            else \
+               varName##_j++; \
+         } \
+         varName##_Last = today; \
+      } \
+      outIdx = varName[varName##_Idx]; \
+      }
+
+#define WINDOW_HIGHEST_FIND(varName,data,trailingIdx,today,outIdx)      WINDOW_EXTREME_FIND(varName,data,trailingIdx,today,outIdx,>)
+#define WINDOW_LOWEST_FIND(varName,data,trailingIdx,today,outIdx)       WINDOW_EXTREME_FIND(varName,data,trailingIdx,today,outIdx,<)
+#define WINDOW_HIGHEST_LAST_FIND(varName,data,trailingIdx,today,outIdx) WINDOW_EXTREME_FIND(varName,data,trailingIdx,today,outIdx,>=)
+#define WINDOW_LOWEST_LAST_FIND(varName,data,trailingIdx,today,outIdx)  WINDOW_EXTREME_FIND(varName,data,trailingIdx,today,outIdx,<=)
+
 /* Convert a period into the equivalent k:
  *
  *    k = 2 / (period + 1)
@@ -309,6 +641,215 @@ void TA_S_INT_stddev_using_precalc_ma( const float  *inReal,
  */
 #define PER_TO_K( per ) ((double)2.0 / ((double)(per + 1)))
 
+/* One step of the recursive smoothing used by many functions.
+ *
+ * These are shared between the batch functions and the streaming
+ * API (ta_stream.c) so both always perform the exact same floating
+ * point operations, in the same order.
+ *
+ *   TA_EMA_STEP:    EMA recursion with a 'k' (see PER_TO_K).
+ *   TA_WILDER_STEP: Wilder's smoothing ((prev*(period-1))+value)/period
+ */
+#define TA_EMA_STEP(prev,value,k)         ((((value)-(prev))*(k)) + (prev))
+#define TA_WILDER_STEP(prev,value,period) ((((prev)*((period)-1))+(value))/(period))
+
+/* Wilder's smoothing of a running sum instead of an average, as
+ * done for the DM and TR sums of the DM, DI, DX and ADX functions.
+ */
+#define TA_WILDER_SUM_STEP(prev,value,period) ((prev) - ((prev)/(period)) + (value))
+
+/* Directional movement of one bar. 'diffP' is the high minus the
+ * previous high, 'diffM' is the previous low minus the low. At most
+ * one of +DM and -DM is not zero.
+ */
+#define TA_PLUS_DM1(diffP,diffM)  ((((diffP) > 0) && ((diffP) > (diffM)))? (diffP) : 0.0)
+#define TA_MINUS_DM1(diffP,diffM) ((((diffM) > 0) && ((diffP) < (diffM)))? (diffM) : 0.0)
+
+/* RSI and CMO: 'diff' is the change from the previous bar. A
+ * decrease is added to 'loss', anything else to 'gain'.
+ *
+ *   TA_GAIN_LOSS_ADD:  used while summing the first period.
+ *   TA_GAIN_LOSS_STEP: Wilder's smoothing of the average gain and loss.
+ */
+#define TA_GAIN_LOSS_ADD(gain,loss,diff) \
+   { \
+      if( (diff) < 0 ) \
+         loss -= (diff); \
+      else \
+         gain += (diff); \
+   }
+
+#define TA_GAIN_LOSS_STEP(gain,loss,diff,period) \
+   { \
+      loss *= ((period)-1); \
+      gain *= ((period)-1); \
+      TA_GAIN_LOSS_ADD(gain,loss,diff) \
+      loss /= (period); \
+      gain /= (period); \
+   }
+
+/* KAMA: 'sumROC1' is the sum of the absolute 1-bar changes over the
+ * period. 'oldest' is the value leaving the window, 'trailingValue'
+ * the one that left it on the previous bar.
+ *
+ *   TA_KAMA_ROC_STEP: slides 'sumROC1' by one bar.
+ *   TA_KAMA_STEP:     efficiency ratio, smoothing constant (left in
+ *                     'sc') and the EMA like step of the KAMA.
+ */
+#define TA_KAMA_ROC_STEP(sumROC1,trailingValue,oldest,value,prevValue) \
+   { \
+      sumROC1 -= std_fabs((trailingValue)-(oldest)); \
+      sumROC1 += std_fabs((value)-(prevValue)); \
+   }
+
+#define TA_KAMA_STEP(prevKAMA,value,periodROC,sumROC1,sc,constMax,constDiff) \
+   { \
+      if( ((sumROC1) <= (periodROC)) || TA_IS_ZERO(sumROC1) ) \
+         sc = 1.0; \
+      else \
+         sc = std_fabs((periodROC)/(sumROC1)); \
+      sc  = (sc*(constDiff))+(constMax); \
+      sc *= sc; \
+      prevKAMA = TA_EMA_STEP(prevKAMA,value,sc); \
+   }
+
+/* T3: one step of each of its six EMA, and the T3 from the
+ * last four of them. TA_T3_EMA_STEP is also the step of the two
+ * EMA of the ADOSC.
+ */
+#define TA_T3_EMA_STEP(prev,value,k,one_minus_k) (((k)*(value))+((one_minus_k)*(prev)))
+#define TA_T3_VALUE(e3,e4,e5,e6,c1,c2,c3,c4) ((c1)*(e6)+(c2)*(e5)+(c3)*(e4)+(c4)*(e3))
+
+/* ADOSC: the accumulation/distribution of one bar added to 'ad'. */
+#define TA_AD_ADD(ad,high,low,close,volume,tmp) \
+   { \
+      tmp = (high)-(low); \
+      if( tmp > 0.0 ) \
+         ad += ((((close)-(low))-((high)-(close)))/tmp)*((double)(volume)); \
+   }
+
+/* SAR: one price bar of the parabolic SAR. 'prevHigh' and 'prevLow'
+ * are the range of the previous bar, 'newHigh' and 'newLow' the one of
+ * this bar. 'outSar' is set to the SAR of this bar, and 'sar' becomes
+ * the SAR of the next bar. SAR_ROUNDING is defined by the caller (see
+ * ta_SAR.c).
+ */
+#define TA_SAR_STEP(isLong,sar,ep,af,prevHigh,prevLow,newHigh,newLow,acceleration,maximum,outSar) \
+   { \
+      if( isLong == 1 ) \
+      { \
+         /* Switch to short if the low penetrates the SAR value. */ \
+         if( newLow <= sar ) \
+         { \
+            /* Switch and Overide the SAR with the ep */ \
+            isLong = 0; \
+            sar = ep; \
+            /* Make sure the overide SAR is within \
+             * yesterday's and today's range. \
+             */ \
+            if( sar < prevHigh ) \
+               sar = prevHigh; \
+            if( sar < newHigh ) \
+               sar = newHigh; \
+            /* Output the overide SAR  */ \
+            outSar = sar; \
+            /* Adjust af and ep */ \
+            af = (acceleration); \
+            ep = newLow; \
+            /* Calculate the new SAR */ \
+            sar = sar + af * (ep - sar); \
+            SAR_ROUNDING( sar ); \
+            /* Make sure the new SAR is within \
+             * yesterday's and today's range. \
+             */ \
+            if( sar < prevHigh ) \
+               sar = prevHigh; \
+            if( sar < newHigh ) \
+               sar = newHigh; \
+         } \
+         else \
+         { \
+            /* No switch */ \
+            /* Output the SAR (was calculated in the previous iteration) */ \
+            outSar = sar; \
+            /* Adjust af and ep. */ \
+            if( newHigh > ep ) \
+            { \
+               ep = newHigh; \
+               af += (acceleration); \
+               if( af > (maximum) ) \
+                  af = (maximum); \
+            } \
+            /* Calculate the new SAR */ \
+            sar = sar + af * (ep - sar); \
+            SAR_ROUNDING( sar ); \
+            /* Make sure the new SAR is within \
+             * yesterday's and today's range. \
+             */ \
+            if( sar > prevLow ) \
+               sar = prevLow; \
+            if( sar > newLow ) \
+               sar = newLow; \
+         } \
+      } \
+      else \
+      { \
+         /* Switch to long if the high penetrates the SAR value. */ \
+         if( newHigh >= sar ) \
+         { \
+            /* Switch and Overide the SAR with the ep */ \
+            isLong = 1; \
+            sar = ep; \
+            /* Make sure the overide SAR is within \
+             * yesterday's and today's range. \
+             */ \
+            if( sar > prevLow ) \
+               sar = prevLow; \
+            if( sar > newLow ) \
+               sar = newLow; \
+            /* Output the overide SAR  */ \
+            outSar = sar; \
+            /* Adjust af and ep */ \
+            af = (acceleration); \
+            ep = newHigh; \
+            /* Calculate the new SAR */ \
+            sar = sar + af * (ep - sar); \
+            SAR_ROUNDING( sar ); \
+            /* Make sure the new SAR is within \
+             * yesterday's and today's range. \
+             */ \
+            if( sar > prevLow ) \
+               sar = prevLow; \
+            if( sar > newLow ) \
+               sar = newLow; \
+         } \
+         else \
+         { \
+            /* No switch */ \
+            /* Output the SAR (was calculated in the previous iteration) */ \
+            outSar = sar; \
+            /* Adjust af and ep. */ \
+            if( newLow < ep ) \
+            { \
+               ep = newLow; \
+               af += (acceleration); \
+               if( af > (maximum) ) \
+                  af = (maximum); \
+            } \
+            /* Calculate the new SAR */ \
+            sar = sar + af * (ep - sar); \
+            SAR_ROUNDING( sar ); \
+            /* Make sure the new SAR is within \
+             * yesterday's and today's range. \
+             */ \
+            if( sar < prevHigh ) \
+               sar = prevHigh; \
+            if( sar < newHigh ) \
+               sar = newHigh; \
+         } \
+      } \
+   }
+
 /* Math Constants and Functions */
 #define PI 3.14159265358979323846
 
@@ -339,21 +880,29 @@ void TA_S_INT_stddev_using_precalc_ma( const float  *inReal,
    #define TA_CANDLEAVGPERIOD(SET) (this.candleSettings[CandleSettingType.SET.ordinal()].avgPeriod)
    #define TA_CANDLEFACTOR(SET)    (this.candleSettings[CandleSettingType.SET.ordinal()].factor)
 #else
-   #define TA_CANDLERANGETYPE(SET) (TA_Globals->candleSettings[TA_##SET].rangeType)
-   #define TA_CANDLEAVGPERIOD(SET) (TA_Globals->candleSettings[TA_##SET].avgPeriod)
-   #define TA_CANDLEFACTOR(SET)    (TA_Globals->candleSettings[TA_##SET].factor)
+   #define TA_CANDLERANGETYPE(SET) (TA_ThreadContext->candleSettings[TA_##SET].rangeType)
+   #define TA_CANDLEAVGPERIOD(SET) (TA_ThreadContext->candleSettings[TA_##SET].avgPeriod)
+   #define TA_CANDLEFACTOR(SET)    (TA_ThreadContext->candleSettings[TA_##SET].factor)
 #endif
 
-#define TA_CANDLERANGE(SET,IDX) \
-    ( TA_CANDLERANGETYPE(SET) == ENUM_VALUE(RangeType,TA_RangeType_RealBody,RealBody) ? TA_REALBODY(IDX) : \
-    ( TA_CANDLERANGETYPE(SET) == ENUM_VALUE(RangeType,TA_RangeType_HighLow,HighLow)   ? TA_HIGHLOWRANGE(IDX) : \
-    ( TA_CANDLERANGETYPE(SET) == ENUM_VALUE(RangeType,TA_RangeType_Shadows,Shadows)   ? TA_UPPERSHADOW(IDX) + TA_LOWERSHADOW(IDX) : \
+/* The _OF variants take the range type, the period and the factor
+ * of the setting as values. TA_CDL_ALL (ta_cdl_all.c) uses them with
+ * the settings it copies, so its averages are the same as the ones
+ * of each TA_CDLXXX.
+ */
+#define TA_CANDLERANGE_OF(TYPE,IDX) \
+    ( (TYPE) == ENUM_VALUE(RangeType,TA_RangeType_RealBody,RealBody) ? TA_REALBODY(IDX) : \
+    ( (TYPE) == ENUM_VALUE(RangeType,TA_RangeType_HighLow,HighLow)   ? TA_HIGHLOWRANGE(IDX) : \
+    ( (TYPE) == ENUM_VALUE(RangeType,TA_RangeType_Shadows,Shadows)   ? TA_UPPERSHADOW(IDX) + TA_LOWERSHADOW(IDX) : \
       0 ) ) )
-#define TA_CANDLEAVERAGE(SET,SUM,IDX) \
-    ( TA_CANDLEFACTOR(SET) \
-        * ( TA_CANDLEAVGPERIOD(SET) != 0.0? SUM / TA_CANDLEAVGPERIOD(SET) : TA_CANDLERANGE(SET,IDX) ) \
-        / ( TA_CANDLERANGETYPE(SET) == ENUM_VALUE(RangeType,TA_RangeType_Shadows,Shadows) ? 2.0 : 1.0 ) \
+#define TA_CANDLEAVERAGE_OF(TYPE,PERIOD,FACTOR,SUM,IDX) \
+    ( (FACTOR) \
+        * ( (PERIOD) != 0.0? (SUM) / (PERIOD) : TA_CANDLERANGE_OF(TYPE,IDX) ) \
+        / ( (TYPE) == ENUM_VALUE(RangeType,TA_RangeType_Shadows,Shadows) ? 2.0 : 1.0 ) \
     )
+#define TA_CANDLERANGE(SET,IDX) TA_CANDLERANGE_OF(TA_CANDLERANGETYPE(SET),IDX)
+#define TA_CANDLEAVERAGE(SET,SUM,IDX) \
+    TA_CANDLEAVERAGE_OF(TA_CANDLERANGETYPE(SET),TA_CANDLEAVGPERIOD(SET),TA_CANDLEFACTOR(SET),SUM,IDX)
 #define TA_REALBODYGAPUP(IDX2,IDX1)     ( min(inOpen[IDX2],inClose[IDX2]) > max(inOpen[IDX1],inClose[IDX1]) )
 #define TA_REALBODYGAPDOWN(IDX2,IDX1)   ( max(inOpen[IDX2],inClose[IDX2]) < min(inOpen[IDX1],inClose[IDX1]) )
 #define TA_CANDLEGAPUP(IDX2,IDX1)       ( inLow[IDX2] > inHigh[IDX1] )
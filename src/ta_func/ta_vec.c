@@ -0,0 +1,359 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ */
+
+/* Description:
+ *   Element-wise functions (math transforms, math operators and
+ *   price transforms) calculated with SSE2, AVX2 or AVX-512
+ *   instructions (see TA_INT_VecMath in ta_utility.h).
+ *
+ *   The kernels are compiled for each set of instructions from the
+ *   same template (ta_vec_kernel.h). The best one supported by the
+ *   CPU is detected at the first call.
+ *
+ *   The kernels are available with gcc/clang and Visual Studio on
+ *   x86/x64. Elsewhere TA_INT_VecMath and TA_INT_VecArith return 0
+ *   and the TA functions use their own loop.
+ */
+
+/* No fused multiply-add (part of AVX-512F), the outputs must be
+ * the same for all the instructions sets.
+ */
+#if defined( __clang__ )
+   #pragma clang fp contract(off)
+#elif defined( __GNUC__ )
+   #pragma GCC optimize ("fp-contract=off")
+#endif
+
+/**** Headers ****/
+#include <math.h>
+#include <float.h>
+#include "ta_utility.h"
+
+#if defined( _MSC_VER ) && (defined( _M_X64 ) || (defined( _M_IX86_FP ) && (_M_IX86_FP >= 2)))
+   #define TA_VEC_ENABLED
+   #define TA_VEC_TARGET(isa)
+   #include <intrin.h>
+   #include <immintrin.h>
+#elif (defined( __clang__ ) || (defined( __GNUC__ ) && (__GNUC__ >= 5))) && \
+      (defined( __x86_64__ ) || (defined( __i386__ ) && defined( __SSE2__ )))
+   #define TA_VEC_ENABLED
+   #define TA_VEC_TARGET(isa) __attribute__((target(isa)))
+   #include <immintrin.h>
+#endif
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+#if defined( TA_VEC_ENABLED )
+
+/* Constants of the kernels. The parts XXX_HI of the constants have
+ * enough zeros at the end for k*XXX_HI to be exact.
+ */
+#define VEC_ROUND_MAGIC  6755399441055744.0      /* 1.5*2^52 */
+#define VEC_TWO_52       4503599627370496.0      /* 2^52 */
+#define VEC_TINY         7.450580596923828e-09   /* 2^-27 */
+#define VEC_LOG2E        1.4426950408889634
+#define VEC_LN2_HI       0.6931471803691238
+#define VEC_LN2_LO       1.9082149292705877e-10
+#define VEC_LOG10_2_HI   0.3010299955494702
+#define VEC_LOG10_2_LO   1.1451100898021838e-10
+#define VEC_INV_LN10_HI  0.4342944818781689
+#define VEC_INV_LN10_LO  2.5082946711645275e-11
+#define VEC_SQRT2        1.4142135623730951
+#define VEC_TWO_OVER_PI  0.6366197723675814
+#define VEC_PIO2_1       1.5707963267341256
+#define VEC_PIO2_2       6.077100506303966e-11
+#define VEC_PIO2_3       2.0222662487111665e-21
+#define VEC_PIO2_4       8.4784276603689e-32
+#define VEC_PI_HI        3.141592653589793
+#define VEC_PI_LO        1.2246467991473532e-16
+#define VEC_PI_2_HI      1.5707963267948966
+#define VEC_PI_2_LO      6.123233995736766e-17
+#define VEC_PI_4_HI      0.7853981633974483
+#define VEC_PI_4_LO      3.061616997868383e-17
+#define VEC_TAN_PI_8     0.41421356237309503
+
+/* The argument reduction of sin/cos/tan is exact up to that. */
+#define VEC_TRIG_MAX     1.0e6
+
+/* Values of TA_VEC_ISA for ta_vec_kernel.h */
+#define VEC_ISA_SSE2     1
+#define VEC_ISA_AVX2     2
+#define VEC_ISA_AVX512   3
+
+#endif
+
+/**** Local functions declarations.    ****/
+#if defined( TA_VEC_ENABLED )
+static TA_VecLevel detectLevel( void );
+#endif
+
+/**** Local variables definitions.     ****/
+#if defined( TA_VEC_ENABLED )
+/* -1 until the first call. Read and written by all the threads,
+ * always atomically (the volatile of Visual Studio is atomic).
+ */
+#if defined( _MSC_VER )
+   static volatile long vecLevel = -1;
+   #define VEC_LEVEL_LOAD()      (vecLevel)
+   #define VEC_LEVEL_STORE(val)  (vecLevel = (long)(val))
+#else
+   static int vecLevel = -1;
+   #define VEC_LEVEL_LOAD()      __atomic_load_n( &vecLevel, __ATOMIC_RELAXED )
+   #define VEC_LEVEL_STORE(val)  __atomic_store_n( &vecLevel, (int)(val), __ATOMIC_RELAXED )
+#endif
+
+/* Elements outside of [min,max] are done with the C library. */
+static const double vecDomain[TA_VEC_FLOOR+1][2] =
+{
+   { -708.0, 708.0 },                  /* TA_VEC_EXP   */
+   { DBL_MIN, DBL_MAX },               /* TA_VEC_LN    */
+   { DBL_MIN, DBL_MAX },               /* TA_VEC_LOG10 */
+   { -VEC_TRIG_MAX, VEC_TRIG_MAX },    /* TA_VEC_SIN   */
+   { -VEC_TRIG_MAX, VEC_TRIG_MAX },    /* TA_VEC_COS   */
+   { -VEC_TRIG_MAX, VEC_TRIG_MAX },    /* TA_VEC_TAN   */
+   { -1.0, 1.0 },                      /* TA_VEC_ASIN  */
+   { -1.0, 1.0 },                      /* TA_VEC_ACOS  */
+   { -DBL_MAX, DBL_MAX },              /* TA_VEC_ATAN  */
+   { -708.0, 708.0 },                  /* TA_VEC_SINH  */
+   { -708.0, 708.0 },                  /* TA_VEC_COSH  */
+   { -22.0, 22.0 },                    /* TA_VEC_TANH  */
+   { 0.0, HUGE_VAL },                  /* TA_VEC_SQRT  */
+   { -HUGE_VAL, HUGE_VAL },            /* TA_VEC_CEIL  */
+   { -HUGE_VAL, HUGE_VAL }             /* TA_VEC_FLOOR */
+};
+
+static double (* const vecLibm[TA_VEC_FLOOR+1])( double ) =
+{
+   std_exp, std_log, std_log10, std_sin, std_cos, std_tan,
+   std_asin, std_acos, std_atan, std_sinh, std_cosh, std_tanh,
+   std_sqrt, std_ceil, std_floor
+};
+
+#define TA_VEC_ISA VEC_ISA_SSE2
+#include "ta_vec_kernel.h"
+#undef  TA_VEC_ISA
+
+#define TA_VEC_ISA VEC_ISA_AVX2
+#include "ta_vec_kernel.h"
+#undef  TA_VEC_ISA
+
+#define TA_VEC_ISA VEC_ISA_AVX512
+#include "ta_vec_kernel.h"
+#undef  TA_VEC_ISA
+#endif
+
+/**** Global functions definitions.   ****/
+int TA_INT_VecMath( TA_VecOp op, const double *in, double *out, int nb )
+{
+#if defined( TA_VEC_ENABLED )
+   /* The transcendental functions are approximated only when allowed. */
+   if( (op < TA_VEC_SQRT) && (TA_ThreadContext->mathMode != TA_MATH_FAST) )
+      return 0;
+
+   switch( TA_INT_VecGetLevel() )
+   {
+   case TA_VEC_LEVEL_AVX512:
+      vecMath_avx512( op, in, out, nb );
+      return 1;
+   case TA_VEC_LEVEL_AVX2:
+      vecMath_avx2( op, in, out, nb );
+      return 1;
+   default:
+      vecMath_sse2( op, in, out, nb );
+      return 1;
+   }
+#else
+   (void)op; (void)in; (void)out; (void)nb;
+   return 0;
+#endif
+}
+
+int TA_S_INT_VecMath( TA_VecOp op, const float *in, double *out, int nb )
+{
+#if defined( TA_VEC_ENABLED )
+   int i;
+
+   if( (op < TA_VEC_SQRT) && (TA_ThreadContext->mathMode != TA_MATH_FAST) )
+      return 0;
+
+   /* Same result as the float promoted to double by the C library call. */
+   for( i=0; i < nb; i++ )
+      out[i] = in[i];
+
+   return TA_INT_VecMath( op, out, out, nb );
+#else
+   (void)op; (void)in; (void)out; (void)nb;
+   return 0;
+#endif
+}
+
+int TA_INT_VecArith( TA_VecOp op,
+                     const double *in0, const double *in1,
+                     const double *in2, const double *in3,
+                     double *out, int nb )
+{
+#if defined( TA_VEC_ENABLED )
+   int i;
+
+   switch( TA_INT_VecGetLevel() )
+   {
+   case TA_VEC_LEVEL_AVX512:
+      i = vecArith_avx512( op, in0, in1, in2, in3, out, nb );
+      break;
+   case TA_VEC_LEVEL_AVX2:
+      i = vecArith_avx2( op, in0, in1, in2, in3, out, nb );
+      break;
+   default:
+      i = vecArith_sse2( op, in0, in1, in2, in3, out, nb );
+      break;
+   }
+
+   /* Same expressions as the TA functions for the last elements. */
+   for( ; i < nb; i++ )
+   {
+      switch( op )
+      {
+      case TA_VEC_ADD:      out[i] = in0[i]+in1[i]; break;
+      case TA_VEC_SUB:      out[i] = in0[i]-in1[i]; break;
+      case TA_VEC_MULT:     out[i] = in0[i]*in1[i]; break;
+      case TA_VEC_DIV:      out[i] = in0[i]/in1[i]; break;
+      case TA_VEC_AVGPRICE: out[i] = (in1[i]+in2[i]+in3[i]+in0[i])/4; break;
+      case TA_VEC_MEDPRICE: out[i] = (in0[i]+in1[i])/2.0; break;
+      case TA_VEC_TYPPRICE: out[i] = (in0[i]+in1[i]+in2[i])/3.0; break;
+      default:              out[i] = (in0[i]+in1[i]+(in2[i]*2.0))/4.0; break;
+      }
+   }
+
+   return 1;
+#else
+   (void)op; (void)in0; (void)in1; (void)in2; (void)in3; (void)out; (void)nb;
+   return 0;
+#endif
+}
+
+TA_VecLevel TA_INT_VecGetLevel( void )
+{
+#if defined( TA_VEC_ENABLED )
+   int level;
+
+   /* Many threads may do the detection at the same time,
+    * they all find the same value.
+    */
+   level = (int)VEC_LEVEL_LOAD();
+   if( level < 0 )
+   {
+      level = (int)detectLevel();
+      VEC_LEVEL_STORE( level );
+   }
+
+   return (TA_VecLevel)level;
+#else
+   return TA_VEC_LEVEL_NONE;
+#endif
+}
+
+void TA_INT_VecSetLevel( TA_VecLevel level )
+{
+#if defined( TA_VEC_ENABLED )
+   TA_VecLevel detected;
+
+   detected = detectLevel();
+   if( (level > detected) || (level == TA_VEC_LEVEL_NONE) )
+      level = detected;
+
+   VEC_LEVEL_STORE( level );
+#else
+   (void)level;
+#endif
+}
+
+/**** Local functions definitions.     ****/
+#if defined( TA_VEC_ENABLED )
+static TA_VecLevel detectLevel( void )
+{
+#if defined( _MSC_VER )
+   int info[4];
+   unsigned long long xcr0;
+
+   __cpuid( info, 0 );
+   if( info[0] < 7 )
+      return TA_VEC_LEVEL_SSE2;
+
+   /* The OS must save the AVX (and AVX-512) registers. */
+   __cpuid( info, 1 );
+   if( !(info[2] & (1<<27)) )
+      return TA_VEC_LEVEL_SSE2;
+   xcr0 = _xgetbv( 0 );
+
+   __cpuidex( info, 7, 0 );
+   if( (info[1] & (1<<16)) && ((xcr0 & 0xE6) == 0xE6) )
+      return TA_VEC_LEVEL_AVX512;
+   if( (info[1] & (1<<5)) && ((xcr0 & 0x06) == 0x06) )
+      return TA_VEC_LEVEL_AVX2;
+
+   return TA_VEC_LEVEL_SSE2;
+#else
+   __builtin_cpu_init();
+
+   if( __builtin_cpu_supports( "avx512f" ) )
+      return TA_VEC_LEVEL_AVX512;
+   if( __builtin_cpu_supports( "avx2" ) )
+      return TA_VEC_LEVEL_AVX2;
+
+   return TA_VEC_LEVEL_SSE2;
+#endif
+}
+#endif
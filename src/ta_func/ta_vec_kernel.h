@@ -0,0 +1,736 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ */
+
+/* Description:
+ *   Kernels of ta_vec.c. This file is included once for each set of
+ *   instructions, with TA_VEC_ISA defined to VEC_ISA_SSE2,
+ *   VEC_ISA_AVX2 or VEC_ISA_AVX512.
+ *
+ *   The operations are written with the VXXX macros below, so the
+ *   same calculations are done whatever the width of the vector. No
+ *   fused multiply-add is used, which makes the outputs identical for
+ *   all the instruction sets.
+ *
+ *   The approximations of the transcendental functions (TA_MATH_FAST)
+ *   first reduce the argument to a small range, then use the Taylor
+ *   series of the function on that range. They are valid only within
+ *   the domain of vecDomain (see ta_vec.c), the other elements are
+ *   re-calculated with the C library.
+ */
+
+#if TA_VEC_ISA == VEC_ISA_SSE2
+   #define VFUNC(name)     name##_sse2
+   #define VTARGET         TA_VEC_TARGET("sse2")
+   #define VWIDTH          2
+   #define VREAL           __m128d
+   #define VINT            __m128i
+   #define VMASK           __m128d
+   #define VLOAD(p)        _mm_loadu_pd(p)
+   #define VSTORE(p,v)     _mm_storeu_pd(p,v)
+   #define VSET(x)         _mm_set1_pd(x)
+   #define VADD(a,b)       _mm_add_pd(a,b)
+   #define VSUB(a,b)       _mm_sub_pd(a,b)
+   #define VMUL(a,b)       _mm_mul_pd(a,b)
+   #define VDIV(a,b)       _mm_div_pd(a,b)
+   #define VSQRT(a)        _mm_sqrt_pd(a)
+   #define VAND(a,b)       _mm_and_pd(a,b)
+   #define VANDNOT(a,b)    _mm_andnot_pd(a,b)
+   #define VOR(a,b)        _mm_or_pd(a,b)
+   #define VXOR(a,b)       _mm_xor_pd(a,b)
+   #define VCMPLT(a,b)     _mm_cmplt_pd(a,b)
+   #define VCMPLE(a,b)     _mm_cmple_pd(a,b)
+   #define VSEL(m,a,b)     _mm_or_pd(_mm_and_pd(m,a),_mm_andnot_pd(m,b))
+   #define VMASKAND(m1,m2) _mm_and_pd(m1,m2)
+   #define VMASKBITS(m)    _mm_movemask_pd(m)
+   #define VTOINT(a)       _mm_castpd_si128(a)
+   #define VTOREAL(i)      _mm_castsi128_pd(i)
+   #define VISET(x)        _mm_set1_epi64x(x)
+   #define VIADD(i,j)      _mm_add_epi64(i,j)
+   #define VISHL(i,n)      _mm_slli_epi64(i,n)
+   #define VISHR(i,n)      _mm_srli_epi64(i,n)
+   #define VFLOOR(a)       VFUNC(vfloor)(a)
+   #define VCEIL(a)        VFUNC(vceil)(a)
+#elif TA_VEC_ISA == VEC_ISA_AVX2
+   #define VFUNC(name)     name##_avx2
+   #define VTARGET         TA_VEC_TARGET("avx2")
+   #define VWIDTH          4
+   #define VREAL           __m256d
+   #define VINT            __m256i
+   #define VMASK           __m256d
+   #define VLOAD(p)        _mm256_loadu_pd(p)
+   #define VSTORE(p,v)     _mm256_storeu_pd(p,v)
+   #define VSET(x)         _mm256_set1_pd(x)
+   #define VADD(a,b)       _mm256_add_pd(a,b)
+   #define VSUB(a,b)       _mm256_sub_pd(a,b)
+   #define VMUL(a,b)       _mm256_mul_pd(a,b)
+   #define VDIV(a,b)       _mm256_div_pd(a,b)
+   #define VSQRT(a)        _mm256_sqrt_pd(a)
+   #define VAND(a,b)       _mm256_and_pd(a,b)
+   #define VANDNOT(a,b)    _mm256_andnot_pd(a,b)
+   #define VOR(a,b)        _mm256_or_pd(a,b)
+   #define VXOR(a,b)       _mm256_xor_pd(a,b)
+   #define VCMPLT(a,b)     _mm256_cmp_pd(a,b,_CMP_LT_OQ)
+   #define VCMPLE(a,b)     _mm256_cmp_pd(a,b,_CMP_LE_OQ)
+   #define VSEL(m,a,b)     _mm256_blendv_pd(b,a,m)
+   #define VMASKAND(m1,m2) _mm256_and_pd(m1,m2)
+   #define VMASKBITS(m)    _mm256_movemask_pd(m)
+   #define VTOINT(a)       _mm256_castpd_si256(a)
+   #define VTOREAL(i)      _mm256_castsi256_pd(i)
+   #define VISET(x)        _mm256_set1_epi64x(x)
+   #define VIADD(i,j)      _mm256_add_epi64(i,j)
+   #define VISHL(i,n)      _mm256_slli_epi64(i,n)
+   #define VISHR(i,n)      _mm256_srli_epi64(i,n)
+   #define VFLOOR(a)       _mm256_floor_pd(a)
+   #define VCEIL(a)        _mm256_ceil_pd(a)
+#elif TA_VEC_ISA == VEC_ISA_AVX512
+   /* Only AVX-512F: the logical operations are done on integers. */
+   #define VFUNC(name)     name##_avx512
+   #define VTARGET         TA_VEC_TARGET("avx512f")
+   #define VWIDTH          8
+   #define VREAL           __m512d
+   #define VINT            __m512i
+   #define VMASK           __mmask8
+   #define VLOAD(p)        _mm512_loadu_pd(p)
+   #define VSTORE(p,v)     _mm512_storeu_pd(p,v)
+   #define VSET(x)         _mm512_set1_pd(x)
+   #define VADD(a,b)       _mm512_add_pd(a,b)
+   #define VSUB(a,b)       _mm512_sub_pd(a,b)
+   #define VMUL(a,b)       _mm512_mul_pd(a,b)
+   #define VDIV(a,b)       _mm512_div_pd(a,b)
+   #define VSQRT(a)        _mm512_sqrt_pd(a)
+   #define VAND(a,b)       VTOREAL(_mm512_and_epi64(VTOINT(a),VTOINT(b)))
+   #define VANDNOT(a,b)    VTOREAL(_mm512_andnot_epi64(VTOINT(a),VTOINT(b)))
+   #define VOR(a,b)        VTOREAL(_mm512_or_epi64(VTOINT(a),VTOINT(b)))
+   #define VXOR(a,b)       VTOREAL(_mm512_xor_epi64(VTOINT(a),VTOINT(b)))
+   #define VCMPLT(a,b)     _mm512_cmp_pd_mask(a,b,_CMP_LT_OQ)
+   #define VCMPLE(a,b)     _mm512_cmp_pd_mask(a,b,_CMP_LE_OQ)
+   #define VSEL(m,a,b)     _mm512_mask_blend_pd(m,b,a)
+   #define VMASKAND(m1,m2) ((__mmask8)((m1)&(m2)))
+   #define VMASKBITS(m)    ((int)(m))
+   #define VTOINT(a)       _mm512_castpd_si512(a)
+   #define VTOREAL(i)      _mm512_castsi512_pd(i)
+   #define VISET(x)        _mm512_set1_epi64(x)
+   #define VIADD(i,j)      _mm512_add_epi64(i,j)
+   #define VISHL(i,n)      _mm512_slli_epi64(i,n)
+   #define VISHR(i,n)      _mm512_srli_epi64(i,n)
+   #define VFLOOR(a)       _mm512_roundscale_pd(a,_MM_FROUND_TO_NEG_INF|_MM_FROUND_NO_EXC)
+   #define VCEIL(a)        _mm512_roundscale_pd(a,_MM_FROUND_TO_POS_INF|_MM_FROUND_NO_EXC)
+#endif
+
+#define VABS(a)         VANDNOT(VSET(-0.0),a)
+#define VSIGN(a)        VAND(VSET(-0.0),a)
+#define VHORNER(p,x,c)  p = VADD(VMUL(p,x),VSET(c))
+
+/* f(x) rounds to x below this magnitude for the odd functions (also
+ * keeps the sign of -0.0).
+ */
+#define VTINY(x,y)      VSEL(VCMPLT(VABS(x),VSET(VEC_TINY)),x,y)
+
+#if TA_VEC_ISA == VEC_ISA_SSE2
+/* Nearest integer of x for |x| < 2^52 (SSE2 has no rounding
+ * instruction). The result is corrected for floor and ceil, and
+ * takes the sign of x for the zero results (floor(-0.0), ceil(-0.5)).
+ */
+static VTARGET VREAL VFUNC(vround)( VREAL x )
+{
+   VREAL magic;
+
+   magic = VOR( VSET(VEC_TWO_52), VSIGN(x) );
+   return VSUB( VADD( x, magic ), magic );
+}
+
+static VTARGET VREAL VFUNC(vfloor)( VREAL x )
+{
+   VREAL y;
+
+   y = VFUNC(vround)( x );
+   y = VSEL( VCMPLT( x, y ), VSUB( y, VSET(1.0) ), y );
+   y = VOR( y, VSIGN(x) );
+   return VSEL( VCMPLT( VABS(x), VSET(VEC_TWO_52) ), y, x );
+}
+
+static VTARGET VREAL VFUNC(vceil)( VREAL x )
+{
+   VREAL y;
+
+   y = VFUNC(vround)( x );
+   y = VSEL( VCMPLT( y, x ), VADD( y, VSET(1.0) ), y );
+   y = VOR( y, VSIGN(x) );
+   return VSEL( VCMPLT( VABS(x), VSET(VEC_TWO_52) ), y, x );
+}
+#endif
+
+/* exp(x) for |x| <= 708 */
+static VTARGET VREAL VFUNC(vexp)( VREAL x )
+{
+   VREAL k, r, p;
+   VINT  e;
+
+   /* x = k*ln(2)+r with |r| <= ln(2)/2. The low bits of
+    * k+VEC_ROUND_MAGIC are the integer k.
+    */
+   k = VADD( VMUL( x, VSET(VEC_LOG2E) ), VSET(VEC_ROUND_MAGIC) );
+   e = VTOINT( k );
+   k = VSUB( k, VSET(VEC_ROUND_MAGIC) );
+   r = VSUB( x, VMUL( k, VSET(VEC_LN2_HI) ) );
+   r = VSUB( r, VMUL( k, VSET(VEC_LN2_LO) ) );
+
+   p = VSET(1.6059043836821613e-10); /* 1/13! */
+   VHORNER( p, r, 2.08767569878681e-09 );
+   VHORNER( p, r, 2.505210838544172e-08 );
+   VHORNER( p, r, 2.755731922398589e-07 );
+   VHORNER( p, r, 2.7557319223985893e-06 );
+   VHORNER( p, r, 2.48015873015873e-05 );
+   VHORNER( p, r, 0.0001984126984126984 );
+   VHORNER( p, r, 0.001388888888888889 );
+   VHORNER( p, r, 0.008333333333333333 );
+   VHORNER( p, r, 0.041666666666666664 );
+   VHORNER( p, r, 0.16666666666666666 );
+   VHORNER( p, r, 0.5 );
+   VHORNER( p, r, 1.0 );
+   VHORNER( p, r, 1.0 );
+
+   /* Multiply by 2^k. */
+   e = VISHL( VIADD( e, VISET(1023) ), 52 );
+   return VMUL( p, VTOREAL(e) );
+}
+
+/* log(x) for a positive normal x: x = (1+f)*2^e with 1+f within
+ * [sqrt(2)/2,sqrt(2)]. Returns r such that log(1+f) = f-hfsq+r,
+ * where hfsq = f*f/2 (same decomposition as fdlibm).
+ */
+static VTARGET VREAL VFUNC(vlogf)( VREAL x, VREAL *e, VREAL *f, VREAL *hfsq )
+{
+   VREAL m, s, z, p;
+   VMASK big;
+
+   /* The biased exponent is converted to double by putting
+    * it in the mantissa of 2^52.
+    */
+   *e = VOR( VTOREAL( VISHR( VTOINT(x), 52 ) ), VSET(VEC_TWO_52) );
+   *e = VSUB( *e, VSET(VEC_TWO_52+1023.0) );
+   m  = VOR( VAND( x, VTOREAL( VISET(0x000FFFFFFFFFFFFFLL) ) ), VSET(1.0) );
+
+   big = VCMPLT( VSET(VEC_SQRT2), m );
+   m   = VSEL( big, VMUL( m, VSET(0.5) ), m );
+   *e  = VSEL( big, VADD( *e, VSET(1.0) ), *e );
+
+   /* log(1+f) = 2*atanh(s) with s = f/(2+f) */
+   *f    = VSUB( m, VSET(1.0) );
+   *hfsq = VMUL( VMUL( *f, *f ), VSET(0.5) );
+   s     = VDIV( *f, VADD( *f, VSET(2.0) ) );
+   z     = VMUL( s, s );
+
+   p = VSET(0.08695652173913043); /* 2/23 */
+   VHORNER( p, z, 0.09523809523809523 );
+   VHORNER( p, z, 0.10526315789473684 );
+   VHORNER( p, z, 0.11764705882352941 );
+   VHORNER( p, z, 0.13333333333333333 );
+   VHORNER( p, z, 0.15384615384615385 );
+   VHORNER( p, z, 0.18181818181818182 );
+   VHORNER( p, z, 0.2222222222222222 );
+   VHORNER( p, z, 0.2857142857142857 );
+   VHORNER( p, z, 0.4 );
+   VHORNER( p, z, 0.6666666666666666 );
+
+   return VMUL( s, VADD( *hfsq, VMUL( z, p ) ) );
+}
+
+static VTARGET VREAL VFUNC(vlog)( VREAL x )
+{
+   VREAL e, f, hfsq, r;
+
+   r = VFUNC(vlogf)( x, &e, &f, &hfsq );
+   r = VADD( r, VMUL( e, VSET(VEC_LN2_LO) ) );
+   return VSUB( VMUL( e, VSET(VEC_LN2_HI) ), VSUB( VSUB( hfsq, r ), f ) );
+}
+
+static VTARGET VREAL VFUNC(vlog10)( VREAL x )
+{
+   VREAL e, f, hfsq, r, hi, lo, y, w;
+
+   r = VFUNC(vlogf)( x, &e, &f, &hfsq );
+
+   /* log(1+f) = hi+lo, hi having only 21 bits so
+    * hi*VEC_INV_LN10_HI is exact.
+    */
+   hi = VSUB( f, hfsq );
+   hi = VAND( hi, VTOREAL( VISET(0xFFFFFFFF00000000LL) ) );
+   lo = VADD( VSUB( VSUB( f, hi ), hfsq ), r );
+
+   y  = VMUL( e, VSET(VEC_LOG10_2_HI) );
+   r  = VMUL( e, VSET(VEC_LOG10_2_LO) );
+   r  = VADD( r, VMUL( VADD( lo, hi ), VSET(VEC_INV_LN10_LO) ) );
+   r  = VADD( r, VMUL( lo, VSET(VEC_INV_LN10_HI) ) );
+   hi = VMUL( hi, VSET(VEC_INV_LN10_HI) );
+   w  = VADD( y, hi );
+   r  = VADD( r, VADD( VSUB( y, w ), hi ) );
+   return VADD( r, w );
+}
+
+/* a+b = s+err exactly (Knuth's two-sum). 's' must not be 'a'. */
+#define VTWOSUM(a,b,s,err) { \
+   VREAL bb; \
+   s   = VADD( a, b ); \
+   bb  = VSUB( s, a ); \
+   err = VADD( VSUB( a, VSUB( s, bb ) ), VSUB( b, bb ) ); \
+}
+
+/* sin(r) and cos(r) with x = k*pi/2+r for |x| <= VEC_TRIG_MAX.
+ * Returns the low bits of k.
+ */
+static VTARGET VINT VFUNC(vsincos)( VREAL x, VREAL *sinr, VREAL *cosr )
+{
+   VREAL k, hi, lo, e, z, p, hz, w;
+   VINT  q;
+
+   /* pi/2 is split in four parts, the first three having enough
+    * zeros at the end for k*part to be exact. r = hi+lo.
+    */
+   k  = VADD( VMUL( x, VSET(VEC_TWO_OVER_PI) ), VSET(VEC_ROUND_MAGIC) );
+   q  = VTOINT( k );
+   k  = VSUB( k, VSET(VEC_ROUND_MAGIC) );
+   w  = VSUB( x, VMUL( k, VSET(VEC_PIO2_1) ) );
+   VTWOSUM( w, VMUL( k, VSET(-VEC_PIO2_2) ), hi, lo );
+   VTWOSUM( hi, VMUL( k, VSET(-VEC_PIO2_3) ), w, e );
+   lo = VSUB( VADD( lo, e ), VMUL( k, VSET(VEC_PIO2_4) ) );
+   hi = w;
+   w  = VADD( hi, lo );
+   lo = VSUB( lo, VSUB( w, hi ) );
+   hi = w;
+   z  = VMUL( hi, hi );
+
+   /* sin(r) = hi+hi*z*p(z)+lo*(1-z/2) */
+   p = VSET(2.8114572543455206e-15); /* 1/17! */
+   VHORNER( p, z, -7.647163731819816e-13 );
+   VHORNER( p, z, 1.6059043836821613e-10 );
+   VHORNER( p, z, -2.505210838544172e-08 );
+   VHORNER( p, z, 2.7557319223985893e-06 );
+   VHORNER( p, z, -0.0001984126984126984 );
+   VHORNER( p, z, 0.008333333333333333 );
+   VHORNER( p, z, -0.16666666666666666 );
+   hz = VMUL( z, VSET(0.5) );
+   *sinr = VADD( hi, VADD( VMUL( VMUL( hi, z ), p ), VSUB( lo, VMUL( hz, lo ) ) ) );
+
+   /* cos(r) = 1-z/2+z*z*p(z)-hi*lo, the first subtraction
+    * being corrected as in fdlibm.
+    */
+   p = VSET(-1.5619206968586225e-16); /* -1/18! */
+   VHORNER( p, z, 4.779477332387385e-14 );
+   VHORNER( p, z, -1.1470745597729725e-11 );
+   VHORNER( p, z, 2.08767569878681e-09 );
+   VHORNER( p, z, -2.755731922398589e-07 );
+   VHORNER( p, z, 2.48015873015873e-05 );
+   VHORNER( p, z, -0.001388888888888889 );
+   VHORNER( p, z, 0.041666666666666664 );
+   w = VSUB( VSET(1.0), hz );
+   e = VSUB( VSUB( VSET(1.0), w ), hz );
+   *cosr = VADD( w, VADD( e, VSUB( VMUL( VMUL( z, z ), p ), VMUL( hi, lo ) ) ) );
+
+   return q;
+}
+
+/* All bits set when bit 0 of q is set. */
+#define VODD(q) VCMPLT( VOR( VTOREAL(VISHL(q,63)), VSET(1.0) ), VSET(0.0) )
+
+/* Sign bit taken from bit 1 of q. */
+#define VSIGNQ(q) VTOREAL( VISHL( VISHR(q,1), 63 ) )
+
+static VTARGET VREAL VFUNC(vsin)( VREAL x )
+{
+   VREAL s, c, y;
+   VINT  q;
+
+   q = VFUNC(vsincos)( x, &s, &c );
+   y = VSEL( VODD(q), c, s );
+   y = VXOR( y, VSIGNQ(q) );
+   return VTINY( x, y );
+}
+
+static VTARGET VREAL VFUNC(vcos)( VREAL x )
+{
+   VREAL s, c, y;
+   VINT  q;
+
+   q = VFUNC(vsincos)( x, &s, &c );
+   y = VSEL( VODD(q), s, c );
+   return VXOR( y, VSIGNQ( VIADD( q, VISET(1) ) ) );
+}
+
+static VTARGET VREAL VFUNC(vtan)( VREAL x )
+{
+   VREAL s, c, y;
+   VINT  q;
+
+   q = VFUNC(vsincos)( x, &s, &c );
+   y = VSEL( VODD(q), VDIV( VXOR( c, VSET(-0.0) ), s ), VDIV( s, c ) );
+   return VTINY( x, y );
+}
+
+/* Selects the point c of the reduction of atan when x > limit. */
+#define VATAN_POINT(limit,cj,hij,loj) { \
+   m  = VCMPLT( VSET(limit), x ); \
+   c  = VSEL( m, VSET(cj), c ); \
+   hi = VSEL( m, VSET(hij), hi ); \
+   lo = VSEL( m, VSET(loj), lo ); \
+}
+
+/* atan(x) for x >= 0 */
+static VTARGET VREAL VFUNC(vatanpos)( VREAL x )
+{
+   VREAL c, hi, lo, u, z, p;
+   VMASK m;
+
+   /* atan(x) = atan(c)+atan((x-c)/(1+x*c)) with c the nearest point,
+    * so |u| <= 0.125. Above 10, atan(x) = pi/2+atan(-1/x).
+    * atan(c) = hi+lo.
+    */
+   c  = VSET(0.0);
+   hi = VSET(0.0);
+   lo = VSET(0.0);
+   VATAN_POINT( 0.125, 0.25, 0.24497866312686414, 1.0698755618734451e-17 );
+   VATAN_POINT( 0.375, 0.5,  0.4636476090008061,  2.2698777452961687e-17 );
+   VATAN_POINT( 0.625, 0.75, 0.6435011087932844,  1.5834785051444286e-17 );
+   VATAN_POINT( 0.875, 1.0,  VEC_PI_4_HI,         VEC_PI_4_LO );
+   VATAN_POINT( 1.25,  1.5,  0.982793723247329,   1.3903311031230998e-17 );
+   VATAN_POINT( 2.0,   2.5,  1.1902899496825317,  7.683333629842069e-17 );
+   VATAN_POINT( 3.5,   5.0,  1.373400766945016,  -3.3077103557695165e-17 );
+
+   u  = VDIV( VSUB( x, c ), VADD( VSET(1.0), VMUL( x, c ) ) );
+   m  = VCMPLT( VSET(10.0), x );
+   u  = VSEL( m, VDIV( VSET(-1.0), x ), u );
+   hi = VSEL( m, VSET(VEC_PI_2_HI), hi );
+   lo = VSEL( m, VSET(VEC_PI_2_LO), lo );
+   z  = VMUL( u, u );
+
+   p = VSET(0.05263157894736842); /* 1/19 */
+   VHORNER( p, z, -0.058823529411764705 );
+   VHORNER( p, z, 0.06666666666666667 );
+   VHORNER( p, z, -0.07692307692307693 );
+   VHORNER( p, z, 0.09090909090909091 );
+   VHORNER( p, z, -0.1111111111111111 );
+   VHORNER( p, z, 0.14285714285714285 );
+   VHORNER( p, z, -0.2 );
+   VHORNER( p, z, 0.3333333333333333 );
+
+   /* atan(u) = u-u*z*p(z) */
+   return VADD( hi, VADD( VSUB( u, VMUL( VMUL( u, z ), p ) ), lo ) );
+}
+
+static VTARGET VREAL VFUNC(vatan)( VREAL x )
+{
+   VREAL y;
+
+   y = VOR( VFUNC(vatanpos)( VABS(x) ), VSIGN(x) );
+   return VTINY( x, y );
+}
+
+/* sqrt(1-x*x) for |x| <= 1 */
+static VTARGET VREAL VFUNC(vsqrt1mx2)( VREAL a )
+{
+   VREAL d;
+
+   d = VSEL( VCMPLT( a, VSET(0.5) ),
+             VSUB( VSET(1.0), VMUL( a, a ) ),
+             VMUL( VSUB( VSET(1.0), a ), VADD( VSET(1.0), a ) ) );
+   return VSQRT( d );
+}
+
+static VTARGET VREAL VFUNC(vasin)( VREAL x )
+{
+   VREAL a, y;
+
+   /* asin(x) = atan(x/sqrt(1-x*x)) */
+   a = VABS(x);
+   y = VFUNC(vatanpos)( VDIV( a, VFUNC(vsqrt1mx2)( a ) ) );
+   y = VOR( y, VSIGN(x) );
+   return VTINY( x, y );
+}
+
+static VTARGET VREAL VFUNC(vacos)( VREAL x )
+{
+   VREAL a, s, y;
+   VMASK small;
+
+   /* |x| <= 0.5: pi/2-asin(x).
+    * Else atan(sqrt(1-x*x)/x), or pi-atan(sqrt(1-x*x)/|x|) for x < 0.
+    */
+   a     = VABS(x);
+   s     = VFUNC(vsqrt1mx2)( a );
+   small = VCMPLE( a, VSET(0.5) );
+   y     = VFUNC(vatanpos)( VSEL( small, VDIV( a, s ), VDIV( s, a ) ) );
+
+   return VSEL( small,
+                VSUB( VSET(VEC_PI_2_HI), VSUB( VOR( y, VSIGN(x) ), VSET(VEC_PI_2_LO) ) ),
+                VSEL( VCMPLT( x, VSET(0.0) ),
+                      VSUB( VSET(VEC_PI_HI), VSUB( y, VSET(VEC_PI_LO) ) ),
+                      y ) );
+}
+
+/* sinh(x) for |x| < 1 (Taylor series) */
+static VTARGET VREAL VFUNC(vsinhsmall)( VREAL x )
+{
+   VREAL z, p;
+
+   z = VMUL( x, x );
+   p = VSET(8.22063524662433e-18); /* 1/19! */
+   VHORNER( p, z, 2.8114572543455206e-15 );
+   VHORNER( p, z, 7.647163731819816e-13 );
+   VHORNER( p, z, 1.6059043836821613e-10 );
+   VHORNER( p, z, 2.505210838544172e-08 );
+   VHORNER( p, z, 2.7557319223985893e-06 );
+   VHORNER( p, z, 0.0001984126984126984 );
+   VHORNER( p, z, 0.008333333333333333 );
+   VHORNER( p, z, 0.16666666666666666 );
+   return VADD( x, VMUL( VMUL( x, z ), p ) );
+}
+
+/* sinh(x) for |x| <= 708 */
+static VTARGET VREAL VFUNC(vsinh)( VREAL x )
+{
+   VREAL a, e, y;
+
+   a = VABS(x);
+   e = VFUNC(vexp)( a );
+   y = VMUL( VSUB( e, VDIV( VSET(1.0), e ) ), VSET(0.5) );
+   y = VSEL( VCMPLT( a, VSET(1.0) ), VFUNC(vsinhsmall)( x ), VOR( y, VSIGN(x) ) );
+   return VTINY( x, y );
+}
+
+/* cosh(x) for |x| <= 708 */
+static VTARGET VREAL VFUNC(vcosh)( VREAL x )
+{
+   VREAL e;
+
+   e = VFUNC(vexp)( VABS(x) );
+   return VMUL( VADD( e, VDIV( VSET(1.0), e ) ), VSET(0.5) );
+}
+
+/* tanh(x) for |x| <= 22 */
+static VTARGET VREAL VFUNC(vtanh)( VREAL x )
+{
+   VREAL a, e, ei, s, y;
+
+   a  = VABS(x);
+   e  = VFUNC(vexp)( a );
+   ei = VDIV( VSET(1.0), e );
+   s  = VSEL( VCMPLT( a, VSET(1.0) ),
+              VADD( VFUNC(vsinhsmall)( a ), VFUNC(vsinhsmall)( a ) ),
+              VSUB( e, ei ) );
+   y  = VOR( VDIV( s, VADD( e, ei ) ), VSIGN(x) );
+   return VTINY( x, y );
+}
+
+/* out[i] = f(in[i]) for the operations of TA_INT_VecMath. */
+static VTARGET VREAL VFUNC(vecMath1)( TA_VecOp op, VREAL x )
+{
+   switch( op )
+   {
+   case TA_VEC_EXP:   return VFUNC(vexp)( x );
+   case TA_VEC_LN:    return VFUNC(vlog)( x );
+   case TA_VEC_LOG10: return VFUNC(vlog10)( x );
+   case TA_VEC_SIN:   return VFUNC(vsin)( x );
+   case TA_VEC_COS:   return VFUNC(vcos)( x );
+   case TA_VEC_TAN:   return VFUNC(vtan)( x );
+   case TA_VEC_ASIN:  return VFUNC(vasin)( x );
+   case TA_VEC_ACOS:  return VFUNC(vacos)( x );
+   case TA_VEC_ATAN:  return VFUNC(vatan)( x );
+   case TA_VEC_SINH:  return VFUNC(vsinh)( x );
+   case TA_VEC_COSH:  return VFUNC(vcosh)( x );
+   case TA_VEC_TANH:  return VFUNC(vtanh)( x );
+   case TA_VEC_SQRT:  return VSQRT( x );
+   case TA_VEC_CEIL:  return VCEIL( x );
+   default:           return VFLOOR( x );
+   }
+}
+
+static VTARGET void VFUNC(vecMath)( TA_VecOp op, const double *in, double *out, int nb )
+{
+   double temp[VWIDTH];
+   VREAL x, lo, hi;
+   int i, j, nbLeft, inDomain;
+
+   lo = VSET( vecDomain[op][0] );
+   hi = VSET( vecDomain[op][1] );
+
+   for( i=0; i < nb; i += VWIDTH )
+   {
+      nbLeft = nb-i;
+      if( nbLeft >= VWIDTH )
+         x = VLOAD( &in[i] );
+      else
+      {
+         /* Last elements, completed with a value in all the domains. */
+         for( j=0; j < VWIDTH; j++ )
+            temp[j] = j < nbLeft? in[i+j] : 1.0;
+         x = VLOAD( temp );
+      }
+
+      inDomain = VMASKBITS( VMASKAND( VCMPLE( lo, x ), VCMPLE( x, hi ) ) );
+
+      if( nbLeft >= VWIDTH )
+         VSTORE( &out[i], VFUNC(vecMath1)( op, x ) );
+      else
+      {
+         VSTORE( temp, VFUNC(vecMath1)( op, x ) );
+         for( j=0; j < nbLeft; j++ )
+            out[i+j] = temp[j];
+      }
+
+      /* The other elements (not finite, too large...) are done
+       * by the C library. 'in' may be 'out'.
+       */
+      if( inDomain != (1<<VWIDTH)-1 )
+      {
+         VSTORE( temp, x );
+         for( j=0; (j < VWIDTH) && (j < nbLeft); j++ )
+         {
+            if( !(inDomain & (1<<j)) )
+               out[i+j] = vecLibm[op]( temp[j] );
+         }
+      }
+   }
+}
+
+/* Returns the number of elements done, a multiple of VWIDTH. */
+static VTARGET int VFUNC(vecArith)( TA_VecOp op,
+                                    const double *in0, const double *in1,
+                                    const double *in2, const double *in3,
+                                    double *out, int nb )
+{
+   int i;
+
+   nb -= nb%VWIDTH;
+
+   switch( op )
+   {
+   case TA_VEC_ADD:
+      for( i=0; i < nb; i += VWIDTH )
+         VSTORE( &out[i], VADD( VLOAD(&in0[i]), VLOAD(&in1[i]) ) );
+      break;
+   case TA_VEC_SUB:
+      for( i=0; i < nb; i += VWIDTH )
+         VSTORE( &out[i], VSUB( VLOAD(&in0[i]), VLOAD(&in1[i]) ) );
+      break;
+   case TA_VEC_MULT:
+      for( i=0; i < nb; i += VWIDTH )
+         VSTORE( &out[i], VMUL( VLOAD(&in0[i]), VLOAD(&in1[i]) ) );
+      break;
+   case TA_VEC_DIV:
+      for( i=0; i < nb; i += VWIDTH )
+         VSTORE( &out[i], VDIV( VLOAD(&in0[i]), VLOAD(&in1[i]) ) );
+      break;
+   case TA_VEC_AVGPRICE:
+      /* (High+Low+Close+Open)/4 */
+      for( i=0; i < nb; i += VWIDTH )
+         VSTORE( &out[i], VDIV( VADD( VADD( VADD( VLOAD(&in1[i]), VLOAD(&in2[i]) ),
+                                            VLOAD(&in3[i]) ),
+                                      VLOAD(&in0[i]) ),
+                                VSET(4.0) ) );
+      break;
+   case TA_VEC_MEDPRICE:
+      for( i=0; i < nb; i += VWIDTH )
+         VSTORE( &out[i], VDIV( VADD( VLOAD(&in0[i]), VLOAD(&in1[i]) ), VSET(2.0) ) );
+      break;
+   case TA_VEC_TYPPRICE:
+      for( i=0; i < nb; i += VWIDTH )
+         VSTORE( &out[i], VDIV( VADD( VADD( VLOAD(&in0[i]), VLOAD(&in1[i]) ),
+                                      VLOAD(&in2[i]) ),
+                                VSET(3.0) ) );
+      break;
+   default:
+      /* TA_VEC_WCLPRICE: (High+Low+(Close*2))/4 */
+      for( i=0; i < nb; i += VWIDTH )
+         VSTORE( &out[i], VDIV( VADD( VADD( VLOAD(&in0[i]), VLOAD(&in1[i]) ),
+                                      VMUL( VLOAD(&in2[i]), VSET(2.0) ) ),
+                                VSET(4.0) ) );
+      break;
+   }
+
+   return nb;
+}
+
+#undef VFUNC
+#undef VTARGET
+#undef VWIDTH
+#undef VREAL
+#undef VINT
+#undef VMASK
+#undef VLOAD
+#undef VSTORE
+#undef VSET
+#undef VADD
+#undef VSUB
+#undef VMUL
+#undef VDIV
+#undef VSQRT
+#undef VAND
+#undef VANDNOT
+#undef VOR
+#undef VXOR
+#undef VCMPLT
+#undef VCMPLE
+#undef VSEL
+#undef VMASKAND
+#undef VMASKBITS
+#undef VTOINT
+#undef VTOREAL
+#undef VISET
+#undef VIADD
+#undef VISHL
+#undef VISHR
+#undef VFLOOR
+#undef VCEIL
+#undef VABS
+#undef VSIGN
+#undef VHORNER
+#undef VTINY
+#undef VODD
+#undef VSIGNQ
+#undef VTWOSUM
+#undef VATAN_POINT
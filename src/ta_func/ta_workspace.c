@@ -0,0 +1,1136 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ */
+
+/* Description:
+ *   Call the TA functions needing temporary buffers with a workspace
+ *   provided by the caller instead of allocating from the heap.
+ *
+ *   TA_XXX_Workspace returns the number of double needed by TA_XXX
+ *   for the same range and parameters. This is the sum of all the
+ *   buffers allocated while TA_XXX executes, including the ones of
+ *   the functions it calls (TA_MA, TA_STOCHF...), each rounded up to
+ *   a multiple of double (see TA_INT_TempAlloc in ta_utility.c). The
+ *   size of each buffer comes from the same macro as its allocation
+ *   (TA_XXX_SIZE in ta_utility.h).
+ *
+ *   TA_XXX_WS makes the workspace the one of the calling thread
+ *   (TA_ThreadWorkspace) for the duration of the call to TA_XXX, so
+ *   the generated TA functions and the functions they call need no
+ *   change to use it.
+ */
+
+/**** Headers ****/
+#include "ta_func_ext.h"
+#include "ta_memory.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+
+/* Body of the TA_XXX_WS functions. 'size' is the call to
+ * TA_XXX_Workspace and 'call' the call to TA_XXX.
+ */
+#define WORKSPACE_CALL(size,call) { \
+   TA_Workspace threadWorkspace, *prevWorkspace; \
+   TA_RetCode retCode; \
+   int nbDouble; \
+   nbDouble = size; \
+   if( nbDouble < 0 ) \
+      return call; /* Let TA_XXX report the bad parameter. */ \
+   if( (nbDouble > 0) && (!workspace || (workspaceSize < nbDouble)) ) \
+      return TA_BAD_PARAM; \
+   threadWorkspace.begin = workspace; \
+   threadWorkspace.next  = workspace; \
+   threadWorkspace.end   = workspace? workspace+workspaceSize : NULL; \
+   prevWorkspace = TA_ThreadWorkspace; \
+   TA_ThreadWorkspace = &threadWorkspace; \
+   retCode = call; \
+   TA_ThreadWorkspace = prevWorkspace; \
+   return retCode; \
+}
+
+/**** Local functions declarations.    ****/
+static int workspaceDEMA( int startIdx, int endIdx, int optInTimePeriod, int inPlace );
+static int workspaceTEMA( int startIdx, int endIdx, int optInTimePeriod );
+static int workspaceMA( int startIdx, int endIdx, int optInTimePeriod,
+                        TA_MAType optInMAType, int inPlace );
+static int workspaceSTOCHF( int startIdx, int endIdx,
+                            int optInFastK_Period,
+                            int optInFastD_Period,
+                            TA_MAType optInFastD_MAType );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+int TA_DEMA_Workspace( int startIdx,
+                       int endIdx,
+                       int optInTimePeriod )
+{
+   if( (startIdx < 0) || (endIdx < startIdx) || (TA_DEMA_Lookback(optInTimePeriod) < 0) )
+      return -1;
+
+   if( optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 30;
+
+   return workspaceDEMA( startIdx, endIdx, optInTimePeriod, 0 );
+}
+
+int TA_TEMA_Workspace( int startIdx,
+                       int endIdx,
+                       int optInTimePeriod )
+{
+   if( (startIdx < 0) || (endIdx < startIdx) || (TA_TEMA_Lookback(optInTimePeriod) < 0) )
+      return -1;
+
+   if( optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 30;
+
+   return workspaceTEMA( startIdx, endIdx, optInTimePeriod );
+}
+
+int TA_TRIX_Workspace( int startIdx,
+                       int endIdx,
+                       int optInTimePeriod )
+{
+   int lookbackTotal;
+
+   if( (startIdx < 0) || (endIdx < startIdx) || (TA_TRIX_Lookback(optInTimePeriod) < 0) )
+      return -1;
+
+   if( optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 30;
+
+   lookbackTotal = (TA_EMA_Lookback(optInTimePeriod)*3) + TA_ROCR_Lookback(1);
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+   if( startIdx > endIdx )
+      return 0;
+
+   /* The three EMA are done in the same buffer. */
+   return TA_TRIX_EMA_SIZE(startIdx,endIdx,lookbackTotal);
+}
+
+int TA_MA_Workspace( int startIdx,
+                     int endIdx,
+                     int optInTimePeriod,
+                     TA_MAType optInMAType )
+{
+   if( (startIdx < 0) || (endIdx < startIdx) || (TA_MA_Lookback(optInTimePeriod,optInMAType) < 0) )
+      return -1;
+
+   if( optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 30;
+   if( (int)optInMAType == TA_INTEGER_DEFAULT )
+      optInMAType = TA_MAType_SMA;
+
+   return workspaceMA( startIdx, endIdx, optInTimePeriod, optInMAType, 0 );
+}
+
+int TA_APO_Workspace( int startIdx,
+                      int endIdx,
+                      int optInFastPeriod,
+                      int optInSlowPeriod,
+                      TA_MAType optInMAType )
+{
+   if( (startIdx < 0) || (endIdx < startIdx) ||
+       (TA_APO_Lookback(optInFastPeriod,optInSlowPeriod,optInMAType) < 0) )
+      return -1;
+
+   if( optInFastPeriod == TA_INTEGER_DEFAULT )
+      optInFastPeriod = 12;
+   if( optInSlowPeriod == TA_INTEGER_DEFAULT )
+      optInSlowPeriod = 26;
+   if( (int)optInMAType == TA_INTEGER_DEFAULT )
+      optInMAType = TA_MAType_SMA;
+
+   /* The fast MA buffer, then both MA over the whole range. */
+   return TA_PO_MA_SIZE(startIdx,endIdx) +
+          workspaceMA( startIdx, endIdx, optInFastPeriod, optInMAType, 0 ) +
+          workspaceMA( startIdx, endIdx, optInSlowPeriod, optInMAType, 0 );
+}
+
+int TA_PPO_Workspace( int startIdx,
+                      int endIdx,
+                      int optInFastPeriod,
+                      int optInSlowPeriod,
+                      TA_MAType optInMAType )
+{
+   /* Same calculation as the APO. */
+   return TA_APO_Workspace( startIdx, endIdx, optInFastPeriod, optInSlowPeriod, optInMAType );
+}
+
+int TA_MACD_Workspace( int startIdx,
+                       int endIdx,
+                       int optInFastPeriod,
+                       int optInSlowPeriod,
+                       int optInSignalPeriod )
+{
+   int lookbackSignal, lookbackTotal;
+
+   if( (startIdx < 0) || (endIdx < startIdx) ||
+       (TA_MACD_Lookback(optInFastPeriod,optInSlowPeriod,optInSignalPeriod) < 0) )
+      return -1;
+
+   if( optInFastPeriod == TA_INTEGER_DEFAULT )
+      optInFastPeriod = 12;
+   if( optInSlowPeriod == TA_INTEGER_DEFAULT )
+      optInSlowPeriod = 26;
+   if( optInSignalPeriod == TA_INTEGER_DEFAULT )
+      optInSignalPeriod = 9;
+
+   /* Same lookback as TA_INT_MACD, the slowest EMA is the
+    * longest period.
+    */
+   if( optInSlowPeriod < optInFastPeriod )
+      optInSlowPeriod = optInFastPeriod;
+   lookbackSignal = TA_EMA_Lookback( optInSignalPeriod );
+   lookbackTotal  = lookbackSignal + TA_EMA_Lookback( optInSlowPeriod );
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+   if( startIdx > endIdx )
+      return 0;
+
+   /* The fast and slow EMA buffers. */
+   return 2*TA_MACD_MA_SIZE(startIdx,endIdx,lookbackSignal);
+}
+
+int TA_MACDEXT_Workspace( int startIdx,
+                          int endIdx,
+                          int optInFastPeriod,
+                          TA_MAType optInFastMAType,
+                          int optInSlowPeriod,
+                          TA_MAType optInSlowMAType,
+                          int optInSignalPeriod,
+                          TA_MAType optInSignalMAType )
+{
+   int lookbackLargest, lookbackSignal, tempInteger;
+
+   if( (startIdx < 0) || (endIdx < startIdx) ||
+       (TA_MACDEXT_Lookback(optInFastPeriod,optInFastMAType,
+                            optInSlowPeriod,optInSlowMAType,
+                            optInSignalPeriod,optInSignalMAType) < 0) )
+      return -1;
+
+   if( optInFastPeriod == TA_INTEGER_DEFAULT )
+      optInFastPeriod = 12;
+   if( (int)optInFastMAType == TA_INTEGER_DEFAULT )
+      optInFastMAType = TA_MAType_SMA;
+   if( optInSlowPeriod == TA_INTEGER_DEFAULT )
+      optInSlowPeriod = 26;
+   if( (int)optInSlowMAType == TA_INTEGER_DEFAULT )
+      optInSlowMAType = TA_MAType_SMA;
+   if( optInSignalPeriod == TA_INTEGER_DEFAULT )
+      optInSignalPeriod = 9;
+   if( (int)optInSignalMAType == TA_INTEGER_DEFAULT )
+      optInSignalMAType = TA_MAType_SMA;
+
+   lookbackLargest = TA_MA_Lookback( optInFastPeriod, optInFastMAType );
+   tempInteger     = TA_MA_Lookback( optInSlowPeriod, optInSlowMAType );
+   if( tempInteger > lookbackLargest )
+      lookbackLargest = tempInteger;
+   lookbackSignal = TA_MA_Lookback( optInSignalPeriod, optInSignalMAType );
+
+   if( startIdx < lookbackSignal+lookbackLargest )
+      startIdx = lookbackSignal+lookbackLargest;
+   if( startIdx > endIdx )
+      return 0;
+
+   /* The fast and slow MA buffers, then the three MA. */
+   tempInteger = TA_MACD_MA_SIZE(startIdx,endIdx,lookbackSignal);
+   return 2*tempInteger +
+          workspaceMA( startIdx-lookbackSignal, endIdx, optInSlowPeriod, optInSlowMAType, 0 ) +
+          workspaceMA( startIdx-lookbackSignal, endIdx, optInFastPeriod, optInFastMAType, 0 ) +
+          workspaceMA( 0, tempInteger-1, optInSignalPeriod, optInSignalMAType, 0 );
+}
+
+int TA_STOCHF_Workspace( int startIdx,
+                         int endIdx,
+                         int optInFastK_Period,
+                         int optInFastD_Period,
+                         TA_MAType optInFastD_MAType )
+{
+   if( (startIdx < 0) || (endIdx < startIdx) ||
+       (TA_STOCHF_Lookback(optInFastK_Period,optInFastD_Period,optInFastD_MAType) < 0) )
+      return -1;
+
+   if( optInFastK_Period == TA_INTEGER_DEFAULT )
+      optInFastK_Period = 5;
+   if( optInFastD_Period == TA_INTEGER_DEFAULT )
+      optInFastD_Period = 3;
+   if( (int)optInFastD_MAType == TA_INTEGER_DEFAULT )
+      optInFastD_MAType = TA_MAType_SMA;
+
+   return workspaceSTOCHF( startIdx, endIdx, optInFastK_Period,
+                           optInFastD_Period, optInFastD_MAType );
+}
+
+int TA_STOCH_Workspace( int startIdx,
+                        int endIdx,
+                        int optInFastK_Period,
+                        int optInSlowK_Period,
+                        TA_MAType optInSlowK_MAType,
+                        int optInSlowD_Period,
+                        TA_MAType optInSlowD_MAType )
+{
+   int lookbackKSlow, lookbackDSlow, today, tempInteger;
+
+   if( (startIdx < 0) || (endIdx < startIdx) ||
+       (TA_STOCH_Lookback(optInFastK_Period,
+                          optInSlowK_Period,optInSlowK_MAType,
+                          optInSlowD_Period,optInSlowD_MAType) < 0) )
+      return -1;
+
+   if( optInFastK_Period == TA_INTEGER_DEFAULT )
+      optInFastK_Period = 5;
+   if( optInSlowK_Period == TA_INTEGER_DEFAULT )
+      optInSlowK_Period = 3;
+   if( (int)optInSlowK_MAType == TA_INTEGER_DEFAULT )
+      optInSlowK_MAType = TA_MAType_SMA;
+   if( optInSlowD_Period == TA_INTEGER_DEFAULT )
+      optInSlowD_Period = 3;
+   if( (int)optInSlowD_MAType == TA_INTEGER_DEFAULT )
+      optInSlowD_MAType = TA_MAType_SMA;
+
+   lookbackKSlow = TA_MA_Lookback( optInSlowK_Period, optInSlowK_MAType );
+   lookbackDSlow = TA_MA_Lookback( optInSlowD_Period, optInSlowD_MAType );
+   if( startIdx < (optInFastK_Period-1)+lookbackKSlow+lookbackDSlow )
+      startIdx = (optInFastK_Period-1)+lookbackKSlow+lookbackDSlow;
+   if( startIdx > endIdx )
+      return 0;
+
+   /* The windows of the highest and lowest, the buffer of
+    * the fast-K, then the slow-K MA (done in place in the
+    * buffer) and the slow-D MA.
+    */
+   today       = startIdx-lookbackKSlow-lookbackDSlow;
+   tempInteger = TA_STOCH_K_SIZE(today,endIdx);
+   return 2*WINDOW_EXTREME_WORKSPACE(optInFastK_Period) +
+          tempInteger +
+          workspaceMA( 0, tempInteger-1,
+                       optInSlowK_Period, optInSlowK_MAType, 1 ) +
+          workspaceMA( 0, tempInteger-lookbackKSlow-1,
+                       optInSlowD_Period, optInSlowD_MAType, 0 );
+}
+
+int TA_STOCHRSI_Workspace( int startIdx,
+                           int endIdx,
+                           int optInTimePeriod,
+                           int optInFastK_Period,
+                           int optInFastD_Period,
+                           TA_MAType optInFastD_MAType )
+{
+   int lookbackSTOCHF, lookbackTotal, tempArraySize;
+
+   if( (startIdx < 0) || (endIdx < startIdx) ||
+       (TA_STOCHRSI_Lookback(optInTimePeriod,optInFastK_Period,
+                             optInFastD_Period,optInFastD_MAType) < 0) )
+      return -1;
+
+   if( optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 14;
+   if( optInFastK_Period == TA_INTEGER_DEFAULT )
+      optInFastK_Period = 5;
+   if( optInFastD_Period == TA_INTEGER_DEFAULT )
+      optInFastD_Period = 3;
+   if( (int)optInFastD_MAType == TA_INTEGER_DEFAULT )
+      optInFastD_MAType = TA_MAType_SMA;
+
+   lookbackSTOCHF = TA_STOCHF_Lookback( optInFastK_Period, optInFastD_Period, optInFastD_MAType );
+   lookbackTotal  = TA_RSI_Lookback( optInTimePeriod ) + lookbackSTOCHF;
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+   if( startIdx > endIdx )
+      return 0;
+
+   /* The RSI buffer, then the STOCHF of the RSI. */
+   tempArraySize = TA_STOCHRSI_RSI_SIZE(startIdx,endIdx,lookbackSTOCHF);
+   return tempArraySize +
+          workspaceSTOCHF( 0, tempArraySize-1, optInFastK_Period,
+                           optInFastD_Period, optInFastD_MAType );
+}
+
+int TA_NATR_Workspace( int startIdx,
+                       int endIdx,
+                       int optInTimePeriod )
+{
+   int lookbackTotal;
+
+   if( (startIdx < 0) || (endIdx < startIdx) || (TA_NATR_Lookback(optInTimePeriod) < 0) )
+      return -1;
+
+   if( optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 14;
+
+   lookbackTotal = TA_NATR_Lookback( optInTimePeriod );
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+   if( (startIdx > endIdx) || (optInTimePeriod <= 1) )
+      return 0;
+
+   /* The true range buffer. */
+   return TA_NATR_TRANGE_SIZE(startIdx,endIdx,lookbackTotal);
+}
+
+int TA_ADXR_Workspace( int startIdx,
+                       int endIdx,
+                       int optInTimePeriod )
+{
+   int lookbackTotal;
+
+   if( (startIdx < 0) || (endIdx < startIdx) || (TA_ADXR_Lookback(optInTimePeriod) < 0) )
+      return -1;
+
+   if( optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 14;
+
+   lookbackTotal = TA_ADXR_Lookback( optInTimePeriod );
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+   if( startIdx > endIdx )
+      return 0;
+
+   /* The ADX buffer. */
+   return TA_ADXR_ADX_SIZE(startIdx,endIdx,optInTimePeriod);
+}
+
+int TA_CCI_Workspace( int startIdx,
+                      int endIdx,
+                      int optInTimePeriod )
+{
+   if( (startIdx < 0) || (endIdx < startIdx) || (TA_CCI_Lookback(optInTimePeriod) < 0) )
+      return -1;
+
+   if( optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 14;
+
+   if( startIdx < optInTimePeriod-1 )
+      startIdx = optInTimePeriod-1;
+   if( startIdx > endIdx )
+      return 0;
+
+   /* The tree is used only in TA_MATH_FAST, but the size must
+    * not depend on the math mode when the workspace is allocated.
+    * It is also larger than the circular buffer of the direct
+    * calculation.
+    */
+   if( optInTimePeriod >= TA_AVGDEV_TREE_MIN_PERIOD )
+      return TA_INT_AvgDevTreeWorkspace( optInTimePeriod, endIdx-startIdx+1 );
+
+   return CIRCBUF_WORKSPACE( double, optInTimePeriod, TA_CCI_LOCAL_SIZE );
+}
+
+int TA_MFI_Workspace( int startIdx,
+                      int endIdx,
+                      int optInTimePeriod )
+{
+   if( (startIdx < 0) || (endIdx < startIdx) || (TA_MFI_Lookback(optInTimePeriod) < 0) )
+      return -1;
+
+   if( optInTimePeriod == TA_INTEGER_DEFAULT )
+      optInTimePeriod = 14;
+
+   /* The circular buffer of the money flows (two double each,
+    * see ta_MFI.c) is allocated for any range.
+    */
+   return CIRCBUF_WORKSPACE( double[2], optInTimePeriod, TA_MFI_LOCAL_SIZE );
+}
+
+TA_RetCode TA_DEMA_WS( int    startIdx,
+                       int    endIdx,
+                       const double inReal[],
+                       int           optInTimePeriod,
+                       double        workspace[],
+                       int           workspaceSize,
+                       int          *outBegIdx,
+                       int          *outNBElement,
+                       double        outReal[] )
+{
+   WORKSPACE_CALL( TA_DEMA_Workspace(startIdx, endIdx, optInTimePeriod),
+                   TA_DEMA(startIdx, endIdx, inReal, optInTimePeriod, outBegIdx,
+                           outNBElement, outReal) )
+}
+
+TA_RetCode TA_S_DEMA_WS( int    startIdx,
+                         int    endIdx,
+                         const float  inReal[],
+                         int           optInTimePeriod,
+                         double        workspace[],
+                         int           workspaceSize,
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double        outReal[] )
+{
+   WORKSPACE_CALL( TA_DEMA_Workspace(startIdx, endIdx, optInTimePeriod),
+                   TA_S_DEMA(startIdx, endIdx, inReal, optInTimePeriod, outBegIdx,
+                             outNBElement, outReal) )
+}
+
+TA_RetCode TA_TEMA_WS( int    startIdx,
+                       int    endIdx,
+                       const double inReal[],
+                       int           optInTimePeriod,
+                       double        workspace[],
+                       int           workspaceSize,
+                       int          *outBegIdx,
+                       int          *outNBElement,
+                       double        outReal[] )
+{
+   WORKSPACE_CALL( TA_TEMA_Workspace(startIdx, endIdx, optInTimePeriod),
+                   TA_TEMA(startIdx, endIdx, inReal, optInTimePeriod, outBegIdx,
+                           outNBElement, outReal) )
+}
+
+TA_RetCode TA_S_TEMA_WS( int    startIdx,
+                         int    endIdx,
+                         const float  inReal[],
+                         int           optInTimePeriod,
+                         double        workspace[],
+                         int           workspaceSize,
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double        outReal[] )
+{
+   WORKSPACE_CALL( TA_TEMA_Workspace(startIdx, endIdx, optInTimePeriod),
+                   TA_S_TEMA(startIdx, endIdx, inReal, optInTimePeriod, outBegIdx,
+                             outNBElement, outReal) )
+}
+
+TA_RetCode TA_TRIX_WS( int    startIdx,
+                       int    endIdx,
+                       const double inReal[],
+                       int           optInTimePeriod,
+                       double        workspace[],
+                       int           workspaceSize,
+                       int          *outBegIdx,
+                       int          *outNBElement,
+                       double        outReal[] )
+{
+   WORKSPACE_CALL( TA_TRIX_Workspace(startIdx, endIdx, optInTimePeriod),
+                   TA_TRIX(startIdx, endIdx, inReal, optInTimePeriod, outBegIdx,
+                           outNBElement, outReal) )
+}
+
+TA_RetCode TA_S_TRIX_WS( int    startIdx,
+                         int    endIdx,
+                         const float  inReal[],
+                         int           optInTimePeriod,
+                         double        workspace[],
+                         int           workspaceSize,
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double        outReal[] )
+{
+   WORKSPACE_CALL( TA_TRIX_Workspace(startIdx, endIdx, optInTimePeriod),
+                   TA_S_TRIX(startIdx, endIdx, inReal, optInTimePeriod, outBegIdx,
+                             outNBElement, outReal) )
+}
+
+TA_RetCode TA_MA_WS( int    startIdx,
+                     int    endIdx,
+                     const double inReal[],
+                     int           optInTimePeriod,
+                     TA_MAType     optInMAType,
+                     double        workspace[],
+                     int           workspaceSize,
+                     int          *outBegIdx,
+                     int          *outNBElement,
+                     double        outReal[] )
+{
+   WORKSPACE_CALL( TA_MA_Workspace(startIdx, endIdx, optInTimePeriod, optInMAType),
+                   TA_MA(startIdx, endIdx, inReal, optInTimePeriod, optInMAType,
+                         outBegIdx, outNBElement, outReal) )
+}
+
+TA_RetCode TA_S_MA_WS( int    startIdx,
+                       int    endIdx,
+                       const float  inReal[],
+                       int           optInTimePeriod,
+                       TA_MAType     optInMAType,
+                       double        workspace[],
+                       int           workspaceSize,
+                       int          *outBegIdx,
+                       int          *outNBElement,
+                       double        outReal[] )
+{
+   WORKSPACE_CALL( TA_MA_Workspace(startIdx, endIdx, optInTimePeriod, optInMAType),
+                   TA_S_MA(startIdx, endIdx, inReal, optInTimePeriod, optInMAType,
+                           outBegIdx, outNBElement, outReal) )
+}
+
+TA_RetCode TA_APO_WS( int    startIdx,
+                      int    endIdx,
+                      const double inReal[],
+                      int           optInFastPeriod,
+                      int           optInSlowPeriod,
+                      TA_MAType     optInMAType,
+                      double        workspace[],
+                      int           workspaceSize,
+                      int          *outBegIdx,
+                      int          *outNBElement,
+                      double        outReal[] )
+{
+   WORKSPACE_CALL( TA_APO_Workspace(startIdx, endIdx, optInFastPeriod, optInSlowPeriod,
+                                    optInMAType),
+                   TA_APO(startIdx, endIdx, inReal, optInFastPeriod, optInSlowPeriod,
+                          optInMAType, outBegIdx, outNBElement, outReal) )
+}
+
+TA_RetCode TA_S_APO_WS( int    startIdx,
+                        int    endIdx,
+                        const float  inReal[],
+                        int           optInFastPeriod,
+                        int           optInSlowPeriod,
+                        TA_MAType     optInMAType,
+                        double        workspace[],
+                        int           workspaceSize,
+                        int          *outBegIdx,
+                        int          *outNBElement,
+                        double        outReal[] )
+{
+   WORKSPACE_CALL( TA_APO_Workspace(startIdx, endIdx, optInFastPeriod, optInSlowPeriod,
+                                    optInMAType),
+                   TA_S_APO(startIdx, endIdx, inReal, optInFastPeriod, optInSlowPeriod,
+                            optInMAType, outBegIdx, outNBElement, outReal) )
+}
+
+TA_RetCode TA_PPO_WS( int    startIdx,
+                      int    endIdx,
+                      const double inReal[],
+                      int           optInFastPeriod,
+                      int           optInSlowPeriod,
+                      TA_MAType     optInMAType,
+                      double        workspace[],
+                      int           workspaceSize,
+                      int          *outBegIdx,
+                      int          *outNBElement,
+                      double        outReal[] )
+{
+   WORKSPACE_CALL( TA_PPO_Workspace(startIdx, endIdx, optInFastPeriod, optInSlowPeriod,
+                                    optInMAType),
+                   TA_PPO(startIdx, endIdx, inReal, optInFastPeriod, optInSlowPeriod,
+                          optInMAType, outBegIdx, outNBElement, outReal) )
+}
+
+TA_RetCode TA_S_PPO_WS( int    startIdx,
+                        int    endIdx,
+                        const float  inReal[],
+                        int           optInFastPeriod,
+                        int           optInSlowPeriod,
+                        TA_MAType     optInMAType,
+                        double        workspace[],
+                        int           workspaceSize,
+                        int          *outBegIdx,
+                        int          *outNBElement,
+                        double        outReal[] )
+{
+   WORKSPACE_CALL( TA_PPO_Workspace(startIdx, endIdx, optInFastPeriod, optInSlowPeriod,
+                                    optInMAType),
+                   TA_S_PPO(startIdx, endIdx, inReal, optInFastPeriod, optInSlowPeriod,
+                            optInMAType, outBegIdx, outNBElement, outReal) )
+}
+
+TA_RetCode TA_MACD_WS( int    startIdx,
+                       int    endIdx,
+                       const double inReal[],
+                       int           optInFastPeriod,
+                       int           optInSlowPeriod,
+                       int           optInSignalPeriod,
+                       double        workspace[],
+                       int           workspaceSize,
+                       int          *outBegIdx,
+                       int          *outNBElement,
+                       double        outMACD[],
+                       double        outMACDSignal[],
+                       double        outMACDHist[] )
+{
+   WORKSPACE_CALL( TA_MACD_Workspace(startIdx, endIdx, optInFastPeriod, optInSlowPeriod,
+                                     optInSignalPeriod),
+                   TA_MACD(startIdx, endIdx, inReal, optInFastPeriod, optInSlowPeriod,
+                           optInSignalPeriod, outBegIdx, outNBElement, outMACD,
+                           outMACDSignal, outMACDHist) )
+}
+
+TA_RetCode TA_S_MACD_WS( int    startIdx,
+                         int    endIdx,
+                         const float  inReal[],
+                         int           optInFastPeriod,
+                         int           optInSlowPeriod,
+                         int           optInSignalPeriod,
+                         double        workspace[],
+                         int           workspaceSize,
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double        outMACD[],
+                         double        outMACDSignal[],
+                         double        outMACDHist[] )
+{
+   WORKSPACE_CALL( TA_MACD_Workspace(startIdx, endIdx, optInFastPeriod, optInSlowPeriod,
+                                     optInSignalPeriod),
+                   TA_S_MACD(startIdx, endIdx, inReal, optInFastPeriod, optInSlowPeriod,
+                             optInSignalPeriod, outBegIdx, outNBElement, outMACD,
+                             outMACDSignal, outMACDHist) )
+}
+
+TA_RetCode TA_MACDEXT_WS( int    startIdx,
+                          int    endIdx,
+                          const double inReal[],
+                          int           optInFastPeriod,
+                          TA_MAType     optInFastMAType,
+                          int           optInSlowPeriod,
+                          TA_MAType     optInSlowMAType,
+                          int           optInSignalPeriod,
+                          TA_MAType     optInSignalMAType,
+                          double        workspace[],
+                          int           workspaceSize,
+                          int          *outBegIdx,
+                          int          *outNBElement,
+                          double        outMACD[],
+                          double        outMACDSignal[],
+                          double        outMACDHist[] )
+{
+   WORKSPACE_CALL( TA_MACDEXT_Workspace(startIdx, endIdx, optInFastPeriod,
+                                        optInFastMAType, optInSlowPeriod,
+                                        optInSlowMAType, optInSignalPeriod,
+                                        optInSignalMAType),
+                   TA_MACDEXT(startIdx, endIdx, inReal, optInFastPeriod,
+                              optInFastMAType, optInSlowPeriod, optInSlowMAType,
+                              optInSignalPeriod, optInSignalMAType, outBegIdx,
+                              outNBElement, outMACD, outMACDSignal, outMACDHist) )
+}
+
+TA_RetCode TA_S_MACDEXT_WS( int    startIdx,
+                            int    endIdx,
+                            const float  inReal[],
+                            int           optInFastPeriod,
+                            TA_MAType     optInFastMAType,
+                            int           optInSlowPeriod,
+                            TA_MAType     optInSlowMAType,
+                            int           optInSignalPeriod,
+                            TA_MAType     optInSignalMAType,
+                            double        workspace[],
+                            int           workspaceSize,
+                            int          *outBegIdx,
+                            int          *outNBElement,
+                            double        outMACD[],
+                            double        outMACDSignal[],
+                            double        outMACDHist[] )
+{
+   WORKSPACE_CALL( TA_MACDEXT_Workspace(startIdx, endIdx, optInFastPeriod,
+                                        optInFastMAType, optInSlowPeriod,
+                                        optInSlowMAType, optInSignalPeriod,
+                                        optInSignalMAType),
+                   TA_S_MACDEXT(startIdx, endIdx, inReal, optInFastPeriod,
+                                optInFastMAType, optInSlowPeriod, optInSlowMAType,
+                                optInSignalPeriod, optInSignalMAType, outBegIdx,
+                                outNBElement, outMACD, outMACDSignal, outMACDHist) )
+}
+
+TA_RetCode TA_STOCHF_WS( int    startIdx,
+                         int    endIdx,
+                         const double inHigh[],
+                         const double inLow[],
+                         const double inClose[],
+                         int           optInFastK_Period,
+                         int           optInFastD_Period,
+                         TA_MAType     optInFastD_MAType,
+                         double        workspace[],
+                         int           workspaceSize,
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double        outFastK[],
+                         double        outFastD[] )
+{
+   WORKSPACE_CALL( TA_STOCHF_Workspace(startIdx, endIdx, optInFastK_Period,
+                                       optInFastD_Period, optInFastD_MAType),
+                   TA_STOCHF(startIdx, endIdx, inHigh, inLow, inClose,
+                             optInFastK_Period, optInFastD_Period, optInFastD_MAType,
+                             outBegIdx, outNBElement, outFastK, outFastD) )
+}
+
+TA_RetCode TA_S_STOCHF_WS( int    startIdx,
+                           int    endIdx,
+                           const float  inHigh[],
+                           const float  inLow[],
+                           const float  inClose[],
+                           int           optInFastK_Period,
+                           int           optInFastD_Period,
+                           TA_MAType     optInFastD_MAType,
+                           double        workspace[],
+                           int           workspaceSize,
+                           int          *outBegIdx,
+                           int          *outNBElement,
+                           double        outFastK[],
+                           double        outFastD[] )
+{
+   WORKSPACE_CALL( TA_STOCHF_Workspace(startIdx, endIdx, optInFastK_Period,
+                                       optInFastD_Period, optInFastD_MAType),
+                   TA_S_STOCHF(startIdx, endIdx, inHigh, inLow, inClose,
+                               optInFastK_Period, optInFastD_Period, optInFastD_MAType,
+                               outBegIdx, outNBElement, outFastK, outFastD) )
+}
+
+TA_RetCode TA_STOCH_WS( int    startIdx,
+                        int    endIdx,
+                        const double inHigh[],
+                        const double inLow[],
+                        const double inClose[],
+                        int           optInFastK_Period,
+                        int           optInSlowK_Period,
+                        TA_MAType     optInSlowK_MAType,
+                        int           optInSlowD_Period,
+                        TA_MAType     optInSlowD_MAType,
+                        double        workspace[],
+                        int           workspaceSize,
+                        int          *outBegIdx,
+                        int          *outNBElement,
+                        double        outSlowK[],
+                        double        outSlowD[] )
+{
+   WORKSPACE_CALL( TA_STOCH_Workspace(startIdx, endIdx, optInFastK_Period,
+                                      optInSlowK_Period, optInSlowK_MAType,
+                                      optInSlowD_Period, optInSlowD_MAType),
+                   TA_STOCH(startIdx, endIdx, inHigh, inLow, inClose, optInFastK_Period,
+                            optInSlowK_Period, optInSlowK_MAType, optInSlowD_Period,
+                            optInSlowD_MAType, outBegIdx, outNBElement, outSlowK,
+                            outSlowD) )
+}
+
+TA_RetCode TA_S_STOCH_WS( int    startIdx,
+                          int    endIdx,
+                          const float  inHigh[],
+                          const float  inLow[],
+                          const float  inClose[],
+                          int           optInFastK_Period,
+                          int           optInSlowK_Period,
+                          TA_MAType     optInSlowK_MAType,
+                          int           optInSlowD_Period,
+                          TA_MAType     optInSlowD_MAType,
+                          double        workspace[],
+                          int           workspaceSize,
+                          int          *outBegIdx,
+                          int          *outNBElement,
+                          double        outSlowK[],
+                          double        outSlowD[] )
+{
+   WORKSPACE_CALL( TA_STOCH_Workspace(startIdx, endIdx, optInFastK_Period,
+                                      optInSlowK_Period, optInSlowK_MAType,
+                                      optInSlowD_Period, optInSlowD_MAType),
+                   TA_S_STOCH(startIdx, endIdx, inHigh, inLow, inClose,
+                              optInFastK_Period, optInSlowK_Period, optInSlowK_MAType,
+                              optInSlowD_Period, optInSlowD_MAType, outBegIdx,
+                              outNBElement, outSlowK, outSlowD) )
+}
+
+TA_RetCode TA_STOCHRSI_WS( int    startIdx,
+                           int    endIdx,
+                           const double inReal[],
+                           int           optInTimePeriod,
+                           int           optInFastK_Period,
+                           int           optInFastD_Period,
+                           TA_MAType     optInFastD_MAType,
+                           double        workspace[],
+                           int           workspaceSize,
+                           int          *outBegIdx,
+                           int          *outNBElement,
+                           double        outFastK[],
+                           double        outFastD[] )
+{
+   WORKSPACE_CALL( TA_STOCHRSI_Workspace(startIdx, endIdx, optInTimePeriod,
+                                         optInFastK_Period, optInFastD_Period,
+                                         optInFastD_MAType),
+                   TA_STOCHRSI(startIdx, endIdx, inReal, optInTimePeriod,
+                               optInFastK_Period, optInFastD_Period, optInFastD_MAType,
+                               outBegIdx, outNBElement, outFastK, outFastD) )
+}
+
+TA_RetCode TA_S_STOCHRSI_WS( int    startIdx,
+                             int    endIdx,
+                             const float  inReal[],
+                             int           optInTimePeriod,
+                             int           optInFastK_Period,
+                             int           optInFastD_Period,
+                             TA_MAType     optInFastD_MAType,
+                             double        workspace[],
+                             int           workspaceSize,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outFastK[],
+                             double        outFastD[] )
+{
+   WORKSPACE_CALL( TA_STOCHRSI_Workspace(startIdx, endIdx, optInTimePeriod,
+                                         optInFastK_Period, optInFastD_Period,
+                                         optInFastD_MAType),
+                   TA_S_STOCHRSI(startIdx, endIdx, inReal, optInTimePeriod,
+                                 optInFastK_Period, optInFastD_Period,
+                                 optInFastD_MAType, outBegIdx, outNBElement, outFastK,
+                                 outFastD) )
+}
+
+TA_RetCode TA_NATR_WS( int    startIdx,
+                       int    endIdx,
+                       const double inHigh[],
+                       const double inLow[],
+                       const double inClose[],
+                       int           optInTimePeriod,
+                       double        workspace[],
+                       int           workspaceSize,
+                       int          *outBegIdx,
+                       int          *outNBElement,
+                       double        outReal[] )
+{
+   WORKSPACE_CALL( TA_NATR_Workspace(startIdx, endIdx, optInTimePeriod),
+                   TA_NATR(startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod,
+                           outBegIdx, outNBElement, outReal) )
+}
+
+TA_RetCode TA_S_NATR_WS( int    startIdx,
+                         int    endIdx,
+                         const float  inHigh[],
+                         const float  inLow[],
+                         const float  inClose[],
+                         int           optInTimePeriod,
+                         double        workspace[],
+                         int           workspaceSize,
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double        outReal[] )
+{
+   WORKSPACE_CALL( TA_NATR_Workspace(startIdx, endIdx, optInTimePeriod),
+                   TA_S_NATR(startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod,
+                             outBegIdx, outNBElement, outReal) )
+}
+
+TA_RetCode TA_ADXR_WS( int    startIdx,
+                       int    endIdx,
+                       const double inHigh[],
+                       const double inLow[],
+                       const double inClose[],
+                       int           optInTimePeriod,
+                       double        workspace[],
+                       int           workspaceSize,
+                       int          *outBegIdx,
+                       int          *outNBElement,
+                       double        outReal[] )
+{
+   WORKSPACE_CALL( TA_ADXR_Workspace(startIdx, endIdx, optInTimePeriod),
+                   TA_ADXR(startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod,
+                           outBegIdx, outNBElement, outReal) )
+}
+
+TA_RetCode TA_S_ADXR_WS( int    startIdx,
+                         int    endIdx,
+                         const float  inHigh[],
+                         const float  inLow[],
+                         const float  inClose[],
+                         int           optInTimePeriod,
+                         double        workspace[],
+                         int           workspaceSize,
+                         int          *outBegIdx,
+                         int          *outNBElement,
+                         double        outReal[] )
+{
+   WORKSPACE_CALL( TA_ADXR_Workspace(startIdx, endIdx, optInTimePeriod),
+                   TA_S_ADXR(startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod,
+                             outBegIdx, outNBElement, outReal) )
+}
+
+TA_RetCode TA_CCI_WS( int    startIdx,
+                      int    endIdx,
+                      const double inHigh[],
+                      const double inLow[],
+                      const double inClose[],
+                      int           optInTimePeriod,
+                      double        workspace[],
+                      int           workspaceSize,
+                      int          *outBegIdx,
+                      int          *outNBElement,
+                      double        outReal[] )
+{
+   WORKSPACE_CALL( TA_CCI_Workspace(startIdx, endIdx, optInTimePeriod),
+                   TA_CCI(startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod,
+                          outBegIdx, outNBElement, outReal) )
+}
+
+TA_RetCode TA_S_CCI_WS( int    startIdx,
+                        int    endIdx,
+                        const float  inHigh[],
+                        const float  inLow[],
+                        const float  inClose[],
+                        int           optInTimePeriod,
+                        double        workspace[],
+                        int           workspaceSize,
+                        int          *outBegIdx,
+                        int          *outNBElement,
+                        double        outReal[] )
+{
+   WORKSPACE_CALL( TA_CCI_Workspace(startIdx, endIdx, optInTimePeriod),
+                   TA_S_CCI(startIdx, endIdx, inHigh, inLow, inClose, optInTimePeriod,
+                            outBegIdx, outNBElement, outReal) )
+}
+
+TA_RetCode TA_MFI_WS( int    startIdx,
+                      int    endIdx,
+                      const double inHigh[],
+                      const double inLow[],
+                      const double inClose[],
+                      const double inVolume[],
+                      int           optInTimePeriod,
+                      double        workspace[],
+                      int           workspaceSize,
+                      int          *outBegIdx,
+                      int          *outNBElement,
+                      double        outReal[] )
+{
+   WORKSPACE_CALL( TA_MFI_Workspace(startIdx, endIdx, optInTimePeriod),
+                   TA_MFI(startIdx, endIdx, inHigh, inLow, inClose, inVolume,
+                          optInTimePeriod, outBegIdx, outNBElement, outReal) )
+}
+
+TA_RetCode TA_S_MFI_WS( int    startIdx,
+                        int    endIdx,
+                        const float  inHigh[],
+                        const float  inLow[],
+                        const float  inClose[],
+                        const float  inVolume[],
+                        int           optInTimePeriod,
+                        double        workspace[],
+                        int           workspaceSize,
+                        int          *outBegIdx,
+                        int          *outNBElement,
+                        double        outReal[] )
+{
+   WORKSPACE_CALL( TA_MFI_Workspace(startIdx, endIdx, optInTimePeriod),
+                   TA_S_MFI(startIdx, endIdx, inHigh, inLow, inClose, inVolume,
+                            optInTimePeriod, outBegIdx, outNBElement, outReal) )
+}
+
+/**** Local functions definitions.     ****/
+static int workspaceDEMA( int startIdx, int endIdx, int optInTimePeriod, int inPlace )
+{
+   int lookbackEMA;
+
+   lookbackEMA = TA_EMA_Lookback( optInTimePeriod );
+   if( startIdx < lookbackEMA*2 )
+      startIdx = lookbackEMA*2;
+   if( startIdx > endIdx )
+      return 0;
+
+   /* The first and second EMA buffers. The first EMA is
+    * done in the output when TA_DEMA is called in place
+    * (double input only).
+    */
+   return (inPlace? 0 : TA_DEMA_EMA1_SIZE(startIdx,endIdx,lookbackEMA)) +
+          TA_DEMA_EMA2_SIZE(startIdx,endIdx,lookbackEMA);
+}
+
+static int workspaceTEMA( int startIdx, int endIdx, int optInTimePeriod )
+{
+   int lookbackEMA;
+
+   lookbackEMA = TA_EMA_Lookback( optInTimePeriod );
+   if( startIdx < lookbackEMA*3 )
+      startIdx = lookbackEMA*3;
+   if( startIdx > endIdx )
+      return 0;
+
+   /* The first and second EMA buffers. */
+   return TA_TEMA_EMA1_SIZE(startIdx,endIdx,lookbackEMA) +
+          TA_TEMA_EMA2_SIZE(startIdx,endIdx,lookbackEMA);
+}
+
+static int workspaceMA( int startIdx, int endIdx, int optInTimePeriod,
+                        TA_MAType optInMAType, int inPlace )
+{
+   if( optInTimePeriod == 1 )
+      return 0;
+
+   switch( optInMAType )
+   {
+   case TA_MAType_DEMA:
+      return workspaceDEMA( startIdx, endIdx, optInTimePeriod, inPlace );
+   case TA_MAType_TEMA:
+      return workspaceTEMA( startIdx, endIdx, optInTimePeriod );
+   case TA_MAType_MAMA:
+      /* The FAMA output, ignored. */
+      return TA_MAMA_FAMA_SIZE(startIdx,endIdx);
+   default:
+      return 0;
+   }
+}
+
+static int workspaceSTOCHF( int startIdx, int endIdx,
+                            int optInFastK_Period,
+                            int optInFastD_Period,
+                            TA_MAType optInFastD_MAType )
+{
+   int lookbackFastD, today, tempInteger;
+
+   lookbackFastD = TA_MA_Lookback( optInFastD_Period, optInFastD_MAType );
+   if( startIdx < (optInFastK_Period-1)+lookbackFastD )
+      startIdx = (optInFastK_Period-1)+lookbackFastD;
+   if( startIdx > endIdx )
+      return 0;
+
+   /* The windows of the highest and lowest, the buffer of
+    * the fast-K, then the fast-D MA.
+    */
+   today       = startIdx-lookbackFastD;
+   tempInteger = TA_STOCH_K_SIZE(today,endIdx);
+   return 2*WINDOW_EXTREME_WORKSPACE(optInFastK_Period) +
+          tempInteger +
+          workspaceMA( 0, tempInteger-1,
+                       optInFastD_Period, optInFastD_MAType, 0 );
+}
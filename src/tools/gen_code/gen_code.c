@@ -325,6 +325,9 @@ static void doForEachUnstableFunction( const TA_FuncInfo *funcInfo,
 
 static void doDefsFile( void );
 
+static int genFuncIdAndHash( void );
+static void addFuncIdAndHash( const TA_FuncInfo *funcInfo, void *opaqueData );
+
 static int gen_retcode( void );
 
 static void printIndent( FILE *out, unsigned int indent );
@@ -366,6 +369,9 @@ static void printFunc(FILE *out,
 
 static void printCallFrame  ( FILE *out, const TA_FuncInfo *funcInfo );
 static void printFrameHeader( FILE *out, const TA_FuncInfo *funcInfo, unsigned int lookbackSignature );
+static void printDirectFrameHeader( FILE *out, const TA_FuncInfo *funcInfo );
+static void printFrameInput( FILE *out, unsigned int paramNb, const char *dataName,
+                             const char *typeString, unsigned int *ptrNb );
 
 static void printExternReferenceForEachFunction( const TA_FuncInfo *info,
                                                  void *opaqueData );
@@ -460,11 +466,20 @@ static int genCode(int argc, char* argv[]);
 
 extern const TA_OptInputParameterInfo TA_DEF_UI_MA_Method;
 
+/* Same hash as TA_GetFuncHandle (see ta_abstract.c). */
+extern unsigned int TA_INT_FuncNameHash( const char *name, unsigned int seed );
+
 /* Set this variable to 1 whenever you wish to output a
  * prefix to all generated line.
  */
 int genPrefix = 0;
 
+/* Set this variable to 1 for having printFunc taking the
+ * inputs and outputs of a frame from the arrays of pointers
+ * 'in' and 'out' (see TA_FrameDirect in ta_frame_priv.h).
+ */
+int genDirectFrame = 0;
+
 void print( FILE *out, const char *text, ... )
 {
    va_list arglist;
@@ -528,6 +543,7 @@ int main(int argc, char* argv[])
          printf( "     - ta-lib/ta_func_list.txt\n" );
          printf( "     - ta-lib/src/ta_common/ta_retcode.*\n" );
          printf( "     - ta-lib/src/ta_abstract/ta_group_idx.c\n");
+         printf( "     - ta-lib/src/ta_abstract/ta_func_id.txt\n");
          printf( "     - ta-lib/src/ta_abstract/frames/*.*\n");
          printf( "     - ta-lib/swig/src/interface/ta_func.swg\n" );
          printf( "     - ta-lib/dotnet/src/Core/TA-Lib-Core.vcproj (Win32 only)\n" );
@@ -1202,6 +1218,13 @@ static int genCode(int argc, char* argv[])
       print( gOutGroupIdx_C->file, "const unsigned int TA_TotalNbFunction =\n" );
       forEachGroup( printGroupSizeAddition, NULL );
 
+      /* The ids and the hash of the names. */
+      if( genFuncIdAndHash() != 0 )
+      {
+         fileClose( gOutGroupIdx_C );
+         return -1;
+      }
+
       fileClose( gOutGroupIdx_C );
       genPrefix = 0;
 
@@ -1760,6 +1783,8 @@ static void doForEachFunctionPhase2( const TA_FuncInfo *funcInfo,
       printFrameHeader( gOutFrame_H->file, funcInfo, 0 );
       fprintf( gOutFrame_H->file, ";\n" );
       printFrameHeader( gOutFrame_H->file, funcInfo, 1 );
+      fprintf( gOutFrame_H->file, ";\n" );
+      printDirectFrameHeader( gOutFrame_H->file, funcInfo );
       fprintf( gOutFrame_H->file, ";\n\n" );
       printCallFrame( gOutFrame_C->file, funcInfo );
 
@@ -2009,6 +2034,7 @@ static void printFunc(FILE *out,
    unsigned int i, j, k, lastParam;
    int indent;
    unsigned int paramNb;
+   unsigned int ptrNb;
    const char *paramName;
    const char *defaultParamName;
    const TA_InputParameterInfo *inputParamInfo;
@@ -2246,6 +2272,7 @@ static void printFunc(FILE *out,
    if( frame )
       indent -= 5;
 
+   ptrNb = 0;
    if( frame && !lookbackSignature )
    {
       printIndent( out, indent );
@@ -2363,7 +2390,7 @@ static void printFunc(FILE *out,
                {
                   printIndent( out, indent );
                   if( frame )
-                     fprintf( out, "params->in[%d].data.inPrice.open, /*", paramNb );
+                     printFrameInput( out, paramNb, "inPrice.open", "TA_Real", &ptrNb );
 				  if( arrayToSubArrayCnvt )
 				  {
                      fprintf( out, "              gcnew SubArrayFrom1D<%s>(inOpen,0)", inputDoubleArrayType );
@@ -2384,7 +2411,7 @@ static void printFunc(FILE *out,
                {
                   printIndent( out, indent );
                   if( frame )
-                     fprintf( out, "params->in[%d].data.inPrice.high, /*", paramNb );
+                     printFrameInput( out, paramNb, "inPrice.high", "TA_Real", &ptrNb );
 				  if( arrayToSubArrayCnvt )
 				  {
                      fprintf( out, "              gcnew SubArrayFrom1D<%s>(inHigh,0)", inputDoubleArrayType );
@@ -2405,7 +2432,7 @@ static void printFunc(FILE *out,
                {
                   printIndent( out, indent );
                   if( frame )
-                     fprintf( out, "params->in[%d].data.inPrice.low, /*", paramNb );
+                     printFrameInput( out, paramNb, "inPrice.low", "TA_Real", &ptrNb );
                   if( arrayToSubArrayCnvt )
 				  {
 					  fprintf( out, "              gcnew SubArrayFrom1D<%s>(inLow,0)", inputDoubleArrayType );
@@ -2427,7 +2454,7 @@ static void printFunc(FILE *out,
                {
                   printIndent( out, indent );
                   if( frame )
-                     fprintf( out, "params->in[%d].data.inPrice.close, /*", paramNb );
+                     printFrameInput( out, paramNb, "inPrice.close", "TA_Real", &ptrNb );
                   if( arrayToSubArrayCnvt )
 				  {
 					  fprintf( out, "              gcnew SubArrayFrom1D<%s>(inClose,0)", inputDoubleArrayType );
@@ -2449,7 +2476,7 @@ static void printFunc(FILE *out,
                {
                   printIndent( out, indent );
                   if( frame )
-                     fprintf( out, "params->in[%d].data.inPrice.volume, /*", paramNb );
+                     printFrameInput( out, paramNb, "inPrice.volume", "TA_Real", &ptrNb );
                   if( arrayToSubArrayCnvt )
 				  {
 					  fprintf( out, "              gcnew SubArrayFrom1D<%s>(inVolume,0)", inputDoubleArrayType );
@@ -2471,7 +2498,7 @@ static void printFunc(FILE *out,
                {
                   printIndent( out, indent );
                   if( frame )
-                     fprintf( out, "params->in[%d].data.inPrice.openInterest, /*", paramNb );
+                     printFrameInput( out, paramNb, "inPrice.openInterest", "TA_Real", &ptrNb );
                   if( arrayToSubArrayCnvt )
 				  {
 					  fprintf( out, "              gcnew SubArrayFrom1D<%s>(inOpenInterest,0)", inputDoubleArrayType );
@@ -2516,7 +2543,9 @@ static void printFunc(FILE *out,
             {
 
                if( frame )
-                  fprintf( out, "params->in[%d].data.%s, /*", paramNb, defaultParamName );
+                  printFrameInput( out, paramNb, defaultParamName,
+                                   inputParamInfo->type == TA_Input_Integer? "TA_Integer":"TA_Real",
+                                   &ptrNb );
                if( outputForSWIG )
                   fprintf( out, "%-*s%s%s /* %s */",
                            prototype? 12 : 0,
@@ -2827,7 +2856,11 @@ static void printFunc(FILE *out,
          else
          {
             printIndent( out, indent );
-            if( frame )
+            if( frame && genDirectFrame )
+               fprintf( out, "(%s *)out[%d]%s /*",
+                      outputParamInfo->type == TA_Output_Integer? "TA_Integer":"TA_Real",
+                      paramNb, lastParam? "":"," );
+            else if( frame )
                fprintf( out, "params->out[%d].data.%s%s /*",
                       paramNb, defaultParamName,
                       lastParam? "":"," );
@@ -2893,6 +2926,15 @@ static void printCallFrame( FILE *out, const TA_FuncInfo *funcInfo )
    printFunc( out, "   return ", funcInfo, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0);
    print( out, "}\n" );
 
+   printDirectFrameHeader( out, funcInfo );
+   print( out, "{\n" );
+   if( funcInfo->nbOptInput == 0 )
+      print( out, "   (void)params;\n" );
+   genDirectFrame = 1;
+   printFunc( out, "   return ", funcInfo, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+   genDirectFrame = 0;
+   print( out, "}\n" );
+
    genPrefix = 0;
 }
 
@@ -2915,6 +2957,29 @@ static void printFrameHeader( FILE *out, const TA_FuncInfo *funcInfo, unsigned i
    }
 }
 
+static void printDirectFrameHeader( FILE *out, const TA_FuncInfo *funcInfo )
+{
+   if (!out) return;
+
+   print( out, "TA_RetCode TA_%s_FramePPDirect( const TA_ParamHolderPriv *params,\n", funcInfo->name );
+   print( out, "                          const void * const *in,\n" );
+   print( out, "                          void * const       *out,\n" );
+   print( out, "                          int            startIdx,\n" );
+   print( out, "                          int            endIdx,\n" );
+   print( out, "                          int           *outBegIdx,\n" );
+   print( out, "                          int           *outNBElement )\n" );
+}
+
+static void printFrameInput( FILE *out, unsigned int paramNb, const char *dataName,
+                             const char *typeString, unsigned int *ptrNb )
+{
+   /* A direct frame takes one pointer per price component. */
+   if( genDirectFrame )
+      fprintf( out, "(const %s *)in[%d], /*", typeString, (*ptrNb)++ );
+   else
+      fprintf( out, "params->in[%d].data.%s, /*", paramNb, dataName );
+}
+
 static void printExternReferenceForEachFunction( const TA_FuncInfo *info,
                                                  void *opaqueData )
 {
@@ -3005,6 +3070,224 @@ static void printGroupSizeAddition( const char *groupName,
    #endif
 }
 
+/* The id of a function never changes. The ids are kept in
+ * ta_func_id.txt: a new function is added at the end with the
+ * next id, and the id of a removed function is never re-used.
+ *
+ * TA_GetFuncHandle finds a name with a perfect hash: the
+ * name goes in one of FUNC_HASH_NB_BUCKET buckets, and the seed of
+ * the bucket gives its slot. The seeds are searched for the
+ * largest buckets first, so that no two names share a slot.
+ */
+#define FUNC_ID_MAX_NB       2048
+#define FUNC_ID_MAX_NAME     64
+#define FUNC_HASH_NB_SLOT    256
+#define FUNC_HASH_NB_BUCKET  64
+#define FUNC_HASH_MAX_SEED   65535
+#define FUNC_ID_FILE ta_fs_path(4, "..", "src", "ta_abstract", "ta_func_id.txt")
+
+static char gFuncIdName[FUNC_ID_MAX_NB][FUNC_ID_MAX_NAME];
+static int gFuncIdExist[FUNC_ID_MAX_NB];
+static unsigned int gNbFuncId;
+static int gFuncIdError;
+
+static int genFuncIdAndHash( void )
+{
+   FileHandle *idFile;
+   unsigned int i, j, id, nbFunc, bucket, nbInBucket, seed, slot;
+   unsigned int bucketSize[FUNC_HASH_NB_BUCKET];
+   unsigned int bucketOrder[FUNC_HASH_NB_BUCKET];
+   unsigned int seedOfBucket[FUNC_HASH_NB_BUCKET];
+   unsigned int idOfSlot[FUNC_HASH_NB_SLOT];
+   unsigned int slotOfFunc[FUNC_ID_MAX_NB];
+   unsigned int funcInBucket[FUNC_ID_MAX_NB];
+   int ok;
+
+   /* Read the ids already given. */
+   gNbFuncId = 0;
+   gFuncIdError = 0;
+   memset( gFuncIdExist, 0, sizeof(gFuncIdExist) );
+   idFile = fileOpen( FUNC_ID_FILE, NULL, FILE_READ );
+   if( idFile )
+   {
+      while( fgets( gTempBuf, BUFFER_SIZE, idFile->file ) != NULL )
+      {
+         if( (gTempBuf[0] == '#') || (gTempBuf[0] == '\n') || (gTempBuf[0] == '\r') )
+            continue;
+
+         if( (sscanf( gTempBuf, "%u %63s", &id, gTempBuf2 ) != 2) ||
+             (id != gNbFuncId+1) || (id >= FUNC_ID_MAX_NB) )
+         {
+            printf( "\nBad line in ta_func_id.txt: %s\n", gTempBuf );
+            fileClose( idFile );
+            return -1;
+         }
+         strcpy( gFuncIdName[id], gTempBuf2 );
+         gNbFuncId = id;
+      }
+      fileClose( idFile );
+   }
+
+   /* Give an id to the new functions. */
+   TA_ForEachFunc( addFuncIdAndHash, NULL );
+   if( gFuncIdError )
+      return -1;
+
+   idFile = fileOpen( FUNC_ID_FILE, NULL, FILE_WRITE|WRITE_ON_CHANGE_ONLY );
+   if( idFile == NULL )
+   {
+      printf( "\nCannot access [%s]\n", gToOpen );
+      return -1;
+   }
+   fprintf( idFile->file, "# Important: This file is updated by gen_code.\n" );
+   fprintf( idFile->file, "#\n" );
+   fprintf( idFile->file, "# Id of each function (see TA_GetFuncId). An id never changes\n" );
+   fprintf( idFile->file, "# and is never re-used: never modify or remove a line.\n" );
+   for( id=1; id <= gNbFuncId; id++ )
+      fprintf( idFile->file, "%u %s\n", id, gFuncIdName[id] );
+   fileClose( idFile );
+
+   /* Put the existing functions in their bucket. */
+   memset( bucketSize, 0, sizeof(bucketSize) );
+   nbFunc = 0;
+   for( id=1; id <= gNbFuncId; id++ )
+   {
+      if( gFuncIdExist[id] )
+      {
+         bucket = TA_INT_FuncNameHash( gFuncIdName[id], 0 )&(FUNC_HASH_NB_BUCKET-1);
+         bucketSize[bucket]++;
+         nbFunc++;
+      }
+   }
+
+   if( nbFunc > FUNC_HASH_NB_SLOT*3/4 )
+   {
+      printf( "\nToo many functions, increase FUNC_HASH_NB_SLOT\n" );
+      return -1;
+   }
+
+   /* The largest buckets first. */
+   for( i=0; i < FUNC_HASH_NB_BUCKET; i++ )
+      bucketOrder[i] = i;
+   for( i=1; i < FUNC_HASH_NB_BUCKET; i++ )
+   {
+      for( j=i; (j > 0) && (bucketSize[bucketOrder[j]] > bucketSize[bucketOrder[j-1]]); j-- )
+      {
+         bucket = bucketOrder[j];
+         bucketOrder[j] = bucketOrder[j-1];
+         bucketOrder[j-1] = bucket;
+      }
+   }
+
+   memset( idOfSlot, 0, sizeof(idOfSlot) );
+   memset( seedOfBucket, 0, sizeof(seedOfBucket) );
+   for( i=0; i < FUNC_HASH_NB_BUCKET; i++ )
+   {
+      bucket = bucketOrder[i];
+      if( bucketSize[bucket] == 0 )
+         break;
+
+      nbInBucket = 0;
+      for( id=1; id <= gNbFuncId; id++ )
+      {
+         if( gFuncIdExist[id] &&
+             ((TA_INT_FuncNameHash( gFuncIdName[id], 0 )&(FUNC_HASH_NB_BUCKET-1)) == bucket) )
+            funcInBucket[nbInBucket++] = id;
+      }
+
+      /* First seed where all the names of the bucket get a free slot. */
+      ok = 0;
+      for( seed=1; (seed <= FUNC_HASH_MAX_SEED) && !ok; seed++ )
+      {
+         for( j=0; j < nbInBucket; j++ )
+         {
+            id = funcInBucket[j];
+            slot = TA_INT_FuncNameHash( gFuncIdName[id], seed )&(FUNC_HASH_NB_SLOT-1);
+            if( idOfSlot[slot] != 0 )
+               break;
+            idOfSlot[slot] = id;
+            slotOfFunc[j] = slot;
+         }
+
+         if( j == nbInBucket )
+         {
+            seedOfBucket[bucket] = seed;
+            ok = 1;
+         }
+         else
+         {
+            /* Free the slots taken with this seed. */
+            while( j > 0 )
+               idOfSlot[slotOfFunc[--j]] = 0;
+         }
+      }
+
+      if( !ok )
+      {
+         printf( "\nNo perfect hash found, increase FUNC_HASH_NB_SLOT\n" );
+         return -1;
+      }
+   }
+
+   /* Output the tables. */
+   fprintf( gOutGroupIdx_C->file, "\n\n" );
+   print( gOutGroupIdx_C->file, "const TA_FuncDef *TA_FuncDefById[%u] = {\n", gNbFuncId+1 );
+   fprintf( gOutGroupIdx_C->file, "NULL,\n" );
+   for( id=1; id <= gNbFuncId; id++ )
+   {
+      if( gFuncIdExist[id] )
+         fprintf( gOutGroupIdx_C->file, "&TA_DEF_%s%s\n", gFuncIdName[id], id == gNbFuncId? "" : "," );
+      else
+         fprintf( gOutGroupIdx_C->file, "NULL%s\n", id == gNbFuncId? "" : "," );
+   }
+   print( gOutGroupIdx_C->file, "};\n\n" );
+   print( gOutGroupIdx_C->file, "const unsigned int TA_FuncIdMax = %u;\n\n", gNbFuncId );
+
+   print( gOutGroupIdx_C->file, "const unsigned int TA_FuncHashNbBucket = %u;\n", FUNC_HASH_NB_BUCKET );
+   print( gOutGroupIdx_C->file, "const unsigned int TA_FuncHashNbSlot = %u;\n\n", FUNC_HASH_NB_SLOT );
+
+   print( gOutGroupIdx_C->file, "const unsigned short TA_FuncHashSeed[%u] = {\n", FUNC_HASH_NB_BUCKET );
+   for( i=0; i < FUNC_HASH_NB_BUCKET; i++ )
+      fprintf( gOutGroupIdx_C->file, "%u%s", seedOfBucket[i],
+               i == FUNC_HASH_NB_BUCKET-1? "\n" : ((i%16) == 15? ",\n" : ",") );
+   print( gOutGroupIdx_C->file, "};\n\n" );
+
+   print( gOutGroupIdx_C->file, "const unsigned short TA_FuncHashId[%u] = {\n", FUNC_HASH_NB_SLOT );
+   for( i=0; i < FUNC_HASH_NB_SLOT; i++ )
+      fprintf( gOutGroupIdx_C->file, "%u%s", idOfSlot[i],
+               i == FUNC_HASH_NB_SLOT-1? "\n" : ((i%16) == 15? ",\n" : ",") );
+   print( gOutGroupIdx_C->file, "};" );
+
+   return 0;
+}
+
+static void addFuncIdAndHash( const TA_FuncInfo *funcInfo, void *opaqueData )
+{
+   unsigned int id;
+
+   (void)opaqueData; /* Get ride of compiler warning. */
+
+   for( id=1; id <= gNbFuncId; id++ )
+   {
+      if( strcmp( gFuncIdName[id], funcInfo->name ) == 0 )
+      {
+         gFuncIdExist[id] = 1;
+         return;
+      }
+   }
+
+   if( (gNbFuncId+1 >= FUNC_ID_MAX_NB) || (strlen( funcInfo->name ) >= FUNC_ID_MAX_NAME) )
+   {
+      printf( "\nCannot give an id to %s\n", funcInfo->name );
+      gFuncIdError = 1;
+      return;
+   }
+
+   gNbFuncId++;
+   strcpy( gFuncIdName[gNbFuncId], funcInfo->name );
+   gFuncIdExist[gNbFuncId] = 1;
+}
+
 static void doFuncFile( const TA_FuncInfo *funcInfo )
 {
 
@@ -0,0 +1,455 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ */
+
+/* Description:
+ *    Utilities shared by the benchmark tools (see ta_bench.h).
+ */
+
+/**** Headers ****/
+#if defined( __linux__ ) && !defined( _GNU_SOURCE )
+   #define _GNU_SOURCE
+#endif
+
+#ifdef WIN32
+   #include "windows.h"
+#else
+   #include <time.h>
+#endif
+
+#if defined( __linux__ )
+   #include <sched.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ta_bench.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef struct
+{
+   TA_BenchFuncList *list;
+   const char *names;
+} TA_BenchListBuild;
+
+/**** Local functions declarations.    ****/
+static void addFunc( const TA_FuncInfo *funcInfo, void *opaqueData );
+static int  isInList( const char *name, const char *names );
+static double randUniform( unsigned long long *state );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+int benchDataAlloc( TA_BenchData *data, int nbBars )
+{
+   TA_Real *buffer;
+   unsigned long long state;
+   double u, prevClose;
+   int i;
+
+   memset( data, 0, sizeof(TA_BenchData) );
+   buffer = (TA_Real *)malloc( sizeof(TA_Real)*7*(size_t)nbBars );
+   if( !buffer )
+      return 0;
+
+   data->nbBars       = nbBars;
+   data->open         = buffer;
+   data->high         = &buffer[(size_t)nbBars];
+   data->low          = &buffer[2*(size_t)nbBars];
+   data->close        = &buffer[3*(size_t)nbBars];
+   data->volume       = &buffer[4*(size_t)nbBars];
+   data->openInterest = &buffer[5*(size_t)nbBars];
+   data->unit         = &buffer[6*(size_t)nbBars];
+
+   /* A random walk, always the same for comparing the runs. */
+   state = 0x2545F4914F6CDD1DULL;
+   prevClose = 100.0;
+   for( i=0; i < nbBars; i++ )
+   {
+      u = randUniform( &state );
+      data->open[i]  = prevClose;
+      data->close[i] = prevClose*(1.0+0.02*(u-0.5));
+      u = randUniform( &state );
+      data->high[i]  = (data->open[i] > data->close[i]? data->open[i] : data->close[i])*(1.0+0.01*u);
+      u = randUniform( &state );
+      data->low[i]   = (data->open[i] < data->close[i]? data->open[i] : data->close[i])*(1.0-0.01*u);
+      u = randUniform( &state );
+      data->volume[i] = 1000.0+9000.0*u;
+      data->openInterest[i] = 5000.0+1000.0*u;
+      data->unit[i] = 0.99*(2.0*randUniform( &state )-1.0);
+      prevClose = data->close[i];
+
+      /* Stay away from 0 and from the overflows. */
+      if( (prevClose < 1.0) || (prevClose > 1.0e6) )
+         prevClose = 100.0;
+   }
+
+   return 1;
+}
+
+void benchDataFree( TA_BenchData *data )
+{
+   if( data->open )
+      free( data->open );
+   memset( data, 0, sizeof(TA_BenchData) );
+}
+
+int benchFuncListAlloc( TA_BenchFuncList *list, const char *names )
+{
+   TA_BenchListBuild build;
+   int nbFunc;
+
+   /* Count, then fill. */
+   nbFunc = 0;
+   list->nbFunc   = 0;
+   list->funcInfo = NULL;
+   build.list  = list;
+   build.names = names;
+   TA_ForEachFunc( addFunc, &build );
+
+   nbFunc = list->nbFunc;
+   if( nbFunc == 0 )
+      return 0;
+
+   list->funcInfo = (const TA_FuncInfo **)malloc( sizeof(const TA_FuncInfo *)*nbFunc );
+   if( !list->funcInfo )
+      return 0;
+
+   list->nbFunc = 0;
+   TA_ForEachFunc( addFunc, &build );
+
+   return 1;
+}
+
+void benchFuncListFree( TA_BenchFuncList *list )
+{
+   if( list->funcInfo )
+      free( (void *)list->funcInfo );
+   list->nbFunc   = 0;
+   list->funcInfo = NULL;
+}
+
+int benchHasPeriod( const TA_FuncInfo *funcInfo )
+{
+   const TA_OptInputParameterInfo *optInfo;
+   unsigned int i;
+
+   for( i=0; i < funcInfo->nbOptInput; i++ )
+   {
+      TA_GetOptInputParameterInfo( funcInfo->handle, i, &optInfo );
+      if( strcmp( optInfo->paramName, "optInTimePeriod" ) == 0 )
+         return 1;
+   }
+
+   return 0;
+}
+
+TA_RetCode benchCallAlloc( TA_BenchCall *call,
+                           const TA_FuncInfo *funcInfo,
+                           const TA_BenchData *data,
+                           int period )
+{
+   const TA_InputParameterInfo *inputInfo;
+   const TA_OptInputParameterInfo *optInfo;
+   const TA_OutputParameterInfo *outputInfo;
+   const TA_IntegerRange *range;
+   const TA_Real *real;
+   TA_RetCode retCode;
+   unsigned int i;
+   int value;
+
+   memset( call, 0, sizeof(TA_BenchCall) );
+   call->funcInfo = funcInfo;
+   call->period   = -1;
+
+   if( funcInfo->nbOutput > TA_BENCH_MAX_OUTPUT )
+      return TA_NOT_SUPPORTED;
+
+   retCode = TA_ParamHolderAlloc( funcInfo->handle, &call->params );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   for( i=0; i < funcInfo->nbInput; i++ )
+   {
+      TA_GetInputParameterInfo( funcInfo->handle, i, &inputInfo );
+      switch( inputInfo->type )
+      {
+      case TA_Input_Price:
+         retCode = TA_SetInputParamPricePtr( call->params, i,
+                      inputInfo->flags&TA_IN_PRICE_OPEN?         data->open         : NULL,
+                      inputInfo->flags&TA_IN_PRICE_HIGH?         data->high         : NULL,
+                      inputInfo->flags&TA_IN_PRICE_LOW?          data->low          : NULL,
+                      inputInfo->flags&TA_IN_PRICE_CLOSE?        data->close        : NULL,
+                      inputInfo->flags&TA_IN_PRICE_VOLUME?       data->volume       : NULL,
+                      inputInfo->flags&TA_IN_PRICE_OPENINTEREST? data->openInterest : NULL );
+         if( inputInfo->flags&TA_IN_PRICE_OPEN )         call->bytesPerBar += sizeof(TA_Real);
+         if( inputInfo->flags&TA_IN_PRICE_HIGH )         call->bytesPerBar += sizeof(TA_Real);
+         if( inputInfo->flags&TA_IN_PRICE_LOW )          call->bytesPerBar += sizeof(TA_Real);
+         if( inputInfo->flags&TA_IN_PRICE_CLOSE )        call->bytesPerBar += sizeof(TA_Real);
+         if( inputInfo->flags&TA_IN_PRICE_VOLUME )       call->bytesPerBar += sizeof(TA_Real);
+         if( inputInfo->flags&TA_IN_PRICE_OPENINTEREST ) call->bytesPerBar += sizeof(TA_Real);
+         break;
+      case TA_Input_Real:
+         /* The second real input of a function is another series. */
+         if( strcmp( funcInfo->group, "Math Transform" ) == 0 )
+            real = data->unit;
+         else
+            real = i == 0? data->close : data->open;
+         retCode = TA_SetInputParamRealPtr( call->params, i, real );
+         call->bytesPerBar += sizeof(TA_Real);
+         break;
+      default:
+         retCode = TA_NOT_SUPPORTED;
+         break;
+      }
+
+      if( retCode != TA_SUCCESS )
+      {
+         benchCallFree( call );
+         return retCode;
+      }
+   }
+
+   /* The other optional parameters keep their default. */
+   for( i=0; (i < funcInfo->nbOptInput) && (period > 0); i++ )
+   {
+      TA_GetOptInputParameterInfo( funcInfo->handle, i, &optInfo );
+      if( (strcmp( optInfo->paramName, "optInTimePeriod" ) == 0) &&
+          (optInfo->type == TA_OptInput_IntegerRange) )
+      {
+         range = (const TA_IntegerRange *)optInfo->dataSet;
+         value = period;
+         if( value < range->min )
+            value = range->min;
+         if( value > range->max )
+            value = range->max;
+
+         retCode = TA_SetOptInputParamInteger( call->params, i, value );
+         if( retCode != TA_SUCCESS )
+         {
+            benchCallFree( call );
+            return retCode;
+         }
+         call->period = value;
+      }
+   }
+
+   /* TA_Integer are not larger than TA_Real, so all the outputs
+    * use a buffer of TA_Real.
+    */
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      call->output[i] = (TA_Real *)malloc( sizeof(TA_Real)*(size_t)data->nbBars );
+      if( !call->output[i] )
+      {
+         benchCallFree( call );
+         return TA_ALLOC_ERR;
+      }
+
+      TA_GetOutputParameterInfo( funcInfo->handle, i, &outputInfo );
+      if( outputInfo->type == TA_Output_Integer )
+      {
+         retCode = TA_SetOutputParamIntegerPtr( call->params, i, (TA_Integer *)call->output[i] );
+         call->bytesPerBar += sizeof(TA_Integer);
+      }
+      else
+      {
+         retCode = TA_SetOutputParamRealPtr( call->params, i, call->output[i] );
+         call->bytesPerBar += sizeof(TA_Real);
+      }
+
+      if( retCode != TA_SUCCESS )
+      {
+         benchCallFree( call );
+         return retCode;
+      }
+   }
+
+   return TA_SUCCESS;
+}
+
+void benchCallFree( TA_BenchCall *call )
+{
+   int i;
+
+   for( i=0; i < TA_BENCH_MAX_OUTPUT; i++ )
+   {
+      if( call->output[i] )
+         free( call->output[i] );
+      call->output[i] = NULL;
+   }
+
+   if( call->params )
+      TA_ParamHolderFree( call->params );
+   call->params = NULL;
+}
+
+TA_RetCode benchCallDo( const TA_BenchCall *call, int nbBars )
+{
+   TA_Integer outBegIdx, outNBElement;
+
+   return TA_CallFunc( call->params, 0, nbBars-1, &outBegIdx, &outNBElement );
+}
+
+double benchNow( void )
+{
+#ifdef WIN32
+   LARGE_INTEGER counter, freq;
+
+   QueryPerformanceCounter( &counter );
+   QueryPerformanceFrequency( &freq );
+   return ((double)counter.QuadPart/(double)freq.QuadPart)*1.0e9;
+#else
+   struct timespec t;
+
+   clock_gettime( CLOCK_MONOTONIC, &t );
+   return ((double)t.tv_sec*1.0e9)+(double)t.tv_nsec;
+#endif
+}
+
+int benchPinThread( int cpu )
+{
+#if defined( __linux__ )
+   cpu_set_t set;
+
+   CPU_ZERO( &set );
+   CPU_SET( cpu, &set );
+   return sched_setaffinity( 0, sizeof(set), &set ) == 0;
+#elif defined( WIN32 )
+   return SetThreadAffinityMask( GetCurrentThread(), ((DWORD_PTR)1) << cpu ) != 0;
+#else
+   (void)cpu;
+   return 0;
+#endif
+}
+
+int benchParseList( const char *str, int *values, int max )
+{
+   char *end;
+   int nb;
+   long value;
+
+   nb = 0;
+   while( *str != '\0' )
+   {
+      if( nb == max )
+         return 0;
+
+      value = strtol( str, &end, 10 );
+      if( (end == str) || (value <= 0) || (value > 2000000000L) )
+         return 0;
+      values[nb++] = (int)value;
+
+      str = end;
+      if( *str == ',' )
+         str++;
+      else if( *str != '\0' )
+         return 0;
+   }
+
+   return nb;
+}
+
+/**** Local functions definitions.     ****/
+static void addFunc( const TA_FuncInfo *funcInfo, void *opaqueData )
+{
+   TA_BenchListBuild *build;
+
+   build = (TA_BenchListBuild *)opaqueData;
+   if( build->names && !isInList( funcInfo->name, build->names ) )
+      return;
+
+   if( build->list->funcInfo )
+      build->list->funcInfo[build->list->nbFunc] = funcInfo;
+   build->list->nbFunc++;
+}
+
+static int isInList( const char *name, const char *names )
+{
+   size_t len;
+
+   len = strlen( name );
+   while( *names != '\0' )
+   {
+      if( (strncmp( names, name, len ) == 0) &&
+          ((names[len] == ',') || (names[len] == '\0')) )
+         return 1;
+
+      names = strchr( names, ',' );
+      if( !names )
+         return 0;
+      names++;
+   }
+
+   return 0;
+}
+
+/* xorshift64* */
+static double randUniform( unsigned long long *state )
+{
+   unsigned long long x;
+
+   x = *state;
+   x ^= x >> 12;
+   x ^= x << 25;
+   x ^= x >> 27;
+   *state = x;
+
+   return (double)((x*0x2545F4914F6CDD1DULL) >> 11)*(1.0/9007199254740992.0);
+}
@@ -0,0 +1,404 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ */
+
+/* Description:
+ *    Benchmark of all the functions of the abstract interface.
+ *
+ *    Each function is called on the first N bars of a synthetic
+ *    series, for each size N and each value of optInTimePeriod (the
+ *    defaults are used for the functions without that parameter).
+ *
+ *    After a few calls for warming up the caches, the calls are timed
+ *    one by one. The median is reported in nanoseconds per bar, with
+ *    the variation between the calls and the scaling compared to the
+ *    smallest size (1.0 means the time per bar stays the same).
+ *
+ *    The results can be written in a JSON file, for comparing the
+ *    releases.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "ta_bench.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+#define MAX_SIZE   16
+#define MAX_PERIOD 16
+
+typedef struct
+{
+   int nbSize;
+   int size[MAX_SIZE];
+   int nbPeriod;
+   int period[MAX_PERIOD];
+   const char *funcNames;
+   int nbRepeat;
+   int nbWarmup;
+   int cpu;
+   const char *jsonFile;
+} TA_BenchOptions;
+
+typedef struct
+{
+   double nsPerBar;
+   double nsPerBarMin;
+   double cv;
+} TA_BenchResult;
+
+/**** Local functions declarations.    ****/
+static int  parseOptions( int argc, char **argv, TA_BenchOptions *options );
+static void printUsage( void );
+static TA_RetCode timeCall( const TA_BenchCall *call, int nbBars,
+                            const TA_BenchOptions *options,
+                            double *samples, TA_BenchResult *result );
+static int  compareDouble( const void *a, const void *b );
+
+/**** Local variables definitions.     ****/
+static const int defaultSize[]   = { 1000, 10000, 100000, 1000000 };
+static const int defaultPeriod[] = { 5, 14, 50, 200 };
+
+/**** Global functions definitions.   ****/
+int main( int argc, char **argv )
+{
+   TA_BenchOptions options;
+   TA_BenchData data;
+   TA_BenchFuncList list;
+   TA_BenchCall call;
+   TA_BenchResult result;
+   TA_RetCode retCode;
+   FILE *json;
+   double *samples, firstNsPerBar;
+   char periodStr[16];
+   int f, p, s, maxBars, nbPeriod, period, pinned, nbResult;
+   time_t now;
+
+   if( !parseOptions( argc, argv, &options ) )
+   {
+      printUsage();
+      return 1;
+   }
+
+   retCode = TA_Initialize();
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_Initialize failed [%d]\n", retCode );
+      return 1;
+   }
+
+   pinned = 0;
+   if( options.cpu >= 0 )
+   {
+      pinned = benchPinThread( options.cpu );
+      if( !pinned )
+         printf( "Warning: cannot run only on the CPU %d\n", options.cpu );
+   }
+
+   maxBars = 0;
+   for( s=0; s < options.nbSize; s++ )
+      maxBars = options.size[s] > maxBars? options.size[s] : maxBars;
+
+   samples = (double *)malloc( sizeof(double)*options.nbRepeat );
+   if( !samples || !benchDataAlloc( &data, maxBars ) )
+   {
+      printf( "Not enough memory for %d bars\n", maxBars );
+      return 1;
+   }
+
+   if( !benchFuncListAlloc( &list, options.funcNames ) )
+   {
+      printf( "No function to benchmark\n" );
+      return 1;
+   }
+
+   json = NULL;
+   if( options.jsonFile )
+   {
+      json = fopen( options.jsonFile, "w" );
+      if( !json )
+      {
+         printf( "Cannot open %s\n", options.jsonFile );
+         return 1;
+      }
+
+      now = time( NULL );
+      fprintf( json, "{\n" );
+      fprintf( json, "  \"version\": \"%s\",\n", TA_GetVersionString() );
+      fprintf( json, "  \"time\": %lld,\n", (long long)now );
+      fprintf( json, "  \"warmup\": %d,\n", options.nbWarmup );
+      fprintf( json, "  \"repeat\": %d,\n", options.nbRepeat );
+      fprintf( json, "  \"cpu\": %d,\n", pinned? options.cpu : -1 );
+      fprintf( json, "  \"results\": [" );
+   }
+
+   printf( "ta_bench V%s - %d functions, median of %d calls\n\n",
+           TA_GetVersionString(), list.nbFunc, options.nbRepeat );
+   printf( "%-16s %6s %10s %12s %12s %7s %9s %8s\n",
+           "Function", "Period", "Bars", "ns/bar", "Min ns/bar", "CV %", "Bytes/bar", "Scaling" );
+
+   nbResult = 0;
+   for( f=0; f < list.nbFunc; f++ )
+   {
+      nbPeriod = benchHasPeriod( list.funcInfo[f] )? options.nbPeriod : 1;
+      for( p=0; p < nbPeriod; p++ )
+      {
+         period = benchHasPeriod( list.funcInfo[f] )? options.period[p] : -1;
+         retCode = benchCallAlloc( &call, list.funcInfo[f], &data, period );
+         if( retCode != TA_SUCCESS )
+         {
+            printf( "%-16s not benchmarked [%d]\n", list.funcInfo[f]->name, retCode );
+            continue;
+         }
+
+         if( call.period > 0 )
+            sprintf( periodStr, "%d", call.period );
+         else
+            strcpy( periodStr, "-" );
+
+         firstNsPerBar = 0.0;
+         for( s=0; s < options.nbSize; s++ )
+         {
+            retCode = timeCall( &call, options.size[s], &options, samples, &result );
+            if( retCode != TA_SUCCESS )
+            {
+               printf( "%-16s %6s %10d failed [%d]\n",
+                       list.funcInfo[f]->name, periodStr, options.size[s], retCode );
+               continue;
+            }
+
+            if( firstNsPerBar <= 0.0 )
+               firstNsPerBar = result.nsPerBar > 0.0? result.nsPerBar : 1.0;
+
+            printf( "%-16s %6s %10d %12.3f %12.3f %7.1f %9d %8.2f\n",
+                    list.funcInfo[f]->name, periodStr, options.size[s],
+                    result.nsPerBar, result.nsPerBarMin, result.cv*100.0,
+                    call.bytesPerBar, result.nsPerBar/firstNsPerBar );
+
+            if( json )
+            {
+               fprintf( json, "%s\n    { \"function\": \"%s\", \"group\": \"%s\", ",
+                        nbResult? "," : "", list.funcInfo[f]->name, list.funcInfo[f]->group );
+               if( call.period > 0 )
+                  fprintf( json, "\"period\": %d, ", call.period );
+               else
+                  fprintf( json, "\"period\": null, " );
+               fprintf( json, "\"bars\": %d, \"nsPerBar\": %.6g, \"nsPerBarMin\": %.6g, "
+                              "\"cv\": %.6g, \"bytesPerBar\": %d, \"barsPerSecond\": %.6g, "
+                              "\"scaling\": %.6g }",
+                        options.size[s], result.nsPerBar, result.nsPerBarMin, result.cv,
+                        call.bytesPerBar, 1.0e9/result.nsPerBar,
+                        result.nsPerBar/firstNsPerBar );
+            }
+            nbResult++;
+         }
+
+         benchCallFree( &call );
+      }
+   }
+
+   if( json )
+   {
+      fprintf( json, "\n  ]\n}\n" );
+      fclose( json );
+   }
+
+   benchFuncListFree( &list );
+   benchDataFree( &data );
+   free( samples );
+   TA_Shutdown();
+
+   return 0;
+}
+
+/**** Local functions definitions.     ****/
+static int parseOptions( int argc, char **argv, TA_BenchOptions *options )
+{
+   int i;
+
+   memset( options, 0, sizeof(TA_BenchOptions) );
+   options->nbSize = sizeof(defaultSize)/sizeof(int);
+   memcpy( options->size, defaultSize, sizeof(defaultSize) );
+   options->nbPeriod = sizeof(defaultPeriod)/sizeof(int);
+   memcpy( options->period, defaultPeriod, sizeof(defaultPeriod) );
+   options->nbRepeat = 10;
+   options->nbWarmup = 2;
+   options->cpu      = -1;
+
+   /* All the options have a value. */
+   for( i=1; i < argc; i += 2 )
+   {
+      if( (argv[i][0] != '-') || (argv[i][1] == '\0') || (argv[i][2] != '\0') || (i+1 >= argc) )
+         return 0;
+
+      switch( argv[i][1] )
+      {
+      case 's':
+         options->nbSize = benchParseList( argv[i+1], options->size, MAX_SIZE );
+         if( options->nbSize == 0 )
+            return 0;
+         break;
+      case 'p':
+         options->nbPeriod = benchParseList( argv[i+1], options->period, MAX_PERIOD );
+         if( options->nbPeriod == 0 )
+            return 0;
+         break;
+      case 'f':
+         options->funcNames = argv[i+1];
+         break;
+      case 'r':
+         options->nbRepeat = atoi( argv[i+1] );
+         if( options->nbRepeat <= 0 )
+            return 0;
+         break;
+      case 'w':
+         options->nbWarmup = atoi( argv[i+1] );
+         if( options->nbWarmup < 0 )
+            return 0;
+         break;
+      case 'c':
+         options->cpu = atoi( argv[i+1] );
+         break;
+      case 'o':
+         options->jsonFile = argv[i+1];
+         break;
+      default:
+         return 0;
+      }
+   }
+
+   return 1;
+}
+
+static void printUsage( void )
+{
+   printf( "Usage: ta_bench [-s sizes] [-p periods] [-f functions]\n" );
+   printf( "                [-r repeat] [-w warmup] [-c cpu] [-o file]\n" );
+   printf( "\n" );
+   printf( "   Time all the functions of TA-Lib on a synthetic series.\n" );
+   printf( "\n" );
+   printf( "   OPTIONS:\n" );
+   printf( "    -s Number of bars, comma separated (default 1000,10000,100000,1000000).\n" );
+   printf( "       Up to 100000000. Each bar needs 56 bytes of memory for the\n" );
+   printf( "       series, plus 8 bytes for each output of the function.\n" );
+   printf( "    -p Values of optInTimePeriod, comma separated (default 5,14,50,200).\n" );
+   printf( "    -f Only these functions, comma separated (ex: SMA,RSI,MACD).\n" );
+   printf( "    -r Number of timed calls (default 10).\n" );
+   printf( "    -w Number of calls before the timed ones (default 2).\n" );
+   printf( "    -c Run only on this CPU (Linux and Windows).\n" );
+   printf( "    -o Write the results in this JSON file.\n" );
+}
+
+static TA_RetCode timeCall( const TA_BenchCall *call, int nbBars,
+                            const TA_BenchOptions *options,
+                            double *samples, TA_BenchResult *result )
+{
+   TA_RetCode retCode;
+   double start, mean, var;
+   int i, nb;
+
+   for( i=0; i < options->nbWarmup; i++ )
+   {
+      retCode = benchCallDo( call, nbBars );
+      if( retCode != TA_SUCCESS )
+         return retCode;
+   }
+
+   nb = options->nbRepeat;
+   for( i=0; i < nb; i++ )
+   {
+      start = benchNow();
+      retCode = benchCallDo( call, nbBars );
+      samples[i] = benchNow()-start;
+      if( retCode != TA_SUCCESS )
+         return retCode;
+   }
+
+   mean = 0.0;
+   for( i=0; i < nb; i++ )
+      mean += samples[i];
+   mean /= nb;
+
+   var = 0.0;
+   for( i=0; i < nb; i++ )
+      var += (samples[i]-mean)*(samples[i]-mean);
+   var /= nb;
+
+   qsort( samples, nb, sizeof(double), compareDouble );
+   if( nb%2 )
+      result->nsPerBar = samples[nb/2];
+   else
+      result->nsPerBar = (samples[nb/2-1]+samples[nb/2])/2.0;
+
+   result->nsPerBar   /= nbBars;
+   result->nsPerBarMin = samples[0]/nbBars;
+   result->cv          = mean > 0.0? sqrt(var)/mean : 0.0;
+
+   return TA_SUCCESS;
+}
+
+static int compareDouble( const void *a, const void *b )
+{
+   double va, vb;
+
+   va = *(const double *)a;
+   vb = *(const double *)b;
+   return va < vb? -1 : (va > vb? 1 : 0);
+}
@@ -0,0 +1,138 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ */
+
+/* Description:
+ *    Shared by the benchmark tools: synthetic series, setup of a
+ *    call of a function through the abstract interface, clock and
+ *    CPU pinning (see bench_util.c).
+ */
+
+#ifndef TA_BENCH_H
+#define TA_BENCH_H
+
+#ifndef TA_LIBC_H
+   #include "ta_libc.h"
+#endif
+
+/* The synthetic series, all of 'nbBars' bars.
+ *
+ * 'unit' is within [-1,1], for the math transforms that are
+ * defined only there (ASIN, ACOS...).
+ */
+typedef struct
+{
+   int nbBars;
+   TA_Real *open;
+   TA_Real *high;
+   TA_Real *low;
+   TA_Real *close;
+   TA_Real *volume;
+   TA_Real *openInterest;
+   TA_Real *unit;
+} TA_BenchData;
+
+/* A function ready to be called with TA_CallFunc on the first
+ * bars of the synthetic series.
+ *
+ * 'period' is the value given to optInTimePeriod, or -1 when the
+ * function has no such parameter (the defaults are used).
+ *
+ * 'bytesPerBar' is the size of the inputs read and of the outputs
+ * written for each bar.
+ */
+#define TA_BENCH_MAX_OUTPUT 3
+
+typedef struct
+{
+   const TA_FuncInfo *funcInfo;
+   TA_ParamHolder *params;
+   int period;
+   int bytesPerBar;
+   TA_Real *output[TA_BENCH_MAX_OUTPUT];
+} TA_BenchCall;
+
+/* The list of all the functions (see TA_ForEachFunc),
+ * or of the functions in a comma separated list of names.
+ */
+typedef struct
+{
+   int nbFunc;
+   const TA_FuncInfo **funcInfo;
+} TA_BenchFuncList;
+
+int  benchDataAlloc( TA_BenchData *data, int nbBars );
+void benchDataFree ( TA_BenchData *data );
+
+int  benchFuncListAlloc( TA_BenchFuncList *list, const char *names );
+void benchFuncListFree ( TA_BenchFuncList *list );
+
+/* 1 when the function has an optInTimePeriod parameter. */
+int benchHasPeriod( const TA_FuncInfo *funcInfo );
+
+TA_RetCode benchCallAlloc( TA_BenchCall *call,
+                           const TA_FuncInfo *funcInfo,
+                           const TA_BenchData *data,
+                           int period );
+void benchCallFree( TA_BenchCall *call );
+
+TA_RetCode benchCallDo( const TA_BenchCall *call, int nbBars );
+
+/* Monotonic clock in nanoseconds. */
+double benchNow( void );
+
+/* Run the calling thread only on the CPU 'cpu'.
+ * Returns 0 when not supported on the platform.
+ */
+int benchPinThread( int cpu );
+
+/* Parse a comma separated list of integers (at most 'max').
+ * Returns the number of values, 0 on error.
+ */
+int benchParseList( const char *str, int *values, int max );
+
+#endif
@@ -0,0 +1,545 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ */
+
+/* Description:
+ *    Hardware performance counters of all the functions of the
+ *    abstract interface (Linux only, with perf_event_open).
+ *
+ *    Each function is called on the same synthetic series as ta_bench,
+ *    with optInTimePeriod at 14 when the function has it. The counters
+ *    are read around the calls and reported per bar:
+ *
+ *       cycles, instructions, branch-misses,
+ *       L1d-misses (L1 data cache read misses),
+ *       LLC-misses (last level cache misses).
+ *
+ *    A counter not supported by the CPU (or the virtual machine) is
+ *    reported as "-" (or "nan" in the baseline file).
+ *
+ *    -o writes a baseline file: one line per function with the
+ *    counters per bar. -b compares with a baseline file and exits
+ *    with 2 when the cycles or the instructions of a function grow
+ *    more than the threshold (-t).
+ *
+ *    /proc/sys/kernel/perf_event_paranoid must be 2 or less for the
+ *    counters of the process to be readable.
+ */
+
+/**** Headers ****/
+#if defined( __linux__ )
+   #include <linux/perf_event.h>
+   #include <sys/syscall.h>
+   #include <sys/ioctl.h>
+   #include <unistd.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ta_bench.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+#define NB_COUNTER 5
+#define PERIOD     14
+
+typedef struct
+{
+   char name[32];
+   int period;
+   double perBar[NB_COUNTER];
+} TA_PerfLine;
+
+typedef struct
+{
+   int nbBars;
+   int nbRepeat;
+   const char *funcNames;
+   const char *outFile;
+   const char *baseFile;
+   double threshold;
+   int cpu;
+} TA_PerfOptions;
+
+/**** Local functions declarations.    ****/
+static int  parseOptions( int argc, char **argv, TA_PerfOptions *options );
+static void printUsage( void );
+static int  readBaseline( const char *file, TA_PerfLine **lines );
+static const TA_PerfLine *findLine( const TA_PerfLine *lines, int nbLine,
+                                    const char *name, int period );
+#if defined( __linux__ )
+static int  openCounters( int *fd );
+static void closeCounters( int *fd );
+static TA_RetCode measure( const TA_BenchCall *call, const TA_PerfOptions *options,
+                           int *fd, double *perBar );
+#endif
+
+/**** Local variables definitions.     ****/
+static const char *counterName[NB_COUNTER] =
+{
+   "cycles", "instructions", "branch-misses", "L1d-misses", "LLC-misses"
+};
+
+/**** Global functions definitions.   ****/
+int main( int argc, char **argv )
+{
+#if defined( __linux__ )
+   TA_PerfOptions options;
+   TA_BenchData data;
+   TA_BenchFuncList list;
+   TA_BenchCall call;
+   TA_PerfLine *base;
+   const TA_PerfLine *ref;
+   TA_RetCode retCode;
+   FILE *out;
+   double perBar[NB_COUNTER], change;
+   int fd[NB_COUNTER];
+   int f, i, nbBase, nbCounter, nbRegression;
+
+   if( !parseOptions( argc, argv, &options ) )
+   {
+      printUsage();
+      return 1;
+   }
+
+   base = NULL;
+   nbBase = 0;
+   if( options.baseFile )
+   {
+      nbBase = readBaseline( options.baseFile, &base );
+      if( nbBase <= 0 )
+      {
+         printf( "Cannot read the baseline %s\n", options.baseFile );
+         return 1;
+      }
+   }
+
+   nbCounter = openCounters( fd );
+   if( nbCounter == 0 )
+   {
+      printf( "No hardware counter available (see perf_event_paranoid)\n" );
+      return 1;
+   }
+
+   if( (options.cpu >= 0) && !benchPinThread( options.cpu ) )
+      printf( "Warning: cannot run only on the CPU %d\n", options.cpu );
+
+   retCode = TA_Initialize();
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_Initialize failed [%d]\n", retCode );
+      return 1;
+   }
+
+   if( !benchDataAlloc( &data, options.nbBars ) ||
+       !benchFuncListAlloc( &list, options.funcNames ) )
+   {
+      printf( "Cannot allocate the series or the list of functions\n" );
+      return 1;
+   }
+
+   out = NULL;
+   if( options.outFile )
+   {
+      out = fopen( options.outFile, "w" );
+      if( !out )
+      {
+         printf( "Cannot open %s\n", options.outFile );
+         return 1;
+      }
+
+      fprintf( out, "# ta_perf V%s\n", TA_GetVersionString() );
+      fprintf( out, "# bars %d repeat %d\n", options.nbBars, options.nbRepeat );
+      fprintf( out, "# function period" );
+      for( i=0; i < NB_COUNTER; i++ )
+         fprintf( out, " %s", counterName[i] );
+      fprintf( out, "\n" );
+   }
+
+   printf( "ta_perf V%s - %d bars, counters per bar\n\n", TA_GetVersionString(), options.nbBars );
+   printf( "%-16s %6s", "Function", "Period" );
+   for( i=0; i < NB_COUNTER; i++ )
+      printf( " %13s", counterName[i] );
+   if( base )
+      printf( " %9s %9s", "cycles %", "instr %" );
+   printf( "\n" );
+
+   nbRegression = 0;
+   for( f=0; f < list.nbFunc; f++ )
+   {
+      retCode = benchCallAlloc( &call, list.funcInfo[f], &data,
+                                benchHasPeriod( list.funcInfo[f] )? PERIOD : -1 );
+      if( retCode == TA_SUCCESS )
+         retCode = measure( &call, &options, fd, perBar );
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "%-16s failed [%d]\n", list.funcInfo[f]->name, retCode );
+         benchCallFree( &call );
+         continue;
+      }
+
+      if( call.period > 0 )
+         printf( "%-16s %6d", list.funcInfo[f]->name, call.period );
+      else
+         printf( "%-16s %6s", list.funcInfo[f]->name, "-" );
+      for( i=0; i < NB_COUNTER; i++ )
+      {
+         if( fd[i] < 0 )
+            printf( " %13s", "-" );
+         else
+            printf( " %13.4f", perBar[i] );
+      }
+
+      /* The changes of the cycles and of the instructions. */
+      ref = findLine( base, nbBase, list.funcInfo[f]->name, call.period );
+      if( ref )
+      {
+         for( i=0; i < 2; i++ )
+         {
+            if( (fd[i] < 0) || !(ref->perBar[i] > 0.0) )
+            {
+               printf( " %9s", "-" );
+               continue;
+            }
+
+            change = ((perBar[i]/ref->perBar[i])-1.0)*100.0;
+            printf( " %+9.1f", change );
+            if( change > options.threshold )
+            {
+               printf( "*" );
+               nbRegression++;
+            }
+         }
+      }
+      printf( "\n" );
+
+      if( out )
+      {
+         fprintf( out, "%s %d", list.funcInfo[f]->name, call.period );
+         for( i=0; i < NB_COUNTER; i++ )
+         {
+            if( fd[i] < 0 )
+               fprintf( out, " nan" );
+            else
+               fprintf( out, " %.6g", perBar[i] );
+         }
+         fprintf( out, "\n" );
+      }
+
+      benchCallFree( &call );
+   }
+
+   if( out )
+      fclose( out );
+
+   if( base )
+   {
+      printf( "\n%d regression(s) above %g%%\n", nbRegression, options.threshold );
+      free( base );
+   }
+
+   closeCounters( fd );
+   benchFuncListFree( &list );
+   benchDataFree( &data );
+   TA_Shutdown();
+
+   return nbRegression? 2 : 0;
+#else
+   (void)argc; (void)argv;
+   (void)readBaseline; (void)findLine; (void)parseOptions; (void)printUsage;
+   (void)counterName;
+   printf( "ta_perf: the hardware counters are supported only on Linux\n" );
+   return 1;
+#endif
+}
+
+/**** Local functions definitions.     ****/
+static int parseOptions( int argc, char **argv, TA_PerfOptions *options )
+{
+   int i;
+
+   options->nbBars    = 100000;
+   options->nbRepeat  = 10;
+   options->funcNames = NULL;
+   options->outFile   = NULL;
+   options->baseFile  = NULL;
+   options->threshold = 10.0;
+   options->cpu       = -1;
+
+   /* All the options have a value. */
+   for( i=1; i < argc; i += 2 )
+   {
+      if( (argv[i][0] != '-') || (argv[i][1] == '\0') || (argv[i][2] != '\0') || (i+1 >= argc) )
+         return 0;
+
+      switch( argv[i][1] )
+      {
+      case 'n':
+         options->nbBars = atoi( argv[i+1] );
+         if( options->nbBars <= 0 )
+            return 0;
+         break;
+      case 'r':
+         options->nbRepeat = atoi( argv[i+1] );
+         if( options->nbRepeat <= 0 )
+            return 0;
+         break;
+      case 'f':
+         options->funcNames = argv[i+1];
+         break;
+      case 'o':
+         options->outFile = argv[i+1];
+         break;
+      case 'b':
+         options->baseFile = argv[i+1];
+         break;
+      case 't':
+         options->threshold = atof( argv[i+1] );
+         break;
+      case 'c':
+         options->cpu = atoi( argv[i+1] );
+         break;
+      default:
+         return 0;
+      }
+   }
+
+   return 1;
+}
+
+static void printUsage( void )
+{
+   printf( "Usage: ta_perf [-n bars] [-r repeat] [-f functions] [-c cpu]\n" );
+   printf( "               [-o baseline] [-b baseline] [-t threshold]\n" );
+   printf( "\n" );
+   printf( "   Hardware counters per bar of all the functions of TA-Lib.\n" );
+   printf( "\n" );
+   printf( "   OPTIONS:\n" );
+   printf( "    -n Number of bars (default 100000).\n" );
+   printf( "    -r Number of calls measured, after one call for\n" );
+   printf( "       warming up (default 10).\n" );
+   printf( "    -f Only these functions, comma separated (ex: SMA,RSI,MACD).\n" );
+   printf( "    -c Run only on this CPU.\n" );
+   printf( "    -o Write the counters in this baseline file.\n" );
+   printf( "    -b Compare with this baseline file.\n" );
+   printf( "    -t Threshold of a regression in percent (default 10).\n" );
+   printf( "\n" );
+   printf( "   Exit code 2 when a regression is found, 1 on error.\n" );
+}
+
+static int readBaseline( const char *file, TA_PerfLine **lines )
+{
+   FILE *in;
+   TA_PerfLine line, *all, *tmp;
+   char buffer[512], value[NB_COUNTER][32];
+   int i, nb, max;
+
+   in = fopen( file, "r" );
+   if( !in )
+      return -1;
+
+   all = NULL;
+   nb = max = 0;
+   while( fgets( buffer, sizeof(buffer), in ) )
+   {
+      if( buffer[0] == '#' )
+         continue;
+
+      /* "nan" is read as a string, strtod may not accept it. */
+      if( sscanf( buffer, "%31s %d %31s %31s %31s %31s %31s", line.name, &line.period,
+                  value[0], value[1], value[2], value[3], value[4] ) != 2+NB_COUNTER )
+         continue;
+      for( i=0; i < NB_COUNTER; i++ )
+         line.perBar[i] = strcmp( value[i], "nan" ) == 0? -1.0 : atof( value[i] );
+
+      if( nb == max )
+      {
+         max = max? 2*max : 256;
+         tmp = (TA_PerfLine *)realloc( all, sizeof(TA_PerfLine)*max );
+         if( !tmp )
+         {
+            free( all );
+            fclose( in );
+            return -1;
+         }
+         all = tmp;
+      }
+      all[nb++] = line;
+   }
+
+   fclose( in );
+   *lines = all;
+
+   return nb;
+}
+
+static const TA_PerfLine *findLine( const TA_PerfLine *lines, int nbLine,
+                                    const char *name, int period )
+{
+   int i;
+
+   for( i=0; i < nbLine; i++ )
+   {
+      if( (lines[i].period == period) && (strcmp( lines[i].name, name ) == 0) )
+         return &lines[i];
+   }
+
+   return NULL;
+}
+
+#if defined( __linux__ )
+static int openCounters( int *fd )
+{
+   struct perf_event_attr attr;
+   int i, nb;
+
+   nb = 0;
+   for( i=0; i < NB_COUNTER; i++ )
+   {
+      memset( &attr, 0, sizeof(attr) );
+      attr.size = sizeof(attr);
+      attr.type = PERF_TYPE_HARDWARE;
+      switch( i )
+      {
+      case 0: attr.config = PERF_COUNT_HW_CPU_CYCLES;    break;
+      case 1: attr.config = PERF_COUNT_HW_INSTRUCTIONS;  break;
+      case 2: attr.config = PERF_COUNT_HW_BRANCH_MISSES; break;
+      case 3:
+         attr.type   = PERF_TYPE_HW_CACHE;
+         attr.config = PERF_COUNT_HW_CACHE_L1D |
+                       (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                       (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+         break;
+      default: attr.config = PERF_COUNT_HW_CACHE_MISSES; break;
+      }
+
+      /* Only this thread, in user mode. When the CPU has less
+       * counters than requested, they are multiplexed and the
+       * values are scaled (see measure).
+       */
+      attr.disabled       = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv     = 1;
+      attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+      fd[i] = (int)syscall( __NR_perf_event_open, &attr, 0, -1, -1, 0 );
+      if( fd[i] >= 0 )
+         nb++;
+   }
+
+   return nb;
+}
+
+static void closeCounters( int *fd )
+{
+   int i;
+
+   for( i=0; i < NB_COUNTER; i++ )
+   {
+      if( fd[i] >= 0 )
+         close( fd[i] );
+      fd[i] = -1;
+   }
+}
+
+static TA_RetCode measure( const TA_BenchCall *call, const TA_PerfOptions *options,
+                           int *fd, double *perBar )
+{
+   TA_RetCode retCode;
+   unsigned long long value[3];
+   int i, r;
+
+   /* Warm up the caches and the branch predictors. */
+   retCode = benchCallDo( call, options->nbBars );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   for( i=0; i < NB_COUNTER; i++ )
+   {
+      if( fd[i] >= 0 )
+         ioctl( fd[i], PERF_EVENT_IOC_RESET, 0 );
+   }
+   for( i=0; i < NB_COUNTER; i++ )
+   {
+      if( fd[i] >= 0 )
+         ioctl( fd[i], PERF_EVENT_IOC_ENABLE, 0 );
+   }
+
+   for( r=0; (r < options->nbRepeat) && (retCode == TA_SUCCESS); r++ )
+      retCode = benchCallDo( call, options->nbBars );
+
+   for( i=0; i < NB_COUNTER; i++ )
+   {
+      if( fd[i] >= 0 )
+         ioctl( fd[i], PERF_EVENT_IOC_DISABLE, 0 );
+   }
+
+   for( i=0; i < NB_COUNTER; i++ )
+   {
+      perBar[i] = 0.0;
+      if( (fd[i] < 0) || (read( fd[i], value, sizeof(value) ) != (ssize_t)sizeof(value)) )
+         continue;
+
+      /* value = { count, time enabled, time running } */
+      if( value[2] > 0 )
+         perBar[i] = ((double)value[0]*((double)value[1]/(double)value[2])) /
+                     ((double)options->nbRepeat*(double)options->nbBars);
+   }
+
+   return retCode;
+}
+#endif
@@ -223,6 +223,7 @@ typedef enum
   TA_ABS_TST_FAIL_STARTEND_ZERO         = 617,
   TA_ABS_TST_FAIL_FUNCTION_DESC_SMALL   = 618,
   TA_ABS_TST_FAIL_FUNCTION_DESC_LARGE   = 619,
+  TA_ABS_TST_FAIL_FUNC_ID               = 620,
 
   /* Error code related to internal tests. */
   TA_INTERNAL_CIRC_BUFF_FAIL_0      = 700,
@@ -292,6 +293,101 @@ typedef enum
   TA_TEST_FAIL_BUG1359452_4  = 2004,
   TA_TEST_FAIL_BUG1359452_5  = 2005,
 
+  /* Error code related to a zero close in TA_NATR. */
+  TA_TEST_FAIL_NATR_ZERO_CLOSE_1 = 2010,
+  TA_TEST_FAIL_NATR_ZERO_CLOSE_2 = 2011,
+
+  /* Error code related to the streaming API. */
+  TA_TEST_STREAM_ALLOC_FAILED    = 3000,
+  TA_TEST_STREAM_BATCH_FAILED    = 3001,
+  TA_TEST_STREAM_BAD_LOOKBACK    = 3002,
+  TA_TEST_STREAM_UPDATE_FAILED   = 3003,
+  TA_TEST_STREAM_BAD_NB_ELEMENT  = 3004,
+  TA_TEST_STREAM_BAD_VALUE       = 3005,
+  TA_TEST_STREAM_RESET_FAILED    = 3006,
+  TA_TEST_STREAM_BAD_PARAM_CHECK = 3007,
+
+  /* Error code related to the linear regression family. */
+  TA_TEST_LINEARREG_CALL_FAILED  = 3100,
+  TA_TEST_LINEARREG_BAD_VALUE    = 3101,
+  TA_TEST_LINEARREG_NOT_SAME     = 3102,
+
+  /* Error code related to TA_MAVP. */
+  TA_TEST_MAVP_CALL_FAILED       = 3200,
+  TA_TEST_MAVP_BAD_VALUE         = 3201,
+
+  /* Error code related to TA_HT_ALL. */
+  TA_TEST_HT_ALL_CALL_FAILED     = 3300,
+  TA_TEST_HT_ALL_NOT_SAME        = 3301,
+
+  /* Error code related to TA_DM_ALL. */
+  TA_TEST_DM_ALL_CALL_FAILED     = 3400,
+  TA_TEST_DM_ALL_NOT_SAME        = 3401,
+
+  /* Error code related to TA_MA_MULTI. */
+  TA_TEST_MA_MULTI_CALL_FAILED   = 3500,
+  TA_TEST_MA_MULTI_NOT_SAME      = 3501,
+
+  /* Error code related to TA_CDL_ALL. */
+  TA_TEST_CDL_ALL_CALL_FAILED    = 3600,
+  TA_TEST_CDL_ALL_NOT_SAME       = 3601,
+
+  /* Error code related to TA_Context. */
+  TA_TEST_CONTEXT_CALL_FAILED    = 3700,
+  TA_TEST_CONTEXT_NOT_SAME       = 3701,
+
+  /* Error code related to TA_XXX_WS. */
+  TA_TEST_WORKSPACE_CALL_FAILED  = 3800,
+  TA_TEST_WORKSPACE_NOT_SAME     = 3801,
+  TA_TEST_WORKSPACE_HEAP_USED    = 3802,
+
+  /* Error code related to TA_SetAllocator. */
+  TA_TEST_ALLOCATOR_CALL_FAILED  = 3900,
+  TA_TEST_ALLOCATOR_NOT_SAME     = 3901,
+
+  /* Error code related to TA_CallFuncParallel. */
+  TA_TEST_PARALLEL_CALL_FAILED   = 4000,
+  TA_TEST_PARALLEL_NOT_SAME      = 4001,
+
+  /* Error code related to TA_CallFuncBatch. */
+  TA_TEST_BATCH_CALL_FAILED      = 4100,
+  TA_TEST_BATCH_NOT_SAME         = 4101,
+
+  /* Error code related to TA_XXX_PANEL. */
+  TA_TEST_PANEL_CALL_FAILED      = 4200,
+  TA_TEST_PANEL_NOT_SAME         = 4201,
+
+  /* Error code related to the SIMD element-wise functions. */
+  TA_TEST_VEC_CALL_FAILED        = 4300,
+  TA_TEST_VEC_NOT_SAME           = 4301,
+  TA_TEST_VEC_NOT_ACCURATE       = 4302,
+  TA_TEST_VEC_BAD_MODE           = 4303,
+
+  /* Error code related to TA_F_XXX. */
+  TA_TEST_FLOAT_CALL_FAILED      = 4400,
+  TA_TEST_FLOAT_NOT_SAME         = 4401,
+  TA_TEST_FLOAT_NOT_ACCURATE     = 4402,
+
+  /* Error code related to the one pass TA_BBANDS (SMA). */
+  TA_TEST_BBANDS_CALL_FAILED     = 4500,
+  TA_TEST_BBANDS_NOT_SAME        = 4501,
+
+  /* Error code related to the long periods of AVGDEV and CCI. */
+  TA_TEST_AVGDEV_TREE_CALL_FAILED   = 4600,
+  TA_TEST_AVGDEV_TREE_NOT_ACCURATE  = 4601,
+  TA_TEST_AVGDEV_TREE_NOT_SAME      = 4602,
+  TA_TEST_AVGDEV_TREE_NOT_NAN       = 4603,
+
+  /* Error code related to the statistics of the calls. */
+  TA_TEST_STATS_API_FAILED       = 4700,
+  TA_TEST_STATS_CALL_FAILED      = 4701,
+  TA_TEST_STATS_BAD_COUNT        = 4702,
+
+  /* Error code related to the call plans. */
+  TA_TEST_CALL_PLAN_API_FAILED   = 4800,
+  TA_TEST_CALL_PLAN_CALL_FAILED  = 4801,
+  TA_TEST_CALL_PLAN_NOT_SAME     = 4802,
+
   TA_LAST_VALID_ERROR = 0xFFFF
 } ErrorNumber;
 #endif
@@ -273,6 +273,22 @@ static ErrorNumber testTAFunction_ALL( void )
    DO_TEST( test_func_stddev,   "STDDEV,VAR" );
    DO_TEST( test_func_avgdev,   "AVGDEV" );
    DO_TEST( test_func_bbands,   "BBANDS" );
+   DO_TEST( test_func_linearreg, "LINEARREG,TSF (all outputs)" );
+   DO_TEST( test_func_ht_all,   "HT_*,MAMA (all outputs)" );
+   DO_TEST( test_func_dm_all,   "ADX,DI,DM,ATR,TRANGE (all outputs)" );
+   DO_TEST( test_func_ma_multi, "MA,TRIX (many periods)" );
+   DO_TEST( test_func_cdl_all,  "CDL (many patterns)" );
+   DO_TEST( test_func_context,  "TA_Context" );
+   DO_TEST( test_func_workspace, "TA_XXX_WS (caller workspace)" );
+   DO_TEST( test_func_allocator, "TA_SetAllocator/TA_Arena" );
+   DO_TEST( test_func_parallel, "TA_CallFuncParallel" );
+   DO_TEST( test_func_batch,    "TA_CallFuncBatch" );
+   DO_TEST( test_func_panel,    "TA_XXX_PANEL (many symbols)" );
+   DO_TEST( test_func_vector,   "Element-wise functions (SIMD)" );
+   DO_TEST( test_func_float,    "TA_F_XXX (single precision)" );
+   DO_TEST( test_func_stats,    "Statistics of the calls" );
+   DO_TEST( test_func_call_plan, "TA_CallPlan" );
+   DO_TEST( test_func_stream,   "Streaming API" );
    DO_TEST( test_candlestick,   "All Candlesticks" );
 
    return TA_TEST_PASS; /* All tests succeeded. */
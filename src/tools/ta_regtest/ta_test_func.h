@@ -24,5 +24,21 @@ ErrorNumber test_func_1in_1out( TA_History *history );
 ErrorNumber test_func_1in_2out( TA_History *history );
 ErrorNumber test_func_avgdev  ( TA_History *history );
 ErrorNumber test_func_imi     ( TA_History *history );
+ErrorNumber test_func_stream  ( TA_History *history );
+ErrorNumber test_func_linearreg( TA_History *history );
+ErrorNumber test_func_ht_all  ( TA_History *history );
+ErrorNumber test_func_dm_all  ( TA_History *history );
+ErrorNumber test_func_ma_multi( TA_History *history );
+ErrorNumber test_func_cdl_all( TA_History *history );
+ErrorNumber test_func_context( TA_History *history );
+ErrorNumber test_func_workspace( TA_History *history );
+ErrorNumber test_func_allocator( TA_History *history );
+ErrorNumber test_func_parallel( TA_History *history );
+ErrorNumber test_func_batch( TA_History *history );
+ErrorNumber test_func_panel( TA_History *history );
+ErrorNumber test_func_vector( TA_History *history );
+ErrorNumber test_func_float( TA_History *history );
+ErrorNumber test_func_stats( TA_History *history );
+ErrorNumber test_func_call_plan( TA_History *history );
 
 #endif
@@ -0,0 +1,574 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ *
+ */
+
+/* Description:
+ *     Test that all the memory of TA-Lib goes through the allocator
+ *     set with TA_SetAllocator/TA_SetThreadAllocator and is given back
+ *     to it, that the TA functions give the same output when their
+ *     temporary buffers come from a TA_Arena, that the memory of an
+ *     arena can be freed by another thread, and that nothing is
+ *     leaked when an allocation fails.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#if defined( _WIN32 )
+   #include <windows.h>
+#else
+   #include <pthread.h>
+#endif
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_memory.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef struct
+{
+   int nbAlloc;
+   int nbFree;
+   size_t nbByte; /* Currently allocated. */
+   int failAt;    /* This allocation fails (0 for none). */
+} TA_CountAllocator;
+
+/* Work of the second thread in testArenaThread. */
+typedef struct
+{
+   const TA_Allocator *allocator;
+   void *ptr;
+   void *ptrOther; /* Allocated by the second thread (must fail). */
+} TA_ArenaThread;
+
+#if defined( _WIN32 )
+typedef LPTHREAD_START_ROUTINE TA_ThreadFunc;
+#else
+typedef void *(*TA_ThreadFunc)( void *param );
+#endif
+
+/**** Local functions declarations.    ****/
+static void *countAlloc( void *opaque, size_t size );
+static void  countFree ( void *opaque, void *ptr, size_t size );
+
+static TA_RetCode callMACDEXT( const TA_History *history, double *out );
+
+static ErrorNumber testBadParam( void );
+static ErrorNumber testCount( const TA_History *history, double *outRef, double *out );
+static ErrorNumber testArena( const TA_History *history, double *outRef, double *out );
+static int runThread( TA_ThreadFunc func, void *param );
+static ErrorNumber testArenaThread( void );
+static ErrorNumber testArenaOwnerExit( void );
+static ErrorNumber testAllocFail( const TA_History *history, double *out );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_allocator( TA_History *history )
+{
+   ErrorNumber retValue;
+   double *outRef, *out;
+   int nbBars;
+
+   nbBars = (int)history->nbBars;
+   if( nbBars < 252 )
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+
+   outRef = (double *)malloc( sizeof(double)*6*nbBars );
+   if( !outRef )
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+   out = &outRef[3*nbBars];
+
+   if( callMACDEXT( history, outRef ) != TA_SUCCESS )
+   {
+      free( outRef );
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+   }
+
+   retValue = testBadParam();
+   if( retValue == TA_TEST_PASS )
+      retValue = testCount( history, outRef, out );
+   if( retValue == TA_TEST_PASS )
+      retValue = testArena( history, outRef, out );
+   if( retValue == TA_TEST_PASS )
+      retValue = testArenaThread();
+   if( retValue == TA_TEST_PASS )
+      retValue = testArenaOwnerExit();
+   if( retValue == TA_TEST_PASS )
+      retValue = testAllocFail( history, out );
+
+   TA_SetAllocator( NULL );
+   TA_SetThreadAllocator( NULL );
+
+   free( outRef );
+
+   return retValue;
+}
+
+/**** Local functions definitions.     ****/
+static void *countAlloc( void *opaque, size_t size )
+{
+   TA_CountAllocator *count;
+
+   count = (TA_CountAllocator *)opaque;
+   if( count->nbAlloc+1 == count->failAt )
+      return NULL;
+   count->nbAlloc++;
+   count->nbByte += size;
+
+   return malloc( size );
+}
+
+static void countFree( void *opaque, void *ptr, size_t size )
+{
+   TA_CountAllocator *count;
+
+   count = (TA_CountAllocator *)opaque;
+   count->nbFree++;
+   count->nbByte -= size;
+
+   free( ptr );
+}
+
+/* The MA types used all allocate temporary buffers. */
+static TA_RetCode callMACDEXT( const TA_History *history, double *out )
+{
+   int outBegIdx, outNBElement, nbBars;
+
+   nbBars = (int)history->nbBars;
+   memset( out, 0, sizeof(double)*3*nbBars );
+
+   return TA_MACDEXT( 0, nbBars-1, history->close,
+                      12, TA_MAType_DEMA, 26, TA_MAType_TEMA, 9, TA_MAType_MAMA,
+                      &outBegIdx, &outNBElement,
+                      out, &out[nbBars], &out[2*nbBars] );
+}
+
+static ErrorNumber testBadParam( void )
+{
+   TA_Allocator allocator;
+   TA_Arena *arena;
+
+   allocator.allocFunc = countAlloc;
+   allocator.freeFunc  = NULL;
+   allocator.opaque    = NULL;
+   if( TA_SetAllocator( &allocator ) != TA_BAD_PARAM )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+   if( TA_SetThreadAllocator( &allocator ) != TA_BAD_PARAM )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+
+   allocator.allocFunc = NULL;
+   allocator.freeFunc  = countFree;
+   if( TA_SetThreadAllocator( &allocator ) != TA_BAD_PARAM )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+   if( TA_GetThreadAllocator() != NULL )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+
+   if( TA_ArenaAlloc( NULL, 0 ) != TA_BAD_PARAM )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+   if( TA_ArenaFree( NULL ) != TA_SUCCESS )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+   if( TA_ArenaGetAllocator( NULL ) != NULL )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+
+   /* Not an arena. */
+   arena = (TA_Arena *)&allocator;
+   if( TA_ArenaFree( arena ) != TA_INVALID_HANDLE )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+   if( TA_ArenaGetAllocator( arena ) != NULL )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber testCount( const TA_History *history, double *outRef, double *out )
+{
+   TA_CountAllocator globalCount, threadCount;
+   TA_Allocator globalAllocator, threadAllocator;
+   const TA_FuncHandle *handle;
+   TA_ParamHolder *params;
+   int *buffer, i, nbBars;
+
+   nbBars = (int)history->nbBars;
+
+   memset( &globalCount, 0, sizeof(globalCount) );
+   memset( &threadCount, 0, sizeof(threadCount) );
+   globalAllocator.allocFunc = countAlloc;
+   globalAllocator.freeFunc  = countFree;
+   globalAllocator.opaque    = &globalCount;
+   threadAllocator = globalAllocator;
+   threadAllocator.opaque    = &threadCount;
+
+   /* All the temporary buffers are given back. */
+   if( TA_SetAllocator( &globalAllocator ) != TA_SUCCESS )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+   if( callMACDEXT( history, out ) != TA_SUCCESS )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+   if( memcmp( out, outRef, sizeof(double)*3*nbBars ) != 0 )
+      return TA_TEST_ALLOCATOR_NOT_SAME;
+   if( (globalCount.nbAlloc == 0) ||
+       (globalCount.nbAlloc != globalCount.nbFree) ||
+       (globalCount.nbByte != 0) )
+      return TA_TEST_ALLOCATOR_NOT_SAME;
+
+   /* The allocator of the thread comes first. */
+   if( TA_SetThreadAllocator( &threadAllocator ) != TA_SUCCESS )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+   if( TA_GetThreadAllocator() != &threadAllocator )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+   globalCount.nbAlloc = 0;
+   if( callMACDEXT( history, out ) != TA_SUCCESS )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+   if( memcmp( out, outRef, sizeof(double)*3*nbBars ) != 0 )
+      return TA_TEST_ALLOCATOR_NOT_SAME;
+   if( (globalCount.nbAlloc != 0) ||
+       (threadCount.nbAlloc == 0) ||
+       (threadCount.nbByte != 0) )
+      return TA_TEST_ALLOCATOR_NOT_SAME;
+
+   /* Memory is freed by its allocator even when
+    * no longer the one of the thread.
+    */
+   if( TA_GetFuncHandle( "MACD", &handle ) != TA_SUCCESS )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+   if( TA_ParamHolderAlloc( handle, &params ) != TA_SUCCESS )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+   if( threadCount.nbByte == 0 )
+      return TA_TEST_ALLOCATOR_NOT_SAME;
+   TA_SetThreadAllocator( NULL );
+   TA_SetAllocator( NULL );
+   if( TA_ParamHolderFree( params ) != TA_SUCCESS )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+   if( (threadCount.nbByte != 0) || (threadCount.nbAlloc != threadCount.nbFree) )
+      return TA_TEST_ALLOCATOR_NOT_SAME;
+
+   /* TA_Realloc keeps the content, also when moving
+    * the memory to another allocator.
+    */
+   buffer = (int *)TA_Malloc( sizeof(int)*10 );
+   if( !buffer )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+   for( i=0; i < 10; i++ )
+      buffer[i] = i;
+   buffer = (int *)TA_Realloc( buffer, sizeof(int)*1000 );
+   if( !buffer )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+   TA_SetThreadAllocator( &threadAllocator );
+   buffer = (int *)TA_Realloc( buffer, sizeof(int)*20 );
+   TA_SetThreadAllocator( NULL );
+   if( !buffer )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+   for( i=0; i < 10; i++ )
+   {
+      if( buffer[i] != i )
+      {
+         TA_Free( buffer );
+         return TA_TEST_ALLOCATOR_NOT_SAME;
+      }
+   }
+   TA_Free( buffer );
+   if( (threadCount.nbByte != 0) || (threadCount.nbAlloc != threadCount.nbFree) )
+      return TA_TEST_ALLOCATOR_NOT_SAME;
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber testArena( const TA_History *history, double *outRef, double *out )
+{
+   TA_Arena *arena;
+   const TA_Allocator *allocator;
+   void *ptr1, *ptr2, *ptr3;
+   ErrorNumber retValue;
+   int i, nbBars;
+
+   nbBars = (int)history->nbBars;
+
+   /* Small blocks for having the larger buffers
+    * outside of the blocks.
+    */
+   if( TA_ArenaAlloc( &arena, 1024 ) != TA_SUCCESS )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+   allocator = TA_ArenaGetAllocator( arena );
+   if( !allocator )
+   {
+      TA_ArenaFree( arena );
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+   }
+
+   retValue = TA_TEST_PASS;
+
+   /* The memory freed is re-used for the same size. */
+   ptr1 = allocator->allocFunc( allocator->opaque, 100 );
+   ptr2 = allocator->allocFunc( allocator->opaque, 5000 );
+   if( !ptr1 || !ptr2 )
+      retValue = TA_TEST_ALLOCATOR_CALL_FAILED;
+   else
+   {
+      memset( ptr1, 0xFF, 100 );
+      memset( ptr2, 0xFF, 5000 );
+      allocator->freeFunc( allocator->opaque, ptr1, 100 );
+      allocator->freeFunc( allocator->opaque, ptr2, 5000 );
+      ptr3 = allocator->allocFunc( allocator->opaque, 120 );
+      if( ptr3 != ptr1 )
+         retValue = TA_TEST_ALLOCATOR_NOT_SAME;
+      ptr3 = allocator->allocFunc( allocator->opaque, 4100 );
+      if( ptr3 != ptr2 )
+         retValue = TA_TEST_ALLOCATOR_NOT_SAME;
+   }
+
+   if( (retValue == TA_TEST_PASS) &&
+       (TA_SetThreadAllocator( allocator ) != TA_SUCCESS) )
+      retValue = TA_TEST_ALLOCATOR_CALL_FAILED;
+
+   for( i=0; (i < 3) && (retValue == TA_TEST_PASS); i++ )
+   {
+      if( callMACDEXT( history, out ) != TA_SUCCESS )
+         retValue = TA_TEST_ALLOCATOR_CALL_FAILED;
+      else if( memcmp( out, outRef, sizeof(double)*3*nbBars ) != 0 )
+         retValue = TA_TEST_ALLOCATOR_NOT_SAME;
+   }
+
+   TA_SetThreadAllocator( NULL );
+
+   if( TA_ArenaFree( arena ) != TA_SUCCESS )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+
+   return retValue;
+}
+
+/* Run the function in a new thread and wait for its end.
+ * Return 0 if the thread cannot be started.
+ */
+static int runThread( TA_ThreadFunc func, void *param )
+{
+#if defined( _WIN32 )
+   HANDLE thread;
+
+   thread = CreateThread( NULL, 0, func, param, 0, NULL );
+   if( !thread )
+      return 0;
+   WaitForSingleObject( thread, INFINITE );
+   CloseHandle( thread );
+#else
+   pthread_t thread;
+
+   if( pthread_create( &thread, NULL, func, param ) != 0 )
+      return 0;
+   pthread_join( thread, NULL );
+#endif
+
+   return 1;
+}
+
+#if defined( _WIN32 )
+static DWORD WINAPI arenaThread( LPVOID param )
+#else
+static void *arenaThread( void *param )
+#endif
+{
+   TA_ArenaThread *work;
+
+   work = (TA_ArenaThread *)param;
+   work->allocator->freeFunc( work->allocator->opaque, work->ptr, 100 );
+   work->ptrOther = work->allocator->allocFunc( work->allocator->opaque, 100 );
+
+   return 0;
+}
+
+/* The memory of an arena freed by another thread is
+ * re-used by the thread owning the arena, and only that
+ * thread can allocate from it.
+ */
+static ErrorNumber testArenaThread( void )
+{
+   TA_Arena *arena;
+   TA_ArenaThread work;
+   ErrorNumber retValue;
+   void *ptr;
+
+   if( TA_ArenaAlloc( &arena, 0 ) != TA_SUCCESS )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+
+   work.allocator = TA_ArenaGetAllocator( arena );
+   work.ptr       = work.allocator->allocFunc( work.allocator->opaque, 100 );
+   work.ptrOther  = NULL;
+   if( !work.ptr )
+   {
+      TA_ArenaFree( arena );
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+   }
+
+   if( !runThread( arenaThread, &work ) )
+   {
+      TA_ArenaFree( arena );
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+   }
+
+   retValue = TA_TEST_PASS;
+   if( work.ptrOther )
+      retValue = TA_TEST_ALLOCATOR_NOT_SAME;
+
+   ptr = work.allocator->allocFunc( work.allocator->opaque, 100 );
+   if( ptr != work.ptr )
+      retValue = TA_TEST_ALLOCATOR_NOT_SAME;
+
+   if( TA_ArenaFree( arena ) != TA_SUCCESS )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+
+   return retValue;
+}
+
+#if defined( _WIN32 )
+static DWORD WINAPI arenaAllocThread( LPVOID param )
+#else
+static void *arenaAllocThread( void *param )
+#endif
+{
+   TA_ArenaThread *work;
+
+   work = (TA_ArenaThread *)param;
+   work->ptrOther = work->allocator->allocFunc( work->allocator->opaque, 100 );
+   if( work->ptrOther )
+      work->allocator->freeFunc( work->allocator->opaque, work->ptrOther, 100 );
+
+   return 0;
+}
+
+/* The owner of an arena stays the same after its thread
+ * exits, even for a thread started later with the same
+ * thread local storage.
+ */
+static ErrorNumber testArenaOwnerExit( void )
+{
+   TA_Arena *arena;
+   TA_ArenaThread work;
+   ErrorNumber retValue;
+
+   if( TA_ArenaAlloc( &arena, 0 ) != TA_SUCCESS )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+
+   work.allocator = TA_ArenaGetAllocator( arena );
+   work.ptr       = NULL;
+   work.ptrOther  = NULL;
+
+   /* The first thread owns the arena. */
+   if( !runThread( arenaAllocThread, &work ) || !work.ptrOther )
+   {
+      TA_ArenaFree( arena );
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+   }
+
+   retValue = TA_TEST_PASS;
+   if( !runThread( arenaAllocThread, &work ) )
+      retValue = TA_TEST_ALLOCATOR_CALL_FAILED;
+   else if( work.ptrOther )
+      retValue = TA_TEST_ALLOCATOR_NOT_SAME;
+
+   if( work.allocator->allocFunc( work.allocator->opaque, 100 ) )
+      retValue = TA_TEST_ALLOCATOR_NOT_SAME;
+
+   if( TA_ArenaFree( arena ) != TA_SUCCESS )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+
+   return retValue;
+}
+
+/* The functions using two heap windows (period above 64) give
+ * back the first one when the second cannot be allocated.
+ */
+static ErrorNumber testAllocFail( const TA_History *history, double *out )
+{
+   TA_CountAllocator count;
+   TA_Allocator allocator;
+   TA_RetCode retCode;
+   int outBegIdx, outNBElement, nbBars, i;
+
+   nbBars = (int)history->nbBars;
+
+   memset( &count, 0, sizeof(count) );
+   allocator.allocFunc = countAlloc;
+   allocator.freeFunc  = countFree;
+   allocator.opaque    = &count;
+   if( TA_SetThreadAllocator( &allocator ) != TA_SUCCESS )
+      return TA_TEST_ALLOCATOR_CALL_FAILED;
+
+   for( i=0; i < 2; i++ )
+   {
+      count.nbAlloc = 0;
+      count.nbFree  = 0;
+      count.failAt  = 2;
+      if( i == 0 )
+         retCode = TA_MIDPRICE( 0, nbBars-1, history->high, history->low, 100,
+                                &outBegIdx, &outNBElement, out );
+      else
+         retCode = TA_AROON( 0, nbBars-1, history->high, history->low, 100,
+                             &outBegIdx, &outNBElement, out, &out[nbBars] );
+      if( (retCode != TA_ALLOC_ERR) ||
+          (count.nbAlloc != 1) || (count.nbFree != count.nbAlloc) ||
+          (count.nbByte != 0) )
+      {
+         TA_SetThreadAllocator( NULL );
+         return TA_TEST_ALLOCATOR_NOT_SAME;
+      }
+   }
+
+   TA_SetThreadAllocator( NULL );
+
+   return TA_TEST_PASS;
+}
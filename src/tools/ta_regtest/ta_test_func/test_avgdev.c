@@ -36,6 +36,7 @@
  *  Initial  Name/description
  *  -------------------------------------------------------------------
  *  AB       Anatoliy Belsky
+ *  MF       Mario Fortier
  *
  *
  * Change history:
@@ -43,6 +44,8 @@
  *  MMDDYY BY   Description
  *  -------------------------------------------------------------------
  *  112400 AB   First version.
+ *  101826 MF   Add tests for long periods.
+ *  101826 MF   Test the long periods in both math modes and with NaN.
  *
  */
 
@@ -53,6 +56,8 @@
 /**** Headers ****/
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
+#include <math.h>
 
 #include "ta_test_priv.h"
 #include "ta_test_func.h"
@@ -92,10 +97,23 @@ typedef struct
    const TA_Real *close;
 } TA_RangeTestParam;
 
+/* The long periods are calculated by blocks of at most 4 periods
+ * (see TA_INT_AvgDevTreeAlloc). Such a series crosses many blocks.
+ * The NaN and the infinite value are in different blocks.
+ */
+#define LONG_PERIOD  130
+#define LONG_NB_BARS 5000
+#define LONG_NAN_IDX 1000
+#define LONG_INF_IDX 3000
+
 /**** Local functions declarations.    ****/
 static ErrorNumber do_test( const TA_History *history,
                             const TA_Test *test );
 
+static ErrorNumber do_test_long( const TA_History *history,
+                                 TA_MathMode mathMode,
+                                 int withNotFinite );
+
 /**** Local variables definitions.     ****/
 
 static TA_Test tableTest[] =
@@ -106,6 +124,11 @@ static TA_Test tableTest[] =
    { 1, 0, 251, 5, TA_SUCCESS,     0, 1.0184,  4,  252-4 }, /* First Value */
    { 0, 0, 251, 5, TA_SUCCESS,     1, 0.3684,  4,  252-4 },
    { 0, 0, 251, 5, TA_SUCCESS, 252-5, 0.5952,  4,  252-4 }, /* Last Value */
+
+   /* Long periods are calculated with a different algorithm. */
+   { 1, 0, 251, 150, TA_SUCCESS,       0, 15.5284, 149, 252-149 }, /* First Value */
+   { 0, 0, 251, 150, TA_SUCCESS,       1, 15.5711, 149, 252-149 },
+   { 0, 0, 251, 150, TA_SUCCESS, 252-150, 10.3477, 149, 252-149 }, /* Last Value */
 };
 
 #define NB_TEST (sizeof(tableTest)/sizeof(TA_Test))
@@ -134,6 +157,15 @@ ErrorNumber test_func_avgdev( TA_History *history )
       }
    }
 
+   /* The long periods use the tree only in TA_MATH_FAST. */
+   for( i=0; i < 4; i++ )
+   {
+      retValue = do_test_long( history, (i&1)? TA_MATH_FAST : TA_MATH_STRICT, i>>1 );
+      TA_SetMathMode( TA_MATH_STRICT );
+      if( retValue != TA_TEST_PASS )
+         return retValue;
+   }
+
    /* All test succeed. */
    return TA_TEST_PASS;
 }
@@ -254,3 +286,91 @@ static ErrorNumber do_test( const TA_History *history,
    return TA_TEST_PASS;
 }
 
+/* Compare with the average deviation calculated
+ * directly from its definition, for every output.
+ *
+ * In TA_MATH_STRICT the sums are done in the same
+ * order as TA_AVGDEV, so the outputs must be the same.
+ * A window with a NaN or an infinite value must give NaN
+ * in both modes.
+ */
+static ErrorNumber do_test_long( const TA_History *history,
+                                 TA_MathMode mathMode,
+                                 int withNotFinite )
+{
+   TA_RetCode retCode;
+   TA_Real *in, *out;
+   TA_Integer outBegIdx, outNbElement;
+   double sum, sumDev, expected;
+   int i, j, nbBars;
+
+   in  = (TA_Real *)malloc( sizeof(TA_Real)*2*LONG_NB_BARS );
+   if( !in )
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+   out = &in[LONG_NB_BARS];
+
+   /* The history repeated, each time at a different level. */
+   nbBars = (int)history->nbBars;
+   for( i=0; i < LONG_NB_BARS; i++ )
+      in[i] = history->close[i%nbBars]*(1.0+(i/nbBars)*0.05);
+
+   if( withNotFinite )
+   {
+      in[LONG_NAN_IDX] = sqrt(-1.0);     /* NaN */
+      in[LONG_INF_IDX] = HUGE_VAL;       /* +infinity */
+   }
+
+   TA_SetMathMode( mathMode );
+   retCode = TA_AVGDEV( 0, LONG_NB_BARS-1, in, LONG_PERIOD,
+                        &outBegIdx, &outNbElement, out );
+   if( (retCode != TA_SUCCESS) ||
+       (outBegIdx != LONG_PERIOD-1) ||
+       (outNbElement != LONG_NB_BARS-LONG_PERIOD+1) )
+   {
+      printf( "Fail: AVGDEV long series (mode %d) returned %d (%d,%d)\n",
+              mathMode, retCode, outBegIdx, outNbElement );
+      free( in );
+      return TA_TEST_AVGDEV_TREE_CALL_FAILED;
+   }
+
+   for( i=0; i < outNbElement; i++ )
+   {
+      /* From the last value of the window, as TA_AVGDEV. */
+      sum = 0.0;
+      for( j=i+LONG_PERIOD-1; j >= i; j-- )
+         sum += in[j];
+
+      sumDev = 0.0;
+      for( j=i+LONG_PERIOD-1; j >= i; j-- )
+         sumDev += fabs( in[j]-sum/LONG_PERIOD );
+      expected = sumDev/LONG_PERIOD;
+
+      if( expected != expected )
+      {
+         if( out[i] == out[i] )
+         {
+            printf( "Fail: AVGDEV long series (mode %d) output %d is %.17g, expected NaN\n",
+                    mathMode, i, out[i] );
+            free( in );
+            return TA_TEST_AVGDEV_TREE_NOT_NAN;
+         }
+      }
+      else if( (mathMode == TA_MATH_STRICT) && (out[i] != expected) )
+      {
+         printf( "Fail: AVGDEV long series output %d is %.17g, not %.17g\n",
+                 i, out[i], expected );
+         free( in );
+         return TA_TEST_AVGDEV_TREE_NOT_SAME;
+      }
+      else if( !(fabs( out[i]-expected ) <= 1e-12*fabs( expected )) )
+      {
+         printf( "Fail: AVGDEV long series output %d is %.17g, expected %.17g\n",
+                 i, out[i], expected );
+         free( in );
+         return TA_TEST_AVGDEV_TREE_NOT_ACCURATE;
+      }
+   }
+
+   free( in );
+   return TA_TEST_PASS;
+}
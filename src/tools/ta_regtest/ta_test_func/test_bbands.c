@@ -107,6 +107,7 @@ typedef struct
 /**** Local functions declarations.    ****/
 static ErrorNumber do_test( const TA_History *history,
                             const TA_Test *test );
+static ErrorNumber testOnePass( const TA_History *history );
 
 /**** Local variables definitions.     ****/
 static TA_Test tableTest[] =
@@ -284,6 +285,10 @@ ErrorNumber test_func_bbands( TA_History *history )
       }
    }
 
+   retValue = testOnePass( history );
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
    /* All test succeed. */
    return TA_TEST_PASS;
 }
@@ -531,3 +536,67 @@ static ErrorNumber do_test( const TA_History *history,
 
    return TA_TEST_PASS;
 }
+
+/* With a SMA, TA_BBANDS calculates the three bands in one pass.
+ * Verify the outputs are identical to TA_SMA followed by
+ * TA_INT_stddev_using_precalc_ma (the calculation done before).
+ */
+static ErrorNumber testOnePass( const TA_History *history )
+{
+   static const double nbDev[5][2] =
+   { {1.0,1.0}, {2.0,2.0}, {1.5,1.0}, {1.0,1.5}, {2.0,-0.5} };
+   static const int period[3] = { 2, 20, 200 };
+
+   TA_RetCode retCode;
+   TA_Integer outBegIdx, outNbElement, refBegIdx, refNbElement;
+   double upper, lower;
+   int i, j, k, startIdx;
+
+   for( k=0; k < 3; k++ )
+   {
+      for( j=0; j < 5; j++ )
+      {
+         startIdx = (j == 4)? 210 : 0;
+         retCode = TA_BBANDS( startIdx, history->nbBars-1, history->close,
+                              period[k], nbDev[j][0], nbDev[j][1], TA_MAType_SMA,
+                              &outBegIdx, &outNbElement,
+                              gBuffer[0].out0, gBuffer[0].out1, gBuffer[0].out2 );
+         if( retCode == TA_SUCCESS )
+            retCode = TA_SMA( startIdx, history->nbBars-1, history->close, period[k],
+                              &refBegIdx, &refNbElement, gBuffer[1].out1 );
+         if( retCode != TA_SUCCESS )
+         {
+            printf( "Fail: TA_BBANDS (SMA) period %d returned %d\n", period[k], retCode );
+            return TA_TEST_BBANDS_CALL_FAILED;
+         }
+
+         if( (outBegIdx != refBegIdx) || (outNbElement != refNbElement) )
+         {
+            printf( "Fail: TA_BBANDS (SMA) period %d begIdx %d/%d nbElement %d/%d\n",
+                    period[k], outBegIdx, refBegIdx, outNbElement, refNbElement );
+            return TA_TEST_BBANDS_NOT_SAME;
+         }
+
+         TA_INT_stddev_using_precalc_ma( history->close, gBuffer[1].out1,
+                                         refBegIdx, refNbElement, period[k],
+                                         gBuffer[1].out2 );
+
+         for( i=0; i < outNbElement; i++ )
+         {
+            upper = gBuffer[1].out1[i] + (gBuffer[1].out2[i] * nbDev[j][0]);
+            lower = gBuffer[1].out1[i] - (gBuffer[1].out2[i] * nbDev[j][1]);
+            if( (memcmp( &gBuffer[0].out0[i], &upper, sizeof(double) ) != 0) ||
+                (memcmp( &gBuffer[0].out1[i], &gBuffer[1].out1[i], sizeof(double) ) != 0) ||
+                (memcmp( &gBuffer[0].out2[i], &lower, sizeof(double) ) != 0) )
+            {
+               printf( "Fail: TA_BBANDS (SMA) period %d output %d (%g,%g,%g)/(%g,%g,%g)\n",
+                       period[k], i, gBuffer[0].out0[i], gBuffer[0].out1[i], gBuffer[0].out2[i],
+                       upper, gBuffer[1].out1[i], lower );
+               return TA_TEST_BBANDS_NOT_SAME;
+            }
+         }
+      }
+   }
+
+   return TA_TEST_PASS;
+}
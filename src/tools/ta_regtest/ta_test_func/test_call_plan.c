@@ -0,0 +1,463 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ *
+ */
+
+/* Description:
+ *     Test the call plans (TA_CallPlanAlloc).
+ *     For every function, the outputs of the plan must be identical
+ *     to the ones of TA_CallFunc with the same parameters.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+#define MAX_OUTPUT 3
+
+typedef struct
+{
+   TA_History *history;
+   TA_Integer *inInteger;
+   TA_Real    *outReal[2][MAX_OUTPUT];
+   TA_Integer *outInteger[2][MAX_OUTPUT];
+   ErrorNumber retValue;
+} TA_PlanTest;
+
+/**** Local functions declarations.    ****/
+static void testFunc( const TA_FuncInfo *funcInfo, void *opaqueData );
+static ErrorNumber testPlan( const TA_FuncInfo *funcInfo, TA_PlanTest *test );
+static ErrorNumber setParams( const TA_FuncInfo *funcInfo, TA_PlanTest *test,
+                              TA_ParamHolder *params, int k, int period );
+static ErrorNumber compareOutputs( const TA_FuncInfo *funcInfo, TA_PlanTest *test,
+                                   int nbElement, const char *what );
+static ErrorNumber testRunWith( TA_History *history, TA_Real *outReal[2][MAX_OUTPUT] );
+static ErrorNumber testBadParams( TA_History *history, TA_Real *out );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_call_plan( TA_History *history )
+{
+   TA_PlanTest test;
+   TA_Real *buffer;
+   TA_Integer *intBuffer;
+   int i, k, nbBars;
+
+   nbBars = (int)history->nbBars;
+   buffer    = (TA_Real *)malloc( sizeof(TA_Real)*2*MAX_OUTPUT*nbBars );
+   intBuffer = (TA_Integer *)malloc( sizeof(TA_Integer)*(2*MAX_OUTPUT+1)*nbBars );
+   if( !buffer || !intBuffer )
+   {
+      free( buffer );
+      free( intBuffer );
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+   }
+
+   memset( &test, 0, sizeof(test) );
+   test.history   = history;
+   test.inInteger = &intBuffer[2*MAX_OUTPUT*nbBars];
+   for( i=0; i < nbBars; i++ )
+      test.inInteger[i] = (TA_Integer)history->close[i];
+   for( k=0; k < 2; k++ )
+   {
+      for( i=0; i < MAX_OUTPUT; i++ )
+      {
+         test.outReal[k][i]    = &buffer[(k*MAX_OUTPUT+i)*nbBars];
+         test.outInteger[k][i] = &intBuffer[(k*MAX_OUTPUT+i)*nbBars];
+      }
+   }
+
+   test.retValue = TA_TEST_PASS;
+   TA_ForEachFunc( testFunc, &test );
+
+   if( test.retValue == TA_TEST_PASS )
+      test.retValue = testRunWith( history, test.outReal );
+
+   if( test.retValue == TA_TEST_PASS )
+      test.retValue = testBadParams( history, test.outReal[0][0] );
+
+   free( buffer );
+   free( intBuffer );
+
+   return test.retValue;
+}
+
+/**** Local functions definitions.     ****/
+static void testFunc( const TA_FuncInfo *funcInfo, void *opaqueData )
+{
+   TA_PlanTest *test;
+
+   test = (TA_PlanTest *)opaqueData;
+   if( test->retValue == TA_TEST_PASS )
+      test->retValue = testPlan( funcInfo, test );
+}
+
+static ErrorNumber testPlan( const TA_FuncInfo *funcInfo, TA_PlanTest *test )
+{
+   ErrorNumber retValue;
+   TA_RetCode retCode;
+   TA_ParamHolder *params;
+   TA_CallPlan *plan;
+   TA_Integer outBegIdx, outNbElement, refBegIdx, refNbElement;
+   TA_Integer lookback, refLookback;
+   int endIdx;
+
+   if( TA_ParamHolderAlloc( funcInfo->handle, &params ) != TA_SUCCESS )
+      return TA_TEST_CALL_PLAN_API_FAILED;
+
+   /* The plan writes in the outputs of k=1. */
+   retValue = setParams( funcInfo, test, params, 1, 7 );
+   if( retValue != TA_TEST_PASS )
+   {
+      TA_ParamHolderFree( params );
+      return retValue;
+   }
+
+   retCode = TA_CallPlanAlloc( params, &plan );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Fail: TA_CallPlanAlloc %s returned %d\n", funcInfo->name, retCode );
+      TA_ParamHolderFree( params );
+      return TA_TEST_CALL_PLAN_API_FAILED;
+   }
+
+   /* Changing the params must not change the plan. */
+   endIdx  = (int)test->history->nbBars-1;
+   retValue = setParams( funcInfo, test, params, 0, 5 );
+   retCode  = TA_CallPlanRun( plan, 0, endIdx, &outBegIdx, &outNbElement );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_CallPlanLookback( plan, &lookback );
+   TA_CallPlanFree( plan );
+
+   /* The reference, in the outputs of k=0. */
+   if( retValue == TA_TEST_PASS )
+      retValue = setParams( funcInfo, test, params, 0, 7 );
+   if( retValue != TA_TEST_PASS )
+   {
+      TA_ParamHolderFree( params );
+      return retValue;
+   }
+
+   if( retCode == TA_SUCCESS )
+      retCode = TA_CallFunc( params, 0, endIdx, &refBegIdx, &refNbElement );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_GetLookback( params, &refLookback );
+   TA_ParamHolderFree( params );
+
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Fail: call of %s returned %d\n", funcInfo->name, retCode );
+      return TA_TEST_CALL_PLAN_CALL_FAILED;
+   }
+
+   if( (outBegIdx != refBegIdx) || (outNbElement != refNbElement) || (lookback != refLookback) )
+   {
+      printf( "Fail: %s begIdx %d/%d nbElement %d/%d lookback %d/%d\n",
+              funcInfo->name, outBegIdx, refBegIdx, outNbElement, refNbElement,
+              lookback, refLookback );
+      return TA_TEST_CALL_PLAN_NOT_SAME;
+   }
+
+   return compareOutputs( funcInfo, test, outNbElement, "TA_CallPlanRun" );
+}
+
+static ErrorNumber setParams( const TA_FuncInfo *funcInfo, TA_PlanTest *test,
+                              TA_ParamHolder *params, int k, int period )
+{
+   const TA_InputParameterInfo *inputInfo;
+   const TA_OutputParameterInfo *outputInfo;
+   const TA_OptInputParameterInfo *optInputInfo;
+   TA_History *history;
+   TA_RetCode retCode;
+   unsigned int i;
+
+   history = test->history;
+   retCode = TA_SUCCESS;
+   for( i=0; (i < funcInfo->nbInput) && (retCode == TA_SUCCESS); i++ )
+   {
+      retCode = TA_GetInputParameterInfo( funcInfo->handle, i, &inputInfo );
+      if( retCode != TA_SUCCESS )
+         break;
+
+      switch( inputInfo->type )
+      {
+      case TA_Input_Price:
+         retCode = TA_SetInputParamPricePtr( params, i, history->open, history->high,
+                                             history->low, history->close,
+                                             history->volume, history->openInterest );
+         break;
+      case TA_Input_Integer:
+         retCode = TA_SetInputParamIntegerPtr( params, i, test->inInteger );
+         break;
+      default:
+         /* Not the same series for each input (ex: CORREL). */
+         retCode = TA_SetInputParamRealPtr( params, i, i%2? history->high : history->close );
+         break;
+      }
+   }
+
+   /* Not the default, for checking the copy done by the plan. */
+   for( i=0; (i < funcInfo->nbOptInput) && (retCode == TA_SUCCESS); i++ )
+   {
+      retCode = TA_GetOptInputParameterInfo( funcInfo->handle, i, &optInputInfo );
+      if( (retCode == TA_SUCCESS) && (optInputInfo->type == TA_OptInput_IntegerRange) &&
+          (optInputInfo->flags == 0) && !strcmp( optInputInfo->paramName, "optInTimePeriod" ) )
+         retCode = TA_SetOptInputParamInteger( params, i, period );
+   }
+
+   for( i=0; (i < funcInfo->nbOutput) && (retCode == TA_SUCCESS); i++ )
+   {
+      retCode = TA_GetOutputParameterInfo( funcInfo->handle, i, &outputInfo );
+      if( retCode != TA_SUCCESS )
+         break;
+
+      if( outputInfo->type == TA_Output_Integer )
+         retCode = TA_SetOutputParamIntegerPtr( params, i, test->outInteger[k][i] );
+      else
+         retCode = TA_SetOutputParamRealPtr( params, i, test->outReal[k][i] );
+   }
+
+   if( (retCode != TA_SUCCESS) || (funcInfo->nbOutput > MAX_OUTPUT) )
+   {
+      printf( "Fail: parameters of %s [%d]\n", funcInfo->name, retCode );
+      return TA_TEST_CALL_PLAN_API_FAILED;
+   }
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber compareOutputs( const TA_FuncInfo *funcInfo, TA_PlanTest *test,
+                                   int nbElement, const char *what )
+{
+   const TA_OutputParameterInfo *outputInfo;
+   unsigned int i;
+   int same;
+
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, i, &outputInfo );
+      if( outputInfo->type == TA_Output_Integer )
+         same = !memcmp( test->outInteger[0][i], test->outInteger[1][i],
+                         sizeof(TA_Integer)*nbElement );
+      else
+         same = !memcmp( test->outReal[0][i], test->outReal[1][i],
+                         sizeof(TA_Real)*nbElement );
+
+      if( !same )
+      {
+         printf( "Fail: %s %s output %d not identical\n", what, funcInfo->name, i );
+         return TA_TEST_CALL_PLAN_NOT_SAME;
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber testRunWith( TA_History *history, TA_Real *outReal[2][MAX_OUTPUT] )
+{
+   TA_RetCode retCode;
+   const TA_FuncHandle *handle;
+   TA_ParamHolder *params;
+   TA_CallPlan *plan;
+   TA_Integer outBegIdx, outNbElement, refBegIdx, refNbElement;
+   const void *in[3];
+   void *out[MAX_OUTPUT];
+   int i;
+
+   /* ATR: the price inputs are high, low and close. */
+   if( (TA_GetFuncHandle( "ATR", &handle ) != TA_SUCCESS) ||
+       (TA_ParamHolderAlloc( handle, &params ) != TA_SUCCESS) )
+      return TA_TEST_CALL_PLAN_API_FAILED;
+
+   TA_SetInputParamPricePtr( params, 0, NULL, history->high, history->low,
+                             history->close, NULL, NULL );
+   TA_SetOptInputParamInteger( params, 0, 10 );
+   TA_SetOutputParamRealPtr( params, 0, outReal[0][0] );
+   retCode = TA_CallPlanAlloc( params, &plan );
+   TA_ParamHolderFree( params );
+   if( retCode != TA_SUCCESS )
+      return TA_TEST_CALL_PLAN_API_FAILED;
+
+   /* Other series, other outputs and a shorter range. */
+   retCode = TA_ATR( 100, 199, history->open, history->low, history->close, 10,
+                     &refBegIdx, &refNbElement, outReal[0][0] );
+
+   in[0]  = history->open;
+   in[1]  = history->low;
+   in[2]  = history->close;
+   out[0] = outReal[1][0];
+   if( retCode == TA_SUCCESS )
+      retCode = TA_CallPlanRunWith( plan, in, out, 100, 199, &outBegIdx, &outNbElement );
+
+   /* Not enough inputs. */
+   if( (retCode == TA_SUCCESS) &&
+       (TA_CallPlanRunWith( plan, NULL, out, 100, 199, &outBegIdx, &outNbElement ) != TA_BAD_PARAM) )
+      retCode = TA_INTERNAL_ERROR(0);
+   TA_CallPlanFree( plan );
+
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Fail: TA_CallPlanRunWith ATR returned %d\n", retCode );
+      return TA_TEST_CALL_PLAN_CALL_FAILED;
+   }
+
+   if( (outBegIdx != refBegIdx) || (outNbElement != refNbElement) ||
+       memcmp( outReal[0][0], outReal[1][0], sizeof(TA_Real)*outNbElement ) )
+   {
+      printf( "Fail: TA_CallPlanRunWith ATR not identical\n" );
+      return TA_TEST_CALL_PLAN_NOT_SAME;
+   }
+
+   /* MACD: 3 outputs. */
+   if( (TA_GetFuncHandle( "MACD", &handle ) != TA_SUCCESS) ||
+       (TA_ParamHolderAlloc( handle, &params ) != TA_SUCCESS) )
+      return TA_TEST_CALL_PLAN_API_FAILED;
+
+   TA_SetInputParamRealPtr( params, 0, history->close );
+   for( i=0; i < 3; i++ )
+      TA_SetOutputParamRealPtr( params, i, outReal[0][i] );
+   retCode = TA_CallPlanAlloc( params, &plan );
+   TA_ParamHolderFree( params );
+   if( retCode != TA_SUCCESS )
+      return TA_TEST_CALL_PLAN_API_FAILED;
+
+   retCode = TA_MACD( 0, (int)history->nbBars-1, history->high, 12, 26, 9,
+                      &refBegIdx, &refNbElement, outReal[0][0], outReal[0][1], outReal[0][2] );
+
+   in[0] = history->high;
+   for( i=0; i < 3; i++ )
+      out[i] = outReal[1][i];
+   if( retCode == TA_SUCCESS )
+      retCode = TA_CallPlanRunWith( plan, in, out, 0, (int)history->nbBars-1,
+                                    &outBegIdx, &outNbElement );
+   TA_CallPlanFree( plan );
+
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Fail: TA_CallPlanRunWith MACD returned %d\n", retCode );
+      return TA_TEST_CALL_PLAN_CALL_FAILED;
+   }
+
+   if( (outBegIdx != refBegIdx) || (outNbElement != refNbElement) )
+      return TA_TEST_CALL_PLAN_NOT_SAME;
+
+   for( i=0; i < 3; i++ )
+   {
+      if( memcmp( outReal[0][i], outReal[1][i], sizeof(TA_Real)*outNbElement ) )
+      {
+         printf( "Fail: TA_CallPlanRunWith MACD output %d not identical\n", i );
+         return TA_TEST_CALL_PLAN_NOT_SAME;
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber testBadParams( TA_History *history, TA_Real *out )
+{
+   TA_RetCode retCode;
+   const TA_FuncHandle *handle;
+   TA_ParamHolder *params;
+   TA_CallPlan *plan;
+   TA_Integer outBegIdx, outNbElement, lookback;
+
+   if( (TA_CallPlanAlloc( NULL, &plan ) != TA_BAD_PARAM) || plan ||
+       (TA_CallPlanRun( NULL, 0, 10, &outBegIdx, &outNbElement ) != TA_BAD_PARAM) ||
+       (TA_CallPlanLookback( NULL, &lookback ) != TA_BAD_PARAM) ||
+       (TA_CallPlanFree( NULL ) != TA_SUCCESS) )
+   {
+      printf( "Fail: TA_CallPlanXXX with NULL\n" );
+      return TA_TEST_CALL_PLAN_API_FAILED;
+   }
+
+   /* The output is not set. */
+   if( (TA_GetFuncHandle( "SMA", &handle ) != TA_SUCCESS) ||
+       (TA_ParamHolderAlloc( handle, &params ) != TA_SUCCESS) )
+      return TA_TEST_CALL_PLAN_API_FAILED;
+
+   TA_SetInputParamRealPtr( params, 0, history->close );
+   retCode = TA_CallPlanAlloc( params, &plan );
+   if( (retCode != TA_OUTPUT_NOT_ALL_INITIALIZE) || plan )
+   {
+      printf( "Fail: TA_CallPlanAlloc without output returned %d\n", retCode );
+      TA_ParamHolderFree( params );
+      return TA_TEST_CALL_PLAN_API_FAILED;
+   }
+
+   /* The errors of the function are returned by the plan. */
+   TA_SetOutputParamRealPtr( params, 0, out );
+   retCode = TA_CallPlanAlloc( params, &plan );
+   TA_ParamHolderFree( params );
+   if( retCode != TA_SUCCESS )
+      return TA_TEST_CALL_PLAN_API_FAILED;
+
+   retCode = TA_CallPlanRun( plan, 10, 5, &outBegIdx, &outNbElement );
+   TA_CallPlanFree( plan );
+   if( retCode != TA_OUT_OF_RANGE_END_INDEX )
+   {
+      printf( "Fail: TA_CallPlanRun with endIdx < startIdx returned %d\n", retCode );
+      return TA_TEST_CALL_PLAN_API_FAILED;
+   }
+
+   return TA_TEST_PASS;
+}
@@ -0,0 +1,507 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ *
+ */
+
+/* Description:
+ *     Test TA_CDL_ALL against each TA_CDLXXX called alone (through
+ *     the abstract interface), with the default and with custom
+ *     candle settings.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef struct
+{
+   TA_Integer startIdx;
+   TA_Integer endIdx;
+   TA_Real    optInPenetration;
+
+   TA_Integer candleSettings; /* 0 for the defaults, see setCandleSettings. */
+   TA_Integer useRandom;      /* Use the random candles instead of the history. */
+   TA_Integer reverse;        /* Request the patterns in reverse order. */
+} TA_Test;
+
+typedef struct
+{
+   int nbBars;
+   const double *open;
+   const double *high;
+   const double *low;
+   const double *close;
+} TA_Candles;
+
+/**** Local functions declarations.    ****/
+static ErrorNumber do_test( const TA_Candles *candles,
+                            const TA_Test *test,
+                            int useFloat );
+
+static ErrorNumber callSingle( const TA_Candles *candles,
+                               const TA_Test *test,
+                               TA_CDLPattern pattern,
+                               int *outBegIdx,
+                               int *outNBElement,
+                               int outInteger[] );
+
+static void setCandleSettings( int candleSettings );
+static void makeRandomCandles( double *open, double *high, double *low, double *close, int nbBars );
+
+/**** Local variables definitions.     ****/
+static const char *patternName[TA_CDL_NB_PATTERN] =
+{
+   "CDL2CROWS", "CDL3BLACKCROWS", "CDL3INSIDE", "CDL3LINESTRIKE",
+   "CDL3OUTSIDE", "CDL3STARSINSOUTH", "CDL3WHITESOLDIERS",
+   "CDLABANDONEDBABY", "CDLADVANCEBLOCK", "CDLBELTHOLD", "CDLBREAKAWAY",
+   "CDLCLOSINGMARUBOZU", "CDLCONCEALBABYSWALL", "CDLCOUNTERATTACK",
+   "CDLDARKCLOUDCOVER", "CDLDOJI", "CDLDOJISTAR", "CDLDRAGONFLYDOJI",
+   "CDLENGULFING", "CDLEVENINGDOJISTAR", "CDLEVENINGSTAR",
+   "CDLGAPSIDESIDEWHITE", "CDLGRAVESTONEDOJI", "CDLHAMMER",
+   "CDLHANGINGMAN", "CDLHARAMI", "CDLHARAMICROSS", "CDLHIGHWAVE",
+   "CDLHIKKAKE", "CDLHIKKAKEMOD", "CDLHOMINGPIGEON", "CDLIDENTICAL3CROWS",
+   "CDLINNECK", "CDLINVERTEDHAMMER", "CDLKICKING", "CDLKICKINGBYLENGTH",
+   "CDLLADDERBOTTOM", "CDLLONGLEGGEDDOJI", "CDLLONGLINE", "CDLMARUBOZU",
+   "CDLMATCHINGLOW", "CDLMATHOLD", "CDLMORNINGDOJISTAR", "CDLMORNINGSTAR",
+   "CDLONNECK", "CDLPIERCING", "CDLRICKSHAWMAN", "CDLRISEFALL3METHODS",
+   "CDLSEPARATINGLINES", "CDLSHOOTINGSTAR", "CDLSHORTLINE",
+   "CDLSPINNINGTOP", "CDLSTALLEDPATTERN", "CDLSTICKSANDWICH", "CDLTAKURI",
+   "CDLTASUKIGAP", "CDLTHRUSTING", "CDLTRISTAR", "CDLUNIQUE3RIVER",
+   "CDLUPSIDEGAP2CROWS", "CDLXSIDEGAP3METHODS"
+};
+
+/* The random candles are rounded to a few ticks so the dojis,
+ * the gaps and the equal prices are frequent.
+ */
+#define NB_RANDOM_BAR 1200
+
+static TA_Test tableTest[] =
+{
+   { 0,    251,  TA_REAL_DEFAULT, 0, 0, 0 },
+   { 20,   200,  TA_REAL_DEFAULT, 0, 0, 1 },
+   { 0,    251,  0.0,             0, 0, 0 },
+   { 251,  251,  1.5,             0, 0, 0 },
+   { 0,    1199, TA_REAL_DEFAULT, 0, 1, 0 },
+   { 3,    1199, 0.2,             0, 1, 1 },
+   { 11,   12,   TA_REAL_DEFAULT, 0, 1, 0 },
+   { 0,    1199, TA_REAL_DEFAULT, 1, 1, 0 },
+   { 30,   1000, 0.7,             1, 1, 1 },
+   { 0,    251,  TA_REAL_DEFAULT, 1, 0, 0 },
+   { 0,    1199, TA_REAL_DEFAULT, 2, 1, 0 },
+   { 5,    251,  TA_REAL_DEFAULT, 2, 0, 1 }
+};
+
+#define NB_TEST (sizeof(tableTest)/sizeof(TA_Test))
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_cdl_all( TA_History *history )
+{
+   unsigned int i;
+   ErrorNumber retValue;
+   TA_Candles histCandles, randomCandles;
+   double *randomData;
+   TA_CDLPattern patterns[1];
+   int outBegIdx[1], outNBElement[1], outInteger[1];
+
+   randomData = (double *)malloc( sizeof(double)*4*NB_RANDOM_BAR );
+   if( !randomData )
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+
+   makeRandomCandles( randomData, &randomData[NB_RANDOM_BAR],
+                      &randomData[2*NB_RANDOM_BAR], &randomData[3*NB_RANDOM_BAR],
+                      NB_RANDOM_BAR );
+
+   randomCandles.nbBars = NB_RANDOM_BAR;
+   randomCandles.open   = randomData;
+   randomCandles.high   = &randomData[NB_RANDOM_BAR];
+   randomCandles.low    = &randomData[2*NB_RANDOM_BAR];
+   randomCandles.close  = &randomData[3*NB_RANDOM_BAR];
+
+   histCandles.nbBars = (int)history->nbBars;
+   histCandles.open   = history->open;
+   histCandles.high   = history->high;
+   histCandles.low    = history->low;
+   histCandles.close  = history->close;
+
+   retValue = TA_TEST_PASS;
+   for( i=0; (i < NB_TEST) && (retValue == TA_TEST_PASS); i++ )
+   {
+      setCandleSettings( tableTest[i].candleSettings );
+
+      retValue = do_test( tableTest[i].useRandom? &randomCandles : &histCandles,
+                          &tableTest[i], 0 );
+      if( retValue == TA_TEST_PASS )
+         retValue = do_test( tableTest[i].useRandom? &randomCandles : &histCandles,
+                             &tableTest[i], 1 );
+
+      TA_RestoreCandleDefaultSettings( TA_AllCandleSettings );
+
+      if( retValue != TA_TEST_PASS )
+         printf( "Failed CDL_ALL Test #%d (Code=%d)\n", i, retValue );
+   }
+
+   free( randomData );
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   /* At least one of the outputs must be provided. */
+   patterns[0] = TA_CDLPattern_DOJI;
+   if( TA_CDL_ALL( 0, 0, history->open, history->high, history->low, history->close,
+                   patterns, 1, TA_REAL_DEFAULT, outBegIdx, outNBElement, NULL, NULL ) != TA_BAD_PARAM )
+   {
+      printf( "TA_CDL_ALL should fail without output\n" );
+      return TA_TEST_CDL_ALL_CALL_FAILED;
+   }
+
+   patterns[0] = (TA_CDLPattern)TA_CDL_NB_PATTERN;
+   if( TA_CDL_ALL( 0, 0, history->open, history->high, history->low, history->close,
+                   patterns, 1, TA_REAL_DEFAULT, outBegIdx, outNBElement, outInteger, NULL ) != TA_BAD_PARAM )
+   {
+      printf( "TA_CDL_ALL should fail with an unknown pattern\n" );
+      return TA_TEST_CDL_ALL_CALL_FAILED;
+   }
+
+   patterns[0] = TA_CDLPattern_MATHOLD;
+   if( TA_CDL_ALL( 0, 0, history->open, history->high, history->low, history->close,
+                   patterns, 1, -1.0, outBegIdx, outNBElement, outInteger, NULL ) != TA_BAD_PARAM )
+   {
+      printf( "TA_CDL_ALL should fail with a negative penetration\n" );
+      return TA_TEST_CDL_ALL_CALL_FAILED;
+   }
+
+   /* All test succeed. */
+   return TA_TEST_PASS;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber do_test( const TA_Candles *candles,
+                            const TA_Test *test,
+                            int useFloat )
+{
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   TA_Candles floatCandles;
+   TA_CDLPattern patterns[TA_CDL_NB_PATTERN];
+   int outBegIdx, outNBElement, nbOutput, nbBars, i, k, bit;
+   int outBegIdxAll[TA_CDL_NB_PATTERN], outNBElementAll[TA_CDL_NB_PATTERN];
+   int outBegIdxMask[TA_CDL_NB_PATTERN], outNBElementMask[TA_CDL_NB_PATTERN];
+   int *out, *outAll, *outAllFloat;
+   UInt64 *outMask, *outMaskOnly;
+   float *inFloat;
+   double *inDouble;
+
+   nbBars   = candles->nbBars;
+   nbOutput = test->endIdx-test->startIdx+1;
+
+   out         = (int *)malloc( sizeof(int)*nbOutput*(2*TA_CDL_NB_PATTERN+1) );
+   outMask     = (UInt64 *)malloc( sizeof(UInt64)*nbOutput*2 );
+   inFloat     = (float *)malloc( sizeof(float)*nbBars*4 );
+   inDouble    = (double *)malloc( sizeof(double)*nbBars*4 );
+   if( !out || !outMask || !inFloat || !inDouble )
+   {
+      free( out );
+      free( outMask );
+      free( inFloat );
+      free( inDouble );
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+   }
+   outAll      = &out[nbOutput];
+   outAllFloat = &outAll[nbOutput*TA_CDL_NB_PATTERN];
+   outMaskOnly = &outMask[nbOutput];
+
+   /* TA_S_CDL_ALL converts the prices to double, it must give the
+    * same outputs as the double version on the converted prices.
+    */
+   if( useFloat )
+   {
+      for( i=0; i < nbBars; i++ )
+      {
+         inFloat[i]          = (float)candles->open[i];
+         inFloat[nbBars+i]   = (float)candles->high[i];
+         inFloat[2*nbBars+i] = (float)candles->low[i];
+         inFloat[3*nbBars+i] = (float)candles->close[i];
+      }
+      for( i=0; i < 4*nbBars; i++ )
+         inDouble[i] = inFloat[i];
+
+      floatCandles.nbBars = nbBars;
+      floatCandles.open   = inDouble;
+      floatCandles.high   = &inDouble[nbBars];
+      floatCandles.low    = &inDouble[2*nbBars];
+      floatCandles.close  = &inDouble[3*nbBars];
+      candles = &floatCandles;
+   }
+
+   for( k=0; k < TA_CDL_NB_PATTERN; k++ )
+      patterns[k] = (TA_CDLPattern)(test->reverse? TA_CDL_NB_PATTERN-1-k : k);
+
+   retValue = TA_TEST_PASS;
+
+   retCode = TA_CDL_ALL( test->startIdx, test->endIdx,
+                         candles->open, candles->high, candles->low, candles->close,
+                         patterns, TA_CDL_NB_PATTERN, test->optInPenetration,
+                         outBegIdxAll, outNBElementAll, outAll, outMask );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_CDL_ALL failed (%d)\n", retCode );
+      retValue = TA_TEST_CDL_ALL_CALL_FAILED;
+      goto cleanup;
+   }
+
+   /* The mask alone must be the same. */
+   retCode = TA_CDL_ALL( test->startIdx, test->endIdx,
+                         candles->open, candles->high, candles->low, candles->close,
+                         patterns, TA_CDL_NB_PATTERN, test->optInPenetration,
+                         outBegIdxMask, outNBElementMask, NULL, outMaskOnly );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_CDL_ALL failed (%d)\n", retCode );
+      retValue = TA_TEST_CDL_ALL_CALL_FAILED;
+      goto cleanup;
+   }
+
+   for( i=0; i < nbOutput; i++ )
+   {
+      if( outMaskOnly[i] != outMask[i] )
+      {
+         printf( "Mask at bar %d differs when outInteger is NULL\n", test->startIdx+i );
+         retValue = TA_TEST_CDL_ALL_NOT_SAME;
+         goto cleanup;
+      }
+   }
+
+   if( useFloat )
+   {
+      retCode = TA_S_CDL_ALL( test->startIdx, test->endIdx,
+                              inFloat, &inFloat[nbBars], &inFloat[2*nbBars], &inFloat[3*nbBars],
+                              patterns, TA_CDL_NB_PATTERN, test->optInPenetration,
+                              outBegIdxAll, outNBElementAll, outAllFloat, NULL );
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "TA_S_CDL_ALL failed (%d)\n", retCode );
+         retValue = TA_TEST_CDL_ALL_CALL_FAILED;
+         goto cleanup;
+      }
+
+      for( k=0; k < TA_CDL_NB_PATTERN; k++ )
+      {
+         for( i=0; i < outNBElementAll[k]; i++ )
+         {
+            if( outAllFloat[k*nbOutput+i] != outAll[k*nbOutput+i] )
+            {
+               printf( "%s: TA_S_CDL_ALL and TA_CDL_ALL differ at bar %d\n",
+                       patternName[patterns[k]], outBegIdxAll[k]+i );
+               retValue = TA_TEST_CDL_ALL_NOT_SAME;
+               goto cleanup;
+            }
+         }
+      }
+   }
+
+   for( k=0; k < TA_CDL_NB_PATTERN; k++ )
+   {
+      retValue = callSingle( candles, test, patterns[k],
+                             &outBegIdx, &outNBElement, out );
+      if( retValue != TA_TEST_PASS )
+         goto cleanup;
+
+      if( (outBegIdx != outBegIdxAll[k]) || (outNBElement != outNBElementAll[k]) )
+      {
+         printf( "%s: single (%d,%d) and all (%d,%d) differ\n",
+                 patternName[patterns[k]], outBegIdx, outNBElement,
+                 outBegIdxAll[k], outNBElementAll[k] );
+         retValue = TA_TEST_CDL_ALL_NOT_SAME;
+         goto cleanup;
+      }
+
+      for( i=0; i < outNBElement; i++ )
+      {
+         if( outAll[k*nbOutput+i] != out[i] )
+         {
+            printf( "%s at bar %d is %d but expected %d\n",
+                    patternName[patterns[k]], outBegIdx+i, outAll[k*nbOutput+i], out[i] );
+            retValue = TA_TEST_CDL_ALL_NOT_SAME;
+            goto cleanup;
+         }
+      }
+
+      /* The bit of the pattern is set on the bars where it is recognized. */
+      for( i=test->startIdx; i <= test->endIdx; i++ )
+      {
+         bit = (outMask[i-test->startIdx] >> patterns[k]) & 1;
+         if( bit != ((outNBElement > 0) && (i >= outBegIdx) && (out[i-outBegIdx] != 0)) )
+         {
+            printf( "%s: bad mask at bar %d\n", patternName[patterns[k]], i );
+            retValue = TA_TEST_CDL_ALL_NOT_SAME;
+            goto cleanup;
+         }
+      }
+   }
+
+cleanup:
+   free( out );
+   free( outMask );
+   free( inFloat );
+   free( inDouble );
+
+   return retValue;
+}
+
+static ErrorNumber callSingle( const TA_Candles *candles,
+                               const TA_Test *test,
+                               TA_CDLPattern pattern,
+                               int *outBegIdx,
+                               int *outNBElement,
+                               int outInteger[] )
+{
+   TA_RetCode retCode;
+   const TA_FuncHandle *handle;
+   const TA_FuncInfo *funcInfo;
+   TA_ParamHolder *params;
+
+   retCode = TA_GetFuncHandle( patternName[pattern], &handle );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_GetFuncInfo( handle, &funcInfo );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_GetFuncHandle( %s ) failed (%d)\n", patternName[pattern], retCode );
+      return TA_TEST_CDL_ALL_CALL_FAILED;
+   }
+
+   retCode = TA_ParamHolderAlloc( handle, &params );
+   if( retCode != TA_SUCCESS )
+      return TA_TEST_CDL_ALL_CALL_FAILED;
+
+   retCode = TA_SetInputParamPricePtr( params, 0, candles->open, candles->high,
+                                       candles->low, candles->close, NULL, NULL );
+
+   /* Only the optional input is the penetration. */
+   if( (retCode == TA_SUCCESS) && (funcInfo->nbOptInput != 0) &&
+       (test->optInPenetration != TA_REAL_DEFAULT) )
+      retCode = TA_SetOptInputParamReal( params, 0, test->optInPenetration );
+
+   if( retCode == TA_SUCCESS )
+      retCode = TA_SetOutputParamIntegerPtr( params, 0, outInteger );
+
+   if( retCode == TA_SUCCESS )
+      retCode = TA_CallFunc( params, test->startIdx, test->endIdx,
+                             outBegIdx, outNBElement );
+
+   TA_ParamHolderFree( params );
+
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "%s failed (%d)\n", patternName[pattern], retCode );
+      return TA_TEST_CDL_ALL_CALL_FAILED;
+   }
+
+   return TA_TEST_PASS;
+}
+
+static void setCandleSettings( int candleSettings )
+{
+   switch( candleSettings )
+   {
+   case 1:
+      /* No average, one candle average and other range types. */
+      TA_SetCandleSettings( TA_BodyLong, TA_RangeType_RealBody, 0, 1.0 );
+      TA_SetCandleSettings( TA_BodyDoji, TA_RangeType_HighLow, 1, 0.2 );
+      TA_SetCandleSettings( TA_ShadowVeryShort, TA_RangeType_Shadows, 3, 0.5 );
+      TA_SetCandleSettings( TA_Near, TA_RangeType_Shadows, 7, 0.3 );
+      break;
+   case 2:
+      /* Long averages and the same average for many settings. */
+      TA_SetCandleSettings( TA_BodyLong, TA_RangeType_HighLow, 20, 0.5 );
+      TA_SetCandleSettings( TA_BodyShort, TA_RangeType_HighLow, 20, 0.3 );
+      TA_SetCandleSettings( TA_ShadowLong, TA_RangeType_HighLow, 20, 0.6 );
+      TA_SetCandleSettings( TA_Equal, TA_RangeType_HighLow, 1, 0.1 );
+      break;
+   default:
+      break;
+   }
+}
+
+static void makeRandomCandles( double *open, double *high, double *low, double *close, int nbBars )
+{
+   unsigned int seed;
+   int i, price, o, c, h, l;
+
+   seed  = 12345;
+   price = 1000;
+   for( i=0; i < nbBars; i++ )
+   {
+      seed = seed*1103515245+12345;
+      o = price + (int)((seed>>16)%9) - 4;
+      seed = seed*1103515245+12345;
+      c = o + (int)((seed>>16)%21) - 10;
+      seed = seed*1103515245+12345;
+      h = max(o,c) + (int)((seed>>16)%4);
+      seed = seed*1103515245+12345;
+      l = min(o,c) - (int)((seed>>16)%4);
+
+      open[i]  = o*0.25;
+      high[i]  = h*0.25;
+      low[i]   = l*0.25;
+      close[i] = c*0.25;
+      price = c;
+   }
+}
@@ -0,0 +1,369 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ *
+ */
+
+/* Description:
+ *     Test that the settings of a TA_Context are used instead of the
+ *     global settings, and that they do not change the global settings.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+#define NB_OUTPUT 252
+
+/* The output of a few functions influenced by each kind of setting. */
+typedef struct
+{
+   int     nbEMA, nbRSI, nbDOJI;
+   TA_Real ema[NB_OUTPUT];
+   TA_Real rsi[NB_OUTPUT];
+   TA_Integer doji[NB_OUTPUT];
+} TA_Outputs;
+
+/**** Local functions declarations.    ****/
+static ErrorNumber callFunctions( TA_History *history, TA_Outputs *outputs );
+static ErrorNumber callEMA( TA_History *history, const TA_Context *context,
+                            TA_Outputs *outputs );
+static ErrorNumber checkSame( const TA_Outputs *outputs, const TA_Outputs *expected );
+static ErrorNumber checkGlobalsUnchanged( void );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_context( TA_History *history )
+{
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   TA_Context *context, *context2;
+   TA_Outputs *outDefault, *outCustom, *out;
+
+   if( history->nbBars < NB_OUTPUT )
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+
+   outDefault = (TA_Outputs *)malloc( sizeof(TA_Outputs)*3 );
+   if( !outDefault )
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+   outCustom = &outDefault[1];
+   out       = &outDefault[2];
+   context   = NULL;
+   context2  = NULL;
+
+   /* Reference outputs using the global settings. */
+   retValue = callFunctions( history, outDefault );
+   if( retValue != TA_TEST_PASS )
+      goto cleanup;
+
+   TA_SetUnstablePeriod( TA_FUNC_UNST_EMA, 15 );
+   TA_SetCompatibility( TA_COMPATIBILITY_METASTOCK );
+   TA_SetCandleSettings( TA_BodyDoji, TA_RangeType_HighLow, 3, 0.5 );
+   retValue = callFunctions( history, outCustom );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+   TA_SetCompatibility( TA_COMPATIBILITY_DEFAULT );
+   TA_RestoreCandleDefaultSettings( TA_AllCandleSettings );
+   if( retValue != TA_TEST_PASS )
+      goto cleanup;
+
+   retValue = TA_TEST_CONTEXT_NOT_SAME;
+   if( (outCustom->nbEMA == outDefault->nbEMA) ||
+       (outCustom->rsi[0] == outDefault->rsi[0]) ||
+       !memcmp( outCustom->doji, outDefault->doji, sizeof(outCustom->doji) ) )
+   {
+      printf( "The custom settings are expected to change all the outputs\n" );
+      goto cleanup;
+   }
+
+   /* Same settings, but in a context. */
+   retValue = TA_TEST_CONTEXT_CALL_FAILED;
+   retCode = TA_ContextAlloc( &context );
+   if( (retCode != TA_SUCCESS) ||
+       (TA_ContextSetUnstablePeriod( context, TA_FUNC_UNST_EMA, 15 ) != TA_SUCCESS) ||
+       (TA_ContextSetCompatibility( context, TA_COMPATIBILITY_METASTOCK ) != TA_SUCCESS) ||
+       (TA_ContextSetCandleSettings( context, TA_BodyDoji, TA_RangeType_HighLow, 3, 0.5 ) != TA_SUCCESS) )
+   {
+      printf( "Failed to setup the context (%d)\n", retCode );
+      goto cleanup;
+   }
+
+   if( (TA_ContextGetUnstablePeriod( context, TA_FUNC_UNST_EMA ) != 15) ||
+       (TA_ContextGetUnstablePeriod( context, TA_FUNC_UNST_RSI ) != 0) ||
+       (TA_ContextGetCompatibility( context ) != TA_COMPATIBILITY_METASTOCK) )
+   {
+      printf( "Unexpected context settings\n" );
+      goto cleanup;
+   }
+
+   if( TA_GetThreadContext() != NULL )
+   {
+      printf( "No context expected before TA_SetThreadContext\n" );
+      goto cleanup;
+   }
+
+   retCode = TA_SetThreadContext( context );
+   if( (retCode != TA_SUCCESS) || (TA_GetThreadContext() != context) )
+   {
+      printf( "TA_SetThreadContext failed (%d)\n", retCode );
+      goto cleanup;
+   }
+
+   retValue = callFunctions( history, out );
+   if( retValue == TA_TEST_PASS )
+      retValue = checkSame( out, outCustom );
+   if( retValue == TA_TEST_PASS )
+      retValue = checkGlobalsUnchanged();
+
+   TA_SetThreadContext( NULL );
+   if( retValue != TA_TEST_PASS )
+      goto cleanup;
+
+   /* Back to the global settings. */
+   retValue = callFunctions( history, out );
+   if( retValue == TA_TEST_PASS )
+      retValue = checkSame( out, outDefault );
+   if( retValue != TA_TEST_PASS )
+      goto cleanup;
+
+   /* Through the abstract interface, the thread settings are
+    * restored on return.
+    */
+   retValue = callEMA( history, context, out );
+   if( retValue == TA_TEST_PASS )
+      retValue = (out->nbEMA == outCustom->nbEMA) &&
+                 !memcmp( out->ema, outCustom->ema, sizeof(TA_Real)*out->nbEMA )?
+                 TA_TEST_PASS : TA_TEST_CONTEXT_NOT_SAME;
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "TA_CallFuncContext did not use the context settings\n" );
+      goto cleanup;
+   }
+
+   retValue = TA_TEST_CONTEXT_CALL_FAILED;
+   if( TA_GetThreadContext() != NULL )
+   {
+      printf( "TA_CallFuncContext did not restore the thread context\n" );
+      goto cleanup;
+   }
+
+   /* A new context starts with a copy of the global settings. */
+   TA_SetUnstablePeriod( TA_FUNC_UNST_EMA, 7 );
+   retCode = TA_ContextAlloc( &context2 );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+   if( (retCode != TA_SUCCESS) ||
+       (TA_ContextGetUnstablePeriod( context2, TA_FUNC_UNST_EMA ) != 7) ||
+       (TA_ContextGetCompatibility( context2 ) != TA_COMPATIBILITY_DEFAULT) )
+   {
+      printf( "TA_ContextAlloc did not copy the global settings\n" );
+      goto cleanup;
+   }
+
+   /* Restoring the candle defaults of a context. */
+   retCode = TA_ContextRestoreCandleDefaultSettings( context, TA_AllCandleSettings );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_ContextSetUnstablePeriod( context, TA_FUNC_UNST_ALL, 0 );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_ContextSetCompatibility( context, TA_COMPATIBILITY_DEFAULT );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Failed to restore the context settings (%d)\n", retCode );
+      goto cleanup;
+   }
+
+   TA_SetThreadContext( context );
+   retValue = callFunctions( history, out );
+   TA_SetThreadContext( NULL );
+   if( retValue == TA_TEST_PASS )
+      retValue = checkSame( out, outDefault );
+   if( retValue != TA_TEST_PASS )
+      goto cleanup;
+
+   /* Bad parameters. */
+   retValue = TA_TEST_CONTEXT_CALL_FAILED;
+   if( (TA_ContextAlloc( NULL ) != TA_BAD_PARAM) ||
+       (TA_ContextSetCompatibility( NULL, TA_COMPATIBILITY_DEFAULT ) != TA_INVALID_HANDLE) ||
+       (TA_ContextSetUnstablePeriod( context, (TA_FuncUnstId)(TA_FUNC_UNST_ALL+1), 0 ) != TA_BAD_PARAM) ||
+       (TA_ContextSetCandleSettings( context, TA_AllCandleSettings, TA_RangeType_HighLow, 0, 0.0 ) != TA_BAD_PARAM) ||
+       (TA_ContextGetUnstablePeriod( NULL, TA_FUNC_UNST_EMA ) != 0) ||
+       (TA_ContextFree( NULL ) != TA_SUCCESS) ||
+       (TA_CallFuncContext( NULL, NULL, 0, 0, NULL, NULL ) != TA_BAD_PARAM) )
+   {
+      printf( "Unexpected return code for a bad parameter\n" );
+      goto cleanup;
+   }
+
+   retValue = TA_TEST_PASS;
+
+cleanup:
+   TA_SetThreadContext( NULL );
+   if( (TA_ContextFree( context ) != TA_SUCCESS) ||
+       (TA_ContextFree( context2 ) != TA_SUCCESS) )
+   {
+      printf( "TA_ContextFree failed\n" );
+      if( retValue == TA_TEST_PASS )
+         retValue = TA_TEST_CONTEXT_CALL_FAILED;
+   }
+   free( outDefault );
+
+   return retValue;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber callFunctions( TA_History *history, TA_Outputs *outputs )
+{
+   TA_RetCode retCode;
+   int outBegIdx;
+
+   memset( outputs, 0, sizeof(TA_Outputs) );
+
+   retCode = TA_EMA( 0, NB_OUTPUT-1, history->close, 10,
+                     &outBegIdx, &outputs->nbEMA, outputs->ema );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_RSI( 0, NB_OUTPUT-1, history->close, 14,
+                        &outBegIdx, &outputs->nbRSI, outputs->rsi );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_CDLDOJI( 0, NB_OUTPUT-1, history->open, history->high,
+                            history->low, history->close,
+                            &outBegIdx, &outputs->nbDOJI, outputs->doji );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Function call failed (%d)\n", retCode );
+      return TA_TEST_CONTEXT_CALL_FAILED;
+   }
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber callEMA( TA_History *history, const TA_Context *context,
+                            TA_Outputs *outputs )
+{
+   TA_RetCode retCode;
+   const TA_FuncHandle *handle;
+   TA_ParamHolder *params;
+   int outBegIdx;
+
+   memset( outputs, 0, sizeof(TA_Outputs) );
+
+   retCode = TA_GetFuncHandle( "EMA", &handle );
+   if( retCode != TA_SUCCESS )
+      return TA_TEST_CONTEXT_CALL_FAILED;
+
+   retCode = TA_ParamHolderAlloc( handle, &params );
+   if( retCode != TA_SUCCESS )
+      return TA_TEST_CONTEXT_CALL_FAILED;
+
+   retCode = TA_SetInputParamRealPtr( params, 0, history->close );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_SetOptInputParamInteger( params, 0, 10 );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_SetOutputParamRealPtr( params, 0, outputs->ema );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_CallFuncContext( context, params, 0, NB_OUTPUT-1,
+                                    &outBegIdx, &outputs->nbEMA );
+
+   TA_ParamHolderFree( params );
+
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_CallFuncContext failed (%d)\n", retCode );
+      return TA_TEST_CONTEXT_CALL_FAILED;
+   }
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber checkSame( const TA_Outputs *outputs, const TA_Outputs *expected )
+{
+   if( (outputs->nbEMA != expected->nbEMA) ||
+       memcmp( outputs->ema, expected->ema, sizeof(TA_Real)*expected->nbEMA ) )
+   {
+      printf( "EMA output differs\n" );
+      return TA_TEST_CONTEXT_NOT_SAME;
+   }
+
+   if( (outputs->nbRSI != expected->nbRSI) ||
+       memcmp( outputs->rsi, expected->rsi, sizeof(TA_Real)*expected->nbRSI ) )
+   {
+      printf( "RSI output differs\n" );
+      return TA_TEST_CONTEXT_NOT_SAME;
+   }
+
+   if( (outputs->nbDOJI != expected->nbDOJI) ||
+       memcmp( outputs->doji, expected->doji, sizeof(TA_Integer)*expected->nbDOJI ) )
+   {
+      printf( "CDLDOJI output differs\n" );
+      return TA_TEST_CONTEXT_NOT_SAME;
+   }
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber checkGlobalsUnchanged( void )
+{
+   if( (TA_GetUnstablePeriod( TA_FUNC_UNST_EMA ) != 0) ||
+       (TA_GetCompatibility() != TA_COMPATIBILITY_DEFAULT) )
+   {
+      printf( "The context changed the global settings\n" );
+      return TA_TEST_CONTEXT_NOT_SAME;
+   }
+
+   return TA_TEST_PASS;
+}
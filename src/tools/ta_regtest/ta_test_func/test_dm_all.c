@@ -0,0 +1,321 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ *  101826 MF   Compare with the functions called with the same startIdx.
+ *
+ */
+
+/* Description:
+ *     Test TA_DM_ALL against TRANGE, ATR, NATR, PLUS_DM, MINUS_DM,
+ *     PLUS_DI, MINUS_DI, DX, ADX and ADXR.
+ *
+ *     Each individual function is called with the same startIdx as
+ *     TA_DM_ALL and the outputs must be identical, with the default
+ *     unstable periods and with a different one for each function.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+
+/* The outputs, in the same order as the TA_DM_ALL parameters. */
+enum
+{
+   OUT_TRANGE,
+   OUT_ATR,
+   OUT_NATR,
+   OUT_PLUS_DM,
+   OUT_MINUS_DM,
+   OUT_PLUS_DI,
+   OUT_MINUS_DI,
+   OUT_DX,
+   OUT_ADX,
+   OUT_ADXR,
+   NB_OUTPUT
+};
+
+typedef struct
+{
+   TA_Integer startIdx;
+   TA_Integer optInTimePeriod;
+   TA_Integer unstablePeriod; /* 0 for all, else different for each function */
+} TA_Test;
+
+/**** Local functions declarations.    ****/
+static ErrorNumber do_test( const TA_History *history,
+                            const TA_Test *test,
+                            int useFloat );
+
+/**** Local variables definitions.     ****/
+static TA_Test tableTest[] =
+{
+   { 0,   14, 0  },
+   { 100, 14, 0  },
+   { 251, 14, 0  },
+   { 0,   2,  0  },
+   { 0,   30, 0  },
+   { 0,   14, 5  },
+   { 60,  5,  50 },
+   { 0,   10, 21 }
+};
+
+#define NB_TEST (sizeof(tableTest)/sizeof(TA_Test))
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_dm_all( TA_History *history )
+{
+   unsigned int i;
+   ErrorNumber retValue;
+
+   for( i=0; i < NB_TEST; i++ )
+   {
+      retValue = do_test( history, &tableTest[i], 0 );
+      if( retValue == TA_TEST_PASS )
+         retValue = do_test( history, &tableTest[i], 1 );
+
+      if( retValue != TA_TEST_PASS )
+      {
+         printf( "Failed DM_ALL Test #%d (Code=%d)\n", i, retValue );
+         TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+         return retValue;
+      }
+   }
+
+   TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+
+   /* All test succeed. */
+   return TA_TEST_PASS;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber do_test( const TA_History *history,
+                            const TA_Test *test,
+                            int useFloat )
+{
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   double *out[NB_OUTPUT], *outAll[NB_OUTPUT], *inCopy;
+   float *inFloat[3];
+   int outBegIdx, outNBElement, begIdx, nbElement, lookback;
+   int startIdx, endIdx, nbBars, period, i, j;
+
+   nbBars = (int)history->nbBars;
+   endIdx = nbBars-1;
+   period = test->optInTimePeriod;
+
+   /* With a large unstable period, ATR and NATR have the
+    * longest lookback.
+    */
+   TA_SetUnstablePeriod( TA_FUNC_UNST_ATR,      test->unstablePeriod );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_NATR,     test->unstablePeriod/2 );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_ADX,      test->unstablePeriod/3 );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_PLUS_DM,  test->unstablePeriod/4 );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_MINUS_DM, test->unstablePeriod/5 );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_PLUS_DI,  test->unstablePeriod/4 );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_MINUS_DI, test->unstablePeriod/6 );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_DX,       test->unstablePeriod/7 );
+
+   lookback = TA_DM_ALL_Lookback( period );
+   if( (lookback < TA_ADXR_Lookback( period )) || (lookback < TA_ATR_Lookback( period )) )
+      return TA_TEST_DM_ALL_CALL_FAILED;
+
+   inCopy     = (double *)malloc( sizeof(double)*nbBars*(2*NB_OUTPUT+1) );
+   inFloat[0] = (float *)malloc( sizeof(float)*nbBars*3 );
+   if( !inCopy || !inFloat[0] )
+   {
+      free( inCopy );
+      free( inFloat[0] );
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+   }
+   inFloat[1] = &inFloat[0][nbBars];
+   inFloat[2] = &inFloat[0][nbBars*2];
+
+   for( j=0; j < NB_OUTPUT; j++ )
+   {
+      out[j]    = &inCopy[nbBars*(j+1)];
+      outAll[j] = &inCopy[nbBars*(j+1+NB_OUTPUT)];
+   }
+
+   for( i=0; i < nbBars; i++ )
+   {
+      inFloat[0][i] = (float)history->high[i];
+      inFloat[1][i] = (float)history->low[i];
+      inFloat[2][i] = (float)history->close[i];
+   }
+
+   retValue = TA_TEST_PASS;
+
+   #define CHECK_CALL(x) \
+      { \
+         retCode = x; \
+         if( (retCode != TA_SUCCESS) || (outBegIdx != startIdx) || \
+             (outNBElement != endIdx-startIdx+1) ) \
+         { \
+            printf( "Call %d failed (%d)\n", j, retCode ); \
+            retValue = TA_TEST_DM_ALL_CALL_FAILED; \
+            goto cleanup; \
+         } \
+      }
+
+   #define CALL_HLC(func,...) \
+      (useFloat? TA_S_##func( startIdx, endIdx, inFloat[0], inFloat[1], inFloat[2], __VA_ARGS__ ) : \
+                 TA_##func( startIdx, endIdx, history->high, history->low, history->close, __VA_ARGS__ ))
+
+   startIdx = lookback;
+   if( startIdx < test->startIdx )
+      startIdx = test->startIdx;
+   begIdx    = startIdx;
+   nbElement = endIdx-startIdx+1;
+
+   j = NB_OUTPUT;
+   CHECK_CALL( CALL_HLC( DM_ALL, period, &outBegIdx, &outNBElement,
+                         outAll[OUT_TRANGE], outAll[OUT_ATR], outAll[OUT_NATR],
+                         outAll[OUT_PLUS_DM], outAll[OUT_MINUS_DM],
+                         outAll[OUT_PLUS_DI], outAll[OUT_MINUS_DI],
+                         outAll[OUT_DX], outAll[OUT_ADX], outAll[OUT_ADXR] ) );
+
+   /* Call every function with the same startIdx. */
+   for( j=0; j < NB_OUTPUT; j++ )
+   {
+      switch( j )
+      {
+      case OUT_TRANGE:
+         CHECK_CALL( CALL_HLC( TRANGE, &outBegIdx, &outNBElement, out[j] ) );
+         break;
+      case OUT_ATR:
+         CHECK_CALL( CALL_HLC( ATR, period, &outBegIdx, &outNBElement, out[j] ) );
+         break;
+      case OUT_NATR:
+         CHECK_CALL( CALL_HLC( NATR, period, &outBegIdx, &outNBElement, out[j] ) );
+         break;
+      case OUT_PLUS_DM:
+         CHECK_CALL( useFloat? TA_S_PLUS_DM( startIdx, endIdx, inFloat[0], inFloat[1], period,
+                                             &outBegIdx, &outNBElement, out[j] ) :
+                               TA_PLUS_DM( startIdx, endIdx, history->high, history->low, period,
+                                           &outBegIdx, &outNBElement, out[j] ) );
+         break;
+      case OUT_MINUS_DM:
+         CHECK_CALL( useFloat? TA_S_MINUS_DM( startIdx, endIdx, inFloat[0], inFloat[1], period,
+                                              &outBegIdx, &outNBElement, out[j] ) :
+                               TA_MINUS_DM( startIdx, endIdx, history->high, history->low, period,
+                                            &outBegIdx, &outNBElement, out[j] ) );
+         break;
+      case OUT_PLUS_DI:
+         CHECK_CALL( CALL_HLC( PLUS_DI, period, &outBegIdx, &outNBElement, out[j] ) );
+         break;
+      case OUT_MINUS_DI:
+         CHECK_CALL( CALL_HLC( MINUS_DI, period, &outBegIdx, &outNBElement, out[j] ) );
+         break;
+      case OUT_DX:
+         CHECK_CALL( CALL_HLC( DX, period, &outBegIdx, &outNBElement, out[j] ) );
+         break;
+      case OUT_ADX:
+         CHECK_CALL( CALL_HLC( ADX, period, &outBegIdx, &outNBElement, out[j] ) );
+         break;
+      case OUT_ADXR:
+         CHECK_CALL( CALL_HLC( ADXR, period, &outBegIdx, &outNBElement, out[j] ) );
+         break;
+      }
+
+      for( i=0; i < nbElement; i++ )
+      {
+         if( out[j][i] != outAll[j][i] )
+         {
+            printf( "Output %d at bar %d is %.17g but expected %.17g\n",
+                    j, begIdx+i, outAll[j][i], out[j][i] );
+            retValue = TA_TEST_DM_ALL_NOT_SAME;
+            goto cleanup;
+         }
+      }
+   }
+
+   /* A subset of the outputs must give the same values. The
+    * input and output can be the same buffer.
+    */
+   memcpy( inCopy, history->close, sizeof(double)*nbBars );
+   j = NB_OUTPUT;
+   CHECK_CALL( useFloat?
+               TA_S_DM_ALL( startIdx, endIdx, inFloat[0], inFloat[1], inFloat[2], period,
+                            &outBegIdx, &outNBElement,
+                            NULL, NULL, out[OUT_NATR], NULL, NULL,
+                            NULL, out[OUT_MINUS_DI], NULL, NULL, out[OUT_ADXR] ) :
+               TA_DM_ALL( startIdx, endIdx, history->high, history->low, inCopy, period,
+                          &outBegIdx, &outNBElement,
+                          NULL, NULL, inCopy, NULL, NULL,
+                          NULL, out[OUT_MINUS_DI], NULL, NULL, out[OUT_ADXR] ) );
+   if( (memcmp( useFloat? out[OUT_NATR] : inCopy, outAll[OUT_NATR], sizeof(double)*nbElement ) != 0) ||
+       (memcmp( out[OUT_MINUS_DI], outAll[OUT_MINUS_DI], sizeof(double)*nbElement ) != 0) ||
+       (memcmp( out[OUT_ADXR], outAll[OUT_ADXR], sizeof(double)*nbElement ) != 0) )
+   {
+      printf( "TA_DM_ALL output not the same with a subset of the outputs\n" );
+      retValue = TA_TEST_DM_ALL_NOT_SAME;
+      goto cleanup;
+   }
+
+   #undef CALL_HLC
+   #undef CHECK_CALL
+
+cleanup:
+   free( inCopy );
+   free( inFloat[0] );
+
+   return retValue;
+}
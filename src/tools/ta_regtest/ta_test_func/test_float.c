@@ -0,0 +1,373 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ *
+ */
+
+/* Description:
+ *     Test that the TA_F_XXX functions are within their documented
+ *     error bounds of TA_S_XXX (see ta_func_ext.h), and that each
+ *     column of TA_F_EMA_PANEL is identical to TA_F_EMA.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_func_ext.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef enum
+{
+   FLOAT_ADD, FLOAT_SUB, FLOAT_MULT, FLOAT_DIV,
+   FLOAT_AVGPRICE, FLOAT_MEDPRICE, FLOAT_TYPPRICE, FLOAT_WCLPRICE,
+   FLOAT_SMA, FLOAT_EMA
+} TA_FloatFunc;
+
+typedef struct
+{
+   TA_FloatFunc func;
+   const char *name;
+   int period;
+   double maxError; /* In u*M (see ta_func_ext.h), 0 when exact. */
+} TA_FloatTest;
+
+static TA_FloatTest tableTest[] =
+{
+   { FLOAT_ADD,      "ADD",      0,   0.0 },
+   { FLOAT_SUB,      "SUB",      0,   0.0 },
+   { FLOAT_MULT,     "MULT",     0,   0.0 },
+   { FLOAT_DIV,      "DIV",      0,   0.0 },
+   { FLOAT_AVGPRICE, "AVGPRICE", 0,   3.0 },
+   { FLOAT_MEDPRICE, "MEDPRICE", 0,   0.0 },
+   { FLOAT_TYPPRICE, "TYPPRICE", 0,   3.0 },
+   { FLOAT_WCLPRICE, "WCLPRICE", 0,   3.0 },
+   { FLOAT_SMA,      "SMA",      2,   2.0 },
+   { FLOAT_SMA,      "SMA",      30,  2.0 },
+   { FLOAT_SMA,      "SMA",      200, 2.0 },
+   { FLOAT_EMA,      "EMA",      2,   2.0 },
+   { FLOAT_EMA,      "EMA",      30,  2.0 },
+   { FLOAT_EMA,      "EMA",      200, 2.0 }
+};
+
+#define NB_TEST (sizeof(tableTest)/sizeof(TA_FloatTest))
+
+/* Same panel as test_panel.c */
+#define NB_SYMBOL 13
+#define STRIDE    16
+#define SHIFT     3
+
+typedef struct
+{
+   int nbBars;
+   float *open, *high, *low, *close;
+   float *outFloat;
+   double *outDouble;
+} TA_FloatInputs;
+
+/**** Local functions declarations.    ****/
+static ErrorNumber doTest( const TA_FloatTest *test, const TA_FloatInputs *in,
+                           int startIdx, int endIdx );
+static TA_RetCode callFunc( const TA_FloatTest *test, const TA_FloatInputs *in,
+                            int startIdx, int endIdx, const float *inReal,
+                            int *outBegIdx, int *outNBElement,
+                            float *outFloat, double *outDouble );
+static ErrorNumber testPanel( const TA_FloatInputs *in, int period );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_float( TA_History *history )
+{
+   ErrorNumber retValue;
+   TA_FloatInputs in;
+   float *buffer;
+   int i, k, nbBars;
+
+   nbBars = (int)history->nbBars;
+   buffer = (float *)malloc( sizeof(float)*6*nbBars+sizeof(double)*nbBars );
+   if( !buffer )
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+
+   in.nbBars    = nbBars;
+   in.outDouble = (double *)buffer;
+   in.open      = &buffer[2*nbBars];
+   in.high      = &buffer[3*nbBars];
+   in.low       = &buffer[4*nbBars];
+   in.close     = &buffer[5*nbBars];
+   in.outFloat  = &buffer[6*nbBars];
+
+   for( i=0; i < nbBars; i++ )
+   {
+      in.open[i]  = (float)history->open[i];
+      in.high[i]  = (float)history->high[i];
+      in.low[i]   = (float)history->low[i];
+      in.close[i] = (float)history->close[i];
+   }
+
+   retValue = TA_TEST_PASS;
+   for( k=0; (k < 2) && (retValue == TA_TEST_PASS); k++ )
+   {
+      TA_SetCompatibility( k == 0? TA_COMPATIBILITY_DEFAULT : TA_COMPATIBILITY_METASTOCK );
+
+      for( i=0; (i < (int)NB_TEST) && (retValue == TA_TEST_PASS); i++ )
+      {
+         retValue = doTest( &tableTest[i], &in, 0, nbBars-1 );
+         if( retValue == TA_TEST_PASS )
+            retValue = doTest( &tableTest[i], &in, 50, 150 );
+      }
+
+      if( retValue == TA_TEST_PASS )
+         retValue = testPanel( &in, 2 );
+      if( retValue == TA_TEST_PASS )
+         retValue = testPanel( &in, 30 );
+   }
+   TA_SetCompatibility( TA_COMPATIBILITY_DEFAULT );
+
+   free( buffer );
+
+   return retValue;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber doTest( const TA_FloatTest *test, const TA_FloatInputs *in,
+                           int startIdx, int endIdx )
+{
+   TA_RetCode retCode;
+   int outBegIdx, outNBElement, refBegIdx, refNBElement;
+   int i, j, fail;
+   double maxInput;
+
+   retCode = callFunc( test, in, startIdx, endIdx, in->close,
+                       &outBegIdx, &outNBElement, in->outFloat, NULL );
+   if( retCode == TA_SUCCESS )
+      retCode = callFunc( test, in, startIdx, endIdx, in->close,
+                          &refBegIdx, &refNBElement, NULL, in->outDouble );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Fail: TA_F_%s period %d returned %d\n", test->name, test->period, retCode );
+      return TA_TEST_FLOAT_CALL_FAILED;
+   }
+
+   if( (outBegIdx != refBegIdx) || (outNBElement != refNBElement) )
+   {
+      printf( "Fail: TA_F_%s period %d begIdx %d/%d nbElement %d/%d\n",
+              test->name, test->period, outBegIdx, refBegIdx,
+              outNBElement, refNBElement );
+      return TA_TEST_FLOAT_NOT_SAME;
+   }
+
+   /* M is the largest input from the start of the calculation,
+    * which is larger than needed for some functions.
+    */
+   maxInput = 0.0;
+   for( i=0; i < outNBElement; i++ )
+   {
+      for( j=(i == 0? 0 : outBegIdx+i); j <= outBegIdx+i; j++ )
+      {
+         maxInput = fabs(in->open[j])  > maxInput? fabs(in->open[j])  : maxInput;
+         maxInput = fabs(in->high[j])  > maxInput? fabs(in->high[j])  : maxInput;
+         maxInput = fabs(in->low[j])   > maxInput? fabs(in->low[j])   : maxInput;
+         maxInput = fabs(in->close[j]) > maxInput? fabs(in->close[j]) : maxInput;
+      }
+
+      /* u*M = M*2^-24 */
+      if( test->maxError == 0.0 )
+         fail = (in->outFloat[i] != (float)in->outDouble[i]);
+      else
+         fail = fabs( in->outFloat[i]-in->outDouble[i] ) > test->maxError*ldexp(maxInput,-24);
+
+      if( fail )
+      {
+         printf( "Fail: TA_F_%s period %d output %d (%.9g/%.17g)\n",
+                 test->name, test->period, i, in->outFloat[i], in->outDouble[i] );
+         return TA_TEST_FLOAT_NOT_ACCURATE;
+      }
+   }
+
+   /* The input and output can be the same buffer (outDouble
+    * keeping a copy of the outputs meanwhile).
+    */
+   if( (test->func == FLOAT_SMA) || (test->func == FLOAT_EMA) )
+   {
+      memcpy( in->outDouble, in->outFloat, sizeof(float)*outNBElement );
+      memcpy( in->outFloat, in->close, sizeof(float)*in->nbBars );
+      retCode = callFunc( test, in, startIdx, endIdx, in->outFloat,
+                          &outBegIdx, &outNBElement, in->outFloat, NULL );
+      if( (retCode != TA_SUCCESS) ||
+          (memcmp( in->outFloat, in->outDouble, sizeof(float)*outNBElement ) != 0) )
+      {
+         printf( "Fail: TA_F_%s period %d in the input buffer\n", test->name, test->period );
+         return TA_TEST_FLOAT_NOT_SAME;
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+static TA_RetCode callFunc( const TA_FloatTest *test, const TA_FloatInputs *in,
+                            int startIdx, int endIdx, const float *inReal,
+                            int *outBegIdx, int *outNBElement,
+                            float *outFloat, double *outDouble )
+{
+   const float *o, *h, *l, *c;
+
+   o = in->open;
+   h = in->high;
+   l = in->low;
+   c = in->close;
+
+   /* TA_F_XXX when outFloat is provided, else TA_S_XXX. */
+   switch( test->func )
+   {
+   case FLOAT_ADD:
+      return outFloat? TA_F_ADD( startIdx, endIdx, h, l, outBegIdx, outNBElement, outFloat ) :
+                       TA_S_ADD( startIdx, endIdx, h, l, outBegIdx, outNBElement, outDouble );
+   case FLOAT_SUB:
+      return outFloat? TA_F_SUB( startIdx, endIdx, h, l, outBegIdx, outNBElement, outFloat ) :
+                       TA_S_SUB( startIdx, endIdx, h, l, outBegIdx, outNBElement, outDouble );
+   case FLOAT_MULT:
+      return outFloat? TA_F_MULT( startIdx, endIdx, h, l, outBegIdx, outNBElement, outFloat ) :
+                       TA_S_MULT( startIdx, endIdx, h, l, outBegIdx, outNBElement, outDouble );
+   case FLOAT_DIV:
+      return outFloat? TA_F_DIV( startIdx, endIdx, c, o, outBegIdx, outNBElement, outFloat ) :
+                       TA_S_DIV( startIdx, endIdx, c, o, outBegIdx, outNBElement, outDouble );
+   case FLOAT_AVGPRICE:
+      return outFloat? TA_F_AVGPRICE( startIdx, endIdx, o, h, l, c, outBegIdx, outNBElement, outFloat ) :
+                       TA_S_AVGPRICE( startIdx, endIdx, o, h, l, c, outBegIdx, outNBElement, outDouble );
+   case FLOAT_MEDPRICE:
+      return outFloat? TA_F_MEDPRICE( startIdx, endIdx, h, l, outBegIdx, outNBElement, outFloat ) :
+                       TA_S_MEDPRICE( startIdx, endIdx, h, l, outBegIdx, outNBElement, outDouble );
+   case FLOAT_TYPPRICE:
+      return outFloat? TA_F_TYPPRICE( startIdx, endIdx, h, l, c, outBegIdx, outNBElement, outFloat ) :
+                       TA_S_TYPPRICE( startIdx, endIdx, h, l, c, outBegIdx, outNBElement, outDouble );
+   case FLOAT_WCLPRICE:
+      return outFloat? TA_F_WCLPRICE( startIdx, endIdx, h, l, c, outBegIdx, outNBElement, outFloat ) :
+                       TA_S_WCLPRICE( startIdx, endIdx, h, l, c, outBegIdx, outNBElement, outDouble );
+   case FLOAT_SMA:
+      return outFloat? TA_F_SMA( startIdx, endIdx, inReal, test->period, outBegIdx, outNBElement, outFloat ) :
+                       TA_S_SMA( startIdx, endIdx, inReal, test->period, outBegIdx, outNBElement, outDouble );
+   default:
+      return outFloat? TA_F_EMA( startIdx, endIdx, inReal, test->period, outBegIdx, outNBElement, outFloat ) :
+                       TA_S_EMA( startIdx, endIdx, inReal, test->period, outBegIdx, outNBElement, outDouble );
+   }
+}
+
+static ErrorNumber testPanel( const TA_FloatInputs *in, int period )
+{
+   ErrorNumber retValue;
+   TA_RetCode retCode;
+   float *panel, *outPanel, *column, *outRef;
+   int outBegIdx, outNBElement, refBegIdx, refNBElement;
+   int i, s, nbBars;
+
+   nbBars = in->nbBars-SHIFT*(NB_SYMBOL-1);
+   panel = (float *)malloc( sizeof(float)*(2*STRIDE+2)*nbBars );
+   if( !panel )
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+   outPanel = &panel[STRIDE*nbBars];
+   column   = &panel[2*STRIDE*nbBars];
+   outRef   = &column[nbBars];
+
+   for( i=0; i < nbBars; i++ )
+   {
+      for( s=0; s < STRIDE; s++ )
+         panel[i*STRIDE+s] = in->close[i+SHIFT*(s%NB_SYMBOL)];
+   }
+
+   retValue = TA_TEST_PASS;
+   retCode = TA_F_EMA_PANEL( 0, nbBars-1, NB_SYMBOL, STRIDE, panel, period,
+                             &outBegIdx, &outNBElement, outPanel );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Fail: TA_F_EMA_PANEL period %d returned %d\n", period, retCode );
+      retValue = TA_TEST_FLOAT_CALL_FAILED;
+   }
+
+   for( s=0; (s < NB_SYMBOL) && (retValue == TA_TEST_PASS); s++ )
+   {
+      for( i=0; i < nbBars; i++ )
+         column[i] = panel[i*STRIDE+s];
+
+      retCode = TA_F_EMA( 0, nbBars-1, column, period, &refBegIdx, &refNBElement, outRef );
+      if( (retCode != TA_SUCCESS) || (outBegIdx != refBegIdx) || (outNBElement != refNBElement) )
+      {
+         printf( "Fail: TA_F_EMA_PANEL period %d begIdx %d/%d nbElement %d/%d\n",
+                 period, outBegIdx, refBegIdx, outNBElement, refNBElement );
+         retValue = TA_TEST_FLOAT_NOT_SAME;
+         break;
+      }
+
+      for( i=0; i < outNBElement; i++ )
+      {
+         if( memcmp( &outPanel[i*STRIDE+s], &outRef[i], sizeof(float) ) != 0 )
+         {
+            printf( "Fail: TA_F_EMA_PANEL period %d symbol %d output %d (%.9g/%.9g)\n",
+                    period, s, i, outPanel[i*STRIDE+s], outRef[i] );
+            retValue = TA_TEST_FLOAT_NOT_SAME;
+            break;
+         }
+      }
+   }
+
+   free( panel );
+
+   return retValue;
+}
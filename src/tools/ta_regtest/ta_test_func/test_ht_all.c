@@ -0,0 +1,329 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ *  101826 MF   Outputs must be identical, also with default unstable periods.
+ *
+ */
+
+/* Description:
+ *     Test TA_HT_ALL against HT_DCPERIOD, HT_DCPHASE, HT_PHASOR,
+ *     HT_SINE, HT_TRENDLINE, HT_TRENDMODE and MAMA.
+ *
+ *     Every output must be identical to the one of its individual
+ *     function with the same unstable periods, including the default
+ *     ones (all 0).
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+
+/* The double outputs, in the same order as the TA_HT_ALL parameters
+ * (outTrendMode is handled separately).
+ */
+enum
+{
+   OUT_DCPERIOD,
+   OUT_DCPHASE,
+   OUT_INPHASE,
+   OUT_QUADRATURE,
+   OUT_SINE,
+   OUT_LEADSINE,
+   OUT_TRENDLINE,
+   OUT_MAMA,
+   OUT_FAMA,
+   NB_OUTPUT
+};
+
+typedef struct
+{
+   TA_Integer startIdx;
+   TA_Integer unstablePhase;  /* HT_DCPHASE, HT_SINE, HT_TRENDLINE, HT_TRENDMODE */
+   TA_Integer unstablePeriod; /* HT_DCPERIOD, HT_PHASOR, MAMA */
+} TA_Test;
+
+/**** Local functions declarations.    ****/
+static ErrorNumber do_test( const TA_History *history,
+                            const TA_Test *test,
+                            int useFloat );
+
+/**** Local variables definitions.     ****/
+static TA_Test tableTest[] =
+{
+   { 0,   0,  0  },
+   { 63,  0,  0  },
+   { 100, 0,  0  },
+   { 0,   10, 16 },
+   { 0,   10, 3  },
+   { 251, 10, 0  },
+   { 0,   0,  40 }
+};
+
+#define NB_TEST (sizeof(tableTest)/sizeof(TA_Test))
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_ht_all( TA_History *history )
+{
+   unsigned int i;
+   ErrorNumber retValue;
+
+   for( i=0; i < NB_TEST; i++ )
+   {
+      retValue = do_test( history, &tableTest[i], 0 );
+      if( retValue == TA_TEST_PASS )
+         retValue = do_test( history, &tableTest[i], 1 );
+
+      if( retValue != TA_TEST_PASS )
+      {
+         printf( "Failed HT_ALL Test #%d (Code=%d)\n", i, retValue );
+         TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+         return retValue;
+      }
+   }
+
+   TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+
+   /* All test succeed. */
+   return TA_TEST_PASS;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber do_test( const TA_History *history,
+                            const TA_Test *test,
+                            int useFloat )
+{
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   double *out[NB_OUTPUT], *outAll[NB_OUTPUT], *inCopy;
+   int *trendMode, *trendModeAll;
+   float *inFloat;
+   int outBegIdx, outNBElement, begIdx, nbElement;
+   int startIdx, endIdx, nbBars, i, j;
+
+   nbBars = (int)history->nbBars;
+   endIdx = nbBars-1;
+
+   TA_SetUnstablePeriod( TA_FUNC_UNST_HT_DCPHASE,    test->unstablePhase );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_HT_SINE,       test->unstablePhase );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_HT_TRENDLINE,  test->unstablePhase );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_HT_TRENDMODE,  test->unstablePhase );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_HT_DCPERIOD,   test->unstablePeriod );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_HT_PHASOR,     test->unstablePeriod );
+   TA_SetUnstablePeriod( TA_FUNC_UNST_MAMA,          test->unstablePeriod );
+
+   /* All the functions are called from the first output of
+    * TA_HT_ALL, so they must all start at the same bar.
+    */
+   startIdx = TA_HT_ALL_Lookback( TA_REAL_DEFAULT, TA_REAL_DEFAULT );
+   i = TA_HT_TRENDMODE_Lookback();
+   if( TA_MAMA_Lookback( TA_REAL_DEFAULT, TA_REAL_DEFAULT ) > i )
+      i = TA_MAMA_Lookback( TA_REAL_DEFAULT, TA_REAL_DEFAULT );
+   if( startIdx != i )
+      return TA_TEST_HT_ALL_CALL_FAILED;
+   if( startIdx < test->startIdx )
+      startIdx = test->startIdx;
+
+   inCopy       = (double *)malloc( sizeof(double)*nbBars*(2*NB_OUTPUT+1) );
+   trendMode    = (int *)malloc( sizeof(int)*nbBars*2 );
+   inFloat      = (float *)malloc( sizeof(float)*nbBars );
+   if( !inCopy || !trendMode || !inFloat )
+   {
+      free( inCopy );
+      free( trendMode );
+      free( inFloat );
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+   }
+   trendModeAll = &trendMode[nbBars];
+
+   for( j=0; j < NB_OUTPUT; j++ )
+   {
+      out[j]    = &inCopy[nbBars*(j+1)];
+      outAll[j] = &inCopy[nbBars*(j+1+NB_OUTPUT)];
+   }
+
+   for( i=0; i < nbBars; i++ )
+      inFloat[i] = (float)history->close[i];
+
+   retValue = TA_TEST_PASS;
+
+   #define CHECK_CALL(x) \
+      { \
+         retCode = x; \
+         if( (retCode != TA_SUCCESS) || \
+             ((j>0) && ((outBegIdx != begIdx) || (outNBElement != nbElement))) ) \
+         { \
+            printf( "Call %d failed (%d)\n", j, retCode ); \
+            retValue = TA_TEST_HT_ALL_CALL_FAILED; \
+            goto cleanup; \
+         } \
+         begIdx = outBegIdx; \
+         nbElement = outNBElement; \
+      }
+
+   /* Calls with the same input type for every function. */
+   #define CALL_1(func,input,...) \
+      (useFloat? TA_S_##func( startIdx, endIdx, inFloat, __VA_ARGS__ ) : \
+                 TA_##func( startIdx, endIdx, input, __VA_ARGS__ ))
+
+   j = 0;
+   CHECK_CALL( CALL_1( HT_DCPERIOD, history->close, &outBegIdx, &outNBElement, out[OUT_DCPERIOD] ) );
+   j++;
+   CHECK_CALL( CALL_1( HT_DCPHASE, history->close, &outBegIdx, &outNBElement, out[OUT_DCPHASE] ) );
+   j++;
+   CHECK_CALL( CALL_1( HT_PHASOR, history->close, &outBegIdx, &outNBElement,
+                       out[OUT_INPHASE], out[OUT_QUADRATURE] ) );
+   j++;
+   CHECK_CALL( CALL_1( HT_SINE, history->close, &outBegIdx, &outNBElement,
+                       out[OUT_SINE], out[OUT_LEADSINE] ) );
+   j++;
+   CHECK_CALL( CALL_1( HT_TRENDLINE, history->close, &outBegIdx, &outNBElement, out[OUT_TRENDLINE] ) );
+   j++;
+   CHECK_CALL( CALL_1( HT_TRENDMODE, history->close, &outBegIdx, &outNBElement, trendMode ) );
+   j++;
+   CHECK_CALL( CALL_1( MAMA, history->close, 0.5, 0.05, &outBegIdx, &outNBElement,
+                       out[OUT_MAMA], out[OUT_FAMA] ) );
+   j++;
+   CHECK_CALL( CALL_1( HT_ALL, history->close, 0.5, 0.05, &outBegIdx, &outNBElement,
+                       outAll[OUT_DCPERIOD], outAll[OUT_DCPHASE],
+                       outAll[OUT_INPHASE], outAll[OUT_QUADRATURE],
+                       outAll[OUT_SINE], outAll[OUT_LEADSINE],
+                       outAll[OUT_TRENDLINE], trendModeAll,
+                       outAll[OUT_MAMA], outAll[OUT_FAMA] ) );
+
+   if( nbElement <= 0 )
+   {
+      retValue = TA_TEST_HT_ALL_CALL_FAILED;
+      goto cleanup;
+   }
+
+   for( j=0; j < NB_OUTPUT; j++ )
+   {
+      for( i=0; i < nbElement; i++ )
+      {
+         if( out[j][i] != outAll[j][i] )
+         {
+            printf( "Output %d at bar %d is %.17g but expected %.17g\n",
+                    j, begIdx+i, outAll[j][i], out[j][i] );
+            retValue = TA_TEST_HT_ALL_NOT_SAME;
+            goto cleanup;
+         }
+      }
+   }
+
+   if( memcmp( trendMode, trendModeAll, sizeof(int)*nbElement ) != 0 )
+   {
+      printf( "TA_HT_ALL trend mode not the same\n" );
+      retValue = TA_TEST_HT_ALL_NOT_SAME;
+      goto cleanup;
+   }
+
+   /* Skipping the dominant cycle phase must not change the other
+    * outputs. The input and output can be the same buffer.
+    */
+   memcpy( inCopy, history->close, sizeof(double)*nbBars );
+   j = 1;
+   CHECK_CALL( CALL_1( HT_ALL, inCopy, 0.5, 0.05, &outBegIdx, &outNBElement,
+                       out[OUT_DCPERIOD], NULL, NULL, out[OUT_QUADRATURE],
+                       NULL, NULL, NULL, NULL, NULL, inCopy ) );
+   if( (memcmp( out[OUT_DCPERIOD], outAll[OUT_DCPERIOD], sizeof(double)*nbElement ) != 0) ||
+       (memcmp( out[OUT_QUADRATURE], outAll[OUT_QUADRATURE], sizeof(double)*nbElement ) != 0) ||
+       (!useFloat && (memcmp( inCopy, outAll[OUT_FAMA], sizeof(double)*nbElement ) != 0)) )
+   {
+      printf( "TA_HT_ALL output not the same with a subset of the outputs\n" );
+      retValue = TA_TEST_HT_ALL_NOT_SAME;
+      goto cleanup;
+   }
+
+   /* With all the outputs, the pass writing over the input must be
+    * done after the pass reading it from an earlier bar.
+    */
+   if( !useFloat )
+   {
+      memcpy( inCopy, history->close, sizeof(double)*nbBars );
+      j = 1;
+      CHECK_CALL( TA_HT_ALL( startIdx, endIdx, inCopy, 0.5, 0.05, &outBegIdx, &outNBElement,
+                             out[OUT_DCPERIOD], out[OUT_DCPHASE],
+                             out[OUT_INPHASE], out[OUT_QUADRATURE],
+                             out[OUT_SINE], out[OUT_LEADSINE],
+                             out[OUT_TRENDLINE], trendMode,
+                             inCopy, out[OUT_FAMA] ) );
+      memcpy( out[OUT_MAMA], inCopy, sizeof(double)*nbElement );
+      for( j=0; j < NB_OUTPUT; j++ )
+      {
+         if( memcmp( out[j], outAll[j], sizeof(double)*nbElement ) != 0 )
+         {
+            printf( "TA_HT_ALL output %d not the same when written over the input\n", j );
+            retValue = TA_TEST_HT_ALL_NOT_SAME;
+            goto cleanup;
+         }
+      }
+   }
+
+   #undef CALL_1
+   #undef CHECK_CALL
+
+cleanup:
+   free( inCopy );
+   free( trendMode );
+   free( inFloat );
+
+   return retValue;
+}
@@ -0,0 +1,322 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ *
+ */
+
+/* Description:
+ *     Test LINEARREG, LINEARREG_SLOPE, LINEARREG_INTERCEPT,
+ *     LINEARREG_ANGLE, TSF and TA_LINEARREG_ALL.
+ *
+ *     The incrementally updated sums are verified against a
+ *     straightforward re-calculation of the regression for
+ *     every output. TA_LINEARREG_ALL must be identical to
+ *     the individual functions.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+#define NB_OUTPUT 5
+
+typedef struct
+{
+   TA_Integer startIdx;
+   TA_Integer optInTimePeriod;
+} TA_Test;
+
+/**** Local functions declarations.    ****/
+static ErrorNumber do_test( const TA_History *history,
+                            const TA_Test *test );
+
+static void calcReference( const double *inReal, int today,
+                           int period, double out[NB_OUTPUT] );
+
+/**** Local variables definitions.     ****/
+static TA_Test tableTest[] =
+{
+   { 0,   2   },
+   { 0,   3   },
+   { 0,   14  },
+   { 5,   14  },
+   { 100, 14  },
+   { 0,   50  },
+   { 0,   200 },
+   { 251, 200 },
+   { 0,   252 }
+};
+
+#define NB_TEST (sizeof(tableTest)/sizeof(TA_Test))
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_linearreg( TA_History *history )
+{
+   unsigned int i;
+   ErrorNumber retValue;
+
+   for( i=0; i < NB_TEST; i++ )
+   {
+      retValue = do_test( history, &tableTest[i] );
+      if( retValue != 0 )
+      {
+         printf( "Failed LINEARREG Test #%d (Code=%d)\n", i, retValue );
+         return retValue;
+      }
+   }
+
+   /* All test succeed. */
+   return TA_TEST_PASS;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber do_test( const TA_History *history,
+                            const TA_Test *test )
+{
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   double *out[NB_OUTPUT], *outAll[NB_OUTPUT], *inCopy;
+   float *inFloat;
+   double ref[NB_OUTPUT];
+   int outBegIdx, outNBElement, begIdx, nbElement;
+   int endIdx, nbBars, i, j;
+
+   nbBars = (int)history->nbBars;
+   endIdx = nbBars-1;
+
+   inCopy  = (double *)malloc( sizeof(double)*nbBars*(2*NB_OUTPUT+1) );
+   inFloat = (float *)malloc( sizeof(float)*nbBars );
+   if( !inCopy || !inFloat )
+   {
+      free( inCopy );
+      free( inFloat );
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+   }
+
+   for( j=0; j < NB_OUTPUT; j++ )
+   {
+      out[j]    = &inCopy[nbBars*(j+1)];
+      outAll[j] = &inCopy[nbBars*(j+1+NB_OUTPUT)];
+   }
+
+   for( i=0; i < nbBars; i++ )
+      inFloat[i] = (float)history->close[i];
+
+   retValue = TA_TEST_PASS;
+
+   #define CHECK_CALL(x) \
+      { \
+         retCode = x; \
+         if( (retCode != TA_SUCCESS) || \
+             ((j>0) && ((outBegIdx != begIdx) || (outNBElement != nbElement))) ) \
+         { \
+            printf( "Call %d failed (%d)\n", j, retCode ); \
+            retValue = TA_TEST_LINEARREG_CALL_FAILED; \
+            goto cleanup; \
+         } \
+         begIdx = outBegIdx; \
+         nbElement = outNBElement; \
+      }
+
+   /* Double precision input. */
+   j = 0;
+   CHECK_CALL( TA_LINEARREG( test->startIdx, endIdx, history->close, test->optInTimePeriod,
+                             &outBegIdx, &outNBElement, out[0] ) );
+   j++;
+   CHECK_CALL( TA_LINEARREG_SLOPE( test->startIdx, endIdx, history->close, test->optInTimePeriod,
+                                   &outBegIdx, &outNBElement, out[1] ) );
+   j++;
+   CHECK_CALL( TA_LINEARREG_INTERCEPT( test->startIdx, endIdx, history->close, test->optInTimePeriod,
+                                       &outBegIdx, &outNBElement, out[2] ) );
+   j++;
+   CHECK_CALL( TA_LINEARREG_ANGLE( test->startIdx, endIdx, history->close, test->optInTimePeriod,
+                                   &outBegIdx, &outNBElement, out[3] ) );
+   j++;
+   CHECK_CALL( TA_TSF( test->startIdx, endIdx, history->close, test->optInTimePeriod,
+                       &outBegIdx, &outNBElement, out[4] ) );
+   j++;
+   CHECK_CALL( TA_LINEARREG_ALL( test->startIdx, endIdx, history->close, test->optInTimePeriod,
+                                 &outBegIdx, &outNBElement,
+                                 outAll[0], outAll[1], outAll[2], outAll[3], outAll[4] ) );
+
+   if( (nbElement <= 0) || (begIdx+nbElement-1 != endIdx) )
+   {
+      retValue = TA_TEST_LINEARREG_CALL_FAILED;
+      goto cleanup;
+   }
+
+   for( i=0; i < nbElement; i++ )
+   {
+      calcReference( history->close, begIdx+i, test->optInTimePeriod, ref );
+      for( j=0; j < NB_OUTPUT; j++ )
+      {
+         if( !TA_REAL_EQ( out[j][i], ref[j], 1e-8 ) )
+         {
+            printf( "Output %d at bar %d is %.17g but expected %.17g\n",
+                    j, begIdx+i, out[j][i], ref[j] );
+            retValue = TA_TEST_LINEARREG_BAD_VALUE;
+            goto cleanup;
+         }
+      }
+   }
+
+   for( j=0; j < NB_OUTPUT; j++ )
+   {
+      if( memcmp( out[j], outAll[j], sizeof(double)*nbElement ) != 0 )
+      {
+         printf( "TA_LINEARREG_ALL output %d not the same\n", j );
+         retValue = TA_TEST_LINEARREG_NOT_SAME;
+         goto cleanup;
+      }
+   }
+
+   /* The input and output can be the same buffer. */
+   memcpy( inCopy, history->close, sizeof(double)*nbBars );
+   j = 1;
+   CHECK_CALL( TA_TSF( test->startIdx, endIdx, inCopy, test->optInTimePeriod,
+                       &outBegIdx, &outNBElement, inCopy ) );
+   if( memcmp( inCopy, out[4], sizeof(double)*nbElement ) != 0 )
+   {
+      printf( "TA_TSF output not the same when in-place\n" );
+      retValue = TA_TEST_LINEARREG_NOT_SAME;
+      goto cleanup;
+   }
+
+   memcpy( inCopy, history->close, sizeof(double)*nbBars );
+   CHECK_CALL( TA_LINEARREG_ALL( test->startIdx, endIdx, inCopy, test->optInTimePeriod,
+                                 &outBegIdx, &outNBElement,
+                                 NULL, outAll[1], NULL, inCopy, NULL ) );
+   if( (memcmp( inCopy, out[3], sizeof(double)*nbElement ) != 0) ||
+       (memcmp( outAll[1], out[1], sizeof(double)*nbElement ) != 0) )
+   {
+      printf( "TA_LINEARREG_ALL output not the same when in-place\n" );
+      retValue = TA_TEST_LINEARREG_NOT_SAME;
+      goto cleanup;
+   }
+
+   /* Single precision input. */
+   j = 0;
+   CHECK_CALL( TA_S_LINEARREG( test->startIdx, endIdx, inFloat, test->optInTimePeriod,
+                               &outBegIdx, &outNBElement, out[0] ) );
+   j++;
+   CHECK_CALL( TA_S_LINEARREG_SLOPE( test->startIdx, endIdx, inFloat, test->optInTimePeriod,
+                                     &outBegIdx, &outNBElement, out[1] ) );
+   j++;
+   CHECK_CALL( TA_S_LINEARREG_INTERCEPT( test->startIdx, endIdx, inFloat, test->optInTimePeriod,
+                                         &outBegIdx, &outNBElement, out[2] ) );
+   j++;
+   CHECK_CALL( TA_S_LINEARREG_ANGLE( test->startIdx, endIdx, inFloat, test->optInTimePeriod,
+                                     &outBegIdx, &outNBElement, out[3] ) );
+   j++;
+   CHECK_CALL( TA_S_TSF( test->startIdx, endIdx, inFloat, test->optInTimePeriod,
+                         &outBegIdx, &outNBElement, out[4] ) );
+   j++;
+   CHECK_CALL( TA_S_LINEARREG_ALL( test->startIdx, endIdx, inFloat, test->optInTimePeriod,
+                                   &outBegIdx, &outNBElement,
+                                   outAll[0], outAll[1], outAll[2], outAll[3], outAll[4] ) );
+
+   for( j=0; j < NB_OUTPUT; j++ )
+   {
+      if( memcmp( out[j], outAll[j], sizeof(double)*nbElement ) != 0 )
+      {
+         printf( "TA_S_LINEARREG_ALL output %d not the same\n", j );
+         retValue = TA_TEST_LINEARREG_NOT_SAME;
+         goto cleanup;
+      }
+   }
+
+   #undef CHECK_CALL
+
+cleanup:
+   free( inCopy );
+   free( inFloat );
+
+   return retValue;
+}
+
+/* Regression calculated over the whole period for every output. */
+static void calcReference( const double *inReal, int today,
+                           int period, double out[NB_OUTPUT] )
+{
+   double SumX, SumXSqr, SumXY, SumY, Divisor, m, b;
+   int i;
+
+   SumX = period * ( period - 1 ) * 0.5;
+   SumXSqr = period * ( period - 1 ) * ( 2 * period - 1 ) / 6;
+   Divisor = SumX * SumX - period * SumXSqr;
+
+   SumXY = 0.0;
+   SumY = 0.0;
+   for( i = period; i-- != 0; )
+   {
+      SumY += inReal[today - i];
+      SumXY += (double)i * inReal[today - i];
+   }
+
+   m = ( period * SumXY - SumX * SumY) / Divisor;
+   b = ( SumY - m * SumX ) / (double)period;
+
+   out[0] = b + m * (double)(period-1);
+   out[1] = m;
+   out[2] = b;
+   out[3] = atan(m) * ( 180.0 / PI );
+   out[4] = b + m * (double)period;
+}
@@ -44,6 +44,7 @@
  *  -------------------------------------------------------------------
  *  112400 MF   First version.
  *  031707 MF   Add TA_MAVP tests.
+ *  101826 MF   Add TA_MAVP test with a period changing at every bar.
  */
 
 /* Description:
@@ -110,6 +111,7 @@ typedef struct
 static ErrorNumber do_test_ma( const TA_History *history,
                                const TA_Test *test,
 							   int testMAVP /* Boolean */ );
+static ErrorNumber do_test_mavp_variable( const TA_History *history );
 
 /**** Local variables definitions.     ****/
 
@@ -398,6 +400,13 @@ ErrorNumber test_func_ma( TA_History *history )
 	  }
    }
 
+   retValue = do_test_mavp_variable( history );
+   if( retValue != 0 )
+   {
+      printf( "TA_MAVP Failed Variable Period Test (Code=%d)\n", retValue );
+      return retValue;
+   }
+
    /* Re-initialize all the unstable period to zero. */
    TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
 
@@ -814,3 +823,75 @@ static ErrorNumber do_test_ma( const TA_History *history,
    return TA_TEST_PASS;
 }
 
+/* Every output of TA_MAVP must be the TA_MA with the period
+ * of that bar, as if TA_MA was called with the same startIdx.
+ */
+static ErrorNumber do_test_mavp_variable( const TA_History *history )
+{
+   TA_RetCode retCode;
+   TA_Integer outBegIdx, outNbElement;
+   TA_Integer maBegIdx, maNbElement;
+   TA_Real *periods, *out, *maOut;
+   ErrorNumber errNb;
+   int maType, i, period;
+
+   periods = (TA_Real *)TA_Malloc( sizeof(TA_Real)*history->nbBars );
+   out     = (TA_Real *)TA_Malloc( sizeof(TA_Real)*history->nbBars );
+   maOut   = (TA_Real *)TA_Malloc( sizeof(TA_Real)*history->nbBars );
+   if( !periods || !out || !maOut )
+   {
+      FREE_IF_NOT_NULL( periods );
+      FREE_IF_NOT_NULL( out );
+      FREE_IF_NOT_NULL( maOut );
+      return TA_TEST_MAVP_CALL_FAILED;
+   }
+
+   /* Periods from 1 to 31, clipped by TA_MAVP to 2..30 */
+   for( i=0; i < (int)history->nbBars; i++ )
+      periods[i] = (TA_Real)(1+((i*7)%31));
+
+   errNb = TA_TEST_PASS;
+   for( maType=TA_MAType_SMA; (maType <= TA_MAType_T3) && (errNb == TA_TEST_PASS); maType++ )
+   {
+      retCode = TA_MAVP( 0, history->nbBars-1, history->close, periods,
+                         2, 30, (TA_MAType)maType,
+                         &outBegIdx, &outNbElement, out );
+      if( (retCode != TA_SUCCESS) || (outNbElement <= 0) )
+      {
+         errNb = TA_TEST_MAVP_CALL_FAILED;
+         break;
+      }
+
+      for( i=0; i < outNbElement; i++ )
+      {
+         period = (int)periods[outBegIdx+i];
+         if( period < 2 )
+            period = 2;
+         else if( period > 30 )
+            period = 30;
+
+         retCode = TA_MA( outBegIdx, outBegIdx+i, history->close,
+                          period, (TA_MAType)maType,
+                          &maBegIdx, &maNbElement, maOut );
+         if( (retCode != TA_SUCCESS) || (maNbElement != i+1) )
+         {
+            errNb = TA_TEST_MAVP_CALL_FAILED;
+            break;
+         }
+
+         if( !TA_REAL_EQ( out[i], maOut[i], 1e-8 ) )
+         {
+            printf( "Fail: MAType=%d bar %d: %g != %g\n",
+                    maType, outBegIdx+i, out[i], maOut[i] );
+            errNb = TA_TEST_MAVP_BAD_VALUE;
+            break;
+         }
+      }
+   }
+
+   TA_Free( periods );
+   TA_Free( out );
+   TA_Free( maOut );
+
+   return errNb;
+}
@@ -0,0 +1,306 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ *
+ */
+
+/* Description:
+ *     Test TA_MA_MULTI against TA_MA called for each period,
+ *     and TA_TRIX_MULTI against TA_TRIX.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef struct
+{
+   TA_Integer startIdx;
+   TA_Integer endIdx;
+   TA_MAType  optInMAType;
+   TA_Integer doTrix; /* When set, test TA_TRIX_MULTI instead. */
+
+   TA_Integer unstablePeriod; /* For the EMA and the T3. */
+   TA_Compatibility compatibility;
+} TA_Test;
+
+/**** Local functions declarations.    ****/
+static ErrorNumber do_test( const TA_History *history,
+                            const TA_Test *test,
+                            int useFloat );
+
+/**** Local variables definitions.     ****/
+
+/* A period longer than the history gives an empty row. */
+static const int periods[] = { 1, 2, 3, 4, 5, 14, 30, 31, 100, 251, 252, 400, TA_INTEGER_DEFAULT };
+
+#define NB_PERIOD ((int)(sizeof(periods)/sizeof(int)))
+
+static TA_Test tableTest[] =
+{
+   { 0,   251, TA_MAType_SMA,   0, 0,  TA_COMPATIBILITY_DEFAULT },
+   { 0,   251, TA_MAType_WMA,   0, 0,  TA_COMPATIBILITY_DEFAULT },
+   { 0,   251, TA_MAType_TRIMA, 0, 0,  TA_COMPATIBILITY_DEFAULT },
+   { 20,  200, TA_MAType_SMA,   0, 0,  TA_COMPATIBILITY_DEFAULT },
+   { 20,  200, TA_MAType_WMA,   0, 0,  TA_COMPATIBILITY_DEFAULT },
+   { 20,  200, TA_MAType_TRIMA, 0, 0,  TA_COMPATIBILITY_DEFAULT },
+   { 251, 251, TA_MAType_WMA,   0, 0,  TA_COMPATIBILITY_DEFAULT },
+   { 251, 251, TA_MAType_TRIMA, 0, 0,  TA_COMPATIBILITY_DEFAULT },
+
+   /* The EMA family must be identical to the function called alone. */
+   { 0,   251, TA_MAType_EMA,   0, 0,  TA_COMPATIBILITY_DEFAULT },
+   { 0,   251, TA_MAType_DEMA,  0, 0,  TA_COMPATIBILITY_DEFAULT },
+   { 0,   251, TA_MAType_TEMA,  0, 0,  TA_COMPATIBILITY_DEFAULT },
+   { 0,   251, TA_MAType_T3,    0, 0,  TA_COMPATIBILITY_DEFAULT },
+   { 0,   251, TA_MAType_EMA,   1, 0,  TA_COMPATIBILITY_DEFAULT },
+   { 20,  200, TA_MAType_EMA,   0, 0,  TA_COMPATIBILITY_DEFAULT },
+   { 20,  200, TA_MAType_DEMA,  0, 0,  TA_COMPATIBILITY_DEFAULT },
+   { 20,  200, TA_MAType_TEMA,  0, 0,  TA_COMPATIBILITY_DEFAULT },
+   { 100, 251, TA_MAType_T3,    0, 0,  TA_COMPATIBILITY_DEFAULT },
+   { 100, 200, TA_MAType_EMA,   1, 0,  TA_COMPATIBILITY_DEFAULT },
+   { 251, 251, TA_MAType_TEMA,  0, 0,  TA_COMPATIBILITY_DEFAULT },
+   { 0,   251, TA_MAType_DEMA,  0, 7,  TA_COMPATIBILITY_DEFAULT },
+   { 50,  251, TA_MAType_TEMA,  0, 7,  TA_COMPATIBILITY_DEFAULT },
+   { 50,  251, TA_MAType_T3,    0, 7,  TA_COMPATIBILITY_DEFAULT },
+   { 80,  251, TA_MAType_EMA,   1, 7,  TA_COMPATIBILITY_DEFAULT },
+   { 0,   251, TA_MAType_EMA,   0, 0,  TA_COMPATIBILITY_METASTOCK },
+   { 50,  251, TA_MAType_DEMA,  0, 0,  TA_COMPATIBILITY_METASTOCK },
+   { 50,  251, TA_MAType_TEMA,  0, 3,  TA_COMPATIBILITY_METASTOCK },
+   { 0,   251, TA_MAType_EMA,   1, 0,  TA_COMPATIBILITY_METASTOCK },
+   { 60,  251, TA_MAType_EMA,   1, 3,  TA_COMPATIBILITY_METASTOCK }
+};
+
+#define NB_TEST (sizeof(tableTest)/sizeof(TA_Test))
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_ma_multi( TA_History *history )
+{
+   unsigned int i;
+   ErrorNumber retValue;
+   int outBegIdx[NB_PERIOD], outNBElement[NB_PERIOD];
+   double out[NB_PERIOD];
+
+   for( i=0; i < NB_TEST; i++ )
+   {
+      TA_SetUnstablePeriod( TA_FUNC_UNST_EMA, tableTest[i].unstablePeriod );
+      TA_SetUnstablePeriod( TA_FUNC_UNST_T3, tableTest[i].unstablePeriod );
+      TA_SetCompatibility( tableTest[i].compatibility );
+
+      retValue = do_test( history, &tableTest[i], 0 );
+      if( retValue == TA_TEST_PASS )
+         retValue = do_test( history, &tableTest[i], 1 );
+
+      TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+      TA_SetCompatibility( TA_COMPATIBILITY_DEFAULT );
+
+      if( retValue != TA_TEST_PASS )
+      {
+         printf( "Failed MA_MULTI Test #%d (Code=%d)\n", i, retValue );
+         return retValue;
+      }
+   }
+
+   /* The KAMA and MAMA are not supported. */
+   if( TA_MA_MULTI( 0, 0, history->close, periods, NB_PERIOD, TA_MAType_MAMA,
+                    outBegIdx, outNBElement, out ) != TA_BAD_PARAM )
+   {
+      printf( "TA_MA_MULTI should fail with MAMA\n" );
+      return TA_TEST_MA_MULTI_CALL_FAILED;
+   }
+
+   /* Same as TA_TRIX, the period 1 is not supported. */
+   if( TA_TRIX_MULTI( 0, 0, history->close, periods, NB_PERIOD,
+                      outBegIdx, outNBElement, out ) != TA_BAD_PARAM )
+   {
+      printf( "TA_TRIX_MULTI should fail with a period of 1\n" );
+      return TA_TEST_MA_MULTI_CALL_FAILED;
+   }
+
+   /* All test succeed. */
+   return TA_TEST_PASS;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber do_test( const TA_History *history,
+                            const TA_Test *test,
+                            int useFloat )
+{
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   double *out, *outMulti;
+   float *inFloat;
+   int outBegIdx, outNBElement, nbOutput, nbBars, i, k;
+   int outBegIdxMulti[NB_PERIOD], outNBElementMulti[NB_PERIOD];
+   const int *testPeriods;
+   int nbTestPeriod;
+   double epsilon;
+
+   /* The EMA family is calculated the same way, the outputs
+    * must be identical. The TRIX skips the period 1.
+    */
+   testPeriods  = periods;
+   nbTestPeriod = NB_PERIOD;
+   if( test->doTrix )
+   {
+      testPeriods  = &periods[1];
+      nbTestPeriod = NB_PERIOD-1;
+   }
+
+   switch( test->optInMAType )
+   {
+   case TA_MAType_SMA:
+   case TA_MAType_WMA:
+   case TA_MAType_TRIMA:
+      epsilon = 1e-10;
+      break;
+   default:
+      epsilon = 0.0;
+      break;
+   }
+
+   nbBars   = (int)history->nbBars;
+   nbOutput = test->endIdx-test->startIdx+1;
+
+   out     = (double *)malloc( sizeof(double)*nbBars*(NB_PERIOD+1) );
+   inFloat = (float *)malloc( sizeof(float)*nbBars );
+   if( !out || !inFloat )
+   {
+      free( out );
+      free( inFloat );
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+   }
+   outMulti = &out[nbBars];
+
+   for( i=0; i < nbBars; i++ )
+      inFloat[i] = (float)history->close[i];
+
+   retValue = TA_TEST_PASS;
+
+   if( test->doTrix && useFloat )
+      retCode = TA_S_TRIX_MULTI( test->startIdx, test->endIdx, inFloat,
+                                 testPeriods, nbTestPeriod,
+                                 outBegIdxMulti, outNBElementMulti, outMulti );
+   else if( test->doTrix )
+      retCode = TA_TRIX_MULTI( test->startIdx, test->endIdx, history->close,
+                               testPeriods, nbTestPeriod,
+                               outBegIdxMulti, outNBElementMulti, outMulti );
+   else if( useFloat )
+      retCode = TA_S_MA_MULTI( test->startIdx, test->endIdx, inFloat,
+                               testPeriods, nbTestPeriod, test->optInMAType,
+                               outBegIdxMulti, outNBElementMulti, outMulti );
+   else
+      retCode = TA_MA_MULTI( test->startIdx, test->endIdx, history->close,
+                             testPeriods, nbTestPeriod, test->optInMAType,
+                             outBegIdxMulti, outNBElementMulti, outMulti );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_MA_MULTI/TA_TRIX_MULTI failed (%d)\n", retCode );
+      retValue = TA_TEST_MA_MULTI_CALL_FAILED;
+      goto cleanup;
+   }
+
+   for( k=0; k < nbTestPeriod; k++ )
+   {
+      if( test->doTrix && useFloat )
+         retCode = TA_S_TRIX( test->startIdx, test->endIdx, inFloat,
+                              testPeriods[k],
+                              &outBegIdx, &outNBElement, out );
+      else if( test->doTrix )
+         retCode = TA_TRIX( test->startIdx, test->endIdx, history->close,
+                            testPeriods[k],
+                            &outBegIdx, &outNBElement, out );
+      else if( useFloat )
+         retCode = TA_S_MA( test->startIdx, test->endIdx, inFloat,
+                            testPeriods[k], test->optInMAType,
+                            &outBegIdx, &outNBElement, out );
+      else
+         retCode = TA_MA( test->startIdx, test->endIdx, history->close,
+                          testPeriods[k], test->optInMAType,
+                          &outBegIdx, &outNBElement, out );
+      if( (retCode != TA_SUCCESS) ||
+          (outBegIdx != outBegIdxMulti[k]) ||
+          (outNBElement != outNBElementMulti[k]) )
+      {
+         printf( "Period %d: single (%d,%d,%d) and multi (%d,%d) differ\n",
+                 testPeriods[k], retCode, outBegIdx, outNBElement,
+                 outBegIdxMulti[k], outNBElementMulti[k] );
+         retValue = TA_TEST_MA_MULTI_CALL_FAILED;
+         goto cleanup;
+      }
+
+      for( i=0; i < outNBElement; i++ )
+      {
+         if( (epsilon == 0.0)? (outMulti[k*nbOutput+i] != out[i]) :
+                               !TA_REAL_EQ( outMulti[k*nbOutput+i], out[i], epsilon ) )
+         {
+            printf( "Period %d at bar %d is %.17g but expected %.17g\n",
+                    testPeriods[k], outBegIdx+i, outMulti[k*nbOutput+i], out[i] );
+            retValue = TA_TEST_MA_MULTI_NOT_SAME;
+            goto cleanup;
+         }
+      }
+   }
+
+cleanup:
+   free( out );
+   free( inFloat );
+
+   return retValue;
+}
@@ -54,6 +54,7 @@
 /**** Headers ****/
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
 
 #include "ta_test_priv.h"
 #include "ta_test_func.h"
@@ -133,6 +134,13 @@ static TA_RetCode referenceMax( TA_Integer    startIdx,
 
 static ErrorNumber testCompareToReference( const TA_Real *input, int nbElement );
 
+static ErrorNumber testWindowExtreme( const TA_History *history );
+static ErrorNumber testWindowExtremeFunc( const char *name,
+                                          TA_Integer period,
+                                          const TA_Real *high,
+                                          const TA_Real *low,
+                                          const TA_Real *close );
+
 /**** Local variables definitions.     ****/
 
 static TA_Test tableTest[] =
@@ -254,6 +262,23 @@ static TA_RefTest tableRefTest[] =
 
 #define NB_TEST_REF (sizeof(tableRefTest)/sizeof(TA_RefTest))
 
+/* The functions finding the extremes of a sliding window (see
+ * WINDOW_EXTREME_VARIABLES in ta_utility.h). Above a period of 64 the
+ * deque of the window is allocated.
+ */
+static const char *windowFuncName[] =
+{
+   "MAX", "MIN", "MAXINDEX", "MININDEX", "MINMAX", "MINMAXINDEX",
+   "MIDPOINT", "MIDPRICE", "WILLR", "AROON", "AROONOSC", "STOCH", "STOCHF"
+};
+
+static const TA_Integer windowPeriod[] = { 2, 64, 65, 130, 300 };
+
+#define NB_WINDOW_FUNC   (sizeof(windowFuncName)/sizeof(const char *))
+#define NB_WINDOW_PERIOD (sizeof(windowPeriod)/sizeof(TA_Integer))
+#define WINDOW_NB_BARS   400
+#define WINDOW_MAX_OUTPUT 3
+
 /**** Global functions definitions.   ****/
 ErrorNumber test_func_minmax( TA_History *history )
 {
@@ -291,6 +316,10 @@ ErrorNumber test_func_minmax( TA_History *history )
       }
    }
 
+   retValue = testWindowExtreme( history );
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
    /* All test succeed. */
    return TA_TEST_PASS;
 }
@@ -832,3 +861,200 @@ static ErrorNumber testCompareToReference( const TA_Real *input, int nbElement )
 
    return TA_TEST_PASS;
 }
+
+/* Test the sliding window extremes on series where the extreme leaves
+ * the window on every bar (up and down), where all the values are tied
+ * (flat), and on the history.
+ */
+static ErrorNumber testWindowExtreme( const TA_History *history )
+{
+   TA_Real *buffer, *high, *low, *close;
+   ErrorNumber errNb;
+   unsigned int serie, i, j, nbBars;
+
+   buffer = (TA_Real *)malloc( sizeof(TA_Real)*3*WINDOW_NB_BARS );
+   if( !buffer )
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+   high  = buffer;
+   low   = &buffer[WINDOW_NB_BARS];
+   close = &buffer[2*WINDOW_NB_BARS];
+
+   nbBars = history->nbBars;
+   for( serie=0; serie < 4; serie++ )
+   {
+      for( i=0; i < WINDOW_NB_BARS; i++ )
+      {
+         switch( serie )
+         {
+         case 0: /* Up. */
+            close[i] = 100.0+i;
+            high[i]  = close[i]+1.0;
+            low[i]   = close[i]-1.0;
+            break;
+         case 1: /* Down. */
+            close[i] = 1000.0-i;
+            high[i]  = close[i]+1.0;
+            low[i]   = close[i]-1.0;
+            break;
+         case 2: /* Flat. */
+            close[i] = 100.0;
+            high[i]  = 100.0;
+            low[i]   = 100.0;
+            break;
+         default:
+            /* The history, repeated. The index of a tied extreme
+             * depends on the start of the range, so the values are
+             * made distinct.
+             */
+            close[i] = history->close[i%nbBars]+i*1.0e-6;
+            high[i]  = history->high[i%nbBars]+i*1.0e-6;
+            low[i]   = history->low[i%nbBars]+i*1.0e-6;
+            break;
+         }
+      }
+
+      for( i=0; i < NB_WINDOW_FUNC; i++ )
+      {
+         for( j=0; j < NB_WINDOW_PERIOD; j++ )
+         {
+            errNb = testWindowExtremeFunc( windowFuncName[i], windowPeriod[j],
+                                           high, low, close );
+            if( errNb != TA_TEST_PASS )
+            {
+               printf( "Failure: %s period %d on serie %d\n",
+                       windowFuncName[i], windowPeriod[j], serie );
+               free( buffer );
+               return errNb;
+            }
+         }
+      }
+   }
+
+   free( buffer );
+   return TA_TEST_PASS;
+}
+
+/* Each output of a call on the whole range must be the same as the
+ * one of a call for this bar alone, which searches the whole window.
+ * MAX and MIN are also compared with their reference.
+ */
+static ErrorNumber testWindowExtremeFunc( const char *name,
+                                          TA_Integer period,
+                                          const TA_Real *high,
+                                          const TA_Real *low,
+                                          const TA_Real *close )
+{
+   static TA_Real    outReal[WINDOW_MAX_OUTPUT][WINDOW_NB_BARS];
+   static TA_Integer outInteger[WINDOW_MAX_OUTPUT][WINDOW_NB_BARS];
+   static TA_Real    refReal[WINDOW_NB_BARS];
+   TA_Real    oneReal[WINDOW_MAX_OUTPUT];
+   TA_Integer oneInteger[WINDOW_MAX_OUTPUT];
+
+   const TA_FuncHandle *handle;
+   const TA_FuncInfo *funcInfo;
+   const TA_InputParameterInfo *inputInfo;
+   const TA_OptInputParameterInfo *optInputInfo;
+   const TA_OutputParameterInfo *outputInfo[WINDOW_MAX_OUTPUT];
+   TA_ParamHolder *params;
+   TA_RetCode retCode;
+   TA_Integer outBegIdx, outNbElement, begIdx, nbElement, refBegIdx, refNbElement;
+   unsigned int i, j;
+   int isMin;
+
+   if( (TA_GetFuncHandle( name, &handle ) != TA_SUCCESS) ||
+       (TA_GetFuncInfo( handle, &funcInfo ) != TA_SUCCESS) ||
+       (funcInfo->nbOutput > WINDOW_MAX_OUTPUT) ||
+       (TA_ParamHolderAlloc( handle, &params ) != TA_SUCCESS) )
+      return TA_REGTEST_OPTIMIZATION_REF_ERROR;
+
+   for( i=0; i < funcInfo->nbInput; i++ )
+   {
+      TA_GetInputParameterInfo( handle, i, &inputInfo );
+      if( inputInfo->type == TA_Input_Price )
+         TA_SetInputParamPricePtr( params, i, close, high, low, close, close, close );
+      else
+         TA_SetInputParamRealPtr( params, i, close );
+   }
+
+   /* The window is the first period. The other ones (the
+    * smoothing of STOCH and STOCHF) are 1, so the outputs
+    * are still of this bar alone.
+    */
+   for( i=0; i < funcInfo->nbOptInput; i++ )
+   {
+      TA_GetOptInputParameterInfo( handle, i, &optInputInfo );
+      if( optInputInfo->type == TA_OptInput_IntegerRange )
+         TA_SetOptInputParamInteger( params, i, i == 0? period : 1 );
+   }
+
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      TA_GetOutputParameterInfo( handle, i, &outputInfo[i] );
+      if( outputInfo[i]->type == TA_Output_Integer )
+         TA_SetOutputParamIntegerPtr( params, i, outInteger[i] );
+      else
+         TA_SetOutputParamRealPtr( params, i, outReal[i] );
+   }
+
+   retCode = TA_CallFunc( params, 0, WINDOW_NB_BARS-1, &outBegIdx, &outNbElement );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Failure: %s returned %d\n", name, retCode );
+      TA_ParamHolderFree( params );
+      return TA_REGTEST_OPTIMIZATION_REF_ERROR;
+   }
+
+   for( j=0; j < (unsigned int)outNbElement; j++ )
+   {
+      for( i=0; i < funcInfo->nbOutput; i++ )
+      {
+         if( outputInfo[i]->type == TA_Output_Integer )
+            TA_SetOutputParamIntegerPtr( params, i, &oneInteger[i] );
+         else
+            TA_SetOutputParamRealPtr( params, i, &oneReal[i] );
+      }
+
+      retCode = TA_CallFunc( params, outBegIdx+j, outBegIdx+j, &begIdx, &nbElement );
+      if( (retCode != TA_SUCCESS) || (begIdx != outBegIdx+(int)j) || (nbElement != 1) )
+      {
+         printf( "Failure: %s bar %d returned %d\n", name, outBegIdx+j, retCode );
+         TA_ParamHolderFree( params );
+         return TA_REGTEST_OPTIMIZATION_REF_ERROR;
+      }
+
+      for( i=0; i < funcInfo->nbOutput; i++ )
+      {
+         if( outputInfo[i]->type == TA_Output_Integer?
+             (oneInteger[i] != outInteger[i][j]) :
+             (oneReal[i] != outReal[i][j]) )
+         {
+            printf( "Failure: %s output %d bar %d not the same\n", name, i, outBegIdx+j );
+            TA_ParamHolderFree( params );
+            return TA_REGTEST_OPTIMIZATION_REF_ERROR;
+         }
+      }
+   }
+
+   TA_ParamHolderFree( params );
+
+   isMin = (strcmp( name, "MIN" ) == 0);
+   if( isMin || (strcmp( name, "MAX" ) == 0) )
+   {
+      if( isMin )
+         retCode = referenceMin( 0, WINDOW_NB_BARS-1, close, period,
+                                 &refBegIdx, &refNbElement, refReal );
+      else
+         retCode = referenceMax( 0, WINDOW_NB_BARS-1, close, period,
+                                 &refBegIdx, &refNbElement, refReal );
+
+      if( (retCode != TA_SUCCESS) || (refBegIdx != outBegIdx) ||
+          (refNbElement != outNbElement) ||
+          (memcmp( refReal, outReal[0], sizeof(TA_Real)*outNbElement ) != 0) )
+      {
+         printf( "Failure: %s not the same as its reference\n", name );
+         return TA_REGTEST_OPTIMIZATION_REF_ERROR;
+      }
+   }
+
+   return TA_TEST_PASS;
+}
@@ -0,0 +1,280 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ *
+ */
+
+/* Description:
+ *     Test that each column of TA_XXX_PANEL is identical to
+ *     TA_XXX called for that column alone.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_func_ext.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef enum
+{
+   PANEL_EMA, PANEL_RSI, PANEL_ATR, PANEL_KAMA
+} TA_PanelFunc;
+
+typedef struct
+{
+   TA_PanelFunc func;
+   const char *name;
+   int period;
+} TA_PanelTest;
+
+static TA_PanelTest tableTest[] =
+{
+   { PANEL_EMA,  "EMA",  2 },
+   { PANEL_EMA,  "EMA",  30 },
+   { PANEL_RSI,  "RSI",  2 },
+   { PANEL_RSI,  "RSI",  14 },
+   { PANEL_ATR,  "ATR",  1 },
+   { PANEL_ATR,  "ATR",  14 },
+   { PANEL_KAMA, "KAMA", 2 },
+   { PANEL_KAMA, "KAMA", 30 }
+};
+
+#define NB_TEST (sizeof(tableTest)/sizeof(TA_PanelTest))
+
+/* Not a multiple of the vector size, and
+ * the stride is larger than needed.
+ */
+#define NB_SYMBOL 13
+#define STRIDE    16
+
+/* Column s is the history starting at bar SHIFT*s. */
+#define SHIFT 3
+
+typedef struct
+{
+   int nbBars;
+   double *high, *low, *close;        /* Panels */
+   double *colHigh, *colLow, *colClose; /* One column */
+} TA_PanelInputs;
+
+/**** Local functions declarations.    ****/
+static ErrorNumber doTest( const TA_PanelTest *test, const TA_PanelInputs *in,
+                           int startIdx, int endIdx,
+                           double *outPanel, double *outRef );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_panel( TA_History *history )
+{
+   ErrorNumber retValue;
+   TA_PanelInputs in;
+   double *buffer, *outPanel, *outRef;
+   int i, j, k, s, nbBars;
+   int range[3][2];
+
+   nbBars = (int)history->nbBars-SHIFT*(NB_SYMBOL-1);
+   if( nbBars < 200 )
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+
+   buffer = (double *)malloc( sizeof(double)*(4*STRIDE+4)*nbBars );
+   if( !buffer )
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+
+   in.nbBars   = nbBars;
+   in.high     = buffer;
+   in.low      = &buffer[STRIDE*nbBars];
+   in.close    = &buffer[2*STRIDE*nbBars];
+   outPanel    = &buffer[3*STRIDE*nbBars];
+   in.colHigh  = &buffer[4*STRIDE*nbBars];
+   in.colLow   = &in.colHigh[nbBars];
+   in.colClose = &in.colHigh[2*nbBars];
+   outRef      = &in.colHigh[3*nbBars];
+
+   for( i=0; i < nbBars; i++ )
+   {
+      for( s=0; s < STRIDE; s++ )
+      {
+         k = i+SHIFT*(s%NB_SYMBOL);
+         in.high [i*STRIDE+s] = history->high[k];
+         in.low  [i*STRIDE+s] = history->low[k];
+         in.close[i*STRIDE+s] = history->close[k];
+      }
+   }
+
+   /* All the bars, a part of them and a range
+    * ending before any output.
+    */
+   range[0][0] = 0;  range[0][1] = nbBars-1;
+   range[1][0] = 50; range[1][1] = 150;
+   range[2][0] = 0;  range[2][1] = 10;
+
+   retValue = TA_TEST_PASS;
+   for( k=0; (k < 4) && (retValue == TA_TEST_PASS); k++ )
+   {
+      TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, (k%2)*20 );
+      TA_SetCompatibility( k < 2? TA_COMPATIBILITY_DEFAULT : TA_COMPATIBILITY_METASTOCK );
+
+      for( i=0; (i < (int)NB_TEST) && (retValue == TA_TEST_PASS); i++ )
+      {
+         for( j=0; (j < 3) && (retValue == TA_TEST_PASS); j++ )
+            retValue = doTest( &tableTest[i], &in, range[j][0], range[j][1],
+                               outPanel, outRef );
+      }
+   }
+   TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+   TA_SetCompatibility( TA_COMPATIBILITY_DEFAULT );
+
+   free( buffer );
+
+   return retValue;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber doTest( const TA_PanelTest *test, const TA_PanelInputs *in,
+                           int startIdx, int endIdx,
+                           double *outPanel, double *outRef )
+{
+   TA_RetCode retCode;
+   int outBegIdx, outNBElement, refBegIdx, refNBElement;
+   int i, s, nbBars;
+
+   nbBars = in->nbBars;
+   memset( outPanel, 0, sizeof(double)*STRIDE*nbBars );
+
+   switch( test->func )
+   {
+   case PANEL_EMA:
+      retCode = TA_EMA_PANEL( startIdx, endIdx, NB_SYMBOL, STRIDE, in->close,
+                              test->period, &outBegIdx, &outNBElement, outPanel );
+      break;
+   case PANEL_RSI:
+      retCode = TA_RSI_PANEL( startIdx, endIdx, NB_SYMBOL, STRIDE, in->close,
+                              test->period, &outBegIdx, &outNBElement, outPanel );
+      break;
+   case PANEL_ATR:
+      retCode = TA_ATR_PANEL( startIdx, endIdx, NB_SYMBOL, STRIDE,
+                              in->high, in->low, in->close,
+                              test->period, &outBegIdx, &outNBElement, outPanel );
+      break;
+   default:
+      retCode = TA_KAMA_PANEL( startIdx, endIdx, NB_SYMBOL, STRIDE, in->close,
+                               test->period, &outBegIdx, &outNBElement, outPanel );
+      break;
+   }
+
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Fail: %s_PANEL period %d returned %d\n", test->name, test->period, retCode );
+      return TA_TEST_PANEL_CALL_FAILED;
+   }
+
+   for( s=0; s < NB_SYMBOL; s++ )
+   {
+      for( i=0; i < nbBars; i++ )
+      {
+         in->colHigh[i]  = in->high[i*STRIDE+s];
+         in->colLow[i]   = in->low[i*STRIDE+s];
+         in->colClose[i] = in->close[i*STRIDE+s];
+      }
+
+      switch( test->func )
+      {
+      case PANEL_EMA:
+         retCode = TA_EMA( startIdx, endIdx, in->colClose, test->period,
+                           &refBegIdx, &refNBElement, outRef );
+         break;
+      case PANEL_RSI:
+         retCode = TA_RSI( startIdx, endIdx, in->colClose, test->period,
+                           &refBegIdx, &refNBElement, outRef );
+         break;
+      case PANEL_ATR:
+         retCode = TA_ATR( startIdx, endIdx, in->colHigh, in->colLow, in->colClose,
+                           test->period, &refBegIdx, &refNBElement, outRef );
+         break;
+      default:
+         retCode = TA_KAMA( startIdx, endIdx, in->colClose, test->period,
+                            &refBegIdx, &refNBElement, outRef );
+         break;
+      }
+
+      if( retCode != TA_SUCCESS )
+         return TA_TEST_PANEL_CALL_FAILED;
+
+      if( (outBegIdx != refBegIdx) || (outNBElement != refNBElement) )
+      {
+         printf( "Fail: %s_PANEL period %d begIdx %d/%d nbElement %d/%d\n",
+                 test->name, test->period, outBegIdx, refBegIdx,
+                 outNBElement, refNBElement );
+         return TA_TEST_PANEL_NOT_SAME;
+      }
+
+      for( i=0; i < outNBElement; i++ )
+      {
+         if( memcmp( &outPanel[i*STRIDE+s], &outRef[i], sizeof(double) ) != 0 )
+         {
+            printf( "Fail: %s_PANEL period %d symbol %d output %d (%g/%g)\n",
+                    test->name, test->period, s, i, outPanel[i*STRIDE+s], outRef[i] );
+            return TA_TEST_PANEL_NOT_SAME;
+         }
+      }
+   }
+
+   return TA_TEST_PASS;
+}
@@ -0,0 +1,751 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ *  101826 MF   Test the running sums split in TA_MATH_FAST.
+ *  101826 MF   Test CCI and the linear regressions split in TA_MATH_STRICT,
+ *              test the allocator used by the other threads.
+ *
+ */
+
+/* Description:
+ *     Test that TA_CallFuncParallel gives an output identical to
+ *     TA_CallFunc, for functions split among the threads and
+ *     for functions done by the calling thread only.
+ *
+ *     The history is repeated for having a range large enough
+ *     for being split.
+ *
+ *     In TA_MATH_FAST, the functions keeping running sums are also
+ *     split and can differ from TA_CallFunc by the rounding errors.
+ *
+ *     Also test that TA_CallFuncBatch gives for each symbol the
+ *     same output as its own TA_CallFunc, that the other threads
+ *     allocate with the allocator of the caller (or its workspace)
+ *     and that a TA_Arena of the caller still works.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+#if defined( _WIN32 )
+   #include <windows.h>
+#else
+   #include <pthread.h>
+#endif
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+#define NB_REPEAT 200
+
+/* The optional input at optInIdx is set to optInValue
+ * (when optInIdx is not -1).
+ */
+typedef struct
+{
+   const char *name;
+   int optInIdx;
+   int optInValue;
+} TA_ParTest;
+
+static TA_ParTest tableTest[] =
+{
+   { "MAX",          0,  20 },
+   { "MAX",          0,  2000 },
+   { "MIN",          0,  20 },
+   { "MINMAXINDEX",  0,  50 },            /* Not split. */
+   { "MININDEX",     0,  100 },           /* Not split. */
+   { "MIDPRICE",     0,  14 },
+   { "WILLR",        0,  14 },
+   { "AROON",        0,  25 },
+   { "MOM",          0,  10 },
+   { "ROC",          0,  10 },
+   { "TRANGE",      -1,  0 },
+   { "BOP",         -1,  0 },
+   { "SIN",         -1,  0 },
+   { "LN",          -1,  0 },
+   { "DIV",         -1,  0 },
+   { "AVGPRICE",    -1,  0 },
+   { "SMA",          0,  30 },            /* Not split. */
+   { "SUM",          0,  30 },            /* Not split. */
+   { "STDDEV",       0,  20 },            /* Not split. */
+   { "CCI",          0,  100 },
+   { "CDLENGULFING",-1,  0 },             /* Not split. */
+   { "BBANDS",       3,  TA_MAType_WMA }, /* Not split. */
+   { "EMA",          0,  30 },            /* Not split. */
+   { "SAR",         -1,  0 }              /* Not split. */
+};
+
+#define NB_TEST (sizeof(tableTest)/sizeof(TA_ParTest))
+
+/* Functions split and depending on the TA_Context. */
+static TA_ParTest tableContextTest[] =
+{
+   { "SIN",         -1,  0 },
+   { "LN",          -1,  0 }
+};
+
+#define NB_CONTEXT_TEST (sizeof(tableContextTest)/sizeof(TA_ParTest))
+
+/* Functions keeping running sums, split only in TA_MATH_FAST. The
+ * CCI, AVGDEV and the linear regressions are also split in
+ * TA_MATH_STRICT, with periods not dividing the size of the chunks.
+ */
+static TA_ParTest tableSumTest[] =
+{
+   { "SMA",          0,  30 },
+   { "WMA",          0,  30 },
+   { "SUM",          0,  30 },
+   { "STDDEV",       0,  20 },
+   { "VAR",          0,  20 },
+   { "LINEARREG",    0,  14 },
+   { "LINEARREG_SLOPE", 0, 14 },
+   { "LINEARREG_ANGLE", 0, 37 },
+   { "LINEARREG_INTERCEPT", 0, 13 },
+   { "TSF",          0,  14 },
+   { "CORREL",       0,  30 },
+   { "BETA",         0,  5 },
+   { "CCI",          0,  37 },
+   { "CCI",          0,  100 },
+   { "CCI",          0,  200 },
+   { "AVGDEV",       0,  14 },
+   { "AVGDEV",       0,  200 },
+   { "CDLDOJI",     -1,  0 },
+   { "CDLENGULFING",-1,  0 },
+   { "CDLHIKKAKE",  -1,  0 }
+};
+
+#define NB_SUM_TEST (sizeof(tableSumTest)/sizeof(TA_ParTest))
+
+/* Largest difference allowed with TA_CallFunc for the
+ * running sums split in TA_MATH_FAST (see doTest).
+ */
+#define SUM_TOLERANCE 1e-9
+
+/* Functions using the extremes of the window, on a series
+ * where these extremes are tied.
+ */
+static TA_ParTest tableTiedTest[] =
+{
+   { "MAX",          0,  10 },
+   { "MIN",          0,  10 },
+   { "MIDPOINT",     0,  10 },
+   { "MIDPRICE",     0,  10 },
+   { "WILLR",        0,  10 },
+   { "AROON",        0,  10 },
+   { "AROONOSC",     0,  10 },
+   { "MAXINDEX",     0,  10 },            /* Not split. */
+   { "MINMAXINDEX",  0,  10 }             /* Not split. */
+};
+
+#define NB_TIED_TEST (sizeof(tableTiedTest)/sizeof(TA_ParTest))
+
+/* Each symbol of a batch is the history without its first
+ * bars (a different number for each symbol).
+ */
+#define NB_BATCH_SYMBOL 40
+
+static TA_ParTest tableBatchTest[] =
+{
+   { "SMA",          0,  20 },
+   { "MINMAXINDEX",  0,  30 },
+   { "BBANDS",       3,  TA_MAType_EMA },
+   { "CDLENGULFING",-1,  0 },
+   { "ADXR",         0,  14 },
+   { "BETA",         0,  5 }
+};
+
+#define NB_BATCH_TEST (sizeof(tableBatchTest)/sizeof(TA_ParTest))
+
+/* Counts the memory given by the allocator of the caller. The
+ * other threads of the pool use it too.
+ */
+#if defined( _WIN32 )
+   typedef CRITICAL_SECTION TA_TestMutex;
+   #define TEST_MUTEX_INIT(m)    InitializeCriticalSection(m)
+   #define TEST_MUTEX_DESTROY(m) DeleteCriticalSection(m)
+   #define TEST_MUTEX_LOCK(m)    EnterCriticalSection(m)
+   #define TEST_MUTEX_UNLOCK(m)  LeaveCriticalSection(m)
+#else
+   typedef pthread_mutex_t TA_TestMutex;
+   #define TEST_MUTEX_INIT(m)    pthread_mutex_init(m,NULL)
+   #define TEST_MUTEX_DESTROY(m) pthread_mutex_destroy(m)
+   #define TEST_MUTEX_LOCK(m)    pthread_mutex_lock(m)
+   #define TEST_MUTEX_UNLOCK(m)  pthread_mutex_unlock(m)
+#endif
+
+typedef struct
+{
+   TA_Allocator allocator;
+   TA_TestMutex mutex;
+   int nbAlloc;
+   int nbFree;
+} TA_ParAllocator;
+
+/**** Local functions declarations.    ****/
+static ErrorNumber doBatchTest( TA_ThreadPool *pool, const TA_ParTest *test,
+                                const TA_History *history,
+                                TA_Real *outReal, TA_Integer *outInteger,
+                                const TA_Allocator *allocator );
+
+static ErrorNumber doAllocatorTest( TA_ThreadPool *pool, const TA_History *history,
+                                    TA_Real *outReal, TA_Integer *outInteger );
+
+static void *parAlloc( void *opaque, size_t size );
+static void  parFree ( void *opaque, void *ptr, size_t size );
+
+static ErrorNumber doTest( TA_ThreadPool *pool, const TA_ParTest *test,
+                           const TA_History *history,
+                           TA_Real *outReal, TA_Integer *outInteger,
+                           double tolerance );
+
+static ErrorNumber callFunc( TA_ThreadPool *pool, const TA_ParTest *test,
+                             const TA_History *history,
+                             int startIdx, int endIdx,
+                             TA_Real *outReal, TA_Integer *outInteger,
+                             int *outBegIdx, int *outNbElement );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_parallel( TA_History *history )
+{
+   ErrorNumber retValue;
+   TA_History longHistory;
+   TA_ThreadPool *pool;
+   TA_Context *context;
+   TA_Real *buffer, *outReal;
+   TA_Integer *outInteger;
+   unsigned int nbBars, i, j;
+   double factor;
+
+   nbBars = history->nbBars*NB_REPEAT;
+   buffer     = (TA_Real *)malloc( sizeof(TA_Real)*(5+6)*nbBars );
+   outInteger = (TA_Integer *)malloc( sizeof(TA_Integer)*6*nbBars );
+   if( !buffer || !outInteger )
+   {
+      free( buffer );
+      free( outInteger );
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+   }
+
+   /* Each repetition of the history is a bit higher. */
+   memset( &longHistory, 0, sizeof(longHistory) );
+   longHistory.nbBars = nbBars;
+   longHistory.open   = buffer;
+   longHistory.high   = &buffer[nbBars];
+   longHistory.low    = &buffer[2*nbBars];
+   longHistory.close  = &buffer[3*nbBars];
+   longHistory.volume = &buffer[4*nbBars];
+   outReal            = &buffer[5*nbBars];
+   for( i=0; i < NB_REPEAT; i++ )
+   {
+      factor = 1.0+0.01*i;
+      for( j=0; j < history->nbBars; j++ )
+      {
+         longHistory.open  [i*history->nbBars+j] = history->open[j]*factor;
+         longHistory.high  [i*history->nbBars+j] = history->high[j]*factor;
+         longHistory.low   [i*history->nbBars+j] = history->low[j]*factor;
+         longHistory.close [i*history->nbBars+j] = history->close[j]*factor;
+         longHistory.volume[i*history->nbBars+j] = history->volume[j];
+      }
+   }
+
+   retValue = TA_TEST_PASS;
+   pool = NULL;
+   context = NULL;
+   if( (TA_ThreadPoolAlloc( &pool, 4 ) != TA_SUCCESS) ||
+       (TA_ThreadPoolGetNbThread( pool ) != 4) ||
+       (TA_ContextAlloc( &context ) != TA_SUCCESS) )
+      retValue = TA_TEST_PARALLEL_CALL_FAILED;
+
+   for( i=0; (i < NB_TEST) && (retValue == TA_TEST_PASS); i++ )
+      retValue = doTest( pool, &tableTest[i], &longHistory, outReal, outInteger, 0.0 );
+
+   /* Not split in TA_MATH_STRICT. */
+   for( i=0; (i < NB_SUM_TEST) && (retValue == TA_TEST_PASS); i++ )
+      retValue = doTest( pool, &tableSumTest[i], &longHistory, outReal, outInteger, 0.0 );
+
+   /* The other threads use the settings of the caller. */
+   if( (retValue == TA_TEST_PASS) &&
+       ((TA_ContextSetMathMode( context, TA_MATH_FAST ) != TA_SUCCESS) ||
+        (TA_SetThreadContext( context ) != TA_SUCCESS)) )
+      retValue = TA_TEST_PARALLEL_CALL_FAILED;
+
+   for( i=0; (i < NB_CONTEXT_TEST) && (retValue == TA_TEST_PASS); i++ )
+      retValue = doTest( pool, &tableContextTest[i], &longHistory, outReal, outInteger, 0.0 );
+
+   for( i=0; (i < NB_SUM_TEST) && (retValue == TA_TEST_PASS); i++ )
+      retValue = doTest( pool, &tableSumTest[i], &longHistory, outReal, outInteger, SUM_TOLERANCE );
+   TA_SetThreadContext( NULL );
+
+   /* A few values repeated for some bars. */
+   for( i=0; i < nbBars; i++ )
+   {
+      longHistory.close[i] = (double)((i/7)%5);
+      longHistory.open[i]  = longHistory.close[i];
+      longHistory.high[i]  = longHistory.close[i]+(double)((i/3)%3);
+      longHistory.low[i]   = longHistory.close[i]-(double)((i/5)%2);
+   }
+
+   for( i=0; (i < NB_TIED_TEST) && (retValue == TA_TEST_PASS); i++ )
+      retValue = doTest( pool, &tableTiedTest[i], &longHistory, outReal, outInteger, 0.0 );
+
+   TA_ContextFree( context );
+   if( TA_ThreadPoolFree( pool ) != TA_SUCCESS )
+      retValue = TA_TEST_PARALLEL_CALL_FAILED;
+
+   free( buffer );
+   free( outInteger );
+
+   return retValue;
+}
+
+ErrorNumber test_func_batch( TA_History *history )
+{
+   ErrorNumber retValue;
+   TA_ThreadPool *pool;
+   TA_Real *outReal;
+   TA_Integer *outInteger;
+   unsigned int i, nbThread;
+
+   outReal    = (TA_Real *)malloc( sizeof(TA_Real)*(NB_BATCH_SYMBOL+1)*3*history->nbBars );
+   outInteger = (TA_Integer *)malloc( sizeof(TA_Integer)*(NB_BATCH_SYMBOL+1)*3*history->nbBars );
+   if( !outReal || !outInteger )
+   {
+      free( outReal );
+      free( outInteger );
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+   }
+
+   /* Without a pool, then with 1 and 3 threads. */
+   retValue = TA_TEST_PASS;
+   for( nbThread=0; (nbThread <= 3) && (retValue == TA_TEST_PASS); nbThread += 1+(nbThread==1) )
+   {
+      pool = NULL;
+      if( nbThread && (TA_ThreadPoolAlloc( &pool, nbThread ) != TA_SUCCESS) )
+         retValue = TA_TEST_BATCH_CALL_FAILED;
+
+      for( i=0; (i < NB_BATCH_TEST) && (retValue == TA_TEST_PASS); i++ )
+         retValue = doBatchTest( pool, &tableBatchTest[i], history, outReal, outInteger, NULL );
+
+      if( (nbThread == 3) && (retValue == TA_TEST_PASS) )
+         retValue = doAllocatorTest( pool, history, outReal, outInteger );
+
+      TA_ThreadPoolFree( pool );
+   }
+
+   free( outReal );
+   free( outInteger );
+
+   return retValue;
+}
+
+/**** Local functions definitions.     ****/
+/* ATR allocates a buffer for each symbol, from the allocator of
+ * the caller whatever the thread doing the symbol. The buffers of
+ * MACD are all in the workspace allocated once by the caller.
+ * Both still work when the caller allocates from a TA_Arena.
+ */
+static ErrorNumber doAllocatorTest( TA_ThreadPool *pool, const TA_History *history,
+                                    TA_Real *outReal, TA_Integer *outInteger )
+{
+   static const TA_ParTest atrTest  = { "ATR",  0, 14 };
+   static const TA_ParTest macdTest = { "MACD", 0, 12 };
+   TA_ParAllocator count;
+   TA_Arena *arena;
+   ErrorNumber retValue;
+
+   memset( &count, 0, sizeof(count) );
+   count.allocator.allocFunc = parAlloc;
+   count.allocator.freeFunc  = parFree;
+   count.allocator.opaque    = &count;
+   TEST_MUTEX_INIT( &count.mutex );
+
+   retValue = doBatchTest( pool, &atrTest, history, outReal, outInteger, &count.allocator );
+   if( (retValue == TA_TEST_PASS) &&
+       ((count.nbAlloc < NB_BATCH_SYMBOL) || (count.nbFree != count.nbAlloc)) )
+   {
+      printf( "Fail: ATR batch %d alloc %d free\n", count.nbAlloc, count.nbFree );
+      retValue = TA_TEST_BATCH_CALL_FAILED;
+   }
+
+   /* The order of the symbols, the queues and the workspace. */
+   count.nbAlloc = 0;
+   count.nbFree  = 0;
+   if( retValue == TA_TEST_PASS )
+      retValue = doBatchTest( pool, &macdTest, history, outReal, outInteger, &count.allocator );
+   if( (retValue == TA_TEST_PASS) &&
+       ((count.nbAlloc > 4) || (count.nbFree != count.nbAlloc)) )
+   {
+      printf( "Fail: MACD batch %d alloc %d free\n", count.nbAlloc, count.nbFree );
+      retValue = TA_TEST_BATCH_CALL_FAILED;
+   }
+
+   TEST_MUTEX_DESTROY( &count.mutex );
+
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   if( TA_ArenaAlloc( &arena, 0 ) != TA_SUCCESS )
+      return TA_TEST_BATCH_CALL_FAILED;
+
+   retValue = doBatchTest( pool, &atrTest, history, outReal, outInteger,
+                           TA_ArenaGetAllocator( arena ) );
+   if( retValue == TA_TEST_PASS )
+      retValue = doBatchTest( pool, &macdTest, history, outReal, outInteger,
+                              TA_ArenaGetAllocator( arena ) );
+
+   TA_ArenaFree( arena );
+
+   return retValue;
+}
+
+static void *parAlloc( void *opaque, size_t size )
+{
+   TA_ParAllocator *count;
+
+   count = (TA_ParAllocator *)opaque;
+   TEST_MUTEX_LOCK( &count->mutex );
+   count->nbAlloc++;
+   TEST_MUTEX_UNLOCK( &count->mutex );
+
+   return malloc( size );
+}
+
+static void parFree( void *opaque, void *ptr, size_t size )
+{
+   TA_ParAllocator *count;
+
+   (void)size;
+   count = (TA_ParAllocator *)opaque;
+   TEST_MUTEX_LOCK( &count->mutex );
+   count->nbFree++;
+   TEST_MUTEX_UNLOCK( &count->mutex );
+
+   free( ptr );
+}
+
+/* The allocator (when not NULL) is the one of the
+ * caller for TA_CallFuncBatch.
+ */
+static ErrorNumber doBatchTest( TA_ThreadPool *pool, const TA_ParTest *test,
+                                const TA_History *history,
+                                TA_Real *outReal, TA_Integer *outInteger,
+                                const TA_Allocator *allocator )
+{
+   TA_BatchSymbol symbol[NB_BATCH_SYMBOL+1];
+   const void *in[NB_BATCH_SYMBOL+1][5];
+   void *out[NB_BATCH_SYMBOL+1][3];
+   TA_History symbolHistory;
+   const TA_FuncHandle *handle;
+   const TA_FuncInfo *funcInfo;
+   const TA_InputParameterInfo *inputInfo;
+   const TA_OutputParameterInfo *outputInfo;
+   TA_ParamHolder *params;
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   int refBegIdx, refNbElement;
+   unsigned int i, j, k, nbIn, stride;
+   TA_Real *refReal, *symbolReal;
+   TA_Integer *refInteger, *symbolInteger;
+
+   stride     = 3*history->nbBars;
+   refReal    = &outReal[NB_BATCH_SYMBOL*stride];
+   refInteger = &outInteger[NB_BATCH_SYMBOL*stride];
+
+   if( (TA_GetFuncHandle( test->name, &handle ) != TA_SUCCESS) ||
+       (TA_GetFuncInfo( handle, &funcInfo ) != TA_SUCCESS) ||
+       (TA_ParamHolderAlloc( handle, &params ) != TA_SUCCESS) )
+      return TA_TEST_BATCH_CALL_FAILED;
+
+   if( (test->optInIdx >= 0) &&
+       (TA_SetOptInputParamInteger( params, test->optInIdx, test->optInValue ) != TA_SUCCESS) )
+   {
+      TA_ParamHolderFree( params );
+      return TA_TEST_BATCH_CALL_FAILED;
+   }
+
+   /* Symbol i starts at bar 5*i of the history. The last
+    * one has an invalid range.
+    */
+   memset( symbol, 0, sizeof(symbol) );
+   for( i=0; i <= NB_BATCH_SYMBOL; i++ )
+   {
+      k = 5*(i%NB_BATCH_SYMBOL);
+      nbIn = 0;
+      for( j=0; j < funcInfo->nbInput; j++ )
+      {
+         TA_GetInputParameterInfo( handle, j, &inputInfo );
+         if( inputInfo->type != TA_Input_Price )
+            in[i][nbIn++] = j? &history->high[k] : &history->close[k];
+         else
+         {
+            if( inputInfo->flags & TA_IN_PRICE_OPEN )   in[i][nbIn++] = &history->open[k];
+            if( inputInfo->flags & TA_IN_PRICE_HIGH )   in[i][nbIn++] = &history->high[k];
+            if( inputInfo->flags & TA_IN_PRICE_LOW )    in[i][nbIn++] = &history->low[k];
+            if( inputInfo->flags & TA_IN_PRICE_CLOSE )  in[i][nbIn++] = &history->close[k];
+            if( inputInfo->flags & TA_IN_PRICE_VOLUME ) in[i][nbIn++] = &history->volume[k];
+         }
+      }
+
+      for( j=0; j < funcInfo->nbOutput; j++ )
+      {
+         TA_GetOutputParameterInfo( handle, j, &outputInfo );
+         if( outputInfo->type == TA_Output_Integer )
+            out[i][j] = &outInteger[(i%NB_BATCH_SYMBOL)*stride+j*(history->nbBars-k)];
+         else
+            out[i][j] = &outReal[(i%NB_BATCH_SYMBOL)*stride+j*(history->nbBars-k)];
+      }
+
+      symbol[i].in       = in[i];
+      symbol[i].out      = out[i];
+      symbol[i].startIdx = 0;
+      symbol[i].endIdx   = (TA_Integer)(history->nbBars-k-1);
+   }
+   symbol[NB_BATCH_SYMBOL].startIdx = 10;
+   symbol[NB_BATCH_SYMBOL].endIdx   = 5;
+
+   memset( outReal, 0, sizeof(TA_Real)*NB_BATCH_SYMBOL*stride );
+   memset( outInteger, 0, sizeof(TA_Integer)*NB_BATCH_SYMBOL*stride );
+
+   TA_SetThreadAllocator( allocator );
+   retCode = TA_CallFuncBatch( pool, params, symbol, NB_BATCH_SYMBOL+1 );
+   TA_SetThreadAllocator( NULL );
+   TA_ParamHolderFree( params );
+
+   /* Only the invalid symbol fails. */
+   if( (retCode != TA_OUT_OF_RANGE_END_INDEX) ||
+       (symbol[NB_BATCH_SYMBOL].retCode != TA_OUT_OF_RANGE_END_INDEX) )
+   {
+      printf( "Fail: %s batch returned %d\n", test->name, retCode );
+      return TA_TEST_BATCH_CALL_FAILED;
+   }
+
+   for( i=0; i < NB_BATCH_SYMBOL; i++ )
+   {
+      k = 5*i;
+      memset( &symbolHistory, 0, sizeof(symbolHistory) );
+      symbolHistory.nbBars = history->nbBars-k;
+      symbolHistory.open   = &history->open[k];
+      symbolHistory.high   = &history->high[k];
+      symbolHistory.low    = &history->low[k];
+      symbolHistory.close  = &history->close[k];
+      symbolHistory.volume = &history->volume[k];
+
+      retValue = callFunc( NULL, test, &symbolHistory, 0, (int)symbolHistory.nbBars-1,
+                           refReal, refInteger, &refBegIdx, &refNbElement );
+      if( retValue != TA_TEST_PASS )
+         return retValue;
+
+      if( (symbol[i].retCode != TA_SUCCESS) ||
+          (symbol[i].outBegIdx != refBegIdx) ||
+          (symbol[i].outNbElement != refNbElement) )
+      {
+         printf( "Fail: %s symbol %d begIdx %d/%d nbElement %d/%d\n", test->name, i,
+                 symbol[i].outBegIdx, refBegIdx, symbol[i].outNbElement, refNbElement );
+         return TA_TEST_BATCH_NOT_SAME;
+      }
+
+      symbolReal    = &outReal[i*stride];
+      symbolInteger = &outInteger[i*stride];
+      if( (memcmp( symbolReal, refReal, sizeof(TA_Real)*3*symbolHistory.nbBars ) != 0) ||
+          (memcmp( symbolInteger, refInteger, sizeof(TA_Integer)*3*symbolHistory.nbBars ) != 0) )
+      {
+         printf( "Fail: %s symbol %d output not same\n", test->name, i );
+         return TA_TEST_BATCH_NOT_SAME;
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+/* With a tolerance, the outputs can differ by that much relative
+ * to the reference, or absolute near 0 (the integer outputs must
+ * still be identical).
+ */
+static ErrorNumber doTest( TA_ThreadPool *pool, const TA_ParTest *test,
+                           const TA_History *history,
+                           TA_Real *outReal, TA_Integer *outInteger,
+                           double tolerance )
+{
+   ErrorNumber retValue;
+   int nbBars, range, startIdx, endIdx, i;
+   int refBegIdx, refNbElement, outBegIdx, outNbElement;
+   TA_Real *refReal;
+   TA_Integer *refInteger;
+
+   nbBars     = (int)history->nbBars;
+   refReal    = &outReal[3*nbBars];
+   refInteger = &outInteger[3*nbBars];
+
+   /* All the bars, a range not starting at zero, and a
+    * range ending before the lookback of most functions.
+    */
+   for( range=0; range < 3; range++ )
+   {
+      switch( range )
+      {
+      case 0:  startIdx = 0;    endIdx = nbBars-1;  break;
+      case 1:  startIdx = 1234; endIdx = nbBars-77; break;
+      default: startIdx = 5;    endIdx = 10;        break;
+      }
+
+      retValue = callFunc( NULL, test, history, startIdx, endIdx,
+                           refReal, refInteger, &refBegIdx, &refNbElement );
+      if( retValue != TA_TEST_PASS )
+         return retValue;
+
+      retValue = callFunc( pool, test, history, startIdx, endIdx,
+                           outReal, outInteger, &outBegIdx, &outNbElement );
+      if( retValue != TA_TEST_PASS )
+         return retValue;
+
+      if( (outBegIdx != refBegIdx) || (outNbElement != refNbElement) )
+      {
+         printf( "Fail: %s begIdx %d/%d nbElement %d/%d\n", test->name,
+                 outBegIdx, refBegIdx, outNbElement, refNbElement );
+         return TA_TEST_PARALLEL_NOT_SAME;
+      }
+
+      for( i=0; i < 3*nbBars; i++ )
+      {
+         if( (outInteger[i] != refInteger[i]) ||
+             ((tolerance == 0.0)? (memcmp( &outReal[i], &refReal[i], sizeof(TA_Real) ) != 0) :
+                                  (fabs( outReal[i]-refReal[i] ) > tolerance*(1.0+fabs( refReal[i] )))) )
+         {
+            printf( "Fail: %s output %d at %d (%g/%g, %d/%d)\n", test->name,
+                    i/nbBars, i%nbBars, outReal[i], refReal[i],
+                    outInteger[i], refInteger[i] );
+            return TA_TEST_PARALLEL_NOT_SAME;
+         }
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber callFunc( TA_ThreadPool *pool, const TA_ParTest *test,
+                             const TA_History *history,
+                             int startIdx, int endIdx,
+                             TA_Real *outReal, TA_Integer *outInteger,
+                             int *outBegIdx, int *outNbElement )
+{
+   const TA_FuncHandle *handle;
+   const TA_FuncInfo *funcInfo;
+   const TA_InputParameterInfo *inputInfo;
+   const TA_OutputParameterInfo *outputInfo;
+   TA_ParamHolder *params;
+   TA_RetCode retCode;
+   unsigned int i, nbBars;
+
+   nbBars = history->nbBars;
+   for( i=0; i < 3*nbBars; i++ )
+   {
+      outReal[i]    = 0.0;
+      outInteger[i] = 0;
+   }
+
+   if( (TA_GetFuncHandle( test->name, &handle ) != TA_SUCCESS) ||
+       (TA_GetFuncInfo( handle, &funcInfo ) != TA_SUCCESS) ||
+       (TA_ParamHolderAlloc( handle, &params ) != TA_SUCCESS) )
+      return TA_TEST_PARALLEL_CALL_FAILED;
+
+   retCode = TA_SUCCESS;
+   for( i=0; (i < funcInfo->nbInput) && (retCode == TA_SUCCESS); i++ )
+   {
+      TA_GetInputParameterInfo( handle, i, &inputInfo );
+      if( inputInfo->type == TA_Input_Price )
+         retCode = TA_SetInputParamPricePtr( params, i, history->open, history->high,
+                                             history->low, history->close,
+                                             history->volume, history->volume );
+      else
+         retCode = TA_SetInputParamRealPtr( params, i, i? history->high : history->close );
+   }
+
+   for( i=0; (i < funcInfo->nbOutput) && (retCode == TA_SUCCESS); i++ )
+   {
+      TA_GetOutputParameterInfo( handle, i, &outputInfo );
+      if( outputInfo->type == TA_Output_Integer )
+         retCode = TA_SetOutputParamIntegerPtr( params, i, &outInteger[i*nbBars] );
+      else
+         retCode = TA_SetOutputParamRealPtr( params, i, &outReal[i*nbBars] );
+   }
+
+   if( (retCode == TA_SUCCESS) && (test->optInIdx >= 0) )
+      retCode = TA_SetOptInputParamInteger( params, test->optInIdx, test->optInValue );
+
+   if( retCode == TA_SUCCESS )
+   {
+      if( pool )
+         retCode = TA_CallFuncParallel( pool, params, startIdx, endIdx, outBegIdx, outNbElement );
+      else
+         retCode = TA_CallFunc( params, startIdx, endIdx, outBegIdx, outNbElement );
+   }
+
+   TA_ParamHolderFree( params );
+
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Fail: %s call failed (%d)\n", test->name, retCode );
+      return TA_TEST_PARALLEL_CALL_FAILED;
+   }
+
+   return TA_TEST_PASS;
+}
@@ -48,6 +48,10 @@
  *  021106 MF   Add tests for ULTOSC.
  *  042206 MF   Add tests for NATR
  *  120507 MF   Add tests for ACCBANDS
+ *  101826 MF   Add a test for a zero close in NATR.
+ *  101826 MF   Enable the range test of NATR.
+ *  101826 MF   Add tests for CCI long periods.
+ *  101826 MF   Test the CCI long periods in both math modes and with NaN.
  *
  */
 
@@ -62,6 +66,8 @@
 /**** Headers ****/
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
+#include <math.h>
 
 #include "ta_test_priv.h"
 #include "ta_test_func.h"
@@ -116,10 +122,23 @@ typedef struct
    const TA_Real *close;
 } TA_RangeTestParam;
 
+/* The long periods of CCI are calculated by blocks of at most 4
+ * periods (see TA_INT_AvgDevTreeAlloc). Such a series crosses many
+ * blocks. The NaN and the infinite value are in different blocks.
+ */
+#define CCI_LONG_PERIOD  130
+#define CCI_LONG_NB_BARS 5000
+#define CCI_LONG_NAN_IDX 1000
+#define CCI_LONG_INF_IDX 3000
+
 /**** Local functions declarations.    ****/
 static ErrorNumber do_test( const TA_History *history,
                             const TA_Test *test );
 
+static ErrorNumber do_test_cci_long( const TA_History *history,
+                                     TA_MathMode mathMode,
+                                     int withNotFinite );
+
 /**** Local variables definitions.     ****/
 
 static TA_Test tableTest[] =
@@ -132,10 +151,7 @@ static TA_Test tableTest[] =
    /****************/
    /* NATR TEST    */
    /****************/
-   /* TODO Analyze further why NATR requires a very large unstable period.
-    * for now, just disable range testing.
-    */
-   { 0, TA_NATR_TEST, 0, 251, 14, 0, 0, TA_SUCCESS,       0,  3.9321, 14,  252-14 },
+   { 1, TA_NATR_TEST, 0, 251, 14, 0, 0, TA_SUCCESS,       0,  3.9321, 14,  252-14 },
    { 0, TA_NATR_TEST, 0, 251, 14, 0, 0, TA_SUCCESS,       1,  3.7576, 14,  252-14 },
    { 0, TA_NATR_TEST, 0, 251, 14, 0, 0, TA_SUCCESS,  252-15,  3.0229, 14,  252-14 },
 
@@ -169,6 +185,11 @@ static TA_Test tableTest[] =
    { 0, TA_CCI_TEST, 186,187,  2, 0, 0, TA_SUCCESS,   1, 0.0, 186,  2 },
    { 0, TA_CCI_TEST, 187,187,  2, 0, 0, TA_SUCCESS,   0, 0.0, 187,  1 },
 
+   /* Long periods are calculated with a different algorithm. */
+   { 1, TA_CCI_TEST, 0, 251, 150, 0, 0, TA_SUCCESS,   0,  84.4904, 149, 252-149 }, /* First Value */
+   { 0, TA_CCI_TEST, 0, 251, 150, 0, 0, TA_SUCCESS,   1,  77.9547, 149, 252-149 },
+   { 0, TA_CCI_TEST, 0, 251, 150, 0, 0, TA_SUCCESS, 102, -55.0535, 149, 252-149 }, /* Last Value */
+
    /* Test period 2, 5 and 11 */
    { 0, TA_CCI_TEST, 0, 251,  2, 0, 0, TA_SUCCESS,  0, 66.666, 1,  252-1 },
    { 1, TA_CCI_TEST, 0, 251,  5, 0, 0, TA_SUCCESS,  0, 18.857, 4,  252-4 },
@@ -229,6 +250,15 @@ ErrorNumber test_func_per_hlc( TA_History *history )
       }
    }
 
+   /* The long periods use the tree only in TA_MATH_FAST. */
+   for( i=0; i < 4; i++ )
+   {
+      retValue = do_test_cci_long( history, (i&1)? TA_MATH_FAST : TA_MATH_STRICT, i>>1 );
+      TA_SetMathMode( TA_MATH_STRICT );
+      if( retValue != TA_TEST_PASS )
+         return retValue;
+   }
+
    /* Re-initialize all the unstable period to zero. */
    TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
 
@@ -483,6 +513,7 @@ static ErrorNumber do_test( const TA_History *history,
    TA_Integer outBegIdx;
    TA_Integer outNbElement;
    TA_RangeTestParam testParam;
+   int zeroIdx;
 
    /* Set to NAN all the elements of the gBuffers.  */
    clearAllBuffers();
@@ -626,6 +657,8 @@ static ErrorNumber do_test( const TA_History *history,
          errNb = doRangeTest( rangeTestFunction,
                               TA_FUNC_UNST_NATR,
                               (void *)&testParam, 1, 0 );
+         /* The range test leaves an unstable period behind. */
+         TA_SetUnstablePeriod( TA_FUNC_UNST_NATR, 0 );
          break;
 
 	  case TA_ACCBANDS_TEST:
@@ -646,6 +679,149 @@ static ErrorNumber do_test( const TA_History *history,
          return errNb;
    }
 
+   /* A zero close must give a zero at its own output, and
+    * must leave the first output unchanged.
+    */
+   if( test->theFunction == TA_NATR_TEST )
+   {
+      zeroIdx = test->expectedBegIdx+10;
+      gBuffer[2].in[zeroIdx] = 0.0;
+      retCode = TA_NATR( test->startIdx, test->endIdx,
+                         gBuffer[0].in, gBuffer[1].in, gBuffer[2].in,
+                         test->optInTimePeriod1,
+                         &outBegIdx, &outNbElement,
+                         gBuffer[1].out0 );
+      setInputBuffer( 2, history->close, history->nbBars );
+
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "Failed NATR call with a zero close [%d]\n", retCode );
+         return TA_TEST_FAIL_NATR_ZERO_CLOSE_1;
+      }
+      if( (gBuffer[1].out0[zeroIdx-outBegIdx] != 0.0) ||
+          (gBuffer[1].out0[0] != gBuffer[0].out0[0]) )
+      {
+         printf( "Failed NATR with a zero close at %d\n", zeroIdx );
+         return TA_TEST_FAIL_NATR_ZERO_CLOSE_2;
+      }
+   }
+
    return TA_TEST_PASS;
 }
 
+/* Compare with the CCI calculated directly
+ * from its definition, for every output.
+ *
+ * In TA_MATH_STRICT the sums are done in the same
+ * order as TA_CCI (the order of its circular buffer),
+ * so the outputs must be the same. A window with a NaN
+ * or an infinite value must give NaN in both modes.
+ */
+static ErrorNumber do_test_cci_long( const TA_History *history,
+                                     TA_MathMode mathMode,
+                                     int withNotFinite )
+{
+   TA_RetCode retCode;
+   TA_Real *high, *low, *close, *out;
+   TA_Integer outBegIdx, outNbElement;
+   double typPrice[CCI_LONG_PERIOD];
+   double mean, meanDev, lastValue, expected, maxError, factor;
+   int i, j, k, nbBars;
+
+   high = (TA_Real *)malloc( sizeof(TA_Real)*4*CCI_LONG_NB_BARS );
+   if( !high )
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+   low   = &high[CCI_LONG_NB_BARS];
+   close = &high[2*CCI_LONG_NB_BARS];
+   out   = &high[3*CCI_LONG_NB_BARS];
+
+   /* The history repeated, each time at a different level. */
+   nbBars = (int)history->nbBars;
+   for( i=0; i < CCI_LONG_NB_BARS; i++ )
+   {
+      factor   = 1.0+(i/nbBars)*0.05;
+      high[i]  = history->high[i%nbBars]*factor;
+      low[i]   = history->low[i%nbBars]*factor;
+      close[i] = history->close[i%nbBars]*factor;
+   }
+
+   if( withNotFinite )
+   {
+      high[CCI_LONG_NAN_IDX]  = sqrt(-1.0);  /* NaN */
+      close[CCI_LONG_INF_IDX] = HUGE_VAL;    /* +infinity */
+   }
+
+   TA_SetMathMode( mathMode );
+   retCode = TA_CCI( 0, CCI_LONG_NB_BARS-1, high, low, close, CCI_LONG_PERIOD,
+                     &outBegIdx, &outNbElement, out );
+   if( (retCode != TA_SUCCESS) ||
+       (outBegIdx != CCI_LONG_PERIOD-1) ||
+       (outNbElement != CCI_LONG_NB_BARS-CCI_LONG_PERIOD+1) )
+   {
+      printf( "Fail: CCI long series (mode %d) returned %d (%d,%d)\n",
+              mathMode, retCode, outBegIdx, outNbElement );
+      free( high );
+      return TA_TEST_AVGDEV_TREE_CALL_FAILED;
+   }
+
+   for( i=0; i < outNbElement; i++ )
+   {
+      /* typPrice[j] is the price of the window at the
+       * position j of the circular buffer of TA_CCI.
+       */
+      mean = 0.0;
+      for( j=0; j < CCI_LONG_PERIOD; j++ )
+      {
+         k = i+((j-i)%CCI_LONG_PERIOD+CCI_LONG_PERIOD)%CCI_LONG_PERIOD;
+         typPrice[j] = (high[k]+low[k]+close[k])/3;
+         mean += typPrice[j];
+      }
+      mean /= CCI_LONG_PERIOD;
+      k = i+CCI_LONG_PERIOD-1;
+      lastValue = (high[k]+low[k]+close[k])/3;
+
+      meanDev = 0.0;
+      for( j=0; j < CCI_LONG_PERIOD; j++ )
+         meanDev += fabs( typPrice[j]-mean );
+
+      if( ((lastValue-mean) != 0.0) && (meanDev != 0.0) )
+         expected = (lastValue-mean)/(0.015*(meanDev/CCI_LONG_PERIOD));
+      else
+         expected = 0.0;
+
+      if( expected != expected )
+      {
+         if( out[i] == out[i] )
+         {
+            printf( "Fail: CCI long series (mode %d) output %d is %.17g, expected NaN\n",
+                    mathMode, i, out[i] );
+            free( high );
+            return TA_TEST_AVGDEV_TREE_NOT_NAN;
+         }
+         continue;
+      }
+
+      if( (mathMode == TA_MATH_STRICT) && (out[i] != expected) )
+      {
+         printf( "Fail: CCI long series output %d is %.17g, not %.17g\n",
+                 i, out[i], expected );
+         free( high );
+         return TA_TEST_AVGDEV_TREE_NOT_SAME;
+      }
+
+      /* The difference with the average loses the digits
+       * common to the price and its average.
+       */
+      maxError = 1e-12*(fabs( lastValue )/(0.015*(meanDev/CCI_LONG_PERIOD))+fabs( expected ));
+      if( !(fabs( out[i]-expected ) <= maxError) )
+      {
+         printf( "Fail: CCI long series output %d is %.17g, expected %.17g\n",
+                 i, out[i], expected );
+         free( high );
+         return TA_TEST_AVGDEV_TREE_NOT_ACCURATE;
+      }
+   }
+
+   free( high );
+   return TA_TEST_PASS;
+}
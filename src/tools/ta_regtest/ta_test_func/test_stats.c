@@ -0,0 +1,385 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ *
+ */
+
+/* Description:
+ *     Test the statistics of the calls (TA_GetFuncStats).
+ *     Passes without testing anything when the library is built
+ *     without TA_FUNC_STATS.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#if defined( _WIN32 )
+   #include <windows.h>
+#else
+   #include <pthread.h>
+#endif
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+#define NB_SYMBOL 4
+
+/* Calls done by the thread of testConcurrent. */
+#define NB_THREAD_CALL 2000
+
+typedef struct
+{
+   TA_ParamHolder *params;
+   TA_RetCode retCode;
+} TA_StatsThread;
+
+/**** Local functions declarations.    ****/
+static ErrorNumber checkStats( const TA_FuncHandle *handle, const char *name,
+                               unsigned long long nbCall, unsigned long long nbBar );
+static ErrorNumber testCalls( TA_History *history, double *out );
+static ErrorNumber testConcurrent( TA_History *history, double *out );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_stats( TA_History *history )
+{
+   ErrorNumber retValue;
+   TA_RetCode retCode;
+   double *out;
+
+   retCode = TA_SetFuncStats( 1 );
+   if( retCode == TA_NOT_SUPPORTED )
+      return TA_TEST_PASS;
+
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Fail: TA_SetFuncStats returned %d\n", retCode );
+      return TA_TEST_STATS_API_FAILED;
+   }
+
+   out = (double *)malloc( sizeof(double)*NB_SYMBOL*history->nbBars );
+   if( !out )
+      retValue = TA_TESTUTIL_TFRR_BAD_PARAM;
+   else
+      retValue = testCalls( history, out );
+   if( retValue == TA_TEST_PASS )
+      retValue = testConcurrent( history, out );
+
+   TA_SetFuncStats( 0 );
+   TA_ResetFuncStats();
+   free( out );
+
+   return retValue;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber testCalls( TA_History *history, double *out )
+{
+   ErrorNumber retValue;
+   TA_RetCode retCode;
+   const TA_FuncHandle *smaHandle, *atrHandle;
+   const TA_FuncInfo *funcInfo;
+   TA_ParamHolder *params;
+   TA_FuncStats stats;
+   TA_BatchSymbol symbol[NB_SYMBOL];
+   const void *in[NB_SYMBOL][1];
+   void *outPtr[NB_SYMBOL][1];
+   TA_Integer outBegIdx, outNbElement;
+   int i, nbBars;
+
+   nbBars = (int)history->nbBars;
+   if( (TA_GetFuncHandle( "SMA", &smaHandle ) != TA_SUCCESS) ||
+       (TA_GetFuncHandle( "ATR", &atrHandle ) != TA_SUCCESS) ||
+       (TA_GetFuncInfo( smaHandle, &funcInfo ) != TA_SUCCESS) ||
+       (TA_ParamHolderAlloc( smaHandle, &params ) != TA_SUCCESS) )
+   {
+      printf( "Fail: SMA or ATR not found\n" );
+      return TA_TEST_STATS_API_FAILED;
+   }
+
+   if( funcInfo->handle != smaHandle )
+   {
+      TA_ParamHolderFree( params );
+      return TA_TEST_STATS_API_FAILED;
+   }
+
+   /* Counted from 0. */
+   TA_ResetFuncStats();
+   retValue = checkStats( smaHandle, "SMA", 0, 0 );
+   if( retValue != TA_TEST_PASS )
+   {
+      TA_ParamHolderFree( params );
+      return retValue;
+   }
+
+   /* 3 calls on 100 bars. */
+   TA_SetInputParamRealPtr( params, 0, history->close );
+   TA_SetOptInputParamInteger( params, 0, 10 );
+   TA_SetOutputParamRealPtr( params, 0, out );
+   for( i=0; i < 3; i++ )
+   {
+      retCode = TA_CallFunc( params, 100, 199, &outBegIdx, &outNbElement );
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "Fail: TA_CallFunc SMA returned %d\n", retCode );
+         TA_ParamHolderFree( params );
+         return TA_TEST_STATS_CALL_FAILED;
+      }
+   }
+
+   retValue = checkStats( smaHandle, "SMA", 3, 300 );
+   if( retValue != TA_TEST_PASS )
+   {
+      TA_ParamHolderFree( params );
+      return retValue;
+   }
+
+   /* One call for each symbol of a batch. */
+   for( i=0; i < NB_SYMBOL; i++ )
+   {
+      in[i][0]     = history->close;
+      outPtr[i][0] = &out[i*nbBars];
+      symbol[i].in       = in[i];
+      symbol[i].out      = outPtr[i];
+      symbol[i].startIdx = 0;
+      symbol[i].endIdx   = 49;
+   }
+
+   retCode = TA_CallFuncBatch( NULL, params, symbol, NB_SYMBOL );
+   TA_ParamHolderFree( params );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Fail: TA_CallFuncBatch returned %d\n", retCode );
+      return TA_TEST_STATS_CALL_FAILED;
+   }
+
+   retValue = checkStats( smaHandle, "SMA", 3+NB_SYMBOL, 300+NB_SYMBOL*50 );
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   /* ATR allocates its true range. */
+   if( TA_ParamHolderAlloc( atrHandle, &params ) != TA_SUCCESS )
+      return TA_TEST_STATS_API_FAILED;
+
+   TA_SetInputParamPricePtr( params, 0, NULL, history->high, history->low,
+                             history->close, NULL, NULL );
+   TA_SetOutputParamRealPtr( params, 0, out );
+   retCode = TA_CallFunc( params, 0, nbBars-1, &outBegIdx, &outNbElement );
+   TA_ParamHolderFree( params );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Fail: TA_CallFunc ATR returned %d\n", retCode );
+      return TA_TEST_STATS_CALL_FAILED;
+   }
+
+   retValue = checkStats( atrHandle, "ATR", 1, (unsigned long long)nbBars );
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   retCode = TA_GetFuncStats( atrHandle, &stats );
+   if( (retCode != TA_SUCCESS) || (stats.nbAlloc < 1) )
+   {
+      printf( "Fail: ATR nbAlloc %llu\n", stats.nbAlloc );
+      return TA_TEST_STATS_BAD_COUNT;
+   }
+
+   /* Nothing counted while disabled. */
+   TA_SetFuncStats( 0 );
+   TA_SMA( 0, nbBars-1, history->close, 10, &outBegIdx, &outNbElement, out );
+   if( TA_ParamHolderAlloc( smaHandle, &params ) != TA_SUCCESS )
+      return TA_TEST_STATS_API_FAILED;
+   TA_SetInputParamRealPtr( params, 0, history->close );
+   TA_SetOutputParamRealPtr( params, 0, out );
+   TA_CallFunc( params, 0, nbBars-1, &outBegIdx, &outNbElement );
+   TA_ParamHolderFree( params );
+
+   retValue = checkStats( smaHandle, "SMA", 3+NB_SYMBOL, 300+NB_SYMBOL*50 );
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   /* All to 0 after a reset. */
+   if( TA_ResetFuncStats() != TA_SUCCESS )
+      return TA_TEST_STATS_API_FAILED;
+
+   retValue = checkStats( smaHandle, "SMA", 0, 0 );
+   if( retValue == TA_TEST_PASS )
+      retValue = checkStats( atrHandle, "ATR", 0, 0 );
+
+   return retValue;
+}
+
+#if defined( _WIN32 )
+static DWORD WINAPI statsThread( LPVOID param )
+#else
+static void *statsThread( void *param )
+#endif
+{
+   TA_StatsThread *work;
+   TA_Integer outBegIdx, outNbElement;
+   int i;
+
+   work = (TA_StatsThread *)param;
+   for( i=0; (i < NB_THREAD_CALL) && (work->retCode == TA_SUCCESS); i++ )
+      work->retCode = TA_CallFunc( work->params, 20, 29, &outBegIdx, &outNbElement );
+
+   return 0;
+}
+
+/* TA_GetFuncStats and TA_ResetFuncStats while another thread
+ * is counting. Mostly for running under ThreadSanitizer, the
+ * counts seen meanwhile can only be checked for their bounds.
+ */
+static ErrorNumber testConcurrent( TA_History *history, double *out )
+{
+   const TA_FuncHandle *handle;
+   TA_StatsThread work;
+   TA_FuncStats stats;
+   ErrorNumber retValue;
+   int i;
+#if defined( _WIN32 )
+   HANDLE thread;
+#else
+   pthread_t thread;
+#endif
+
+   if( (TA_GetFuncHandle( "SMA", &handle ) != TA_SUCCESS) ||
+       (TA_ParamHolderAlloc( handle, &work.params ) != TA_SUCCESS) )
+      return TA_TEST_STATS_API_FAILED;
+
+   TA_SetInputParamRealPtr( work.params, 0, history->close );
+   TA_SetOutputParamRealPtr( work.params, 0, out );
+   work.retCode = TA_SUCCESS;
+
+   TA_ResetFuncStats();
+
+#if defined( _WIN32 )
+   thread = CreateThread( NULL, 0, statsThread, &work, 0, NULL );
+   if( !thread )
+#else
+   if( pthread_create( &thread, NULL, statsThread, &work ) != 0 )
+#endif
+   {
+      TA_ParamHolderFree( work.params );
+      return TA_TEST_STATS_API_FAILED;
+   }
+
+   retValue = TA_TEST_PASS;
+   for( i=0; i < 200; i++ )
+   {
+      if( (TA_GetFuncStats( handle, &stats ) != TA_SUCCESS) ||
+          (stats.nbCall > NB_THREAD_CALL) || (stats.nbBar > 10*NB_THREAD_CALL) )
+         retValue = TA_TEST_STATS_BAD_COUNT;
+      if( (i%10) == 0 )
+         TA_ResetFuncStats();
+   }
+
+#if defined( _WIN32 )
+   WaitForSingleObject( thread, INFINITE );
+   CloseHandle( thread );
+#else
+   pthread_join( thread, NULL );
+#endif
+   TA_ParamHolderFree( work.params );
+
+   if( work.retCode != TA_SUCCESS )
+   {
+      printf( "Fail: TA_CallFunc SMA returned %d\n", work.retCode );
+      return TA_TEST_STATS_CALL_FAILED;
+   }
+
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "Fail: SMA counted more calls than done\n" );
+      return retValue;
+   }
+
+   /* Once the thread is done, the counts are exact again. */
+   TA_ResetFuncStats();
+   retValue = checkStats( handle, "SMA", 0, 0 );
+
+   return retValue;
+}
+
+static ErrorNumber checkStats( const TA_FuncHandle *handle, const char *name,
+                               unsigned long long nbCall, unsigned long long nbBar )
+{
+   TA_RetCode retCode;
+   TA_FuncStats stats;
+
+   retCode = TA_GetFuncStats( handle, &stats );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Fail: TA_GetFuncStats %s returned %d\n", name, retCode );
+      return TA_TEST_STATS_API_FAILED;
+   }
+
+   if( (stats.nbCall != nbCall) || (stats.nbBar != nbBar) ||
+       (stats.maxNs > stats.totalNs) ||
+       ((nbCall == 0) && (stats.totalNs || stats.nbAlloc)) )
+   {
+      printf( "Fail: %s nbCall %llu (expected %llu) nbBar %llu (expected %llu)\n",
+              name, stats.nbCall, nbCall, stats.nbBar, nbBar );
+      printf( "      totalNs %llu maxNs %llu nbAlloc %llu\n",
+              stats.totalNs, stats.maxNs, stats.nbAlloc );
+      return TA_TEST_STATS_BAD_COUNT;
+   }
+
+   return TA_TEST_PASS;
+}
@@ -0,0 +1,510 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ *  101826 MF   Test DEMA, TEMA, TRIX, MACD, MACDFIX, SAR and ADOSC.
+ *
+ */
+
+/* Description:
+ *     Test the streaming API (ta_stream.h).
+ *
+ *     The history is fed one price bar at a time and every output
+ *     (all of them for the MACD) must be bit-identical to the batch
+ *     function called once on the whole history.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef enum
+{
+   TST_EMA,
+   TST_RSI,
+   TST_CMO,
+   TST_KAMA,
+   TST_T3,
+   TST_TRANGE,
+   TST_ATR,
+   TST_NATR,
+   TST_PLUS_DM,
+   TST_MINUS_DM,
+   TST_PLUS_DI,
+   TST_MINUS_DI,
+   TST_DX,
+   TST_ADX,
+   TST_ADXR,
+   TST_DEMA,
+   TST_TEMA,
+   TST_TRIX,
+   TST_MACD,
+   TST_MACDFIX,
+   TST_SAR,
+   TST_ADOSC
+} TA_StreamTestId;
+
+typedef struct
+{
+   TA_StreamTestId  id;
+   const char      *name;
+   TA_FuncUnstId    unstId;
+   TA_Integer       unstablePeriod;
+   TA_Compatibility compatibility;
+   TA_Integer       optInTimePeriod; /* MACD and ADOSC: fast period. */
+   TA_Real          optInReal;       /* T3: vFactor. SAR: acceleration. */
+   TA_Integer       optInPeriod2;    /* MACD and ADOSC: slow period. */
+   TA_Integer       optInPeriod3;    /* MACD: signal period. */
+   TA_Real          optInReal2;      /* SAR: maximum. */
+} TA_Test;
+
+/**** Local functions declarations.    ****/
+static ErrorNumber do_test( const TA_History *history,
+                            const TA_Test *test );
+
+static TA_RetCode allocStream( const TA_Test *test, TA_Stream **stream );
+
+static TA_RetCode updateStream( TA_Stream *stream,
+                                const TA_History *history,
+                                const TA_Test *test,
+                                int i,
+                                int *outNBElement );
+
+static TA_RetCode callBatch( const TA_History *history,
+                             const TA_Test *test,
+                             int *outBegIdx,
+                             int *outNBElement,
+                             double *outReal[] );
+
+/**** Local variables definitions.     ****/
+#define DEF (TA_COMPATIBILITY_DEFAULT)
+#define MS  (TA_COMPATIBILITY_METASTOCK)
+
+static TA_Test tableTest[] =
+{
+   { TST_EMA,      "EMA",      TA_FUNC_UNST_EMA,      0,  DEF, 2,  0.0,  0,  0, 0.0 },
+   { TST_EMA,      "EMA",      TA_FUNC_UNST_EMA,      0,  DEF, 30, 0.0,  0,  0, 0.0 },
+   { TST_EMA,      "EMA",      TA_FUNC_UNST_EMA,      10, DEF, 14, 0.0,  0,  0, 0.0 },
+   { TST_EMA,      "EMA",      TA_FUNC_UNST_EMA,      0,  MS,  14, 0.0,  0,  0, 0.0 },
+   { TST_EMA,      "EMA",      TA_FUNC_UNST_EMA,      7,  MS,  14, 0.0,  0,  0, 0.0 },
+   { TST_RSI,      "RSI",      TA_FUNC_UNST_RSI,      0,  DEF, 14, 0.0,  0,  0, 0.0 },
+   { TST_RSI,      "RSI",      TA_FUNC_UNST_RSI,      20, DEF, 14, 0.0,  0,  0, 0.0 },
+   { TST_RSI,      "RSI",      TA_FUNC_UNST_RSI,      0,  MS,  14, 0.0,  0,  0, 0.0 },
+   { TST_RSI,      "RSI",      TA_FUNC_UNST_RSI,      1,  MS,  2,  0.0,  0,  0, 0.0 },
+   { TST_RSI,      "RSI",      TA_FUNC_UNST_RSI,      5,  MS,  9,  0.0,  0,  0, 0.0 },
+   { TST_CMO,      "CMO",      TA_FUNC_UNST_CMO,      0,  DEF, 14, 0.0,  0,  0, 0.0 },
+   { TST_CMO,      "CMO",      TA_FUNC_UNST_CMO,      0,  MS,  14, 0.0,  0,  0, 0.0 },
+   { TST_CMO,      "CMO",      TA_FUNC_UNST_CMO,      3,  MS,  5,  0.0,  0,  0, 0.0 },
+   { TST_KAMA,     "KAMA",     TA_FUNC_UNST_KAMA,     0,  DEF, 10, 0.0,  0,  0, 0.0 },
+   { TST_KAMA,     "KAMA",     TA_FUNC_UNST_KAMA,     15, DEF, 2,  0.0,  0,  0, 0.0 },
+   { TST_T3,       "T3",       TA_FUNC_UNST_T3,       0,  DEF, 5,  0.7,  0,  0, 0.0 },
+   { TST_T3,       "T3",       TA_FUNC_UNST_T3,       4,  DEF, 2,  0.0,  0,  0, 0.0 },
+   { TST_T3,       "T3",       TA_FUNC_UNST_T3,       0,  DEF, 12, 1.0,  0,  0, 0.0 },
+   { TST_TRANGE,   "TRANGE",   TA_FUNC_UNST_ATR,      0,  DEF, 1,  0.0,  0,  0, 0.0 },
+   { TST_ATR,      "ATR",      TA_FUNC_UNST_ATR,      0,  DEF, 1,  0.0,  0,  0, 0.0 },
+   { TST_ATR,      "ATR",      TA_FUNC_UNST_ATR,      0,  DEF, 14, 0.0,  0,  0, 0.0 },
+   { TST_ATR,      "ATR",      TA_FUNC_UNST_ATR,      8,  DEF, 2,  0.0,  0,  0, 0.0 },
+   { TST_NATR,     "NATR",     TA_FUNC_UNST_NATR,     0,  DEF, 14, 0.0,  0,  0, 0.0 },
+   { TST_NATR,     "NATR",     TA_FUNC_UNST_NATR,     6,  DEF, 3,  0.0,  0,  0, 0.0 },
+   { TST_PLUS_DM,  "PLUS_DM",  TA_FUNC_UNST_PLUS_DM,  0,  DEF, 1,  0.0,  0,  0, 0.0 },
+   { TST_PLUS_DM,  "PLUS_DM",  TA_FUNC_UNST_PLUS_DM,  0,  DEF, 14, 0.0,  0,  0, 0.0 },
+   { TST_PLUS_DM,  "PLUS_DM",  TA_FUNC_UNST_PLUS_DM,  9,  DEF, 14, 0.0,  0,  0, 0.0 },
+   { TST_MINUS_DM, "MINUS_DM", TA_FUNC_UNST_MINUS_DM, 0,  DEF, 1,  0.0,  0,  0, 0.0 },
+   { TST_MINUS_DM, "MINUS_DM", TA_FUNC_UNST_MINUS_DM, 3,  DEF, 14, 0.0,  0,  0, 0.0 },
+   { TST_PLUS_DI,  "PLUS_DI",  TA_FUNC_UNST_PLUS_DI,  0,  DEF, 1,  0.0,  0,  0, 0.0 },
+   { TST_PLUS_DI,  "PLUS_DI",  TA_FUNC_UNST_PLUS_DI,  0,  DEF, 14, 0.0,  0,  0, 0.0 },
+   { TST_PLUS_DI,  "PLUS_DI",  TA_FUNC_UNST_PLUS_DI,  11, DEF, 2,  0.0,  0,  0, 0.0 },
+   { TST_MINUS_DI, "MINUS_DI", TA_FUNC_UNST_MINUS_DI, 0,  DEF, 1,  0.0,  0,  0, 0.0 },
+   { TST_MINUS_DI, "MINUS_DI", TA_FUNC_UNST_MINUS_DI, 0,  DEF, 14, 0.0,  0,  0, 0.0 },
+   { TST_MINUS_DI, "MINUS_DI", TA_FUNC_UNST_MINUS_DI, 5,  DEF, 14, 0.0,  0,  0, 0.0 },
+   { TST_DX,       "DX",       TA_FUNC_UNST_DX,       0,  DEF, 14, 0.0,  0,  0, 0.0 },
+   { TST_DX,       "DX",       TA_FUNC_UNST_DX,       12, DEF, 2,  0.0,  0,  0, 0.0 },
+   { TST_ADX,      "ADX",      TA_FUNC_UNST_ADX,      0,  DEF, 14, 0.0,  0,  0, 0.0 },
+   { TST_ADX,      "ADX",      TA_FUNC_UNST_ADX,      30, DEF, 2,  0.0,  0,  0, 0.0 },
+   { TST_ADXR,     "ADXR",     TA_FUNC_UNST_ADX,      0,  DEF, 14, 0.0,  0,  0, 0.0 },
+   { TST_ADXR,     "ADXR",     TA_FUNC_UNST_ADX,      4,  DEF, 3,  0.0,  0,  0, 0.0 },
+   { TST_DEMA,     "DEMA",     TA_FUNC_UNST_EMA,      0,  DEF, 30, 0.0,  0,  0, 0.0 },
+   { TST_DEMA,     "DEMA",     TA_FUNC_UNST_EMA,      5,  DEF, 2,  0.0,  0,  0, 0.0 },
+   { TST_DEMA,     "DEMA",     TA_FUNC_UNST_EMA,      0,  MS,  10, 0.0,  0,  0, 0.0 },
+   { TST_DEMA,     "DEMA",     TA_FUNC_UNST_EMA,      3,  MS,  14, 0.0,  0,  0, 0.0 },
+   { TST_TEMA,     "TEMA",     TA_FUNC_UNST_EMA,      0,  DEF, 30, 0.0,  0,  0, 0.0 },
+   { TST_TEMA,     "TEMA",     TA_FUNC_UNST_EMA,      0,  DEF, 2,  0.0,  0,  0, 0.0 },
+   { TST_TEMA,     "TEMA",     TA_FUNC_UNST_EMA,      4,  MS,  5,  0.0,  0,  0, 0.0 },
+   { TST_TRIX,     "TRIX",     TA_FUNC_UNST_EMA,      0,  DEF, 30, 0.0,  0,  0, 0.0 },
+   { TST_TRIX,     "TRIX",     TA_FUNC_UNST_EMA,      0,  DEF, 2,  0.0,  0,  0, 0.0 },
+   { TST_TRIX,     "TRIX",     TA_FUNC_UNST_EMA,      7,  DEF, 5,  0.0,  0,  0, 0.0 },
+   { TST_TRIX,     "TRIX",     TA_FUNC_UNST_EMA,      0,  MS,  9,  0.0,  0,  0, 0.0 },
+   { TST_MACD,     "MACD",     TA_FUNC_UNST_EMA,      0,  DEF, 12, 0.0,  26, 9, 0.0 },
+   { TST_MACD,     "MACD",     TA_FUNC_UNST_EMA,      0,  DEF, 26, 0.0,  12, 9, 0.0 },
+   { TST_MACD,     "MACD",     TA_FUNC_UNST_EMA,      5,  DEF, 3,  0.0,  10, 2, 0.0 },
+   { TST_MACD,     "MACD",     TA_FUNC_UNST_EMA,      0,  MS,  12, 0.0,  26, 9, 0.0 },
+   { TST_MACD,     "MACD",     TA_FUNC_UNST_EMA,      3,  MS,  5,  0.0,  5,  2, 0.0 },
+   { TST_MACDFIX,  "MACDFIX",  TA_FUNC_UNST_EMA,      0,  DEF, 9,  0.0,  0,  0, 0.0 },
+   { TST_MACDFIX,  "MACDFIX",  TA_FUNC_UNST_EMA,      2,  DEF, 2,  0.0,  0,  0, 0.0 },
+   { TST_MACDFIX,  "MACDFIX",  TA_FUNC_UNST_EMA,      0,  MS,  9,  0.0,  0,  0, 0.0 },
+   { TST_SAR,      "SAR",      TA_FUNC_UNST_EMA,      0,  DEF, 1,  0.02, 0,  0, 0.2 },
+   { TST_SAR,      "SAR",      TA_FUNC_UNST_EMA,      0,  DEF, 1,  0.1,  0,  0, 0.05 },
+   { TST_SAR,      "SAR",      TA_FUNC_UNST_EMA,      0,  DEF, 1,  0.0,  0,  0, 0.0 },
+   { TST_ADOSC,    "ADOSC",    TA_FUNC_UNST_EMA,      0,  DEF, 3,  0.0,  10, 0, 0.0 },
+   { TST_ADOSC,    "ADOSC",    TA_FUNC_UNST_EMA,      6,  DEF, 10, 0.0,  3,  0, 0.0 },
+   { TST_ADOSC,    "ADOSC",    TA_FUNC_UNST_EMA,      0,  MS,  2,  0.0,  2,  0, 0.0 },
+};
+
+#define NB_TEST (sizeof(tableTest)/sizeof(TA_Test))
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_stream( TA_History *history )
+{
+   unsigned int i;
+   ErrorNumber retValue;
+   TA_RetCode retCode;
+   TA_Stream *stream;
+   int outNBElement;
+
+   for( i=0; i < NB_TEST; i++ )
+   {
+      retValue = do_test( history, &tableTest[i] );
+
+      /* Restore the default settings. */
+      TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+      TA_SetCompatibility( TA_COMPATIBILITY_DEFAULT );
+
+      if( retValue != 0 )
+      {
+         printf( "Failed Stream Test #%d for %s (Code=%d)\n",
+                 i, tableTest[i].name, retValue );
+         return retValue;
+      }
+   }
+
+   /* Parameters outside of the range must be refused. */
+   stream = NULL;
+   if( (TA_EMA_StreamAlloc( 1, &stream ) != TA_BAD_PARAM) || stream ||
+       (TA_ADX_StreamAlloc( 100001, &stream ) != TA_BAD_PARAM) || stream ||
+       (TA_T3_StreamAlloc( 5, 1.5, &stream ) != TA_BAD_PARAM) || stream ||
+       (TA_TRIX_StreamAlloc( 1, &stream ) != TA_BAD_PARAM) || stream ||
+       (TA_MACD_StreamAlloc( 12, 26, 1, &stream ) != TA_BAD_PARAM) || stream ||
+       (TA_SAR_StreamAlloc( -0.02, 0.2, &stream ) != TA_BAD_PARAM) || stream ||
+       (TA_ADOSC_StreamAlloc( 1, 10, &stream ) != TA_BAD_PARAM) || stream ||
+       (TA_RSI_StreamAlloc( 14, NULL ) != TA_BAD_PARAM) ||
+       (TA_StreamUpdate( NULL, 1.0, NULL, NULL ) != TA_BAD_PARAM) ||
+       (TA_StreamUpdateHL( NULL, 1.0, 1.0, NULL, NULL ) != TA_BAD_PARAM) ||
+       (TA_StreamLookback( NULL ) != -1) ||
+       (TA_StreamNbOutput( NULL ) != -1) )
+   {
+      printf( "Failed Stream parameter check\n" );
+      return TA_TEST_STREAM_BAD_PARAM_CHECK;
+   }
+
+   /* A price bar stream refuses single values and vice-versa. */
+   retCode = TA_ATR_StreamAlloc( TA_INTEGER_DEFAULT, &stream );
+   if( (retCode != TA_SUCCESS) || (TA_StreamLookback(stream) != 14) )
+   {
+      printf( "Failed Stream default parameter\n" );
+      TA_StreamFree( stream );
+      return TA_TEST_STREAM_BAD_PARAM_CHECK;
+   }
+
+   retCode = TA_StreamUpdate( stream, 1.0, &outNBElement, NULL );
+   TA_StreamFree( stream );
+   if( retCode != TA_BAD_PARAM )
+   {
+      printf( "Failed Stream input type check\n" );
+      return TA_TEST_STREAM_BAD_PARAM_CHECK;
+   }
+
+   retCode = TA_SAR_StreamAlloc( TA_REAL_DEFAULT, TA_REAL_DEFAULT, &stream );
+   if( retCode != TA_SUCCESS )
+      return TA_TEST_STREAM_ALLOC_FAILED;
+
+   retCode = TA_StreamUpdateHLC( stream, 1.0, 1.0, 1.0, &outNBElement, NULL );
+   if( retCode == TA_BAD_PARAM )
+      retCode = TA_StreamUpdateHLCV( stream, 1.0, 1.0, 1.0, 1.0, &outNBElement, NULL );
+   TA_StreamFree( stream );
+   if( retCode != TA_BAD_PARAM )
+   {
+      printf( "Failed Stream input type check\n" );
+      return TA_TEST_STREAM_BAD_PARAM_CHECK;
+   }
+
+   /* All test succeed. */
+   return TA_TEST_PASS;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber do_test( const TA_History *history,
+                            const TA_Test *test )
+{
+   TA_RetCode retCode;
+   ErrorNumber retValue;
+   TA_Stream *stream;
+   double *batchOut[TA_STREAM_MAX_OUTPUT];
+   double outReal[TA_STREAM_MAX_OUTPUT];
+   int outBegIdx, outNBElement, nbBars, nbOutput;
+   int i, j, pass;
+
+   TA_SetUnstablePeriod( test->unstId, test->unstablePeriod );
+   TA_SetCompatibility( test->compatibility );
+
+   nbBars = (int)history->nbBars;
+   batchOut[0] = (double *)malloc( sizeof(double)*nbBars*TA_STREAM_MAX_OUTPUT );
+   if( !batchOut[0] )
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+   for( j=1; j < TA_STREAM_MAX_OUTPUT; j++ )
+      batchOut[j] = batchOut[j-1]+nbBars;
+
+   retCode = callBatch( history, test, &outBegIdx, &outNBElement, batchOut );
+   if( (retCode != TA_SUCCESS) || (outNBElement <= 0) )
+   {
+      printf( "Batch call failed (%d)\n", retCode );
+      free( batchOut[0] );
+      return TA_TEST_STREAM_BATCH_FAILED;
+   }
+
+   retCode = allocStream( test, &stream );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Stream alloc failed (%d)\n", retCode );
+      free( batchOut[0] );
+      return TA_TEST_STREAM_ALLOC_FAILED;
+   }
+
+   retValue = TA_TEST_PASS;
+   if( TA_StreamLookback(stream) != outBegIdx )
+   {
+      printf( "Stream lookback %d != %d\n", TA_StreamLookback(stream), outBegIdx );
+      retValue = TA_TEST_STREAM_BAD_LOOKBACK;
+   }
+
+   nbOutput = ((test->id == TST_MACD) || (test->id == TST_MACDFIX))? 3 : 1;
+   if( TA_StreamNbOutput(stream) != nbOutput )
+   {
+      printf( "Stream has %d outputs instead of %d\n", TA_StreamNbOutput(stream), nbOutput );
+      retValue = TA_TEST_STREAM_BAD_NB_ELEMENT;
+   }
+
+   /* The second pass is done after a reset and must give the same result. */
+   for( pass=0; (pass < 2) && (retValue == TA_TEST_PASS); pass++ )
+   {
+      if( pass == 1 )
+      {
+         retCode = TA_StreamReset( stream );
+         if( retCode != TA_SUCCESS )
+         {
+            retValue = TA_TEST_STREAM_RESET_FAILED;
+            break;
+         }
+      }
+
+      for( i=0; (i < nbBars) && (retValue == TA_TEST_PASS); i++ )
+      {
+         retCode = updateStream( stream, history, test, i, &outNBElement );
+         if( retCode != TA_SUCCESS )
+         {
+            printf( "Stream update failed at bar %d (%d)\n", i, retCode );
+            retValue = TA_TEST_STREAM_UPDATE_FAILED;
+            break;
+         }
+
+         if( outNBElement != (i >= outBegIdx) )
+         {
+            printf( "Stream output availability wrong at bar %d\n", i );
+            retValue = TA_TEST_STREAM_BAD_NB_ELEMENT;
+            break;
+         }
+
+         for( j=0; j < TA_STREAM_MAX_OUTPUT; j++ )
+            outReal[j] = -1.0;
+
+         retCode = TA_StreamPeekAll( stream, &outNBElement, outReal );
+         if( (retCode != TA_SUCCESS) || (outNBElement != ((i >= outBegIdx)? nbOutput : 0)) )
+         {
+            printf( "Stream peek failed at bar %d (%d)\n", i, retCode );
+            retValue = TA_TEST_STREAM_BAD_NB_ELEMENT;
+            break;
+         }
+
+         /* Must be bit-identical to the batch. */
+         for( j=0; j < outNBElement; j++ )
+         {
+            if( memcmp( &outReal[j], &batchOut[j][i-outBegIdx], sizeof(double) ) != 0 )
+            {
+               printf( "Stream output %d at bar %d is %.17g but batch is %.17g (pass %d)\n",
+                       j, i, outReal[j], batchOut[j][i-outBegIdx], pass );
+               retValue = TA_TEST_STREAM_BAD_VALUE;
+               break;
+            }
+         }
+      }
+   }
+
+   TA_StreamFree( stream );
+   free( batchOut[0] );
+
+   return retValue;
+}
+
+/* Add the price bar 'i' with the update function of the stream. */
+static TA_RetCode updateStream( TA_Stream *stream,
+                                const TA_History *history,
+                                const TA_Test *test,
+                                int i,
+                                int *outNBElement )
+{
+   switch( test->id )
+   {
+   case TST_EMA:
+   case TST_RSI:
+   case TST_CMO:
+   case TST_KAMA:
+   case TST_T3:
+   case TST_DEMA:
+   case TST_TEMA:
+   case TST_TRIX:
+   case TST_MACD:
+   case TST_MACDFIX:
+      return TA_StreamUpdate( stream, history->close[i], outNBElement, NULL );
+   case TST_SAR:
+      return TA_StreamUpdateHL( stream, history->high[i], history->low[i],
+                                outNBElement, NULL );
+   case TST_ADOSC:
+      return TA_StreamUpdateHLCV( stream, history->high[i], history->low[i],
+                                  history->close[i], history->volume[i],
+                                  outNBElement, NULL );
+   default:
+      return TA_StreamUpdateHLC( stream, history->high[i], history->low[i],
+                                 history->close[i], outNBElement, NULL );
+   }
+}
+
+static TA_RetCode allocStream( const TA_Test *test, TA_Stream **stream )
+{
+   switch( test->id )
+   {
+   case TST_EMA:      return TA_EMA_StreamAlloc( test->optInTimePeriod, stream );
+   case TST_RSI:      return TA_RSI_StreamAlloc( test->optInTimePeriod, stream );
+   case TST_CMO:      return TA_CMO_StreamAlloc( test->optInTimePeriod, stream );
+   case TST_KAMA:     return TA_KAMA_StreamAlloc( test->optInTimePeriod, stream );
+   case TST_T3:       return TA_T3_StreamAlloc( test->optInTimePeriod, test->optInReal, stream );
+   case TST_TRANGE:   return TA_TRANGE_StreamAlloc( stream );
+   case TST_ATR:      return TA_ATR_StreamAlloc( test->optInTimePeriod, stream );
+   case TST_NATR:     return TA_NATR_StreamAlloc( test->optInTimePeriod, stream );
+   case TST_PLUS_DM:  return TA_PLUS_DM_StreamAlloc( test->optInTimePeriod, stream );
+   case TST_MINUS_DM: return TA_MINUS_DM_StreamAlloc( test->optInTimePeriod, stream );
+   case TST_PLUS_DI:  return TA_PLUS_DI_StreamAlloc( test->optInTimePeriod, stream );
+   case TST_MINUS_DI: return TA_MINUS_DI_StreamAlloc( test->optInTimePeriod, stream );
+   case TST_DX:       return TA_DX_StreamAlloc( test->optInTimePeriod, stream );
+   case TST_ADX:      return TA_ADX_StreamAlloc( test->optInTimePeriod, stream );
+   case TST_ADXR:     return TA_ADXR_StreamAlloc( test->optInTimePeriod, stream );
+   case TST_DEMA:     return TA_DEMA_StreamAlloc( test->optInTimePeriod, stream );
+   case TST_TEMA:     return TA_TEMA_StreamAlloc( test->optInTimePeriod, stream );
+   case TST_TRIX:     return TA_TRIX_StreamAlloc( test->optInTimePeriod, stream );
+   case TST_MACD:     return TA_MACD_StreamAlloc( test->optInTimePeriod, test->optInPeriod2, test->optInPeriod3, stream );
+   case TST_MACDFIX:  return TA_MACDFIX_StreamAlloc( test->optInTimePeriod, stream );
+   case TST_SAR:      return TA_SAR_StreamAlloc( test->optInReal, test->optInReal2, stream );
+   case TST_ADOSC:    return TA_ADOSC_StreamAlloc( test->optInTimePeriod, test->optInPeriod2, stream );
+   }
+
+   return TA_BAD_PARAM;
+}
+
+static TA_RetCode callBatch( const TA_History *history,
+                             const TA_Test *test,
+                             int *outBegIdx,
+                             int *outNBElement,
+                             double *out[] )
+{
+   int endIdx = history->nbBars-1;
+   const double *h = history->high;
+   const double *l = history->low;
+   const double *c = history->close;
+   const double *v = history->volume;
+   int period = test->optInTimePeriod;
+   double *outReal = out[0];
+
+   switch( test->id )
+   {
+   case TST_EMA:      return TA_EMA( 0, endIdx, c, period, outBegIdx, outNBElement, outReal );
+   case TST_RSI:      return TA_RSI( 0, endIdx, c, period, outBegIdx, outNBElement, outReal );
+   case TST_CMO:      return TA_CMO( 0, endIdx, c, period, outBegIdx, outNBElement, outReal );
+   case TST_KAMA:     return TA_KAMA( 0, endIdx, c, period, outBegIdx, outNBElement, outReal );
+   case TST_T3:       return TA_T3( 0, endIdx, c, period, test->optInReal, outBegIdx, outNBElement, outReal );
+   case TST_TRANGE:   return TA_TRANGE( 0, endIdx, h, l, c, outBegIdx, outNBElement, outReal );
+   case TST_ATR:      return TA_ATR( 0, endIdx, h, l, c, period, outBegIdx, outNBElement, outReal );
+   case TST_NATR:     return TA_NATR( 0, endIdx, h, l, c, period, outBegIdx, outNBElement, outReal );
+   case TST_PLUS_DM:  return TA_PLUS_DM( 0, endIdx, h, l, period, outBegIdx, outNBElement, outReal );
+   case TST_MINUS_DM: return TA_MINUS_DM( 0, endIdx, h, l, period, outBegIdx, outNBElement, outReal );
+   case TST_PLUS_DI:  return TA_PLUS_DI( 0, endIdx, h, l, c, period, outBegIdx, outNBElement, outReal );
+   case TST_MINUS_DI: return TA_MINUS_DI( 0, endIdx, h, l, c, period, outBegIdx, outNBElement, outReal );
+   case TST_DX:       return TA_DX( 0, endIdx, h, l, c, period, outBegIdx, outNBElement, outReal );
+   case TST_ADX:      return TA_ADX( 0, endIdx, h, l, c, period, outBegIdx, outNBElement, outReal );
+   case TST_ADXR:     return TA_ADXR( 0, endIdx, h, l, c, period, outBegIdx, outNBElement, outReal );
+   case TST_DEMA:     return TA_DEMA( 0, endIdx, c, period, outBegIdx, outNBElement, outReal );
+   case TST_TEMA:     return TA_TEMA( 0, endIdx, c, period, outBegIdx, outNBElement, outReal );
+   case TST_TRIX:     return TA_TRIX( 0, endIdx, c, period, outBegIdx, outNBElement, outReal );
+   case TST_MACD:     return TA_MACD( 0, endIdx, c, period, test->optInPeriod2, test->optInPeriod3,
+                                      outBegIdx, outNBElement, out[0], out[1], out[2] );
+   case TST_MACDFIX:  return TA_MACDFIX( 0, endIdx, c, period,
+                                         outBegIdx, outNBElement, out[0], out[1], out[2] );
+   case TST_SAR:      return TA_SAR( 0, endIdx, h, l, test->optInReal, test->optInReal2, outBegIdx, outNBElement, outReal );
+   case TST_ADOSC:    return TA_ADOSC( 0, endIdx, h, l, c, v, period, test->optInPeriod2, outBegIdx, outNBElement, outReal );
+   }
+
+   return TA_BAD_PARAM;
+}
@@ -0,0 +1,398 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ *
+ */
+
+/* Description:
+ *     Test the element-wise functions calculated with the SIMD
+ *     instructions (see ta_vec.c):
+ *       - The math operators and price transforms are identical
+ *         to the scalar loop.
+ *       - TA_MATH_STRICT is identical to the C library.
+ *       - TA_MATH_FAST is within the documented ulp of the C library,
+ *         and identical whatever the instructions used.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef TA_RetCode (*TA_MathFunc)( int, int, const double[], int *, int *, double[] );
+typedef TA_RetCode (*TA_MathFuncS)( int, int, const float[], int *, int *, double[] );
+
+typedef struct
+{
+   const char  *name;
+   TA_MathFunc  func;
+   TA_MathFuncS funcS;
+   double     (*libm)( double );
+   double       min, max; /* Range of the inputs. */
+} TA_VecMathTest;
+
+static TA_VecMathTest tableMath[] =
+{
+   { "EXP",   TA_EXP,   TA_S_EXP,   exp,   -50.0,  50.0 },
+   { "LN",    TA_LN,    TA_S_LN,    log,   1.0e-3, 1.0e3 },
+   { "LOG10", TA_LOG10, TA_S_LOG10, log10, 1.0e-3, 1.0e3 },
+   { "SIN",   TA_SIN,   TA_S_SIN,   sin,   -100.0, 100.0 },
+   { "COS",   TA_COS,   TA_S_COS,   cos,   -100.0, 100.0 },
+   { "TAN",   TA_TAN,   TA_S_TAN,   tan,   -100.0, 100.0 },
+   { "ASIN",  TA_ASIN,  TA_S_ASIN,  asin,  -1.0,   1.0 },
+   { "ACOS",  TA_ACOS,  TA_S_ACOS,  acos,  -1.0,   1.0 },
+   { "ATAN",  TA_ATAN,  TA_S_ATAN,  atan,  -50.0,  50.0 },
+   { "SINH",  TA_SINH,  TA_S_SINH,  sinh,  -20.0,  20.0 },
+   { "COSH",  TA_COSH,  TA_S_COSH,  cosh,  -20.0,  20.0 },
+   { "TANH",  TA_TANH,  TA_S_TANH,  tanh,  -5.0,   5.0 },
+   { "SQRT",  TA_SQRT,  TA_S_SQRT,  sqrt,   0.0,   1.0e4 },
+   { "CEIL",  TA_CEIL,  TA_S_CEIL,  ceil,  -100.0, 100.0 },
+   { "FLOOR", TA_FLOOR, TA_S_FLOOR, floor, -100.0, 100.0 }
+};
+
+#define NB_MATH_TEST (sizeof(tableMath)/sizeof(TA_VecMathTest))
+
+/* Documented in ta_common.h (TA_MathMode), plus the
+ * error of the C library used as the reference.
+ */
+#define MAX_ULP 5.0
+
+/* Handled by the C library even in TA_MATH_FAST. */
+#define NB_SPECIAL 16
+
+typedef struct
+{
+   int nbBars;      /* Bars followed by the special values. */
+   double *x;       /* Inputs of one math function. */
+   float  *xs;      /* Same in single precision... */
+   double *xp;      /* ...and promoted back to double. */
+   double *out;
+   double *outS;
+   double *ref;
+   double *fast;    /* Outputs of TA_MATH_FAST at the first level. */
+} TA_VecBuffers;
+
+/**** Local functions declarations.    ****/
+static ErrorNumber testArith( const TA_History *history, TA_VecBuffers *buf,
+                              int startIdx, int endIdx );
+static ErrorNumber testMath( const TA_VecMathTest *test, const TA_History *history,
+                             TA_VecBuffers *buf, int firstLevel );
+static ErrorNumber checkMath( const TA_VecMathTest *test, const char *mode,
+                              const double *x, int nb,
+                              const double *out, const double *ref, double maxUlp );
+static double ulpDiff( double value, double ref );
+
+/**** Local variables definitions.     ****/
+static const double specialValue[NB_SPECIAL] =
+{
+   0.0, -0.0, 1.0, -1.0, 0.5, 2.0, -2.0, 1.0e-300, -1.0e-300, 1.0e300,
+   710.0, -710.0, 1.0e7, -1.0e7, HUGE_VAL, -HUGE_VAL
+};
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_vector( TA_History *history )
+{
+   ErrorNumber retValue;
+   TA_VecBuffers buf;
+   TA_VecLevel level, detected;
+   double *buffer;
+   int i, nb, nbBars;
+
+   /* Strict by default, and only the two modes are accepted. */
+   if( (TA_GetMathMode() != TA_MATH_STRICT) ||
+       (TA_SetMathMode( (TA_MathMode)2 ) != TA_BAD_PARAM) )
+   {
+      printf( "Fail: default or invalid TA_MathMode\n" );
+      return TA_TEST_VEC_BAD_MODE;
+   }
+
+   nb = (int)history->nbBars+NB_SPECIAL;
+   buffer = (double *)malloc( sizeof(double)*(6+NB_MATH_TEST)*nb );
+   if( !buffer )
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+
+   buf.nbBars = nb;
+   buf.x      = buffer;
+   buf.xp     = &buffer[nb];
+   buf.out    = &buffer[2*nb];
+   buf.outS   = &buffer[3*nb];
+   buf.ref    = &buffer[4*nb];
+   buf.xs     = (float *)&buffer[5*nb];
+   buf.fast   = &buffer[6*nb];
+
+   detected = TA_INT_VecGetLevel();
+   if( detected == TA_VEC_LEVEL_NONE )
+      detected = TA_VEC_LEVEL_SSE2; /* Test the scalar loops once. */
+
+   retValue = TA_TEST_PASS;
+   for( level=TA_VEC_LEVEL_SSE2; (level <= detected) && (retValue == TA_TEST_PASS); level++ )
+   {
+      TA_INT_VecSetLevel( level );
+
+      /* All the bars, an odd number of bars at an odd
+       * offset, and less than one vector.
+       */
+      nbBars = (int)history->nbBars;
+      retValue = testArith( history, &buf, 0, nbBars-1 );
+      if( retValue == TA_TEST_PASS )
+         retValue = testArith( history, &buf, 1, nbBars-3 );
+      if( retValue == TA_TEST_PASS )
+         retValue = testArith( history, &buf, 5, 7 );
+
+      for( i=0; (i < (int)NB_MATH_TEST) && (retValue == TA_TEST_PASS); i++ )
+         retValue = testMath( &tableMath[i], history, &buf, level == TA_VEC_LEVEL_SSE2 );
+   }
+
+   TA_SetMathMode( TA_MATH_STRICT );
+   TA_INT_VecSetLevel( TA_VEC_LEVEL_NONE );
+
+   free( buffer );
+
+   return retValue;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber testArith( const TA_History *history, TA_VecBuffers *buf,
+                              int startIdx, int endIdx )
+{
+   static const char *name[8] =
+   { "ADD", "SUB", "MULT", "DIV", "AVGPRICE", "MEDPRICE", "TYPPRICE", "WCLPRICE" };
+   const double *o, *h, *l, *c;
+   TA_RetCode retCode;
+   int outBegIdx, outNBElement;
+   int i, j;
+
+   o = history->open;
+   h = history->high;
+   l = history->low;
+   c = history->close;
+
+   for( j=0; j < 8; j++ )
+   {
+      switch( j )
+      {
+      case 0: retCode = TA_ADD( startIdx, endIdx, h, l, &outBegIdx, &outNBElement, buf->out ); break;
+      case 1: retCode = TA_SUB( startIdx, endIdx, h, l, &outBegIdx, &outNBElement, buf->out ); break;
+      case 2: retCode = TA_MULT( startIdx, endIdx, h, l, &outBegIdx, &outNBElement, buf->out ); break;
+      case 3: retCode = TA_DIV( startIdx, endIdx, c, o, &outBegIdx, &outNBElement, buf->out ); break;
+      case 4: retCode = TA_AVGPRICE( startIdx, endIdx, o, h, l, c, &outBegIdx, &outNBElement, buf->out ); break;
+      case 5: retCode = TA_MEDPRICE( startIdx, endIdx, h, l, &outBegIdx, &outNBElement, buf->out ); break;
+      case 6: retCode = TA_TYPPRICE( startIdx, endIdx, h, l, c, &outBegIdx, &outNBElement, buf->out ); break;
+      default: retCode = TA_WCLPRICE( startIdx, endIdx, h, l, c, &outBegIdx, &outNBElement, buf->out ); break;
+      }
+
+      if( (retCode != TA_SUCCESS) || (outBegIdx != startIdx) ||
+          (outNBElement != endIdx-startIdx+1) )
+      {
+         printf( "Fail: %s level %d returned %d\n", name[j], TA_INT_VecGetLevel(), retCode );
+         return TA_TEST_VEC_CALL_FAILED;
+      }
+
+      /* The same expressions as the original loops. */
+      for( i=startIdx; i <= endIdx; i++ )
+      {
+         switch( j )
+         {
+         case 0: buf->ref[i-startIdx] = h[i]+l[i]; break;
+         case 1: buf->ref[i-startIdx] = h[i]-l[i]; break;
+         case 2: buf->ref[i-startIdx] = h[i]*l[i]; break;
+         case 3: buf->ref[i-startIdx] = c[i]/o[i]; break;
+         case 4: buf->ref[i-startIdx] = (h[i]+l[i]+c[i]+o[i])/4; break;
+         case 5: buf->ref[i-startIdx] = (h[i]+l[i])/2.0; break;
+         case 6: buf->ref[i-startIdx] = (h[i]+l[i]+c[i])/3.0; break;
+         default: buf->ref[i-startIdx] = (h[i]+l[i]+(c[i]*2.0))/4.0; break;
+         }
+      }
+
+      if( memcmp( buf->out, buf->ref, sizeof(double)*outNBElement ) != 0 )
+      {
+         printf( "Fail: %s level %d not identical to the scalar loop\n",
+                 name[j], TA_INT_VecGetLevel() );
+         return TA_TEST_VEC_NOT_SAME;
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber testMath( const TA_VecMathTest *test, const TA_History *history,
+                             TA_VecBuffers *buf, int firstLevel )
+{
+   ErrorNumber retValue;
+   TA_RetCode retCode;
+   double *fast;
+   double lowest, highest;
+   int outBegIdx, outNBElement;
+   int i, nb, mode;
+
+   /* The closes scaled to the range, followed by the special values. */
+   nb = (int)history->nbBars;
+   lowest = highest = history->close[0];
+   for( i=1; i < nb; i++ )
+   {
+      if( history->close[i] < lowest )  lowest  = history->close[i];
+      if( history->close[i] > highest ) highest = history->close[i];
+   }
+   for( i=0; i < nb; i++ )
+      buf->x[i] = test->min+(test->max-test->min)*(history->close[i]-lowest)/(highest-lowest);
+   for( i=0; i < NB_SPECIAL; i++ )
+      buf->x[nb+i] = specialValue[i];
+
+   nb = buf->nbBars;
+   for( i=0; i < nb; i++ )
+   {
+      buf->ref[i] = test->libm( buf->x[i] );
+      buf->xs[i]  = (float)buf->x[i];
+      buf->xp[i]  = buf->xs[i];
+   }
+
+   fast = &buf->fast[(test-tableMath)*nb];
+
+   retValue = TA_TEST_PASS;
+   for( mode=TA_MATH_STRICT; (mode <= TA_MATH_FAST) && (retValue == TA_TEST_PASS); mode++ )
+   {
+      TA_SetMathMode( (TA_MathMode)mode );
+
+      /* Start at an odd offset, to not be aligned. */
+      retCode = test->func( 1, nb-1, buf->x, &outBegIdx, &outNBElement, buf->out );
+      if( (retCode != TA_SUCCESS) || (outBegIdx != 1) || (outNBElement != nb-1) )
+      {
+         printf( "Fail: %s returned %d\n", test->name, retCode );
+         retValue = TA_TEST_VEC_CALL_FAILED;
+         break;
+      }
+
+      if( mode == TA_MATH_STRICT )
+         retValue = checkMath( test, "strict", &buf->x[1], nb-1, buf->out, &buf->ref[1], 0.0 );
+      else
+      {
+         retValue = checkMath( test, "fast", &buf->x[1], nb-1, buf->out, &buf->ref[1], MAX_ULP );
+
+         if( firstLevel )
+            memcpy( fast, buf->out, sizeof(double)*(nb-1) );
+         else if( (retValue == TA_TEST_PASS) &&
+                  (memcmp( fast, buf->out, sizeof(double)*(nb-1) ) != 0) )
+         {
+            printf( "Fail: %s level %d not identical to SSE2\n",
+                    test->name, TA_INT_VecGetLevel() );
+            retValue = TA_TEST_VEC_NOT_SAME;
+         }
+      }
+      if( retValue != TA_TEST_PASS )
+         break;
+
+      /* The float inputs give the same outputs as when promoted to double. */
+      retCode = test->func( 1, nb-1, buf->xp, &outBegIdx, &outNBElement, buf->out );
+      if( retCode == TA_SUCCESS )
+         retCode = test->funcS( 1, nb-1, buf->xs, &outBegIdx, &outNBElement, buf->outS );
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "Fail: TA_S_%s returned %d\n", test->name, retCode );
+         retValue = TA_TEST_VEC_CALL_FAILED;
+      }
+      else if( memcmp( buf->out, buf->outS, sizeof(double)*(nb-1) ) != 0 )
+      {
+         printf( "Fail: TA_S_%s not identical to TA_%s\n", test->name, test->name );
+         retValue = TA_TEST_VEC_NOT_SAME;
+      }
+   }
+
+   TA_SetMathMode( TA_MATH_STRICT );
+
+   return retValue;
+}
+
+static ErrorNumber checkMath( const TA_VecMathTest *test, const char *mode,
+                              const double *x, int nb,
+                              const double *out, const double *ref, double maxUlp )
+{
+   int i;
+
+   for( i=0; i < nb; i++ )
+   {
+      if( maxUlp == 0.0 )
+      {
+         if( memcmp( &out[i], &ref[i], sizeof(double) ) == 0 )
+            continue;
+      }
+      else if( isnan(ref[i])? isnan(out[i]) : (ulpDiff( out[i], ref[i] ) <= maxUlp) )
+         continue;
+
+      printf( "Fail: %s (%s) of %.17g is %.17g instead of %.17g\n",
+              test->name, mode, x[i], out[i], ref[i] );
+      return TA_TEST_VEC_NOT_ACCURATE;
+   }
+
+   return TA_TEST_PASS;
+}
+
+static double ulpDiff( double value, double ref )
+{
+   double ulp;
+
+   if( value == ref )
+      return 0.0;
+   if( isinf(ref) || isinf(value) || isnan(value) )
+      return HUGE_VAL;
+
+   ulp = nextafter( fabs(ref), HUGE_VAL )-fabs(ref);
+   return fabs(value-ref)/ulp;
+}
@@ -0,0 +1,753 @@
+/* TA-LIB Copyright (c) 1999-2025, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  MF       Mario Fortier
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 MF   First version.
+ *
+ */
+
+/* Description:
+ *     Test that TA_XXX_WS gives the same output as TA_XXX with a
+ *     workspace of exactly TA_XXX_Workspace double, without taking
+ *     any buffer from the heap. TA_XXX_WS rejects a workspace too
+ *     small, and the buffers not fitting in the thread workspace are
+ *     taken from the heap.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_func_ext.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef enum
+{
+   WS_DEMA, WS_TEMA, WS_TRIX, WS_MA, WS_APO, WS_PPO, WS_MACD, WS_MACDEXT,
+   WS_STOCHF, WS_STOCH, WS_STOCHRSI, WS_NATR, WS_ADXR, WS_CCI, WS_MFI
+} TA_WsFunc;
+
+/* The periods and MA types are in the same order
+ * as the parameters of the function.
+ */
+typedef struct
+{
+   TA_WsFunc  func;
+   const char *name;
+   int        p[4];
+   TA_MAType  ma[3];
+} TA_WsTest;
+
+typedef struct
+{
+   const double *high, *low, *close, *volume;
+   float *highFloat, *lowFloat, *closeFloat, *volumeFloat;
+} TA_WsInputs;
+
+/* Allocations from the heap during a call. */
+typedef struct
+{
+   int nbAlloc;
+   int nbFree;
+} TA_WsCount;
+
+#define SMA  TA_MAType_SMA
+#define EMA  TA_MAType_EMA
+#define WMA  TA_MAType_WMA
+#define DEMA TA_MAType_DEMA
+#define TEMA TA_MAType_TEMA
+#define TRIM TA_MAType_TRIMA
+#define KAMA TA_MAType_KAMA
+#define MAMA TA_MAType_MAMA
+#define T3   TA_MAType_T3
+
+/* Periods over 64 (WINDOW_EXTREME), 30 (CCI), 50 (MFI) and
+ * 128 (CCI tree) make these functions allocate more.
+ */
+static TA_WsTest tableTest[] =
+{
+   { WS_DEMA,     "DEMA",     {2},            {SMA} },
+   { WS_DEMA,     "DEMA",     {30},           {SMA} },
+   { WS_DEMA,     "DEMA",     {100},          {SMA} },
+   { WS_TEMA,     "TEMA",     {2},            {SMA} },
+   { WS_TEMA,     "TEMA",     {30},           {SMA} },
+   { WS_TRIX,     "TRIX",     {2},            {SMA} },
+   { WS_TRIX,     "TRIX",     {30},           {SMA} },
+   { WS_MA,       "MA",       {1},            {DEMA} },
+   { WS_MA,       "MA",       {30},           {SMA} },
+   { WS_MA,       "MA",       {30},           {EMA} },
+   { WS_MA,       "MA",       {30},           {WMA} },
+   { WS_MA,       "MA",       {30},           {DEMA} },
+   { WS_MA,       "MA",       {30},           {TEMA} },
+   { WS_MA,       "MA",       {30},           {TRIM} },
+   { WS_MA,       "MA",       {30},           {KAMA} },
+   { WS_MA,       "MA",       {30},           {MAMA} },
+   { WS_MA,       "MA",       {30},           {T3} },
+   { WS_APO,      "APO",      {12,26},        {SMA} },
+   { WS_APO,      "APO",      {26,12},        {DEMA} },
+   { WS_APO,      "APO",      {5,40},         {MAMA} },
+   { WS_PPO,      "PPO",      {12,26},        {TEMA} },
+   { WS_PPO,      "PPO",      {26,5},         {DEMA} },
+   { WS_MACD,     "MACD",     {12,26,9},      {SMA} },
+   { WS_MACD,     "MACD",     {26,12,2},      {SMA} },
+   { WS_MACD,     "MACD",     {3,100,20},     {SMA} },
+   { WS_MACDEXT,  "MACDEXT",  {12,26,9},      {SMA,SMA,SMA} },
+   { WS_MACDEXT,  "MACDEXT",  {12,26,9},      {DEMA,TEMA,MAMA} },
+   { WS_MACDEXT,  "MACDEXT",  {30,5,20},      {TEMA,MAMA,DEMA} },
+   { WS_STOCHF,   "STOCHF",   {5,3},          {SMA} },
+   { WS_STOCHF,   "STOCHF",   {100,10},       {DEMA} },
+   { WS_STOCHF,   "STOCHF",   {70,1},         {TEMA} },
+   { WS_STOCH,    "STOCH",    {5,3,3},        {SMA,SMA} },
+   { WS_STOCH,    "STOCH",    {100,10,5},     {DEMA,TEMA} },
+   { WS_STOCH,    "STOCH",    {80,3,3},       {MAMA,DEMA} },
+   { WS_STOCHRSI, "STOCHRSI", {14,5,3},       {SMA} },
+   { WS_STOCHRSI, "STOCHRSI", {14,100,10},    {DEMA} },
+   { WS_STOCHRSI, "STOCHRSI", {30,70,5},      {TEMA} },
+   { WS_NATR,     "NATR",     {1},            {SMA} },
+   { WS_NATR,     "NATR",     {14},           {SMA} },
+   { WS_NATR,     "NATR",     {100},          {SMA} },
+   { WS_ADXR,     "ADXR",     {2},            {SMA} },
+   { WS_ADXR,     "ADXR",     {14},           {SMA} },
+   { WS_ADXR,     "ADXR",     {100},          {SMA} },
+   { WS_CCI,      "CCI",      {14},           {SMA} },
+   { WS_CCI,      "CCI",      {50},           {SMA} },
+   { WS_CCI,      "CCI",      {128},          {SMA} },
+   { WS_CCI,      "CCI",      {40},           {SMA} },
+   { WS_MFI,      "MFI",      {14},           {SMA} },
+   { WS_MFI,      "MFI",      {60},           {SMA} }
+};
+
+#define NB_TEST (sizeof(tableTest)/sizeof(TA_WsTest))
+
+/**** Local functions declarations.    ****/
+static ErrorNumber doTest( const TA_WsTest *test, const TA_WsInputs *in,
+                           int startIdx, int endIdx, int useFloat,
+                           double *outRef, double *outWS );
+
+static int workspaceSize( const TA_WsTest *test, int startIdx, int endIdx );
+
+static TA_RetCode callFunc( const TA_WsTest *test, const TA_WsInputs *in,
+                            int startIdx, int endIdx, int useFloat,
+                            int useWorkspace, double *workspace, int workspaceSize,
+                            int *outBegIdx, int *outNBElement, double *out[3] );
+
+static ErrorNumber checkSame( const TA_WsTest *test, int nbOut, int startIdx, int endIdx,
+                              int refBegIdx, int refNBElement, double *ref[3],
+                              int outBegIdx, int outNBElement, double *out[3] );
+
+static void *countAlloc( void *opaque, size_t size );
+static void countFree( void *opaque, void *ptr, size_t size );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_workspace( TA_History *history )
+{
+   ErrorNumber retValue;
+   TA_WsInputs in;
+   double *outRef, *outWS;
+   int nbBars, i, j, k, useFloat;
+   int range[4][2];
+
+   nbBars = (int)history->nbBars;
+   if( nbBars < 252 )
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+
+   in.high   = history->high;
+   in.low    = history->low;
+   in.close  = history->close;
+   in.volume = history->volume;
+
+   in.highFloat = (float *)malloc( sizeof(float)*4*nbBars );
+   outRef       = (double *)malloc( sizeof(double)*6*nbBars );
+   if( !in.highFloat || !outRef )
+   {
+      free( in.highFloat );
+      free( outRef );
+      return TA_TESTUTIL_TFRR_BAD_PARAM;
+   }
+   in.lowFloat    = &in.highFloat[nbBars];
+   in.closeFloat  = &in.highFloat[2*nbBars];
+   in.volumeFloat = &in.highFloat[3*nbBars];
+   outWS          = &outRef[3*nbBars];
+
+   for( i=0; i < nbBars; i++ )
+   {
+      in.highFloat[i]   = (float)history->high[i];
+      in.lowFloat[i]    = (float)history->low[i];
+      in.closeFloat[i]  = (float)history->close[i];
+      in.volumeFloat[i] = (float)history->volume[i];
+   }
+
+   /* All the bars, a part of them, a single bar and a
+    * range ending before any output.
+    */
+   range[0][0] = 0;        range[0][1] = nbBars-1;
+   range[1][0] = 100;      range[1][1] = 200;
+   range[2][0] = nbBars-1; range[2][1] = nbBars-1;
+   range[3][0] = 0;        range[3][1] = 10;
+
+   retValue = TA_TEST_PASS;
+   for( k=0; (k < 2) && (retValue == TA_TEST_PASS); k++ )
+   {
+      /* The size depends on the unstable period. */
+      TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, k*20 );
+
+      for( i=0; (i < (int)NB_TEST) && (retValue == TA_TEST_PASS); i++ )
+      {
+         for( j=0; (j < 4) && (retValue == TA_TEST_PASS); j++ )
+         {
+            for( useFloat=0; (useFloat < 2) && (retValue == TA_TEST_PASS); useFloat++ )
+               retValue = doTest( &tableTest[i], &in, range[j][0], range[j][1],
+                                  useFloat, outRef, outWS );
+         }
+      }
+   }
+   TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+
+   free( in.highFloat );
+   free( outRef );
+
+   return retValue;
+}
+
+/**** Local functions definitions.     ****/
+static ErrorNumber doTest( const TA_WsTest *test, const TA_WsInputs *in,
+                           int startIdx, int endIdx, int useFloat,
+                           double *outRef, double *outWS )
+{
+   ErrorNumber retValue;
+   TA_RetCode retCode;
+   TA_Allocator allocator;
+   TA_WsCount count;
+   TA_Workspace threadWorkspace;
+   double *workspace, *ref[3], *out[3];
+   int size, nbOut, refBegIdx, refNBElement, outBegIdx, outNBElement;
+   int nbValue, i;
+
+   nbValue = endIdx-startIdx+1;
+   for( i=0; i < 3; i++ )
+   {
+      ref[i] = &outRef[i*nbValue];
+      out[i] = &outWS[i*nbValue];
+   }
+   nbOut = (test->func == WS_MACD) || (test->func == WS_MACDEXT)? 3 :
+           (test->func == WS_STOCH) || (test->func == WS_STOCHF) ||
+           (test->func == WS_STOCHRSI)? 2 : 1;
+
+   size = workspaceSize( test, startIdx, endIdx );
+   if( size < 0 )
+   {
+      printf( "TA_%s_Workspace failed for [%d,%d]\n", test->name, startIdx, endIdx );
+      return TA_TEST_WORKSPACE_CALL_FAILED;
+   }
+
+   retCode = callFunc( test, in, startIdx, endIdx, useFloat, 0, NULL, 0,
+                       &refBegIdx, &refNBElement, ref );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_%s failed (%d)\n", test->name, retCode );
+      return TA_TEST_WORKSPACE_CALL_FAILED;
+   }
+
+   /* Exactly the size requested, the unused parts are not
+    * written.
+    */
+   workspace = NULL;
+   if( size > 0 )
+   {
+      workspace = (double *)malloc( sizeof(double)*size );
+      if( !workspace )
+         return TA_TESTUTIL_TFRR_BAD_PARAM;
+   }
+
+   /* Every temporary buffer fits in the workspace. */
+   allocator.allocFunc = countAlloc;
+   allocator.freeFunc  = countFree;
+   allocator.opaque    = &count;
+   memset( &count, 0, sizeof(count) );
+
+   retValue = TA_TEST_WORKSPACE_CALL_FAILED;
+   memset( outWS, 0, sizeof(double)*3*nbValue );
+   TA_SetThreadAllocator( &allocator );
+   retCode = callFunc( test, in, startIdx, endIdx, useFloat, 1, workspace, size,
+                       &outBegIdx, &outNBElement, out );
+   TA_SetThreadAllocator( NULL );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_%s_WS failed (%d) for [%d,%d] with %d double\n",
+              test->name, retCode, startIdx, endIdx, size );
+      goto cleanup;
+   }
+
+   retValue = checkSame( test, nbOut, startIdx, endIdx, refBegIdx, refNBElement, ref,
+                         outBegIdx, outNBElement, out );
+   if( retValue != TA_TEST_PASS )
+      goto cleanup;
+
+   retValue = TA_TEST_WORKSPACE_HEAP_USED;
+   if( count.nbAlloc != 0 )
+   {
+      printf( "TA_%s_WS took %d buffers from the heap for [%d,%d]\n",
+              test->name, count.nbAlloc, startIdx, endIdx );
+      goto cleanup;
+   }
+
+   /* A thread workspace too small: what does not fit is
+    * taken from the heap and freed.
+    */
+   if( size > 0 )
+   {
+      threadWorkspace.begin = workspace;
+      threadWorkspace.next  = workspace;
+      threadWorkspace.end   = workspace+size-1;
+
+      retValue = TA_TEST_WORKSPACE_CALL_FAILED;
+      memset( outWS, 0, sizeof(double)*3*nbValue );
+      TA_SetThreadAllocator( &allocator );
+      TA_ThreadWorkspace = &threadWorkspace;
+      retCode = callFunc( test, in, startIdx, endIdx, useFloat, 0, NULL, 0,
+                          &outBegIdx, &outNBElement, out );
+      TA_ThreadWorkspace = NULL;
+      TA_SetThreadAllocator( NULL );
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "TA_%s failed (%d) with a thread workspace too small\n", test->name, retCode );
+         goto cleanup;
+      }
+
+      retValue = checkSame( test, nbOut, startIdx, endIdx, refBegIdx, refNBElement, ref,
+                            outBegIdx, outNBElement, out );
+      if( retValue != TA_TEST_PASS )
+         goto cleanup;
+
+      retValue = TA_TEST_WORKSPACE_HEAP_USED;
+      if( count.nbFree != count.nbAlloc )
+      {
+         printf( "TA_%s allocated %d and freed %d buffers with a thread workspace too small\n",
+                 test->name, count.nbAlloc, count.nbFree );
+         goto cleanup;
+      }
+   }
+
+   /* A workspace too small or missing. */
+   retValue = TA_TEST_WORKSPACE_CALL_FAILED;
+   if( size > 0 )
+   {
+      retCode = callFunc( test, in, startIdx, endIdx, useFloat, 1, workspace, size-1,
+                          &outBegIdx, &outNBElement, out );
+      if( retCode == TA_BAD_PARAM )
+         retCode = callFunc( test, in, startIdx, endIdx, useFloat, 1, NULL, size,
+                             &outBegIdx, &outNBElement, out );
+      if( retCode != TA_BAD_PARAM )
+      {
+         printf( "TA_%s_WS did not reject a bad workspace (%d)\n", test->name, retCode );
+         goto cleanup;
+      }
+   }
+
+   retValue = TA_TEST_PASS;
+
+cleanup:
+   free( workspace );
+   return retValue;
+}
+
+static ErrorNumber checkSame( const TA_WsTest *test, int nbOut, int startIdx, int endIdx,
+                              int refBegIdx, int refNBElement, double *ref[3],
+                              int outBegIdx, int outNBElement, double *out[3] )
+{
+   int i;
+
+   if( (outBegIdx != refBegIdx) || (outNBElement != refNBElement) )
+   {
+      printf( "TA_%s_WS output range differs\n", test->name );
+      return TA_TEST_WORKSPACE_NOT_SAME;
+   }
+
+   for( i=0; i < nbOut; i++ )
+   {
+      if( memcmp( ref[i], out[i], sizeof(double)*refNBElement ) )
+      {
+         printf( "TA_%s_WS output %d differs for [%d,%d]\n",
+                 test->name, i, startIdx, endIdx );
+         return TA_TEST_WORKSPACE_NOT_SAME;
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+static void *countAlloc( void *opaque, size_t size )
+{
+   ((TA_WsCount *)opaque)->nbAlloc++;
+   return malloc( size );
+}
+
+static void countFree( void *opaque, void *ptr, size_t size )
+{
+   (void)size;
+   ((TA_WsCount *)opaque)->nbFree++;
+   free( ptr );
+}
+
+static int workspaceSize( const TA_WsTest *test, int startIdx, int endIdx )
+{
+   const int *p = test->p;
+   const TA_MAType *ma = test->ma;
+
+   switch( test->func )
+   {
+   case WS_DEMA:
+      return TA_DEMA_Workspace( startIdx, endIdx, p[0] );
+   case WS_TEMA:
+      return TA_TEMA_Workspace( startIdx, endIdx, p[0] );
+   case WS_TRIX:
+      return TA_TRIX_Workspace( startIdx, endIdx, p[0] );
+   case WS_MA:
+      return TA_MA_Workspace( startIdx, endIdx, p[0], ma[0] );
+   case WS_APO:
+      return TA_APO_Workspace( startIdx, endIdx, p[0], p[1], ma[0] );
+   case WS_PPO:
+      return TA_PPO_Workspace( startIdx, endIdx, p[0], p[1], ma[0] );
+   case WS_MACD:
+      return TA_MACD_Workspace( startIdx, endIdx, p[0], p[1], p[2] );
+   case WS_MACDEXT:
+      return TA_MACDEXT_Workspace( startIdx, endIdx, p[0], ma[0], p[1], ma[1], p[2],
+                                   ma[2] );
+   case WS_STOCHF:
+      return TA_STOCHF_Workspace( startIdx, endIdx, p[0], p[1], ma[0] );
+   case WS_STOCH:
+      return TA_STOCH_Workspace( startIdx, endIdx, p[0], p[1], ma[0], p[2], ma[1] );
+   case WS_STOCHRSI:
+      return TA_STOCHRSI_Workspace( startIdx, endIdx, p[0], p[1], p[2], ma[0] );
+   case WS_NATR:
+      return TA_NATR_Workspace( startIdx, endIdx, p[0] );
+   case WS_ADXR:
+      return TA_ADXR_Workspace( startIdx, endIdx, p[0] );
+   case WS_CCI:
+      return TA_CCI_Workspace( startIdx, endIdx, p[0] );
+   case WS_MFI:
+      return TA_MFI_Workspace( startIdx, endIdx, p[0] );
+   }
+
+   return -1;
+}
+
+static TA_RetCode callFunc( const TA_WsTest *test, const TA_WsInputs *in,
+                            int startIdx, int endIdx, int useFloat,
+                            int useWorkspace, double *workspace, int workspaceSize,
+                            int *outBegIdx, int *outNBElement, double *out[3] )
+{
+   const int *p = test->p;
+   const TA_MAType *ma = test->ma;
+   TA_RetCode retCode;
+
+   switch( test->func )
+   {
+   case WS_DEMA:
+      if( !useFloat && !useWorkspace )
+         retCode = TA_DEMA( startIdx, endIdx, in->close, p[0], outBegIdx,
+                            outNBElement, out[0] );
+      else if( useFloat && !useWorkspace )
+         retCode = TA_S_DEMA( startIdx, endIdx, in->closeFloat, p[0], outBegIdx,
+                              outNBElement, out[0] );
+      else if( !useFloat )
+         retCode = TA_DEMA_WS( startIdx, endIdx, in->close, p[0], workspace,
+                               workspaceSize, outBegIdx, outNBElement, out[0] );
+      else
+         retCode = TA_S_DEMA_WS( startIdx, endIdx, in->closeFloat, p[0], workspace,
+                                 workspaceSize, outBegIdx, outNBElement, out[0] );
+      break;
+   case WS_TEMA:
+      if( !useFloat && !useWorkspace )
+         retCode = TA_TEMA( startIdx, endIdx, in->close, p[0], outBegIdx,
+                            outNBElement, out[0] );
+      else if( useFloat && !useWorkspace )
+         retCode = TA_S_TEMA( startIdx, endIdx, in->closeFloat, p[0], outBegIdx,
+                              outNBElement, out[0] );
+      else if( !useFloat )
+         retCode = TA_TEMA_WS( startIdx, endIdx, in->close, p[0], workspace,
+                               workspaceSize, outBegIdx, outNBElement, out[0] );
+      else
+         retCode = TA_S_TEMA_WS( startIdx, endIdx, in->closeFloat, p[0], workspace,
+                                 workspaceSize, outBegIdx, outNBElement, out[0] );
+      break;
+   case WS_TRIX:
+      if( !useFloat && !useWorkspace )
+         retCode = TA_TRIX( startIdx, endIdx, in->close, p[0], outBegIdx,
+                            outNBElement, out[0] );
+      else if( useFloat && !useWorkspace )
+         retCode = TA_S_TRIX( startIdx, endIdx, in->closeFloat, p[0], outBegIdx,
+                              outNBElement, out[0] );
+      else if( !useFloat )
+         retCode = TA_TRIX_WS( startIdx, endIdx, in->close, p[0], workspace,
+                               workspaceSize, outBegIdx, outNBElement, out[0] );
+      else
+         retCode = TA_S_TRIX_WS( startIdx, endIdx, in->closeFloat, p[0], workspace,
+                                 workspaceSize, outBegIdx, outNBElement, out[0] );
+      break;
+   case WS_MA:
+      if( !useFloat && !useWorkspace )
+         retCode = TA_MA( startIdx, endIdx, in->close, p[0], ma[0], outBegIdx,
+                          outNBElement, out[0] );
+      else if( useFloat && !useWorkspace )
+         retCode = TA_S_MA( startIdx, endIdx, in->closeFloat, p[0], ma[0],
+                            outBegIdx, outNBElement, out[0] );
+      else if( !useFloat )
+         retCode = TA_MA_WS( startIdx, endIdx, in->close, p[0], ma[0], workspace,
+                             workspaceSize, outBegIdx, outNBElement, out[0] );
+      else
+         retCode = TA_S_MA_WS( startIdx, endIdx, in->closeFloat, p[0], ma[0],
+                               workspace, workspaceSize, outBegIdx, outNBElement,
+                               out[0] );
+      break;
+   case WS_APO:
+      if( !useFloat && !useWorkspace )
+         retCode = TA_APO( startIdx, endIdx, in->close, p[0], p[1], ma[0],
+                           outBegIdx, outNBElement, out[0] );
+      else if( useFloat && !useWorkspace )
+         retCode = TA_S_APO( startIdx, endIdx, in->closeFloat, p[0], p[1], ma[0],
+                             outBegIdx, outNBElement, out[0] );
+      else if( !useFloat )
+         retCode = TA_APO_WS( startIdx, endIdx, in->close, p[0], p[1], ma[0],
+                              workspace, workspaceSize, outBegIdx, outNBElement,
+                              out[0] );
+      else
+         retCode = TA_S_APO_WS( startIdx, endIdx, in->closeFloat, p[0], p[1], ma[0],
+                                workspace, workspaceSize, outBegIdx, outNBElement,
+                                out[0] );
+      break;
+   case WS_PPO:
+      if( !useFloat && !useWorkspace )
+         retCode = TA_PPO( startIdx, endIdx, in->close, p[0], p[1], ma[0],
+                           outBegIdx, outNBElement, out[0] );
+      else if( useFloat && !useWorkspace )
+         retCode = TA_S_PPO( startIdx, endIdx, in->closeFloat, p[0], p[1], ma[0],
+                             outBegIdx, outNBElement, out[0] );
+      else if( !useFloat )
+         retCode = TA_PPO_WS( startIdx, endIdx, in->close, p[0], p[1], ma[0],
+                              workspace, workspaceSize, outBegIdx, outNBElement,
+                              out[0] );
+      else
+         retCode = TA_S_PPO_WS( startIdx, endIdx, in->closeFloat, p[0], p[1], ma[0],
+                                workspace, workspaceSize, outBegIdx, outNBElement,
+                                out[0] );
+      break;
+   case WS_MACD:
+      if( !useFloat && !useWorkspace )
+         retCode = TA_MACD( startIdx, endIdx, in->close, p[0], p[1], p[2],
+                            outBegIdx, outNBElement, out[0], out[1], out[2] );
+      else if( useFloat && !useWorkspace )
+         retCode = TA_S_MACD( startIdx, endIdx, in->closeFloat, p[0], p[1], p[2],
+                              outBegIdx, outNBElement, out[0], out[1], out[2] );
+      else if( !useFloat )
+         retCode = TA_MACD_WS( startIdx, endIdx, in->close, p[0], p[1], p[2],
+                               workspace, workspaceSize, outBegIdx, outNBElement,
+                               out[0], out[1], out[2] );
+      else
+         retCode = TA_S_MACD_WS( startIdx, endIdx, in->closeFloat, p[0], p[1], p[2],
+                                 workspace, workspaceSize, outBegIdx, outNBElement,
+                                 out[0], out[1], out[2] );
+      break;
+   case WS_MACDEXT:
+      if( !useFloat && !useWorkspace )
+         retCode = TA_MACDEXT( startIdx, endIdx, in->close, p[0], ma[0], p[1],
+                               ma[1], p[2], ma[2], outBegIdx, outNBElement, out[0],
+                               out[1], out[2] );
+      else if( useFloat && !useWorkspace )
+         retCode = TA_S_MACDEXT( startIdx, endIdx, in->closeFloat, p[0], ma[0],
+                                 p[1], ma[1], p[2], ma[2], outBegIdx, outNBElement,
+                                 out[0], out[1], out[2] );
+      else if( !useFloat )
+         retCode = TA_MACDEXT_WS( startIdx, endIdx, in->close, p[0], ma[0], p[1],
+                                  ma[1], p[2], ma[2], workspace, workspaceSize,
+                                  outBegIdx, outNBElement, out[0], out[1], out[2] );
+      else
+         retCode = TA_S_MACDEXT_WS( startIdx, endIdx, in->closeFloat, p[0], ma[0],
+                                    p[1], ma[1], p[2], ma[2], workspace,
+                                    workspaceSize, outBegIdx, outNBElement, out[0],
+                                    out[1], out[2] );
+      break;
+   case WS_STOCHF:
+      if( !useFloat && !useWorkspace )
+         retCode = TA_STOCHF( startIdx, endIdx, in->high, in->low, in->close, p[0],
+                              p[1], ma[0], outBegIdx, outNBElement, out[0], out[1] );
+      else if( useFloat && !useWorkspace )
+         retCode = TA_S_STOCHF( startIdx, endIdx, in->highFloat, in->lowFloat,
+                                in->closeFloat, p[0], p[1], ma[0], outBegIdx,
+                                outNBElement, out[0], out[1] );
+      else if( !useFloat )
+         retCode = TA_STOCHF_WS( startIdx, endIdx, in->high, in->low, in->close,
+                                 p[0], p[1], ma[0], workspace, workspaceSize,
+                                 outBegIdx, outNBElement, out[0], out[1] );
+      else
+         retCode = TA_S_STOCHF_WS( startIdx, endIdx, in->highFloat, in->lowFloat,
+                                   in->closeFloat, p[0], p[1], ma[0], workspace,
+                                   workspaceSize, outBegIdx, outNBElement, out[0],
+                                   out[1] );
+      break;
+   case WS_STOCH:
+      if( !useFloat && !useWorkspace )
+         retCode = TA_STOCH( startIdx, endIdx, in->high, in->low, in->close, p[0],
+                             p[1], ma[0], p[2], ma[1], outBegIdx, outNBElement,
+                             out[0], out[1] );
+      else if( useFloat && !useWorkspace )
+         retCode = TA_S_STOCH( startIdx, endIdx, in->highFloat, in->lowFloat,
+                               in->closeFloat, p[0], p[1], ma[0], p[2], ma[1],
+                               outBegIdx, outNBElement, out[0], out[1] );
+      else if( !useFloat )
+         retCode = TA_STOCH_WS( startIdx, endIdx, in->high, in->low, in->close,
+                                p[0], p[1], ma[0], p[2], ma[1], workspace,
+                                workspaceSize, outBegIdx, outNBElement, out[0],
+                                out[1] );
+      else
+         retCode = TA_S_STOCH_WS( startIdx, endIdx, in->highFloat, in->lowFloat,
+                                  in->closeFloat, p[0], p[1], ma[0], p[2], ma[1],
+                                  workspace, workspaceSize, outBegIdx, outNBElement,
+                                  out[0], out[1] );
+      break;
+   case WS_STOCHRSI:
+      if( !useFloat && !useWorkspace )
+         retCode = TA_STOCHRSI( startIdx, endIdx, in->close, p[0], p[1], p[2],
+                                ma[0], outBegIdx, outNBElement, out[0], out[1] );
+      else if( useFloat && !useWorkspace )
+         retCode = TA_S_STOCHRSI( startIdx, endIdx, in->closeFloat, p[0], p[1],
+                                  p[2], ma[0], outBegIdx, outNBElement, out[0],
+                                  out[1] );
+      else if( !useFloat )
+         retCode = TA_STOCHRSI_WS( startIdx, endIdx, in->close, p[0], p[1], p[2],
+                                   ma[0], workspace, workspaceSize, outBegIdx,
+                                   outNBElement, out[0], out[1] );
+      else
+         retCode = TA_S_STOCHRSI_WS( startIdx, endIdx, in->closeFloat, p[0], p[1],
+                                     p[2], ma[0], workspace, workspaceSize,
+                                     outBegIdx, outNBElement, out[0], out[1] );
+      break;
+   case WS_NATR:
+      if( !useFloat && !useWorkspace )
+         retCode = TA_NATR( startIdx, endIdx, in->high, in->low, in->close, p[0],
+                            outBegIdx, outNBElement, out[0] );
+      else if( useFloat && !useWorkspace )
+         retCode = TA_S_NATR( startIdx, endIdx, in->highFloat, in->lowFloat,
+                              in->closeFloat, p[0], outBegIdx, outNBElement, out[0] );
+      else if( !useFloat )
+         retCode = TA_NATR_WS( startIdx, endIdx, in->high, in->low, in->close, p[0],
+                               workspace, workspaceSize, outBegIdx, outNBElement,
+                               out[0] );
+      else
+         retCode = TA_S_NATR_WS( startIdx, endIdx, in->highFloat, in->lowFloat,
+                                 in->closeFloat, p[0], workspace, workspaceSize,
+                                 outBegIdx, outNBElement, out[0] );
+      break;
+   case WS_ADXR:
+      if( !useFloat && !useWorkspace )
+         retCode = TA_ADXR( startIdx, endIdx, in->high, in->low, in->close, p[0],
+                            outBegIdx, outNBElement, out[0] );
+      else if( useFloat && !useWorkspace )
+         retCode = TA_S_ADXR( startIdx, endIdx, in->highFloat, in->lowFloat,
+                              in->closeFloat, p[0], outBegIdx, outNBElement, out[0] );
+      else if( !useFloat )
+         retCode = TA_ADXR_WS( startIdx, endIdx, in->high, in->low, in->close, p[0],
+                               workspace, workspaceSize, outBegIdx, outNBElement,
+                               out[0] );
+      else
+         retCode = TA_S_ADXR_WS( startIdx, endIdx, in->highFloat, in->lowFloat,
+                                 in->closeFloat, p[0], workspace, workspaceSize,
+                                 outBegIdx, outNBElement, out[0] );
+      break;
+   case WS_CCI:
+      if( !useFloat && !useWorkspace )
+         retCode = TA_CCI( startIdx, endIdx, in->high, in->low, in->close, p[0],
+                           outBegIdx, outNBElement, out[0] );
+      else if( useFloat && !useWorkspace )
+         retCode = TA_S_CCI( startIdx, endIdx, in->highFloat, in->lowFloat,
+                             in->closeFloat, p[0], outBegIdx, outNBElement, out[0] );
+      else if( !useFloat )
+         retCode = TA_CCI_WS( startIdx, endIdx, in->high, in->low, in->close, p[0],
+                              workspace, workspaceSize, outBegIdx, outNBElement,
+                              out[0] );
+      else
+         retCode = TA_S_CCI_WS( startIdx, endIdx, in->highFloat, in->lowFloat,
+                                in->closeFloat, p[0], workspace, workspaceSize,
+                                outBegIdx, outNBElement, out[0] );
+      break;
+   case WS_MFI:
+      if( !useFloat && !useWorkspace )
+         retCode = TA_MFI( startIdx, endIdx, in->high, in->low, in->close,
+                           in->volume, p[0], outBegIdx, outNBElement, out[0] );
+      else if( useFloat && !useWorkspace )
+         retCode = TA_S_MFI( startIdx, endIdx, in->highFloat, in->lowFloat,
+                             in->closeFloat, in->volumeFloat, p[0], outBegIdx,
+                             outNBElement, out[0] );
+      else if( !useFloat )
+         retCode = TA_MFI_WS( startIdx, endIdx, in->high, in->low, in->close,
+                              in->volume, p[0], workspace, workspaceSize, outBegIdx,
+                              outNBElement, out[0] );
+      else
+         retCode = TA_S_MFI_WS( startIdx, endIdx, in->highFloat, in->lowFloat,
+                                in->closeFloat, in->volumeFloat, p[0], workspace,
+                                workspaceSize, outBegIdx, outNBElement, out[0] );
+      break;
+   default:
+      retCode = TA_BAD_PARAM;
+      break;
+   }
+
+   return retCode;
+}
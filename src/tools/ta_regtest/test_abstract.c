@@ -105,6 +105,8 @@ typedef enum
 /**** Local functions declarations.    ****/
 static ErrorNumber testLookback(TA_ParamHolder *paramHolder );
 static ErrorNumber test_default_calls(void);
+static ErrorNumber test_func_id(void);
+static void testFuncId( const TA_FuncInfo *funcInfo, void *opaqueData );
 static ErrorNumber callWithDefaults( const char *funcName,
 									 const double *input,
 									 const int *input_int, int size );
@@ -176,6 +178,11 @@ ErrorNumber test_abstract( void )
    if( retValue != TA_TEST_PASS )
       return retValue;
 
+   /* Verify the handles by name and by id. */
+   retValue = test_func_id();
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
    /* Call all the TA functions through the abstract interface. */
    retValue = allocLib();
    if( retValue != TA_TEST_PASS )
@@ -521,6 +528,73 @@ static ErrorNumber callWithDefaults( const char *funcName, const double *input,
    return TA_TEST_PASS;
 }
 
+static ErrorNumber test_func_id(void)
+{
+   ErrorNumber errNumber;
+   const TA_FuncHandle *handle;
+   const TA_FuncInfo *funcInfo;
+   unsigned int id;
+
+   /* These ids must never change. */
+   static const struct { const char *name; unsigned int id; } fixedId[] =
+   {
+      { "ACCBANDS", 1 }, { "RSI", 135 }, { "SMA", 140 }, { "WMA", 161 }
+   };
+
+   for( id=0; id < sizeof(fixedId)/sizeof(fixedId[0]); id++ )
+   {
+      if( (TA_GetFuncHandleById( fixedId[id].id, &handle ) != TA_SUCCESS) ||
+          (TA_GetFuncInfo( handle, &funcInfo ) != TA_SUCCESS) ||
+          (strcmp( funcInfo->name, fixedId[id].name ) != 0) )
+      {
+         printf( "Fail: %s is not the id %u\n", fixedId[id].name, fixedId[id].id );
+         return TA_ABS_TST_FAIL_FUNC_ID;
+      }
+   }
+
+   /* Not functions. */
+   if( (TA_GetFuncHandle( "SMAX", &handle ) != TA_FUNC_NOT_FOUND) ||
+       (TA_GetFuncHandle( "sma", &handle ) != TA_FUNC_NOT_FOUND) ||
+       (TA_GetFuncHandle( "S", &handle ) != TA_FUNC_NOT_FOUND) ||
+       (TA_GetFuncHandle( "_SMA", &handle ) != TA_FUNC_NOT_FOUND) ||
+       (TA_GetFuncHandle( "", &handle ) != TA_BAD_PARAM) ||
+       (TA_GetFuncHandleById( 0, &handle ) != TA_FUNC_NOT_FOUND) ||
+       (TA_GetFuncHandleById( TA_GetFuncIdMax()+1, &handle ) != TA_FUNC_NOT_FOUND) ||
+       (TA_GetFuncId( NULL, &id ) != TA_BAD_PARAM) )
+   {
+      printf( "Fail: TA_GetFuncHandle or TA_GetFuncHandleById found a bad name or id\n" );
+      return TA_ABS_TST_FAIL_FUNC_ID;
+   }
+
+   /* Every function, by name and by id. */
+   errNumber = TA_TEST_PASS;
+   TA_ForEachFunc( testFuncId, &errNumber );
+
+   return errNumber;
+}
+
+static void testFuncId( const TA_FuncInfo *funcInfo, void *opaqueData )
+{
+   ErrorNumber *errNumber;
+   const TA_FuncHandle *handle, *handleById;
+   unsigned int id;
+
+   errNumber = (ErrorNumber *)opaqueData;
+   if( *errNumber != TA_TEST_PASS )
+      return;
+
+   if( (TA_GetFuncHandle( funcInfo->name, &handle ) != TA_SUCCESS) ||
+       (handle != funcInfo->handle) ||
+       (TA_GetFuncId( handle, &id ) != TA_SUCCESS) ||
+       (id == 0) || (id > TA_GetFuncIdMax()) ||
+       (TA_GetFuncHandleById( id, &handleById ) != TA_SUCCESS) ||
+       (handleById != handle) )
+   {
+      printf( "Fail: handle or id of %s\n", funcInfo->name );
+      *errNumber = TA_ABS_TST_FAIL_FUNC_ID;
+   }
+}
+
 static ErrorNumber test_default_calls(void)
 {
    ErrorNumber errNumber;